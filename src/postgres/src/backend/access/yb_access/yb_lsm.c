@@ -434,7 +434,23 @@ ybcingettuple(IndexScanDesc scan, ScanDirection dir)
 	 */
 	scan->xs_ctup.t_ybctid = 0;
 	bool has_tuple = false;
-	if (ybscan->prepare_params.index_only_scan)
+	if (ybscan->prepare_params.index_only_scan &&
+		!scan->indexRelation->rd_index->indisprimary)
+	{
+		/*
+		 * IndexOnlyScan(Table, SecondaryIndex) --> HeapTuple in the index
+		 * format, see ybcFetchNextIndexHeapTuple.
+		 */
+		HeapTuple tuple = ybc_getnext_index_heaptuple(ybscan, dir,
+													  &scan->xs_recheck);
+		if (tuple)
+		{
+			scan->xs_hitup = tuple;
+			scan->xs_hitupdesc = RelationGetDescr(scan->indexRelation);
+			has_tuple = true;
+		}
+	}
+	else if (ybscan->prepare_params.index_only_scan)
 	{
 		IndexTuple tuple = ybc_getnext_indextuple(ybscan, dir, &scan->xs_recheck);
 		if (tuple)
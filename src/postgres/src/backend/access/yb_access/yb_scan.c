@@ -407,6 +407,9 @@ static HeapTuple ybcFetchNextHeapTuple(YbScanDesc ybScan, ScanDirection dir)
 		else if (ScanDirectionIsBackward(dir))
 			HandleYBStatus(YBCPgSetForwardScan(ybScan->handle, false));
 
+		/* Fetched values are copied into the formed tuple before the next fetch. */
+		HandleYBStatus(YBCPgSetBorrowFetchedValues(ybScan->handle, true));
+
 		HandleYBStatus(YBCPgExecSelect(ybScan->handle, ybScan->exec_params));
 		ybScan->is_exec_done = true;
 	}
@@ -469,17 +472,15 @@ static HeapTuple ybcFetchNextHeapTuple(YbScanDesc ybScan, ScanDirection dir)
 	return tuple;
 }
 
-static IndexTuple
-ybcFetchNextIndexTuple(YbScanDesc ybScan, ScanDirection dir)
+/*
+ * Fetch the values of the next row of an index scan, in the order of the
+ * target descriptor columns.
+ */
+static bool
+ybcFetchNextIndexValues(YbScanDesc ybScan, ScanDirection dir, Datum *values,
+						bool *nulls, YBCPgSysColumns *syscols)
 {
-	IndexTuple tuple    = NULL;
-	bool       has_data = false;
-	Relation   index    = ybScan->index;
-	TupleDesc  tupdesc  = ybScan->target_desc;
-
-	Datum           *values = (Datum *) palloc0(tupdesc->natts * sizeof(Datum));
-	bool            *nulls = (bool *) palloc(tupdesc->natts * sizeof(bool));
-	YBCPgSysColumns syscols;
+	bool has_data = false;
 
 	/* Execute the select statement. */
 	if (!ybScan->is_exec_done)
@@ -490,19 +491,35 @@ ybcFetchNextIndexTuple(YbScanDesc ybScan, ScanDirection dir)
 		else if (ScanDirectionIsBackward(dir))
 			HandleYBStatus(YBCPgSetForwardScan(ybScan->handle, false));
 
+		/* Fetched values are copied into the formed tuple before the next fetch. */
+		HandleYBStatus(YBCPgSetBorrowFetchedValues(ybScan->handle, true));
+
 		HandleYBStatus(YBCPgExecSelect(ybScan->handle, ybScan->exec_params));
 		ybScan->is_exec_done = true;
 	}
 
 	/* Fetch one row. */
 	HandleYBStatus(YBCPgDmlFetch(ybScan->handle,
-	                             tupdesc->natts,
+	                             ybScan->target_desc->natts,
 	                             (uint64_t *) values,
 	                             nulls,
-	                             &syscols,
+	                             syscols,
 	                             &has_data));
+	return has_data;
+}
 
-	if (has_data)
+static IndexTuple
+ybcFetchNextIndexTuple(YbScanDesc ybScan, ScanDirection dir)
+{
+	IndexTuple tuple    = NULL;
+	Relation   index    = ybScan->index;
+	TupleDesc  tupdesc  = ybScan->target_desc;
+
+	Datum           *values = (Datum *) palloc0(tupdesc->natts * sizeof(Datum));
+	bool            *nulls = (bool *) palloc(tupdesc->natts * sizeof(bool));
+	YBCPgSysColumns syscols;
+
+	if (ybcFetchNextIndexValues(ybScan, dir, values, nulls, &syscols))
 	{
 		/*
 		 * Return the IndexTuple. If this is a primary key, reorder the values first as expected
@@ -546,6 +563,39 @@ ybcFetchNextIndexTuple(YbScanDesc ybScan, ScanDirection dir)
 	return tuple;
 }
 
+/*
+ * Same as ybcFetchNextIndexTuple for a secondary index, but the row is returned
+ * as a heap tuple in the format of the index descriptor. Unlike an IndexTuple,
+ * a heap tuple is neither limited in size nor has its large values compressed,
+ * so index-only scans return included columns of any size as they are.
+ */
+static HeapTuple
+ybcFetchNextIndexHeapTuple(YbScanDesc ybScan, ScanDirection dir)
+{
+	HeapTuple  tuple    = NULL;
+	TupleDesc  tupdesc  = ybScan->target_desc;
+
+	Datum           *values = (Datum *) palloc0(tupdesc->natts * sizeof(Datum));
+	bool            *nulls = (bool *) palloc(tupdesc->natts * sizeof(bool));
+	YBCPgSysColumns syscols;
+
+	Assert(!ybScan->index->rd_index->indisprimary);
+	if (ybcFetchNextIndexValues(ybScan, dir, values, nulls, &syscols))
+	{
+		tuple = heap_form_tuple(tupdesc, values, nulls);
+		if (syscols.ybbasectid != NULL)
+		{
+			tuple->t_ybctid = PointerGetDatum(syscols.ybbasectid);
+			ybcUpdateFKCache(ybScan, tuple->t_ybctid);
+		}
+		tuple->t_tableOid = RelationGetRelid(ybScan->relation);
+	}
+	pfree(values);
+	pfree(nulls);
+
+	return tuple;
+}
+
 /*
  * Set up scan plan.
  * This function sets up target and bind columns for each type of scans.
@@ -2592,6 +2642,16 @@ ybc_getnext_indextuple(YbScanDesc ybScan, ScanDirection dir, bool *recheck)
 	return ybcFetchNextIndexTuple(ybScan, dir);
 }
 
+HeapTuple
+ybc_getnext_index_heaptuple(YbScanDesc ybScan, ScanDirection dir,
+							bool *recheck)
+{
+	if (ybScan->quit_scan)
+		return NULL;
+	*recheck = YbNeedsRecheck(ybScan);
+	return ybcFetchNextIndexHeapTuple(ybScan, dir);
+}
+
 bool
 ybc_getnext_aggslot(IndexScanDesc scan, YBCPgStatement handle,
 					bool index_only_scan)
@@ -219,6 +219,60 @@ YbDataTypeIsValidForKey(Oid type_id)
 	return YBCPgAllowForPrimaryKey(type_entity);
 }
 
+bool
+YbGetArrayElemTypeProps(Oid elemtype, int16 *typlen, bool *typbyval,
+						char *typalign)
+{
+	switch (elemtype)
+	{
+		case BOOLOID:
+		case CHAROID:
+			*typlen = 1;
+			*typbyval = true;
+			*typalign = 'c';
+			return true;
+		case INT2OID:
+			*typlen = sizeof(int16);
+			*typbyval = true;
+			*typalign = 's';
+			return true;
+		case INT4OID:
+		case OIDOID:
+		case FLOAT4OID:
+		case DATEOID:
+			*typlen = sizeof(int32);
+			*typbyval = true;
+			*typalign = 'i';
+			return true;
+		case INT8OID:
+		case FLOAT8OID:
+		case TIMEOID:
+		case TIMESTAMPOID:
+		case TIMESTAMPTZOID:
+			*typlen = sizeof(int64);
+			*typbyval = FLOAT8PASSBYVAL;
+			*typalign = 'd';
+			return true;
+		case UUIDOID:
+			*typlen = UUID_LEN;
+			*typbyval = false;
+			*typalign = 'c';
+			return true;
+		case TEXTOID:
+		case VARCHAROID:
+		case BPCHAROID:
+		case BYTEAOID:
+		case NUMERICOID:
+		case JSONBOID:
+			*typlen = -1;
+			*typbyval = false;
+			*typalign = 'i';
+			return true;
+		default:
+			return false;
+	}
+}
+
 const YBCPgTypeEntity *
 YbDataTypeFromName(TypeName *typeName)
 {
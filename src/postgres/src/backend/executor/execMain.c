@@ -316,7 +316,10 @@ standard_ExecutorRun(QueryDesc *queryDesc,
 	Assert(!(estate->es_top_eflags & EXEC_FLAG_EXPLAIN_ONLY));
 
 	if (IsYugaByteEnabled())
+	{
+		YBPredictGlobalTransaction(estate->es_range_table);
 		YBBeginOperationsBuffering();
+	}
 
 	/*
 	 * Switch into per-query memory context
@@ -36,6 +36,7 @@
 #include "executor/nodeYbBatchedNestloop.h"
 #include "nodes/relation.h"
 #include "miscadmin.h"
+#include "utils/datum.h"
 #include "utils/memutils.h"
 
 
@@ -695,6 +696,41 @@ EndTS(YbBatchedNestLoopState *bnlstate)
 	bnlstate->bnl_batchMatchedInfo = NIL;
 }
 
+/*
+ * Whether the outer tuple in slot has the same values of the batched params as
+ * the outer tuple that occupies the batch slot preceding batchno. Values are
+ * compared binary, so equal values with different representations are not
+ * detected, which only costs a batch slot.
+ */
+static bool
+OuterParamsEqualPrevious(YbBatchedNestLoopState *bnlstate,
+						 ExprContext *econtext, TupleTableSlot *slot,
+						 int batchno)
+{
+	YbBatchedNestLoop *batchnl = (YbBatchedNestLoop *) bnlstate->js.ps.plan;
+	TupleDesc	tupdesc = slot->tts_tupleDescriptor;
+	ListCell   *lc;
+
+	foreach(lc, batchnl->nl.nestParams)
+	{
+		NestLoopParam *nlp = (NestLoopParam *) lfirst(lc);
+		ParamExecData *prev =
+			&(econtext->ecxt_param_exec_vals[nlp->paramno + batchno - 1]);
+		AttrNumber	attno = nlp->paramval->varattno;
+		Form_pg_attribute attr = TupleDescAttr(tupdesc, attno - 1);
+		bool		isnull;
+		Datum		value = slot_getattr(slot, attno, &isnull);
+
+		/* NULL keys never match, so a run of them needs a single slot too */
+		if (isnull != prev->isnull)
+			return false;
+		if (!isnull &&
+			!datumIsEqual(value, prev->value, attr->attbyval, attr->attlen))
+			return false;
+	}
+	return true;
+}
+
 bool
 CreateBatch(YbBatchedNestLoopState *bnlstate, ExprContext *econtext)
 {
@@ -702,9 +738,11 @@ CreateBatch(YbBatchedNestLoopState *bnlstate, ExprContext *econtext)
 	TupleTableSlot *outerTupleSlot = NULL;
 	PlanState  *outerPlan = outerPlanState(bnlstate);
 	PlanState  *innerPlan = innerPlanState(bnlstate);
+	int batch_size = GetBatchSize(batchnl);
+	int batchno = 0;
 	LOCAL_JOIN_FN(FreeBatch, bnlstate);
 
-	for (int batchno = 0; batchno < GetBatchSize(batchnl); batchno++)
+	while (batchno < batch_size)
 	{
 		elog(DEBUG2, "getting new outer tuple");
 		if (!bnlstate->bnl_outerdone)
@@ -734,6 +772,17 @@ CreateBatch(YbBatchedNestLoopState *bnlstate, ExprContext *econtext)
 			elog(DEBUG2, "saving new outer tuple information");
 			econtext->ecxt_outertuple = outerTupleSlot;
 			LOCAL_JOIN_FN(AddTupleToOuterBatch, bnlstate, outerTupleSlot);
+
+			/*
+			 * Outer tuples often come in runs of the same join key, e.g. from
+			 * an index scan on a non unique column. Such a tuple is still
+			 * joined as part of the batch, but its key is already shipped to
+			 * the inner side, so it should not take a slot of the batch.
+			 */
+			if (batchno > 0 &&
+				OuterParamsEqualPrevious(bnlstate, econtext, outerTupleSlot,
+										 batchno))
+				continue;
 		}
 
 		/*
@@ -766,6 +815,7 @@ CreateBatch(YbBatchedNestLoopState *bnlstate, ExprContext *econtext)
 			innerPlan->chgParam = bms_add_member(innerPlan->chgParam,
 												 paramno);
 		}
+		batchno++;
 	}
 
 	LOCAL_JOIN_FN(ResetBatch, bnlstate, econtext);
@@ -378,6 +378,38 @@ bool yb_pushdown_walker(Node *node, List **colrefs)
 			}
 			break;
 		}
+		case T_ScalarArrayOpExpr:
+		{
+			ScalarArrayOpExpr *saop = castNode(ScalarArrayOpExpr, node);
+			Oid			elemtype;
+			int16		elmlen;
+			bool		elmbyval;
+			char		elmalign;
+			/*
+			 * Unsafe to pushdown function if collation is not C, there may be
+			 * needed metadata lookup for collation details.
+			 */
+			if (YBIsCollationValidNonC(saop->inputcollid))
+			{
+				return true;
+			}
+			if (!yb_can_pushdown_func(saop->opfuncid))
+			{
+				return true;
+			}
+			/*
+			 * DocDB has to deconstruct the array without catalog access, so
+			 * the element storage properties must be known upfront.
+			 */
+			elemtype = get_element_type(exprType(lsecond(saop->args)));
+			if (!OidIsValid(elemtype) ||
+				!YbGetArrayElemTypeProps(elemtype, &elmlen, &elmbyval,
+										 &elmalign))
+			{
+				return true;
+			}
+			break;
+		}
 		case T_CaseExpr:
 		{
 			CaseExpr *case_expr = castNode(CaseExpr, node);
@@ -415,6 +447,7 @@ bool yb_pushdown_walker(Node *node, List **colrefs)
 		}
 		case T_RelabelType:
 		case T_NullTest:
+		case T_BooleanTest:
 		case T_BoolExpr:
 		case T_CaseWhen:
 			break;
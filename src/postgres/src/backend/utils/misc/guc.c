@@ -6102,6 +6102,10 @@ ResetAllOptions(void)
 {
 	int			i;
 
+	/* Session parameters of the attached client are lost. */
+	if (YbIsClientYsqlConnMgr())
+		YbInvalidateLoadedClientState();
+
 	for (i = 0; i < num_guc_variables; i++)
 	{
 		struct config_generic *gconf = guc_variables[i];
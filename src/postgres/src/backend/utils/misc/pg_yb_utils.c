@@ -131,16 +131,23 @@ YbGetLastKnownCatalogCacheVersion()
 YBCPgLastKnownCatalogVersionInfo
 YbGetCatalogCacheVersionForTablePrefetching()
 {
-	// TODO: In future YBGetLastKnownCatalogCacheVersion must be used instead of
-	//       YbGetMasterCatalogVersion to reduce numer of RPCs to a master.
-	//       But this requires some additional changes. This optimization will
-	//       be done separately.
 	uint64_t version = YB_CATCACHE_VERSION_UNINITIALIZED;
 	bool is_db_catalog_version_mode = YBIsDBCatalogVersionMode();
 	if (*YBCGetGFlags()->ysql_enable_read_request_caching)
 	{
-		YBCPgResetCatalogReadTime();
-		version = YbGetMasterCatalogVersion();
+		/*
+		 * Use the last version known to the local tserver (or to this backend),
+		 * so backends of the tserver share cached catalog responses without
+		 * reading the version from a master. When that version is behind
+		 * the master, the backend refreshes its caches once the tserver learns
+		 * the new version, as any other backend does.
+		 */
+		version = YbGetLastKnownCatalogCacheVersion();
+		if (version == YB_CATCACHE_VERSION_UNINITIALIZED)
+		{
+			YBCPgResetCatalogReadTime();
+			version = YbGetMasterCatalogVersion();
+		}
 	}
 	return (YBCPgLastKnownCatalogVersionInfo){
 		.version = version,
@@ -3524,6 +3531,33 @@ bool YBCIsRegionLocal(Relation rel) {
 			cost <= yb_interzone_cost;
 }
 
+void YBPredictGlobalTransaction(List *rangeTable) {
+	ListCell *l;
+
+	if (yb_force_global_transaction || !YBTransactionsEnabled())
+		return;
+
+	foreach(l, rangeTable)
+	{
+		RangeTblEntry *rte = (RangeTblEntry *) lfirst(l);
+		Relation	rel;
+		bool		is_remote;
+
+		if (rte->rtekind != RTE_RELATION)
+			continue;
+		rel = RelationIdGetRelation(rte->relid);
+		if (!RelationIsValid(rel))
+			continue;
+		is_remote = IsYBRelation(rel) && !IsSystemRelation(rel) && !YBCIsRegionLocal(rel);
+		RelationClose(rel);
+		if (is_remote)
+		{
+			HandleYBStatus(YBCPgExpectGlobalTransaction());
+			return;
+		}
+	}
+}
+
 bool check_yb_xcluster_consistency_level(char** newval, void** extra, GucSource source) {
 	int newConsistency = XCLUSTER_CONSISTENCY_TABLET;
 	if (strcmp(*newval, "tablet") == 0)
@@ -111,6 +111,13 @@ struct ysql_conn_mgr_shmem_header
 	 */
 	uint32_t session_parameter_array_len;
 
+	/*
+	 * Incremented each time the stored session parameters are updated, so a
+	 * backend could tell whether it still has the latest session state of the
+	 * client.
+	 */
+	uint64_t session_parameters_version;
+
 	Oid database;
 	Oid user;
 	bool is_superuser;
@@ -140,6 +147,22 @@ struct changed_session_parameters_list *yb_changed_session_parameters = NULL;
 
 int yb_logical_client_shmem_key = -1;
 
+/*
+ * Client whose session state was last loaded into this backend, and the version
+ * of the loaded state. With transaction level pooling the same client is often
+ * attached to the same backend again. If no other client used the backend in
+ * between and the state of the client is unchanged, there is no need to reset
+ * and replay its session parameters.
+ */
+static int yb_loaded_client_shmem_key = -1;
+static uint64_t yb_loaded_client_state_version = 0;
+
+void
+YbInvalidateLoadedClientState()
+{
+	yb_loaded_client_shmem_key = -1;
+}
+
 int
 get_shmem_size(const int array_len)
 {
@@ -162,9 +185,16 @@ YbCleanChangedSessionParameters()
 void
 YbAddToChangedSessionParametersList(const char *session_parameter_name)
 {
-	if (session_parameter_name == NULL || yb_logical_client_shmem_key == -1)
+	if (session_parameter_name == NULL)
 		return;
 
+	if (yb_logical_client_shmem_key == -1)
+	{
+		/* The change is not stored for any client. */
+		YbInvalidateLoadedClientState();
+		return;
+	}
+
 	/* 
 	 * Length of `session_parameter_name` should be less than
 	 * SHMEM_MAX_STRING_LEN.
@@ -174,6 +204,7 @@ YbAddToChangedSessionParametersList(const char *session_parameter_name)
 		/* TODO (janand) GH #18302 Handle this exception at the Ysql Conn Mgr
 		 * side.
 		 */
+		YbInvalidateLoadedClientState();
 		ereport(WARNING, (errmsg("Unable to store session parameter '%s' in the "
 							   "shared memory. Length of session parameter "
 							   "(%d) exceeds the max limit(%d).",
@@ -405,6 +436,7 @@ update_session_parameters(struct shmem_session_parameter *shmem_parameter_list,
 
 			case ERROR_WHILE_STORING_SESSION_PARAMETER:
 				// Error while storing the session parameter
+				YbInvalidateLoadedClientState();
 				ereport(WARNING, (errmsg("Unable to store the session parameter "
 									   "%s",
 									   session_parameter_name)));
@@ -415,9 +447,12 @@ update_session_parameters(struct shmem_session_parameter *shmem_parameter_list,
 				if (add_session_parameter(shmem_parameter_list,
 										  session_parameter_name,
 										  shmem_itr) < 0)
+				{
+					YbInvalidateLoadedClientState();
 					ereport(WARNING, (errmsg("Unable to store the session "
 										   "parameter %s",
 										   session_parameter_name)));
+				}
 				break;
 
 			case SUCCESSFULLY_UPDATED_SHMEM_VALUE:
@@ -457,20 +492,37 @@ YbUpdateSharedMemory()
 	if (yb_changed_session_parameters == NULL)
 		return;
 
-	if (resize_shmem_if_needed(shmem_id) < 0)
-		return;
-
 	char *shmem_ptr;
-	if (attach_shmem(shmem_id, &shmem_ptr) < 0)
+	if (resize_shmem_if_needed(shmem_id) < 0 ||
+		attach_shmem(shmem_id, &shmem_ptr) < 0)
+	{
+		YbInvalidateLoadedClientState();
 		return;
+	}
 
-	struct ysql_conn_mgr_shmem_header shmem_header;
-	memcpy(&shmem_header, shmem_ptr, sizeof(shmem_header));
+	struct ysql_conn_mgr_shmem_header *shmem_header =
+		(struct ysql_conn_mgr_shmem_header *) shmem_ptr;
+
+	/*
+	 * This backend keeps the state of the client as stored in the shared
+	 * memory only if it had the previous version of the state.
+	 */
+	bool had_loaded_state =
+		yb_loaded_client_shmem_key == shmem_id &&
+		yb_loaded_client_state_version ==
+			shmem_header->session_parameters_version;
 
 	update_session_parameters(
 		(struct shmem_session_parameter
 			 *) (shmem_ptr + sizeof(struct ysql_conn_mgr_shmem_header)),
-		shmem_header.session_parameter_array_len);
+		shmem_header->session_parameter_array_len);
+	++shmem_header->session_parameters_version;
+
+	if (had_loaded_state && yb_loaded_client_shmem_key == shmem_id)
+		yb_loaded_client_state_version =
+			shmem_header->session_parameters_version;
+	else
+		YbInvalidateLoadedClientState();
 
 	detach_shmem(shmem_id, shmem_ptr);
 }
@@ -526,12 +578,29 @@ SetSessionParameterFromSharedMemory(key_t client_shmem_key)
 
 	char *shared_memory_ptr;
 	if (attach_shmem(yb_logical_client_shmem_key, &shared_memory_ptr) < 0)
+	{
+		ResetAllOptions();
 		return;
+	}
 
 	struct ysql_conn_mgr_shmem_header shmem_header;
 	memcpy(&shmem_header, shared_memory_ptr,
 		   sizeof(struct ysql_conn_mgr_shmem_header));
 
+	if (yb_loaded_client_shmem_key == client_shmem_key &&
+		yb_loaded_client_state_version ==
+			shmem_header.session_parameters_version)
+	{
+		/* The backend still has the session state of the client. */
+		elog(DEBUG5, "Reusing the loaded session state of the client with "
+			 "key %d", client_shmem_key);
+		detach_shmem(client_shmem_key, shared_memory_ptr);
+		return;
+	}
+
+	/* Reset all the session parameters */
+	ResetAllOptions();
+
 	struct shmem_session_parameter *shmem_parameter_list =
 		(struct shmem_session_parameter*) 
 				(shared_memory_ptr + sizeof(struct ysql_conn_mgr_shmem_header));
@@ -558,6 +627,9 @@ SetSessionParameterFromSharedMemory(key_t client_shmem_key)
 								 true, 0, false);
 	}
 
+	yb_loaded_client_shmem_key = client_shmem_key;
+	yb_loaded_client_state_version = shmem_header.session_parameters_version;
+
 	/* Detach the shared memory */
 	detach_shmem(client_shmem_key, shared_memory_ptr);
 }
@@ -567,6 +639,9 @@ DeleteSharedMemory(int client_shmem_key)
 {
 	elog(DEBUG5, "Deleting the shared memory with key %d", client_shmem_key);
 
+	if (yb_loaded_client_shmem_key == client_shmem_key)
+		YbInvalidateLoadedClientState();
+
 	/* Shared memory related to the client id will be removed */
 	if (shmctl(client_shmem_key, IPC_RMID, NULL) == -1)
 	{
@@ -593,13 +668,14 @@ YbHandleSetSessionParam(int yb_client_id)
 							   "only during the handling of authentication "
 							   "passthrough request.")));
 
-	/* Reset all the session parameters */
-	ResetAllOptions();
-
 	if (yb_client_id > 0)
 		SetSessionParameterFromSharedMemory((key_t) yb_client_id);
 	else
+	{
+		/* Reset all the session parameters */
+		ResetAllOptions();
 		DeleteSharedMemory((key_t) abs(yb_client_id));
+	}
 }
 
 Oid
@@ -40,6 +40,7 @@
 #include "nodes/makefuncs.h"
 #include "nodes/nodeFuncs.h"
 #include "nodes/primnodes.h"
+#include "utils/array.h"
 #include "utils/memutils.h"
 #include "utils/numeric.h"
 #include "utils/rowtypes.h"
@@ -151,6 +152,91 @@ struct YbgExprContextData
 	Bitmapset *attr_nulls;
 };
 
+static Datum evalExpr(YbgExprContext ctx, Expr* expr, bool *is_null);
+
+/*
+ * Evaluate "scalar op ANY/ALL (array)" the same way as ExecEvalScalarArrayOp.
+ * The element storage properties come from YbGetArrayElemTypeProps, the
+ * planner only pushes down arrays of the types it knows.
+ */
+static Datum
+evalScalarArrayOpExpr(YbgExprContext ctx, ScalarArrayOpExpr *saop,
+					  bool *is_null)
+{
+	bool		use_or = saop->useOr;
+	FmgrInfo   *flinfo = palloc0(sizeof(FmgrInfo));
+	FunctionCallInfoData fcinfo;
+	Datum		array_datum;
+	bool		array_is_null;
+	ArrayType  *arr;
+	int16		elmlen;
+	bool		elmbyval;
+	char		elmalign;
+	Datum	   *elems;
+	bool	   *elem_nulls;
+	int			nelems;
+	bool		result_is_null = false;
+
+	fmgr_info(saop->opfuncid, flinfo);
+	InitFunctionCallInfoData(fcinfo, flinfo, 2, saop->inputcollid, NULL, NULL);
+	fcinfo.arg[0] = evalExpr(ctx, (Expr *) linitial(saop->args),
+							 &fcinfo.argnull[0]);
+	array_datum = evalExpr(ctx, (Expr *) lsecond(saop->args), &array_is_null);
+
+	/* If the array is NULL then we return NULL. */
+	if (array_is_null)
+	{
+		*is_null = true;
+		return (Datum) 0;
+	}
+	arr = DatumGetArrayTypeP(array_datum);
+	*is_null = false;
+	/* If the array is empty, we return either FALSE or TRUE per useOr. */
+	if (ArrayGetNItems(ARR_NDIM(arr), ARR_DIMS(arr)) == 0)
+		return BoolGetDatum(!use_or);
+	/* If the scalar is NULL, and the function is strict, return NULL. */
+	if (fcinfo.argnull[0] && flinfo->fn_strict)
+	{
+		*is_null = true;
+		return (Datum) 0;
+	}
+
+	if (!YbGetArrayElemTypeProps(ARR_ELEMTYPE(arr), &elmlen, &elmbyval,
+								 &elmalign))
+		ereport(ERROR,
+			(errcode(ERRCODE_INTERNAL_ERROR), errmsg(
+			"Unsupported array element type received by DocDB")));
+	deconstruct_array(arr, ARR_ELEMTYPE(arr), elmlen, elmbyval, elmalign,
+					  &elems, &elem_nulls, &nelems);
+
+	for (int i = 0; i < nelems; i++)
+	{
+		Datum		value;
+
+		fcinfo.arg[1] = elems[i];
+		fcinfo.argnull[1] = elem_nulls[i];
+		if (fcinfo.argnull[1] && flinfo->fn_strict)
+		{
+			result_is_null = true;
+			continue;
+		}
+		fcinfo.isnull = false;
+		value = FunctionCallInvoke(&fcinfo);
+		if (fcinfo.isnull)
+			result_is_null = true;
+		else if (use_or == DatumGetBool(value))
+			/* Short-circuit: true for ANY, false for ALL. */
+			return BoolGetDatum(use_or);
+	}
+
+	if (result_is_null)
+	{
+		*is_null = true;
+		return (Datum) 0;
+	}
+	return BoolGetDatum(!use_or);
+}
+
 /*
  * Evaluate an expression against an expression context.
  * Currently assumes the expression has been checked by the planner to only
@@ -215,6 +301,10 @@ static Datum evalExpr(YbgExprContext ctx, Expr* expr, bool *is_null)
 			*is_null = fcinfo.isnull;
 			return result;
 		}
+		case T_ScalarArrayOpExpr:
+			return evalScalarArrayOpExpr(ctx,
+										 castNode(ScalarArrayOpExpr, expr),
+										 is_null);
 		case T_RelabelType:
 		{
 			RelabelType *rt = castNode(RelabelType, expr);
@@ -228,6 +318,36 @@ static Datum evalExpr(YbgExprContext ctx, Expr* expr, bool *is_null)
 			*is_null = false;
 			return (Datum) (nt->nulltesttype == IS_NULL) == arg_is_null;
 		}
+		case T_BooleanTest:
+		{
+			BooleanTest *bt = castNode(BooleanTest, expr);
+			bool		arg_is_null;
+			bool		arg_value = DatumGetBool(evalExpr(ctx, bt->arg,
+														  &arg_is_null));
+			*is_null = false;
+			switch (bt->booltesttype)
+			{
+				case IS_TRUE:
+					return BoolGetDatum(!arg_is_null && arg_value);
+				case IS_NOT_TRUE:
+					return BoolGetDatum(arg_is_null || !arg_value);
+				case IS_FALSE:
+					return BoolGetDatum(!arg_is_null && !arg_value);
+				case IS_NOT_FALSE:
+					return BoolGetDatum(arg_is_null || arg_value);
+				case IS_UNKNOWN:
+					return BoolGetDatum(arg_is_null);
+				case IS_NOT_UNKNOWN:
+					return BoolGetDatum(!arg_is_null);
+				default:
+					/* Planner should ensure we never get here. */
+					ereport(ERROR,
+						(errcode(ERRCODE_INTERNAL_ERROR), errmsg(
+						"Unsupported booltesttype received by DocDB")));
+					break;
+			}
+			return (Datum) 0;
+		}
 		case T_BoolExpr:
 		{
 			BoolExpr   *be = castNode(BoolExpr, expr);
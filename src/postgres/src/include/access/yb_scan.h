@@ -221,6 +221,8 @@ extern bool YbPredetermineNeedsRecheck(Relation relation,
 
 HeapTuple ybc_getnext_heaptuple(YbScanDesc ybScan, ScanDirection dir, bool *recheck);
 IndexTuple ybc_getnext_indextuple(YbScanDesc ybScan, ScanDirection dir, bool *recheck);
+HeapTuple ybc_getnext_index_heaptuple(YbScanDesc ybScan, ScanDirection dir,
+									  bool *recheck);
 bool ybc_getnext_aggslot(IndexScanDesc scan, YBCPgStatement handle,
 						 bool index_only_scan);
 
@@ -57,6 +57,14 @@ extern const Oid YbGetPrimitiveTypeOid(Oid type_id, char typtype,
  */
 bool YbDataTypeIsValidForKey(Oid type_id);
 
+/*
+ * Returns storage properties of the elements of arrays of the given type, if
+ * they are known without catalog access, e.g. when the array is processed by
+ * DocDB. Returns false for other types.
+ */
+extern bool YbGetArrayElemTypeProps(Oid elemtype, int16 *typlen,
+									bool *typbyval, char *typalign);
+
 /*
  * Array of all type entities.
  */
@@ -802,6 +802,13 @@ void YbTryRegisterCatalogVersionTableForPrefetching();
  */
 bool YBCIsRegionLocal(Relation rel);
 
+/*
+ * If the statement with the given range table accesses any relation outside of the local region,
+ * tells pggate to start the transaction as global, instead of promoting it in the middle of the
+ * statement.
+ */
+void YBPredictGlobalTransaction(List *rangeTable);
+
 /*
  * Return NULL for all non-range-partitioned tables.
  * Return an empty string for one-tablet range-partitioned tables.
@@ -48,6 +48,13 @@ extern bool YbIsClientYsqlConnMgr();
  */
 extern void YbUpdateSharedMemory();
 
+/*
+ * Forget that the backend has the session state of a client, so the state is
+ * reset and replayed the next time a client is attached to the backend. Called
+ * when session parameters change in a way not stored for the client.
+ */
+extern void YbInvalidateLoadedClientState();
+
 /*
  * Clean the local list of names of changed session parameters.
  */
@@ -0,0 +1,74 @@
+--
+-- Pushdown of ScalarArrayOpExpr (IN, ANY, ALL) and BooleanTest (IS [NOT] TRUE,
+-- IS [NOT] FALSE, IS [NOT] UNKNOWN) to DocDB. Every query is run with and
+-- without expression pushdown, the results must be the same.
+--
+CREATE TABLE pd_saop (id int PRIMARY KEY, i int, t text, ia int[], ta text[], doc jsonb);
+INSERT INTO pd_saop VALUES
+  (1, 1, 'a', '{1,2}', '{a,b}', '{"k": "a", "n": 1}'),
+  (2, 2, 'b', '{2,NULL}', '{b,NULL}', '{"k": "b", "n": 2}'),
+  (3, 3, 'c', '{}', '{}', '{"k": "c"}'),
+  (4, NULL, NULL, NULL, NULL, '{"n": 4}'),
+  (5, 5, 'e', '{NULL}', '{NULL}', NULL);
+SET yb_enable_expression_pushdown TO on;
+EXPLAIN (COSTS OFF) SELECT id FROM pd_saop WHERE i = ANY ('{1,3,NULL}'::int[]);
+EXPLAIN (COSTS OFF) SELECT id FROM pd_saop WHERE i <> ALL ('{}'::int[]);
+EXPLAIN (COSTS OFF) SELECT id FROM pd_saop WHERE 2 = ANY (ia);
+EXPLAIN (COSTS OFF) SELECT id FROM pd_saop WHERE t IN ('a', 'c');
+EXPLAIN (COSTS OFF) SELECT id FROM pd_saop WHERE (doc ->> 'k') IN ('a', 'b');
+EXPLAIN (COSTS OFF) SELECT id FROM pd_saop WHERE (i <> ALL ('{1,NULL}'::int[])) IS UNKNOWN;
+EXPLAIN (COSTS OFF) SELECT id FROM pd_saop WHERE (doc ? 'k') IS NOT TRUE;
+-- NULL scalar and NULL array elements
+SELECT id FROM pd_saop WHERE i = ANY ('{1,3,NULL}'::int[]) ORDER BY id;
+SELECT id FROM pd_saop WHERE i <> ALL ('{1,4}'::int[]) ORDER BY id;
+SELECT id FROM pd_saop WHERE (i <> ALL ('{1,NULL}'::int[])) IS UNKNOWN ORDER BY id;
+SELECT id FROM pd_saop WHERE (i <> ALL ('{1,NULL}'::int[])) IS NOT UNKNOWN ORDER BY id;
+-- Empty array: ANY is false and ALL is true, even for a NULL scalar
+SELECT id FROM pd_saop WHERE i = ANY ('{}'::int[]) ORDER BY id;
+SELECT id FROM pd_saop WHERE i <> ALL ('{}'::int[]) ORDER BY id;
+-- Array columns
+SELECT id FROM pd_saop WHERE 2 = ANY (ia) ORDER BY id;
+SELECT id FROM pd_saop WHERE (2 = ANY (ia)) IS NOT UNKNOWN ORDER BY id;
+SELECT id FROM pd_saop WHERE 1 <> ALL (ia) ORDER BY id;
+SELECT id FROM pd_saop WHERE t = ANY (ta) ORDER BY id;
+-- Text arrays
+SELECT id FROM pd_saop WHERE t IN ('a', 'c') ORDER BY id;
+SELECT id FROM pd_saop WHERE (t <> ALL ('{a,NULL}'::text[])) IS FALSE ORDER BY id;
+SELECT id FROM pd_saop WHERE (t <> ALL ('{a,NULL}'::text[])) IS NOT FALSE ORDER BY id;
+-- JSONB
+SELECT id FROM pd_saop WHERE (doc ->> 'k') IN ('a', 'b') ORDER BY id;
+SELECT id FROM pd_saop WHERE ((doc ->> 'k') = ANY ('{c,NULL}'::text[])) IS NOT TRUE ORDER BY id;
+SELECT id FROM pd_saop WHERE doc = ANY (ARRAY['{"k": "c"}'::jsonb, '{"n": 4}'::jsonb]) ORDER BY id;
+SELECT id FROM pd_saop WHERE doc @> ANY (ARRAY['{"n": 1}'::jsonb, '{"k": "c"}'::jsonb]) ORDER BY id;
+SELECT id FROM pd_saop WHERE (doc ? 'k') IS NOT TRUE ORDER BY id;
+SELECT id FROM pd_saop WHERE (doc ? 'k') IS UNKNOWN ORDER BY id;
+SELECT id FROM pd_saop WHERE (doc ? 'k') IS TRUE AND (i > 1) IS NOT FALSE ORDER BY id;
+SET yb_enable_expression_pushdown TO off;
+EXPLAIN (COSTS OFF) SELECT id FROM pd_saop WHERE i = ANY ('{1,3,NULL}'::int[]);
+-- NULL scalar and NULL array elements
+SELECT id FROM pd_saop WHERE i = ANY ('{1,3,NULL}'::int[]) ORDER BY id;
+SELECT id FROM pd_saop WHERE i <> ALL ('{1,4}'::int[]) ORDER BY id;
+SELECT id FROM pd_saop WHERE (i <> ALL ('{1,NULL}'::int[])) IS UNKNOWN ORDER BY id;
+SELECT id FROM pd_saop WHERE (i <> ALL ('{1,NULL}'::int[])) IS NOT UNKNOWN ORDER BY id;
+-- Empty array: ANY is false and ALL is true, even for a NULL scalar
+SELECT id FROM pd_saop WHERE i = ANY ('{}'::int[]) ORDER BY id;
+SELECT id FROM pd_saop WHERE i <> ALL ('{}'::int[]) ORDER BY id;
+-- Array columns
+SELECT id FROM pd_saop WHERE 2 = ANY (ia) ORDER BY id;
+SELECT id FROM pd_saop WHERE (2 = ANY (ia)) IS NOT UNKNOWN ORDER BY id;
+SELECT id FROM pd_saop WHERE 1 <> ALL (ia) ORDER BY id;
+SELECT id FROM pd_saop WHERE t = ANY (ta) ORDER BY id;
+-- Text arrays
+SELECT id FROM pd_saop WHERE t IN ('a', 'c') ORDER BY id;
+SELECT id FROM pd_saop WHERE (t <> ALL ('{a,NULL}'::text[])) IS FALSE ORDER BY id;
+SELECT id FROM pd_saop WHERE (t <> ALL ('{a,NULL}'::text[])) IS NOT FALSE ORDER BY id;
+-- JSONB
+SELECT id FROM pd_saop WHERE (doc ->> 'k') IN ('a', 'b') ORDER BY id;
+SELECT id FROM pd_saop WHERE ((doc ->> 'k') = ANY ('{c,NULL}'::text[])) IS NOT TRUE ORDER BY id;
+SELECT id FROM pd_saop WHERE doc = ANY (ARRAY['{"k": "c"}'::jsonb, '{"n": 4}'::jsonb]) ORDER BY id;
+SELECT id FROM pd_saop WHERE doc @> ANY (ARRAY['{"n": 1}'::jsonb, '{"k": "c"}'::jsonb]) ORDER BY id;
+SELECT id FROM pd_saop WHERE (doc ? 'k') IS NOT TRUE ORDER BY id;
+SELECT id FROM pd_saop WHERE (doc ? 'k') IS UNKNOWN ORDER BY id;
+SELECT id FROM pd_saop WHERE (doc ? 'k') IS TRUE AND (i > 1) IS NOT FALSE ORDER BY id;
+RESET yb_enable_expression_pushdown;
+DROP TABLE pd_saop;
@@ -17,11 +17,13 @@
 
 #include "yb/util/random_util.h"
 #include "yb/util/test_util.h"
+#include "yb/util/thread.h"
 
 namespace yb {
 
 using yb::ash::AshAuxInfo;
 using yb::ash::AshMetadata;
+using yb::ash::WaitStateInfo;
 
 class WaitStateTest : public YBTest {};
 
@@ -83,4 +85,23 @@ TEST(WaitStateTest, TestUpdate) {
   ASSERT_EQ(meta1.client_host_port, meta1_copy.client_host_port);
 }
 
+TEST(WaitStateTest, TestAllThreadWaitStates) {
+  auto HasCurrentThread = [](const std::vector<ash::ThreadWaitState>& thread_wait_states,
+                             const ash::WaitStateInfoPtr& wait_state) {
+    for (const auto& thread_wait_state : thread_wait_states) {
+      if (thread_wait_state.tid == Thread::CurrentThreadIdForStack()) {
+        return thread_wait_state.wait_state == wait_state;
+      }
+    }
+    return false;
+  };
+
+  auto wait_state = std::make_shared<WaitStateInfo>(GenerateRandomMetadata());
+  {
+    ash::ScopedAdoptWaitState scoped_adopt(wait_state);
+    ASSERT_TRUE(HasCurrentThread(WaitStateInfo::AllThreadWaitStates(), wait_state));
+  }
+  ASSERT_FALSE(HasCurrentThread(WaitStateInfo::AllThreadWaitStates(), wait_state));
+}
+
 }  // namespace yb
@@ -15,16 +15,107 @@
 
 #include <arpa/inet.h>
 
+#include <algorithm>
+#include <mutex>
+#include <unordered_set>
+
+#include "yb/util/thread.h"
 #include "yb/util/tostring.h"
 #include "yb/util/trace.h"
 
 namespace yb::ash {
 
 namespace {
-  // The current wait_state_ for this thread.
-  thread_local WaitStateInfoPtr threadlocal_wait_state_;
+
+class ThreadWaitStateSlot;
+
+// Slots of all threads that used a wait state, so wait states can be sampled from other threads.
+class ThreadWaitStateRegistry {
+ public:
+  void Register(ThreadWaitStateSlot* slot) EXCLUDES(mutex_) {
+    std::lock_guard lock(mutex_);
+    slots_.insert(slot);
+  }
+
+  void Unregister(ThreadWaitStateSlot* slot) EXCLUDES(mutex_) {
+    std::lock_guard lock(mutex_);
+    slots_.erase(slot);
+  }
+
+  std::vector<ThreadWaitState> All() EXCLUDES(mutex_);
+
+ private:
+  std::mutex mutex_;
+  std::unordered_set<ThreadWaitStateSlot*> slots_ GUARDED_BY(mutex_);
+};
+
+ThreadWaitStateRegistry& GetThreadWaitStateRegistry() {
+  // Never destroyed, since threads could exit after static destructors are run.
+  static auto* registry = new ThreadWaitStateRegistry();
+  return *registry;
+}
+
+// The wait state of a thread. The owning thread is the only writer, while other threads read it
+// to sample wait states.
+class ThreadWaitStateSlot {
+ public:
+  ThreadWaitStateSlot() : tid_(Thread::CurrentThreadIdForStack()) {
+    GetThreadWaitStateRegistry().Register(this);
+  }
+
+  ~ThreadWaitStateSlot() {
+    GetThreadWaitStateRegistry().Unregister(this);
+  }
+
+  ThreadIdForStack tid() const {
+    return tid_;
+  }
+
+  WaitStateInfoPtr Get() const EXCLUDES(mutex_) {
+    std::lock_guard lock(mutex_);
+    return wait_state_;
+  }
+
+  void Set(WaitStateInfoPtr wait_state) EXCLUDES(mutex_) {
+    {
+      std::lock_guard lock(mutex_);
+      wait_state_.swap(wait_state);
+    }
+    // The previous wait state is released outside of the lock.
+  }
+
+ private:
+  const ThreadIdForStack tid_;
+  mutable simple_spinlock mutex_;
+  WaitStateInfoPtr wait_state_ GUARDED_BY(mutex_);
+};
+
+std::vector<ThreadWaitState> ThreadWaitStateRegistry::All() {
+  std::vector<ThreadWaitState> result;
+  {
+    std::lock_guard lock(mutex_);
+    result.reserve(slots_.size());
+    for (auto* slot : slots_) {
+      auto wait_state = slot->Get();
+      if (wait_state) {
+        result.push_back(ThreadWaitState {
+          .tid = slot->tid(),
+          .wait_state = std::move(wait_state),
+        });
+      }
+    }
+  }
+  std::sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.tid < rhs.tid;
+  });
+  return result;
 }
 
+// The current wait_state_ for this thread.
+thread_local ThreadWaitStateSlot threadlocal_wait_state_;
+
+} // namespace
+
 void AshMetadata::set_client_host_port(const HostPort &host_port) {
   client_host_port = host_port;
 }
@@ -91,6 +182,11 @@ int64_t WaitStateInfo::query_id() {
   return metadata_.query_id;
 }
 
+TabletId WaitStateInfo::tablet_id() {
+  std::lock_guard lock(mutex_);
+  return aux_info_.tablet_id;
+}
+
 void WaitStateInfo::set_client_host_port(const HostPort &host_port) {
   std::lock_guard lock(mutex_);
   metadata_.set_client_host_port(host_port);
@@ -112,14 +208,19 @@ void WaitStateInfo::UpdateAuxInfo(const AshAuxInfo &aux) {
 }
 
 void WaitStateInfo::SetCurrentWaitState(WaitStateInfoPtr wait_state) {
-  threadlocal_wait_state_ = std::move(wait_state);
+  threadlocal_wait_state_.Set(std::move(wait_state));
 }
 
 WaitStateInfoPtr WaitStateInfo::CurrentWaitState() {
-  if (!threadlocal_wait_state_) {
+  auto result = threadlocal_wait_state_.Get();
+  if (!result) {
     VLOG_WITH_FUNC(3) << " returning nullptr";
   }
-  return threadlocal_wait_state_;
+  return result;
+}
+
+std::vector<ThreadWaitState> WaitStateInfo::AllThreadWaitStates() {
+  return GetThreadWaitStateRegistry().All();
 }
 
 //
@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <string>
+#include <vector>
 
 #include "yb/common/entity_ids_types.h"
 #include "yb/common/wire_protocol.h"
@@ -23,6 +24,7 @@
 #include "yb/util/enums.h"
 #include "yb/util/locks.h"
 #include "yb/util/net/net_util.h"
+#include "yb/util/stack_trace.h"
 #include "yb/util/uuid.h"
 
 #define SET_WAIT_STATUS_TO(ptr, state) \
@@ -198,6 +200,12 @@ struct AshAuxInfo {
 class WaitStateInfo;
 using WaitStateInfoPtr = std::shared_ptr<WaitStateInfo>;
 
+// Wait state adopted by a thread.
+struct ThreadWaitState {
+  ThreadIdForStack tid;
+  WaitStateInfoPtr wait_state;
+};
+
 class WaitStateInfo {
  public:
   WaitStateInfo() = default;
@@ -211,12 +219,17 @@ class WaitStateInfo {
   void set_yql_endpoint_tserver_uuid(const Uuid& yql_endpoint_tserver_uuid) EXCLUDES(mutex_);
   int64_t query_id() EXCLUDES(mutex_);
   void set_query_id(int64_t query_id) EXCLUDES(mutex_);
+  TabletId tablet_id() EXCLUDES(mutex_);
   void set_rpc_request_id(int64_t id) EXCLUDES(mutex_);
   void set_client_host_port(const HostPort& host_port) EXCLUDES(mutex_);
 
   static WaitStateInfoPtr CurrentWaitState();
   static void SetCurrentWaitState(WaitStateInfoPtr);
 
+  // Returns wait states currently adopted by threads, ordered by thread id. Used to sample thread
+  // stacks together with the wait states of the threads.
+  static std::vector<ThreadWaitState> AllThreadWaitStates();
+
   void UpdateMetadata(const AshMetadata& meta) EXCLUDES(mutex_);
   void UpdateAuxInfo(const AshAuxInfo& aux) EXCLUDES(mutex_);
 
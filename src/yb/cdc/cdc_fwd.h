@@ -23,6 +23,7 @@ namespace cdc {
 
 class CDCServiceContext;
 class CDCServiceImpl;
+class XClusterRecordCache;
 
 } // namespace cdc
 } // namespace yb
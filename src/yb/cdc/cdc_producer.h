@@ -90,6 +90,7 @@ Status GetChangesForXCluster(
     const CoarseTimePoint& deadline,
     StreamMetadata* stream_metadata,
     consensus::ReplicateMsgsHolder* msgs_holder,
+    XClusterRecordCache* record_cache,
     GetChangesResponsePB* resp,
     int64_t* last_readable_opid_index = nullptr);
 }  // namespace cdc
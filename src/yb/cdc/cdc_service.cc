@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <chrono>
 #include <memory>
+#include <thread>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
@@ -31,6 +32,7 @@
 #include "yb/cdc/cdc_state_table.h"
 #include "yb/cdc/cdc_types.h"
 #include "yb/cdc/xcluster_producer_bootstrap.h"
+#include "yb/cdc/xcluster_record_cache.h"
 #include "yb/cdc/xrepl_stream_metadata.h"
 #include "yb/cdc/xrepl_stream_stats.h"
 
@@ -171,6 +173,20 @@ DEFINE_RUNTIME_int32(xcluster_get_changes_max_send_rate_mbps, 100,
                      "Server-wide max send rate in megabytes per second for GetChanges response "
                      "traffic. Throttles xcluster but not cdc traffic.");
 
+DEFINE_RUNTIME_uint32(xcluster_get_changes_max_waiting_requests, 16,
+    "Max number of xCluster GetChanges requests that wait for new changes at the same time. "
+    "Waiting requests hold a GetChanges permit, so requests over this limit return immediately.");
+
+DEFINE_RUNTIME_uint32(xcluster_get_changes_wait_poll_interval_ms, 5,
+    "Interval at which a waiting xCluster GetChanges request checks for newly committed "
+    "operations.");
+
+DEFINE_RUNTIME_int64(cdcsdk_intent_retention_max_lag_ops, 0,
+    "Max number of WAL operations a CDCSDK stream may lag behind the latest operation of a tablet "
+    "while still retaining intents and WAL for it. A stream lagging further stops retaining them "
+    "and is treated as expired for the tablet, so a slow consumer does not bloat the intents DB. "
+    "0 disables the limit.");
+
 DEFINE_RUNTIME_bool(enable_xcluster_stat_collection, true,
     "When enabled, stats are collected from xcluster streams for reporting purposes.");
 
@@ -682,7 +698,8 @@ CDCServiceImpl::CDCServiceImpl(
           1.0, floor(FLAGS_rpc_workers_limit * (1 - FLAGS_cdc_get_changes_free_rpc_ratio)))),
       rate_limiter_(std::unique_ptr<rocksdb::RateLimiter>(rocksdb::NewGenericRateLimiter(
           GetAtomicFlag(&FLAGS_xcluster_get_changes_max_send_rate_mbps) * 1_MB))),
-      impl_(new Impl(context_.get(), &mutex_)) {
+      impl_(new Impl(context_.get(), &mutex_)),
+      xcluster_record_cache_(std::make_unique<XClusterRecordCache>()) {
   cdc_state_table_ = std::make_unique<cdc::CDCStateTable>(impl_->async_client_init_.get());
 
   CHECK_OK(Thread::Create(
@@ -700,6 +717,23 @@ client::YBClient* CDCServiceImpl::client() { return impl_->async_client_init_->c
 
 namespace {
 
+// Waits until an operation after last_index is committed on the tablet or deadline is reached.
+Status WaitForCommittedOpAfter(
+    const tablet::TabletPeer& tablet_peer, int64_t last_index, CoarseTimePoint deadline) {
+  auto consensus = VERIFY_RESULT(tablet_peer.GetConsensus());
+  for (;;) {
+    if (consensus->GetLastCommittedOpId().index > last_index) {
+      return Status::OK();
+    }
+    auto now = CoarseMonoClock::Now();
+    if (now >= deadline) {
+      return Status::OK();
+    }
+    std::this_thread::sleep_for(std::min<CoarseDuration>(
+        deadline - now, FLAGS_xcluster_get_changes_wait_poll_interval_ms * 1ms));
+  }
+}
+
 bool YsqlTableHasPrimaryKey(const client::YBSchema& schema) {
   for (const auto& col : schema.columns()) {
     if (col.order() == static_cast<int32_t>(PgSystemAttrNum::kYBRowId)) {
@@ -1573,6 +1607,12 @@ void CDCServiceImpl::GetChanges(
     }
   }
 
+  if (record.GetSourceType() == CDCSDK && !IsCDCSDKSnapshotRequest(cdc_sdk_from_op_id)) {
+    RPC_STATUS_RETURN_ERROR(
+        CheckIntentRetentionLag(producer_tablet, from_op_id), resp->mutable_error(),
+        CDCErrorPB::INTERNAL_ERROR, context);
+  }
+
   bool is_replication_paused_for_stream = IsReplicationPausedForStream(req->stream_id());
   if (is_replication_paused_for_stream || PREDICT_FALSE(FLAGS_TEST_block_get_changes)) {
     if (is_replication_paused_for_stream && VLOG_IS_ON(1)) {
@@ -1611,11 +1651,27 @@ void CDCServiceImpl::GetChanges(
   bool report_tablet_split = false;
   // Read the latest changes from the Log.
   if (record.GetSourceType() == XCLUSTER) {
+    // Hold the request until new operations are committed, so an idle consumer does not have to
+    // poll repeatedly. The number of waiting requests is limited, since each of them holds an RPC
+    // thread.
+    if (req->wait_for_changes_ms() > 0) {
+      const auto num_waiting = ++num_get_changes_waiting_;
+      auto waiting_scope_exit = ScopeExit([this] { --num_get_changes_waiting_; });
+      if (num_waiting <= FLAGS_xcluster_get_changes_max_waiting_requests) {
+        const auto wait_deadline = std::min(
+            get_changes_deadline, CoarseMonoClock::Now() + req->wait_for_changes_ms() * 1ms);
+        RPC_STATUS_RETURN_ERROR(
+            WaitForCommittedOpAfter(*tablet_peer, from_op_id.index, wait_deadline),
+            resp->mutable_error(), CDCErrorPB::INTERNAL_ERROR, context);
+        resp->set_waited_for_changes(true);
+      }
+    }
     status = GetChangesForXCluster(
         stream_id, req->tablet_id(), from_op_id, tablet_peer,
         std::bind(
             &CDCServiceImpl::UpdateChildrenTabletsOnSplitOpForXCluster, this, producer_tablet, _1),
-        mem_tracker, get_changes_deadline, &record, &msgs_holder, resp, &last_readable_index);
+        mem_tracker, get_changes_deadline, &record, &msgs_holder, xcluster_record_cache_.get(),
+        resp, &last_readable_index);
   } else {
     uint64_t commit_timestamp;
     OpId last_streamed_op_id;
@@ -1746,6 +1802,7 @@ void CDCServiceImpl::GetChanges(
     bool is_colocated = tablet_peer->tablet_metadata()->colocated();
     OpId snapshot_op_id = OpId::Invalid();
     std::string snapshot_key = "";
+    std::string snapshot_end_key = "";
 
     // If snapshot operation or before image is enabled, don't allow compaction.
     HybridTime cdc_sdk_safe_time = HybridTime::kInvalid;
@@ -1764,9 +1821,11 @@ void CDCServiceImpl::GetChanges(
       if (is_snapshot) {
         snapshot_op_id =
             OpId(resp->cdc_sdk_checkpoint().term(), resp->cdc_sdk_checkpoint().index());
-        snapshot_key = (record.GetCheckpointType() == EXPLICIT) ?
-                          req->explicit_cdc_sdk_checkpoint().key()
-                            : req->from_cdc_sdk_checkpoint().key();
+        const auto& snapshot_checkpoint = (record.GetCheckpointType() == EXPLICIT)
+                                              ? req->explicit_cdc_sdk_checkpoint()
+                                              : req->from_cdc_sdk_checkpoint();
+        snapshot_key = snapshot_checkpoint.key();
+        snapshot_end_key = snapshot_checkpoint.snapshot_end_key();
 
         if (snapshot_bootstrap) {
           LOG(INFO) << "Snapshot bootstrapping is initiated for tablet_id: " << req->tablet_id()
@@ -1805,7 +1864,7 @@ void CDCServiceImpl::GetChanges(
               producer_tablet, OpId::FromPB(resp->checkpoint().op_id()), commit_op_id,
               last_record_hybrid_time, record.GetSourceType(), snapshot_bootstrap,
               cdc_sdk_safe_time, is_snapshot, snapshot_key,
-              (is_snapshot && is_colocated) ? req->table_id() : ""),
+              (is_snapshot && is_colocated) ? req->table_id() : "", snapshot_end_key),
           resp->mutable_error(), CDCErrorPB::INTERNAL_ERROR, context);
     }
 
@@ -2417,6 +2476,9 @@ Result<TabletIdCDCCheckpointMap> CDCServiceImpl::PopulateTabletCheckPointInfo(
         last_active_time_cdc_state_table = GetCurrentTimeMicros();
       }
       auto status = CheckStreamActive(producer_tablet, last_active_time_cdc_state_table);
+      if (status.ok() && !entry.snapshot_key.has_value()) {
+        status = CheckIntentRetentionLag(producer_tablet, checkpoint);
+      }
       if (!status.ok()) {
         // It is possible that all streams associated with a tablet have expired, in which case we
         // have to create a default entry in 'tablet_min_checkpoint_map' corresponding to the
@@ -3040,6 +3102,21 @@ void CDCServiceImpl::GetCheckpoint(
     } else {
       set_resp_checkpoint(cdc_sdk_checkpoint);
     }
+
+    if (req->has_snapshot_end_key()) {
+      auto entry_opt = RPC_VERIFY_RESULT(
+          cdc_state_table_->TryFetchEntry(
+              {req->tablet_id(), req_stream_id, is_colocated ? req->table_id() : ""},
+              CDCStateTableEntrySelector().IncludeData()),
+          resp->mutable_error(), CDCErrorPB::INTERNAL_ERROR, context);
+      resp->clear_snapshot_key();
+      if (entry_opt) {
+        auto it = entry_opt->snapshot_range_keys.find(req->snapshot_end_key());
+        if (it != entry_opt->snapshot_range_keys.end()) {
+          resp->set_snapshot_key(it->second);
+        }
+      }
+    }
   }
   context.RespondSuccess();
 }
@@ -3316,6 +3393,44 @@ void CDCServiceImpl::Shutdown() {
   }
 }
 
+Status CDCServiceImpl::CheckIntentRetentionLag(
+    const ProducerTabletInfo& producer_tablet, const OpId& checkpoint) {
+  {
+    SharedLock<rw_spinlock> l(mutex_);
+    if (streams_lagging_beyond_retention_.contains(producer_tablet)) {
+      return STATUS_FORMAT(
+          InternalError, "Stream ID $0 lagged beyond intent retention for Tablet ID $1",
+          producer_tablet.stream_id, producer_tablet.tablet_id);
+    }
+  }
+
+  const auto max_lag_ops = GetAtomicFlag(&FLAGS_cdcsdk_intent_retention_max_lag_ops);
+  if (max_lag_ops <= 0 || !checkpoint.valid() || checkpoint == OpId::Max()) {
+    return Status::OK();
+  }
+  auto tablet_peer = context_->LookupTablet(producer_tablet.tablet_id);
+  if (!tablet_peer || !tablet_peer->log_available()) {
+    return Status::OK();
+  }
+  const auto lag_ops = tablet_peer->log()->GetLatestEntryOpId().index - checkpoint.index;
+  if (lag_ops <= max_lag_ops) {
+    return Status::OK();
+  }
+
+  // Once released, intents and WAL cannot be retained again, so the stream stays expired for the
+  // tablet even if its checkpoint moves later.
+  LOG(WARNING) << "Stream " << producer_tablet.stream_id << " lags " << lag_ops
+               << " operations behind on tablet " << producer_tablet.tablet_id
+               << ", releasing intents and WAL retained for it";
+  {
+    std::lock_guard l(mutex_);
+    streams_lagging_beyond_retention_.insert(producer_tablet);
+  }
+  return STATUS_FORMAT(
+      InternalError, "Stream ID $0 lagged beyond intent retention for Tablet ID $1",
+      producer_tablet.stream_id, producer_tablet.tablet_id);
+}
+
 Status CDCServiceImpl::CheckStreamActive(
     const ProducerTabletInfo& producer_tablet, const int64_t& last_active_time_passed) {
   auto last_active_time = (last_active_time_passed == 0)
@@ -3608,7 +3723,8 @@ Status CDCServiceImpl::UpdateCheckpointAndActiveTime(
     const HybridTime& cdc_sdk_safe_time,
     const bool is_snapshot,
     const std::string& snapshot_key,
-    const TableId& colocated_table_id) {
+    const TableId& colocated_table_id,
+    const std::string& snapshot_end_key) {
   bool update_cdc_state = impl_->UpdateCheckpoint(producer_tablet, sent_op_id, commit_op_id);
   if (!update_cdc_state && !snapshot_bootstrap) {
     return Status::OK();
@@ -3645,7 +3761,13 @@ Status CDCServiceImpl::UpdateCheckpointAndActiveTime(
         // The 'GetChanges' call bootstrapping snapshot will have snapshot key empty.
         // In cases of taking snapshot for a colocated table, we will only update the "snapshot_key"
         // in the rows for meant each colocated tableId.
-        entry.snapshot_key = snapshot_key;
+        // Range snapshots keep a separate snapshot key per range, since they are streamed
+        // concurrently.
+        if (snapshot_end_key.empty()) {
+          entry.snapshot_key = snapshot_key;
+        } else {
+          entry.snapshot_range_keys.emplace(snapshot_end_key, snapshot_key);
+        }
       }
 
       VLOG(2) << "Updating cdc state table with: checkpoint: " << commit_op_id.ToString()
@@ -3785,7 +3907,7 @@ Result<std::shared_ptr<StreamMetadata>> CDCServiceImpl::GetStream(
     const xrepl::StreamId& stream_id, RefreshStreamMapOption opts) {
   std::shared_ptr<StreamMetadata> stream_metadata;
   {
-    SharedLock l(mutex_);
+    SharedLock<rw_spinlock> l(mutex_);
     stream_metadata = FindPtrOrNull(stream_metadata_, stream_id);
   }
 
@@ -12,7 +12,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <unordered_set>
 
 #include "yb/cdc/cdc_fwd.h"
 #include "yb/cdc/cdc_error.h"
@@ -242,6 +244,11 @@ class CDCServiceImpl : public CDCServiceIf {
   Status CheckStreamActive(
       const ProducerTabletInfo& producer_tablet, const int64_t& last_active_time_passed = 0);
 
+  // Fails when the stream lags more than cdcsdk_intent_retention_max_lag_ops behind the latest
+  // operation of the tablet, or lagged beyond it before.
+  Status CheckIntentRetentionLag(
+      const ProducerTabletInfo& producer_tablet, const OpId& checkpoint) EXCLUDES(mutex_);
+
   Result<int64_t> GetLastActiveTime(
       const ProducerTabletInfo& producer_tablet, bool ignore_cache = false);
 
@@ -272,7 +279,8 @@ class CDCServiceImpl : public CDCServiceIf {
       const HybridTime& cdc_sdk_safe_time = HybridTime::kInvalid,
       const bool is_snapshot = false,
       const std::string& snapshot_key = "",
-      const TableId& colocated_table_id = "");
+      const TableId& colocated_table_id = "",
+      const std::string& snapshot_end_key = "");
 
   Status UpdateSnapshotDone(
       const xrepl::StreamId& stream_id, const TabletId& tablet_id,
@@ -453,6 +461,9 @@ class CDCServiceImpl : public CDCServiceIf {
   // Prevents GetChanges "storms" by rejecting when all permits have been acquired.
   Semaphore get_changes_rpc_sem_;
 
+  // Number of xCluster GetChanges requests that are waiting for new changes.
+  std::atomic<uint32_t> num_get_changes_waiting_{0};
+
   // Used to protect tablet_checkpoints_ and stream_metadata_ maps.
   mutable rw_spinlock mutex_;
 
@@ -462,6 +473,8 @@ class CDCServiceImpl : public CDCServiceIf {
 
   std::unique_ptr<CDCStateTable> cdc_state_table_;
 
+  std::unique_ptr<XClusterRecordCache> xcluster_record_cache_;
+
   std::unordered_map<xrepl::StreamId, std::shared_ptr<StreamMetadata>> stream_metadata_
       GUARDED_BY(mutex_);
 
@@ -475,6 +488,11 @@ class CDCServiceImpl : public CDCServiceIf {
   // CDC service proxy.
   CDCServiceProxyMap cdc_service_map_ GUARDED_BY(mutex_);
 
+  // Streams that stopped retaining intents and WAL of a tablet, because they lagged too far
+  // behind. Such streams are treated as expired for the tablet.
+  std::unordered_set<ProducerTabletInfo, ProducerTabletInfo::Hash>
+      streams_lagging_beyond_retention_ GUARDED_BY(mutex_);
+
   // Thread with a few functions:
   //
   // Read the cdc_state table and get the minimum checkpoint for each tablet
@@ -26,6 +26,7 @@
 #include "yb/common/ql_value.h"
 #include "yb/common/schema_pbutil.h"
 
+#include "yb/gutil/strings/escaping.h"
 #include "yb/gutil/walltime.h"
 
 #include "yb/master/master_defaults.h"
@@ -63,6 +64,7 @@ static const char* const kCdcLastReplicationTime = "last_replication_time";
 static const char* const kCDCSDKSafeTime = "cdc_sdk_safe_time";
 static const char* const kCDCSDKActiveTime = "active_time";
 static const char* const kCDCSDKSnapshotKey = "snapshot_key";
+static const char* const kCDCSDKSnapshotRangeKeyPrefix = "snapshot_key_";
 
 namespace {
 const client::YBTableName kCdcStateYBTableName(
@@ -132,6 +134,11 @@ void SerializeEntry(
       client::AddMapEntryToColumn(get_map_value_pb(), kCDCSDKSnapshotKey, *entry.snapshot_key);
     }
 
+    for (const auto& [end_key, snapshot_key] : entry.snapshot_range_keys) {
+      client::AddMapEntryToColumn(
+          get_map_value_pb(), CDCStateTableEntry::SnapshotRangeKeyName(end_key), snapshot_key);
+    }
+
   } else {
     if (entry.active_time) {
       client::UpdateMapUpsertKeyValue(
@@ -147,6 +154,12 @@ void SerializeEntry(
       client::UpdateMapUpsertKeyValue(
           req, cdc_table->ColumnId(kCdcData), kCDCSDKSnapshotKey, *entry.snapshot_key);
     }
+
+    for (const auto& [end_key, snapshot_key] : entry.snapshot_range_keys) {
+      client::UpdateMapUpsertKeyValue(
+          req, cdc_table->ColumnId(kCdcData), CDCStateTableEntry::SnapshotRangeKeyName(end_key),
+          snapshot_key);
+    }
   }
 }
 
@@ -176,6 +189,15 @@ Status DeserializeColumn(
     }
 
     entry->snapshot_key = GetValueFromMap(map_value, kCDCSDKSnapshotKey);
+
+    for (int index = 0; index < map_value.keys_size(); ++index) {
+      Slice name(map_value.keys(index).string_value());
+      if (name.starts_with(kCDCSDKSnapshotRangeKeyPrefix)) {
+        name.remove_prefix(strlen(kCDCSDKSnapshotRangeKeyPrefix));
+        entry->snapshot_range_keys.emplace(
+            a2b_hex(name.AsStringView()), map_value.values(index).string_value());
+      }
+    }
   }
 
   return Status::OK();
@@ -241,9 +263,16 @@ std::string CDCStateTableEntry::ToString() const {
   if (snapshot_key) {
     result += Format(", SnapshotKey: $0", *snapshot_key);
   }
+  if (!snapshot_range_keys.empty()) {
+    result += Format(", SnapshotRangeKeys: $0", snapshot_range_keys);
+  }
   return result;
 }
 
+std::string CDCStateTableEntry::SnapshotRangeKeyName(const std::string& end_key) {
+  return kCDCSDKSnapshotRangeKeyPrefix + b2a_hex(end_key);
+}
+
 const std::string& CDCStateTable::GetNamespaceName() {
   return kCdcStateYBTableName.namespace_name();
 }
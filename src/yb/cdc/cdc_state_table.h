@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <map>
 #include <shared_mutex>
 #include <unordered_set>
 
@@ -83,8 +84,14 @@ struct CDCStateTableEntry {
   std::optional<uint64_t> active_time;
   std::optional<uint64_t> cdc_sdk_safe_time;
   std::optional<std::string> snapshot_key;
+  // Snapshot keys of range snapshots, keyed by the range end key.
+  std::map<std::string, std::string> snapshot_range_keys;
 
   std::string ToString() const;
+
+  // Returns the name of the data map entry that stores the snapshot key of the range ending at
+  // end_key.
+  static std::string SnapshotRangeKeyName(const std::string& end_key);
 };
 
 struct CDCStateTableEntrySelector {
@@ -258,6 +258,17 @@ void SetCheckpoint(
   }
 }
 
+// Strips the cotable id / colocation id prefix, so the key could be compared with the tuple id
+// of a row returned by the snapshot iterator.
+Slice StripCotablePrefix(Slice key) {
+  if (key.starts_with(dockv::KeyEntryTypeAsChar::kTableId)) {
+    key.remove_prefix(1 + kUuidSize);
+  } else if (key.starts_with(dockv::KeyEntryTypeAsChar::kColocationId)) {
+    key.remove_prefix(1 + sizeof(ColocationId));
+  }
+  return key;
+}
+
 bool IsInsertOperation(const RowMessage& row_message) {
   return row_message.op() == RowMessage_Op_INSERT;
 }
@@ -2065,9 +2076,17 @@ Status HandleGetChangesForSnapshotRequest(
     CDCSDKCheckpointPB* checkpoint, bool* checkpoint_updated, HybridTime* safe_hybrid_time_resp) {
   auto txn_participant = tablet_ptr->transaction_participant();
   ReadHybridTime time;
+  // Range snapshot streams only the keys before snapshot_end_key, so several consumers could
+  // stream different ranges of the same tablet concurrently at the same snapshot time.
+  const auto& end_key = from_op_id.snapshot_end_key();
+  const bool range_snapshot = !end_key.empty();
 
   // It is first call in snapshot then take snapshot.
   if ((from_op_id.key().empty()) && (from_op_id.snapshot_time() == 0)) {
+    SCHECK(
+        !range_snapshot, InvalidArgument,
+        Format("Snapshot time should be established before streaming a range of tablet $0",
+               tablet_id));
     tablet::RemoveIntentsData data;
     RETURN_NOT_OK(tablet_peer->GetLastReplicatedData(&data));
 
@@ -2118,6 +2137,13 @@ Status HandleGetChangesForSnapshotRequest(
       return STATUS_FORMAT(ServiceUnavailable, "CDC snapshot is failed for tablet: $0 ", tablet_id);
     }
 
+    // The range was already streamed, keep returning the same checkpoint.
+    if (range_snapshot && next_key == end_key) {
+      *checkpoint = from_op_id;
+      *checkpoint_updated = true;
+      return Status::OK();
+    }
+
     const auto& schema_details = VERIFY_RESULT(GetOrPopulateRequiredSchemaDetails(
         tablet_peer, std::numeric_limits<uint64_t>::max(), cached_schema_details, client,
         colocated_table_id.empty() ? tablet_ptr->metadata()->table_id() : colocated_table_id,
@@ -2134,17 +2160,36 @@ Status HandleGetChangesForSnapshotRequest(
     dockv::ReaderProjection projection(*schema_details.schema);
     auto iter = VERIFY_RESULT(
         tablet_ptr->CreateCDCSnapshotIterator(projection, time, next_key, colocated_table_id));
+    const auto end_tuple_id = StripCotablePrefix(end_key);
+    bool range_done = false;
     while (fetched < limit && VERIFY_RESULT(iter->FetchNext(&row))) {
+      if (range_snapshot && iter->GetTupleId().compare(end_tuple_id) >= 0) {
+        range_done = true;
+        break;
+      }
       RETURN_NOT_OK(PopulateCDCSDKSnapshotRecord(
           resp, &row, *schema_details.schema, *table_name, time, enum_oid_label_map,
           composite_atts_map, from_op_id, next_key, tablet_ptr->table_type() == PGSQL_TABLE_TYPE));
       fetched++;
     }
     dockv::SubDocKey sub_doc_key;
-    RETURN_NOT_OK(iter->GetNextReadSubDocKey(&sub_doc_key));
+    if (!range_done) {
+      RETURN_NOT_OK(iter->GetNextReadSubDocKey(&sub_doc_key));
+      range_done = range_snapshot && (sub_doc_key.doc_key().empty() ||
+                                      iter->GetTupleId().compare(end_tuple_id) >= 0);
+    }
 
-    // Snapshot ends when next key is empty.
-    if (sub_doc_key.doc_key().empty()) {
+    if (range_done) {
+      // Range end is used as the checkpoint key, so the consumer could detect that the range is
+      // done.
+      LOG(INFO) << "Done with snapshot range ending at " << Slice(end_key).ToDebugHexString()
+                << " for tablet_id: " << tablet_id << " stream_id: " << stream_id;
+      SetCheckpoint(
+          from_op_id.term(), from_op_id.index(), -1, end_key, time.read.ToUint64(), checkpoint,
+          nullptr);
+      *checkpoint_updated = true;
+    } else if (sub_doc_key.doc_key().empty()) {
+      // Snapshot ends when next key is empty.
       VLOG(1) << "Setting next sub doc key empty ";
       LOG(INFO) << "Done with snapshot operation for tablet_id: " << tablet_id
                 << " stream_id: " << stream_id << ", from_op_id: " << from_op_id.DebugString();
@@ -2160,6 +2205,9 @@ Status HandleGetChangesForSnapshotRequest(
           time.read.ToUint64(), checkpoint, nullptr);
       *checkpoint_updated = true;
     }
+    if (range_snapshot) {
+      checkpoint->set_snapshot_end_key(end_key);
+    }
   }
 
   return Status::OK();
@@ -11,6 +11,7 @@
 // under the License.
 
 #include "yb/cdc/cdc_producer.h"
+#include "yb/cdc/xcluster_record_cache.h"
 #include "yb/cdc/xrepl_stream_metadata.h"
 
 #include "yb/cdc/cdc_service.pb.h"
@@ -295,6 +296,7 @@ Status GetChangesForXCluster(
     const CoarseTimePoint& deadline,
     StreamMetadata* stream_metadata,
     consensus::ReplicateMsgsHolder* msgs_holder,
+    XClusterRecordCache* record_cache,
     GetChangesResponsePB* resp,
     int64_t* last_readable_opid_index) {
   SCHECK(tablet_peer, NotFound, Format("Tablet id $0 not found", tablet_id));
@@ -375,16 +377,35 @@ Status GetChangesForXCluster(
   OpId checkpoint = from_op_id;
   OpId previous_checkpoint = from_op_id;  // value of checkpoint from previous loop iteration.
 
+  // Records of write and transaction entries do not depend on the stream, so they are decoded
+  // once and shared by all streams through the record cache.
+  auto add_records = [&](const OpId& op_id, const XClusterRecordCache::PopulateFunctor& populate) {
+    if (!record_cache) {
+      return populate(resp);
+    }
+    XClusterRecordCache::Key key {
+      .tablet_id = tablet_id,
+      .op_id = op_id,
+      .record_format = stream_metadata->GetRecordFormat(),
+      .schema_version = tablet->metadata()->schema_version(),
+    };
+    return record_cache->AddRecords(key, populate, resp);
+  };
+
   bool exit_early = false;
   for (const auto& msg_ptr : messages) {
     const auto& msg = *msg_ptr;
     checkpoint = OpId::FromPB(msg.id());
     switch (msg.op_type()) {
       case consensus::OperationType::UPDATE_TRANSACTION_OP:
-        RETURN_NOT_OK(PopulateTransactionRecord(msg, tablet_peer, resp));
+        RETURN_NOT_OK(add_records(checkpoint, [&](GetChangesResponsePB* out) {
+          return PopulateTransactionRecord(msg, tablet_peer, out);
+        }));
         break;
       case consensus::OperationType::WRITE_OP:
-        RETURN_NOT_OK(PopulateWriteRecord(msg, *stream_metadata, tablet_peer, resp));
+        RETURN_NOT_OK(add_records(checkpoint, [&](GetChangesResponsePB* out) {
+          return PopulateWriteRecord(msg, *stream_metadata, tablet_peer, out);
+        }));
         break;
       case consensus::OperationType::SPLIT_OP:
         if (!VERIFY_RESULT(
@@ -0,0 +1,83 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/cdc/xcluster_record_cache.h"
+
+#include <boost/functional/hash.hpp>
+
+#include "yb/util/flags.h"
+#include "yb/util/size_literals.h"
+#include "yb/util/status.h"
+
+using namespace yb::size_literals;
+
+DEFINE_RUNTIME_uint64(xcluster_record_cache_size_bytes, 64_MB,
+    "Size of the cache of CDC records decoded from WAL entries, shared by all xCluster streams. "
+    "0 disables the cache.");
+
+namespace yb::cdc {
+
+Status XClusterRecordCache::AddRecords(
+    const Key& key, const PopulateFunctor& populate, GetChangesResponsePB* resp) {
+  const auto size_limit = FLAGS_xcluster_record_cache_size_bytes;
+  if (size_limit == 0) {
+    return populate(resp);
+  }
+
+  RecordsPtr records;
+  {
+    std::lock_guard lock(mutex_);
+    records = entries_.emplace(Entry {.key = key})->records;
+  }
+  if (records) {
+    resp->mutable_records()->MergeFrom(*records);
+    return Status::OK();
+  }
+
+  GetChangesResponsePB decoded;
+  auto status = populate(&decoded);
+  if (!status.ok()) {
+    std::lock_guard lock(mutex_);
+    entries_.erase(key);
+    return status;
+  }
+  auto new_records = std::make_shared<Records>(std::move(*decoded.mutable_records()));
+  resp->mutable_records()->MergeFrom(*new_records);
+
+  std::lock_guard lock(mutex_);
+  auto it = entries_.emplace(Entry {.key = key});
+  if (!it->records) {
+    // Entries are identified by key only, so modifying other fields does not affect the index.
+    auto& entry = const_cast<Entry&>(*it);
+    entry.records = std::move(new_records);
+    entry.size = entry.records->SpaceUsedExcludingSelfLong();
+    total_size_ += entry.size;
+  }
+  while (total_size_ > size_limit && entries_.begin() != entries_.end()) {
+    auto last = std::prev(entries_.end());
+    total_size_ -= last->size;
+    entries_.erase(last);
+  }
+  return Status::OK();
+}
+
+size_t hash_value(const XClusterRecordCache::Key& key) {
+  size_t result = 0;
+  boost::hash_combine(result, key.tablet_id);
+  boost::hash_combine(result, key.op_id);
+  boost::hash_combine(result, key.record_format);
+  boost::hash_combine(result, key.schema_version);
+  return result;
+}
+
+} // namespace yb::cdc
@@ -0,0 +1,76 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+#include <boost/multi_index/member.hpp>
+
+#include "yb/cdc/cdc_service.pb.h"
+
+#include "yb/common/common_fwd.h"
+#include "yb/common/entity_ids_types.h"
+
+#include "yb/gutil/thread_annotations.h"
+
+#include "yb/util/lru_cache.h"
+#include "yb/util/opid.h"
+
+namespace yb::cdc {
+
+// Caches CDC records decoded from WAL entries, so xCluster streams that read the same tablet
+// decode each WAL entry only once. Records depend only on the WAL entry, the record format of the
+// stream and the schema used for decoding, so they are shared by all streams and pollers at the
+// same position.
+class XClusterRecordCache {
+ public:
+  struct Key {
+    TabletId tablet_id;
+    OpId op_id;
+    CDCRecordFormat record_format;
+    SchemaVersion schema_version;
+
+    friend bool operator==(const Key&, const Key&) = default;
+  };
+
+  using PopulateFunctor = std::function<Status(GetChangesResponsePB*)>;
+
+  // Appends records of the WAL entry identified by key to resp. On cache miss, records are
+  // decoded by populate, which appends them to the provided response.
+  Status AddRecords(const Key& key, const PopulateFunctor& populate, GetChangesResponsePB* resp)
+      EXCLUDES(mutex_);
+
+ private:
+  using Records = google::protobuf::RepeatedPtrField<CDCRecordPB>;
+  using RecordsPtr = std::shared_ptr<const Records>;
+
+  struct Entry {
+    Key key;
+    RecordsPtr records;
+    size_t size = 0;
+  };
+
+  std::mutex mutex_;
+  // Size limit is enforced by total_size_, so the capacity of entries_ is not limited.
+  LRUCache<Entry, boost::multi_index::member<Entry, Key, &Entry::key>> entries_
+      GUARDED_BY(mutex_) {std::numeric_limits<size_t>::max()};
+  size_t total_size_ GUARDED_BY(mutex_) = 0;
+};
+
+size_t hash_value(const XClusterRecordCache::Key& key);
+
+} // namespace yb::cdc
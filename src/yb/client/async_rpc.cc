@@ -29,6 +29,7 @@
 
 #include "yb/gutil/casts.h"
 
+#include "yb/rpc/messenger.h"
 #include "yb/rpc/rpc_controller.h"
 
 #include "yb/tserver/tserver_service.proxy.h"
@@ -73,6 +74,12 @@ METRIC_DEFINE_counter(server, consistent_prefix_failed_reads,
     yb::MetricUnit::kRequests,
     "Number of consistent prefix reads that failed to be served by the closest replica.");
 
+METRIC_DEFINE_counter(server, consistent_prefix_hedged_reads,
+    "Number of consistent prefix reads that were also sent to another replica.",
+    yb::MetricUnit::kRequests,
+    "Number of consistent prefix reads that were also sent to another replica, because the "
+    "closest replica did not respond in time.");
+
 DEFINE_RUNTIME_int32(ybclient_print_trace_every_n, 0,
     "Controls the rate at which traces from ybclient are printed. Setting this to 0 "
     "disables printing the collected traces.");
@@ -91,6 +98,17 @@ DEFINE_UNKNOWN_bool(detect_duplicates_for_retryable_requests, true,
 DEFINE_UNKNOWN_bool(ysql_forward_rpcs_to_local_tserver, false,
     "DEPRECATED. Feature has been removed");
 
+DEFINE_RUNTIME_bool(ybclient_hedge_consistent_prefix_reads, false,
+    "When a consistent prefix read is not answered within the 95th percentile of read latency of "
+    "the tablet server it was sent to, send the same read to another replica and use the first "
+    "successful response.");
+TAG_FLAG(ybclient_hedge_consistent_prefix_reads, advanced);
+
+DEFINE_RUNTIME_int32(ybclient_hedged_reads_max_percent, 5,
+    "Maximal percentage of consistent prefix reads that could be hedged, see "
+    "ybclient_hedge_consistent_prefix_reads.");
+TAG_FLAG(ybclient_hedged_reads_max_percent, advanced);
+
 DEFINE_test_flag(bool, asyncrpc_finished_set_timedout, false,
     "Whether to reset asyncrpc response status to Timedout.");
 
@@ -134,6 +152,31 @@ void FillRequestIds(const RetryableRequestId request_id, InFlightOps* ops) {
   }
 }
 
+// Limits the number of hedged reads to FLAGS_ybclient_hedged_reads_max_percent of reads that could
+// be hedged, so a slow cluster does not get twice the load.
+class HedgedReadsBudget {
+ public:
+  void ReadStarted() {
+    reads_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  bool TryAcquire() {
+    auto percent = GetAtomicFlag(&FLAGS_ybclient_hedged_reads_max_percent);
+    if (hedged_reads_.load(std::memory_order_relaxed) * 100 >=
+            reads_.load(std::memory_order_relaxed) * percent) {
+      return false;
+    }
+    hedged_reads_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+ private:
+  std::atomic<int64_t> reads_{0};
+  std::atomic<int64_t> hedged_reads_{0};
+};
+
+HedgedReadsBudget hedged_reads_budget;
+
 void DoCheckResponseCount(
     const char* op, const char* name, int found, int expected, Status* status) {
   if (found == expected) {
@@ -157,7 +200,8 @@ AsyncRpcMetrics::AsyncRpcMetrics(const scoped_refptr<yb::MetricEntity>& entity)
       time_to_send(METRIC_handler_latency_yb_client_time_to_send.Instantiate(entity)),
       consistent_prefix_successful_reads(
           METRIC_consistent_prefix_successful_reads.Instantiate(entity)),
-      consistent_prefix_failed_reads(METRIC_consistent_prefix_failed_reads.Instantiate(entity)) {
+      consistent_prefix_failed_reads(METRIC_consistent_prefix_failed_reads.Instantiate(entity)),
+      consistent_prefix_hedged_reads(METRIC_consistent_prefix_hedged_reads.Instantiate(entity)) {
 }
 
 AsyncRpc::AsyncRpc(
@@ -246,17 +290,20 @@ void AsyncRpc::Finished(const Status& status) {
 
   }
   if (tablet_invoker_.Done(&new_status)) {
-    if (tablet().is_split() ||
-        ClientError(new_status) == ClientErrorCode::kTablePartitionListIsStale) {
-      ops_[0].yb_op->MarkTablePartitionListAsStale();
-    }
     if (async_rpc_metrics_ && status.ok() && tablet_invoker_.is_consistent_prefix()) {
       IncrementCounter(async_rpc_metrics_->consistent_prefix_successful_reads);
     }
-    ProcessResponseFromTserver(new_status);
-    batcher_->Flushed(ops_, new_status, MakeFlushExtraResult());
-    retained_self_.reset();
+    Complete(new_status);
+  }
+}
+
+void AsyncRpc::Complete(const Status& status) {
+  if (tablet().is_split() || ClientError(status) == ClientErrorCode::kTablePartitionListIsStale) {
+    ops_[0].yb_op->MarkTablePartitionListAsStale();
   }
+  ProcessResponseFromTserver(status);
+  batcher_->Flushed(ops_, status, MakeFlushExtraResult());
+  retained_self_.reset();
 }
 
 void AsyncRpc::Failed(const Status& status) {
@@ -715,7 +762,8 @@ void WriteRpc::NotifyBatcher(const Status& status) {
 }
 
 ReadRpc::ReadRpc(const AsyncRpcData& data, YBConsistencyLevel yb_consistency_level)
-    : AsyncRpcBase(data, yb_consistency_level) {
+    : AsyncRpcBase(data, yb_consistency_level),
+      response_controller_(mutable_retrier()->mutable_controller()) {
   TRACE_TO(trace_, "ReadRpc initiated");
   VTRACE_TO(1, trace_, "Tablet $0 table $1", data.tablet->tablet_id(), table()->name().ToString());
   req_.set_consistency_level(yb_consistency_level);
@@ -765,9 +813,110 @@ void ReadRpc::CallRemoteMethod() {
   TRACE_TO(trace, "SendRpcToTserver");
   ADOPT_TRACE(trace.get());
 
+  sent_to_ = tablet_invoker_.current_ts_ptr();
+  send_time_ = CoarseMonoClock::Now();
+  auto hedge_delay = HedgeDelay();
+  hedged_ = hedge_delay.Initialized();
+  // Response could be received before ReadAsync returns, so everything needed to schedule the
+  // hedged request is prepared in advance.
+  rpc::RpcCommandPtr shared_self;
+  if (hedged_) {
+    shared_self = shared_from_this();
+  }
+  auto* messenger = retrier().messenger();
   tablet_invoker_.proxy()->ReadAsync(
-    req_, &resp_, PrepareController(), std::bind(&ReadRpc::Finished, this, Status::OK()));
+    req_, hedged_ ? &primary_resp_ : &resp_, PrepareController(),
+    std::bind(&ReadRpc::ResponseReceived, this));
   TRACE_TO(trace, "RpcDispatched Asynchronously");
+  if (shared_self) {
+    auto task_id = messenger->ScheduleOnReactor(
+        [this, shared_self](const Status& status) {
+          if (status.ok()) {
+            SendHedge();
+          }
+        },
+        hedge_delay, SOURCE_LOCATION());
+    LOG_IF(WARNING, !task_id.ok()) << "Failed to schedule hedged read: " << task_id.status();
+  }
+}
+
+MonoDelta ReadRpc::HedgeDelay() {
+  if (!GetAtomicFlag(&FLAGS_ybclient_hedge_consistent_prefix_reads) ||
+      !tablet_invoker_.is_consistent_prefix() || num_attempts() > 1 || IsLocalCall()) {
+    return MonoDelta();
+  }
+  auto result = sent_to_->ReadLatencyP95();
+  if (!result || send_time_ + result >= deadline()) {
+    return MonoDelta();
+  }
+  hedged_reads_budget.ReadStarted();
+  return result;
+}
+
+void ReadRpc::SendHedge() {
+  {
+    std::lock_guard lock(hedge_mutex_);
+    if (primary_done_) {
+      return;
+    }
+    hedge_ts_ = tablet_invoker_.SelectHedgeTabletServer();
+    if (!hedge_ts_ || !hedged_reads_budget.TryAcquire()) {
+      return;
+    }
+    hedge_req_.CopyFrom(req_);
+  }
+  TRACE_TO(trace_, "Sending hedged read to $0", hedge_ts_->ToString());
+  if (async_rpc_metrics_) {
+    IncrementCounter(async_rpc_metrics_->consistent_prefix_hedged_reads);
+  }
+  hedge_send_time_ = CoarseMonoClock::Now();
+  hedge_controller_.set_deadline(deadline());
+  hedge_ts_->proxy()->ReadAsync(
+      hedge_req_, &hedge_resp_, &hedge_controller_,
+      [this, shared_self = shared_from_this()] {
+        HedgeResponseReceived();
+      });
+}
+
+void ReadRpc::ResponseReceived() {
+  if (retrier().controller().status().ok()) {
+    sent_to_->ReportReadLatency(CoarseMonoClock::Now() - send_time_);
+  }
+  if (hedged_) {
+    hedged_ = false;
+    rpc::RpcCommandPtr retained_self;
+    {
+      std::lock_guard lock(hedge_mutex_);
+      primary_done_ = true;
+      retained_self = std::move(hedge_retained_self_);
+    }
+    if (retained_self) {
+      // The operation was already completed by the hedged request.
+      return;
+    }
+    resp_.Swap(&primary_resp_);
+  }
+  Finished(Status::OK());
+}
+
+void ReadRpc::HedgeResponseReceived() {
+  if (!hedge_controller_.status().ok() || hedge_resp_.has_error()) {
+    VLOG_WITH_FUNC(3) << "Hedged read failed: " << hedge_controller_.status() << ", "
+                      << AsString(hedge_resp_.error());
+    return;
+  }
+  hedge_ts_->ReportReadLatency(CoarseMonoClock::Now() - hedge_send_time_);
+  {
+    std::lock_guard lock(hedge_mutex_);
+    if (primary_done_) {
+      return;
+    }
+    hedge_retained_self_ = shared_from_this();
+  }
+  TRACE_TO(trace_, "Hedged read completed by $0", hedge_ts_->ToString());
+  resp_.Swap(&hedge_resp_);
+  response_controller_ = &hedge_controller_;
+  Complete(Status::OK());
 }
 
 Status ReadRpc::SwapResponses() {
@@ -799,7 +948,7 @@ Status ReadRpc::SwapResponses() {
         if (ql_response.has_rows_data_sidecar()) {
           // TODO avoid copying sidecar here.
           ql_op->set_rows_data(VERIFY_RESULT(
-              retrier().controller().ExtractSidecar(ql_response.rows_data_sidecar())));
+              response_controller_->ExtractSidecar(ql_response.rows_data_sidecar())));
         }
         ql_idx++;
         break;
@@ -818,7 +967,7 @@ Status ReadRpc::SwapResponses() {
         const auto& pgsql_response = pgsql_op->response();
         if (pgsql_response.has_rows_data_sidecar()) {
           if (pgsql_upcall_sidecar_offset == -1) {
-            pgsql_upcall_sidecar_offset = mutable_retrier()->mutable_controller()->TransferSidecars(
+            pgsql_upcall_sidecar_offset = response_controller_->TransferSidecars(
                 &pgsql_op->sidecars());
           }
           pgsql_op->SetSidecarIndex(
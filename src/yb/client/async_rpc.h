@@ -13,6 +13,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include <boost/range/iterator_range_core.hpp>
 #include <boost/version.hpp>
 
@@ -23,6 +25,8 @@
 #include "yb/common/read_hybrid_time.h"
 #include "yb/common/retryable_request.h"
 
+#include "yb/gutil/thread_annotations.h"
+
 #include "yb/rpc/rpc_fwd.h"
 
 #include "yb/tserver/tserver.pb.h"
@@ -53,6 +57,7 @@ struct AsyncRpcMetrics {
   scoped_refptr<EventStats> time_to_send;
   scoped_refptr<Counter> consistent_prefix_successful_reads;
   scoped_refptr<Counter> consistent_prefix_failed_reads;
+  scoped_refptr<Counter> consistent_prefix_hedged_reads;
 };
 
 using InFlightOps = boost::iterator_range<std::vector<InFlightOp>::iterator>;
@@ -98,6 +103,10 @@ class AsyncRpc : public rpc::Rpc, public TabletRpc {
  protected:
   void Finished(const Status& status) override;
 
+  // Passes the response to the batcher, after tablet invoker decided that the whole operation is
+  // finished.
+  void Complete(const Status& status);
+
   void SendRpcToTserver(int attempt_num) override;
 
   virtual void CallRemoteMethod() = 0;
@@ -191,6 +200,36 @@ class ReadRpc : public AsyncRpcBase<tserver::ReadRequestPB, tserver::ReadRespons
   Status SwapResponses() override;
   void CallRemoteMethod() override;
   void NotifyBatcher(const Status& status) override;
+
+  // Returns the delay after which a hedged request should be sent, or an uninitialized MonoDelta
+  // if the current attempt should not be hedged.
+  MonoDelta HedgeDelay();
+  void SendHedge();
+  void ResponseReceived();
+  void HedgeResponseReceived();
+
+  // Server the current attempt was sent to, and when. Used to track read latency of servers.
+  RemoteTabletServer* sent_to_ = nullptr;
+  CoarseTimePoint send_time_;
+
+  // The first attempt of a consistent prefix read could be hedged: when it takes longer than the
+  // 95th percentile of read latency of its server, a copy of the request is sent to another
+  // replica. The first successful response completes the operation and the other one is ignored.
+  // While the attempt is hedged, its response is received into primary_resp_.
+  bool hedged_ = false;
+  tserver::ReadResponsePB primary_resp_;
+  std::mutex hedge_mutex_;
+  bool primary_done_ GUARDED_BY(hedge_mutex_) = false;
+  RemoteTabletServer* hedge_ts_ = nullptr;
+  CoarseTimePoint hedge_send_time_;
+  tserver::ReadRequestPB hedge_req_;
+  tserver::ReadResponsePB hedge_resp_;
+  rpc::RpcController hedge_controller_;
+  // Controller whose sidecars belong to resp_.
+  rpc::RpcController* response_controller_;
+  // Keeps this object alive until the response to the first attempt is received, when the
+  // operation was completed by the hedged request.
+  rpc::RpcCommandPtr hedge_retained_self_;
 };
 
 }  // namespace internal
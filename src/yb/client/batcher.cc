@@ -82,6 +82,12 @@ DEFINE_test_flag(double, simulate_tablet_lookup_does_not_match_partition_key_pro
                  "Probability for simulating the error that happens when a key is not in the key "
                  "range of the resolved tablet's partition.");
 
+DEFINE_RUNTIME_uint32(ycql_max_write_ops_per_tablet_rpc, 0,
+    "Non-transactional YCQL writes to the same tablet are split into RPCs of about this number "
+    "of operations, so the tablet could apply them in parallel. Operations with the same "
+    "partition key are always sent in the same RPC. 0 - do not split writes.");
+TAG_FLAG(ycql_max_write_ops_per_tablet_rpc, advanced);
+
 using std::pair;
 using std::shared_ptr;
 
@@ -102,6 +108,20 @@ namespace {
 
 const auto kGeneralErrorStatus = STATUS(IOError, Batcher::kErrorReachingOutToTServersMsg);
 
+// Returns true if the group of writes to the same tablet, that starts at group_start, should end
+// before it.
+bool NeedSplitWrites(
+    InFlightOpsGroup::Iterator group_start, InFlightOpsGroup::Iterator it,
+    size_t max_write_ops_per_rpc) {
+  if (!max_write_ops_per_rpc ||
+      static_cast<size_t>(it - group_start) < max_write_ops_per_rpc ||
+      it->yb_op->group() != OpGroup::kWrite ||
+      it->yb_op->type() != YBOperation::Type::QL_WRITE) {
+    return false;
+  }
+  return std::prev(it)->partition_key != it->partition_key;
+}
+
 }  // namespace
 
 // About lock ordering in this file:
@@ -465,17 +485,27 @@ void Batcher::AllLookupsDone() {
     return;
   }
 
+  // Writes that are not part of a transaction don't have to be applied atomically, so writes to
+  // the same tablet could be sent in several RPCs. Writes are ordered by partition key in this
+  // case, so operations on the same row stay in the same RPC in their original order.
+  const size_t max_write_ops_per_rpc =
+      transaction_ ? 0 : FLAGS_ycql_max_write_ops_per_tablet_rpc;
+
   // All operations were added, and tablets for them were resolved.
   // So we could sort them.
   std::sort(ops_queue_.begin(),
             ops_queue_.end(),
-            [](const InFlightOp& lhs, const InFlightOp& rhs) {
+            [max_write_ops_per_rpc](const InFlightOp& lhs, const InFlightOp& rhs) {
     if (lhs.tablet.get() == rhs.tablet.get()) {
       auto lgroup = lhs.yb_op->group();
       auto rgroup = rhs.yb_op->group();
       if (lgroup != rgroup) {
         return lgroup < rgroup;
       }
+      if (max_write_ops_per_rpc && lgroup == OpGroup::kWrite &&
+          lhs.partition_key != rhs.partition_key) {
+        return lhs.partition_key < rhs.partition_key;
+      }
       return lhs.sequence_number < rhs.sequence_number;
     }
     return lhs.tablet.get() < rhs.tablet.get();
@@ -497,7 +527,8 @@ void Batcher::AllLookupsDone() {
           it_tablet->partition_list_version()));
       return;
     }
-    if (current_tablet != it_tablet || current_group != it_group) {
+    if (current_tablet != it_tablet || current_group != it_group ||
+        NeedSplitWrites(group_start, it, max_write_ops_per_rpc)) {
       ops_info_.groups.emplace_back(group_start, it);
       group_start = it;
       current_group = it_group;
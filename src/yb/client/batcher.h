@@ -209,6 +209,11 @@ class Batcher : public Runnable, public std::enable_shared_from_this<Batcher> {
     return deadline_;
   }
 
+  // Ops added to this batcher.
+  const std::vector<YBOperationPtr>& ops() const {
+    return ops_;
+  }
+
   rpc::Messenger* messenger() const;
 
   rpc::ProxyCache& proxy_cache() const;
@@ -566,6 +566,9 @@ class YBClient::Data {
 
   std::array<std::atomic<int>, 2> tserver_count_cached_;
 
+  simple_spinlock flush_coalescer_mutex_;
+  FlushCoalescerPtr flush_coalescer_;
+
  private:
   Status FlushTablesHelper(YBClient* client,
                            const CoarseTimePoint deadline,
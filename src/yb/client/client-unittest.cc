@@ -38,8 +38,11 @@
 #include <gtest/gtest.h>
 
 #include "yb/client/client-internal.h"
+#include "yb/client/meta_cache.h"
 #include "yb/client/schema.h"
 
+#include "yb/util/random_util.h"
+
 namespace yb {
 namespace client {
 
@@ -105,5 +108,18 @@ TEST(ClientUnitTest, TestSchemaBuilder_SingleKey_GoodSchema) {
   ASSERT_EQ("OK", b.Build(&s).ToString());
 }
 
+TEST(ClientUnitTest, ReadLatencyP95) {
+  internal::RemoteTabletServer ts("ts", nullptr);
+  ASSERT_FALSE(ts.ReadLatencyP95().Initialized());
+
+  // Latencies are uniformly distributed between 1ms and 100ms.
+  for (int i = 0; i != 20000; ++i) {
+    ts.ReportReadLatency(MonoDelta::FromMilliseconds(RandomUniformInt(1, 100)));
+  }
+  auto p95 = ts.ReadLatencyP95();
+  ASSERT_GE(p95, MonoDelta::FromMilliseconds(85));
+  ASSERT_LE(p95, MonoDelta::FromMilliseconds(100));
+}
+
 } // namespace client
 } // namespace yb
@@ -54,6 +54,7 @@
 #include "yb/client/client-internal.h"
 #include "yb/client/client_builder-internal.h"
 #include "yb/client/client_utils.h"
+#include "yb/client/flush_coalescer.h"
 #include "yb/client/meta_cache.h"
 #include "yb/client/namespace_alterer.h"
 #include "yb/client/permissions.h"
@@ -2182,6 +2183,10 @@ Result<std::shared_ptr<internal::RemoteTabletServer>> YBClient::GetRemoteTabletS
   return tserver;
 }
 
+internal::RemoteTabletPtr YBClient::LookupCachedTabletById(const TabletId& tablet_id) {
+  return data_->meta_cache_->LookupCachedTabletById(tablet_id);
+}
+
 void YBClient::RequestsFinished(const RetryableRequestIdRange& request_id_range) {
   if (request_id_range.empty()) {
     return;
@@ -2591,6 +2596,14 @@ shared_ptr<YBSession> YBClient::NewSession(CoarseTimePoint deadline) {
   return std::make_shared<YBSession>(this, deadline);
 }
 
+FlushCoalescerPtr YBClient::flush_coalescer() {
+  std::lock_guard lock(data_->flush_coalescer_mutex_);
+  if (!data_->flush_coalescer_) {
+    data_->flush_coalescer_ = std::make_shared<FlushCoalescer>(this, data_->clock_);
+  }
+  return data_->flush_coalescer_;
+}
+
 bool YBClient::IsMultiMaster() const {
   return data_->IsMultiMaster();
 }
@@ -828,6 +828,10 @@ class YBClient {
   std::shared_ptr<YBSession> NewSession(MonoDelta delta);
   std::shared_ptr<YBSession> NewSession(CoarseTimePoint deadline);
 
+  // Returns coalescer that could be shared by sessions of this client to combine their flushes.
+  // Created on first use.
+  FlushCoalescerPtr flush_coalescer();
+
   Status AreNodesSafeToTakeDown(
       std::vector<std::string> tserver_uuids, std::vector<std::string> master_uuids,
       int follower_lag_bound_ms);
@@ -981,6 +985,9 @@ class YBClient {
   Result<std::shared_ptr<internal::RemoteTabletServer>> GetRemoteTabletServer(
       const std::string& permanent_uuid);
 
+  // Returns the tablet from this client's meta_cache, or null if it is not cached.
+  internal::RemoteTabletPtr LookupCachedTabletById(const TabletId& tablet_id);
+
   void RequestsFinished(const RetryableRequestIdRange& request_id_range);
 
   void Shutdown();
@@ -73,6 +73,9 @@ using FlushCallback = boost::function<void(FlushStatus*)>;
 using CommitCallback = boost::function<void(const Status&)>;
 using CreateCallback = boost::function<void(const Status&)>;
 
+class FlushCoalescer;
+using FlushCoalescerPtr = std::shared_ptr<FlushCoalescer>;
+
 class YBTable;
 typedef std::shared_ptr<YBTable> YBTablePtr;
 typedef std::vector<PartitionKey> TablePartitionList;
@@ -84,6 +87,7 @@ class YBOperation;
 typedef std::shared_ptr<YBOperation> YBOperationPtr;
 
 class TableHandle;
+class TransactionHeartbeatBatcher;
 class TransactionManager;
 class TransactionPool;
 class YBColumnSpec;
@@ -0,0 +1,117 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/client/flush_coalescer.h"
+
+#include <unordered_map>
+
+#include "yb/client/error.h"
+#include "yb/client/rejection_score_source.h"
+#include "yb/client/session.h"
+#include "yb/client/yb_op.h"
+
+#include "yb/util/flags.h"
+
+DEFINE_RUNTIME_uint32(client_flush_coalescer_max_in_flight, 4,
+    "Max number of coalesced flushes that are in flight at the same time. Flushes issued while "
+    "this limit is reached are queued and sent together when one of the in flight flushes "
+    "completes.");
+
+namespace yb::client {
+
+FlushCoalescer::FlushCoalescer(YBClient* client, const scoped_refptr<ClockBase>& clock)
+    : client_(client), clock_(clock) {
+}
+
+void FlushCoalescer::Flush(
+    std::vector<YBOperationPtr> ops, CoarseTimePoint deadline, FlushCallback callback) {
+  PendingFlushes flushes;
+  flushes.push_back(PendingFlush {
+    .ops = std::move(ops),
+    .deadline = deadline,
+    .callback = std::move(callback),
+  });
+  {
+    std::lock_guard lock(mutex_);
+    if (num_in_flight_ >= std::max<uint32_t>(FLAGS_client_flush_coalescer_max_in_flight, 1)) {
+      queue_.push_back(std::move(flushes.front()));
+      return;
+    }
+    ++num_in_flight_;
+  }
+  Send(std::move(flushes));
+}
+
+void FlushCoalescer::Send(PendingFlushes flushes) {
+  auto deadline = CoarseTimePoint::max();
+  for (const auto& flush : flushes) {
+    deadline = std::min(deadline, flush.deadline);
+  }
+  auto session = std::make_shared<YBSession>(client_, deadline, clock_);
+  session->SetRejectionScoreSource(std::make_shared<RejectionScoreSource>());
+  for (const auto& flush : flushes) {
+    session->Apply(flush.ops);
+  }
+  VLOG(4) << "Coalesced " << flushes.size() << " flushes";
+  session->FlushAsync(
+      [self = shared_from_this(), session, flushes = std::move(flushes)](FlushStatus* status) {
+    self->Done(flushes, status);
+  });
+}
+
+void FlushCoalescer::Done(const PendingFlushes& flushes, FlushStatus* flush_status) {
+  std::vector<FlushStatus> statuses(flushes.size());
+  if (!flush_status->status.ok()) {
+    // Route each op error to the flush that the op belongs to. When the failure is not attributed
+    // to particular ops, every flush fails with the overall status.
+    bool fail_all = flush_status->errors.empty();
+    std::unordered_map<const YBOperation*, size_t> op_to_flush;
+    for (size_t i = 0; i != flushes.size(); ++i) {
+      for (const auto& op : flushes[i].ops) {
+        op_to_flush.emplace(op.get(), i);
+      }
+    }
+    for (auto& error : flush_status->errors) {
+      auto it = op_to_flush.find(&error->failed_op());
+      if (it == op_to_flush.end()) {
+        fail_all = true;
+        continue;
+      }
+      statuses[it->second].errors.push_back(std::move(error));
+    }
+    for (auto& status : statuses) {
+      if (fail_all || !status.errors.empty()) {
+        status.status = flush_status->status;
+      }
+    }
+  }
+
+  PendingFlushes next;
+  {
+    std::lock_guard lock(mutex_);
+    if (queue_.empty()) {
+      --num_in_flight_;
+    } else {
+      next.swap(queue_);
+    }
+  }
+  if (!next.empty()) {
+    Send(std::move(next));
+  }
+
+  for (size_t i = 0; i != flushes.size(); ++i) {
+    flushes[i].callback(&statuses[i]);
+  }
+}
+
+} // namespace yb::client
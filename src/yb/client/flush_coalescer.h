@@ -0,0 +1,65 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "yb/client/client_fwd.h"
+
+#include "yb/common/clock.h"
+
+#include "yb/gutil/thread_annotations.h"
+
+#include "yb/util/monotime.h"
+
+namespace yb::client {
+
+// Coalesces flushes of non-transactional writes issued concurrently by different sessions.
+// Operations of all coalesced flushes are flushed by a single session, so operations targeting the
+// same tablet are sent in a single RPC.
+//
+// A flush is sent immediately while fewer than client_flush_coalescer_max_in_flight coalesced
+// flushes are in flight. Otherwise it is queued, and all queued flushes are sent together when one
+// of the in flight flushes completes. So flushes are only delayed when there is enough concurrency
+// to coalesce them.
+class FlushCoalescer : public std::enable_shared_from_this<FlushCoalescer> {
+ public:
+  FlushCoalescer(YBClient* client, const scoped_refptr<ClockBase>& clock);
+
+  // Flushes ops, invoking callback with the errors of these ops only. Ops should be writes that
+  // do not belong to a transaction.
+  void Flush(std::vector<YBOperationPtr> ops, CoarseTimePoint deadline, FlushCallback callback);
+
+ private:
+  struct PendingFlush {
+    std::vector<YBOperationPtr> ops;
+    CoarseTimePoint deadline;
+    FlushCallback callback;
+  };
+
+  using PendingFlushes = std::vector<PendingFlush>;
+
+  void Send(PendingFlushes flushes);
+  void Done(const PendingFlushes& flushes, FlushStatus* flush_status);
+
+  YBClient* const client_;
+  const scoped_refptr<ClockBase> clock_;
+
+  std::mutex mutex_;
+  size_t num_in_flight_ GUARDED_BY(mutex_) = 0;
+  PendingFlushes queue_ GUARDED_BY(mutex_);
+};
+
+} // namespace yb::client
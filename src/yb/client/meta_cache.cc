@@ -106,6 +106,10 @@ DEFINE_UNKNOWN_int64(meta_cache_lookup_throttling_step_ms, 5,
 DEFINE_UNKNOWN_int64(meta_cache_lookup_throttling_max_delay_ms, 1000,
              "Max delay between calls during lookup throttling.");
 
+DEFINE_RUNTIME_bool(meta_cache_lock_free_lookups, true,
+    "Whether to look up tablets by partition key in snapshots of the MetaCache, without taking "
+    "the MetaCache lock, before falling back to the regular lookup.");
+
 DEFINE_test_flag(bool, force_master_lookup_all_tablets, false,
                  "If set, force the client to go to the master for all tablet lookup "
                  "instead of reading from cache.");
@@ -297,6 +301,30 @@ std::string RemoteTabletServer::TEST_PlacementZone() const {
   return cloud_info_pb_.placement_zone();
 }
 
+void RemoteTabletServer::ReportReadLatency(MonoDelta latency) {
+  // Streaming quantile estimation: the estimate moves up 19 times faster than it moves down, so
+  // it settles where 5% of samples are above it. Concurrent updates could be lost, that is fine
+  // for an estimate.
+  auto sample = std::max<int64_t>(latency.ToMicroseconds(), 1);
+  auto estimate = read_latency_p95_us_.load(std::memory_order_relaxed);
+  if (estimate == 0) {
+    estimate = sample;
+  } else {
+    auto step = std::max<int64_t>(estimate / 32, 20);
+    if (sample > estimate) {
+      estimate = std::min(estimate + step * 19 / 20, sample);
+    } else if (sample < estimate) {
+      estimate = std::max<int64_t>(estimate - step / 20, 1);
+    }
+  }
+  read_latency_p95_us_.store(estimate, std::memory_order_relaxed);
+}
+
+MonoDelta RemoteTabletServer::ReadLatencyP95() const {
+  auto estimate = read_latency_p95_us_.load(std::memory_order_relaxed);
+  return estimate ? MonoDelta::FromMicroseconds(estimate) : MonoDelta();
+}
+
 std::string ReplicasCount::ToString() {
   return Format(
       " live replicas $0, read replicas $1, expected live replicas $2, expected read replicas $3",
@@ -944,6 +972,7 @@ Status MetaCache::ProcessTabletLocations(
   RETURN_NOT_OK(CheckTabletLocations(locations, allow_split_tablets));
 
   std::vector<std::pair<LookupCallback, LookupCallbackVisitor>> to_notify;
+  TablePartitionTabletsMap partition_tablets;
   {
     std::lock_guard lock(mutex_);
     ProcessedTablesMap processed_tables;
@@ -961,6 +990,14 @@ Status MetaCache::ProcessTabletLocations(
         }
       }
     }
+    if (table_partition_list_version.has_value()) {
+      for (const auto& [table_id, _] : processed_tables) {
+        auto table_it = tables_.find(table_id);
+        if (table_it != tables_.end()) {
+          partition_tablets.emplace(table_id, SnapshotPartitionTabletsUnlocked(table_it->second));
+        }
+      }
+    }
     if (lookup_rpc) {
       lookup_rpc->AddCallbacksToBeNotified(processed_tables, &tables_, &to_notify);
       lookup_rpc->CleanupRequest();
@@ -971,6 +1008,8 @@ Status MetaCache::ProcessTabletLocations(
     boost::apply_visitor(callback_and_param.second, callback_and_param.first);
   }
 
+  PublishPartitionTablets(std::move(partition_tablets));
+
   return Status::OK();
 }
 
@@ -1123,6 +1162,7 @@ void MetaCache::InvalidateTableCache(const YBTable& table) {
       "table: $0, table.partition_list.version: $1", table_id, table_partition_list->version);
 
   std::vector<LookupCallback> to_notify;
+  TablePartitionTabletsMap partition_tablets;
 
   auto invalidate_needed = [this, &table_id, &table_partition_list](const auto& it) {
     const auto table_data_partition_list_version = it->second.partition_list->version;
@@ -1180,7 +1220,9 @@ void MetaCache::InvalidateTableCache(const YBTable& table) {
     // Only update partitions here after invalidating TableData cache to avoid inconsistencies.
     // See https://github.com/yugabyte/yugabyte-db/issues/6890.
     table_data.partition_list = table_partition_list;
+    partition_tablets.emplace(table_id, SnapshotPartitionTabletsUnlocked(table_data));
   }
+  PublishPartitionTablets(std::move(partition_tablets));
   for (const auto& callback : to_notify) {
     const auto s = STATUS_EC_FORMAT(
         TryAgain, ClientError(ClientErrorCode::kMetaCacheInvalidated),
@@ -1199,6 +1241,11 @@ std::shared_ptr<RemoteTabletServer> MetaCache::GetRemoteTabletServer(
   return nullptr;
 }
 
+RemoteTabletPtr MetaCache::LookupCachedTabletById(const TabletId& tablet_id) {
+  SharedLock lock(mutex_);
+  return LookupTabletByIdFastPathUnlocked(tablet_id).value_or(nullptr);
+}
+
 class MetaCache::CallbackNotifier {
  public:
   explicit CallbackNotifier(const Status& status) : status_(status) {}
@@ -1820,6 +1867,68 @@ RemoteTabletPtr MetaCache::LookupTabletByKeyFastPathUnlocked(
   return nullptr;
 }
 
+RemoteTabletPtr MetaCache::LockFreeLookupTabletByKey(
+    const TableId& table_id, const VersionedTablePartitionListPtr& partitions,
+    size_t partition_idx) {
+  auto tables = partition_tablets_.get();
+  auto it = tables->find(table_id);
+  if (it == tables->end()) {
+    return nullptr;
+  }
+  const auto& snapshot = *it->second;
+  if (snapshot.partition_list->version != partitions->version) {
+    return nullptr;
+  }
+
+  DCHECK_LT(partition_idx, snapshot.tablets.size());
+  const auto& result = snapshot.tablets[partition_idx];
+  // Stale entries must be re-fetched.
+  if (!result || result->stale() || !result->HasLeader()) {
+    return nullptr;
+  }
+  const auto& partition_end = result->partition().partition_key_end();
+  if (!partition_end.empty() && partition_end <= snapshot.partition_list->keys[partition_idx]) {
+    return nullptr;
+  }
+  return result;
+}
+
+std::shared_ptr<const TablePartitionTablets> MetaCache::SnapshotPartitionTabletsUnlocked(
+    const TableData& table_data) {
+  auto result = std::make_shared<TablePartitionTablets>();
+  result->generation = ++partition_tablets_generation_;
+  result->partition_list = table_data.partition_list;
+  const auto& keys = table_data.partition_list->keys;
+  result->tablets.reserve(keys.size());
+  // Both keys and tablets_by_partition are ordered by partition start.
+  auto tablet_it = table_data.tablets_by_partition.begin();
+  const auto tablet_end = table_data.tablets_by_partition.end();
+  for (const auto& key : keys) {
+    while (tablet_it != tablet_end && tablet_it->first < key) {
+      ++tablet_it;
+    }
+    result->tablets.push_back(
+        tablet_it != tablet_end && tablet_it->first == key ? tablet_it->second : RemoteTabletPtr());
+  }
+  return result;
+}
+
+void MetaCache::PublishPartitionTablets(TablePartitionTabletsMap snapshots) {
+  if (snapshots.empty()) {
+    return;
+  }
+  std::lock_guard lock(partition_tablets_mutex_);
+  auto tables = *partition_tablets_.get();
+  for (auto& [table_id, snapshot] : snapshots) {
+    // Snapshots taken under mutex_ could be published in a different order.
+    auto& current = tables[table_id];
+    if (!current || current->generation < snapshot->generation) {
+      current = std::move(snapshot);
+    }
+  }
+  partition_tablets_.Set(std::move(tables));
+}
+
 boost::optional<std::vector<RemoteTabletPtr>> MetaCache::FastLookupAllTabletsUnlocked(
     const std::shared_ptr<const YBTable>& table) {
   auto tablets = std::vector<RemoteTabletPtr>();
@@ -2040,12 +2149,23 @@ void MetaCache::LookupTabletByKey(const std::shared_ptr<YBTable>& table,
   }
 
   const auto table_partition_list = table->GetVersionedPartitions();
-  const auto partition_start = client::FindPartitionStart(table_partition_list, partition_key);
+  const auto partition_idx = FindPartitionStartIndex(table_partition_list->keys, partition_key);
+  const PartitionKeyPtr partition_start(
+      table_partition_list, &table_partition_list->keys[partition_idx]);
   VLOG_WITH_PREFIX_AND_FUNC(5) << "Table: " << table->ToString()
                     << ", table_partition_list: " << table_partition_list->ToString()
                     << ", partition_key: " << Slice(partition_key).ToDebugHexString()
                     << ", partition_start: " << Slice(*partition_start).ToDebugHexString();
 
+  if (FLAGS_meta_cache_lock_free_lookups) {
+    auto tablet = LockFreeLookupTabletByKey(table->id(), table_partition_list, partition_idx);
+    if (tablet) {
+      VLOG_WITH_PREFIX(5) << "Lock free lookup: found tablet " << tablet->tablet_id();
+      callback(tablet);
+      return;
+    }
+  }
+
   PartitionGroupStartKeyPtr partition_group_start;
   if (DoLookupTabletByKey<SharedLock<std::shared_timed_mutex>>(
           table, table_partition_list, partition_start, deadline, &callback,
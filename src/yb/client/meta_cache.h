@@ -32,6 +32,7 @@
 // This module is internal to the client and not a public API.
 #pragma once
 
+#include <atomic>
 #include <shared_mutex>
 #include <map>
 #include <string>
@@ -64,6 +65,7 @@
 #include "yb/tserver/tserver_fwd.h"
 
 #include "yb/util/capabilities.h"
+#include "yb/util/concurrent_value.h"
 #include "yb/util/format.h"
 #include "yb/util/locks.h"
 #include "yb/util/lockfree.h"
@@ -152,6 +154,13 @@ class RemoteTabletServer {
 
   std::string TEST_PlacementZone() const;
 
+  // Updates the estimate of the 95th percentile of read latency with a new sample.
+  void ReportReadLatency(MonoDelta latency);
+
+  // Returns the estimated 95th percentile of read latency, or an uninitialized MonoDelta if no
+  // reads were reported yet.
+  MonoDelta ReadLatencyP95() const;
+
  private:
   mutable rw_spinlock mutex_;
   const std::string uuid_;
@@ -164,6 +173,7 @@ class RemoteTabletServer {
   const tserver::LocalTabletServer* const local_tserver_ = nullptr;
   scoped_refptr<EventStats> dns_resolve_stats_;
   std::vector<CapabilityId> capabilities_ GUARDED_BY(mutex_);
+  std::atomic<int64_t> read_latency_p95_us_{0};
 
   DISALLOW_COPY_AND_ASSIGN(RemoteTabletServer);
 };
@@ -475,6 +485,19 @@ struct TableData {
   // miss the key, because it doesn't exist in 1st post-split tablet.
 };
 
+// Immutable snapshot of TableData::tablets_by_partition, used to look up tablets by key without
+// taking MetaCache::mutex_. tablets[i] is the tablet serving the partition that starts at
+// partition_list->keys[i], or nullptr if it is not known yet.
+struct TablePartitionTablets {
+  // Snapshots taken later have higher generations.
+  uint64_t generation;
+  VersionedTablePartitionListPtr partition_list;
+  std::vector<RemoteTabletPtr> tablets;
+};
+
+using TablePartitionTabletsMap =
+    std::unordered_map<TableId, std::shared_ptr<const TablePartitionTablets>>;
+
 class LookupCallbackVisitor : public boost::static_visitor<> {
  public:
   explicit LookupCallbackVisitor(const LookupCallbackParam& param) : param_(param) {
@@ -584,6 +607,9 @@ class MetaCache : public RefCountedThreadSafe<MetaCache> {
 
   std::shared_ptr<RemoteTabletServer> GetRemoteTabletServer(const std::string& permanent_uuid);
 
+  // Returns the tablet if it is present in the cache, null otherwise. Never contacts master.
+  RemoteTabletPtr LookupCachedTabletById(const TabletId& tablet_id);
+
   const std::string& LogPrefix() const { return log_prefix_; }
 
  private:
@@ -603,6 +629,19 @@ class MetaCache : public RefCountedThreadSafe<MetaCache> {
   std::optional<RemoteTabletPtr> LookupTabletByIdFastPathUnlocked(const TabletId& tablet_id)
       REQUIRES_SHARED(mutex_);
 
+  // Lookup the tablet serving the partition with the specified index in partitions, using
+  // snapshots published by PublishPartitionTablets. Does not take mutex_.
+  RemoteTabletPtr LockFreeLookupTabletByKey(
+      const TableId& table_id, const VersionedTablePartitionListPtr& partitions,
+      size_t partition_idx);
+
+  std::shared_ptr<const TablePartitionTablets> SnapshotPartitionTabletsUnlocked(
+      const TableData& table_data) REQUIRES(mutex_);
+
+  // Makes snapshots visible to LockFreeLookupTabletByKey. Waits for concurrent lock free lookups
+  // to complete, so should be called after mutex_ is released.
+  void PublishPartitionTablets(TablePartitionTabletsMap snapshots) EXCLUDES(mutex_);
+
   // Update our information about the given tablet server.
   //
   // This is called when we get some response from the master which contains
@@ -710,6 +749,14 @@ class MetaCache : public RefCountedThreadSafe<MetaCache> {
   // Cache of deleted tablets.
   std::unordered_set<TabletId> deleted_tablets_ GUARDED_BY(mutex_);
 
+  uint64_t partition_tablets_generation_ GUARDED_BY(mutex_) = 0;
+
+  // Serializes updates of partition_tablets_.
+  std::mutex partition_tablets_mutex_;
+
+  // Latest snapshots of tablets_by_partition of tables, read without locks.
+  ConcurrentValue<TablePartitionTabletsMap> partition_tablets_;
+
   // Prevents master lookup "storms" by delaying master lookups when all
   // permits have been acquired.
   Semaphore master_lookup_sem_;
@@ -18,22 +18,28 @@
 #include "yb/client/session.h"
 #include "yb/client/table.h"
 #include "yb/client/table_alterer.h"
+#include "yb/client/meta_cache.h"
 #include "yb/client/transaction.h"
+#include "yb/client/transaction_heartbeat_batcher.h"
 #include "yb/client/transaction_rpc.h"
 #include "yb/client/txn-test-base.h"
 #include "yb/client/yb_op.h"
 
 #include "yb/common/ql_value.h"
+#include "yb/common/transaction_error.h"
+#include "yb/common/wire_protocol.h"
 
 #include "yb/consensus/consensus.h"
 #include "yb/consensus/log.h"
 
 #include "yb/rocksdb/db.h"
+#include "yb/rocksdb/rate_limiter.h"
 
 #include "yb/rpc/rpc.h"
 
 #include "yb/tablet/tablet.h"
 #include "yb/tablet/tablet_bootstrap_if.h"
+#include "yb/tablet/tablet_options.h"
 #include "yb/tablet/tablet_peer.h"
 #include "yb/tablet/transaction_coordinator.h"
 
@@ -44,6 +50,7 @@
 
 #include "yb/util/async_util.h"
 #include "yb/util/backoff_waiter.h"
+#include "yb/util/countdown_latch.h"
 #include "yb/util/random_util.h"
 #include "yb/util/scope_exit.h"
 #include "yb/util/size_literals.h"
@@ -58,6 +65,9 @@ using namespace std::literals;
 using yb::tablet::GetTransactionTimeout;
 
 DECLARE_bool(TEST_disable_proactive_txn_cleanup_on_abort);
+DECLARE_bool(TEST_fail_first_apply_transactions_request);
+DECLARE_bool(batch_apply_transaction_requests);
+DECLARE_bool(batch_transaction_heartbeats);
 DECLARE_bool(TEST_fail_in_apply_if_no_metadata);
 DECLARE_bool(TEST_master_fail_transactional_tablet_lookups);
 DECLARE_bool(TEST_transaction_allow_rerequest_status);
@@ -68,16 +78,25 @@ DECLARE_bool(flush_rocksdb_on_shutdown);
 DECLARE_bool(rocksdb_disable_compactions);
 DECLARE_bool(enable_ondisk_compression);
 DECLARE_int32(TEST_delay_init_tablet_peer_ms);
+DECLARE_int32(TEST_update_transactions_delay_ms);
 DECLARE_int32(log_min_seconds_to_retain);
 DECLARE_int32(intents_flush_max_delay_ms);
 DECLARE_int32(remote_bootstrap_max_chunk_size);
+DECLARE_int32(transaction_table_num_tablets);
 DECLARE_int64(transaction_rpc_timeout_ms);
 DECLARE_int64(db_block_cache_size_bytes);
 DECLARE_int64(db_write_buffer_size);
+DECLARE_int64(intents_cleanup_rate_limit_bytes_per_sec);
 DECLARE_uint64(TEST_transaction_delay_status_reply_usec_in_tests);
 DECLARE_uint64(aborted_intent_cleanup_ms);
 DECLARE_uint64(max_clock_skew_usec);
+DECLARE_uint64(transaction_resend_applying_interval_usec);
 DECLARE_uint64(transaction_heartbeat_usec);
+DECLARE_uint32(transaction_heartbeat_max_batch_size);
+
+METRIC_DECLARE_histogram(handler_latency_yb_tserver_TabletServerService_ApplyTransactions);
+METRIC_DECLARE_histogram(handler_latency_yb_tserver_TabletServerService_UpdateTransaction);
+METRIC_DECLARE_histogram(handler_latency_yb_tserver_TabletServerService_UpdateTransactions);
 
 namespace yb {
 namespace client {
@@ -435,6 +454,61 @@ TEST_F(QLTransactionTest, Cleanup) {
   AssertNoRunningTransactions();
 }
 
+class QLTransactionIntentsCleanupRateLimitTest : public QLTransactionTest {
+ protected:
+  static constexpr int64_t kRateLimitBytesPerSec = 32_KB;
+
+  void SetUp() override {
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_intents_cleanup_rate_limit_bytes_per_sec) =
+        kRateLimitBytesPerSec;
+    QLTransactionTest::SetUp();
+  }
+
+  // Returns max number of bytes that passed the intents cleanup rate limiter of a tablet server.
+  int64_t MaxCleanupBytesThrough() {
+    int64_t result = 0;
+    for (size_t i = 0; i != cluster_->num_tablet_servers(); ++i) {
+      auto* tablet_manager = cluster_->mini_tablet_server(i)->server()->tablet_manager();
+      auto& rate_limiter = tablet_manager->TEST_tablet_options()->intents_cleanup_rate_limiter;
+      result = std::max(result, rate_limiter->GetTotalBytesThrough());
+    }
+    return result;
+  }
+};
+
+TEST_F(QLTransactionIntentsCleanupRateLimitTest, PacesAbortedIntentsRemoval) {
+  constexpr int kNumRows = 500;
+
+  // Intents of applied transactions are removed without throttling.
+  WriteData();
+  ASSERT_OK(WaitTransactionsCleaned());
+  ASSERT_OK(WaitIntentsCleaned());
+  ASSERT_EQ(MaxCleanupBytesThrough(), 0);
+
+  auto txn = CreateTransaction();
+  auto session = CreateSession(txn);
+  for (int i = 0; i != kNumRows; ++i) {
+    ASSERT_OK(WriteRow(session, kNumRows + i, i, WriteOpType::INSERT, Flush::kFalse));
+  }
+  ASSERT_OK(session->TEST_Flush());
+  ASSERT_GT(CountIntents(cluster_.get()), 0);
+
+  auto start = MonoTime::Now();
+  txn->Abort();
+  ASSERT_OK(WaitFor(
+      [this] { return CountIntents(cluster_.get()) == 0; }, 60s * kTimeMultiplier,
+      "Aborted intents cleaned"));
+  auto elapsed = MonoTime::Now() - start;
+
+  // Each tablet server removes intents of all tablets it hosts, sharing a single limiter, that
+  // starts without available tokens and is refilled every 100ms.
+  auto bytes = MaxCleanupBytesThrough();
+  LOG(INFO) << "Removed " << bytes << " bytes of intents in " << elapsed;
+  ASSERT_GT(bytes, 0);
+  auto min_elapsed = MonoDelta::FromSeconds(static_cast<double>(bytes) / kRateLimitBytesPerSec);
+  ASSERT_GE(elapsed, min_elapsed - 200ms);
+}
+
 TEST_F(QLTransactionTest, Heartbeat) {
   auto txn = CreateTransaction();
   auto session = CreateSession(txn);
@@ -515,6 +589,299 @@ TEST_F(QLTransactionTest, ResendApplying) {
   AssertNoRunningTransactions();
 }
 
+class QLTransactionBatchedHeartbeatTest : public QLTransactionTest {
+ protected:
+  void SetUp() override {
+    // Use single status tablet, so heartbeats of all transactions could be batched together.
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_transaction_table_num_tablets) = 1;
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_batch_transaction_heartbeats) = true;
+    QLTransactionTest::SetUp();
+  }
+
+  uint64_t CountRpcs(const HistogramPrototype& prototype) {
+    uint64_t result = 0;
+    for (size_t i = 0; i != cluster_->num_tablet_servers(); ++i) {
+      result += prototype.Instantiate(
+          cluster_->mini_tablet_server(i)->server()->metric_entity())->TotalCount();
+    }
+    return result;
+  }
+
+  Result<internal::RemoteTabletPtr> LookupStatusTablet(const YBTransactionPtr& txn) {
+    auto metadata = VERIFY_RESULT(Copy(txn->GetMetadata(TransactionRpcDeadline()).get()));
+    return MakeFuture<Result<internal::RemoteTabletPtr>>([this, &metadata](auto callback) {
+      client_->LookupTabletById(
+          metadata.status_tablet, /* table= */ nullptr, master::IncludeInactive::kFalse,
+          master::IncludeDeleted::kFalse, TransactionRpcDeadline(),
+          [callback](const auto& lookup_result) {
+            callback(lookup_result);
+          }, UseCache::kTrue);
+    }).get();
+  }
+
+  Result<tserver::UpdateTransactionsResponsePB> SendUpdateTransactions(
+      tserver::UpdateTransactionsRequestPB* req) {
+    rpc::Rpcs rpcs;
+    auto handle = rpcs.InvalidHandle();
+    std::promise<Result<tserver::UpdateTransactionsResponsePB>> promise;
+    rpcs.RegisterAndStart(
+        client::UpdateTransactions(
+            TransactionRpcDeadline(), /* tablet= */ nullptr, client_.get(), req,
+            [&rpcs, &handle, &promise](
+                const Status& status, const tserver::UpdateTransactionsRequestPB&,
+                const tserver::UpdateTransactionsResponsePB& resp) {
+          rpcs.Unregister(&handle);
+          if (status.ok()) {
+            promise.set_value(resp);
+          } else {
+            promise.set_value(status);
+          }
+        }),
+        &handle);
+    return promise.get_future().get();
+  }
+};
+
+void AddPendingState(const TransactionId& id, tserver::UpdateTransactionsRequestPB* req) {
+  auto& state = *req->add_states();
+  state.set_transaction_id(id.data(), id.size());
+  state.set_status(TransactionStatus::PENDING);
+}
+
+// Keeps many transactions that use the same status tablet open, while UpdateTransactions RPCs are
+// slow, so heartbeats are queued and sent in batches.
+TEST_F_EX(QLTransactionTest, BatchedHeartbeats, QLTransactionBatchedHeartbeatTest) {
+  constexpr size_t kTransactions = 100;
+  // Smaller than number of transactions, so heartbeats of a single period are split into batches.
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_transaction_heartbeat_max_batch_size) = 50;
+
+  std::vector<YBTransactionPtr> transactions;
+  TabletId status_tablet;
+  for (size_t i = 0; i != kTransactions; ++i) {
+    auto txn = CreateTransaction();
+    ASSERT_OK(WriteRows(CreateSession(txn), i));
+    auto metadata = ASSERT_RESULT(Copy(txn->GetMetadata(TransactionRpcDeadline()).get()));
+    if (status_tablet.empty()) {
+      status_tablet = metadata.status_tablet;
+    }
+    ASSERT_EQ(metadata.status_tablet, status_tablet);
+    transactions.push_back(std::move(txn));
+  }
+
+  const auto heartbeat_period = std::chrono::microseconds(FLAGS_transaction_heartbeat_usec);
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_update_transactions_delay_ms) = narrow_cast<int32_t>(
+      ToMilliseconds(heartbeat_period / 5));
+  auto single_rpcs_before = CountRpcs(
+      METRIC_handler_latency_yb_tserver_TabletServerService_UpdateTransaction);
+  auto batch_rpcs_before = CountRpcs(
+      METRIC_handler_latency_yb_tserver_TabletServerService_UpdateTransactions);
+
+  // Transactions are kept alive only by batched heartbeats.
+  const auto sleep_time = std::chrono::duration_cast<std::chrono::microseconds>(
+      GetTransactionTimeout() * 2);
+  std::this_thread::sleep_for(sleep_time);
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_update_transactions_delay_ms) = 0;
+
+  auto single_rpcs = CountRpcs(
+      METRIC_handler_latency_yb_tserver_TabletServerService_UpdateTransaction) -
+      single_rpcs_before;
+  auto batch_rpcs = CountRpcs(
+      METRIC_handler_latency_yb_tserver_TabletServerService_UpdateTransactions) -
+      batch_rpcs_before;
+  uint64_t expected_heartbeats = kTransactions * (sleep_time / heartbeat_period);
+  LOG(INFO) << "UpdateTransaction RPCs: " << single_rpcs << ", UpdateTransactions RPCs: "
+            << batch_rpcs << ", expected heartbeats: " << expected_heartbeats;
+  ASSERT_EQ(single_rpcs, 0U);
+  ASSERT_GT(batch_rpcs, 0U);
+  ASSERT_LT(batch_rpcs * 4, expected_heartbeats);
+
+  for (auto& txn : transactions) {
+    ASSERT_OK(txn->CommitFuture().get());
+  }
+  VerifyData(kTransactions);
+  ASSERT_OK(WaitTransactionsCleaned());
+}
+
+// Checks that entries of UpdateTransactions for aborted and expired transactions fail, without
+// affecting other transactions of the same batch.
+TEST_F_EX(QLTransactionTest, BatchedHeartbeatsWithAbortedTransaction,
+          QLTransactionBatchedHeartbeatTest) {
+  std::vector<YBTransactionPtr> transactions;
+  std::vector<TransactionMetadata> metadatas;
+  for (size_t i = 0; i != 3; ++i) {
+    auto txn = CreateTransaction();
+    ASSERT_OK(WriteRows(CreateSession(txn), i));
+    metadatas.push_back(ASSERT_RESULT(Copy(txn->GetMetadata(TransactionRpcDeadline()).get())));
+    ASSERT_EQ(metadatas.back().status_tablet, metadatas.front().status_tablet);
+    transactions.push_back(std::move(txn));
+  }
+
+  auto aborted_txn = transactions[1];
+  aborted_txn->Abort();
+  ASSERT_OK(WaitFor([this, &metadatas]() -> Result<bool> {
+    tserver::GetTransactionStatusRequestPB req;
+    req.set_tablet_id(metadatas[1].status_tablet);
+    req.add_transaction_id()->assign(
+        pointer_cast<const char*>(metadatas[1].transaction_id.data()),
+        metadatas[1].transaction_id.size());
+    rpc::Rpcs rpcs;
+    auto resp = VERIFY_RESULT(rpc::WrapRpcFuture<tserver::GetTransactionStatusResponsePB>(
+        GetTransactionStatus, &rpcs)(
+            TransactionRpcDeadline(), /* tablet= */ nullptr, client_.get(), &req).get());
+    return resp.status(0) == TransactionStatus::ABORTED;
+  }, 10s * kTimeMultiplier, "Transaction aborted"));
+
+  tserver::UpdateTransactionsRequestPB req;
+  req.set_tablet_id(metadatas[0].status_tablet);
+  AddPendingState(metadatas[0].transaction_id, &req);
+  AddPendingState(metadatas[1].transaction_id, &req);
+  // Unknown transaction is handled by coordinator in the same way as expired one.
+  AddPendingState(TransactionId::GenerateRandom(), &req);
+  AddPendingState(metadatas[2].transaction_id, &req);
+  auto resp = ASSERT_RESULT(SendUpdateTransactions(&req));
+  ASSERT_FALSE(resp.has_error()) << resp.ShortDebugString();
+  ASSERT_EQ(resp.statuses_size(), req.states_size());
+  ASSERT_TRUE(resp.has_propagated_hybrid_time());
+
+  ASSERT_OK(StatusFromPB(resp.statuses(0)));
+  ASSERT_NOK(StatusFromPB(resp.statuses(1)));
+  auto expired_status = StatusFromPB(resp.statuses(2));
+  ASSERT_TRUE(expired_status.IsExpired()) << expired_status;
+  ASSERT_EQ(TransactionError(expired_status).value(), TransactionErrorCode::kAborted)
+      << expired_status;
+  ASSERT_OK(StatusFromPB(resp.statuses(3)));
+
+  // Only PENDING heartbeats could be batched.
+  req.mutable_states(3)->set_status(TransactionStatus::COMMITTED);
+  ASSERT_NOK(SendUpdateTransactions(&req));
+
+  ASSERT_OK(transactions[0]->CommitFuture().get());
+  ASSERT_NOK(aborted_txn->CommitFuture().get());
+  ASSERT_OK(transactions[2]->CommitFuture().get());
+  ASSERT_OK(WaitTransactionsCleaned());
+}
+
+// Checks that heartbeats queued behind the in flight UpdateTransactions RPC are failed on
+// shutdown, and that heartbeats sent after shutdown fail immediately.
+TEST_F_EX(QLTransactionTest, BatchedHeartbeatsShutdown, QLTransactionBatchedHeartbeatTest) {
+  constexpr int kHeartbeats = 100;
+
+  auto txn = CreateTransaction();
+  ASSERT_OK(WriteRows(CreateSession(txn)));
+  auto status_tablet = ASSERT_RESULT(LookupStatusTablet(txn));
+  auto transaction_id = txn->id();
+
+  // Keep the first RPC in flight, so the rest of heartbeats are queued. The delay is shorter than
+  // transaction timeout, so txn is not expired because of its own delayed heartbeats.
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_update_transactions_delay_ms) = narrow_cast<int32_t>(
+      ToMilliseconds(std::chrono::microseconds(FLAGS_transaction_heartbeat_usec) * 2));
+
+  rpc::Rpcs rpcs;
+  TransactionHeartbeatBatcher batcher(client_.get(), clock_, &rpcs);
+  CountDownLatch latch(kHeartbeats);
+  std::atomic<int> aborted{0};
+  for (int i = 0; i != kHeartbeats; ++i) {
+    tablet::TransactionStatePB state;
+    state.set_transaction_id(transaction_id.data(), transaction_id.size());
+    state.set_status(TransactionStatus::PENDING);
+    batcher.Send(
+        status_tablet, std::move(state), TransactionRpcDeadline(),
+        [&latch, &aborted](const Status& status) {
+      if (status.IsAborted()) {
+        aborted.fetch_add(1);
+      } else {
+        EXPECT_OK(status);
+      }
+      latch.CountDown();
+    });
+  }
+
+  batcher.Shutdown();
+  // Queued heartbeats are failed by Shutdown itself.
+  ASSERT_EQ(latch.count(), 1U);
+  ASSERT_EQ(aborted.load(), kHeartbeats - 1);
+
+  auto after_shutdown = std::make_shared<std::promise<Status>>();
+  batcher.Send(
+      status_tablet, tablet::TransactionStatePB(), TransactionRpcDeadline(),
+      [after_shutdown](const Status& status) {
+    after_shutdown->set_value(status);
+  });
+  auto after_shutdown_future = after_shutdown->get_future();
+  ASSERT_EQ(after_shutdown_future.wait_for(0s), std::future_status::ready);
+  ASSERT_TRUE(after_shutdown_future.get().IsAborted());
+
+  // In flight heartbeat is completed when RPCs are shut down.
+  rpcs.Shutdown();
+  ASSERT_TRUE(latch.WaitFor(10s * kTimeMultiplier));
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_update_transactions_delay_ms) = 0;
+
+  ASSERT_OK(txn->CommitFuture().get());
+  VerifyData();
+}
+
+class QLTransactionBatchedApplyTest : public QLTransactionTest {
+ protected:
+  void SetUp() override {
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_batch_apply_transaction_requests) = true;
+    QLTransactionTest::SetUp();
+  }
+
+  // More tablets than tablet servers, so some tablet server leads several tablets touched by each
+  // transaction.
+  int NumTablets() override {
+    return 9;
+  }
+
+  uint64_t CountApplyTransactionsRpcs() {
+    uint64_t result = 0;
+    for (size_t i = 0; i != cluster_->num_tablet_servers(); ++i) {
+      result += METRIC_handler_latency_yb_tserver_TabletServerService_ApplyTransactions.Instantiate(
+          cluster_->mini_tablet_server(i)->server()->metric_entity())->TotalCount();
+    }
+    return result;
+  }
+
+  // Commits transactions that write to all tablets, until participants are notified with a batched
+  // ApplyTransactions RPC. Leaders of participants are known to the coordinator only after earlier
+  // transactions were applied through the per tablet path.
+  void WriteUntilBatchedApply(size_t writes_per_transaction) {
+    constexpr int kMaxTransactions = 20;
+    auto rpcs_before = CountApplyTransactionsRpcs();
+    for (int i = 0; i != kMaxTransactions && CountApplyTransactionsRpcs() == rpcs_before; ++i) {
+      auto txn = CreateTransaction();
+      auto session = CreateSession(txn);
+      for (size_t write = 0; write != writes_per_transaction; ++write) {
+        ASSERT_OK(WriteRows(session, write));
+      }
+      ASSERT_OK(txn->CommitFuture().get());
+      ASSERT_OK(WaitTransactionsCleaned());
+    }
+    ASSERT_GT(CountApplyTransactionsRpcs(), rpcs_before);
+  }
+};
+
+TEST_F_EX(QLTransactionTest, BatchedApply, QLTransactionBatchedApplyTest) {
+  constexpr size_t kWritesPerTransaction = 20;
+
+  ASSERT_NO_FATALS(WriteUntilBatchedApply(kWritesPerTransaction));
+  VerifyData(kWritesPerTransaction);
+  AssertNoRunningTransactions();
+}
+
+// Checks that a failed entry of ApplyTransactions is resent to its tablet with UpdateTransaction.
+TEST_F_EX(QLTransactionTest, BatchedApplyFallback, QLTransactionBatchedApplyTest) {
+  constexpr size_t kWritesPerTransaction = 20;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_fail_first_apply_transactions_request) = true;
+  // Periodic resend of apply requests would hide a missing fallback.
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_transaction_resend_applying_interval_usec) =
+      std::chrono::microseconds(1h).count();
+
+  ASSERT_NO_FATALS(WriteUntilBatchedApply(kWritesPerTransaction));
+  VerifyData(kWritesPerTransaction);
+  AssertNoRunningTransactions();
+}
+
 TEST_F(QLTransactionTest, ConflictResolution) {
   constexpr int kTotalTransactions = 5;
   constexpr int kNumRows = 10;
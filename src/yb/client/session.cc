@@ -19,6 +19,7 @@
 #include "yb/client/client_error.h"
 #include "yb/client/error.h"
 #include "yb/client/error_collector.h"
+#include "yb/client/flush_coalescer.h"
 #include "yb/client/yb_op.h"
 
 #include "yb/common/consistent_read_point.h"
@@ -242,7 +243,9 @@ void YBSession::FlushAsync(FlushCallback callback) {
 
   internal::BatcherPtr old_batcher;
   old_batcher.swap(batcher_);
-  if (old_batcher) {
+  if (old_batcher && CanCoalesceFlush(*old_batcher)) {
+    flush_coalescer_->Flush(old_batcher->ops(), old_batcher->deadline(), std::move(callback));
+  } else if (old_batcher) {
     FlushBatcherAsync(
         old_batcher, std::move(callback), batcher_config_,
         internal::IsWithinTransactionRetry::kFalse);
@@ -252,6 +255,20 @@ void YBSession::FlushAsync(FlushCallback callback) {
   }
 }
 
+bool YBSession::CanCoalesceFlush(const internal::Batcher& batcher) const {
+  if (!flush_coalescer_ || batcher_config_.transaction || batcher_config_.force_consistent_read ||
+      batcher_config_.leader_term != OpId::kUnknownTerm) {
+    return false;
+  }
+  // Reads are not coalesced, since they should use the read point of this session.
+  for (const auto& op : batcher.ops()) {
+    if (op->read_only()) {
+      return false;
+    }
+  }
+  return true;
+}
+
 std::future<FlushStatus> YBSession::FlushFuture() {
   auto promise = std::make_shared<std::promise<FlushStatus>>();
   auto future = promise->get_future();
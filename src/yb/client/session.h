@@ -233,6 +233,12 @@ class YBSession : public std::enable_shared_from_this<YBSession> {
 
   void SetLeaderTerm(int64_t leader_term) { batcher_config_.leader_term = leader_term; }
 
+  // Flushes of non-transactional write only batches are sent through the specified coalescer, so
+  // they could share RPCs with flushes of other sessions.
+  void SetFlushCoalescer(FlushCoalescerPtr flush_coalescer) {
+    flush_coalescer_ = std::move(flush_coalescer);
+  }
+
   struct BatcherConfig {
     std::weak_ptr<YBSession> session;
     client::YBClient* client;
@@ -254,8 +260,12 @@ class YBSession : public std::enable_shared_from_this<YBSession> {
 
   internal::Batcher& Batcher();
 
+  bool CanCoalesceFlush(const internal::Batcher& batcher) const;
+
   BatcherConfig batcher_config_;
 
+  FlushCoalescerPtr flush_coalescer_;
+
   // Lock protecting flushed_batchers_.
   mutable simple_spinlock lock_;
 
@@ -66,6 +66,7 @@ using namespace std::literals;
 DECLARE_bool(enable_lease_revocation);
 DECLARE_bool(TEST_disallow_lmp_failures);
 DECLARE_bool(enable_multi_raft_heartbeat_batcher);
+DECLARE_bool(multi_raft_batch_update_consensus);
 DECLARE_bool(fail_on_out_of_range_clock_skew);
 DECLARE_bool(ycql_consistent_transactional_paging);
 DECLARE_int32(TEST_inject_load_transaction_delay_ms);
@@ -374,6 +375,13 @@ TEST_F(SnapshotTxnTest, BankAccounts) {
   TestBankAccounts({}, 30s, RegularBuildVsSanitizers(10, 1) /* minimal_updates_per_second */);
 }
 
+TEST_F(SnapshotTxnTest, BankAccountsWithMultiRaftBatching) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_disallow_lmp_failures) = true;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_enable_multi_raft_heartbeat_batcher) = true;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_multi_raft_batch_update_consensus) = true;
+  TestBankAccounts({}, 30s, RegularBuildVsSanitizers(10, 1) /* minimal_updates_per_second */);
+}
+
 TEST_F(SnapshotTxnTest, BankAccountsPartitioned) {
   TestBankAccounts(
       BankAccountsOptions{BankAccountsOption::kNetworkPartition}, 150s,
@@ -102,6 +102,25 @@ void TabletInvoker::SelectTabletServerWithConsistentPrefix() {
   VLOG(1) << "Using tserver: " << yb::ToString(current_ts_);
 }
 
+RemoteTabletServer* TabletInvoker::SelectHedgeTabletServer() {
+  if (!current_ts_) {
+    return nullptr;
+  }
+  std::vector<RemoteTabletServer*> candidates;
+  auto* result = client_->data_->SelectTServer(
+      tablet_.get(), YBClient::ReplicaSelection::CLOSEST_REPLICA,
+      {current_ts_->permanent_uuid()}, &candidates);
+  if (!result || result == current_ts_) {
+    return nullptr;
+  }
+  auto status = result->InitProxy(client_);
+  if (!status.ok()) {
+    VLOG(1) << "Failed to init proxy to " << result->ToString() << ": " << status;
+    return nullptr;
+  }
+  return result;
+}
+
 void TabletInvoker::SelectLocalTabletServer() {
   TRACE_TO(trace_, "SelectLocalTabletServer()");
 
@@ -288,6 +307,21 @@ Status TabletInvoker::FailToNewReplica(const Status& reason,
       .status = STATUS(IllegalState, "Not the leader"),
       .time = CoarseMonoClock::now()
     });
+    // The replica could tell who the leader is. Mark it as the leader in the cache, so this and
+    // other RPCs for the tablet go to it without trying other replicas or the master.
+    auto leader_hint = tserver::TabletServerLeaderHint::ValueFromStatus(reason);
+    if (leader_hint && tablet_) {
+      vector<RemoteTabletServer*> replicas;
+      tablet_->GetRemoteTabletServers(&replicas);
+      for (auto* ts : replicas) {
+        if (ts->permanent_uuid() == *leader_hint && !followers_.count(ts)) {
+          bool assigned = tablet_->MarkTServerAsLeader(ts);
+          VLOG(1) << "Tablet " << tablet_id_ << ": Leader hint " << ts->ToString()
+                  << (assigned ? " used" : " not found in replicas");
+          break;
+        }
+      }
+    }
   } else {
     VLOG(1) << "Failing " << command_->ToString() << " to a new replica: " << reason
             << ", old replica: " << yb::ToString(current_ts_);
@@ -90,10 +90,15 @@ class TabletInvoker {
   ::yb::HostPort ProxyEndpoint() const;
   YBClient& client() const { return *client_; }
   const RemoteTabletServer& current_ts() { return *current_ts_; }
+  RemoteTabletServer* current_ts_ptr() const { return current_ts_; }
   bool local_tserver_only() const { return local_tserver_only_; }
 
   bool is_consistent_prefix() const { return consistent_prefix_; }
 
+  // Returns the closest replica other than the current one, with initialized proxy, to send a
+  // hedged request to. Returns nullptr if there is no such replica.
+  RemoteTabletServer* SelectHedgeTabletServer();
+
  private:
   friend class TabletRpcTest;
   FRIEND_TEST(TabletRpcTest, TabletInvokerSelectTabletServerRace);
@@ -25,6 +25,7 @@
 #include "yb/client/in_flight_op.h"
 #include "yb/client/meta_cache.h"
 #include "yb/client/transaction_cleanup.h"
+#include "yb/client/transaction_heartbeat_batcher.h"
 #include "yb/client/transaction_manager.h"
 #include "yb/client/transaction_rpc.h"
 #include "yb/client/yb_op.h"
@@ -102,6 +103,10 @@ DEFINE_test_flag(int32, old_txn_status_abort_delay_ms, 0,
 DEFINE_test_flag(uint64, override_transaction_priority, 0,
                  "Override priority of transactions if nonzero.");
 
+DEFINE_RUNTIME_AUTO_bool(batch_transaction_heartbeats, kExternal, false, true,
+    "Combine PENDING heartbeats of transactions with the same status tablet into a single "
+    "UpdateTransactions RPC.");
+
 DEFINE_RUNTIME_bool(disable_heartbeat_send_involved_tablets, false,
                     "If disabled, do not send involved tablets on heartbeats for pending "
                     "transactions. This behavior is needed to support fetching old transactions "
@@ -1156,16 +1161,10 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
 
   typedef std::unordered_map<TabletId, TabletState> TabletStates;
 
-  rpc::RpcCommandPtr PrepareHeartbeatRPC(
-      CoarseTimePoint deadline, const internal::RemoteTabletPtr& status_tablet,
-      TransactionStatus status, UpdateTransactionCallback callback,
-      std::optional<SubtxnSet> aborted_set_for_rollback_heartbeat = std::nullopt,
-      const TabletStates& tablets_with_locks = {}) {
-    tserver::UpdateTransactionRequestPB req;
-    req.set_tablet_id(status_tablet->tablet_id());
-    req.set_propagated_hybrid_time(manager_->Now().ToUint64());
-
-    auto& state = *req.mutable_state();
+  void FillHeartbeatState(
+      TransactionStatus status, const TabletStates& tablets_with_locks,
+      tablet::TransactionStatePB* out) {
+    auto& state = *out;
     state.set_transaction_id(metadata_.transaction_id.data(), metadata_.transaction_id.size());
     state.set_status(status);
 
@@ -1183,6 +1182,19 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
     if (local_ts) {
       state.set_host_node_uuid(local_ts->permanent_uuid());
     }
+  }
+
+  rpc::RpcCommandPtr PrepareHeartbeatRPC(
+      CoarseTimePoint deadline, const internal::RemoteTabletPtr& status_tablet,
+      TransactionStatus status, UpdateTransactionCallback callback,
+      std::optional<SubtxnSet> aborted_set_for_rollback_heartbeat = std::nullopt,
+      const TabletStates& tablets_with_locks = {}) {
+    tserver::UpdateTransactionRequestPB req;
+    req.set_tablet_id(status_tablet->tablet_id());
+    req.set_propagated_hybrid_time(manager_->Now().ToUint64());
+
+    auto& state = *req.mutable_state();
+    FillHeartbeatState(status, tablets_with_locks, &state);
 
     if (aborted_set_for_rollback_heartbeat) {
       VLOG_WITH_PREFIX(4) << "Setting aborted_set_for_rollback_heartbeat: "
@@ -1747,21 +1759,40 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
       timeout = TransactionRpcTimeout();
     }
 
+    const auto batched = status == TransactionStatus::PENDING &&
+                         FLAGS_batch_transaction_heartbeats;
     rpc::RpcCommandPtr rpc;
+    internal::RemoteTabletPtr status_tablet;
+    tablet::TransactionStatePB state;
     {
       SharedLock<std::shared_mutex> lock(mutex_);
-      internal::RemoteTabletPtr status_tablet;
 
       if (!send_to_new_tablet && old_status_tablet_) {
         status_tablet = old_status_tablet_;
       } else {
         status_tablet = status_tablet_;
       }
-      rpc = PrepareHeartbeatRPC(
-          CoarseMonoClock::now() + timeout, status_tablet, status,
-          std::bind(
-              &Impl::HeartbeatDone, this, _1, _2, _3, status, transaction, send_to_new_tablet),
-          std::nullopt, tablets_);
+      if (batched) {
+        FillHeartbeatState(status, tablets_, &state);
+      } else {
+        rpc = PrepareHeartbeatRPC(
+            CoarseMonoClock::now() + timeout, status_tablet, status,
+            std::bind(
+                &Impl::HeartbeatDone, this, _1, _2, _3, status, transaction, send_to_new_tablet),
+            std::nullopt, tablets_);
+      }
+    }
+
+    if (batched) {
+      // HeartbeatDone uses request only for CREATED status, and response only to update clock,
+      // which is done by the batcher.
+      manager_->heartbeat_batcher().Send(
+          status_tablet, std::move(state), CoarseMonoClock::now() + timeout,
+          [this, status, transaction, send_to_new_tablet](const Status& result) {
+        HeartbeatDone(result, /* request= */ {}, /* response= */ {}, status, transaction,
+                      send_to_new_tablet);
+      });
+      return;
     }
 
     auto& handle = send_to_new_tablet ? new_heartbeat_handle_ : heartbeat_handle_;
@@ -0,0 +1,169 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/client/transaction_heartbeat_batcher.h"
+
+#include "yb/client/meta_cache.h"
+#include "yb/client/transaction_rpc.h"
+
+#include "yb/common/wire_protocol.h"
+
+#include "yb/tserver/tserver_service.pb.h"
+
+#include "yb/util/flags.h"
+#include "yb/util/logging.h"
+#include "yb/util/status_format.h"
+
+using namespace std::placeholders;
+
+DEFINE_RUNTIME_uint32(transaction_heartbeat_max_batch_size, 1000,
+    "Max number of transaction heartbeats sent to a status tablet in a single RPC.");
+
+namespace yb::client {
+
+TransactionHeartbeatBatcher::TransactionHeartbeatBatcher(
+    YBClient* client, const scoped_refptr<ClockBase>& clock, rpc::Rpcs* rpcs)
+    : client_(client), clock_(clock), rpcs_(*rpcs) {
+}
+
+TransactionHeartbeatBatcher::~TransactionHeartbeatBatcher() {
+  Shutdown();
+}
+
+void TransactionHeartbeatBatcher::Send(
+    const internal::RemoteTabletPtr& status_tablet, tablet::TransactionStatePB state,
+    CoarseTimePoint deadline, TransactionHeartbeatCallback callback) {
+  TabletQueue* queue = nullptr;
+  HeartbeatsPtr batch;
+  {
+    std::lock_guard lock(mutex_);
+    if (!closing_) {
+      auto [it, inserted] = queues_.try_emplace(status_tablet->tablet_id());
+      queue = &it->second;
+      if (inserted) {
+        queue->tablet = status_tablet;
+        queue->handle = rpcs_.InvalidHandle();
+      }
+      queue->queue.push_back(Heartbeat {
+        .state = std::move(state),
+        .deadline = deadline,
+        .callback = std::move(callback),
+      });
+      if (queue->in_flight) {
+        return;
+      }
+      queue->in_flight = true;
+      batch = NextBatch(queue);
+    }
+  }
+  if (!batch) {
+    callback(STATUS(Aborted, "Transaction manager shutting down"));
+    return;
+  }
+  SendBatch(queue, std::move(batch));
+}
+
+TransactionHeartbeatBatcher::HeartbeatsPtr TransactionHeartbeatBatcher::NextBatch(
+    TabletQueue* queue) {
+  if (queue->queue.empty()) {
+    queue->in_flight = false;
+    return nullptr;
+  }
+  auto max_size = std::max<size_t>(FLAGS_transaction_heartbeat_max_batch_size, 1);
+  auto result = std::make_shared<Heartbeats>();
+  if (queue->queue.size() <= max_size) {
+    result->swap(queue->queue);
+  } else {
+    auto end = queue->queue.begin() + max_size;
+    result->assign(std::make_move_iterator(queue->queue.begin()), std::make_move_iterator(end));
+    queue->queue.erase(queue->queue.begin(), end);
+  }
+  return result;
+}
+
+void TransactionHeartbeatBatcher::SendBatch(TabletQueue* queue, HeartbeatsPtr batch) {
+  tserver::UpdateTransactionsRequestPB req;
+  req.set_tablet_id(queue->tablet->tablet_id());
+  req.set_propagated_hybrid_time(clock_->Now().ToUint64());
+  auto deadline = CoarseTimePoint::max();
+  for (auto& heartbeat : *batch) {
+    deadline = std::min(deadline, heartbeat.deadline);
+    req.mutable_states()->Add()->Swap(&heartbeat.state);
+  }
+  VLOG(4) << "Sending " << batch->size() << " heartbeats to " << req.tablet_id();
+
+  auto rpc = UpdateTransactions(
+      deadline, queue->tablet.get(), client_, &req,
+      std::bind(&TransactionHeartbeatBatcher::BatchDone, this, queue, batch, _1, _2, _3));
+  if (!rpcs_.RegisterAndStart(rpc, &queue->handle)) {
+    tserver::UpdateTransactionsResponsePB resp;
+    BatchDone(queue, batch, STATUS(Aborted, "Transaction manager shutting down"), req, resp);
+  }
+}
+
+void TransactionHeartbeatBatcher::BatchDone(
+    TabletQueue* queue, const HeartbeatsPtr& batch, const Status& status,
+    const tserver::UpdateTransactionsRequestPB& request,
+    const tserver::UpdateTransactionsResponsePB& response) {
+  if (response.has_propagated_hybrid_time()) {
+    clock_->Update(HybridTime(response.propagated_hybrid_time()));
+  }
+  rpcs_.Unregister(&queue->handle);
+
+  std::vector<Status> statuses;
+  statuses.reserve(batch->size());
+  for (size_t i = 0; i != batch->size(); ++i) {
+    if (!status.ok()) {
+      statuses.push_back(status);
+    } else if (narrow_cast<int>(i) < response.statuses_size()) {
+      statuses.push_back(StatusFromPB(response.statuses(narrow_cast<int>(i))));
+    } else {
+      statuses.push_back(STATUS_FORMAT(
+          IllegalState, "Heartbeat response has $0 statuses, while $1 expected",
+          response.statuses_size(), batch->size()));
+    }
+  }
+
+  HeartbeatsPtr next_batch;
+  {
+    std::lock_guard lock(mutex_);
+    next_batch = NextBatch(queue);
+  }
+  if (next_batch) {
+    SendBatch(queue, std::move(next_batch));
+  }
+
+  for (size_t i = 0; i != batch->size(); ++i) {
+    (*batch)[i].callback(statuses[i]);
+  }
+}
+
+void TransactionHeartbeatBatcher::Shutdown() {
+  Heartbeats aborted;
+  {
+    std::lock_guard lock(mutex_);
+    if (closing_) {
+      return;
+    }
+    closing_ = true;
+    for (auto& [_, queue] : queues_) {
+      std::move(queue.queue.begin(), queue.queue.end(), std::back_inserter(aborted));
+      queue.queue.clear();
+    }
+  }
+  for (auto& heartbeat : aborted) {
+    heartbeat.callback(STATUS(Aborted, "Transaction manager shutting down"));
+  }
+}
+
+} // namespace yb::client
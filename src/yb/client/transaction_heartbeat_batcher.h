@@ -0,0 +1,98 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "yb/client/client_fwd.h"
+
+#include "yb/common/clock.h"
+#include "yb/common/entity_ids_types.h"
+
+#include "yb/gutil/thread_annotations.h"
+
+#include "yb/rpc/rpc.h"
+
+#include "yb/tablet/operations.pb.h"
+
+#include "yb/tserver/tserver_fwd.h"
+
+#include "yb/util/monotime.h"
+
+namespace yb::client {
+
+using TransactionHeartbeatCallback = std::function<void(const Status&)>;
+
+// Combines PENDING heartbeats of transactions that use the same status tablet into
+// UpdateTransactions RPCs.
+//
+// At most one RPC per status tablet is in flight. Heartbeats issued while it is running are queued
+// and sent together when it completes, so heartbeats are not delayed when the RPC rate is low.
+class TransactionHeartbeatBatcher {
+ public:
+  TransactionHeartbeatBatcher(
+      YBClient* client, const scoped_refptr<ClockBase>& clock, rpc::Rpcs* rpcs);
+  ~TransactionHeartbeatBatcher();
+
+  // Sends heartbeat with the specified state to status_tablet, callback is invoked with the
+  // result for this transaction.
+  void Send(
+      const internal::RemoteTabletPtr& status_tablet, tablet::TransactionStatePB state,
+      CoarseTimePoint deadline, TransactionHeartbeatCallback callback);
+
+  // Fails queued heartbeats, so they are not sent anymore.
+  void Shutdown();
+
+ private:
+  struct Heartbeat {
+    tablet::TransactionStatePB state;
+    CoarseTimePoint deadline;
+    TransactionHeartbeatCallback callback;
+  };
+
+  using Heartbeats = std::vector<Heartbeat>;
+  using HeartbeatsPtr = std::shared_ptr<Heartbeats>;
+
+  struct TabletQueue {
+    internal::RemoteTabletPtr tablet;
+    bool in_flight = false;
+    Heartbeats queue;
+    rpc::Rpcs::Handle handle;
+  };
+
+  // Extracts the next batch from the queue, resetting in_flight when the queue is empty.
+  HeartbeatsPtr NextBatch(TabletQueue* queue) REQUIRES(mutex_);
+
+  void SendBatch(TabletQueue* queue, HeartbeatsPtr batch);
+
+  void BatchDone(
+      TabletQueue* queue, const HeartbeatsPtr& batch, const Status& status,
+      const tserver::UpdateTransactionsRequestPB& request,
+      const tserver::UpdateTransactionsResponsePB& response);
+
+  YBClient* const client_;
+  const scoped_refptr<ClockBase> clock_;
+  rpc::Rpcs& rpcs_;
+
+  std::mutex mutex_;
+  bool closing_ GUARDED_BY(mutex_) = false;
+  // Queues are never removed, since the number of status tablets is small.
+  std::unordered_map<TabletId, TabletQueue> queues_ GUARDED_BY(mutex_);
+};
+
+} // namespace yb::client
@@ -18,6 +18,7 @@
 #include "yb/client/client.h"
 #include "yb/client/meta_cache.h"
 #include "yb/client/table.h"
+#include "yb/client/transaction_heartbeat_batcher.h"
 #include "yb/client/yb_table_name.h"
 
 #include "yb/master/catalog_manager.h"
@@ -249,7 +250,8 @@ class TransactionManager::Impl {
           .max_workers = FLAGS_transaction_manager_workers_limit,
         }),
         tasks_pool_(FLAGS_transaction_manager_queue_limit),
-        invoke_callback_tasks_(FLAGS_transaction_manager_queue_limit) {
+        invoke_callback_tasks_(FLAGS_transaction_manager_queue_limit),
+        heartbeat_batcher_(client, clock, &rpcs_) {
     CHECK(clock);
   }
 
@@ -316,6 +318,10 @@ class TransactionManager::Impl {
     return rpcs_;
   }
 
+  TransactionHeartbeatBatcher& heartbeat_batcher() {
+    return heartbeat_batcher_;
+  }
+
   HybridTime Now() const {
     return clock_->Now();
   }
@@ -329,6 +335,7 @@ class TransactionManager::Impl {
   }
 
   void Shutdown() {
+    heartbeat_batcher_.Shutdown();
     rpcs_.Shutdown();
     thread_pool_.Shutdown();
   }
@@ -351,6 +358,7 @@ class TransactionManager::Impl {
   yb::rpc::TasksPool<LoadStatusTabletsTask> tasks_pool_;
   yb::rpc::TasksPool<InvokeCallbackTask> invoke_callback_tasks_;
   yb::rpc::Rpcs rpcs_;
+  TransactionHeartbeatBatcher heartbeat_batcher_;
 };
 
 TransactionManager::TransactionManager(
@@ -374,6 +382,10 @@ YBClient* TransactionManager::client() const {
   return impl_->client();
 }
 
+TransactionHeartbeatBatcher& TransactionManager::heartbeat_batcher() {
+  return impl_->heartbeat_batcher();
+}
+
 rpc::Rpcs& TransactionManager::rpcs() {
   return impl_->rpcs();
 }
@@ -53,6 +53,8 @@ class TransactionManager {
   rpc::Rpcs& rpcs();
   YBClient* client() const;
 
+  TransactionHeartbeatBatcher& heartbeat_batcher();
+
   const scoped_refptr<ClockBase>& clock() const;
   HybridTime Now() const;
   HybridTimeRange NowRange() const;
@@ -22,6 +22,8 @@
 #include "yb/client/transaction.h"
 #include "yb/client/transaction_manager.h"
 
+#include "yb/common/transaction.h"
+
 #include "yb/gutil/thread_annotations.h"
 
 #include "yb/rpc/messenger.h"
@@ -41,6 +43,10 @@ DEFINE_UNKNOWN_double(transaction_pool_reserve_factor, 2,
               "During cleanup we will preserve number of transactions in pool that equals to"
                   " average number or take requests during prepration multiplied by this factor");
 
+DEFINE_RUNTIME_uint32(transaction_pool_max_prewarm, 16,
+    "Max number of transactions that are prepared during a single transaction pool cleanup, to "
+    "refill the pool up to its preserved size before take requests arrive. 0 disables it.");
+
 DEFINE_UNKNOWN_bool(force_global_transactions, false,
             "Force all transactions to be global transactions");
 
@@ -126,17 +132,24 @@ class SingleLocalityPool {
       new_txn = std::make_shared<YBTransaction>(&manager_, locality_);
       ++preparing_transactions_;
     }
+    StartPreparation(new_txn, old_taken, deadline);
+    return result;
+  }
+
+ private:
+  // preparing_transactions_ should be already incremented for txn.
+  void StartPreparation(
+      const YBTransactionPtr& txn, uint64_t taken_before_creation, CoarseTimePoint deadline)
+      EXCLUDES(mutex_) {
     IncrementGauge(gauge_preparing_);
     internal::InFlightOpsGroupsWithMetadata ops_info;
-    if (new_txn->batcher_if().Prepare(
+    if (txn->batcher_if().Prepare(
         &ops_info, ForceConsistentRead::kFalse, deadline, Initial::kFalse,
-        std::bind(&SingleLocalityPool::TransactionReady, this, _1, new_txn, old_taken))) {
-      TransactionReady(Status::OK(), new_txn, old_taken);
+        std::bind(&SingleLocalityPool::TransactionReady, this, _1, txn, taken_before_creation))) {
+      TransactionReady(Status::OK(), txn, taken_before_creation);
     }
-    return result;
   }
 
- private:
   void TransactionReady(
       const Status& status, const YBTransactionPtr& txn, uint64_t taken_before_creation) {
     if (status.ok()) {
@@ -166,10 +179,36 @@ class SingleLocalityPool {
   }
 
   void Cleanup(const Status& status) {
-    std::lock_guard lock(mutex_);
+    std::vector<YBTransactionPtr> prewarm_transactions;
+    uint64_t taken_transactions;
+    {
+      std::lock_guard lock(mutex_);
+      if (!DoCleanup()) {
+        return;
+      }
+      prewarm_transactions.reserve(NumTransactionsToPrewarm());
+      while (prewarm_transactions.size() < prewarm_transactions.capacity()) {
+        prewarm_transactions.push_back(std::make_shared<YBTransaction>(&manager_, locality_));
+        ++preparing_transactions_;
+      }
+      taken_transactions = taken_transactions_;
+    }
+    if (prewarm_transactions.empty()) {
+      return;
+    }
+    VLOG(2) << "Prewarm " << prewarm_transactions.size() << " "
+            << TransactionLocality_Name(locality_) << " transactions";
+    const auto deadline = CoarseMonoClock::now() + TransactionRpcTimeout();
+    for (const auto& txn : prewarm_transactions) {
+      StartPreparation(txn, taken_transactions, deadline);
+    }
+  }
+
+  // Returns true if the pool is still in use, i.e. transactions could be prewarmed.
+  bool DoCleanup() REQUIRES(mutex_) {
     scheduled_task_ = rpc::kUninitializedScheduledTaskId;
     if (CheckClosing()) {
-      return;
+      return false;
     }
 
     if (taken_transactions_at_last_cleanup_ == taken_transactions_) {
@@ -177,7 +216,7 @@ class SingleLocalityPool {
       while (!transactions_.empty()) {
         Pop()->Abort();
       }
-      return;
+      return false;
     }
     taken_transactions_at_last_cleanup_ = taken_transactions_;
 
@@ -213,6 +252,25 @@ class SingleLocalityPool {
     if (!transactions_.empty()) {
       ScheduleCleanup();
     }
+    return true;
+  }
+
+  // Pool is refilled only by take requests, so a burst of takes after a quiet period would miss
+  // the pool. Returns number of transactions that should be prepared to keep the pool at the size
+  // that cleanup preserves, i.e. the average number of take requests during preparation multiplied
+  // by the reserve factor.
+  size_t NumTransactionsToPrewarm() REQUIRES(mutex_) {
+    const auto size = transactions_.size();
+    if (size == 0) {
+      return 0;
+    }
+    const auto target = static_cast<size_t>(
+        taken_during_preparation_sum_ * FLAGS_transaction_pool_reserve_factor / size);
+    const auto current = size + preparing_transactions_;
+    if (target <= current) {
+      return 0;
+    }
+    return std::min<size_t>(target - current, FLAGS_transaction_pool_max_prewarm);
   }
 
   YBTransactionPtr Pop() REQUIRES(mutex_) {
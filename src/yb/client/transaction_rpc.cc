@@ -18,9 +18,11 @@
 #include <boost/preprocessor/cat.hpp>
 
 #include "yb/client/client.h"
+#include "yb/client/meta_cache.h"
 #include "yb/client/tablet_rpc.h"
 
 #include "yb/common/transaction.h"
+#include "yb/common/wire_protocol.h"
 
 #include "yb/rpc/rpc.h"
 #include "yb/rpc/rpc_controller.h"
@@ -183,8 +185,69 @@ constexpr const char* TRANSACTION_RPC_TRAITS_NAME(entry)::kName;
 
 BOOST_PP_SEQ_FOR_EACH(TRANSACTION_RPC_TRAITS, ~, TRANSACTION_RPCS)
 
+class ApplyTransactionsRpc : public rpc::Rpc {
+ public:
+  ApplyTransactionsRpc(CoarseTimePoint deadline,
+                       internal::RemoteTabletServer* tserver,
+                       YBClient* client,
+                       tserver::ApplyTransactionsRequestPB* req,
+                       ApplyTransactionsCallback callback)
+      : rpc::Rpc(deadline, client->messenger(), &client->proxy_cache()),
+        tserver_(tserver),
+        client_(client),
+        callback_(std::move(callback)) {
+    req_.Swap(req);
+    TRACE_TO(trace_, "ApplyTransactions");
+  }
+
+  void SendRpc() override {
+    auto status = tserver_->InitProxy(client_);
+    if (!status.ok()) {
+      Finished(status);
+      return;
+    }
+    tserver_->proxy()->ApplyTransactionsAsync(
+        req_, &resp_, PrepareController(),
+        std::bind(&ApplyTransactionsRpc::Finished, this, Status::OK()));
+  }
+
+  std::string ToString() const override {
+    return Format("ApplyTransactions: $0 requests to $1, retrier: $2",
+                  req_.requests_size(), tserver_->permanent_uuid(), retrier());
+  }
+
+  void Finished(const Status& status) override {
+    Status new_status = status;
+    if (new_status.ok() && mutable_retrier()->HandleResponse(this, &new_status)) {
+      return;
+    }
+    if (new_status.ok() && resp_.has_error()) {
+      new_status = StatusFromPB(resp_.error().status());
+    }
+    auto retain_self = shared_from_this();
+    callback_(new_status, resp_);
+  }
+
+ private:
+  internal::RemoteTabletServer* const tserver_;
+  YBClient* const client_;
+  tserver::ApplyTransactionsRequestPB req_;
+  tserver::ApplyTransactionsResponsePB resp_;
+  ApplyTransactionsCallback callback_;
+};
+
 } // namespace
 
+rpc::RpcCommandPtr ApplyTransactions(
+    CoarseTimePoint deadline,
+    internal::RemoteTabletServer* tserver,
+    YBClient* client,
+    tserver::ApplyTransactionsRequestPB* req,
+    ApplyTransactionsCallback callback) {
+  return std::make_shared<ApplyTransactionsRpc>(
+      deadline, tserver, client, req, std::move(callback));
+}
+
 #define TRANSACTION_RPC_BODY(entry) { \
   return std::make_shared<TransactionRpc<TRANSACTION_RPC_TRAITS_NAME(entry)>>( \
       deadline, tablet, client, req, std::move(callback)); \
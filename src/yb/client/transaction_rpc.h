@@ -34,6 +34,7 @@ class HybridTime;
 
 #define TRANSACTION_RPCS \
     ((UpdateTransaction, WITH_REQUEST)) \
+    ((UpdateTransactions, WITH_REQUEST)) \
     ((GetTransactionStatus, WITHOUT_REQUEST)) \
     ((GetTransactionStatusAtParticipant, WITHOUT_REQUEST)) \
     ((AbortTransaction, WITHOUT_REQUEST)) \
@@ -79,6 +80,18 @@ namespace client {
 
 BOOST_PP_SEQ_FOR_EACH(TRANSACTION_RPC_FUNCTION, TRANSACTION_RPC_SEMICOLON, TRANSACTION_RPCS)
 
+using ApplyTransactionsCallback = std::function<void(
+    const Status&, const tserver::ApplyTransactionsResponsePB&)>;
+
+// Sends ApplyTransactions to the specified tablet server. Unlike the functions above, request is
+// not routed by tablet, so the caller is responsible for retrying requests that were not applied.
+MUST_USE_RESULT rpc::RpcCommandPtr ApplyTransactions(
+    CoarseTimePoint deadline,
+    internal::RemoteTabletServer* tserver,
+    YBClient* client,
+    tserver::ApplyTransactionsRequestPB* req,
+    ApplyTransactionsCallback callback);
+
 template <class Response, class T>
 void UpdateClock(const Response& resp, T* t) {
   if (resp.has_propagated_hybrid_time()) {
@@ -239,6 +239,14 @@ Result<size_t> DocHybridTime::GetEncodedSize(const Slice& encoded_key) {
   return result;
 }
 
+size_t DocHybridTime::EncodedSizeFromEndOrZero(Slice encoded_key) {
+  if (encoded_key.empty()) {
+    return 0;
+  }
+  size_t result = static_cast<uint8_t>(encoded_key.end()[-1]) & kHybridTimeSizeMask;
+  return result <= kMaxBytesPerEncodedHybridTime && result < encoded_key.size() ? result : 0;
+}
+
 Status DocHybridTime::EncodedFromEnd(const Slice& slice, EncodedDocHybridTime* out) {
   auto size = VERIFY_RESULT(GetEncodedSize(slice));
   out->Assign(slice.Suffix(size));
@@ -154,6 +154,11 @@ class DocHybridTime {
   // Status and value separately, instead of wrapping it with Result.
   static Status EncodedFromEnd(const Slice& slice, EncodedDocHybridTime* out);
 
+  // Returns size of encoded DocHybridTime stored at the end of the key according to the last byte,
+  // or 0 if it is not a valid size. Unlike GetEncodedSize does not create status, so could be used
+  // for keys that might not contain DocHybridTime.
+  static size_t EncodedSizeFromEndOrZero(Slice encoded_key);
+
   static Result<const char*> EncodedFromStart(const char* begin, const char* end);
 
   static Result<Slice> EncodedFromStart(Slice* slice);
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 #include <rapidjson/prettywriter.h>
 
+#include "yb/common/common.pb.h"
 #include "yb/common/jsonb.h"
 
 #include "yb/gutil/dynamic_annotations.h"
@@ -24,6 +25,7 @@
 #include "yb/util/status.h"
 #include "yb/util/test_macros.h"
 #include "yb/util/tostring.h"
+#include "yb/util/varint.h"
 
 namespace yb {
 namespace common {
@@ -155,5 +157,60 @@ TEST(JsonbTest, TestArrays) {
   VerifyArray(document);
 }
 
+using JsonPath = google::protobuf::RepeatedPtrField<QLJsonOperationPB>;
+
+void AddMemberToPath(const std::string& member, JsonPath* path) {
+  auto* op = path->Add();
+  op->set_json_operator(JsonOperatorPB::JSON_OBJECT);
+  op->mutable_operand()->mutable_value()->set_string_value(member);
+}
+
+void AddIndexToPath(int64_t index, JsonPath* path) {
+  auto* op = path->Add();
+  op->set_json_operator(JsonOperatorPB::JSON_OBJECT);
+  op->mutable_operand()->mutable_value()->set_varint_value(VarInt(index).EncodeToComparable());
+}
+
+void ReplaceValue(const JsonPath& path, const std::string& value, Jsonb* jsonb) {
+  Jsonb value_jsonb;
+  ASSERT_OK(value_jsonb.FromString(value));
+  ASSERT_TRUE(ASSERT_RESULT(jsonb->ReplaceValue(path, value_jsonb.SerializedJsonb())));
+}
+
+TEST(JsonbTest, TestReplaceValue) {
+  Jsonb jsonb;
+  ASSERT_OK(jsonb.FromString(R"#({"a": {"b": 1, "c": [1, "x", true]}, "d": "text"})#"));
+
+  JsonPath a_b;
+  AddMemberToPath("a", &a_b);
+  AddMemberToPath("b", &a_b);
+  ASSERT_NO_FATALS(ReplaceValue(a_b, R"#("longer value")#", &jsonb));
+
+  JsonPath a_c_1;
+  AddMemberToPath("a", &a_c_1);
+  AddMemberToPath("c", &a_c_1);
+  AddIndexToPath(1, &a_c_1);
+  ASSERT_NO_FATALS(ReplaceValue(a_c_1, R"#({"e": null})#", &jsonb));
+
+  JsonPath d;
+  AddMemberToPath("d", &d);
+  ASSERT_NO_FATALS(ReplaceValue(d, "2", &jsonb));
+
+  Jsonb expected;
+  ASSERT_OK(expected.FromString(
+      R"#({"a": {"b": "longer value", "c": [1, {"e": null}, true]}, "d": 2})#"));
+  ASSERT_EQ(jsonb, expected);
+
+  // Missing paths and paths through scalars are not replaced.
+  JsonPath missing;
+  AddMemberToPath("x", &missing);
+  JsonPath through_scalar = d;
+  AddMemberToPath("y", &through_scalar);
+  for (const auto* path : {&missing, &through_scalar}) {
+    ASSERT_FALSE(ASSERT_RESULT(jsonb.ReplaceValue(*path, Jsonb::kSerializedJsonbNull)));
+    ASSERT_EQ(jsonb, expected);
+  }
+}
+
 }  // namespace common
 }  // namespace yb
@@ -673,7 +673,8 @@ Status Jsonb::ToJsonStringInternal(const Slice& jsonb, std::string* json) {
 
 Status Jsonb::ApplyJsonbOperatorToArray(const Slice& jsonb, const QLJsonOperationPB& json_op,
                                         const JsonbHeader& jsonb_header,
-                                        Slice* result, JEntry* element_metadata) {
+                                        Slice* result, JEntry* element_metadata,
+                                        size_t* element_jentry_offset) {
   if(!json_op.operand().value().has_varint_value()) {
     return STATUS_SUBSTITUTE(NotFound, "Couldn't apply json operator");
   }
@@ -694,12 +695,16 @@ Status Jsonb::ApplyJsonbOperatorToArray(const Slice& jsonb, const QLJsonOperatio
   RETURN_NOT_OK(GetArrayElement(array_index, jsonb, sizeof(jsonb_header),
                                 ComputeDataOffset(num_array_entries, kJBArray), result,
                                 element_metadata));
+  if (element_jentry_offset) {
+    *element_jentry_offset = sizeof(jsonb_header) + array_index * sizeof(JEntry);
+  }
   return Status::OK();
 }
 
 Status Jsonb::ApplyJsonbOperatorToObject(const Slice& jsonb, const QLJsonOperationPB& json_op,
                                          const JsonbHeader& jsonb_header,
-                                         Slice* result, JEntry* element_metadata) {
+                                         Slice* result, JEntry* element_metadata,
+                                         size_t* element_jentry_offset) {
   if (!json_op.operand().value().has_string_value()) {
     return STATUS_SUBSTITUTE(NotFound, "Couldn't apply json operator");
   }
@@ -722,6 +727,9 @@ Status Jsonb::ApplyJsonbOperatorToObject(const Slice& jsonb, const QLJsonOperati
       RETURN_NOT_OK(GetObjectValue(mid, jsonb, sizeof(jsonb_header),
                                    ComputeDataOffset(num_kv_pairs, kJBObject), num_kv_pairs,
                                    result, element_metadata));
+      if (element_jentry_offset) {
+        *element_jentry_offset = sizeof(jsonb_header) + (num_kv_pairs + mid) * sizeof(JEntry);
+      }
       return Status::OK();
     } else if (mid_key.ToBuffer() > search_key) {
       high = mid - 1;
@@ -785,8 +793,89 @@ Status Jsonb::ApplyJsonbOperators(const std::string &serialized_json,
   return Status::OK();
 }
 
+Result<bool> Jsonb::ReplaceValue(
+    const google::protobuf::RepeatedPtrField<QLJsonOperationPB>& path, Slice value_jsonb) {
+  if (path.empty()) {
+    return false;
+  }
+
+  // The end offsets of the replaced element and of all elements following it in the containers
+  // along the path are shifted by the change of the element size. Keep the range of their
+  // JEntries for every container.
+  std::vector<std::pair<size_t, size_t>> shifted_jentries;
+  shifted_jentries.reserve(path.size());
+  const Slice document(serialized_jsonb_);
+  Slice operand = document;
+  Slice element;
+  JEntry element_metadata = kJEIsObject;
+  size_t element_jentry_offset = 0;
+  for (const auto& op : path) {
+    if (IsScalar(element_metadata) || operand.size() < sizeof(JsonbHeader)) {
+      return false;
+    }
+    auto status = ApplyJsonbOperator(
+        operand, op, &element, &element_metadata, &element_jentry_offset);
+    if (status.IsNotFound()) {
+      return false;
+    }
+    RETURN_NOT_OK(status);
+    const auto container_offset = static_cast<size_t>(operand.data() - document.data());
+    JsonbHeader container_header = BigEndian::Load32(operand.data());
+    shifted_jentries.emplace_back(
+        container_offset + element_jentry_offset,
+        container_offset + ComputeDataOffset(GetCount(container_header), container_header));
+    operand = element;
+  }
+
+  // Scalars are serialized as an array with one element, whose data is stored in the container.
+  if (value_jsonb.size() < sizeof(JsonbHeader)) {
+    return STATUS(InvalidArgument, "Not enough data to process");
+  }
+  Slice value_data = value_jsonb;
+  JEntry value_type;
+  JsonbHeader value_header = BigEndian::Load32(value_jsonb.data());
+  if ((value_header & kJBScalar) && (value_header & kJBArray)) {
+    JEntry scalar_metadata;
+    RETURN_NOT_OK(GetArrayElement(0, value_jsonb, sizeof(JsonbHeader),
+                                  ComputeDataOffset(1, kJBArray), &value_data, &scalar_metadata));
+    value_type = GetJEType(scalar_metadata);
+  } else if (value_header & kJBArray) {
+    value_type = kJEIsArray;
+  } else if (value_header & kJBObject) {
+    value_type = kJEIsObject;
+  } else {
+    return STATUS(InvalidArgument, "Invalid json value");
+  }
+
+  const int64_t delta = static_cast<int64_t>(value_data.size()) - element.size();
+  for (const auto& [begin, end] : shifted_jentries) {
+    // End offsets grow within a container, so it is enough to check the last one.
+    auto last_jentry = BigEndian::Load32(document.data() + end - sizeof(JEntry));
+    if (GetOffset(last_jentry) + delta > kJEOffsetMask) {
+      // Offsets do not fit into JEntry, leave it to the regular serialization to report.
+      return false;
+    }
+  }
+  for (const auto& [begin, end] : shifted_jentries) {
+    for (auto offset = begin; offset != end; offset += sizeof(JEntry)) {
+      JEntry jentry = BigEndian::Load32(document.data() + offset);
+      BigEndian::Store32(
+          &serialized_jsonb_[offset],
+          GetJEType(jentry) | GetOffset(narrow_cast<JEntry>(GetOffset(jentry) + delta)));
+    }
+  }
+  const auto element_jentry = shifted_jentries.back().first;
+  BigEndian::Store32(
+      &serialized_jsonb_[element_jentry],
+      value_type | GetOffset(BigEndian::Load32(document.data() + element_jentry)));
+  serialized_jsonb_.replace(
+      element.data() - document.data(), element.size(), value_data.cdata(), value_data.size());
+  return true;
+}
+
 Status Jsonb::ApplyJsonbOperator(const Slice& jsonb, const QLJsonOperationPB& json_op,
-                                 Slice* result, JEntry* element_metadata) {
+                                 Slice* result, JEntry* element_metadata,
+                                 size_t* element_jentry_offset) {
   // Currently, both these operators are considered the same since we only handle strings.
   DCHECK(json_op.json_operator() == JsonOperatorPB::JSON_OBJECT ||
          json_op.json_operator() == JsonOperatorPB::JSON_TEXT);
@@ -803,9 +892,11 @@ Status Jsonb::ApplyJsonbOperator(const Slice& jsonb, const QLJsonOperationPB& js
     // This is a scalar value and no operators can be applied to it.
     return STATUS(NotFound, "Cannot apply operators to scalar values");
   } else if (jsonb_header & kJBArray) {
-    return ApplyJsonbOperatorToArray(jsonb, json_op, jsonb_header, result, element_metadata);
+    return ApplyJsonbOperatorToArray(
+        jsonb, json_op, jsonb_header, result, element_metadata, element_jentry_offset);
   } else if (jsonb_header & kJBObject) {
-    return ApplyJsonbOperatorToObject(jsonb, json_op, jsonb_header, result, element_metadata);
+    return ApplyJsonbOperatorToObject(
+        jsonb, json_op, jsonb_header, result, element_metadata, element_jentry_offset);
   }
 
   return STATUS(InvalidArgument, "Invalid json operation");
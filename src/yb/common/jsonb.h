@@ -15,6 +15,8 @@
 
 #include <string>
 
+#include <google/protobuf/repeated_field.h>
+
 #include <rapidjson/document.h>
 
 #include "yb/common/common_fwd.h"
@@ -89,6 +91,12 @@ class Jsonb {
                                             const QLJsonColumnOperationsPB& json_ops,
                                             QLValuePB* result);
 
+  // Replaces the value at the given path, e.g. j->'a'->'b', with the value of serialized jsonb in
+  // place, without converting the whole document to rapidjson and back. Returns false and keeps
+  // the document unchanged, when the path is not present in the document.
+  Result<bool> ReplaceValue(
+      const google::protobuf::RepeatedPtrField<QLJsonOperationPB>& path, Slice value_jsonb);
+
   const std::string& SerializedJsonb() const;
 
   // Use with extreme care since this destroys the internal state of the object. The only purpose
@@ -104,9 +112,11 @@ class Jsonb {
   std::string serialized_jsonb_;
 
   // Given a jsonb slice, it applies the given operator to the slice and returns the result as a
-  // Slice and the element's metadata.
+  // Slice and the element's metadata. When element_jentry_offset is specified, it is set to the
+  // offset of the element's JEntry in the jsonb slice.
   static Status ApplyJsonbOperator(const Slice& jsonb, const QLJsonOperationPB& json_op,
-                                           Slice* result, JEntry* element_metadata);
+                                           Slice* result, JEntry* element_metadata,
+                                           size_t* element_jentry_offset = nullptr);
 
   static bool IsScalar(const JEntry& jentry);
 
@@ -186,13 +196,15 @@ class Jsonb {
                                                   const QLJsonOperationPB& json_op,
                                                   const JsonbHeader& jsonb_header,
                                                   Slice* result,
-                                                  JEntry* element_metadata);
+                                                  JEntry* element_metadata,
+                                                  size_t* element_jentry_offset);
 
   static Status ApplyJsonbOperatorToObject(const Slice& jsonb,
                                                    const QLJsonOperationPB& json_op,
                                                    const JsonbHeader& jsonb_header,
                                                    Slice* result,
-                                                   JEntry* element_metadata);
+                                                   JEntry* element_metadata,
+                                                   size_t* element_jentry_offset);
 
   static inline uint32_t GetOffset(JEntry metadata) { return metadata & kJEOffsetMask; }
 
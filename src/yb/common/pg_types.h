@@ -25,6 +25,7 @@ class Slice;
 using PgOid = uint32_t;
 static constexpr PgOid kPgInvalidOid = 0;
 static constexpr PgOid kPgByteArrayOid = 17;
+static constexpr PgOid kPgTextOid = 25;
 
 // A struct to identify a Postgres object by oid and the database oid it belongs to.
 struct PgObjectId {
@@ -320,5 +320,33 @@ TEST(TestSchema, TestTableProperties) {
   ASSERT_FALSE(properties3.HasDefaultTimeToLive());
 }
 
+TEST(TestSchema, TestHistoryRetentionInterval) {
+  TableProperties properties;
+  ASSERT_FALSE(properties.HasHistoryRetentionInterval());
+
+  TablePropertiesPB pb;
+  properties.ToTablePropertiesPB(&pb);
+  ASSERT_EQ(0, pb.history_retention_interval_sec());
+
+  properties.SetHistoryRetentionIntervalSec(60);
+  ASSERT_TRUE(properties.HasHistoryRetentionInterval());
+  ASSERT_NE(properties, TableProperties());
+
+  properties.ToTablePropertiesPB(&pb);
+  ASSERT_EQ(60, pb.history_retention_interval_sec());
+  auto properties1 = TableProperties::FromTablePropertiesPB(pb);
+  ASSERT_EQ(60, properties1.history_retention_interval_sec());
+
+  TableProperties properties2;
+  properties2.AlterFromTablePropertiesPB(pb);
+  ASSERT_EQ(properties1, properties2);
+
+  // Altering back to zero restores the global retention interval.
+  properties.SetHistoryRetentionIntervalSec(0);
+  properties.ToTablePropertiesPB(&pb);
+  properties2.AlterFromTablePropertiesPB(pb);
+  ASSERT_FALSE(properties2.HasHistoryRetentionInterval());
+}
+
 } // namespace tablet
 } // namespace yb
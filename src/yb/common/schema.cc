@@ -191,6 +191,7 @@ void TableProperties::ToTablePropertiesPB(TablePropertiesPB *pb) const {
   pb->set_is_ysql_catalog_table(is_ysql_catalog_table_);
   pb->set_retain_delete_markers(retain_delete_markers_);
   pb->set_partitioning_version(partitioning_version_);
+  pb->set_history_retention_interval_sec(history_retention_interval_sec_);
 }
 
 TableProperties TableProperties::FromTablePropertiesPB(const TablePropertiesPB& pb) {
@@ -221,6 +222,9 @@ TableProperties TableProperties::FromTablePropertiesPB(const TablePropertiesPB&
   }
   table_properties.set_partitioning_version(
       pb.has_partitioning_version() ? pb.partitioning_version() : 0);
+  if (pb.has_history_retention_interval_sec()) {
+    table_properties.SetHistoryRetentionIntervalSec(pb.history_retention_interval_sec());
+  }
   return table_properties;
 }
 
@@ -247,6 +251,9 @@ void TableProperties::AlterFromTablePropertiesPB(const TablePropertiesPB& pb) {
     SetRetainDeleteMarkers(pb.retain_delete_markers());
   }
   set_partitioning_version(pb.has_partitioning_version() ? pb.partitioning_version() : 0);
+  if (pb.has_history_retention_interval_sec()) {
+    SetHistoryRetentionIntervalSec(pb.history_retention_interval_sec());
+  }
 }
 
 void TableProperties::Reset() {
@@ -261,6 +268,7 @@ void TableProperties::Reset() {
   partitioning_version_ =
       PREDICT_TRUE(FLAGS_TEST_partitioning_version < 0) ? kCurrentPartitioningVersion
                                                         : FLAGS_TEST_partitioning_version;
+  history_retention_interval_sec_ = 0;
 }
 
 string TableProperties::ToString() const {
@@ -270,6 +278,9 @@ string TableProperties::ToString() const {
   }
   result += Format("contain_counters: $0 is_transactional: $1 ",
                    contain_counters_, is_transactional_);
+  if (HasHistoryRetentionInterval()) {
+    result += Format("history_retention_interval_sec: $0 ", history_retention_interval_sec_);
+  }
   return result + Format(
       "consistency_level: $0 is_ysql_catalog_table: $1 partitioning_version: $2 }",
       consistency_level_,
@@ -353,7 +353,8 @@ class TableProperties {
 
     return default_time_to_live_ == other.default_time_to_live_ &&
            use_mangled_column_name_ == other.use_mangled_column_name_ &&
-           contain_counters_ == other.contain_counters_;
+           contain_counters_ == other.contain_counters_ &&
+           history_retention_interval_sec_ == other.history_retention_interval_sec_;
 
     // Ignoring num_tablets_.
     // Ignoring retain_delete_markers_.
@@ -383,6 +384,7 @@ class TableProperties {
     // Ignoring contain_counters_.
     // Ignoring retain_delete_markers_.
     // Ignoring partitioning_version_.
+    // Ignoring history_retention_interval_sec_.
     return true;
   }
 
@@ -466,6 +468,20 @@ class TableProperties {
     partitioning_version_ = value;
   }
 
+  // Returns true if the table has its own history retention interval, instead of the one specified
+  // by timestamp_history_retention_interval_sec.
+  bool HasHistoryRetentionInterval() const {
+    return history_retention_interval_sec_ > 0;
+  }
+
+  int32_t history_retention_interval_sec() const {
+    return history_retention_interval_sec_;
+  }
+
+  void SetHistoryRetentionIntervalSec(int32_t value) {
+    history_retention_interval_sec_ = value;
+  }
+
   void ToTablePropertiesPB(TablePropertiesPB *pb) const;
 
   static TableProperties FromTablePropertiesPB(const TablePropertiesPB& pb);
@@ -490,6 +506,7 @@ class TableProperties {
   int num_tablets_;
   bool is_ysql_catalog_table_;
   uint32_t partitioning_version_;
+  int32_t history_retention_interval_sec_;
 };
 
 typedef std::string PgSchemaName;
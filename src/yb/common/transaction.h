@@ -38,6 +38,7 @@
 #include "yb/util/enums.h"
 #include "yb/util/math_util.h"
 #include "yb/util/metrics.h"
+#include "yb/util/slice.h"
 #include "yb/util/status_fwd.h"
 #include "yb/util/strongly_typed_uuid.h"
 #include "yb/util/uint_set.h"
@@ -239,6 +240,27 @@ class TransactionStatusManager {
   // Returns minimal running hybrid time of all running transactions.
   virtual HybridTime MinRunningHybridTime() const = 0;
 
+  // Returns false if intents DB does not contain intents of running transactions in the
+  // [lower, upper) key range. Empty upper means that the range is not bounded from above.
+  virtual bool MayHaveIntentsInRange(Slice lower, Slice upper) const {
+    return true;
+  }
+
+  // Returns false if intents DB does not contain intents of running transactions on doc_path,
+  // that conflict with intent of specified strength.
+  virtual bool MayHaveConflictingIntents(Slice doc_path, bool strong) const {
+    return true;
+  }
+
+  // Returns final outcome of the transaction, received from its coordinator by one of the
+  // previous reads of the tablet. commit_ht of the aborted transaction is HybridTime::kMin.
+  virtual boost::optional<TransactionLocalState> CachedTxnOutcome(const TransactionId& id) {
+    return boost::none;
+  }
+
+  // Should be invoked with final outcome of the transaction, received from its coordinator.
+  virtual void CacheTxnOutcome(const TransactionId& id, const TransactionLocalState& outcome) {}
+
   virtual Result<HybridTime> WaitForSafeTime(HybridTime safe_time, CoarseTimePoint deadline) = 0;
 
   virtual const TabletId& tablet_id() const = 0;
@@ -48,10 +48,13 @@
 #include "yb/consensus/consensus_queue.h"
 #include "yb/consensus/replicate_msgs_holder.h"
 #include "yb/consensus/multi_raft_batcher.h"
+
+#include "yb/gutil/casts.h"
 #include "yb/gutil/strings/substitute.h"
 
 #include "yb/rpc/periodic.h"
 #include "yb/rpc/rpc_controller.h"
+#include "yb/rpc/sidecars.h"
 
 #include "yb/tablet/tablet_error.h"
 #include "yb/tserver/tserver_error.h"
@@ -91,6 +94,12 @@ TAG_FLAG(collect_update_consensus_traces, advanced);
 DECLARE_int32(raft_heartbeat_interval_ms);
 
 DECLARE_bool(enable_multi_raft_heartbeat_batcher);
+DECLARE_bool(multi_raft_batch_update_consensus);
+DECLARE_uint64(multi_raft_max_batched_request_bytes);
+
+DEFINE_RUNTIME_AUTO_bool(consensus_send_ops_in_sidecars, kExternal, false, true,
+    "If true, the leader sends operations to followers in RPC sidecars, serializing each "
+    "operation once for all followers.");
 
 DEFINE_test_flag(double, fault_crash_on_leader_request_fraction, 0.0,
                  "Fraction of the time when the leader will crash just before sending an "
@@ -397,6 +406,26 @@ void Peer::SendNextRequest(RequestTriggerMode trigger_mode) {
     return;
   }
 
+  // Small update requests are batched with requests of other tablets sent to the same server.
+  // The batcher sends them right away when there is no batch in flight, so they are not delayed
+  // at low load.
+  if (!req_is_heartbeat && multi_raft_batcher_ && FLAGS_enable_multi_raft_heartbeat_batcher &&
+      FLAGS_multi_raft_batch_update_consensus &&
+      update_request_->SerializedSize() <= FLAGS_multi_raft_max_batched_request_bytes) {
+    // Outstanding heartbeats are not viable anymore, see minimum_viable_heartbeat_ below.
+    minimum_viable_heartbeat_ = cur_heartbeat_id_ + 1;
+    // Multi-Raft batches use regular protobuf messages, so the request is copied.
+    update_request_->ToGoogleProtobuf(&batched_request_);
+    batched_response_.Clear();
+    processing_lock.unlock();
+    performing_update_lock.release();
+    last_rpc_start_time_.store(CoarseMonoClock::now(), std::memory_order_release);
+    multi_raft_batcher_->AddRequestToBatch(
+        &batched_request_, &batched_response_,
+        std::bind(&Peer::ProcessBatchedResponse, retain_self, _1), MultiRaftRequestKind::kUpdate);
+    return;
+  }
+
   TracePtr trace(Trace::CurrentTrace());
   if (trace && GetAtomicFlag(&FLAGS_collect_update_consensus_traces)) {
     update_request_->set_trace_requested(true);
@@ -412,6 +441,10 @@ void Peer::SendNextRequest(RequestTriggerMode trigger_mode) {
   processing_lock.unlock();
   performing_update_lock.release();
   controller_.set_invoke_callback_mode(rpc::InvokeCallbackMode::kThreadPoolHigh);
+  if (!update_request_->ops().empty() && FLAGS_consensus_send_ops_in_sidecars &&
+      proxy_->SupportsSidecars()) {
+    MoveOpsToSidecars();
+  }
   last_rpc_start_time_.store(CoarseMonoClock::now(), std::memory_order_release);
   proxy_->UpdateAsync(update_request_, trigger_mode, update_response_, &controller_,
                       std::bind(&Peer::ProcessResponse, retain_self, trace));
@@ -559,6 +592,38 @@ void Peer::ProcessHeartbeatResponse(const Status& status) {
   }
 }
 
+void Peer::MoveOpsToSidecars() {
+  auto& sidecars = controller_.outbound_sidecars();
+  const auto start = sidecars.offsets().size();
+  for (const auto& op : update_request_->ops()) {
+    sidecars.Start().AddBlock(queue_->SerializedOp(op), 0);
+    sidecars.Complete();
+  }
+  update_request_->set_ops_sidecars_start(narrow_cast<uint32_t>(start));
+  update_request_->set_num_sidecar_ops(narrow_cast<uint32_t>(update_request_->ops().size()));
+  update_request_->mutable_ops()->clear();
+}
+
+void Peer::ProcessBatchedResponse(const Status& status) {
+  DCHECK(performing_update_mutex_.is_locked()) << "Got a response when nothing was pending.";
+  last_rpc_start_time_.store(CoarseTimePoint::min(), std::memory_order_release);
+
+  auto performing_update_lock = LockPerformingUpdate(std::adopt_lock);
+  auto processing_lock = StartProcessingUnlocked();
+  if (!processing_lock.owns_lock()) {
+    return;
+  }
+
+  auto lw_response = rpc::CopySharedMessage(batched_response_);
+  bool more_pending = ProcessResponseWithStatus(status, lw_response.get());
+
+  if (more_pending) {
+    processing_lock.unlock();
+    performing_update_lock.release();
+    SendNextRequest(RequestTriggerMode::kAlwaysSend);
+  }
+}
+
 Status Peer::SendRemoteBootstrapRequest() {
   YB_LOG_WITH_PREFIX_EVERY_N_SECS(INFO, 30) << "Sending request to remotely bootstrap";
   controller_.set_invoke_callback_mode(rpc::InvokeCallbackMode::kThreadPoolNormal);
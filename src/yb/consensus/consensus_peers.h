@@ -192,6 +192,13 @@ class Peer : public std::enable_shared_from_this<Peer> {
   // Signals that a heartbeat response was received from the peer.
   void ProcessHeartbeatResponse(const Status& status);
 
+  // Signals that a response to the update request sent via multi-Raft batcher was received.
+  void ProcessBatchedResponse(const Status& status);
+
+  // Moves ops of update_request_ to sidecars of controller_, reusing serialized ops from the
+  // log cache.
+  void MoveOpsToSidecars();
+
   // Returns true if there are more pending ops to process, false otherwise.
   bool ProcessResponseWithStatus(const Status& status,
                                  LWConsensusResponsePB* response);
@@ -245,6 +252,10 @@ class Peer : public std::enable_shared_from_this<Peer> {
   ConsensusRequestPB heartbeat_request_;
   ConsensusResponsePB heartbeat_response_;
 
+  // Latest update request with ops and its response, sent via multi-Raft batcher.
+  ConsensusRequestPB batched_request_;
+  ConsensusResponsePB batched_response_;
+
   // Each time a heartbeat request is sent this value is incremented.
   int64_t cur_heartbeat_id_ = 0;
   // Indiciates the last valid heartbeat id that was sent.
@@ -302,6 +313,11 @@ class Peer : public std::enable_shared_from_this<Peer> {
 class PeerProxy {
  public:
 
+  // Whether the proxy delivers RPC sidecars of the controller passed to UpdateAsync.
+  virtual bool SupportsSidecars() const {
+    return false;
+  }
+
   // Sends a request, asynchronously, to a remote peer.
   virtual void UpdateAsync(const LWConsensusRequestPB* request,
                            RequestTriggerMode trigger_mode,
@@ -361,6 +377,10 @@ class RpcPeerProxy : public PeerProxy {
  public:
   RpcPeerProxy(HostPort hostport, ConsensusServiceProxyPtr consensus_proxy);
 
+  bool SupportsSidecars() const override {
+    return true;
+  }
+
   virtual void UpdateAsync(const LWConsensusRequestPB* request,
                            RequestTriggerMode trigger_mode,
                            LWConsensusResponsePB* response,
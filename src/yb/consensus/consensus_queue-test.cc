@@ -57,6 +57,7 @@ using std::string;
 
 DECLARE_bool(enable_data_block_fsync);
 DECLARE_uint64(consensus_max_batch_size_bytes);
+DECLARE_uint64(consensus_max_adaptive_batch_size_bytes);
 
 METRIC_DECLARE_entity(tablet);
 
@@ -945,5 +946,47 @@ TEST_F(ConsensusQueueTest, TestReadReplicatedMessagesForCDC) {
   ASSERT_EQ(last_committed_index - start, read_result.messages.size());
 }
 
+TEST_F(ConsensusQueueTest, TestAdaptiveBatchSize) {
+  const uint64_t kMinSize = FLAGS_consensus_max_batch_size_bytes;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_consensus_max_adaptive_batch_size_bytes) = kMinSize * 8;
+
+  PeerMessageQueue::TrackedPeer peer(kPeerUuid);
+
+  // Full batches don't change the batch size while the latency is unknown.
+  peer.batch_full_size = kMinSize;
+  peer.UpdateBatchSize(100ms);
+  ASSERT_EQ(peer.max_batch_size_bytes, 0U);
+
+  peer.batch_full_size = 0;
+  peer.UpdateBatchSize(50ms);
+  ASSERT_EQ(peer.min_round_trip_time, MonoDelta(50ms));
+
+  // Transfer time is negligible, batch size grows.
+  peer.batch_full_size = kMinSize;
+  peer.UpdateBatchSize(51ms);
+  ASSERT_EQ(peer.max_batch_size_bytes, kMinSize * 3 / 2);
+
+  // Transfer time equals to the latency, batch size moves towards the bandwidth-delay product
+  // multiplied by 4.
+  peer.batch_full_size = peer.max_batch_size_bytes;
+  peer.UpdateBatchSize(100ms);
+  ASSERT_EQ(peer.max_batch_size_bytes, (kMinSize * 3 / 2 + kMinSize * 6) / 2);
+
+  // Batch size is limited by consensus_max_adaptive_batch_size_bytes.
+  for (int i = 0; i != 10; ++i) {
+    peer.batch_full_size = peer.max_batch_size_bytes;
+    peer.UpdateBatchSize(50ms);
+  }
+  ASSERT_EQ(peer.max_batch_size_bytes, kMinSize * 8);
+
+  // Slow link, batch size is limited by consensus_max_batch_size_bytes.
+  peer.batch_full_size = peer.max_batch_size_bytes;
+  peer.UpdateBatchSize(10s);
+  peer.UpdateBatchSize(10s);
+  peer.UpdateBatchSize(10s);
+  peer.UpdateBatchSize(10s);
+  ASSERT_EQ(peer.max_batch_size_bytes, kMinSize);
+}
+
 }  // namespace consensus
 }  // namespace yb
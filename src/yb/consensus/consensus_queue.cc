@@ -103,6 +103,15 @@ DEFINE_RUNTIME_bool(enable_consensus_exponential_backoff, true,
     "for number of entries to replicate to lagging follower is enabled.");
 TAG_FLAG(enable_consensus_exponential_backoff, advanced);
 
+DEFINE_RUNTIME_bool(consensus_adaptive_batch_size, false,
+    "Adapt the maximum size of the batch of ops sent to a peer to the bandwidth-delay product of "
+    "the link to that peer. Used to replicate faster over high latency links, where a batch of "
+    "consensus_max_batch_size_bytes is sent much faster than the round trip time.");
+
+DEFINE_RUNTIME_uint64(consensus_max_adaptive_batch_size_bytes, 32_MB,
+    "Upper bound of the batch size when consensus_adaptive_batch_size is set. Also limited by "
+    "rpc_max_message_size.");
+
 DEFINE_RUNTIME_int32(consensus_lagging_follower_threshold, 10,
     "Number of retransmissions at tablet leader to mark a follower as lagging. "
     "-1 disables the feature.");
@@ -182,6 +191,40 @@ void PeerMessageQueue::TrackedPeer::ResetLastRequest() {
   current_retransmissions = -1;
 }
 
+void PeerMessageQueue::TrackedPeer::UpdateBatchSize(MonoDelta round_trip_time) {
+  // Batch is sized to this number of bandwidth-delay products, so the link is busy most of the
+  // time with a single request in flight.
+  constexpr uint64_t kBandwidthDelayProductMultiplier = 4;
+
+  if (!batch_full_size) {
+    // The request was not limited by the batch size, so its round trip time approximates the
+    // network latency.
+    if (!min_round_trip_time.Initialized() || round_trip_time < min_round_trip_time) {
+      min_round_trip_time = round_trip_time;
+    }
+    return;
+  }
+  if (!min_round_trip_time.Initialized()) {
+    return;
+  }
+
+  const uint64_t min_size = FLAGS_consensus_max_batch_size_bytes;
+  const uint64_t max_size = std::max(min_size, std::min<uint64_t>(
+      FLAGS_consensus_max_adaptive_batch_size_bytes, FLAGS_rpc_max_message_size - 2_KB));
+  const uint64_t current_size = max_batch_size_bytes ? max_batch_size_bytes : min_size;
+  const auto latency_us = std::max<int64_t>(min_round_trip_time.ToMicroseconds(), 1);
+  const auto transfer_us = round_trip_time.ToMicroseconds() - latency_us;
+  uint64_t target_size;
+  if (transfer_us * 8 <= latency_us) {
+    // Transfer time is negligible compared to the latency, so the batch is far below the
+    // bandwidth-delay product.
+    target_size = current_size * 2;
+  } else {
+    target_size = kBandwidthDelayProductMultiplier * batch_full_size * latency_us / transfer_us;
+  }
+  max_batch_size_bytes = std::clamp((current_size + target_size) / 2, min_size, max_size);
+}
+
 #define INSTANTIATE_METRIC(x) \
   x.Instantiate(metric_entity, 0)
 PeerMessageQueue::Metrics::Metrics(const scoped_refptr<MetricEntity>& metric_entity)
@@ -482,6 +525,7 @@ Status PeerMessageQueue::RequestForPeer(const string& uuid,
 
   int64 current_term;
   RaftConfigPB active_config;
+  uint64_t max_batch_size_bytes = FLAGS_consensus_max_batch_size_bytes;
   {
     LockGuard lock(queue_lock_);
     DCHECK_EQ(queue_state_.state, State::kQueueOpen);
@@ -582,6 +626,9 @@ Status PeerMessageQueue::RequestForPeer(const string& uuid,
     }
     current_term = queue_state_.current_term;
     active_config = *queue_state_.active_config;
+    if (peer->max_batch_size_bytes && GetAtomicFlag(&FLAGS_consensus_adaptive_batch_size)) {
+      max_batch_size_bytes = peer->max_batch_size_bytes;
+    }
   }
 
   if (unreachable_time.ToSeconds() > FLAGS_follower_unavailable_considered_failed_sec) {
@@ -613,7 +660,7 @@ Status PeerMessageQueue::RequestForPeer(const string& uuid,
   // Otherwise, we grab requests from the log starting at the last_received point.
   if (!is_new && num_log_ops_to_send > 0) {
     // The batch of messages to send to the peer.
-    auto max_batch_size = FLAGS_consensus_max_batch_size_bytes - request->SerializedSize();
+    auto max_batch_size = max_batch_size_bytes - request->SerializedSize();
     auto to_index = num_log_ops_to_send == kSendUnboundedLogOps ?
         0 : previously_sent_index + num_log_ops_to_send;
     auto result = ReadFromLogCache(previously_sent_index, to_index, max_batch_size, uuid);
@@ -644,6 +691,11 @@ Status PeerMessageQueue::RequestForPeer(const string& uuid,
       }
 
       peer->last_num_messages_sent = result->messages.size();
+      if (!result->messages.empty()) {
+        peer->batch_send_time = CoarseMonoClock::Now();
+        peer->batch_last_index = result->messages.back()->id().index();
+        peer->batch_full_size = result->have_more_messages ? max_batch_size : 0;
+      }
     }
 
     ScopedTrackedConsumption consumption;
@@ -1259,6 +1311,13 @@ bool PeerMessageQueue::ResponseFromPeer(const std::string& peer_uuid,
 
     if (response.has_status()) {
       const auto& status = response.status();
+      if (peer->batch_send_time != CoarseTimePoint() &&
+          status.last_received().index() >= peer->batch_last_index) {
+        if (GetAtomicFlag(&FLAGS_consensus_adaptive_batch_size)) {
+          peer->UpdateBatchSize(CoarseMonoClock::Now() - peer->batch_send_time);
+        }
+        peer->batch_send_time = CoarseTimePoint();
+      }
       // The status must always have a last received op id and a last committed index.
       DCHECK(status.has_last_received());
       DCHECK(status.has_last_received_current_leader());
@@ -1739,6 +1798,10 @@ void PeerMessageQueue::TrackOperationsMemory(const OpIds& op_ids) {
   log_cache_.TrackOperationsMemory(op_ids);
 }
 
+RefCntBuffer PeerMessageQueue::SerializedOp(const LWReplicateMsg& msg) {
+  return log_cache_.SerializedOp(msg);
+}
+
 Result<OpId> PeerMessageQueue::TEST_GetLastOpIdWithType(
     int64_t max_allowed_index, OperationType op_type) {
   return log_cache_.TEST_GetLastOpIdWithType(max_allowed_index, op_type);
@@ -142,6 +142,10 @@ class PeerMessageQueue {
 
     void ResetLastRequest();
 
+    // Adapts max_batch_size_bytes to the bandwidth-delay product of the link to this peer, using
+    // the round trip time of the last request with ops.
+    void UpdateBatchSize(MonoDelta round_trip_time);
+
     // UUID of the peer.
     const std::string uuid;
 
@@ -203,6 +207,21 @@ class PeerMessageQueue {
 
     std::vector<HostPortPB> last_known_broadcast_addr;
 
+    // Maximum size of the ops batch sent to this peer when consensus_adaptive_batch_size is set,
+    // 0 if not adapted yet.
+    uint64_t max_batch_size_bytes = 0;
+
+    // Minimum round trip time of requests that were not limited by the batch size.
+    MonoDelta min_round_trip_time;
+
+    // Send time and index of the last op of the last request with ops, whose response has not
+    // been received yet.
+    CoarseTimePoint batch_send_time;
+    int64_t batch_last_index = 0;
+
+    // Size of the last batch if it was limited by the maximum batch size, 0 otherwise.
+    uint64_t batch_full_size = 0;
+
    private:
     // The last term we saw from a given peer.
     // This is only used for sanity checking that a peer doesn't
@@ -409,6 +428,9 @@ class PeerMessageQueue {
   // Start memory tracking of following operations in case they are still present in our caches.
   void TrackOperationsMemory(const OpIds& op_ids);
 
+  // Returns serialized form of msg, shared between peers while msg is in the log cache.
+  RefCntBuffer SerializedOp(const LWReplicateMsg& msg);
+
   const server::ClockPtr& clock() const {
     return clock_;
   }
@@ -46,15 +46,20 @@
 #include "yb/consensus/log.messages.h"
 #include "yb/consensus/log-test-base.h"
 #include "yb/consensus/log_index.h"
+#include "yb/consensus/log_sync_group.h"
 #include "yb/consensus/opid_util.h"
 
 #include "yb/gutil/stl_util.h"
 #include "yb/gutil/strings/substitute.h"
 
+#include "yb/util/countdown_latch.h"
 #include "yb/util/random.h"
 #include "yb/util/size_literals.h"
 #include "yb/util/stopwatch.h"
 #include "yb/util/flags.h"
+#include "yb/util/test_thread_holder.h"
+
+using namespace std::literals;
 
 DEFINE_NON_RUNTIME_int32(num_batches, 10000,
              "Number of batches to write to/read from the Log in TestWriteManyBatches");
@@ -67,6 +72,13 @@ DECLARE_int32(o_direct_block_size_bytes);
 DECLARE_bool(TEST_simulate_abrupt_server_restart);
 DECLARE_bool(TEST_skip_file_close);
 DECLARE_int64(reuse_unclosed_segment_threshold_bytes);
+DECLARE_bool(log_sync_group_commit);
+DECLARE_bool(log_sync_group_use_syncfs);
+DECLARE_bool(enable_log_compression);
+DECLARE_string(log_compression_type);
+DECLARE_bool(log_segment_mmap_reads);
+DECLARE_int32(log_max_recycled_segments);
+DECLARE_bool(log_salt_recycled_segment_entries);
 
 namespace yb {
 namespace log {
@@ -350,6 +362,58 @@ TEST_F(LogTest, TestMultipleEntriesInABatch) {
   ASSERT_OK(log_->Close());
 }
 
+class LogCompressionTest : public LogTest, public testing::WithParamInterface<std::string> {
+};
+
+// Entries of segments written with compression should be read back.
+TEST_P(LogCompressionTest, TestCompressedEntries) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_enable_log_compression) = true;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_log_compression_type) = GetParam();
+  BuildLog();
+
+  OpIdPB opid;
+  opid.set_term(1);
+  opid.set_index(1);
+
+  ASSERT_OK(AppendNoOpsToLogSync(clock_, log_.get(), &opid, 2));
+  ASSERT_OK(AppendNoOpsToLogSync(clock_, log_.get(), &opid, 3));
+  ASSERT_OK(log_->AllocateSegmentAndRollOver());
+
+  SegmentSequence segments;
+  ASSERT_OK(log_->GetLogReader()->GetSegmentsSnapshot(&segments));
+
+  const ReadableLogSegmentPtr& first_segment = ASSERT_RESULT(segments.front());
+  ASSERT_EQ(ASSERT_RESULT(ParseLogCompressionType(GetParam())),
+            first_segment->header().compression_type());
+  auto read_entries = first_segment->ReadEntries();
+  ASSERT_OK(read_entries.status);
+  ASSERT_EQ(5, read_entries.entries.size());
+
+  auto loaded_op = ASSERT_RESULT(log_->GetLogReader()->LookupOpId(4));
+  ASSERT_EQ(yb::OpId(1, 4), loaded_op);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    CompressionType, LogCompressionTest, ::testing::Values("none", "lz4", "snappy"));
+
+// Segments should not be compressed until the format change is enabled.
+TEST_F(LogTest, TestCompressionRequiresAutoFlag) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_enable_log_compression) = false;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_log_compression_type) = "lz4";
+  BuildLog();
+
+  OpIdPB opid;
+  opid.set_term(1);
+  opid.set_index(1);
+  ASSERT_OK(AppendNoOpsToLogSync(clock_, log_.get(), &opid, 2));
+
+  SegmentSequence segments;
+  ASSERT_OK(log_->GetLogReader()->GetSegmentsSnapshot(&segments));
+  const ReadableLogSegmentPtr& first_segment = ASSERT_RESULT(segments.front());
+  ASSERT_EQ(LogCompressionTypePB::NO_LOG_COMPRESSION, first_segment->header().compression_type());
+  ASSERT_OK(log_->Close());
+}
+
 // Tests that everything works properly with fsync enabled:
 // This also tests SyncDir() (see KUDU-261), which is called whenever
 // a new log segment is initialized.
@@ -365,6 +429,126 @@ TEST_F(LogTest, TestFsync) {
   ASSERT_OK(log_->Close());
 }
 
+// Tests that fsyncs go through the sync group of the WAL disk when group commit is enabled.
+class LogSyncGroupTest : public LogTest, public testing::WithParamInterface<bool> {
+};
+
+TEST_P(LogSyncGroupTest, TestFsyncGroupCommit) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_log_sync_group_commit) = true;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_log_sync_group_use_syncfs) = GetParam();
+  options_.durable_wal_write = true;
+  BuildLog();
+
+  OpIdPB opid;
+  opid.set_term(0);
+  opid.set_index(1);
+
+  auto sync_group = LogSyncGroup::ForWalDir(env_.get(), log_->wal_dir());
+  auto num_syncs = sync_group->num_syncs();
+  ASSERT_OK(AppendNoOp(&opid));
+  ASSERT_OK(AppendNoOp(&opid));
+  ASSERT_GT(sync_group->num_syncs(), num_syncs);
+  ASSERT_OK(log_->Close());
+}
+
+INSTANTIATE_TEST_CASE_P(UseSyncFs, LogSyncGroupTest, ::testing::Bool());
+
+namespace {
+
+// Tracks size of the file at the last completed sync and the number of concurrent syncs.
+class SyncTrackingFile : public WritableFileWrapper {
+ public:
+  SyncTrackingFile(std::unique_ptr<WritableFile> target, std::atomic<int>* active_syncs,
+                   std::atomic<int>* max_active_syncs)
+      : WritableFileWrapper(std::move(target)), active_syncs_(active_syncs),
+        max_active_syncs_(max_active_syncs) {}
+
+  Status Sync() override {
+    auto size = Size();
+    auto active = ++*active_syncs_;
+    auto max_active = max_active_syncs_->load();
+    while (active > max_active && !max_active_syncs_->compare_exchange_weak(max_active, active)) {
+    }
+    // Make syncs slow enough to overlap when they are performed in parallel.
+    std::this_thread::sleep_for(50ms);
+    auto status = WritableFileWrapper::Sync();
+    --*active_syncs_;
+    RETURN_NOT_OK(status);
+    synced_size_ = size;
+    return Status::OK();
+  }
+
+  uint64_t synced_size() const {
+    return synced_size_;
+  }
+
+ private:
+  std::atomic<int>* active_syncs_;
+  std::atomic<int>* max_active_syncs_;
+  std::atomic<uint64_t> synced_size_{0};
+};
+
+} // namespace
+
+// Tests that logs syncing through the same group are released with their data synced, and that
+// segments of a batch are synced in parallel.
+TEST_F(LogTest, TestSyncGroupSyncsSegmentsInParallel) {
+  constexpr int kNumSegments = 4;
+  constexpr int kNumIterations = 5;
+
+  std::atomic<int> active_syncs{0};
+  std::atomic<int> max_active_syncs{0};
+  LogSyncGroup sync_group(env_.get(), GetTestPath("wal"));
+  std::vector<std::shared_ptr<SyncTrackingFile>> files;
+  std::vector<std::unique_ptr<WritableLogSegment>> segments;
+  for (int i = 0; i != kNumSegments; ++i) {
+    auto path = GetTestPath(Format("segment-$0", i));
+    std::unique_ptr<WritableFile> file;
+    ASSERT_OK(env_->NewWritableFile(path, &file));
+    files.push_back(std::make_shared<SyncTrackingFile>(
+        std::move(file), &active_syncs, &max_active_syncs));
+    segments.push_back(std::make_unique<WritableLogSegment>(path, files.back()));
+    LogSegmentHeaderPB header;
+    header.set_major_version(kLogMajorVersion);
+    header.set_minor_version(kLogMinorVersion);
+    header.set_sequence_number(i);
+    header.set_unused_tablet_id(kTestTablet);
+    SchemaToPB(schema_, header.mutable_deprecated_schema());
+    ASSERT_OK(segments.back()->WriteHeader(header));
+  }
+
+  CountDownLatch start_latch(1);
+  CountDownLatch done_latch(kNumSegments);
+  TestThreadHolder thread_holder;
+  for (int i = 0; i != kNumSegments; ++i) {
+    thread_holder.AddThreadFunctor([&, i] {
+      auto& segment = *segments[i];
+      start_latch.Wait();
+      for (int iteration = 0; iteration != kNumIterations; ++iteration) {
+        ASSERT_OK(segment.WriteEntryBatch(Format("segment $0 entry $1", i, iteration)));
+        ASSERT_OK(sync_group.Sync(&segment));
+        // Everything written before the sync is durable when the sync returns.
+        ASSERT_EQ(files[i]->synced_size(), static_cast<uint64_t>(segment.written_offset()));
+      }
+      done_latch.CountDown();
+    });
+  }
+  start_latch.CountDown();
+  ASSERT_TRUE(done_latch.WaitFor(30s));
+  thread_holder.JoinAll();
+
+  ASSERT_GT(max_active_syncs.load(), 1);
+  for (int i = 0; i != kNumSegments; ++i) {
+    auto size = static_cast<uint64_t>(segments[i]->written_offset());
+    ASSERT_OK(files[i]->Close());
+    faststring content;
+    ASSERT_OK(ReadFileToString(env_.get(), segments[i]->path(), &content));
+    ASSERT_EQ(content.size(), size);
+    auto last_entry = Format("segment $0 entry $1", i, kNumIterations - 1);
+    ASSERT_TRUE(content.ToString().ends_with(last_entry));
+  }
+}
+
 // Tests interval for durable wal write
 TEST_F(LogTest, TestFsyncInterval) {
   options_.interval_durable_wal_write = MonoDelta::FromMilliseconds(1);
@@ -658,6 +842,47 @@ TEST_F(LogTest, TestSegmentRollover) {
   ASSERT_EQ(num_entries, total_read);
 }
 
+// Checks that entries of closed segments read through a memory mapping match regular reads.
+TEST_F(LogTest, TestMmapReadsOfClosedSegments) {
+  BuildLog();
+  log_->SetMaxSegmentSizeForTests(990);
+  const int kNumEntriesPerBatch = 100;
+
+  OpIdPB op_id = MakeOpId(1, 1);
+  SegmentSequence segments;
+  ASSERT_OK(log_->GetLogReader()->GetSegmentsSnapshot(&segments));
+  while (segments.size() < 3) {
+    ASSERT_OK(AppendNoOps(&op_id, kNumEntriesPerBatch));
+    ASSERT_OK(log_->GetLogReader()->GetSegmentsSnapshot(&segments));
+  }
+  ASSERT_OK(log_->Close());
+
+  auto read_all = [this](bool mmap_reads) -> Result<std::vector<std::string>> {
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_log_segment_mmap_reads) = mmap_reads;
+    std::unique_ptr<LogReader> reader;
+    RETURN_NOT_OK(LogReader::Open(
+        fs_manager_->env(), nullptr, "Log reader: ", tablet_wal_path_, nullptr, nullptr,
+        &reader));
+    SegmentSequence segments;
+    RETURN_NOT_OK(reader->GetSegmentsSnapshot(&segments));
+    std::vector<std::string> result;
+    for (const auto& segment : segments) {
+      SCHECK_EQ(segment->GetMapping() != nullptr, mmap_reads, IllegalState, "Unexpected mapping");
+      auto read_entries = segment->ReadEntries();
+      RETURN_NOT_OK(read_entries.status);
+      for (const auto& entry : read_entries.entries) {
+        result.push_back(entry->ShortDebugString());
+      }
+    }
+    return result;
+  };
+
+  auto regular_entries = ASSERT_RESULT(read_all(false));
+  auto mmap_entries = ASSERT_RESULT(read_all(true));
+  ASSERT_FALSE(regular_entries.empty());
+  ASSERT_EQ(regular_entries, mmap_entries);
+}
+
 TEST_F(LogTest, TestWriteAndReadToAndFromInProgressSegment) {
   const int kNumEntries = 4;
   BuildLog();
@@ -1297,6 +1522,65 @@ TEST_F(LogTest, AllocateSegmentAndRollOver) {
   ASSERT_OK(log_->Close());
 }
 
+TEST_F(LogTest, RecycleSegments) {
+  constexpr int kNumOpsPerSegment = 5;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_log_max_recycled_segments) = 1;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_log_salt_recycled_segment_entries) = true;
+
+  auto list_recycled_segments = [this]() -> Result<std::vector<std::string>> {
+    std::vector<std::string> result;
+    auto files = VERIFY_RESULT(env_->GetChildren(tablet_wal_path_, ExcludeDots::kTrue));
+    for (const auto& file : files) {
+      if (HasPrefixString(file, ".tmp.recycledsegment")) {
+        result.push_back(JoinPathSegments(tablet_wal_path_, file));
+      }
+    }
+    return result;
+  };
+
+  BuildLog();
+  OpIdPB op_id = MakeOpId(1, 1);
+  ASSERT_OK(AppendMultiSegmentSequence(4, kNumOpsPerSegment, &op_id, nullptr));
+
+  // Two segments are GCed, the first one is recycled and the second one is deleted.
+  int num_gced_segments;
+  ASSERT_OK(log_->GC(op_id.index(), &num_gced_segments));
+  ASSERT_EQ(num_gced_segments, 2);
+  auto recycled = ASSERT_RESULT(list_recycled_segments());
+  ASSERT_EQ(recycled.size(), 1);
+  auto recycled_inode = ASSERT_RESULT(env_->GetFileINode(recycled[0]));
+  auto recycled_size = ASSERT_RESULT(env_->GetFileSize(recycled[0]));
+
+  // The recycled file is used for the next segment.
+  ASSERT_OK(RollLog());
+  ASSERT_EQ(ASSERT_RESULT(list_recycled_segments()).size(), 0);
+  auto active_path = log_->active_segment_->path();
+  ASSERT_EQ(ASSERT_RESULT(env_->GetFileINode(active_path)), recycled_inode);
+  ASSERT_NE(log_->active_segment_->header().entry_header_salt(), 0U);
+  ASSERT_OK(AppendNoOps(&op_id, 1));
+
+  // Crash with the segment shorter than the GCed one, so its entries are left past the tail.
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_simulate_abrupt_server_restart) = true;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_skip_file_close) = true;
+  ASSERT_OK(log_->Close());
+  ASSERT_GE(ASSERT_RESULT(env_->GetFileSize(active_path)), recycled_size);
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_simulate_abrupt_server_restart) = false;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_skip_file_close) = false;
+
+  // Entries of the GCed segment should not be read from the reused file after restart.
+  BuildLog();
+  auto* reader = log_->GetLogReader();
+  auto min_index = reader->GetMinReplicateIndex();
+  ReplicateMsgs repls;
+  int64_t starting_op_segment_seq_num;
+  ASSERT_OK(reader->ReadReplicatesInRange(
+      min_index, op_id.index() - 1, LogReader::kNoSizeLimit, &repls,
+      &starting_op_segment_seq_num));
+  ASSERT_EQ(repls.size(), static_cast<size_t>(op_id.index() - min_index));
+  ASSERT_EQ(repls.back()->id().index(), op_id.index() - 1);
+  ASSERT_OK(log_->Close());
+}
+
 TEST_F(LogTest, ConcurrentAllocateSegmentAndRollOver) {
   constexpr auto kNumBatches = 10;
   constexpr auto kNumEntriesPerBatch = 10;
@@ -52,6 +52,7 @@
 #include "yb/consensus/log_index.h"
 #include "yb/consensus/log_metrics.h"
 #include "yb/consensus/log_reader.h"
+#include "yb/consensus/log_sync_group.h"
 #include "yb/consensus/log_util.h"
 
 #include "yb/fs/fs_manager.h"
@@ -61,6 +62,7 @@
 #include "yb/gutil/ref_counted.h"
 #include "yb/gutil/stl_util.h"
 #include "yb/gutil/strings/substitute.h"
+#include "yb/gutil/strings/util.h"
 #include "yb/gutil/walltime.h"
 
 #include "yb/util/async_util.h"
@@ -74,6 +76,7 @@
 #include "yb/util/file_util.h"
 #include "yb/util/flags.h"
 #include "yb/util/format.h"
+#include "yb/util/lockfree.h"
 #include "yb/util/logging.h"
 #include "yb/util/metrics.h"
 #include "yb/util/operation_counter.h"
@@ -81,6 +84,7 @@
 #include "yb/util/path_util.h"
 #include "yb/util/pb_util.h"
 #include "yb/util/random.h"
+#include "yb/util/random_util.h"
 #include "yb/util/scope_exit.h"
 #include "yb/util/shared_lock.h"
 #include "yb/util/size_literals.h"
@@ -139,6 +143,10 @@ DEFINE_UNKNOWN_double(log_background_sync_interval_fraction, 0.6,
              "entry exceeds interval_durable_wal_write_ms*log_background_sync_interval_fraction "
              "the fsync task is pushed to the log-sync queue.");
 
+DEFINE_RUNTIME_bool(log_sync_group_commit, false,
+    "If true, fsyncs of logs with WAL on the same disk are issued together in batches by a "
+    "single thread, and waiters of a batch are released at once. Reduces fsyncs of unrelated "
+    "tablets queued behind each other when there are many tablets per server.");
 
 // Flags for controlling kernel watchdog limits.
 DEFINE_RUNTIME_int32(consensus_log_scoped_watch_delay_callback_threshold_ms, 1000,
@@ -215,6 +223,37 @@ DEFINE_RUNTIME_int64(reuse_unclosed_segment_threshold_bytes, INT64_MAX,
             "Log will reuse this last segment as writable active_segment at tablet bootstrap. "
             "Otherwise, Log will create a new segment.");
 
+DEFINE_RUNTIME_int32(log_max_recycled_segments, 0,
+    "Maximum number of GCed WAL segment files of a tablet that are kept to be reused as new "
+    "segments, instead of being deleted, so a roll does not create and allocate a file. "
+    "0 disables recycling. Segments are recycled only when log_salt_recycled_segment_entries is "
+    "set.");
+TAG_FLAG(log_max_recycled_segments, advanced);
+
+DEFINE_RUNTIME_AUTO_bool(log_salt_recycled_segment_entries, kLocalPersisted, false, true,
+    "Whether WAL segments written into recycled files salt their entry header checksums, so "
+    "stale entries of the previous segment in the file are not read. Required to recycle "
+    "segments, since older versions cannot read salted segments.");
+
+DEFINE_RUNTIME_AUTO_bool(enable_log_compression, kLocalPersisted, false, true,
+    "Whether new WAL segments could be compressed according to log_compression_type. Older "
+    "versions cannot read compressed segments.");
+
+DEFINE_RUNTIME_string(log_compression_type, "none",
+    "Compression of entry batches in new WAL segments: none, lz4 or snappy. Each segment records "
+    "its compression in the header, so the flag could be changed at any time. Ignored until "
+    "enable_log_compression is set.");
+
+static bool ValidateLogCompressionType(const char* flagname, const std::string& value) {
+  auto compression_type = yb::log::ParseLogCompressionType(value);
+  if (compression_type.ok()) {
+    return true;
+  }
+  LOG(ERROR) << flagname << ": " << compression_type.status();
+  return false;
+}
+DEFINE_validator(log_compression_type, &ValidateLogCompressionType);
+
 // Validate that log_min_segments_to_retain >= 1
 static bool ValidateLogsToRetain(const char* flagname, int value) {
   if (value >= 1) {
@@ -228,6 +267,7 @@ DEFINE_validator(log_min_segments_to_retain, &ValidateLogsToRetain);
 
 static std::string kSegmentPlaceholderFilePrefix = ".tmp.newsegment";
 static std::string kSegmentPlaceholderFileTemplate = kSegmentPlaceholderFilePrefix + "XXXXXX";
+static std::string kRecycledSegmentFilePrefix = ".tmp.recycledsegment";
 
 namespace yb {
 namespace log {
@@ -245,11 +285,24 @@ bool IsMarkerType(LogEntryTypePB type) {
          type == LogEntryTypePB::FLUSH_MARKER;
 }
 
+// Returns a salt for entry headers of a segment written into a recycled file. Entry header of
+// all zeros, i.e. unwritten preallocated space, should still not pass the checksum.
+uint32_t GenerateEntryHeaderSalt() {
+  static const uint8_t kZeroHeader[8] = {};
+  static const uint32_t kZeroHeaderCrc = crc::Crc32c(kZeroHeader, sizeof(kZeroHeader));
+  for (;;) {
+    auto salt = RandomUniformInt<uint32_t>(1, std::numeric_limits<uint32_t>::max());
+    if (salt != kZeroHeaderCrc) {
+      return salt;
+    }
+  }
+}
+
 } // namespace
 
 // This class represents a batch of operations to be written and synced to the log. It is opaque to
 // the user and is managed by the Log class.
-class Log::LogEntryBatch {
+class Log::LogEntryBatch : public MPSCQueueEntry<LogEntryBatch> {
  public:
   LogEntryBatch(LogEntryTypePB type, std::shared_ptr<LWLogEntryBatchPB> entry_batch_pb);
   ~LogEntryBatch();
@@ -626,6 +679,7 @@ Log::Log(
       allocation_token_(allocation_thread_pool->NewToken(ThreadPool::ExecutionMode::SERIAL)),
       background_sync_threadpool_token_(
           background_sync_threadpool->NewToken(ThreadPool::ExecutionMode::SERIAL)),
+      sync_group_(LogSyncGroup::ForWalDir(options_.env, wal_dir_)),
       durable_wal_write_(options_.durable_wal_write),
       interval_durable_wal_write_(options_.interval_durable_wal_write),
       bytes_durable_wal_write_mb_(options_.bytes_durable_wal_write_mb),
@@ -680,6 +734,8 @@ Status Log::Init() {
 
   }
 
+  RETURN_NOT_OK(LoadRecycledSegments());
+
   if (durable_wal_write_) {
     YB_LOG_FIRST_N(INFO, 1) << "durable_wal_write is turned on.";
   } else if (interval_durable_wal_write_) {
@@ -1110,7 +1166,8 @@ Status Log::DoSync() {
   LOG_SLOW_EXECUTION_EVERY_N_SECS(INFO, /* log at most one slow execution every 1 sec */ 1,
                                   50, "Fsync log took a long time") {
     SCOPED_LATENCY_METRIC(metrics_, sync_latency);
-    status = active_segment_->Sync();
+    status = FLAGS_log_sync_group_commit ? sync_group_->Sync(active_segment_.get())
+                                         : active_segment_->Sync();
   }
 
   return status;
@@ -1458,13 +1515,21 @@ Status Log::GC(int64_t min_op_idx, int32_t* num_gced) {
           reader_->TrimSegmentsUpToAndIncluding(last_to_delete->header().sequence_number()));
     }
 
-    // Now that they are no longer referenced by the Log, delete the files.
+    // Now that they are no longer referenced by the Log, delete or recycle the files.
     *num_gced = 0;
     for (const scoped_refptr<ReadableLogSegment>& segment : segments_to_delete) {
-      LOG_WITH_PREFIX(INFO) << "Deleting log segment in path: " << segment->path()
-                            << " (GCed ops < " << segment->footer().max_replicate_index() + 1
-                            << ")";
-      RETURN_NOT_OK(get_env()->DeleteFile(segment->path()));
+      // The file of a recycled segment is overwritten, so it could be recycled only when nobody
+      // else holds the segment.
+      if (segment->HasOneRef() && VERIFY_RESULT(RecycleSegment(*segment))) {
+        LOG_WITH_PREFIX(INFO) << "Recycled log segment in path: " << segment->path()
+                              << " (GCed ops < " << segment->footer().max_replicate_index() + 1
+                              << ")";
+      } else {
+        LOG_WITH_PREFIX(INFO) << "Deleting log segment in path: " << segment->path()
+                              << " (GCed ops < " << segment->footer().max_replicate_index() + 1
+                              << ")";
+        RETURN_NOT_OK(get_env()->DeleteFile(segment->path()));
+      }
       (*num_gced)++;
 
       if (metrics_) {
@@ -1805,7 +1870,10 @@ Status Log::PreAllocateNewSegment() {
   CHECK_EQ(allocation_state(), SegmentAllocationState::kAllocationInProgress);
 
   auto opts = GetNewSegmentWritableFileOptions();
-  RETURN_NOT_OK(CreatePlaceholderSegment(opts, &next_segment_path_, &next_segment_file_));
+  next_segment_recycled_ = ReuseRecycledSegment(opts, &next_segment_path_, &next_segment_file_);
+  if (!next_segment_recycled_) {
+    RETURN_NOT_OK(CreatePlaceholderSegment(opts, &next_segment_path_, &next_segment_file_));
+  }
 
   if (options_.preallocate_segments) {
     uint64_t next_segment_size = NextSegmentDesiredSize();
@@ -1846,6 +1914,17 @@ Status Log::SwitchToAllocatedSegment() {
   header.set_minor_version(kLogMinorVersion);
   header.set_sequence_number(active_segment_sequence_number_);
   header.set_unused_tablet_id(tablet_id_);
+  if (FLAGS_enable_log_compression) {
+    header.set_compression_type(ResultToValue(
+        ParseLogCompressionType(FLAGS_log_compression_type),
+        LogCompressionTypePB::NO_LOG_COMPRESSION));
+  }
+  if (next_segment_recycled_) {
+    // The file is not rewritten, so it still contains entries of the GCed segment past the tail of
+    // the new one. Those entries fail the checksum of the salted entry headers, so after a crash
+    // the reader treats them as the tail of a partially written segment.
+    header.set_entry_header_salt(GenerateEntryHeaderSalt());
+  }
 
   // Set up the new footer. This will be maintained as the segment is written.
   footer_builder_.Clear();
@@ -1938,6 +2017,70 @@ Status Log::CreatePlaceholderSegment(const WritableFileOptions& opts,
   return Status::OK();
 }
 
+Status Log::LoadRecycledSegments() {
+  auto children = VERIFY_RESULT(get_env()->GetChildren(wal_dir_, ExcludeDots::kTrue));
+  std::lock_guard lock(recycled_segments_mutex_);
+  for (const auto& child : children) {
+    if (!HasPrefixString(child, kRecycledSegmentFilePrefix)) {
+      continue;
+    }
+    auto path = JoinPathSegments(wal_dir_, child);
+    if (get_env()->IsEncrypted() || !FLAGS_log_salt_recycled_segment_entries ||
+        static_cast<int64_t>(recycled_segments_.size()) >= FLAGS_log_max_recycled_segments) {
+      RETURN_NOT_OK(get_env()->DeleteFile(path));
+      continue;
+    }
+    VLOG_WITH_PREFIX(1) << "Found recycled segment: " << path;
+    recycled_segments_.push_back(std::move(path));
+  }
+  return Status::OK();
+}
+
+Result<bool> Log::RecycleSegment(const ReadableLogSegment& segment) {
+  // Encrypted file has a header that should not be overwritten, so it is not recycled.
+  if (get_env()->IsEncrypted() || !FLAGS_log_salt_recycled_segment_entries) {
+    return false;
+  }
+  std::lock_guard lock(recycled_segments_mutex_);
+  if (static_cast<int64_t>(recycled_segments_.size()) >= FLAGS_log_max_recycled_segments) {
+    return false;
+  }
+  auto path = JoinPathSegments(
+      wal_dir_, Format("$0$1", kRecycledSegmentFilePrefix, segment.header().sequence_number()));
+  RETURN_NOT_OK(get_env()->RenameFile(segment.path(), path));
+  recycled_segments_.push_back(std::move(path));
+  return true;
+}
+
+bool Log::ReuseRecycledSegment(
+    WritableFileOptions opts, std::string* result_path, std::shared_ptr<WritableFile>* out) {
+  std::string path;
+  {
+    std::lock_guard lock(recycled_segments_mutex_);
+    if (recycled_segments_.empty()) {
+      return false;
+    }
+    path = std::move(recycled_segments_.back());
+    recycled_segments_.pop_back();
+  }
+
+  // The file is not zeroed, entries of the GCed segment are made unreadable by the entry header
+  // salt of the new segment, see SwitchToAllocatedSegment.
+  opts.mode = Env::OPEN_EXISTING;
+  opts.initial_offset = 0;
+  std::unique_ptr<WritableFile> segment_file;
+  auto status = get_env()->NewWritableFile(opts, path, &segment_file);
+  if (status.ok()) {
+    VLOG_WITH_PREFIX(1) << "Reused recycled segment as next WAL segment: " << path;
+    *result_path = std::move(path);
+    out->reset(segment_file.release());
+    return true;
+  }
+  LOG_WITH_PREFIX(WARNING) << "Failed to reuse recycled segment " << path << ": " << status;
+  WARN_NOT_OK(get_env()->DeleteFile(path), "Failed to delete recycled segment");
+  return false;
+}
+
 uint64_t Log::active_segment_sequence_number() const {
   return active_segment_sequence_number_;
 }
@@ -389,6 +389,21 @@ class Log : public RefCountedThreadSafe<Log> {
                                   std::string* result_path,
                                   std::shared_ptr<WritableFile>* out);
 
+  // Adds recycled segment files left in the WAL directory by previous instance of the log to the
+  // pool, deleting the files that do not fit into it.
+  Status LoadRecycledSegments() EXCLUDES(recycled_segments_mutex_);
+
+  // Renames the file of the GCed segment and adds it to the pool of recycled segments. Returns
+  // false if the pool is full, then the file should be deleted.
+  Result<bool> RecycleSegment(const ReadableLogSegment& segment)
+      EXCLUDES(recycled_segments_mutex_);
+
+  // Opens a file from the pool of recycled segments for writing from the start.
+  // Returns false if the pool is empty or the file could not be reused.
+  bool ReuseRecycledSegment(
+      WritableFileOptions opts, std::string* result_path, std::shared_ptr<WritableFile>* out)
+      EXCLUDES(recycled_segments_mutex_);
+
   // Creates a new WAL segment on disk, writes the next_segment_header_ to disk as the header, and
   // sets active_segment_ to point to this new segment.
   Status SwitchToAllocatedSegment() EXCLUDES(active_segment_mutex_);
@@ -540,6 +555,14 @@ class Log : public RefCountedThreadSafe<Log> {
   // The path for the next allocated segment.
   std::string next_segment_path_;
 
+  // Whether the next allocated segment reuses a recycled file.
+  bool next_segment_recycled_ = false;
+
+  std::mutex recycled_segments_mutex_;
+
+  // Paths of GCed segment files kept to be reused for new segments, see log_max_recycled_segments.
+  std::vector<std::string> recycled_segments_ GUARDED_BY(recycled_segments_mutex_);
+
   // Lock to protect mutations to log_state_ and other shared state variables.
   mutable PerCpuRwMutex state_lock_;
 
@@ -585,6 +608,9 @@ class Log : public RefCountedThreadSafe<Log> {
   // A thread pool for performing log fsync operations.
   std::unique_ptr<ThreadPoolToken> background_sync_threadpool_token_;
 
+  // Group commit of fsyncs shared with other logs on the same disk, see log_sync_group_commit.
+  std::shared_ptr<LogSyncGroup> sync_group_;
+
   // If true, sync on all appends.
   bool durable_wal_write_;
 
@@ -219,6 +219,27 @@ TEST_F(LogCacheTest, TestAppendAndGetMessages) {
   EXPECT_EQ(MakeOpIdForIndex(start + 1), OpId::FromPB(read_result.messages[0]->id()));
 }
 
+// Serialized op should be cached with the op and shared between readers.
+TEST_F(LogCacheTest, TestSerializedOp) {
+  ASSERT_OK(AppendReplicateMessagesToCache(1, kNumMessages));
+  ASSERT_OK(log_->WaitUntilAllFlushed());
+
+  auto read_result = ASSERT_RESULT(cache_->ReadOps(kMessageIndex1, 8_MB));
+  ASSERT_FALSE(read_result.messages.empty());
+  const auto& msg = *read_result.messages[0];
+  auto size_before = cache_->metrics_.size->value();
+
+  auto serialized = cache_->SerializedOp(msg);
+  ASSERT_EQ(msg.SerializedSize(), serialized.size());
+  ASSERT_EQ(size_before + serialized.size(), cache_->metrics_.size->value());
+  ASSERT_EQ(serialized.data(), cache_->SerializedOp(msg).data());
+
+  ThreadSafeArena arena;
+  LWReplicateMsg parsed(&arena);
+  ASSERT_OK(parsed.ParseFromSlice(serialized.AsSlice()));
+  ASSERT_EQ(OpId::FromPB(msg.id()), OpId::FromPB(parsed.id()));
+}
+
 // Test cache entry shouldn't be evicted until it's synced to disk.
 TEST_F(LogCacheTest, ShouldNotEvictUnsyncedOpFromCache) {
   ASSERT_OK(AppendReplicateMessageToCache(/* term = */ 1, /* index = */ 1));
@@ -664,6 +664,33 @@ void LogCache::TrackOperationsMemory(const OpIds& op_ids) {
   }
 }
 
+RefCntBuffer LogCache::SerializedOp(const LWReplicateMsg& msg) {
+  const auto index = msg.id().index();
+  {
+    std::lock_guard lock(lock_);
+    auto it = cache_.find(index);
+    if (it != cache_.end() && it->second.msg.get() == &msg && it->second.serialized) {
+      return it->second.serialized;
+    }
+  }
+
+  RefCntBuffer result(msg.SerializedSize());
+  msg.SerializeToArray(result.udata());
+
+  std::lock_guard lock(lock_);
+  auto it = cache_.find(index);
+  if (it != cache_.end() && it->second.msg.get() == &msg && !it->second.serialized) {
+    auto& entry = it->second;
+    entry.serialized = result;
+    entry.mem_usage += result.size();
+    metrics_.size->IncrementBy(result.size());
+    if (entry.tracked) {
+      tracker_->Consume(result.size());
+    }
+  }
+  return result;
+}
+
 int64_t LogCache::num_cached_ops() const {
   return metrics_.num_ops->value();
 }
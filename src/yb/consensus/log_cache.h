@@ -182,6 +182,10 @@ class LogCache {
   // Start memory tracking of following operations in case they are still present in cache.
   void TrackOperationsMemory(const OpIds& op_ids);
 
+  // Returns serialized form of msg. When msg is present in the cache, the serialized form is
+  // cached with it, so the message is serialized once for all peers.
+  RefCntBuffer SerializedOp(const LWReplicateMsg& msg);
+
   Result<OpId> TEST_GetLastOpIdWithType(int64_t max_allowed_index, OperationType op_type);
 
  private:
@@ -200,6 +204,9 @@ class LogCache {
 
     // Did we start memory tracking for this entry.
     bool tracked = false;
+
+    // Serialized msg, filled on demand by SerializedOp.
+    RefCntBuffer serialized;
   };
 
   typedef boost::container::small_vector<ReplicateMsgPtr, 8> ReplicateMsgVector;
@@ -31,6 +31,8 @@ class LogIndex;
 class LogReader;
 class LogSegmentFooterPB;
 class LogSegmentHeaderPB;
+class LogSegmentMapping;
+class LogSyncGroup;
 class ReadableLogSegment;
 class WritableLogSegment;
 
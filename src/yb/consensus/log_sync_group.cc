@@ -0,0 +1,117 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/consensus/log_sync_group.h"
+
+#include <unordered_map>
+
+#include "yb/consensus/log_util.h"
+
+#include "yb/util/env.h"
+#include "yb/util/flags.h"
+#include "yb/util/logging.h"
+#include "yb/util/path_util.h"
+
+DEFINE_RUNTIME_bool(log_sync_group_use_syncfs, false,
+    "When log_sync_group_commit is enabled, sync a batch of logs with a single sync of the file "
+    "system containing the WAL. Should only be used when WAL is on a dedicated disk, since it "
+    "also flushes all other dirty data of this file system. Linux kernels before 5.8 do not "
+    "report writeback errors from syncfs, so a failed WAL write could go unnoticed there.");
+
+namespace yb {
+namespace log {
+
+LogSyncGroup::LogSyncGroup(Env* env, std::string path)
+    : env_(env), path_(std::move(path)) {
+}
+
+std::shared_ptr<LogSyncGroup> LogSyncGroup::ForWalDir(Env* env, const std::string& wal_dir) {
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::shared_ptr<LogSyncGroup>> groups;
+
+  // Tablet WAL dirs are <wal root>/table-<table id>/tablet-<tablet id>.
+  auto root = DirName(DirName(wal_dir));
+  std::lock_guard lock(mutex);
+  auto& result = groups[root];
+  if (!result) {
+    result = std::make_shared<LogSyncGroup>(env, root);
+  }
+  return result;
+}
+
+Status LogSyncGroup::Sync(WritableLogSegment* segment) {
+  SyncRequest request{segment};
+  std::unique_lock lock(mutex_);
+  pending_.push_back(&request);
+  while (!request.done) {
+    if (sync_in_progress_) {
+      cond_.wait(lock);
+      continue;
+    }
+    // Become the leader for all requests pending at this moment. Waiters hold the lock of their
+    // log while waiting, so their segments stay alive until the request is done.
+    sync_in_progress_ = true;
+    std::vector<SyncRequest*> batch;
+    batch.swap(pending_);
+    lock.unlock();
+    StartBatch(batch);
+    lock.lock();
+    sync_in_progress_ = false;
+    ++num_syncs_;
+    for (auto* batch_request : batch) {
+      batch_request->done = true;
+    }
+    cond_.notify_all();
+  }
+  lock.unlock();
+
+  // Segments are synced by their own logs, so syncs of the batch run in parallel instead of
+  // the leader syncing them one by one.
+  if (request.sync_segment && request.status.ok()) {
+    request.status = segment->Sync();
+  }
+  return request.status;
+}
+
+void LogSyncGroup::StartBatch(const std::vector<SyncRequest*>& batch) {
+  for (auto* request : batch) {
+    request->status = request->segment->FlushAsync();
+  }
+
+  // Data written before the file system sync started is durable after it finished.
+  // Before Linux 5.8 syncfs does not return writeback errors, so it could succeed even if
+  // writes of the batch failed. See log_sync_group_use_syncfs.
+  if (syncfs_supported_ && FLAGS_log_sync_group_use_syncfs) {
+    auto status = env_->SyncFileSystem(path_);
+    if (status.ok()) {
+      return;
+    }
+    if (status.IsNotSupported()) {
+      syncfs_supported_ = false;
+    } else {
+      YB_LOG_EVERY_N_SECS(WARNING, 10) << "Sync of " << path_ << " failed: " << status;
+    }
+  }
+
+  for (auto* request : batch) {
+    request->sync_segment = true;
+  }
+}
+
+uint64_t LogSyncGroup::num_syncs() const {
+  std::lock_guard lock(mutex_);
+  return num_syncs_;
+}
+
+}  // namespace log
+}  // namespace yb
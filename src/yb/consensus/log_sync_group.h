@@ -0,0 +1,82 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "yb/consensus/log_fwd.h"
+
+#include "yb/util/status.h"
+
+namespace yb {
+
+class Env;
+
+namespace log {
+
+// Group commit of WAL fsyncs for all tablets having WAL on the same disk.
+//
+// With many tablets per server, each tablet log syncing its own segment results in a lot of small
+// random fsyncs queued behind each other. When log_sync_group_commit is enabled, logs on the same
+// WAL root sync through a shared LogSyncGroup instead: the first waiting log becomes the leader
+// for segments of all waiting logs.
+//
+// The leader starts writeback of all segments of the batch before any of them is waited for, so
+// the disk receives the writes of the batch together. When log_sync_group_use_syncfs is set, the
+// leader then syncs the whole file system once, and all logs of the batch just wait for it.
+// Otherwise each log syncs its own segment in its own thread, so segments of the batch are synced
+// in parallel, and each sync is cheap since its data is already being written.
+class LogSyncGroup {
+ public:
+  LogSyncGroup(Env* env, std::string path);
+
+  // Returns the sync group shared by all logs with WAL dirs under the same WAL root as wal_dir.
+  static std::shared_ptr<LogSyncGroup> ForWalDir(Env* env, const std::string& wal_dir);
+
+  // Makes data written to the segment durable.
+  Status Sync(WritableLogSegment* segment);
+
+  // Number of batches synced by this group.
+  uint64_t num_syncs() const;
+
+ private:
+  struct SyncRequest {
+    WritableLogSegment* segment = nullptr;
+    Status status;
+    bool done = false;
+    // Whether the segment should be synced by its log after the batch is done.
+    bool sync_segment = false;
+  };
+
+  // Starts writeback of segments of the batch and syncs the file system when enabled.
+  // Sets sync_segment for requests whose segments were not made durable by it.
+  void StartBatch(const std::vector<SyncRequest*>& batch);
+
+  Env* const env_;
+  const std::string path_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable cond_;
+  std::vector<SyncRequest*> pending_;
+  bool sync_in_progress_ = false;
+  bool syncfs_supported_ = true;
+  uint64_t num_syncs_ = 0;
+};
+
+}  // namespace log
+}  // namespace yb
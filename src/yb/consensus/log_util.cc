@@ -32,11 +32,19 @@
 
 #include "yb/consensus/log_util.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+
 #include <algorithm>
 #include <array>
 #include <limits>
 #include <utility>
 
+#include <lz4.h>
+#include <snappy.h>
+
+#include <boost/algorithm/string/predicate.hpp>
+
 #include "yb/common/hybrid_time.h"
 
 #include "yb/consensus/consensus.messages.h"
@@ -51,12 +59,14 @@
 #include "yb/gutil/strings/util.h"
 
 #include "yb/util/atomic.h"
+#include "yb/util/cast.h"
 #include "yb/util/coding-inl.h"
 #include "yb/util/coding.h"
 #include "yb/util/crc.h"
 #include "yb/util/debug-util.h"
 #include "yb/util/debug/trace_event.h"
 #include "yb/util/env_util.h"
+#include "yb/util/errno.h"
 #include "yb/util/flags.h"
 #include "yb/util/logging.h"
 #include "yb/util/pb_util.h"
@@ -120,6 +130,11 @@ DEFINE_RUNTIME_bool(save_index_into_wal_segments, false,
 TAG_FLAG(save_index_into_wal_segments, hidden);
 TAG_FLAG(save_index_into_wal_segments, advanced);
 
+DEFINE_RUNTIME_bool(log_segment_mmap_reads, false,
+    "Whether to read entries of closed WAL segments through a memory mapping of the segment file. "
+    "Entries are parsed directly from the mapping instead of being copied into a read buffer.");
+TAG_FLAG(log_segment_mmap_reads, advanced);
+
 namespace yb {
 namespace log {
 
@@ -181,6 +196,33 @@ Result<scoped_refptr<ReadableLogSegment>> ReadableLogSegment::Open(
   return segment;
 }
 
+Result<std::shared_ptr<LogSegmentMapping>> LogSegmentMapping::Open(
+    const std::string& path, size_t size) {
+  int fd;
+  do {
+    fd = open(path.c_str(), O_CLOEXEC | O_RDONLY);
+  } while (fd < 0 && errno == EINTR);
+  if (fd < 0) {
+    return STATUS(IOError, Format("Unable to open $0", path), Errno(errno));
+  }
+  auto* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  if (data == MAP_FAILED) {
+    auto status = STATUS(IOError, Format("Unable to mmap $0", path), Errno(errno));
+    close(fd);
+    return status;
+  }
+  return std::make_shared<LogSegmentMapping>(fd, static_cast<const uint8_t*>(data), size);
+}
+
+LogSegmentMapping::LogSegmentMapping(int fd, const uint8_t* data, size_t size)
+    : fd_(fd), data_(data), size_(size) {
+}
+
+LogSegmentMapping::~LogSegmentMapping() {
+  munmap(const_cast<uint8_t*>(data_), size_);
+  close(fd_);
+}
+
 ReadableLogSegment::ReadableLogSegment(
     std::string path, shared_ptr<RandomAccessFile> readable_file)
     : path_(std::move(path)),
@@ -882,12 +924,36 @@ Result<std::shared_ptr<LWLogEntryBatchPB>> ReadableLogSegment::ReadEntryHeaderAn
 }
 
 
+std::shared_ptr<LogSegmentMapping> ReadableLogSegment::GetMapping() {
+  if (!FLAGS_log_segment_mmap_reads || !IsInitialized() || !HasFooter() || footer_was_rebuilt_ ||
+      get_encryption_header_size() != 0) {
+    return nullptr;
+  }
+  std::lock_guard lock(mapping_mutex_);
+  if (mapping_ || mapping_failed_) {
+    return mapping_;
+  }
+  auto mapping = LogSegmentMapping::Open(path_, make_unsigned(file_size()));
+  if (!mapping.ok()) {
+    LOG(WARNING) << "Falling back to regular reads: " << mapping.status();
+    mapping_failed_ = true;
+    return nullptr;
+  }
+  mapping_ = std::move(*mapping);
+  return mapping_;
+}
+
 Status ReadableLogSegment::ReadEntryHeader(int64_t *offset, EntryHeader* header) {
   uint8_t scratch[kEntryHeaderSize];
   Slice slice;
-  RETURN_NOT_OK_PREPEND(ReadFully(readable_file().get(), *offset, kEntryHeaderSize,
-                                  &slice, scratch),
-                        "Could not read log entry header");
+  auto mapping = GetMapping();
+  if (mapping && make_unsigned(*offset) + kEntryHeaderSize <= mapping->data().size()) {
+    slice = Slice(mapping->data().data() + *offset, kEntryHeaderSize);
+  } else {
+    RETURN_NOT_OK_PREPEND(ReadFully(readable_file().get(), *offset, kEntryHeaderSize,
+                                    &slice, scratch),
+                          "Could not read log entry header");
+  }
 
   RETURN_NOT_OK(DecodeEntryHeader(slice, header));
   *offset += slice.size();
@@ -901,7 +967,7 @@ Status ReadableLogSegment::DecodeEntryHeader(const Slice& data, EntryHeader* hea
   header->header_crc = DecodeFixed32(data.data() + 8);
 
   // Verify the header.
-  uint32_t computed_crc = crc::Crc32c(data.data(), 8);
+  uint32_t computed_crc = crc::Crc32c(data.data(), 8) ^ header_.entry_header_salt();
   if (computed_crc != header->header_crc) {
     return STATUS_FORMAT(
         Corruption, "Invalid checksum in log entry head header: found=$0, computed=$1",
@@ -930,15 +996,23 @@ Result<std::shared_ptr<LWLogEntryBatchPB>> ReadableLogSegment::ReadEntryBatch(
                    header.msg_length, *offset, path_, limit));
   }
 
-  RefCntBuffer buffer(header.msg_length);
+  RefCntBuffer buffer;
   Slice entry_batch_slice;
+  Status s;
 
-  Status s = readable_file()->Read(*offset, header.msg_length, &entry_batch_slice, buffer.data());
-
-  if (!s.ok()) {
-    return STATUS_FORMAT(
-        IOError, "Could not read entry at offset: $0, length: $1. Cause: $2", *offset,
-        header.msg_length, s);
+  // Closed segments are parsed directly from the mapping, which is kept alive by the batch.
+  auto mapping = GetMapping();
+  if (mapping && make_unsigned(*offset) + header.msg_length <= mapping->data().size()) {
+    entry_batch_slice = Slice(mapping->data().data() + *offset, header.msg_length);
+  } else {
+    mapping = nullptr;
+    buffer = RefCntBuffer(header.msg_length);
+    s = readable_file()->Read(*offset, header.msg_length, &entry_batch_slice, buffer.data());
+    if (!s.ok()) {
+      return STATUS_FORMAT(
+          IOError, "Could not read entry at offset: $0, length: $1. Cause: $2", *offset,
+          header.msg_length, s);
+    }
   }
 
   // Verify the CRC.
@@ -950,17 +1024,31 @@ Result<std::shared_ptr<LWLogEntryBatchPB>> ReadableLogSegment::ReadEntryBatch(
                                          header.msg_crc, read_crc));
   }
 
+  if (header_.compression_type() != LogCompressionTypePB::NO_LOG_COMPRESSION) {
+    auto uncompressed = UncompressLogEntryBatch(header_.compression_type(), entry_batch_slice);
+    if (!uncompressed.ok()) {
+      return STATUS_FORMAT(
+          Corruption, "Failed to uncompress entry at offset: $0, length: $1. Cause: $2", *offset,
+          header.msg_length, uncompressed.status());
+    }
+    buffer = std::move(*uncompressed);
+    entry_batch_slice = buffer.AsSlice();
+    mapping = nullptr;
+  }
+
   // TODO(lw_uc) embed buffer and first arena block into holder itself.
   struct DataHolder {
     RefCntBuffer buffer;
+    std::shared_ptr<LogSegmentMapping> mapping;
     ThreadSafeArena arena;
 
-    explicit DataHolder(const RefCntBuffer& buffer_) : buffer(buffer_) {}
+    DataHolder(const RefCntBuffer& buffer_, std::shared_ptr<LogSegmentMapping> mapping_)
+        : buffer(buffer_), mapping(std::move(mapping_)) {}
   };
 
-  auto holder = std::make_shared<DataHolder>(buffer);
+  auto holder = std::make_shared<DataHolder>(buffer, std::move(mapping));
   auto batch = holder->arena.NewArenaObject<LWLogEntryBatchPB>();
-  s = batch->ParseFromSlice(entry_batch_slice.Prefix(header.msg_length));
+  s = batch->ParseFromSlice(entry_batch_slice);
 
   if (!s.ok()) {
     return STATUS_FORMAT(
@@ -968,7 +1056,7 @@ Result<std::shared_ptr<LWLogEntryBatchPB>> ReadableLogSegment::ReadEntryBatch(
         header.msg_length, s);
   }
 
-  *offset += entry_batch_slice.size();
+  *offset += header.msg_length;
   return rpc::SharedField(holder, batch);
 }
 
@@ -1109,9 +1197,15 @@ Status WritableLogSegment::WriteIndexWithFooterAndClose(
   return Status::OK();
 }
 
-Status WritableLogSegment::WriteEntryBatch(const Slice& data) {
+Status WritableLogSegment::WriteEntryBatch(const Slice& entry_batch_data) {
   DCHECK(is_header_written_);
   DCHECK(!is_footer_written_);
+  Slice data = entry_batch_data;
+  if (header_.compression_type() != LogCompressionTypePB::NO_LOG_COMPRESSION) {
+    RETURN_NOT_OK(CompressLogEntryBatch(
+        header_.compression_type(), entry_batch_data, &compression_buffer_));
+    data = Slice(compression_buffer_);
+  }
   uint8_t header_buf[kEntryHeaderSize];
 
   // First encode the length of the message.
@@ -1123,7 +1217,7 @@ Status WritableLogSegment::WriteEntryBatch(const Slice& data) {
   InlineEncodeFixed32(&header_buf[4], msg_crc);
 
   // Then the CRC of the header
-  uint32_t header_crc = crc::Crc32c(&header_buf, 8);
+  uint32_t header_crc = crc::Crc32c(&header_buf, 8) ^ header_.entry_header_salt();
   InlineEncodeFixed32(&header_buf[8], header_crc);
 
   std::array<Slice, 2> slices = {
@@ -1152,7 +1246,7 @@ Status WritableLogSegment::TEST_WriteCorruptedEntryBatchAndSync() {
   InlineEncodeFixed32(&header_buf[4], msg_crc);
 
   // Then the CRC of the header.
-  uint32_t header_crc = crc::Crc32c(&header_buf, 8);
+  uint32_t header_crc = crc::Crc32c(&header_buf, 8) ^ header_.entry_header_salt();
   InlineEncodeFixed32(&header_buf[8], header_crc);
 
   // Only append the header.
@@ -1203,6 +1297,10 @@ Status WritableLogSegment::Sync() {
   return writable_file_->Sync();
 }
 
+Status WritableLogSegment::FlushAsync() {
+  return writable_file_->Flush(WritableFile::FLUSH_ASYNC);
+}
+
 // Creates a LogEntryBatchPB from pre-allocated ReplicateMsgs managed using shared pointers. The
 // caller has to ensure these messages are not deleted twice, both by LogEntryBatchPB and by
 // the shared pointers.
@@ -1303,6 +1401,87 @@ void UpdateSegmentFooterIndexes(
   }
 }
 
+Result<LogCompressionTypePB> ParseLogCompressionType(const std::string& name) {
+  if (boost::iequals(name, "none")) {
+    return LogCompressionTypePB::NO_LOG_COMPRESSION;
+  }
+  if (boost::iequals(name, "lz4")) {
+    return LogCompressionTypePB::LZ4_LOG_COMPRESSION;
+  }
+  if (boost::iequals(name, "snappy")) {
+    return LogCompressionTypePB::SNAPPY_LOG_COMPRESSION;
+  }
+  return STATUS_FORMAT(InvalidArgument, "Unknown log compression type: $0", name);
+}
+
+Status CompressLogEntryBatch(
+    LogCompressionTypePB compression_type, const Slice& data, faststring* out) {
+  out->clear();
+  PutFixed32(out, narrow_cast<uint32_t>(data.size()));
+  const auto prefix_size = out->size();
+  switch (compression_type) {
+    case LogCompressionTypePB::LZ4_LOG_COMPRESSION: {
+      const auto input_size = narrow_cast<int>(data.size());
+      out->resize(prefix_size + LZ4_compressBound(input_size));
+      auto compressed_size = LZ4_compress_default(
+          data.cdata(), pointer_cast<char*>(out->data() + prefix_size), input_size,
+          narrow_cast<int>(out->size() - prefix_size));
+      if (compressed_size <= 0) {
+        return STATUS_FORMAT(RuntimeError, "LZ4 compression of $0 bytes failed", data.size());
+      }
+      out->resize(prefix_size + compressed_size);
+      return Status::OK();
+    }
+    case LogCompressionTypePB::SNAPPY_LOG_COMPRESSION: {
+      out->resize(prefix_size + snappy::MaxCompressedLength(data.size()));
+      size_t compressed_size = 0;
+      snappy::RawCompress(
+          data.cdata(), data.size(), pointer_cast<char*>(out->data() + prefix_size),
+          &compressed_size);
+      out->resize(prefix_size + compressed_size);
+      return Status::OK();
+    }
+    case LogCompressionTypePB::NO_LOG_COMPRESSION:
+      break;
+  }
+  return STATUS_FORMAT(InvalidArgument, "Unexpected log compression type: $0", compression_type);
+}
+
+Result<RefCntBuffer> UncompressLogEntryBatch(
+    LogCompressionTypePB compression_type, const Slice& data) {
+  if (data.size() < sizeof(uint32_t)) {
+    return STATUS_FORMAT(Corruption, "Compressed entry batch is too short: $0", data.size());
+  }
+  const auto uncompressed_size = DecodeFixed32(data.data());
+  const auto compressed = data.WithoutPrefix(sizeof(uint32_t));
+  RefCntBuffer result(uncompressed_size);
+  switch (compression_type) {
+    case LogCompressionTypePB::LZ4_LOG_COMPRESSION: {
+      auto size = LZ4_decompress_safe(
+          compressed.cdata(), result.data(), narrow_cast<int>(compressed.size()),
+          narrow_cast<int>(uncompressed_size));
+      if (size < 0 || static_cast<size_t>(size) != uncompressed_size) {
+        return STATUS_FORMAT(
+            Corruption, "LZ4 decompression failed: $0, expected size: $1", size,
+            uncompressed_size);
+      }
+      return result;
+    }
+    case LogCompressionTypePB::SNAPPY_LOG_COMPRESSION: {
+      size_t size = 0;
+      if (!snappy::GetUncompressedLength(compressed.cdata(), compressed.size(), &size) ||
+          size != uncompressed_size ||
+          !snappy::RawUncompress(compressed.cdata(), compressed.size(), result.data())) {
+        return STATUS(Corruption, "Snappy decompression failed");
+      }
+      return result;
+    }
+    case LogCompressionTypePB::NO_LOG_COMPRESSION:
+      break;
+  }
+  return STATUS_FORMAT(InvalidArgument, "Unexpected log compression type: $0", compression_type);
+}
+
 
 }  // namespace log
 }  // namespace yb
@@ -35,6 +35,7 @@
 #include <iosfwd>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -48,11 +49,13 @@
 
 #include "yb/gutil/macros.h"
 #include "yb/gutil/ref_counted.h"
+#include "yb/gutil/thread_annotations.h"
 
 #include "yb/util/compare_util.h"
 #include "yb/util/env.h"
 #include "yb/util/monotime.h"
 #include "yb/util/opid.h"
+#include "yb/util/ref_cnt_buffer.h"
 #include "yb/util/restart_safe_clock.h"
 #include "yb/util/status.h"
 #include "yb/util/tostring.h"
@@ -157,6 +160,28 @@ struct FirstEntryMetadata {
 
 YB_DEFINE_ENUM(EntriesToRead, (kAll)(kReplicate));
 
+// Read only memory mapping of a closed log segment file.
+// Closed segments are immutable, so slices of the mapping could be used to parse entries and to
+// send segment data without copying it into intermediate buffers.
+class LogSegmentMapping {
+ public:
+  static Result<std::shared_ptr<LogSegmentMapping>> Open(const std::string& path, size_t size);
+
+  LogSegmentMapping(int fd, const uint8_t* data, size_t size);
+  ~LogSegmentMapping();
+
+  Slice data() const {
+    return Slice(data_, size_);
+  }
+
+ private:
+  const int fd_;
+  const uint8_t* const data_;
+  const size_t size_;
+
+  DISALLOW_COPY_AND_ASSIGN(LogSegmentMapping);
+};
+
 // A segment of the log can either be a ReadableLogSegment (for replay and
 // consensus catch-up) or a WritableLogSegment (where the Log actually stores
 // state). LogSegments have a maximum size defined in LogOptions (set from the
@@ -297,6 +322,10 @@ class ReadableLogSegment : public RefCountedThreadSafe<ReadableLogSegment> {
     return footer_was_rebuilt_;
   }
 
+  // Returns memory mapping of this segment when it is closed, not encrypted and reads via mmap
+  // are enabled, nullptr otherwise. The mapping is created on first use.
+  std::shared_ptr<LogSegmentMapping> GetMapping();
+
  private:
   friend class RefCountedThreadSafe<ReadableLogSegment>;
   friend class LogReader;
@@ -396,6 +425,10 @@ class ReadableLogSegment : public RefCountedThreadSafe<ReadableLogSegment> {
   // the offset of the first entry in the log.
   int64_t first_entry_offset_;
 
+  std::mutex mapping_mutex_;
+  std::shared_ptr<LogSegmentMapping> mapping_ GUARDED_BY(mapping_mutex_);
+  bool mapping_failed_ GUARDED_BY(mapping_mutex_) = false;
+
   DISALLOW_COPY_AND_ASSIGN(ReadableLogSegment);
 };
 
@@ -438,6 +471,10 @@ class WritableLogSegment {
   // Makes sure the I/O buffers in the underlying writable file are flushed.
   Status Sync();
 
+  // Starts writing out data of the underlying writable file, without waiting for it to become
+  // durable.
+  Status FlushAsync();
+
   // Returns true if the segment header has already been written to disk.
   bool IsHeaderWritten() const {
     return is_header_written_;
@@ -508,6 +545,9 @@ class WritableLogSegment {
 
   faststring index_block_header_buffer_;
 
+  // Buffer for compressed entry batches.
+  faststring compression_buffer_;
+
   DISALLOW_COPY_AND_ASSIGN(WritableLogSegment);
 };
 
@@ -531,5 +571,16 @@ Status ModifyDurableWriteFlagIfNotODirect();
 void UpdateSegmentFooterIndexes(
     const consensus::LWReplicateMsg& replicate, LogSegmentFooterPB* footer);
 
+// Parses compression type name: none, lz4 or snappy.
+Result<LogCompressionTypePB> ParseLogCompressionType(const std::string& name);
+
+// Converts entry batch data to the form stored in segments with the specified compression.
+Status CompressLogEntryBatch(
+    LogCompressionTypePB compression_type, const Slice& data, faststring* out);
+
+// Restores entry batch data converted by CompressLogEntryBatch.
+Result<RefCntBuffer> UncompressLogEntryBatch(
+    LogCompressionTypePB compression_type, const Slice& data);
+
 }  // namespace log
 }  // namespace yb
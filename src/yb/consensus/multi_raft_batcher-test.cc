@@ -0,0 +1,168 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+
+#include <deque>
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "yb/consensus/consensus.pb.h"
+#include "yb/consensus/multi_raft_batcher.h"
+
+#include "yb/rpc/messenger.h"
+#include "yb/rpc/proxy.h"
+
+#include "yb/util/flags.h"
+#include "yb/util/test_macros.h"
+#include "yb/util/test_util.h"
+
+DECLARE_uint64(multi_raft_heartbeat_interval_ms);
+
+namespace yb {
+namespace consensus {
+
+namespace {
+
+struct TestRequest {
+  ConsensusRequestPB req;
+  ConsensusResponsePB resp;
+  std::optional<Status> status;
+};
+
+struct SentBatch {
+  std::vector<std::string> tablet_ids;
+  MultiRaftConsensusResponsePB* resp;
+  rpc::ResponseCallback callback;
+};
+
+} // namespace
+
+class MultiRaftBatcherTest : public YBTest {
+ protected:
+  void SetUp() override {
+    YBTest::SetUp();
+    // Batches should only be sent by requests and batch completions.
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_multi_raft_heartbeat_interval_ms) = 3600 * 1000;
+    messenger_ = ASSERT_RESULT(rpc::MessengerBuilder("test").Build());
+    proxy_cache_ = std::make_unique<rpc::ProxyCache>(messenger_.get());
+    batcher_ = std::make_shared<MultiRaftHeartbeatBatcher>(
+        HostPort("127.0.0.1", 12345), proxy_cache_.get(), messenger_.get(), &running_calls_);
+    batcher_->TEST_SetBatchSender([this](
+        const MultiRaftConsensusRequestPB& req, MultiRaftConsensusResponsePB* resp,
+        rpc::RpcController*, rpc::ResponseCallback callback) {
+      SentBatch batch { .resp = resp, .callback = std::move(callback) };
+      for (const auto& consensus_req : req.consensus_request()) {
+        batch.tablet_ids.push_back(consensus_req.tablet_id());
+      }
+      sent_.push_back(std::move(batch));
+    });
+    batcher_->Start();
+  }
+
+  void TearDown() override {
+    batcher_.reset();
+    messenger_->Shutdown();
+    YBTest::TearDown();
+  }
+
+  TestRequest* Add(const std::string& tablet_id, MultiRaftRequestKind kind) {
+    auto& request = requests_.emplace_back();
+    request.req.set_tablet_id(tablet_id);
+    request.req.set_caller_uuid("caller");
+    batcher_->AddRequestToBatch(
+        &request.req, &request.resp, [&request](const Status& status) {
+          request.status = status;
+        }, kind);
+    return &request;
+  }
+
+  // Responds to the batch with the specified index, each response carries its tablet id.
+  void Complete(size_t idx) {
+    auto& batch = sent_[idx];
+    for (const auto& tablet_id : batch.tablet_ids) {
+      batch.resp->add_consensus_response()->set_responder_uuid(tablet_id);
+    }
+    // Completion could send the next batch, so don't hold a reference into sent_.
+    auto callback = std::move(batch.callback);
+    callback();
+  }
+
+  static void CheckCompleted(const TestRequest& request) {
+    ASSERT_TRUE(request.status.has_value()) << request.req.tablet_id();
+    ASSERT_OK(*request.status);
+    ASSERT_EQ(request.resp.responder_uuid(), request.req.tablet_id());
+  }
+
+  std::unique_ptr<rpc::Messenger> messenger_;
+  std::unique_ptr<rpc::ProxyCache> proxy_cache_;
+  std::atomic<int> running_calls_{0};
+  std::shared_ptr<MultiRaftHeartbeatBatcher> batcher_;
+  std::deque<TestRequest> requests_;
+  std::deque<SentBatch> sent_;
+};
+
+TEST_F(MultiRaftBatcherTest, UpdatesWaitForInFlightBatch) {
+  using Kind = MultiRaftRequestKind;
+
+  // Nothing is in flight, so the update is sent right away.
+  auto* a = Add("a", Kind::kUpdate);
+  ASSERT_EQ(sent_.size(), 1U);
+  ASSERT_EQ(sent_[0].tablet_ids, std::vector<std::string>({"a"}));
+  ASSERT_EQ(running_calls_.load(), 1);
+
+  // Requests added while the batch is in flight are held in the next batch.
+  auto* b = Add("b", Kind::kUpdate);
+  auto* c = Add("c", Kind::kUpdate);
+  auto* h = Add("h", Kind::kHeartbeat);
+  ASSERT_EQ(sent_.size(), 1U);
+  ASSERT_FALSE(b->status.has_value());
+
+  // Completion of the in flight batch sends the held updates together with the heartbeat.
+  Complete(0);
+  ASSERT_NO_FATALS(CheckCompleted(*a));
+  ASSERT_EQ(sent_.size(), 2U);
+  ASSERT_EQ(sent_[1].tablet_ids, std::vector<std::string>({"b", "c", "h"}));
+  ASSERT_EQ(running_calls_.load(), 1);
+
+  // Heartbeat alone waits for the timer.
+  auto* h2 = Add("h2", Kind::kHeartbeat);
+  ASSERT_EQ(sent_.size(), 2U);
+
+  // Completion does not send a batch without updates.
+  Complete(1);
+  for (auto* request : {b, c, h}) {
+    ASSERT_NO_FATALS(CheckCompleted(*request));
+  }
+  ASSERT_EQ(sent_.size(), 2U);
+  ASSERT_EQ(running_calls_.load(), 0);
+  ASSERT_FALSE(h2->status.has_value());
+
+  // Nothing is in flight again, so the update is sent right away, taking the heartbeat with it.
+  auto* d = Add("d", Kind::kUpdate);
+  ASSERT_EQ(sent_.size(), 3U);
+  ASSERT_EQ(sent_[2].tablet_ids, std::vector<std::string>({"h2", "d"}));
+  Complete(2);
+  ASSERT_NO_FATALS(CheckCompleted(*h2));
+  ASSERT_NO_FATALS(CheckCompleted(*d));
+  ASSERT_EQ(sent_.size(), 3U);
+  ASSERT_EQ(running_calls_.load(), 0);
+
+  // Requests that were not sent are aborted by shutdown.
+  auto* h3 = Add("h3", Kind::kHeartbeat);
+  batcher_->Shutdown();
+  ASSERT_TRUE(h3->status.has_value());
+  ASSERT_TRUE(h3->status->IsAborted()) << *h3->status;
+  ASSERT_EQ(sent_.size(), 3U);
+}
+
+} // namespace consensus
+} // namespace yb
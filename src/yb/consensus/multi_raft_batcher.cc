@@ -22,6 +22,7 @@
 #include "yb/rpc/periodic.h"
 
 #include "yb/util/flags.h"
+#include "yb/util/size_literals.h"
 
 using namespace std::literals;
 using namespace std::placeholders;
@@ -37,6 +38,13 @@ DEFINE_UNKNOWN_uint64(multi_raft_batch_size, 0,
               "Maximum batch size for a multi-Raft consensus payload. Ignored if set to zero.");
 TAG_FLAG(multi_raft_batch_size, advanced);
 
+DEFINE_RUNTIME_bool(multi_raft_batch_update_consensus, false,
+    "If true and multi-Raft batching is enabled, also batch update consensus requests with ops, "
+    "whose size does not exceed multi_raft_max_batched_request_bytes.");
+
+DEFINE_RUNTIME_uint64(multi_raft_max_batched_request_bytes, 16_KB,
+    "Max size of update consensus request with ops, that could be added to a multi-Raft batch.");
+
 DECLARE_int32(consensus_rpc_timeout_ms);
 
 namespace yb {
@@ -59,6 +67,8 @@ struct MultiRaftHeartbeatBatcher::MultiRaftConsensusData {
   MultiRaftConsensusResponsePB batch_res;
   rpc::RpcController controller;
   std::vector<ResponseCallbackData> response_callback_data;
+  // Whether the batch contains update requests with ops, that should not wait for the timer.
+  bool has_updates = false;
 };
 
 MultiRaftHeartbeatBatcher::MultiRaftHeartbeatBatcher(
@@ -92,7 +102,8 @@ MultiRaftHeartbeatBatcher::~MultiRaftHeartbeatBatcher() {
 
 void MultiRaftHeartbeatBatcher::AddRequestToBatch(ConsensusRequestPB* request,
                                                   ConsensusResponsePB* response,
-                                                  HeartbeatResponseCallback callback) {
+                                                  HeartbeatResponseCallback callback,
+                                                  MultiRaftRequestKind kind) {
   std::shared_ptr<MultiRaftConsensusData> data = nullptr;
   {
     std::lock_guard lock(mutex_);
@@ -102,8 +113,12 @@ void MultiRaftHeartbeatBatcher::AddRequestToBatch(ConsensusRequestPB* request,
     });
     // Add a ConsensusRequestPB to the batch
     current_batch_->batch_req.add_consensus_request()->Swap(request);
-    if (FLAGS_multi_raft_batch_size > 0
-        && current_batch_->response_callback_data.size() >= FLAGS_multi_raft_batch_size) {
+    if (kind == MultiRaftRequestKind::kUpdate) {
+      current_batch_->has_updates = true;
+    }
+    if ((FLAGS_multi_raft_batch_size > 0
+         && current_batch_->response_callback_data.size() >= FLAGS_multi_raft_batch_size) ||
+        (current_batch_->has_updates && batches_in_flight_ == 0)) {
       data = PrepareNextBatchRequest();
     }
   }
@@ -127,21 +142,37 @@ std::shared_ptr<MultiRaftHeartbeatBatcher::MultiRaftConsensusData>
   batch_sender_->Snooze();
   auto data = std::make_shared<MultiRaftConsensusData>();
   current_batch_.swap(data);
+  ++batches_in_flight_;
   auto running_calls = ++*running_calls_;
   LOG_IF(DFATAL, running_calls <= 0) << "Wrong number or running calls: " << running_calls;
   return data;
 }
 
+void MultiRaftHeartbeatBatcher::BatchCompleted() {
+  std::shared_ptr<MultiRaftConsensusData> data;
+  {
+    std::lock_guard lock(mutex_);
+    --batches_in_flight_;
+    if (current_batch_ && current_batch_->has_updates) {
+      data = PrepareNextBatchRequest();
+    }
+  }
+  SendBatchRequest(data);
+}
+
 void MultiRaftHeartbeatBatcher::SendBatchRequest(std::shared_ptr<MultiRaftConsensusData> data) {
   if (!data) {
     return;
   }
 
   data->controller.Reset();
+  if (data->has_updates) {
+    // Processing responses to update requests could block, so don't do it on the reactor thread.
+    data->controller.set_invoke_callback_mode(rpc::InvokeCallbackMode::kThreadPoolHigh);
+  }
   data->controller.set_timeout(MonoDelta::FromMilliseconds(
       FLAGS_consensus_rpc_timeout_ms * data->batch_req.consensus_request_size()));
-  auto callback = [data, running_calls = running_calls_]() {
-    --*running_calls;
+  auto callback = [data, running_calls = running_calls_, weak_self = weak_from_this()]() {
     auto status = data->controller.status();
     for (int i = 0; i < data->batch_req.consensus_request_size(); i++) {
       auto callback_data = data->response_callback_data[i];
@@ -150,7 +181,15 @@ void MultiRaftHeartbeatBatcher::SendBatchRequest(std::shared_ptr<MultiRaftConsen
       }
       callback_data.callback(status);
     }
+    if (auto self = weak_self.lock()) {
+      self->BatchCompleted();
+    }
+    --*running_calls;
   };
+  if (PREDICT_FALSE(test_batch_sender_)) {
+    test_batch_sender_(data->batch_req, &data->batch_res, &data->controller, callback);
+    return;
+  }
   consensus_proxy_->MultiRaftUpdateConsensusAsync(
       data->batch_req, &data->batch_res, &data->controller, callback);
 }
@@ -20,6 +20,7 @@
 
 #include "yb/rpc/rpc_controller.h"
 
+#include "yb/util/enums.h"
 #include "yb/util/net/net_util.h"
 
 namespace yb {
@@ -33,6 +34,13 @@ namespace consensus {
 
 using HeartbeatResponseCallback = std::function<void(const Status&)>;
 
+YB_DEFINE_ENUM(MultiRaftRequestKind, (kHeartbeat)(kUpdate));
+
+// Sends a batch request, invoking the callback when the call completes.
+using MultiRaftBatchSender = std::function<void(
+    const MultiRaftConsensusRequestPB&, MultiRaftConsensusResponsePB*, rpc::RpcController*,
+    rpc::ResponseCallback)>;
+
 // - MultiRaftHeartbeatBatcher is responsible for the batching of heartbeats
 //   among peers that are communicating with remote peers at the same tserver
 // - It is also responsible for periodically sending out these batched requests
@@ -40,6 +48,10 @@ using HeartbeatResponseCallback = std::function<void(const Status&)>;
 // - A heartbeat is added to a batch upon calling AddRequestToBatch and a batch is sent
 //   out every FLAGS_multi_raft_heartbeat_interval_ms ms or once the batch size reaches
 //   FLAGS_multi_raft_batch_size
+// - Small update requests with ops are also batched when FLAGS_multi_raft_batch_update_consensus
+//   is set. To avoid adding latency, a batch containing update requests is sent right away when
+//   no batch is in flight, otherwise it is sent as soon as the in flight batch completes. So
+//   batches grow with load and round trip time, and are not delayed at low load
 // - To improve efficency multiple batches may be processed concurrently
 //   but only a single batch is being built at any given time
 class MultiRaftHeartbeatBatcher : public std::enable_shared_from_this<MultiRaftHeartbeatBatcher> {
@@ -60,10 +72,16 @@ class MultiRaftHeartbeatBatcher : public std::enable_shared_from_this<MultiRaftH
   // executed with an error status.
   void AddRequestToBatch(ConsensusRequestPB* request,
                          ConsensusResponsePB* response,
-                         HeartbeatResponseCallback callback);
+                         HeartbeatResponseCallback callback,
+                         MultiRaftRequestKind kind = MultiRaftRequestKind::kHeartbeat);
 
   void Shutdown();
 
+  // Replaces sending batches via the consensus proxy, should be called before adding requests.
+  void TEST_SetBatchSender(MultiRaftBatchSender sender) {
+    test_batch_sender_ = std::move(sender);
+  }
+
  private:
   // Tracks all the metadata for a single batch request, including a list of all
   // ResponseCallbackData registered by each local peer with this batch in AddRequestToBatch().
@@ -79,6 +97,9 @@ class MultiRaftHeartbeatBatcher : public std::enable_shared_from_this<MultiRaftH
 
   void MultiRaftUpdateHeartbeatResponseCallback(std::shared_ptr<MultiRaftConsensusData> data);
 
+  // Invoked when a batch sent by this batcher completes, sends pending update requests if any.
+  void BatchCompleted();
+
   rpc::Messenger* messenger_;
 
   ConsensusServiceProxyPtr consensus_proxy_;
@@ -89,7 +110,12 @@ class MultiRaftHeartbeatBatcher : public std::enable_shared_from_this<MultiRaftH
 
   std::shared_ptr<MultiRaftConsensusData> current_batch_ GUARDED_BY(mutex_);
 
+  // Number of batches sent by this batcher, that did not complete yet.
+  size_t batches_in_flight_ GUARDED_BY(mutex_) = 0;
+
   std::atomic<int>* running_calls_;
+
+  MultiRaftBatchSender test_batch_sender_;
 };
 
 // MultiRaftManager is responsible for managing all MultiRaftHeartbeatBatchers
@@ -243,6 +243,11 @@ DEFINE_UNKNOWN_bool(
 TAG_FLAG(raft_disallow_concurrent_outstanding_report_failure_tasks, advanced);
 TAG_FLAG(raft_disallow_concurrent_outstanding_report_failure_tasks, hidden);
 
+DEFINE_RUNTIME_bool(raft_fast_failover_on_peer_crash, true,
+    "Start leader election right away when the master reports that the tablet server of the "
+    "current leader was restarted, instead of waiting for missed heartbeats.");
+TAG_FLAG(raft_fast_failover_on_peer_crash, advanced);
+
 DEFINE_UNKNOWN_int64(protege_synchronization_timeout_ms, 1000,
              "Timeout to synchronize protege before performing step down. "
              "0 to disable synchronization.");
@@ -425,6 +430,7 @@ RaftConsensus::RaftConsensus(
       queue_(std::move(queue)),
       rng_(GetRandomSeed32()),
       withhold_votes_until_(MonoTime::Min()),
+      last_leader_update_at_(MonoTime::Min()),
       step_down_check_tracker_(&peer_proxy_factory_->messenger()->scheduler()),
       mark_dirty_clbk_(std::move(mark_dirty_clbk)),
       shutdown_(false),
@@ -1048,6 +1054,38 @@ void RaftConsensus::ReportFailureDetectedTask() {
   }
 }
 
+void RaftConsensus::HandlePeerCrash(const std::string& crashed_uuid, MonoTime restart_seen_at) {
+  if (!GetAtomicFlag(&FLAGS_raft_fast_failover_on_peer_crash) || crashed_uuid == peer_uuid()) {
+    return;
+  }
+
+  auto lock = state_->LockForRead();
+  if (state_->GetLeaderUuidUnlocked() != crashed_uuid) {
+    return;
+  }
+  // The master reports the restart with a delay, so the restarted process could already be
+  // elected and send us updates. The crashed process stopped sending updates at least one
+  // heartbeat interval before its restart was seen.
+  auto last_leader_update_at = last_leader_update_at_.load(std::memory_order_acquire);
+  if (last_leader_update_at + FLAGS_raft_heartbeat_interval_ms * 1ms >= restart_seen_at) {
+    LOG_WITH_PREFIX(INFO)
+        << "Leader " << crashed_uuid << " was restarted, but sent update "
+        << MonoTime::Now() - last_leader_update_at << " ago, ignoring";
+    return;
+  }
+  // Other followers receive the same report, so they would not reject our votes because of the
+  // recent heartbeats from the crashed leader.
+  withhold_votes_until_.store(MonoTime::Min(), std::memory_order_release);
+  if (state_->GetActiveRoleUnlocked() != PeerRole::FOLLOWER) {
+    return;
+  }
+  // All followers learn about the crash at about the same time, so random delay is used to avoid
+  // split votes.
+  auto delay = MonoDelta::FromMilliseconds(rng_.Uniform(FLAGS_raft_heartbeat_interval_ms));
+  LOG_WITH_PREFIX(INFO) << "Leader " << crashed_uuid << " crashed, starting election in " << delay;
+  SnoozeFailureDetector(DO_NOT_LOG, delay);
+}
+
 void RaftConsensus::ReportFailureDetected() {
   if (FLAGS_raft_disallow_concurrent_outstanding_report_failure_tasks &&
       outstanding_report_failure_task_.exchange(true, std::memory_order_acq_rel)) {
@@ -1985,6 +2023,7 @@ Result<RaftConsensus::UpdateReplicaResult> RaftConsensus::UpdateReplica(
 
   // Also prohibit voting for anyone for the minimum election timeout.
   withhold_votes_until_.store(now + MinimumElectionTimeout(), std::memory_order_release);
+  last_leader_update_at_.store(now, std::memory_order_release);
 
   // 1 - Early commit pending (and committed) operations
   RETURN_NOT_OK(EarlyCommitUnlocked(request, deduped_req));
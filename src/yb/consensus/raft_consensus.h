@@ -158,6 +158,16 @@ class RaftConsensus : public std::enable_shared_from_this<RaftConsensus>,
   Status StepDown(const LeaderStepDownRequestPB* req,
                   LeaderStepDownResponsePB* resp) override;
 
+  // Called when the peer crashed_uuid is known to have crashed, i.e. its process was restarted.
+  // restart_seen_at is the time when the restart was first seen.
+  // If it is our leader, we start an election without waiting for the failure detector
+  // and stop withholding votes for it.
+  // Nothing is done if the leader sent us an update since the restart was seen, or shortly before,
+  // since then it is the restarted process that is our leader.
+  // The lease of the old leader is not revoked, since the restarted peer could already be elected
+  // again. The new leader still waits only for the remaining old lease reported by voters.
+  void HandlePeerCrash(const std::string& crashed_uuid, MonoTime restart_seen_at);
+
   Status TEST_Replicate(const ConsensusRoundPtr& round) override;
   Status ReplicateBatch(const ConsensusRounds& rounds) override;
 
@@ -692,6 +702,9 @@ class RaftConsensus : public std::enable_shared_from_this<RaftConsensus>,
   // nodes from disturbing the healthy leader.
   std::atomic<MonoTime> withhold_votes_until_;
 
+  // Time of the last update accepted from the leader.
+  std::atomic<MonoTime> last_leader_update_at_;
+
   // UUID of new desired leader during stepdown.
   TabletServerId protege_leader_uuid_;
 
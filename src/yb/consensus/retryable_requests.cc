@@ -13,16 +13,16 @@
 
 #include "yb/consensus/retryable_requests.h"
 
-#include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index_container.hpp>
+#include <algorithm>
+#include <vector>
 
 #include "yb/consensus/consensus.messages.h"
 #include "yb/consensus/consensus_round.h"
 #include "yb/consensus/consensus.pb.h"
 #include "yb/consensus/opid_util.h"
 
+#include "yb/gutil/casts.h"
+
 #include "yb/server/clock.h"
 
 #include "yb/tablet/operations.pb.h"
@@ -73,7 +73,7 @@ namespace {
 struct RunningRetryableRequest {
   RetryableRequestId request_id;
   RestartSafeCoarseTimePoint time;
-  mutable std::vector<ConsensusRoundPtr> duplicate_rounds;
+  std::vector<ConsensusRoundPtr> duplicate_rounds;
 
   RunningRetryableRequest(
       RetryableRequestId request_id_, RestartSafeCoarseTimePoint time_)
@@ -85,11 +85,11 @@ struct RunningRetryableRequest {
 };
 
 struct ReplicatedRetryableRequestRange {
-  mutable RetryableRequestId first_id;
+  RetryableRequestId first_id;
   RetryableRequestId last_id;
   OpId min_op_id;
-  mutable RestartSafeCoarseTimePoint min_time;
-  mutable RestartSafeCoarseTimePoint max_time;
+  RestartSafeCoarseTimePoint min_time;
+  RestartSafeCoarseTimePoint max_time;
 
   ReplicatedRetryableRequestRange(RetryableRequestId id_,
                                   const OpId& op_id_,
@@ -105,14 +105,19 @@ struct ReplicatedRetryableRequestRange {
       : first_id(first_id_), last_id(last_id_), min_op_id(min_op_id_), min_time(min_time_),
         max_time(max_time_) {}
 
-  void InsertTime(const RestartSafeCoarseTimePoint& time) const {
+  void InsertTime(const RestartSafeCoarseTimePoint& time) {
     min_time = std::min(min_time, time);
     max_time = std::max(max_time, time);
   }
 
-  void PrepareJoinWithPrev(const ReplicatedRetryableRequestRange& prev) const {
+  void InsertOpId(const OpId& op_id) {
+    min_op_id = std::min(min_op_id, op_id);
+  }
+
+  void PrepareJoinWithPrev(const ReplicatedRetryableRequestRange& prev) {
     min_time = std::min(min_time, prev.min_time);
     max_time = std::max(max_time, prev.max_time);
+    min_op_id = std::min(min_op_id, prev.min_op_id);
     first_id = prev.first_id;
   }
 
@@ -122,67 +127,59 @@ struct ReplicatedRetryableRequestRange {
   }
 };
 
-struct LastIdIndex;
-struct OpIdIndex;
-struct RequestIdIndex;
-
-typedef boost::multi_index_container <
-    RunningRetryableRequest,
-    boost::multi_index::indexed_by <
-        boost::multi_index::hashed_unique <
-            boost::multi_index::tag<RequestIdIndex>,
-            boost::multi_index::member <
-                RunningRetryableRequest, RetryableRequestId, &RunningRetryableRequest::request_id
-            >
-        >
-    >,
-    MemTrackerAllocator<RunningRetryableRequest>
-> RunningRetryableRequests;
-
-typedef boost::multi_index_container <
-    ReplicatedRetryableRequestRange,
-    boost::multi_index::indexed_by <
-        boost::multi_index::ordered_unique <
-            boost::multi_index::tag<LastIdIndex>,
-            boost::multi_index::member <
-                ReplicatedRetryableRequestRange, RetryableRequestId,
-                &ReplicatedRetryableRequestRange::last_id
-            >
-        >,
-        boost::multi_index::ordered_unique <
-            boost::multi_index::tag<OpIdIndex>,
-            boost::multi_index::member <
-                ReplicatedRetryableRequestRange, yb::OpId,
-                &ReplicatedRetryableRequestRange::min_op_id
-            >
-        >
-    >,
-    MemTrackerAllocator<ReplicatedRetryableRequestRange>
-> ReplicatedRetryableRequestRanges;
-
-typedef ReplicatedRetryableRequestRanges::index<LastIdIndex>::type
-    ReplicatedRetryableRequestRangesByLastId;
+// Requests of a single client are kept in flat vectors, that are sorted by request id. A client
+// usually has a few running requests and a few replicated ranges, so binary search over a vector
+// is cheaper than node based containers, and a client without requests does not allocate memory.
+using RunningRetryableRequests =
+    std::vector<RunningRetryableRequest, MemTrackerAllocator<RunningRetryableRequest>>;
+
+// Ranges do not overlap, so they are sorted by both first and last id.
+using ReplicatedRetryableRequestRanges = std::vector<
+    ReplicatedRetryableRequestRange, MemTrackerAllocator<ReplicatedRetryableRequestRange>>;
+
+// Returns the first running request with id >= request_id.
+RunningRetryableRequests::iterator RunningLowerBound(
+    RunningRetryableRequests* running, RetryableRequestId request_id) {
+  return std::lower_bound(
+      running->begin(), running->end(), request_id,
+      [](const RunningRetryableRequest& lhs, RetryableRequestId rhs) {
+    return lhs.request_id < rhs;
+  });
+}
+
+RunningRetryableRequests::iterator FindRunning(
+    RunningRetryableRequests* running, RetryableRequestId request_id) {
+  auto it = RunningLowerBound(running, request_id);
+  return it != running->end() && it->request_id == request_id ? it : running->end();
+}
+
+// Returns the first replicated range with last_id >= request_id.
+ReplicatedRetryableRequestRanges::iterator ReplicatedLowerBound(
+    ReplicatedRetryableRequestRanges* replicated, RetryableRequestId request_id) {
+  return std::lower_bound(
+      replicated->begin(), replicated->end(), request_id,
+      [](const ReplicatedRetryableRequestRange& lhs, RetryableRequestId rhs) {
+    return lhs.last_id < rhs;
+  });
+}
+
+// Releases memory of vectors that became much smaller than their capacity.
+template <class Container>
+void MaybeShrink(Container* container) {
+  if (container->capacity() > 4 && container->size() * 4 < container->capacity()) {
+    container->shrink_to_fit();
+  }
+}
 
 struct ClientRetryableRequests {
-  std::unique_ptr<RunningRetryableRequests> running;
-  std::unique_ptr<ReplicatedRetryableRequestRanges> replicated;
+  RunningRetryableRequests running;
+  ReplicatedRetryableRequestRanges replicated;
   RetryableRequestId min_running_request_id = 0;
   RestartSafeCoarseTimePoint empty_since;
 
   explicit ClientRetryableRequests(const MemTrackerPtr& mem_tracker)
-      : running(std::make_unique<RunningRetryableRequests>(
-            RunningRetryableRequests::ctor_args_list(),
-            MemTrackerAllocator<RunningRetryableRequest>(mem_tracker))),
-        replicated(std::make_unique<ReplicatedRetryableRequestRanges>(
-            ReplicatedRetryableRequestRanges::ctor_args_list(),
-            MemTrackerAllocator<ReplicatedRetryableRequestRange>(mem_tracker))) {
-  }
-
-  ClientRetryableRequests(const ClientRetryableRequests& c)
-      : running(new RunningRetryableRequests(*c.running)),
-        replicated(new ReplicatedRetryableRequestRanges(*c.replicated)),
-        min_running_request_id(c.min_running_request_id),
-        empty_since(c.empty_since) {
+      : running(MemTrackerAllocator<RunningRetryableRequest>(mem_tracker)),
+        replicated(MemTrackerAllocator<ReplicatedRetryableRequestRange>(mem_tracker)) {
   }
 };
 
@@ -400,21 +397,31 @@ class RetryableRequests::Impl {
     running_requests_gauge_ = rhs.running_requests_gauge_;
     replicated_request_ranges_gauge_ = rhs.replicated_request_ranges_gauge_;
 
-    for (const auto& rhs_client_requests : rhs.clients_) {
-      ClientId client_id = rhs_client_requests.first;
-      if (clients_.find(client_id) == clients_.end()) {
-        clients_.emplace(client_id, ClientRetryableRequests(
-            (mem_tracker_) ? mem_tracker_ : rhs.mem_tracker_));
+    for (const auto& [client_id, rhs_client_requests] : rhs.clients_) {
+      auto [it, inserted] = clients_.try_emplace(
+          client_id, mem_tracker_ ? mem_tracker_ : rhs.mem_tracker_);
+      auto& client_requests = it->second;
+      if (inserted) {
+        client_requests.replicated.assign(
+            rhs_client_requests.replicated.begin(), rhs_client_requests.replicated.end());
+        client_requests.running.assign(
+            rhs_client_requests.running.begin(), rhs_client_requests.running.end());
+        continue;
       }
-      auto& client_requests = clients_.at(client_id);
 
-      auto& replicated_requests = client_requests.replicated;
-      for (auto& rhs_replicated_request : *rhs_client_requests.second.replicated) {
-        replicated_requests->emplace(rhs_replicated_request);
+      for (const auto& rhs_range : rhs_client_requests.replicated) {
+        auto range_it = ReplicatedLowerBound(&client_requests.replicated, rhs_range.last_id);
+        if (range_it == client_requests.replicated.end() ||
+            range_it->last_id != rhs_range.last_id) {
+          client_requests.replicated.insert(range_it, rhs_range);
+        }
       }
-      auto& running_requests = client_requests.running;
-      for (auto& rhs_running_request : *rhs_client_requests.second.running) {
-        running_requests->emplace(rhs_running_request);
+      for (const auto& rhs_running : rhs_client_requests.running) {
+        auto running_it = RunningLowerBound(&client_requests.running, rhs_running.request_id);
+        if (running_it == client_requests.running.end() ||
+            running_it->request_id != rhs_running.request_id) {
+          client_requests.running.insert(running_it, rhs_running);
+        }
       }
     }
   }
@@ -448,8 +455,10 @@ class RetryableRequests::Impl {
       client_requests_pb->set_client_id1(pair.first);
       client_requests_pb->set_client_id2(pair.second);
       VLOG_WITH_PREFIX(4) << Format("Saving $0 ranges for client $1",
-          client_requests.second.replicated->size(), client_requests.first);
-      for (const auto& range : *client_requests.second.replicated) {
+          client_requests.second.replicated.size(), client_requests.first);
+      client_requests_pb->mutable_range()->Reserve(
+          narrow_cast<int>(client_requests.second.replicated.size()));
+      for (const auto& range : client_requests.second.replicated) {
         auto* range_pb = client_requests_pb->add_range();
         range_pb->set_first_id(range.first_id);
         range_pb->set_last_id(range.last_id);
@@ -464,18 +473,24 @@ class RetryableRequests::Impl {
     max_replicated_op_id_ = last_flushed_op_id_ = OpId::FromPB(pb.last_op_id());
     for (auto& reqs : pb.client_requests()) {
       ClientId client_id(reqs.client_id1(), reqs.client_id2());
-     auto& client_requests = clients_.try_emplace(client_id, mem_tracker_).first->second;
+      auto& client_requests = clients_.try_emplace(client_id, mem_tracker_).first->second;
       auto& replicated_requests = client_requests.replicated;
       VLOG_WITH_PREFIX(4) << Format("Loaded $0 ranges for client $1:\n$2",
           reqs.range_size(), client_id, reqs.DebugString());
+      replicated_requests.reserve(replicated_requests.size() + reqs.range_size());
       for (auto& r : reqs.range()) {
-        replicated_requests->emplace(r.first_id(), r.last_id(),
-                                     OpId::FromPB(r.min_op_id()),
-                                     RestartSafeCoarseTimePoint::FromUInt64(r.min_time()),
-                                     RestartSafeCoarseTimePoint::FromUInt64(r.max_time()));
-        if (replicated_request_ranges_gauge_) {
-          replicated_request_ranges_gauge_->Increment();
-        }
+        replicated_requests.emplace_back(r.first_id(), r.last_id(),
+                                         OpId::FromPB(r.min_op_id()),
+                                         RestartSafeCoarseTimePoint::FromUInt64(r.min_time()),
+                                         RestartSafeCoarseTimePoint::FromUInt64(r.max_time()));
+      }
+      // Ranges are saved in order, so sorting is required only for data written differently.
+      auto by_last_id = [](const auto& lhs, const auto& rhs) { return lhs.last_id < rhs.last_id; };
+      if (!std::is_sorted(replicated_requests.begin(), replicated_requests.end(), by_last_id)) {
+        std::sort(replicated_requests.begin(), replicated_requests.end(), by_last_id);
+      }
+      if (replicated_request_ranges_gauge_) {
+        replicated_request_ranges_gauge_->IncrementBy(reqs.range_size());
       }
     }
   }
@@ -506,9 +521,9 @@ class RetryableRequests::Impl {
           data.client_id(), client_retryable_requests.min_running_request_id);
     }
 
-    auto& replicated_indexed_by_last_id = client_retryable_requests.replicated->get<LastIdIndex>();
-    auto it = replicated_indexed_by_last_id.lower_bound(data.request_id());
-    if (it != replicated_indexed_by_last_id.end() && it->first_id <= data.request_id()) {
+    auto& replicated = client_retryable_requests.replicated;
+    auto it = ReplicatedLowerBound(&replicated, data.request_id());
+    if (it != replicated.end() && it->first_id <= data.request_id()) {
       return STATUS_FORMAT(
               AlreadyPresent, "Duplicate request $0 from client $1 (min running $2)",
               data.request_id(), data.client_id(),
@@ -540,12 +555,13 @@ class RetryableRequests::Impl {
       }
     }
 
-    auto& running_indexed_by_request_id = client_retryable_requests.running->get<RequestIdIndex>();
-    auto emplace_result = running_indexed_by_request_id.emplace(data.request_id(), entry_time);
-    if (!emplace_result.second) {
-      emplace_result.first->duplicate_rounds.push_back(round);
+    auto& running = client_retryable_requests.running;
+    auto running_it = RunningLowerBound(&running, data.request_id());
+    if (running_it != running.end() && running_it->request_id == data.request_id()) {
+      running_it->duplicate_rounds.push_back(round);
       return false;
     }
+    running.emplace(running_it, data.request_id(), entry_time);
 
     VLOG_WITH_PREFIX(4) << "Running added " << data;
     if (running_requests_gauge_) {
@@ -561,23 +577,26 @@ class RetryableRequests::Impl {
     auto clean_start = now - request_timeout_secs_ * 1s;
     for (auto ci = clients_.begin(); ci != clients_.end();) {
       ClientRetryableRequests& client_retryable_requests = ci->second;
-      auto& op_id_index = client_retryable_requests.replicated->get<OpIdIndex>();
-      auto it = op_id_index.begin();
-      int64_t count = 0;
-      while (it != op_id_index.end() && it->max_time < clean_start) {
-        ++it;
-        ++count;
+      auto& replicated = client_retryable_requests.replicated;
+      // Ranges that precede the first not expired range in op id order are removed, so the log
+      // could be cleaned up to min op id of that range.
+      auto min_op_id = OpId::Max();
+      for (const auto& range : replicated) {
+        if (range.max_time >= clean_start) {
+          min_op_id = std::min(min_op_id, range.min_op_id);
+        }
       }
+      auto erase_it = std::remove_if(
+          replicated.begin(), replicated.end(), [min_op_id](const auto& range) {
+        return range.min_op_id < min_op_id;
+      });
       if (replicated_request_ranges_gauge_) {
-        replicated_request_ranges_gauge_->DecrementBy(count);
-      }
-      if (it != op_id_index.end()) {
-        result = std::min(result, it->min_op_id);
-        op_id_index.erase(op_id_index.begin(), it);
-      } else {
-        op_id_index.clear();
+        replicated_request_ranges_gauge_->DecrementBy(replicated.end() - erase_it);
       }
-      if (op_id_index.empty() && client_retryable_requests.running->empty()) {
+      replicated.erase(erase_it, replicated.end());
+      MaybeShrink(&replicated);
+      result = std::min(result, min_op_id);
+      if (replicated.empty() && client_retryable_requests.running.empty()) {
         // We delay deleting client with empty requests, to be able to filter requests with too
         // small request id.
         if (client_retryable_requests.empty_since == RestartSafeCoarseTimePoint()) {
@@ -602,12 +621,11 @@ class RetryableRequests::Impl {
 
     auto& client_retryable_requests = clients_.try_emplace(
         data.client_id(), mem_tracker_).first->second;
-    auto& running_indexed_by_request_id = client_retryable_requests.running->get<RequestIdIndex>();
-    auto running_it = running_indexed_by_request_id.find(data.request_id());
-    if (running_it == running_indexed_by_request_id.end()) {
+    auto& running = client_retryable_requests.running;
+    auto running_it = FindRunning(&running, data.request_id());
+    if (running_it == running.end()) {
 #ifndef NDEBUG
-      LOG_WITH_PREFIX(ERROR) << "Running requests: "
-                             << AsString(running_indexed_by_request_id);
+      LOG_WITH_PREFIX(ERROR) << "Running requests: " << AsString(running);
 #endif
       LOG_WITH_PREFIX(DFATAL) << "Replication finished for request with unknown id " << data;
       return;
@@ -622,7 +640,8 @@ class RetryableRequests::Impl {
                                            nullptr /* applied_op_ids */);
     }
     auto entry_time = running_it->time;
-    running_indexed_by_request_id.erase(running_it);
+    running.erase(running_it);
+    MaybeShrink(&running);
     if (running_requests_gauge_) {
       running_requests_gauge_->Decrement();
     }
@@ -646,11 +665,10 @@ class RetryableRequests::Impl {
 
     auto& client_retryable_requests = clients_.try_emplace(
         data.client_id(), mem_tracker_).first->second;
-    auto& running_indexed_by_request_id = client_retryable_requests.running->get<RequestIdIndex>();
-    if (running_indexed_by_request_id.count(data.request_id()) != 0) {
+    auto& running = client_retryable_requests.running;
+    if (FindRunning(&running, data.request_id()) != running.end()) {
 #ifndef NDEBUG
-      LOG_WITH_PREFIX(ERROR) << "Running requests: "
-                             << yb::ToString(running_indexed_by_request_id);
+      LOG_WITH_PREFIX(ERROR) << "Running requests: " << yb::ToString(running);
 #endif
       LOG_WITH_PREFIX(DFATAL) << "Bootstrapped running request " << data;
       return;
@@ -692,8 +710,8 @@ class RetryableRequests::Impl {
   RetryableRequestsCounts Counts() {
     RetryableRequestsCounts result;
     for (const auto& p : clients_) {
-      result.running += p.second.running->size();
-      result.replicated += p.second.replicated->size();
+      result.running += p.second.running.size();
+      result.replicated += p.second.replicated.size();
       LOG_WITH_PREFIX(INFO) << "Replicated: " << yb::ToString(p.second.replicated);
     }
     return result;
@@ -711,24 +729,22 @@ class RetryableRequests::Impl {
   void CleanupReplicatedRequests(
       RetryableRequestId new_min_running_request_id,
       ClientRetryableRequests* client_retryable_requests) {
-    auto& replicated_indexed_by_last_id = client_retryable_requests->replicated->get<LastIdIndex>();
+    auto& replicated = client_retryable_requests->replicated;
     if (new_min_running_request_id > client_retryable_requests->min_running_request_id) {
       // We are not interested in ids below write_request.min_running_request_id() anymore.
       //
       // Request id intervals are ordered by last id of interval, and does not overlap.
       // So we are trying to find interval with last_id >= min_running_request_id
       // and trim it if necessary.
-      auto it = replicated_indexed_by_last_id.lower_bound(new_min_running_request_id);
-      if (it != replicated_indexed_by_last_id.end() &&
-          it->first_id < new_min_running_request_id) {
+      auto it = ReplicatedLowerBound(&replicated, new_min_running_request_id);
+      if (it != replicated.end() && it->first_id < new_min_running_request_id) {
         it->first_id = new_min_running_request_id;
       }
       if (replicated_request_ranges_gauge_) {
-        replicated_request_ranges_gauge_->DecrementBy(
-            std::distance(replicated_indexed_by_last_id.begin(), it));
+        replicated_request_ranges_gauge_->DecrementBy(it - replicated.begin());
       }
       // Remove all intervals that has ids below write_request.min_running_request_id().
-      replicated_indexed_by_last_id.erase(replicated_indexed_by_last_id.begin(), it);
+      replicated.erase(replicated.begin(), it);
       client_retryable_requests->min_running_request_id = new_min_running_request_id;
     }
   }
@@ -736,12 +752,11 @@ class RetryableRequests::Impl {
   void AddReplicated(yb::OpId op_id, const ReplicateData& data, RestartSafeCoarseTimePoint time,
                      ClientRetryableRequests* client) {
     auto request_id = data.request_id();
-    auto& replicated_indexed_by_last_id = client->replicated->get<LastIdIndex>();
-    auto request_it = replicated_indexed_by_last_id.lower_bound(request_id);
-    if (request_it != replicated_indexed_by_last_id.end() && request_it->first_id <= request_id) {
+    auto& replicated = client->replicated;
+    auto request_it = ReplicatedLowerBound(&replicated, request_id);
+    if (request_it != replicated.end() && request_it->first_id <= request_id) {
 #ifndef NDEBUG
-      LOG_WITH_PREFIX(ERROR)
-          << "Replicated requests: " << yb::ToString(client->replicated);
+      LOG_WITH_PREFIX(ERROR) << "Replicated requests: " << yb::ToString(replicated);
 #endif
 
       LOG_WITH_PREFIX(DFATAL) << "Request already replicated: " << data;
@@ -756,44 +771,30 @@ class RetryableRequests::Impl {
     // Check that we have range right after this id, and we could extend it.
     // Requests rarely attaches to begin of interval, so we could don't check for
     // RangeTimeLimit() here.
-    if (request_it != replicated_indexed_by_last_id.end() &&
-        request_it->first_id == request_id + 1) {
-      op_id = std::min(request_it->min_op_id, op_id);
+    if (request_it != replicated.end() && request_it->first_id == request_id + 1) {
+      request_it->InsertOpId(op_id);
       request_it->InsertTime(time);
       // If previous range is right before this id, then we could just join those ranges.
-      if (!TryJoinRanges(request_it, op_id, &replicated_indexed_by_last_id)) {
+      if (!TryJoinRanges(request_it, &replicated)) {
         --(request_it->first_id);
-        UpdateMinOpId(request_it, op_id, &replicated_indexed_by_last_id);
       }
       return;
     }
 
-    if (TryJoinToEndOfRange(request_it, op_id, request_id, time, &replicated_indexed_by_last_id)) {
+    if (TryJoinToEndOfRange(request_it, op_id, request_id, time, &replicated)) {
       return;
     }
 
-    client->replicated->emplace(request_id, op_id, time);
+    replicated.emplace(request_it, request_id, op_id, time);
     if (replicated_request_ranges_gauge_) {
       replicated_request_ranges_gauge_->Increment();
     }
   }
 
-  void UpdateMinOpId(
-      ReplicatedRetryableRequestRangesByLastId::iterator request_it,
-      yb::OpId min_op_id,
-      ReplicatedRetryableRequestRangesByLastId* replicated_indexed_by_last_id) {
-    if (min_op_id < request_it->min_op_id) {
-      replicated_indexed_by_last_id->modify(request_it, [min_op_id](auto& entry) { // NOLINT
-        entry.min_op_id = min_op_id;
-      });
-    }
-  }
-
   bool TryJoinRanges(
-      ReplicatedRetryableRequestRangesByLastId::iterator request_it,
-      yb::OpId min_op_id,
-      ReplicatedRetryableRequestRangesByLastId* replicated_indexed_by_last_id) {
-    if (request_it == replicated_indexed_by_last_id->begin()) {
+      ReplicatedRetryableRequestRanges::iterator request_it,
+      ReplicatedRetryableRequestRanges* replicated) {
+    if (request_it == replicated->begin()) {
       return false;
     }
 
@@ -811,22 +812,20 @@ class RetryableRequests::Impl {
       return false;
     }
 
-    min_op_id = std::min(min_op_id, request_prev_it->min_op_id);
     request_it->PrepareJoinWithPrev(*request_prev_it);
-    replicated_indexed_by_last_id->erase(request_prev_it);
+    replicated->erase(request_prev_it);
     if (replicated_request_ranges_gauge_) {
       replicated_request_ranges_gauge_->Decrement();
     }
-    UpdateMinOpId(request_it, min_op_id, replicated_indexed_by_last_id);
 
     return true;
   }
 
   bool TryJoinToEndOfRange(
-      ReplicatedRetryableRequestRangesByLastId::iterator request_it,
+      ReplicatedRetryableRequestRanges::iterator request_it,
       yb::OpId op_id, RetryableRequestId request_id, RestartSafeCoarseTimePoint time,
-      ReplicatedRetryableRequestRangesByLastId* replicated_indexed_by_last_id) {
-    if (request_it == replicated_indexed_by_last_id->begin()) {
+      ReplicatedRetryableRequestRanges* replicated) {
+    if (request_it == replicated->begin()) {
       return false;
     }
 
@@ -843,13 +842,9 @@ class RetryableRequests::Impl {
       return false;
     }
 
-    op_id = std::min(request_it->min_op_id, op_id);
+    request_it->InsertOpId(op_id);
     request_it->InsertTime(time);
-    // Actually we should use the modify function on client.replicated, but since the order of
-    // ranges should not be changed, we could update last_id directly.
-    ++const_cast<ReplicatedRetryableRequestRange&>(*request_it).last_id;
-
-    UpdateMinOpId(request_it, op_id, replicated_indexed_by_last_id);
+    ++request_it->last_id;
 
     return true;
   }
@@ -28,6 +28,12 @@ BoundedRocksDbIterator::BoundedRocksDbIterator(
   VLOG(3) << "key_bounds_ = " << AsString(key_bounds_);
 }
 
+BoundedRocksDbIterator::BoundedRocksDbIterator(
+    std::unique_ptr<rocksdb::Iterator> iterator, const KeyBounds* key_bounds)
+    : iterator_(std::move(iterator)), key_bounds_(key_bounds) {
+  CHECK_NOTNULL(key_bounds_);
+}
+
 const rocksdb::KeyValueEntry& BoundedRocksDbIterator::SeekToFirst() {
   if (key_bounds_->lower.empty()) {
     return FilterEntry(iterator_->SeekToFirst());
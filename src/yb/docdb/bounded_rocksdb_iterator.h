@@ -33,6 +33,8 @@ class BoundedRocksDbIterator final : public rocksdb::Iterator {
   BoundedRocksDbIterator(
       rocksdb::DB* rocksdb, const rocksdb::ReadOptions& read_opts, const KeyBounds* key_bounds);
 
+  BoundedRocksDbIterator(std::unique_ptr<rocksdb::Iterator> iterator, const KeyBounds* key_bounds);
+
   BoundedRocksDbIterator(const BoundedRocksDbIterator& other) = delete;
   void operator=(const BoundedRocksDbIterator& other) = delete;
 
@@ -71,6 +73,10 @@ class BoundedRocksDbIterator final : public rocksdb::Iterator {
     iterator_.reset();
   }
 
+  std::unique_ptr<rocksdb::Iterator> Release() {
+    return std::move(iterator_);
+  }
+
   void UseFastNext(bool value) override;
 
  private:
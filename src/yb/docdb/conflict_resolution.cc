@@ -38,6 +38,7 @@
 #include "yb/tablet/tablet_metadata.h"
 #include "yb/tablet/tablet_metrics.h"
 
+#include "yb/util/flags.h"
 #include "yb/util/lazy_invoke.h"
 #include "yb/util/logging.h"
 #include "yb/util/metrics.h"
@@ -52,6 +53,11 @@
 using namespace std::literals;
 using namespace std::placeholders;
 
+DEFINE_RUNTIME_bool(conflict_resolution_use_live_intents_filter, true,
+                    "Skip intents DB lookups of conflict resolution for keys that have no "
+                    "conflicting intents of live transactions according to the in memory filter "
+                    "maintained by transaction participant.");
+
 namespace yb {
 namespace docdb {
 
@@ -198,6 +204,14 @@ class ConflictResolver : public std::enable_shared_from_this<ConflictResolver> {
 
   // Reads conflicts for specified intent from DB.
   Status ReadIntentConflicts(IntentTypeSet type, bool first, KeyBytes* intent_key_prefix) {
+    if (first) {
+      intent_iter_positioned_ = false;
+    }
+    if (FLAGS_conflict_resolution_use_live_intents_filter &&
+        !status_manager_.MayHaveConflictingIntents(intent_key_prefix->AsSlice(), HasStrong(type))) {
+      return Status::OK();
+    }
+
     EnsureIntentIteratorCreated();
 
     const auto conflicting_intent_types = kIntentTypeSetConflicts[type.ToUIntPtr()];
@@ -221,8 +235,9 @@ class ConflictResolver : public std::enable_shared_from_this<ConflictResolver> {
     VLOG_WITH_PREFIX_AND_FUNC(4) << "Check conflicts in intents DB; Seek: "
                                  << intent_key_prefix->AsSlice().ToDebugHexString() << " for type "
                                  << ToString(type);
-    if (first) {
+    if (!intent_iter_positioned_) {
       intent_iter_.Seek(intent_key_prefix->AsSlice());
+      intent_iter_positioned_ = true;
     } else {
       intent_iter_.RevalidateAfterUpperBoundChange();
       SeekForward(intent_key_prefix->AsSlice(), &intent_iter_);
@@ -499,6 +514,10 @@ class ConflictResolver : public std::enable_shared_from_this<ConflictResolver> {
   ResolutionCallback callback_;
 
   BoundedRocksDbIterator intent_iter_;
+  // Whether intent_iter_ was positioned during the current resolution, so it could be moved
+  // forward. Lookups of keys without conflicting intents are skipped, so the first lookup of the
+  // resolution does not necessarily position the iterator.
+  bool intent_iter_positioned_ = false;
   Slice intent_key_upperbound_;
   TransactionConflictInfoMap conflicts_;
 
@@ -15,6 +15,7 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -81,6 +82,11 @@ DEFINE_RUNTIME_bool(ycql_enable_packed_row, kYcqlPackedRowEnabled,
 DEFINE_RUNTIME_bool(ycql_jsonb_use_member_cache, true,
                     "Whether we use member cache during jsonb processing in YCQL.");
 
+DEFINE_RUNTIME_bool(ycql_jsonb_update_in_place, true,
+                    "Whether updates of existing paths of YCQL jsonb columns, e.g. j->'a' = '1', "
+                    "replace the value in the serialized jsonb without converting the whole "
+                    "document to json and back.");
+
 DEFINE_UNKNOWN_uint64(
     ycql_packed_row_size_limit, 0,
     "Packed row size limit for YCQL in bytes. 0 to make this equal to SSTable block size.");
@@ -298,6 +304,33 @@ Status CheckUserTimestampForCollections(const UserTimeMicros user_timestamp) {
   return Status::OK();
 }
 
+// Returns true if the request only increments or decrements counter columns of a single row, and
+// reads nothing but the counters it updates. Such a request does not depend on the other columns
+// of the row, so it is enough to lock the paths of the updated counters.
+Result<bool> IsCounterOnlyUpdate(const QLWriteRequestPB& request, const Schema& schema) {
+  if (request.type() != QLWriteRequestPB::QL_STMT_UPDATE || request.column_values().empty() ||
+      request.has_if_expr() || request.returns_status() || request.has_user_timestamp_usec() ||
+      IsRangeOperation(request, schema)) {
+    return false;
+  }
+  std::unordered_set<int32_t> column_ids;
+  for (const auto& column_value : request.column_values()) {
+    const auto& column = VERIFY_RESULT_REF(schema.column_by_id(ColumnId(column_value.column_id())));
+    if (!column.is_counter()) {
+      return false;
+    }
+    column_ids.insert(column_value.column_id());
+  }
+  for (const auto* ids : {&request.column_refs().ids(), &request.column_refs().static_ids()}) {
+    for (auto id : *ids) {
+      if (!column_ids.contains(id)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 } // namespace
 
 struct QLWriteOperation::ApplyContext {
@@ -347,6 +380,8 @@ Status QLWriteOperation::Init(QLResponsePB* response) {
   require_read_ = RequireRead(request_, doc_read_context_->schema()) || insert_into_unique_index_
                   || !index_map_.empty();
   update_indexes_ = !request_.update_index_ids().empty();
+  lock_counters_only_ = !insert_into_unique_index_ && index_map_.empty() &&
+                        VERIFY_RESULT(IsCounterOnlyUpdate(request_, doc_read_context_->schema()));
 
   // Determine if static / non-static columns are being written.
   bool write_static_columns = false;
@@ -426,7 +461,8 @@ Status QLWriteOperation::InitializeKeys(const bool hashed_key, const bool primar
 
 Status QLWriteOperation::GetDocPaths(
     GetDocPathsMode mode, DocPathsToLock *paths, IsolationLevel *level) const {
-  if (mode == GetDocPathsMode::kLock || request_.column_values().empty() || !index_map_.empty()) {
+  if ((mode == GetDocPathsMode::kLock && !lock_counters_only_) ||
+      request_.column_values().empty() || !index_map_.empty()) {
     if (encoded_hashed_doc_key_) {
       paths->push_back(encoded_hashed_doc_key_);
     }
@@ -729,6 +765,8 @@ Status QLWriteOperation::ApplyForJsonOperators(
   QLValue qlv;
   RapidJsonMemberCache member_cache;
   bool read_needed = true;
+  // Serialized value of the column, while paths present in it are replaced in place.
+  std::optional<Jsonb> jsonb_in_place;
   for (const auto& column_value_ptr : col_map.find(col_id)->second) {
     const auto& column_value = *column_value_ptr;
     if (column_value.column_id() != col_id) continue;
@@ -737,7 +775,9 @@ Status QLWriteOperation::ApplyForJsonOperators(
       QLExprResult temp;
       RETURN_NOT_OK(existing_row->ReadColumn(col_id, temp.Writer()));
       const auto& ql_value = temp.Value();
-      if (!IsNull(ql_value)) {
+      if (!IsNull(ql_value) && FLAGS_ycql_jsonb_update_in_place) {
+        jsonb_in_place.emplace(ql_value.jsonb_value());
+      } else if (!IsNull(ql_value)) {
         Jsonb jsonb(ql_value.jsonb_value());
         RETURN_NOT_OK(jsonb.ToRapidJson(&document));
       } else {
@@ -754,6 +794,16 @@ Status QLWriteOperation::ApplyForJsonOperators(
     }
     read_needed = false;
 
+    if (jsonb_in_place) {
+      if (VERIFY_RESULT(jsonb_in_place->ReplaceValue(
+              column_value.json_args(), column_value.expr().value().jsonb_value()))) {
+        continue;
+      }
+      // Missing paths are added or reported by the regular read modify write below.
+      RETURN_NOT_OK(jsonb_in_place->ToRapidJson(&document));
+      jsonb_in_place.reset();
+    }
+
     // Deserialize the rhs.
     Jsonb rhs(column_value.expr().value().jsonb_value());
     rapidjson::Document rhs_doc(&document.GetAllocator());
@@ -803,7 +853,11 @@ Status QLWriteOperation::ApplyForJsonOperators(
   } // end of column processing
   // Now write the new json value back.
   Jsonb jsonb_result;
-  RETURN_NOT_OK(jsonb_result.FromRapidJson(document));
+  if (jsonb_in_place) {
+    jsonb_result = std::move(*jsonb_in_place);
+  } else {
+    RETURN_NOT_OK(jsonb_result.FromRapidJson(document));
+  }
   // Update the current row as well so that we can accumulate the result of multiple json
   // operations and write the final value.
   *qlv.mutable_jsonb_value() = std::move(jsonb_result.MoveSerializedJsonb());
@@ -199,6 +199,10 @@ class QLWriteOperation :
   // Is this an insert into a unique index?
   bool insert_into_unique_index_ = false;
 
+  // Does this write only update counters, so just their column paths should be locked instead of
+  // the whole row?
+  bool lock_counters_only_ = false;
+
   // Does the liveness column exist before the write operation?
   bool liveness_column_exists_ = false;
 };
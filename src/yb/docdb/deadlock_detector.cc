@@ -13,9 +13,11 @@
 
 #include "yb/docdb/deadlock_detector.h"
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 
 #include "yb/client/transaction_rpc.h"
 
@@ -64,6 +66,14 @@ DEFINE_RUNTIME_int32(
 TAG_FLAG(clear_deadlocked_txns_info_older_than_heartbeats, hidden);
 TAG_FLAG(clear_deadlocked_txns_info_older_than_heartbeats, advanced);
 
+DEFINE_RUNTIME_int32(
+    deadlock_probe_full_scan_period, 5,
+    "Number of periodic probe rounds of a deadlock detector after which all waiting transactions "
+    "are probed. Other rounds only probe waiting transactions whose wait-for dependencies changed "
+    "since the previous round. All waiting transactions are probed on every round if this is not "
+    "greater than 1.");
+TAG_FLAG(deadlock_probe_full_scan_period, advanced);
+
 METRIC_DEFINE_event_stats(
     tablet, deadlock_size, "Deadlock size", yb::MetricUnit::kTransactions,
     "The number of transactions involved in detected deadlocks");
@@ -78,6 +88,10 @@ DEFINE_test_flag(int32, sleep_amidst_iterating_blockers_ms, 0,
     "Time for which the thread sleeps in each iteration while looping over the computed wait-for "
     "probes and sending information to the waiters.");
 
+DEFINE_test_flag(bool, skip_deadlock_probes_on_wait_for_update, false,
+    "Don't probe waiters when their wait-for dependencies are received, so deadlocks are only "
+    "detected by periodic probe rounds.");
+
 DECLARE_uint64(transaction_heartbeat_usec);
 
 namespace yb {
@@ -89,8 +103,12 @@ YB_STRONGLY_TYPED_UUID(DetectorId);
 
 using LocalProbeProcessorCallback = std::function<void(
     const Status&, const tserver::ProbeTransactionDeadlockResponsePB&)>;
-using WaiterTxnTuple = std::tuple<
-    const TransactionId, const std::string, std::shared_ptr<const WaiterData>>;
+
+// Waiting transaction with its wait-for data received from all tablet servers.
+struct WaiterToProbe {
+  TransactionId id;
+  std::vector<std::shared_ptr<const WaiterData>> waiter_data;
+};
 
 // Container class which supports efficiently fetching items uniquely indexed by probe_num as well
 // as efficiently removing items which were added before a threshold time or which are associated
@@ -229,6 +247,17 @@ class LocalProbeProcessor : public std::enable_shared_from_this<LocalProbeProces
     auto& blocker_id = blocker_info.id;
     auto& blocker_status_tablet = blocker_info.status_tablet;
     auto& blocking_subtxn_info = blocker_info.blocking_subtxn_info;
+    // The same wait-for dependency could be reported by several tablet servers, it is enough to
+    // probe it once.
+    auto [added_it, added_end] = added_blockers_.equal_range(blocker_id);
+    for (; added_it != added_end; ++added_it) {
+      if (added_it->second->set() == blocking_subtxn_info->set()) {
+        VLOG_WITH_PREFIX_AND_FUNC(4) << "Skipping duplicate blocker " << blocker_id;
+        return;
+      }
+    }
+    added_blockers_.emplace(blocker_id, blocking_subtxn_info);
+
     handles_.push_back(rpcs_->Prepare());
     auto handle = handles_.back();
     if (handle == rpcs_->InvalidHandle()) {
@@ -354,6 +383,8 @@ class LocalProbeProcessor : public std::enable_shared_from_this<LocalProbeProces
   CoarseTimePoint sent_at_;
 
   std::vector<rpc::Rpcs::Handle> handles_;
+  std::unordered_multimap<TransactionId, std::shared_ptr<const SubtxnSetAndPB>, TransactionIdHash>
+      added_blockers_;
 
   LocalProbeProcessorCallback callback_ = [](const auto& status, const auto& resp) {
     DCHECK(false) << "Did not set callback before sending probes.";
@@ -464,9 +495,10 @@ class DeadlockDetector::Impl : public std::enable_shared_from_this<DeadlockDetec
       const tserver::UpdateTransactionWaitingForStatusRequestPB& req,
       tserver::UpdateTransactionWaitingForStatusResponsePB* resp,
       DeadlockDetectorRpcCallback&& callback) {
-    std::vector<WaiterTxnTuple> waiters_to_probe;
+    std::vector<WaiterToProbe> waiters_to_probe;
     auto status = [this, &waiters_to_probe](const auto& req) -> Status {
       UniqueLock<decltype(mutex_)> l(mutex_);
+      auto generation = ++wait_for_generation_;
       auto tserver_uuid = req.tserver_uuid();
       RSTATUS_DCHECK(
           !tserver_uuid.empty(), InvalidArgument,
@@ -509,7 +541,8 @@ class DeadlockDetector::Impl : public std::enable_shared_from_this<DeadlockDetec
                               << " with newer request at " << wait_start_time;
           waiter_data = std::make_shared<WaiterData>(WaiterData{
             .wait_start_time = std::move(wait_start_time),
-            .blockers = std::make_shared<BlockerData>(BlockerData())
+            .blockers = std::make_shared<BlockerData>(BlockerData()),
+            .generation = generation,
           });
           // waiters_ map is guarded by mutex_, hence resetting the value field (shared_ptr)
           // is thread safe. Copies of the shared_ptr that might operate outside the scope of
@@ -523,6 +556,7 @@ class DeadlockDetector::Impl : public std::enable_shared_from_this<DeadlockDetec
           waiter_data = std::make_shared<WaiterData>(WaiterData {
             .wait_start_time = std::move(wait_start_time),
             .blockers = std::make_shared<BlockerData>(BlockerData()),
+            .generation = generation,
           });
           auto it = waiters_.emplace(
                 WaiterInfoEntry(waiter_txn_id, tserver_uuid, waiter_data));
@@ -556,11 +590,9 @@ class DeadlockDetector::Impl : public std::enable_shared_from_this<DeadlockDetec
               << "received from TS: " << tserver_uuid << " "
               << "start time: " << wait_start_time;
         }
-        // TODO(wait-queues): Tracking tserver uuid here is unnecessary as it isn't required in
-        // GetProbesToSend. We adhere to this format so that GetProbesToSend function can be re-used
-        // for both 'waiters_'  as well as 'waiters_to_probe'.
-        waiters_to_probe.push_back(
-            {waiter_it->txn_id(), "" /* tserver uuid */, waiter_it->waiter_data()});
+        // Probe the waiter with its blockers reported by all tablet servers, so the wait-for
+        // dependencies from other tablet servers are not probed by a separate probe.
+        waiters_to_probe.push_back(GetWaiterToProbeUnlocked(waiter_txn_id));
       }
       return Status::OK();
     }(req);
@@ -571,6 +603,9 @@ class DeadlockDetector::Impl : public std::enable_shared_from_this<DeadlockDetec
     }
 
     callback(Status::OK());
+    if (PREDICT_FALSE(FLAGS_TEST_skip_deadlock_probes_on_wait_for_update)) {
+      return;
+    }
     for (const auto& probe : GetProbesToSend(waiters_to_probe)) {
       probe->Send();
     }
@@ -588,9 +623,24 @@ class DeadlockDetector::Impl : public std::enable_shared_from_this<DeadlockDetec
         return;
       }
       is_probe_scan_active_ = true;
-      // TODO(wait-queues): Trigger probes only for waiters which which have
-      // wait_start_time > Now() - N seconds
-      probes_to_send = GetProbesToSend(waiters_);
+      // A deadlock could only be formed by a new wait-for dependency. Each new dependency is
+      // probed when it is received, and once again on the next round, in case the probe was sent
+      // before other dependencies of the cycle reached their detectors. Other waiters are probed
+      // on full scans only, to recover from lost probes.
+      auto full_scan_period = FLAGS_deadlock_probe_full_scan_period;
+      uint64_t min_generation = 0;
+      if (full_scan_period > 1 && ++num_partial_probe_scans_ < full_scan_period) {
+        min_generation = last_probe_scan_generation_ + 1;
+      } else {
+        num_partial_probe_scans_ = 0;
+      }
+      last_probe_scan_generation_ = wait_for_generation_;
+      probes_to_send = GetProbesToSend(GetWaitersToProbeUnlocked(min_generation));
+      VLOG_WITH_PREFIX(1) << "Probing " << probes_to_send.size() << " waiters of "
+                          << waiters_.size() << " with min generation " << min_generation;
+      if (probes_to_send.empty()) {
+        is_probe_scan_active_ = false;
+      }
 
       // Clear the info of old deadlocked transactions.
       auto interval = FLAGS_clear_deadlocked_txns_info_older_than_heartbeats *
@@ -637,19 +687,51 @@ class DeadlockDetector::Impl : public std::enable_shared_from_this<DeadlockDetec
   }
 
  private:
-  template <class T>
-  std::vector<LocalProbeProcessorPtr> GetProbesToSend(const T& waiters) {
+  WaiterToProbe GetWaiterToProbeUnlocked(const TransactionId& waiter_txn_id)
+      REQUIRES_SHARED(mutex_) {
+    WaiterToProbe result{.id = waiter_txn_id};
+    auto waiter_entries =
+        boost::make_iterator_range(waiters_.get<TransactionIdTag>().equal_range(waiter_txn_id));
+    for (const auto& entry : waiter_entries) {
+      result.waiter_data.push_back(entry.waiter_data());
+    }
+    return result;
+  }
+
+  // Returns waiters that have wait-for data recorded at min_generation or later.
+  std::vector<WaiterToProbe> GetWaitersToProbeUnlocked(uint64_t min_generation)
+      REQUIRES_SHARED(mutex_) {
+    std::vector<WaiterToProbe> result;
+    bool changed = false;
+    // Entries of the same waiter are adjacent in the transaction id index.
+    for (const auto& entry : waiters_.get<TransactionIdTag>()) {
+      if (result.empty() || result.back().id != entry.txn_id()) {
+        if (!result.empty() && !changed) {
+          result.pop_back();
+        }
+        result.push_back(WaiterToProbe{.id = entry.txn_id()});
+        changed = false;
+      }
+      result.back().waiter_data.push_back(entry.waiter_data());
+      changed = changed || entry.waiter_data()->generation >= min_generation;
+    }
+    if (!result.empty() && !changed) {
+      result.pop_back();
+    }
+    return result;
+  }
+
+  std::vector<LocalProbeProcessorPtr> GetProbesToSend(const std::vector<WaiterToProbe>& waiters) {
     std::vector<LocalProbeProcessorPtr> probes_to_send;
-    std::shared_ptr<std::atomic<uint64>> outstanding_probes =
-        std::make_shared<std::atomic<uint64>>(waiters.size());
-
-    // A waiter_txn_id might be encountered multiple times in the below iterations depending
-    // on the number of Tablet Servers the wait-for dependencies for the waiter arrived from.
-    //
-    // TODO(wait-queues): Coalesce multiple entries in waiters with the same waiter_txn_id into a
-    // single LocalProbeProcessor.
-    for (const auto& [waiter_txn_id, _, waiter_data] : waiters) {
-      if (waiter_data->blockers->empty()) {
+    auto outstanding_probes = std::make_shared<std::atomic<uint64>>(0);
+
+    // All wait-for data of a waiter, received from different tablet servers, is probed by a single
+    // LocalProbeProcessor.
+    for (const auto& [waiter_txn_id, waiter_data_list] : waiters) {
+      auto has_blockers = std::any_of(
+          waiter_data_list.begin(), waiter_data_list.end(),
+          [](const auto& waiter_data) { return !waiter_data->blockers->empty(); });
+      if (!has_blockers) {
         LOG_WITH_PREFIX(WARNING) << "Tried getting probes for waiter with no blockers "
                                  << waiter_txn_id;
         continue;
@@ -664,10 +746,12 @@ class DeadlockDetector::Impl : public std::enable_shared_from_this<DeadlockDetec
       auto processor = std::make_shared<LocalProbeProcessor>(
           log_prefix_, detector_id_, probe_num, min_probe_num,
           waiter_txn_id, &rpcs_, &client(), probe_latency_);
-      for (const auto& blocker : *waiter_data->blockers) {
-        AtomicFlagSleepMs(&FLAGS_TEST_sleep_amidst_iterating_blockers_ms);
-        DCHECK(!blocker.status_tablet.empty());
-        processor->AddBlocker(blocker);
+      for (const auto& waiter_data : waiter_data_list) {
+        for (const auto& blocker : *waiter_data->blockers) {
+          AtomicFlagSleepMs(&FLAGS_TEST_sleep_amidst_iterating_blockers_ms);
+          DCHECK(!blocker.status_tablet.empty());
+          processor->AddBlocker(blocker);
+        }
       }
       processor->SetCallback([detector = shared_from_this(), outstanding_probes, probe_num]
           (const auto& status, const auto& resp) {
@@ -699,6 +783,9 @@ class DeadlockDetector::Impl : public std::enable_shared_from_this<DeadlockDetec
       probes_to_send.push_back(processor);
       created_probes_.AddOrGet(probe_num, TransactionId(waiter_txn_id));
     }
+    // Callbacks are invoked only after the probes are sent, so the counter is set before any of
+    // them could decrement it.
+    outstanding_probes->store(probes_to_send.size());
     return probes_to_send;
   }
 
@@ -871,6 +958,12 @@ class DeadlockDetector::Impl : public std::enable_shared_from_this<DeadlockDetec
 
   Waiters waiters_ GUARDED_BY(mutex_);
 
+  // Incremented on each received wait-for update, recorded in the WaiterData created by it.
+  uint64_t wait_for_generation_ GUARDED_BY(mutex_) = 0;
+  // Value of wait_for_generation_ at the previous periodic probe round.
+  uint64_t last_probe_scan_generation_ GUARDED_BY(mutex_) = 0;
+  int32_t num_partial_probe_scans_ GUARDED_BY(mutex_) = 0;
+
   std::atomic<uint32_t> seq_no_ = 0;
 
   std::unordered_map<TransactionId, std::pair<std::string, CoarseTimePoint>, TransactionIdHash>
@@ -42,6 +42,8 @@ using BlockerDataPtr = std::shared_ptr<BlockerData>;
 struct WaiterData {
     HybridTime wait_start_time;
     BlockerDataPtr blockers;
+    // Wait-for generation of the detector at which this data was recorded.
+    uint64_t generation = 0;
 };
 
 // WaiterInfoEntry stores the wait-for dependencies of a waiter transaction received from a
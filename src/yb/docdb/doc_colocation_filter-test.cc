@@ -0,0 +1,115 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "yb/docdb/doc_colocation_filter.h"
+
+#include "yb/common/hybrid_time.h"
+
+#include "yb/dockv/doc_key.h"
+#include "yb/dockv/key_entry_value.h"
+
+#include "yb/util/flags.h"
+#include "yb/util/test_macros.h"
+
+DECLARE_uint32(docdb_max_colocation_ids_per_sst);
+
+namespace yb::docdb {
+
+namespace {
+
+rocksdb::UserCollectedProperties CollectProperties(
+    const std::vector<dockv::DocKey>& doc_keys,
+    const std::vector<HybridTime>& hybrid_times = {}) {
+  auto factory = CreateColocationIdsCollectorFactory();
+  std::unique_ptr<rocksdb::TablePropertiesCollector> collector(
+      factory->CreateTablePropertiesCollector({}));
+  uint64_t file_size = 0;
+  for (size_t i = 0; i != doc_keys.size(); ++i) {
+    auto ht = i < hybrid_times.size() ? hybrid_times[i] : HybridTime::FromMicros(1000);
+    auto key = dockv::SubDocKey(doc_keys[i], ht).Encode();
+    CHECK_OK(collector->AddUserKey(
+        key.AsSlice(), Slice(), rocksdb::kEntryPut, /* seq= */ 0, file_size));
+    file_size += key.size();
+  }
+  rocksdb::UserCollectedProperties result;
+  CHECK_OK(collector->Finish(&result));
+  return result;
+}
+
+dockv::DocKey ColocatedKey(ColocationId colocation_id, int64_t value) {
+  dockv::DocKey result(colocation_id);
+  result.range_group().push_back(dockv::KeyEntryValue::Int64(value));
+  return result;
+}
+
+} // namespace
+
+TEST(DocColocationFilterTest, Collect) {
+  auto properties = CollectProperties({
+      ColocatedKey(0x10000, 1), ColocatedKey(0x10000, 2), ColocatedKey(0x20000, 1),
+      ColocatedKey(0x50000, 3)});
+  ASSERT_EQ(properties.count(kColocationIdsPropertyName), 1);
+  ASSERT_TRUE(ColocationIdsMayContain(properties, 0x10000));
+  ASSERT_TRUE(ColocationIdsMayContain(properties, 0x20000));
+  ASSERT_TRUE(ColocationIdsMayContain(properties, 0x50000));
+  ASSERT_FALSE(ColocationIdsMayContain(properties, 0x30000));
+  ASSERT_FALSE(ColocationIdsMayContain(properties, 0x1));
+  ASSERT_FALSE(ColocationIdsMayContain(properties, 0x60000));
+
+  // Files without colocated rows or collected before the property was introduced are not skipped.
+  properties = CollectProperties({dockv::DocKey(dockv::KeyEntryValues{
+      dockv::KeyEntryValue::Int64(1)})});
+  ASSERT_EQ(properties.count(kColocationIdsPropertyName), 0);
+  ASSERT_TRUE(ColocationIdsMayContain(properties, 0x10000));
+}
+
+TEST(DocColocationFilterTest, TableTombstone) {
+  auto properties = CollectProperties(
+      {ColocatedKey(0x10000, 1), ColocatedKey(0x10000, 2), ColocatedKey(0x20000, 1)},
+      {HybridTime::FromMicros(1000), HybridTime::FromMicros(3000), HybridTime::FromMicros(2000)});
+  // All rows are older than the tombstone.
+  ASSERT_FALSE(ColocationIdsMayContain(properties, 0x10000, HybridTime::FromMicros(4000)));
+  ASSERT_FALSE(ColocationIdsMayContain(properties, 0x20000, HybridTime::FromMicros(2500)));
+  // Some rows are not older than the tombstone.
+  ASSERT_TRUE(ColocationIdsMayContain(properties, 0x10000, HybridTime::FromMicros(2000)));
+  ASSERT_TRUE(ColocationIdsMayContain(properties, 0x20000, HybridTime::FromMicros(2000)));
+  ASSERT_TRUE(ColocationIdsMayContain(properties, 0x20000, HybridTime::kInvalid));
+
+  // Files without max hybrid times are skipped only by colocation ids.
+  properties.erase(kColocationMaxHybridTimesPropertyName);
+  ASSERT_TRUE(ColocationIdsMayContain(properties, 0x10000, HybridTime::FromMicros(4000)));
+  ASSERT_FALSE(ColocationIdsMayContain(properties, 0x30000, HybridTime::FromMicros(4000)));
+}
+
+TEST(DocColocationFilterTest, Overflow) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_docdb_max_colocation_ids_per_sst) = 2;
+  auto properties = CollectProperties({
+      ColocatedKey(0x10000, 1), ColocatedKey(0x20000, 1)});
+  ASSERT_FALSE(ColocationIdsMayContain(properties, 0x30000));
+
+  properties = CollectProperties({
+      ColocatedKey(0x10000, 1), ColocatedKey(0x20000, 1), ColocatedKey(0x30000, 1)});
+  ASSERT_EQ(properties.count(kColocationIdsPropertyName), 0);
+  ASSERT_TRUE(ColocationIdsMayContain(properties, 0x40000));
+
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_docdb_max_colocation_ids_per_sst) = 0;
+  properties = CollectProperties({ColocatedKey(0x10000, 1)});
+  ASSERT_TRUE(ColocationIdsMayContain(properties, 0x20000));
+}
+
+} // namespace yb::docdb
@@ -0,0 +1,183 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/doc_colocation_filter.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "yb/common/doc_hybrid_time.h"
+
+#include "yb/dockv/value_type.h"
+
+#include "yb/gutil/endian.h"
+
+#include "yb/rocksdb/table/table_reader.h"
+
+#include "yb/util/flags.h"
+#include "yb/util/format.h"
+
+DEFINE_RUNTIME_uint32(docdb_max_colocation_ids_per_sst, 1024,
+    "Maximal number of colocation ids, that are stored in the properties of a regular DB SST file "
+    "of a colocated tablet. Scans of a colocated table skip SST files without its rows, or with "
+    "only rows older than its last truncation. Files with more colocation ids are never skipped. "
+    "0 disables collection of colocation ids. Applied to SST files created after the change.");
+
+namespace yb::docdb {
+
+const char kColocationIdsPropertyName[] = "yb.colocation_ids";
+const char kColocationMaxHybridTimesPropertyName[] = "yb.colocation_max_hts";
+
+namespace {
+
+constexpr size_t kEncodedColocationIdSize = sizeof(ColocationId);
+
+class ColocationIdsCollector : public rocksdb::TablePropertiesCollector {
+ public:
+  explicit ColocationIdsCollector(size_t max_ids) : max_ids_(max_ids) {}
+
+  Status AddUserKey(
+      const Slice& key, const Slice& value, rocksdb::EntryType type, rocksdb::SequenceNumber seq,
+      uint64_t file_size) override {
+    if (overflow_ || key.size() <= kEncodedColocationIdSize ||
+        key[0] != dockv::KeyEntryTypeAsChar::kColocationId) {
+      return Status::OK();
+    }
+    auto colocation_id = BigEndian::Load32(key.data() + 1);
+    auto doc_ht = DocHybridTime::DecodeFromEnd(key);
+    auto ht = doc_ht.ok() ? doc_ht->hybrid_time() : HybridTime::kMax;
+    // Keys are ordered, so the same colocation id is usually seen by a range of keys.
+    if (!colocations_.empty() && colocations_.back().id == colocation_id) {
+      colocations_.back().max_ht.MakeAtLeast(ht);
+      return Status::OK();
+    }
+    if (colocations_.size() >= max_ids_) {
+      overflow_ = true;
+      colocations_.clear();
+      return Status::OK();
+    }
+    colocations_.push_back(ColocationInfo {
+      .id = colocation_id,
+      .max_ht = ht,
+    });
+    return Status::OK();
+  }
+
+  Status Finish(rocksdb::UserCollectedProperties* properties) override {
+    if (overflow_ || colocations_.empty()) {
+      return Status::OK();
+    }
+    std::sort(colocations_.begin(), colocations_.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.id < rhs.id;
+    });
+    std::string ids;
+    std::string max_hts;
+    for (size_t i = 0; i != colocations_.size(); ++i) {
+      const auto& info = colocations_[i];
+      if (i + 1 != colocations_.size() && colocations_[i + 1].id == info.id) {
+        colocations_[i + 1].max_ht.MakeAtLeast(info.max_ht);
+        continue;
+      }
+      char buffer[sizeof(uint64_t)];
+      BigEndian::Store32(buffer, info.id);
+      ids.append(buffer, kEncodedColocationIdSize);
+      BigEndian::Store64(buffer, info.max_ht.ToUint64());
+      max_hts.append(buffer, sizeof(uint64_t));
+    }
+    properties->emplace(kColocationIdsPropertyName, std::move(ids));
+    properties->emplace(kColocationMaxHybridTimesPropertyName, std::move(max_hts));
+    return Status::OK();
+  }
+
+  rocksdb::UserCollectedProperties GetReadableProperties() const override {
+    return {{"docdb.colocation_ids", overflow_ ? "overflow" : AsString(colocations_.size())}};
+  }
+
+  const char* Name() const override {
+    return "ColocationIdsCollector";
+  }
+
+ private:
+  struct ColocationInfo {
+    ColocationId id;
+    HybridTime max_ht;
+  };
+
+  const size_t max_ids_;
+  bool overflow_ = false;
+  std::vector<ColocationInfo> colocations_;
+};
+
+class ColocationIdsCollectorFactory : public rocksdb::TablePropertiesCollectorFactory {
+ public:
+  rocksdb::TablePropertiesCollector* CreateTablePropertiesCollector(
+      rocksdb::TablePropertiesCollectorFactory::Context context) override {
+    return new ColocationIdsCollector(FLAGS_docdb_max_colocation_ids_per_sst);
+  }
+
+  const char* Name() const override {
+    return "ColocationIdsCollectorFactory";
+  }
+};
+
+} // namespace
+
+std::shared_ptr<rocksdb::TablePropertiesCollectorFactory> CreateColocationIdsCollectorFactory() {
+  return std::make_shared<ColocationIdsCollectorFactory>();
+}
+
+bool ColocationIdsMayContain(
+    const rocksdb::UserCollectedProperties& properties, ColocationId colocation_id,
+    HybridTime table_tombstone_ht) {
+  auto it = properties.find(kColocationIdsPropertyName);
+  if (it == properties.end() || it->second.size() % kEncodedColocationIdSize != 0) {
+    return true;
+  }
+  const auto* data = it->second.data();
+  const auto num_ids = it->second.size() / kEncodedColocationIdSize;
+  size_t lower = 0;
+  size_t upper = num_ids;
+  while (lower < upper) {
+    auto middle = (lower + upper) / 2;
+    auto id = BigEndian::Load32(data + middle * kEncodedColocationIdSize);
+    if (id == colocation_id) {
+      lower = middle;
+      break;
+    }
+    if (id < colocation_id) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+  if (lower == upper) {
+    return false;
+  }
+  if (!table_tombstone_ht.is_valid()) {
+    return true;
+  }
+  it = properties.find(kColocationMaxHybridTimesPropertyName);
+  if (it == properties.end() || it->second.size() != num_ids * sizeof(uint64_t)) {
+    return true;
+  }
+  auto max_ht = HybridTime(BigEndian::Load64(it->second.data() + lower * sizeof(uint64_t)));
+  return max_ht >= table_tombstone_ht;
+}
+
+bool ColocationIdFileFilter::Filter(rocksdb::TableReader* reader) const {
+  auto properties = reader->GetTableProperties();
+  return !properties || ColocationIdsMayContain(properties->user_collected_properties,
+                                                colocation_id_, table_tombstone_ht_);
+}
+
+}  // namespace yb::docdb
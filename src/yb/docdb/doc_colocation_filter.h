@@ -0,0 +1,59 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <memory>
+
+#include "yb/common/common_fwd.h"
+#include "yb/common/hybrid_time.h"
+
+#include "yb/rocksdb/options.h"
+#include "yb/rocksdb/table_properties.h"
+
+namespace yb::docdb {
+
+// Regular DB SST files of a colocated tablet store the sorted list of colocation ids of their rows
+// in the user collected property with this name. The property is absent when the file has more
+// than docdb_max_colocation_ids_per_sst colocation ids, or was created before it was introduced.
+extern const char kColocationIdsPropertyName[];
+
+// Max hybrid times of entries of every colocation id listed in kColocationIdsPropertyName, in the
+// same order.
+extern const char kColocationMaxHybridTimesPropertyName[];
+
+std::shared_ptr<rocksdb::TablePropertiesCollectorFactory> CreateColocationIdsCollectorFactory();
+
+// Returns false only if properties contain the list of colocation ids, that does not include the
+// specified one. When table_tombstone_ht is valid, also returns false if all entries of the
+// specified colocation id are older than table_tombstone_ht, i.e. hidden by the table tombstone
+// written by TRUNCATE of the colocated table.
+bool ColocationIdsMayContain(
+    const rocksdb::UserCollectedProperties& properties, ColocationId colocation_id,
+    HybridTime table_tombstone_ht = HybridTime::kInvalid);
+
+// Filter that skips SST files without visible rows of the specified colocated table.
+class ColocationIdFileFilter : public rocksdb::TableAwareReadFileFilter {
+ public:
+  explicit ColocationIdFileFilter(
+      ColocationId colocation_id, HybridTime table_tombstone_ht = HybridTime::kInvalid)
+      : colocation_id_(colocation_id), table_tombstone_ht_(table_tombstone_ht) {}
+
+  bool Filter(rocksdb::TableReader* reader) const override;
+
+ private:
+  const ColocationId colocation_id_;
+  const HybridTime table_tombstone_ht_;
+};
+
+}  // namespace yb::docdb
@@ -35,6 +35,8 @@ struct DocOperationApplyData {
   // Whether we should restart seek while fetching entry from doc key.
   bool restart_seek;
   SchemaPackingProvider* schema_packing_provider;  // null okay
+  // Per request statistics of reads performed while applying operations, null okay.
+  const DocDBStatistics* statistics = nullptr;
 
   CoarseTimePoint deadline() const {
     return read_operation_data.deadline;
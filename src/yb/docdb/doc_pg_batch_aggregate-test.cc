@@ -0,0 +1,173 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <gtest/gtest.h>
+
+#include "yb/bfpg/tserver_opcodes.h"
+
+#include "yb/common/pgsql_protocol.pb.h"
+#include "yb/common/ql_value.h"
+#include "yb/common/schema.h"
+
+#include "yb/docdb/doc_expr.h"
+#include "yb/docdb/doc_pg_batch_aggregate.h"
+
+#include "yb/dockv/dockv_test_util.h"
+#include "yb/dockv/pg_row.h"
+#include "yb/dockv/reader_projection.h"
+
+#include "yb/util/random_util.h"
+#include "yb/util/test_macros.h"
+
+namespace yb::docdb {
+
+namespace {
+
+void AddTarget(bfpg::TSOpcode opcode, std::optional<int> column_id, PgsqlReadRequestPB* req) {
+  auto* tscall = req->add_targets()->mutable_tscall();
+  tscall->set_opcode(to_underlying(opcode));
+  auto* operand = tscall->add_operands();
+  if (column_id) {
+    operand->set_column_id(*column_id);
+  } else {
+    operand->mutable_value()->set_int64_value(1);
+  }
+}
+
+} // namespace
+
+TEST(DocPgBatchAggregateTest, MatchesRowByRowEvaluation) {
+  constexpr size_t kNumRows = 1000;
+  constexpr size_t kBatchSize = 64;
+  const std::vector<DataType> kTypes = {
+      DataType::INT8, DataType::INT16, DataType::INT32, DataType::INT64, DataType::FLOAT,
+      DataType::DOUBLE};
+
+  SchemaBuilder builder;
+  ASSERT_OK(builder.AddKeyColumn("key", DataType::INT64));
+  for (auto type : kTypes) {
+    ASSERT_OK(builder.AddNullableColumn(Format("v$0", builder.next_column_id()), type));
+  }
+  auto schema = builder.Build();
+  dockv::ReaderProjection projection(schema);
+
+  PgsqlReadRequestPB req;
+  req.set_is_aggregate(true);
+  AddTarget(bfpg::TSOpcode::kCount, std::nullopt, &req);
+  for (size_t idx = schema.num_key_columns(); idx != schema.num_columns(); ++idx) {
+    auto column_id = schema.column_id(idx).rep();
+    auto type = projection.columns[idx].data_type;
+    AddTarget(bfpg::TSOpcode::kCount, column_id, &req);
+    switch (type) {
+      case DataType::INT8:
+        AddTarget(bfpg::TSOpcode::kSumInt8, column_id, &req);
+        break;
+      case DataType::INT16:
+        AddTarget(bfpg::TSOpcode::kSumInt16, column_id, &req);
+        break;
+      case DataType::INT32:
+        AddTarget(bfpg::TSOpcode::kSumInt32, column_id, &req);
+        break;
+      case DataType::INT64:
+        AddTarget(bfpg::TSOpcode::kSumInt64, column_id, &req);
+        break;
+      case DataType::FLOAT:
+        AddTarget(bfpg::TSOpcode::kSumFloat, column_id, &req);
+        continue;
+      case DataType::DOUBLE:
+        AddTarget(bfpg::TSOpcode::kSumDouble, column_id, &req);
+        continue;
+      default:
+        FAIL() << "Unexpected type: " << type;
+    }
+    AddTarget(bfpg::TSOpcode::kMin, column_id, &req);
+    AddTarget(bfpg::TSOpcode::kMax, column_id, &req);
+  }
+
+  auto aggregator = DocPgBatchAggregator::TryCreate(req, projection);
+  ASSERT_TRUE(aggregator);
+  ASSERT_EQ(aggregator->num_targets(), static_cast<size_t>(req.targets().size()));
+
+  DocExprExecutor executor;
+  std::vector<QLValuePB> expected(req.targets().size());
+  dockv::PgTableRow row(projection);
+  dockv::PgTableRowBatch batch(projection);
+  for (size_t i = 0; i != kNumRows; ++i) {
+    row.Reset();
+    for (size_t idx = 0; idx != projection.size(); ++idx) {
+      // Column v1 is always null, other value columns are null in 1/4 of rows.
+      if (idx != 0 && (idx == 1 || RandomUniformInt(0, 3) == 0)) {
+        row.SetNull(idx);
+        continue;
+      }
+      ASSERT_OK(row.SetValueByColumnIdx(
+          idx, dockv::RandomQLValue(projection.columns[idx].data_type)));
+    }
+    for (int target_idx = 0; target_idx != req.targets().size(); ++target_idx) {
+      ASSERT_OK(executor.EvalTSCall(
+          req.targets(target_idx).tscall(), row, &expected[target_idx], &schema));
+    }
+    batch.Append(row);
+    if (batch.size() == kBatchSize) {
+      aggregator->Consume(batch);
+      batch.Reset();
+    }
+  }
+  aggregator->Consume(batch);
+
+  std::vector<qlexpr::QLExprResult> actual;
+  aggregator->Finish(&actual);
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i != expected.size(); ++i) {
+    SCOPED_TRACE(Format("Target: $0", req.targets(narrow_cast<int>(i)).ShortDebugString()));
+    ASSERT_EQ(expected[i].ShortDebugString(), actual[i].Value().ShortDebugString());
+  }
+}
+
+TEST(DocPgBatchAggregateTest, UnsupportedTargets) {
+  SchemaBuilder builder;
+  ASSERT_OK(builder.AddKeyColumn("key", DataType::INT64));
+  ASSERT_OK(builder.AddNullableColumn("str", DataType::STRING));
+  ASSERT_OK(builder.AddNullableColumn("dbl", DataType::DOUBLE));
+  auto schema = builder.Build();
+  dockv::ReaderProjection projection(schema);
+  auto str_id = schema.column_id(1).rep();
+  auto dbl_id = schema.column_id(2).rep();
+
+  {
+    PgsqlReadRequestPB req;
+    req.set_is_aggregate(true);
+    AddTarget(bfpg::TSOpcode::kCount, str_id, &req);
+    ASSERT_TRUE(DocPgBatchAggregator::TryCreate(req, projection));
+  }
+  {
+    PgsqlReadRequestPB req;
+    req.set_is_aggregate(true);
+    AddTarget(bfpg::TSOpcode::kMax, str_id, &req);
+    ASSERT_FALSE(DocPgBatchAggregator::TryCreate(req, projection));
+  }
+  {
+    PgsqlReadRequestPB req;
+    req.set_is_aggregate(true);
+    AddTarget(bfpg::TSOpcode::kMin, dbl_id, &req);
+    ASSERT_FALSE(DocPgBatchAggregator::TryCreate(req, projection));
+  }
+  {
+    PgsqlReadRequestPB req;
+    req.set_is_aggregate(true);
+    AddTarget(bfpg::TSOpcode::kSumInt64, dbl_id, &req);
+    ASSERT_FALSE(DocPgBatchAggregator::TryCreate(req, projection));
+  }
+}
+
+}  // namespace yb::docdb
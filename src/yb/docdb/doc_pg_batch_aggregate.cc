@@ -0,0 +1,355 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/doc_pg_batch_aggregate.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "yb/bfpg/tserver_opcodes.h"
+
+#include "yb/common/pgsql_protocol.pb.h"
+#include "yb/common/ql_value.h"
+
+#include "yb/dockv/pg_row.h"
+#include "yb/dockv/reader_projection.h"
+
+#include "yb/gutil/casts.h"
+
+#include "yb/util/bitmap.h"
+#include "yb/util/logging.h"
+
+namespace yb::docdb {
+
+namespace {
+
+std::optional<bfpg::TSOpcode> IntSumOpcode(DataType data_type) {
+  switch (data_type) {
+    case DataType::INT8: return bfpg::TSOpcode::kSumInt8;
+    case DataType::INT16: return bfpg::TSOpcode::kSumInt16;
+    case DataType::INT32: return bfpg::TSOpcode::kSumInt32;
+    case DataType::INT64: return bfpg::TSOpcode::kSumInt64;
+    default: return std::nullopt;
+  }
+}
+
+// Null entries of the batch have 0 datum, so they don't affect the sum.
+template <class T>
+int64_t SumIntColumn(const dockv::PgValueDatum* datums, size_t size) {
+  uint64_t sum = 0;
+  for (size_t i = 0; i != size; ++i) {
+    sum += static_cast<uint64_t>(static_cast<int64_t>(static_cast<T>(datums[i])));
+  }
+  return static_cast<int64_t>(sum);
+}
+
+int64_t SumIntColumn(DataType data_type, const dockv::PgValueDatum* datums, size_t size) {
+  switch (data_type) {
+    case DataType::INT8: return SumIntColumn<int8_t>(datums, size);
+    case DataType::INT16: return SumIntColumn<int16_t>(datums, size);
+    case DataType::INT32: return SumIntColumn<int32_t>(datums, size);
+    case DataType::INT64: return SumIntColumn<int64_t>(datums, size);
+    default: break;
+  }
+  FATAL_INVALID_ENUM_VALUE(DataType, data_type);
+}
+
+template <class T>
+T RealFromDatum(dockv::PgValueDatum datum) {
+  if constexpr (sizeof(T) == sizeof(uint32_t)) {
+    return bit_cast<T>(static_cast<uint32_t>(datum));
+  } else {
+    return bit_cast<T>(static_cast<uint64_t>(datum));
+  }
+}
+
+// Floating point values are summed in the row order, to get exactly the same result as row by row
+// evaluation.
+template <class T>
+void SumRealColumn(
+    const dockv::PgTableRowBatch& batch, size_t column_idx, bool* has_value, T* sum) {
+  const auto* datums = batch.datums(column_idx);
+  const auto* nulls = batch.HasNulls(column_idx) ? batch.null_bitmap(column_idx) : nullptr;
+  auto result = *sum;
+  auto result_has_value = *has_value;
+  for (size_t i = 0, size = batch.size(); i != size; ++i) {
+    if (nulls && BitmapTest(nulls, i)) {
+      continue;
+    }
+    auto value = RealFromDatum<T>(datums[i]);
+    result = result_has_value ? result + value : value;
+    result_has_value = true;
+  }
+  *sum = result;
+  *has_value = result_has_value;
+}
+
+template <class T, bool kMin>
+int64_t MinMaxColumn(
+    const dockv::PgTableRowBatch& batch, size_t column_idx, bool has_value, int64_t current) {
+  T result = has_value ? static_cast<T>(current)
+                       : (kMin ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min());
+  const auto* datums = batch.datums(column_idx);
+  const auto size = batch.size();
+  if (!batch.HasNulls(column_idx)) {
+    for (size_t i = 0; i != size; ++i) {
+      auto value = static_cast<T>(datums[i]);
+      result = kMin ? std::min(result, value) : std::max(result, value);
+    }
+  } else {
+    const auto* nulls = batch.null_bitmap(column_idx);
+    for (size_t i = 0; i != size; ++i) {
+      if (BitmapTest(nulls, i)) {
+        continue;
+      }
+      auto value = static_cast<T>(datums[i]);
+      result = kMin ? std::min(result, value) : std::max(result, value);
+    }
+  }
+  return result;
+}
+
+template <bool kMin>
+int64_t MinMaxColumn(
+    DataType data_type, const dockv::PgTableRowBatch& batch, size_t column_idx, bool has_value,
+    int64_t current) {
+  switch (data_type) {
+    case DataType::INT8: return MinMaxColumn<int8_t, kMin>(batch, column_idx, has_value, current);
+    case DataType::INT16: return MinMaxColumn<int16_t, kMin>(batch, column_idx, has_value, current);
+    case DataType::INT32: return MinMaxColumn<int32_t, kMin>(batch, column_idx, has_value, current);
+    case DataType::INT64: return MinMaxColumn<int64_t, kMin>(batch, column_idx, has_value, current);
+    default: break;
+  }
+  FATAL_INVALID_ENUM_VALUE(DataType, data_type);
+}
+
+} // namespace
+
+std::optional<DocPgBatchAggregator> DocPgBatchAggregator::TryCreate(
+    const PgsqlReadRequestPB& request, const dockv::ReaderProjection& projection) {
+  if (!request.is_aggregate() || request.targets().empty()) {
+    return std::nullopt;
+  }
+
+  DocPgBatchAggregator result;
+  result.targets_.reserve(request.targets().size());
+  for (const auto& expr : request.targets()) {
+    if (!expr.has_tscall() || expr.tscall().operands().empty()) {
+      return std::nullopt;
+    }
+    const auto& tscall = expr.tscall();
+    const auto& operand = *tscall.operands().begin();
+    const auto opcode = static_cast<bfpg::TSOpcode>(tscall.opcode());
+    Target target;
+    if (opcode == bfpg::TSOpcode::kCount) {
+      // Should match DocExprExecutor::EvalTSCall for kCount.
+      if (operand.has_column_id()) {
+        target.kind = PgBatchAggregateKind::kCountColumn;
+      } else if (operand.has_value() && IsNull(operand.value())) {
+        target.kind = PgBatchAggregateKind::kCountNone;
+      } else {
+        target.kind = PgBatchAggregateKind::kCountAll;
+      }
+    } else if (opcode == bfpg::TSOpcode::kSumInt8 || opcode == bfpg::TSOpcode::kSumInt16 ||
+               opcode == bfpg::TSOpcode::kSumInt32 || opcode == bfpg::TSOpcode::kSumInt64) {
+      target.kind = PgBatchAggregateKind::kSumInt;
+    } else if (opcode == bfpg::TSOpcode::kSumFloat) {
+      target.kind = PgBatchAggregateKind::kSumFloat;
+    } else if (opcode == bfpg::TSOpcode::kSumDouble) {
+      target.kind = PgBatchAggregateKind::kSumDouble;
+    } else if (opcode == bfpg::TSOpcode::kMin) {
+      target.kind = PgBatchAggregateKind::kMin;
+    } else if (opcode == bfpg::TSOpcode::kMax) {
+      target.kind = PgBatchAggregateKind::kMax;
+    } else {
+      return std::nullopt;
+    }
+
+    if (target.kind != PgBatchAggregateKind::kCountAll &&
+        target.kind != PgBatchAggregateKind::kCountNone) {
+      if (!operand.has_column_id()) {
+        return std::nullopt;
+      }
+      target.column_idx = projection.ColumnIdxById(ColumnId(operand.column_id()));
+      if (target.column_idx == dockv::ReaderProjection::kNotFoundIndex) {
+        return std::nullopt;
+      }
+      target.data_type = projection.columns[target.column_idx].data_type;
+    }
+
+    switch (target.kind) {
+      case PgBatchAggregateKind::kCountAll: [[fallthrough]];
+      case PgBatchAggregateKind::kCountNone: [[fallthrough]];
+      case PgBatchAggregateKind::kCountColumn:
+        break;
+      case PgBatchAggregateKind::kSumInt:
+        if (IntSumOpcode(target.data_type) != opcode) {
+          return std::nullopt;
+        }
+        break;
+      case PgBatchAggregateKind::kSumFloat:
+        if (target.data_type != DataType::FLOAT) {
+          return std::nullopt;
+        }
+        target.float_value = 0;
+        break;
+      case PgBatchAggregateKind::kSumDouble:
+        if (target.data_type != DataType::DOUBLE) {
+          return std::nullopt;
+        }
+        target.double_value = 0;
+        break;
+      case PgBatchAggregateKind::kMin: [[fallthrough]];
+      case PgBatchAggregateKind::kMax:
+        // Floating point min/max are not handled here, because of NaN ordering.
+        if (!IntSumOpcode(target.data_type)) {
+          return std::nullopt;
+        }
+        break;
+    }
+    result.targets_.push_back(target);
+  }
+  return result;
+}
+
+void DocPgBatchAggregator::Consume(const dockv::PgTableRowBatch& batch) {
+  const auto size = batch.size();
+  if (size == 0) {
+    return;
+  }
+  for (auto& target : targets_) {
+    switch (target.kind) {
+      case PgBatchAggregateKind::kCountAll:
+        target.int_value += size;
+        target.has_value = true;
+        break;
+      case PgBatchAggregateKind::kCountNone:
+        break;
+      case PgBatchAggregateKind::kCountColumn: {
+        auto count = size - batch.NumNulls(target.column_idx);
+        if (count) {
+          target.int_value += count;
+          target.has_value = true;
+        }
+        break;
+      }
+      case PgBatchAggregateKind::kSumInt:
+        if (size != batch.NumNulls(target.column_idx)) {
+          target.int_value = static_cast<int64_t>(
+              static_cast<uint64_t>(target.int_value) + static_cast<uint64_t>(
+                  SumIntColumn(target.data_type, batch.datums(target.column_idx), size)));
+          target.has_value = true;
+        }
+        break;
+      case PgBatchAggregateKind::kSumFloat:
+        SumRealColumn(batch, target.column_idx, &target.has_value, &target.float_value);
+        break;
+      case PgBatchAggregateKind::kSumDouble:
+        SumRealColumn(batch, target.column_idx, &target.has_value, &target.double_value);
+        break;
+      case PgBatchAggregateKind::kMin: [[fallthrough]];
+      case PgBatchAggregateKind::kMax:
+        if (size != batch.NumNulls(target.column_idx)) {
+          target.int_value = target.kind == PgBatchAggregateKind::kMin
+              ? MinMaxColumn<true>(
+                    target.data_type, batch, target.column_idx, target.has_value,
+                    target.int_value)
+              : MinMaxColumn<false>(
+                    target.data_type, batch, target.column_idx, target.has_value,
+                    target.int_value);
+          target.has_value = true;
+        }
+        break;
+    }
+  }
+}
+
+bool DocPgBatchAggregator::IsMergeable() const {
+  for (const auto& target : targets_) {
+    if (target.kind == PgBatchAggregateKind::kSumFloat ||
+        target.kind == PgBatchAggregateKind::kSumDouble) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void DocPgBatchAggregator::Merge(const DocPgBatchAggregator& other) {
+  DCHECK_EQ(targets_.size(), other.targets_.size());
+  for (size_t i = 0; i != targets_.size(); ++i) {
+    auto& target = targets_[i];
+    const auto& other_target = other.targets_[i];
+    if (!other_target.has_value) {
+      continue;
+    }
+    if (!target.has_value) {
+      target = other_target;
+      continue;
+    }
+    switch (target.kind) {
+      case PgBatchAggregateKind::kCountAll: [[fallthrough]];
+      case PgBatchAggregateKind::kCountNone: [[fallthrough]];
+      case PgBatchAggregateKind::kCountColumn: [[fallthrough]];
+      case PgBatchAggregateKind::kSumInt:
+        target.int_value = static_cast<int64_t>(
+            static_cast<uint64_t>(target.int_value) +
+            static_cast<uint64_t>(other_target.int_value));
+        break;
+      case PgBatchAggregateKind::kSumFloat:
+        target.float_value += other_target.float_value;
+        break;
+      case PgBatchAggregateKind::kSumDouble:
+        target.double_value += other_target.double_value;
+        break;
+      case PgBatchAggregateKind::kMin:
+        target.int_value = std::min(target.int_value, other_target.int_value);
+        break;
+      case PgBatchAggregateKind::kMax:
+        target.int_value = std::max(target.int_value, other_target.int_value);
+        break;
+    }
+  }
+}
+
+void DocPgBatchAggregator::Finish(std::vector<qlexpr::QLExprResult>* out) const {
+  out->resize(targets_.size());
+  for (size_t i = 0; i != targets_.size(); ++i) {
+    const auto& target = targets_[i];
+    auto& value = (*out)[i].ForceNewValue();
+    value.Clear();
+    if (!target.has_value) {
+      continue;
+    }
+    switch (target.kind) {
+      case PgBatchAggregateKind::kCountAll: [[fallthrough]];
+      case PgBatchAggregateKind::kCountNone: [[fallthrough]];
+      case PgBatchAggregateKind::kCountColumn: [[fallthrough]];
+      case PgBatchAggregateKind::kSumInt:
+        value.set_int64_value(target.int_value);
+        break;
+      case PgBatchAggregateKind::kSumFloat:
+        value.set_float_value(target.float_value);
+        break;
+      case PgBatchAggregateKind::kSumDouble:
+        value.set_double_value(target.double_value);
+        break;
+      case PgBatchAggregateKind::kMin: [[fallthrough]];
+      case PgBatchAggregateKind::kMax:
+        value = dockv::PgValue(static_cast<dockv::PgValueDatum>(target.int_value))
+            .ToQLValuePB(target.data_type);
+        break;
+    }
+  }
+}
+
+}  // namespace yb::docdb
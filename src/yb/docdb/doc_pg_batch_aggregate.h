@@ -0,0 +1,84 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "yb/common/pgsql_protocol.fwd.h"
+#include "yb/common/value.pb.h"
+
+#include "yb/dockv/dockv_fwd.h"
+
+#include "yb/qlexpr/ql_expr.h"
+
+#include "yb/util/enums.h"
+
+namespace yb::docdb {
+
+YB_DEFINE_ENUM(
+    PgBatchAggregateKind,
+    (kCountAll)(kCountNone)(kCountColumn)(kSumInt)(kSumFloat)(kSumDouble)(kMin)(kMax));
+
+// Evaluates pushed down COUNT/SUM/MIN/MAX over column-major row batches.
+//
+// Used instead of per row DocExprExecutor::EvalTSCall when every aggregate target of the request
+// is a plain column reference to a fixed width column. Each target is accumulated by a typed
+// kernel working directly on the batch datums, without constructing intermediate QLValuePB.
+// Kernels are written as simple loops over contiguous arrays, so compiler could vectorize them.
+// Results are exactly the same as produced by DocExprExecutor, including the order of floating
+// point additions.
+class DocPgBatchAggregator {
+ public:
+  // Returns aggregator if all targets of the request could be evaluated by batch kernels.
+  static std::optional<DocPgBatchAggregator> TryCreate(
+      const PgsqlReadRequestPB& request, const dockv::ReaderProjection& projection);
+
+  void Consume(const dockv::PgTableRowBatch& batch);
+
+  // Whether aggregates accumulated over adjacent row ranges could be merged, getting the same
+  // result as accumulated over the whole range. Not true for floating point sums, since the order
+  // of additions would change.
+  bool IsMergeable() const;
+
+  // Merges aggregates accumulated by other aggregator, created for the same request, over rows
+  // that follow rows consumed by this aggregator.
+  void Merge(const DocPgBatchAggregator& other);
+
+  // Stores accumulated values to the aggregate results, in order of request targets.
+  void Finish(std::vector<qlexpr::QLExprResult>* out) const;
+
+  size_t num_targets() const {
+    return targets_.size();
+  }
+
+ private:
+  struct Target {
+    PgBatchAggregateKind kind;
+    size_t column_idx = 0;
+    DataType data_type = DataType::UNKNOWN_DATA;
+    bool has_value = false;
+    union {
+      int64_t int_value = 0;
+      float float_value;
+      double double_value;
+    };
+  };
+
+  DocPgBatchAggregator() = default;
+
+  std::vector<Target> targets_;
+};
+
+}  // namespace yb::docdb
@@ -0,0 +1,66 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <optional>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "yb/docdb/doc_pg_block_sampler.h"
+
+#include "yb/util/test_macros.h"
+
+namespace yb::docdb {
+
+namespace {
+
+// Tablet covering a quarter of the hash space, with the same number of rows at each hash code.
+constexpr uint32_t kTabletStart = 0x4000;
+constexpr uint32_t kTabletEnd = 0x8000;
+constexpr uint64_t kRowsPerHash = 8;
+constexpr uint64_t kNumRows = (kTabletEnd - kTabletStart) * kRowsPerHash;
+
+// Scans the tablet, seeking to hash codes returned by the sampler.
+void ScanTablet(DocPgBlockSampler* sampler) {
+  uint32_t hash = kTabletStart;
+  while (hash < kTabletEnd) {
+    std::optional<uint32_t> seek_hash;
+    for (uint64_t i = 0; i != kRowsPerHash && !seek_hash; ++i) {
+      seek_hash = sampler->RowRead(hash);
+    }
+    hash = seek_hash ? *seek_hash : hash + 1;
+  }
+}
+
+} // namespace
+
+TEST(DocPgBlockSamplerTest, ReadAll) {
+  DocPgBlockSampler sampler(1 /* stride */, 64 /* block_rows */);
+  ScanTablet(&sampler);
+  ASSERT_EQ(sampler.rows_read(), kNumRows);
+  ASSERT_DOUBLE_EQ(sampler.EstimatedRows(), kNumRows);
+}
+
+TEST(DocPgBlockSamplerTest, Estimate) {
+  constexpr uint32_t kStride = 8;
+  std::mt19937_64 rng(42);
+  DocPgBlockSampler sampler(kStride, 64 /* block_rows */, &rng);
+  ScanTablet(&sampler);
+
+  ASSERT_GE(sampler.rows_read(), kNumRows / kStride / 2);
+  ASSERT_LE(sampler.rows_read(), kNumRows / kStride * 2);
+  ASSERT_GE(sampler.EstimatedRows(), kNumRows * 0.9);
+  ASSERT_LE(sampler.EstimatedRows(), kNumRows * 1.1);
+}
+
+} // namespace yb::docdb
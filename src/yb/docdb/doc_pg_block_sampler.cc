@@ -0,0 +1,70 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/doc_pg_block_sampler.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "yb/util/random_util.h"
+
+namespace yb::docdb {
+
+DocPgBlockSampler::DocPgBlockSampler(
+    uint32_t stride, uint32_t block_rows, std::mt19937_64* rng)
+    : stride_(std::max<uint32_t>(stride, 1)), block_rows_(std::max<uint32_t>(block_rows, 1)),
+      rng_(rng) {
+}
+
+std::optional<uint32_t> DocPgBlockSampler::RowRead(DocKeyHash hash) {
+  if (block_rows_read_ == 0) {
+    if (rows_read_ == 0) {
+      block_start_ = hash;
+    } else {
+      skipped_span_ += pending_skip_;
+      pending_skip_ = 0;
+    }
+  }
+  ++rows_read_;
+  ++block_rows_read_;
+  last_hash_ = hash;
+  if (block_rows_read_ < block_rows_ || stride_ == 1) {
+    return std::nullopt;
+  }
+
+  const uint64_t block_span = last_hash_ - block_start_ + 1;
+  read_span_ += block_span;
+  block_rows_read_ = 0;
+  // Uniform in [0, 2 * (stride - 1) * block_span], so the mean is (stride - 1) * block_span.
+  pending_skip_ = RandomUniformInt<uint64_t>(0, 2 * (stride_ - 1) * block_span, rng_);
+  const auto next_block_start = last_hash_ + 1 + pending_skip_;
+  block_start_ = static_cast<uint32_t>(
+      std::min<uint64_t>(next_block_start, std::numeric_limits<uint32_t>::max()));
+  return block_start_;
+}
+
+double DocPgBlockSampler::EstimatedRows() const {
+  uint64_t read_span = read_span_;
+  if (block_rows_read_ != 0) {
+    read_span += last_hash_ - std::min(block_start_, last_hash_) + 1;
+  }
+  if (read_span == 0) {
+    return static_cast<double>(rows_read_);
+  }
+  // The tablet ends somewhere in the last skipped range, if a row was not read after it, so half of
+  // this range is accounted.
+  const double skipped_span = skipped_span_ + pending_skip_ / 2.0;
+  return rows_read_ + skipped_span * rows_read_ / read_span;
+}
+
+} // namespace yb::docdb
@@ -0,0 +1,72 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <random>
+
+#include "yb/docdb/docdb_fwd.h"
+
+namespace yb::docdb {
+
+// Picks blocks of consecutive rows of a hash partitioned tablet to be read by ANALYZE sampling,
+// so only a fraction of the tablet is read.
+//
+// Rows are uniformly distributed over hash codes, so a block that starts at a random hash code is a
+// random sample of the tablet. After each block of block_rows rows the scan skips a random range of
+// hash codes, on average stride - 1 times as wide as the range covered by the block. The number of
+// rows in the skipped ranges is estimated from the density of rows in the read blocks.
+//
+// Usage: call RowRead for each scanned row, and when it returns a hash code, seek the scan to it.
+class DocPgBlockSampler {
+ public:
+  // rng is used to pick skipped ranges, nullptr for the thread local generator.
+  DocPgBlockSampler(uint32_t stride, uint32_t block_rows, std::mt19937_64* rng = nullptr);
+
+  // Registers a row read at the specified hash code. Returns the hash code to seek to when the
+  // current block is complete. The returned hash code exceeds the max hash code when the rest of
+  // the tablet should be skipped.
+  std::optional<uint32_t> RowRead(DocKeyHash hash);
+
+  // Number of rows read so far.
+  uint64_t rows_read() const {
+    return rows_read_;
+  }
+
+  // Estimated number of rows in the part of the tablet passed by the scan, both read and skipped.
+  double EstimatedRows() const;
+
+ private:
+  const uint32_t stride_;
+  const uint32_t block_rows_;
+  std::mt19937_64* const rng_;
+
+  uint64_t rows_read_ = 0;
+  // Number of hash codes covered by completed blocks.
+  uint64_t read_span_ = 0;
+  // Number of hash codes skipped between blocks.
+  uint64_t skipped_span_ = 0;
+
+  // Number of rows read in the current block.
+  uint32_t block_rows_read_ = 0;
+  // First hash code of the current block.
+  uint32_t block_start_ = 0;
+  uint32_t last_hash_ = 0;
+  // Width of the last skipped range. It is accounted as skipped only when a row is read after it,
+  // because the tablet could end inside of it.
+  uint64_t pending_skip_ = 0;
+};
+
+} // namespace yb::docdb
@@ -14,7 +14,10 @@
 #include "yb/docdb/doc_pg_expr.h"
 
 #include <map>
+#include <memory>
 #include <optional>
+#include <string>
+#include <unordered_map>
 #include <utility>
 
 #include <boost/container/small_vector.hpp>
@@ -28,10 +31,18 @@
 
 #include "ybgate/ybgate_api.h"
 
+#include "yb/util/flags.h"
 #include "yb/util/logging.h"
+#include "yb/util/status_log.h"
 
 #include "yb/yql/pggate/pg_value.h"
 
+DEFINE_RUNTIME_uint32(ysql_pushdown_expr_cache_size, 256,
+    "Max number of deserialized pushed down YSQL expressions cached per thread, so requests of "
+    "the same prepared statement do not deserialize the same expressions again. 0 disables the "
+    "cache.");
+TAG_FLAG(ysql_pushdown_expr_cache_size, advanced);
+
 namespace yb::docdb {
 namespace {
 
@@ -71,6 +82,69 @@ class MemoryContextGuard {
   DISALLOW_COPY_AND_ASSIGN(MemoryContextGuard);
 };
 
+// Deserialized Postgres expression with its own memory context, so it could outlive the executor
+// that requested it. Evaluation does not modify the expression, so it could be shared by multiple
+// executors.
+class CachedPgExpr {
+ public:
+  CachedPgExpr() = default;
+
+  ~CachedPgExpr() {
+    if (!mem_ctx_) {
+      return;
+    }
+    MemoryContextGuard mem_guard(YbgSetCurrentMemoryContext(mem_ctx_));
+    WARN_NOT_OK(DeleteMemoryContext(), "Failed to delete cached expression memory context");
+  }
+
+  Status Init(const std::string& expr_str) {
+    RETURN_NOT_OK(CreateMemoryContext(nullptr, "DocPg Cached Expression Context", &mem_ctx_));
+    MemoryContextGuard mem_guard(YbgSetCurrentMemoryContext(mem_ctx_));
+    return DocPgPrepareExpr(expr_str, &expr_, &expr_type_);
+  }
+
+  YbgPreparedExpr expr() const {
+    return expr_;
+  }
+
+  const DocPgVarRef& expr_type() const {
+    return expr_type_;
+  }
+
+ private:
+  YbgMemoryContext mem_ctx_ = nullptr;
+  YbgPreparedExpr expr_ = nullptr;
+  DocPgVarRef expr_type_{};
+
+  DISALLOW_COPY_AND_ASSIGN(CachedPgExpr);
+};
+
+using CachedPgExprPtr = std::shared_ptr<const CachedPgExpr>;
+
+// Returns deserialized expression, reusing the one deserialized by a previous request processed
+// by the current thread if any. Postgres memory contexts are thread local, so the cache is thread
+// local as well.
+Result<CachedPgExprPtr> GetCachedPgExpr(const std::string& expr_str) {
+  thread_local std::unordered_map<std::string, CachedPgExprPtr> cache;
+  const size_t max_size = FLAGS_ysql_pushdown_expr_cache_size;
+  if (max_size) {
+    auto it = cache.find(expr_str);
+    if (it != cache.end()) {
+      return it->second;
+    }
+  }
+  auto result = std::make_shared<CachedPgExpr>();
+  RETURN_NOT_OK(result->Init(expr_str));
+  if (max_size) {
+    // Executors keep references to expressions they use, so it is safe to drop all of them.
+    if (cache.size() >= max_size) {
+      cache.clear();
+    }
+    cache.emplace(expr_str, result);
+  }
+  return result;
+}
+
 class ColumnIdxResolver {
  public:
   ColumnIdxResolver(
@@ -190,11 +264,14 @@ class TSCallExecutor {
     RSTATUS_DCHECK(!row_ctx_, InternalError, "Can not add expression, execution has started");
     // Retrieve string representing the expression
     const auto& expr_str = tscall.operands(0).value().string_value();
-    // Make sure expression is in the right memory context
-    MemoryContextGuard mem_guard(YbgSetCurrentMemoryContext(mem_ctx_));
-    // Perform deserialization and get result data type info
-    YbgPreparedExpr prepared_expr = nullptr;
-    RETURN_NOT_OK(DocPgPrepareExpr(expr_str, &prepared_expr, expr_type));
+    // Perform deserialization, or reuse the expression deserialized earlier, and get result data
+    // type info
+    auto cached_expr = VERIFY_RESULT(GetCachedPgExpr(expr_str));
+    YbgPreparedExpr prepared_expr = cached_expr->expr();
+    if (expr_type) {
+      *expr_type = cached_expr->expr_type();
+    }
+    cached_exprs_.push_back(std::move(cached_expr));
     if (tscall.operands_size() > 1) {
       // Pre-pushdown nodes e.g. v2.12 may create and send serialized PG expression when executing
       // statements like UPDATE table SET col = col + 1 WHERE pk = 1; during upgrade.
@@ -265,6 +342,8 @@ class TSCallExecutor {
   // Container for Postgres-format data retrieved from the DocDB row.
   // Provides fast access to is_nulls and datums by index(attribute number).
   YbgExprContext expr_ctx_ = nullptr;
+  // Deserialized expressions used by where clause and targets.
+  boost::container::small_vector<CachedPgExprPtr, 8> cached_exprs_;
   // Where clause expressions
   boost::container::small_vector<YbgPreparedExpr, 8> where_clause_;
   // Target expressions with their type info
@@ -0,0 +1,147 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "yb/bfpg/tserver_opcodes.h"
+
+#include "yb/common/pgsql_protocol.pb.h"
+#include "yb/common/ql_value.h"
+#include "yb/common/schema.h"
+
+#include "yb/docdb/doc_expr.h"
+#include "yb/docdb/doc_pg_grouped_aggregate.h"
+
+#include "yb/dockv/pg_row.h"
+#include "yb/dockv/reader_projection.h"
+
+#include "yb/util/flags.h"
+#include "yb/util/test_macros.h"
+
+#include "yb/yql/pggate/util/pg_doc_data.h"
+
+DECLARE_uint64(ysql_pushdown_aggregate_max_groups);
+
+namespace yb::docdb {
+
+namespace {
+
+void AddTarget(bfpg::TSOpcode opcode, int column_id, PgsqlReadRequestPB* req) {
+  auto* tscall = req->add_targets()->mutable_tscall();
+  tscall->set_opcode(to_underlying(opcode));
+  tscall->add_operands()->set_column_id(column_id);
+}
+
+class DocPgGroupedAggregateTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    SchemaBuilder builder;
+    ASSERT_OK(builder.AddKeyColumn("key", DataType::INT64));
+    ASSERT_OK(builder.AddColumn("grp", DataType::INT32));
+    ASSERT_OK(builder.AddColumn("val", DataType::INT64));
+    schema_ = builder.Build();
+    projection_.Init(schema_, {schema_.column_id(0).rep(), schema_.column_id(1).rep(),
+                               schema_.column_id(2).rep()});
+
+    // SELECT grp, COUNT(val), SUM(val), MAX(val) ... GROUP BY grp
+    req_.set_is_aggregate(true);
+    req_.set_num_group_by_targets(1);
+    req_.add_targets()->set_column_id(schema_.column_id(1).rep());
+    const auto val_id = schema_.column_id(2).rep();
+    AddTarget(bfpg::TSOpcode::kCount, val_id, &req_);
+    AddTarget(bfpg::TSOpcode::kSumInt64, val_id, &req_);
+    AddTarget(bfpg::TSOpcode::kMax, val_id, &req_);
+  }
+
+  void FillRow(int64_t key, int32_t group, dockv::PgTableRow* row) {
+    row->Reset();
+    ASSERT_OK(row->SetValueByColumnIdx(0, QLValue::Primitive(key)));
+    ASSERT_OK(row->SetValueByColumnIdx(1, QLValue::Primitive(group)));
+    ASSERT_OK(row->SetValueByColumnIdx(2, QLValue::Primitive(key * 3)));
+  }
+
+  Schema schema_;
+  dockv::ReaderProjection projection_;
+  PgsqlReadRequestPB req_;
+};
+
+} // namespace
+
+TEST_F(DocPgGroupedAggregateTest, MatchesPerGroupEvaluation) {
+  constexpr int kNumRows = 1000;
+  constexpr int kNumGroups = 7;
+
+  DocExprExecutor executor;
+  DocPgGroupedAggregator aggregator(req_, &executor);
+  std::vector<std::vector<QLValuePB>> expected(
+      kNumGroups, std::vector<QLValuePB>(req_.targets().size()));
+  dockv::PgTableRow row(projection_);
+  for (int i = 0; i != kNumRows; ++i) {
+    const int group = i % kNumGroups;
+    FillRow(i, group, &row);
+    ASSERT_OK(aggregator.Consume(row));
+    auto& group_expected = expected[group];
+    group_expected[0] = QLValue::Primitive(group);
+    for (int target_idx = 1; target_idx != req_.targets().size(); ++target_idx) {
+      ASSERT_OK(executor.EvalTSCall(
+          req_.targets(target_idx).tscall(), row, &group_expected[target_idx], &schema_));
+    }
+  }
+  ASSERT_EQ(aggregator.num_groups(), static_cast<size_t>(kNumGroups));
+  ASSERT_FALSE(aggregator.IsFull());
+
+  // Order of groups is not specified, so compare sorted rows. All columns have fixed width, so all
+  // rows have the same size.
+  std::vector<std::string> expected_rows;
+  for (const auto& values : expected) {
+    WriteBuffer buffer(1024);
+    for (const auto& value : values) {
+      ASSERT_OK(pggate::WriteColumn(value, &buffer));
+    }
+    expected_rows.push_back(buffer.ToBuffer());
+  }
+  WriteBuffer out(1024);
+  ASSERT_OK(aggregator.Finish(&out));
+  const auto actual = out.ToBuffer();
+  const auto row_size = expected_rows.front().size();
+  ASSERT_EQ(actual.size(), row_size * kNumGroups);
+  std::vector<std::string> actual_rows;
+  for (size_t pos = 0; pos != actual.size(); pos += row_size) {
+    actual_rows.push_back(actual.substr(pos, row_size));
+  }
+  std::sort(expected_rows.begin(), expected_rows.end());
+  std::sort(actual_rows.begin(), actual_rows.end());
+  ASSERT_EQ(expected_rows, actual_rows);
+}
+
+TEST_F(DocPgGroupedAggregateTest, MaxGroups) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_ysql_pushdown_aggregate_max_groups) = 3;
+
+  DocExprExecutor executor;
+  DocPgGroupedAggregator aggregator(req_, &executor);
+  dockv::PgTableRow row(projection_);
+  for (int i = 0; i != 3; ++i) {
+    ASSERT_FALSE(aggregator.IsFull());
+    // Rows of existing groups do not add groups.
+    for (int j = 0; j != 5; ++j) {
+      FillRow(i * 5 + j, i, &row);
+      ASSERT_OK(aggregator.Consume(row));
+    }
+    ASSERT_EQ(aggregator.num_groups(), static_cast<size_t>(i + 1));
+  }
+  ASSERT_TRUE(aggregator.IsFull());
+}
+
+}  // namespace yb::docdb
@@ -0,0 +1,85 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/doc_pg_grouped_aggregate.h"
+
+#include <algorithm>
+
+#include "yb/common/pgsql_protocol.pb.h"
+
+#include "yb/dockv/pg_row.h"
+
+#include "yb/gutil/casts.h"
+
+#include "yb/util/flags.h"
+
+#include "yb/yql/pggate/util/pg_doc_data.h"
+
+DEFINE_RUNTIME_uint64(ysql_pushdown_aggregate_max_groups, 10000,
+    "Max number of groups accumulated by a pushed down GROUP BY aggregate read before the scan "
+    "stops and returns partial results of the groups to the client. Limits memory used by the "
+    "aggregation.");
+TAG_FLAG(ysql_pushdown_aggregate_max_groups, advanced);
+
+namespace yb::docdb {
+
+DocPgGroupedAggregator::DocPgGroupedAggregator(
+    const PgsqlReadRequestPB& request, qlexpr::QLExprExecutor* executor)
+    : request_(request), executor_(*executor),
+      num_group_by_targets_(request.num_group_by_targets()),
+      max_groups_(std::max<uint64_t>(FLAGS_ysql_pushdown_aggregate_max_groups, 1)),
+      group_by_values_(num_group_by_targets_) {
+}
+
+Status DocPgGroupedAggregator::Consume(const dockv::PgTableRow& row) {
+  key_buffer_.clear();
+  for (size_t i = 0; i != num_group_by_targets_; ++i) {
+    auto& value = group_by_values_[i];
+    value = qlexpr::QLExprResult();
+    RETURN_NOT_OK(executor_.EvalExpr(request_.targets(narrow_cast<int>(i)), row, value.Writer()));
+    // Prefix each value with its size, so different sequences of values have different keys.
+    const auto& pb = value.Value();
+    const auto size = narrow_cast<uint32_t>(pb.ByteSizeLong());
+    key_buffer_.append(pointer_cast<const char*>(&size), sizeof(size));
+    pb.AppendToString(&key_buffer_);
+  }
+
+  auto [it, inserted] = groups_.try_emplace(key_buffer_);
+  auto& results = it->second;
+  if (inserted) {
+    results.resize(request_.targets().size());
+    for (size_t i = 0; i != num_group_by_targets_; ++i) {
+      results[i].ForceNewValue() = group_by_values_[i].Value();
+    }
+  }
+  for (auto i = num_group_by_targets_; i != results.size(); ++i) {
+    RETURN_NOT_OK(executor_.EvalExpr(
+        request_.targets(narrow_cast<int>(i)), row, results[i].Writer()));
+  }
+  return Status::OK();
+}
+
+bool DocPgGroupedAggregator::IsFull() const {
+  return groups_.size() >= max_groups_;
+}
+
+Status DocPgGroupedAggregator::Finish(WriteBuffer* out) {
+  for (auto& [key, results] : groups_) {
+    for (auto& result : results) {
+      RETURN_NOT_OK(pggate::WriteColumn(result.Value(), out));
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace yb::docdb
@@ -0,0 +1,69 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "yb/common/pgsql_protocol.fwd.h"
+
+#include "yb/dockv/dockv_fwd.h"
+
+#include "yb/qlexpr/ql_expr.h"
+
+#include "yb/util/status.h"
+#include "yb/util/write_buffer.h"
+
+namespace yb::docdb {
+
+// Evaluates pushed down aggregates per group of rows with the same values of grouping targets.
+//
+// The first num_group_by_targets targets of the request are grouping expressions, the rest are
+// aggregates. Groups are kept in a hash table keyed by the binary representation of grouping
+// values, so the client should group by values of types where binary equality matches Postgres
+// equality only.
+//
+// The number of groups is limited by ysql_pushdown_aggregate_max_groups. When the limit is reached
+// the scan should stop and return groups accumulated so far, so results are partial: the same group
+// could be returned by different pages and tablets, and the client merges them.
+class DocPgGroupedAggregator {
+ public:
+  // executor is used to evaluate targets and should outlive the aggregator.
+  DocPgGroupedAggregator(const PgsqlReadRequestPB& request, qlexpr::QLExprExecutor* executor);
+
+  Status Consume(const dockv::PgTableRow& row);
+
+  // Whether the number of groups reached the limit, so the scan should stop.
+  bool IsFull() const;
+
+  size_t num_groups() const {
+    return groups_.size();
+  }
+
+  // Writes a row per group to out: values of grouping targets followed by aggregate values.
+  Status Finish(WriteBuffer* out);
+
+ private:
+  const PgsqlReadRequestPB& request_;
+  qlexpr::QLExprExecutor& executor_;
+  const size_t num_group_by_targets_;
+  const size_t max_groups_;
+  std::string key_buffer_;
+  std::vector<qlexpr::QLExprResult> group_by_values_;
+  // Results of all request targets, per group.
+  std::unordered_map<std::string, std::vector<qlexpr::QLExprResult>> groups_;
+};
+
+}  // namespace yb::docdb
@@ -0,0 +1,137 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <algorithm>
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "yb/common/pgsql_protocol.pb.h"
+#include "yb/common/ql_value.h"
+#include "yb/common/schema.h"
+
+#include "yb/docdb/doc_expr.h"
+#include "yb/docdb/doc_pg_top_n.h"
+
+#include "yb/dockv/pg_row.h"
+#include "yb/dockv/reader_projection.h"
+
+#include "yb/util/test_macros.h"
+
+namespace yb::docdb {
+
+namespace {
+
+constexpr int kNumRows = 1000;
+constexpr int kLimit = 5;
+
+// Key of each 250th row is null, other keys are distinct. So there are less null keys than kLimit.
+std::optional<int32_t> SortValue(int row_idx) {
+  if (row_idx % 250 == 0) {
+    return std::nullopt;
+  }
+  return row_idx * 7 % kNumRows;
+}
+
+std::vector<std::string> SplitRows(const std::string& rows) {
+  std::vector<std::string> result;
+  std::string::size_type pos = 0;
+  for (auto next = rows.find(';'); next != std::string::npos; next = rows.find(';', pos)) {
+    result.push_back(rows.substr(pos, next - pos));
+    pos = next + 1;
+  }
+  return result;
+}
+
+// Scans kNumRows rows through the heap, and returns ids of kept rows in the returned order.
+Result<std::string> ScanTopN(bool is_descending, bool nulls_first) {
+  SchemaBuilder builder;
+  RETURN_NOT_OK(builder.AddKeyColumn("key", DataType::INT64));
+  RETURN_NOT_OK(builder.AddNullableColumn("val", DataType::INT32));
+  auto schema = builder.Build();
+  dockv::ReaderProjection projection(schema);
+
+  PgsqlReadRequestPB req;
+  req.set_top_n_limit(kLimit);
+  auto* sort_key = req.add_top_n_sort_keys();
+  sort_key->mutable_expr()->set_column_id(schema.column_id(1).rep());
+  sort_key->set_is_descending(is_descending);
+  sort_key->set_nulls_first(nulls_first);
+
+  DocExprExecutor executor;
+  DocPgTopNHeap heap(req, &executor);
+  dockv::PgTableRow row(projection);
+  for (int i = 0; i != kNumRows; ++i) {
+    row.Reset();
+    RETURN_NOT_OK(row.SetValueByColumnIdx(0, QLValue::Primitive(static_cast<int64_t>(i))));
+    auto value = SortValue(i);
+    if (value) {
+      RETURN_NOT_OK(row.SetValueByColumnIdx(1, QLValue::Primitive(*value)));
+    } else {
+      row.SetNull(1);
+    }
+    if (VERIFY_RESULT(heap.Accepts(row))) {
+      heap.Add(Format("$0;", i));
+    }
+  }
+  SCHECK_EQ(heap.size(), static_cast<size_t>(kLimit), IllegalState, "Wrong number of kept rows");
+  WriteBuffer out(1024);
+  SCHECK_EQ(heap.Finish(&out), static_cast<size_t>(kLimit), IllegalState, "Wrong number of rows");
+  return out.ToBuffer();
+}
+
+std::string ExpectedTopN(bool is_descending, bool nulls_first) {
+  std::vector<int> rows(kNumRows);
+  for (int i = 0; i != kNumRows; ++i) {
+    rows[i] = i;
+  }
+  std::stable_sort(rows.begin(), rows.end(), [is_descending, nulls_first](int lhs, int rhs) {
+    auto lhs_value = SortValue(lhs);
+    auto rhs_value = SortValue(rhs);
+    if (!lhs_value || !rhs_value) {
+      return lhs_value.has_value() != rhs_value.has_value() &&
+             lhs_value.has_value() != nulls_first;
+    }
+    return is_descending ? *lhs_value > *rhs_value : *lhs_value < *rhs_value;
+  });
+  std::string result;
+  for (int i = 0; i != kLimit; ++i) {
+    result += Format("$0;", rows[i]);
+  }
+  return result;
+}
+
+} // namespace
+
+TEST(DocPgTopNTest, Order) {
+  for (auto is_descending : {false, true}) {
+    for (auto nulls_first : {false, true}) {
+      SCOPED_TRACE(Format("Descending: $0, nulls first: $1", is_descending, nulls_first));
+      auto top_n = ASSERT_RESULT(ScanTopN(is_descending, nulls_first));
+      if (!nulls_first) {
+        ASSERT_EQ(top_n, ExpectedTopN(is_descending, nulls_first));
+        continue;
+      }
+      // Null rows are not ordered among themselves, so check only that they are first, followed by
+      // the only non null row.
+      auto top_n_rows = SplitRows(top_n);
+      auto expected_rows = SplitRows(ExpectedTopN(is_descending, nulls_first));
+      ASSERT_EQ(top_n_rows.back(), expected_rows.back());
+      std::sort(top_n_rows.begin(), top_n_rows.end());
+      std::sort(expected_rows.begin(), expected_rows.end());
+      ASSERT_EQ(top_n_rows, expected_rows);
+    }
+  }
+}
+
+}  // namespace yb::docdb
@@ -0,0 +1,98 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/doc_pg_top_n.h"
+
+#include <algorithm>
+
+#include "yb/common/pgsql_protocol.pb.h"
+#include "yb/common/ql_value.h"
+
+#include "yb/dockv/pg_row.h"
+
+#include "yb/gutil/casts.h"
+
+#include "yb/util/logging.h"
+
+namespace yb::docdb {
+
+DocPgTopNHeap::DocPgTopNHeap(const PgsqlReadRequestPB& request, qlexpr::QLExprExecutor* executor)
+    : request_(request), executor_(*executor), limit_(request.top_n_limit()),
+      pending_sort_values_(request.top_n_sort_keys().size()) {
+  DCHECK_GT(limit_, 0);
+  entries_.reserve(limit_);
+}
+
+Result<bool> DocPgTopNHeap::Accepts(const dockv::PgTableRow& row) {
+  for (int i = 0; i != request_.top_n_sort_keys().size(); ++i) {
+    qlexpr::QLExprResult value;
+    RETURN_NOT_OK(executor_.EvalExpr(request_.top_n_sort_keys(i).expr(), row, value.Writer()));
+    value.MoveTo(&pending_sort_values_[i]);
+  }
+  return entries_.size() < limit_ || Less(pending_sort_values_, entries_.front().sort_values);
+}
+
+void DocPgTopNHeap::Add(std::string row_data) {
+  auto less = [this](const Entry& lhs, const Entry& rhs) { return EntryLess(lhs, rhs); };
+  if (entries_.size() >= limit_) {
+    std::pop_heap(entries_.begin(), entries_.end(), less);
+    entries_.pop_back();
+  }
+  entries_.push_back(Entry {
+    .sort_values = pending_sort_values_,
+    .row_data = std::move(row_data),
+  });
+  std::push_heap(entries_.begin(), entries_.end(), less);
+}
+
+size_t DocPgTopNHeap::Finish(WriteBuffer* out) {
+  std::sort_heap(
+      entries_.begin(), entries_.end(),
+      [this](const Entry& lhs, const Entry& rhs) { return EntryLess(lhs, rhs); });
+  for (const auto& entry : entries_) {
+    out->Append(Slice(entry.row_data));
+  }
+  return entries_.size();
+}
+
+bool DocPgTopNHeap::Less(
+    const std::vector<QLValuePB>& lhs, const std::vector<QLValuePB>& rhs) const {
+  for (size_t i = 0; i != lhs.size(); ++i) {
+    const auto& key = request_.top_n_sort_keys(narrow_cast<int>(i));
+    const bool lhs_null = IsNull(lhs[i]);
+    const bool rhs_null = IsNull(rhs[i]);
+    int cmp;
+    if (lhs_null || rhs_null) {
+      if (lhs_null == rhs_null) {
+        continue;
+      }
+      cmp = lhs_null == key.nulls_first() ? -1 : 1;
+    } else {
+      cmp = Compare(lhs[i], rhs[i]);
+      if (cmp == 0) {
+        continue;
+      }
+      if (key.is_descending()) {
+        cmp = -cmp;
+      }
+    }
+    return cmp < 0;
+  }
+  return false;
+}
+
+bool DocPgTopNHeap::EntryLess(const Entry& lhs, const Entry& rhs) const {
+  return Less(lhs.sort_values, rhs.sort_values);
+}
+
+}  // namespace yb::docdb
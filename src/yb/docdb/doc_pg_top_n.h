@@ -0,0 +1,75 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "yb/common/pgsql_protocol.fwd.h"
+#include "yb/common/value.pb.h"
+
+#include "yb/dockv/dockv_fwd.h"
+
+#include "yb/qlexpr/ql_expr.h"
+
+#include "yb/util/status.h"
+#include "yb/util/write_buffer.h"
+
+namespace yb::docdb {
+
+// Keeps the first top_n_limit rows of a scan in order of top_n_sort_keys of the request.
+//
+// Rows are kept in a bounded heap with the last ranked row on top, so a row that is ranked after
+// all kept rows is rejected without encoding it. Sort keys are compared as DocDB values, so the
+// client should push down ordering by values of types where it matches Postgres ordering only.
+//
+// Usage: for each scanned row call Accepts, and when it returns true, encode the row and pass it
+// to Add. Finish writes kept rows in order.
+class DocPgTopNHeap {
+ public:
+  // executor is used to evaluate sort keys and should outlive the heap.
+  DocPgTopNHeap(const PgsqlReadRequestPB& request, qlexpr::QLExprExecutor* executor);
+
+  // Evaluates sort keys of the row, returns true if the row should be kept.
+  Result<bool> Accepts(const dockv::PgTableRow& row);
+
+  // Adds encoded row, that was accepted by the last call to Accepts.
+  void Add(std::string row_data);
+
+  // Writes kept rows to out in order, returns the number of written rows.
+  size_t Finish(WriteBuffer* out);
+
+  size_t size() const {
+    return entries_.size();
+  }
+
+ private:
+  struct Entry {
+    std::vector<QLValuePB> sort_values;
+    std::string row_data;
+  };
+
+  // Returns true if lhs is ranked before rhs.
+  bool Less(const std::vector<QLValuePB>& lhs, const std::vector<QLValuePB>& rhs) const;
+  bool EntryLess(const Entry& lhs, const Entry& rhs) const;
+
+  const PgsqlReadRequestPB& request_;
+  qlexpr::QLExprExecutor& executor_;
+  const size_t limit_;
+  std::vector<QLValuePB> pending_sort_values_;
+  // Max heap by rank, i.e. the last ranked row is on top.
+  std::vector<Entry> entries_;
+};
+
+}  // namespace yb::docdb
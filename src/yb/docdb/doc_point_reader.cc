@@ -0,0 +1,143 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/doc_point_reader.h"
+
+#include "yb/docdb/doc_read_context.h"
+#include "yb/docdb/doc_reader.h"
+#include "yb/docdb/docdb_statistics.h"
+#include "yb/docdb/docdb_rocksdb_util.h"
+#include "yb/docdb/intent_aware_iterator.h"
+
+#include "yb/dockv/doc_key.h"
+#include "yb/dockv/pg_row.h"
+#include "yb/dockv/reader_projection.h"
+
+#include "yb/rocksdb/db.h"
+
+#include "yb/util/logging.h"
+#include "yb/util/result.h"
+#include "yb/util/status_format.h"
+
+namespace yb::docdb {
+
+PgPointReader::PgPointReader(
+    const dockv::ReaderProjection& projection,
+    std::reference_wrapper<const DocReadContext> doc_read_context,
+    const TransactionOperationContext& txn_op_context,
+    const DocDB& doc_db,
+    const ReadOperationData& read_operation_data,
+    std::reference_wrapper<const ScopedRWOperation> pending_op,
+    const DocDBStatistics* statistics)
+    : projection_(projection),
+      doc_read_context_(doc_read_context),
+      txn_op_context_(txn_op_context),
+      doc_db_(doc_db),
+      read_operation_data_(read_operation_data),
+      pending_op_(pending_op),
+      statistics_(statistics) {
+}
+
+PgPointReader::~PgPointReader() = default;
+
+Status PgPointReader::Init(Slice min_tuple_id, Slice max_tuple_id) {
+  DCHECK(!iter_) << "Init should be called only once.";
+  FillKey(&row_key_, min_tuple_id);
+  KeyBuffer max_key;
+  FillKey(&max_key, max_tuple_id);
+  const bool is_fixed_point_get = VERIFY_RESULT(dockv::HashedOrFirstRangeComponentsEqual(
+      row_key_.AsSlice(), max_key.AsSlice()));
+  read_bounds_.lower.Reset(row_key_.AsSlice());
+  read_bounds_.upper.Reset(max_key.AsSlice());
+  read_bounds_.upper.AppendKeyEntryType(dockv::KeyEntryType::kMaxByte);
+
+  iter_ = CreateIntentAwareIterator(
+      doc_db_,
+      is_fixed_point_get ? BloomFilterMode::USE_BLOOM_FILTER
+                         : BloomFilterMode::DONT_USE_BLOOM_FILTER,
+      row_key_.AsSlice(),
+      rocksdb::kDefaultQueryId,
+      txn_op_context_,
+      read_operation_data_,
+      nullptr /* file_filter */,
+      nullptr /* iterate_upper_bound */,
+      statistics_,
+      &read_bounds_);
+
+  doc_reader_ = std::make_unique<DocDBTableReader>(
+      iter_.get(), read_operation_data_.deadline, &projection_, TableType::PGSQL_TABLE_TYPE,
+      doc_read_context_.schema_packing_storage, doc_read_context_.schema());
+  RETURN_NOT_OK(doc_reader_->UpdateTableTombstoneTime(VERIFY_RESULT(GetTableTombstoneTime(
+      row_key_.AsSlice(), doc_db_, txn_op_context_, read_operation_data_))));
+  key_decoder_.emplace(doc_read_context_.schema(), projection_);
+  return Status::OK();
+}
+
+Result<bool> PgPointReader::Fetch(Slice tuple_id, dockv::PgTableRow* row) {
+  RETURN_NOT_OK(pending_op_.GetAbortedStatus());
+  RSTATUS_DCHECK(iter_, IllegalState, "Point reader is not initialized");
+  if (row) {
+    row->Reset();
+  }
+
+  FillKey(&row_key_, tuple_id);
+  auto key = row_key_.AsSlice();
+  upperbound_.Assign(key);
+  upperbound_.PushBack(dockv::KeyEntryTypeAsChar::kHighest);
+  IntentAwareIteratorUpperboundScope upperbound_scope(upperbound_.AsSlice(), iter_.get());
+  // Moving forward from the previous row is cheaper, since the iterator could reuse its position.
+  if (!prev_row_key_.empty() && key > prev_row_key_.AsSlice()) {
+    iter_->SeekForward(key);
+  } else {
+    iter_->Seek(key);
+  }
+  prev_row_key_.Assign(key);
+
+  const auto& fetched_entry = VERIFY_RESULT_REF(iter_->Fetch());
+  if (!fetched_entry || !fetched_entry.key.starts_with(key)) {
+    return false;
+  }
+  const auto doc_found = VERIFY_RESULT(doc_reader_->GetFlat(&row_key_, fetched_entry, row));
+  if (doc_found == DocReaderResult::kNotFound) {
+    return false;
+  }
+  if (row) {
+    RETURN_NOT_OK(key_decoder_->Decode(
+        row_key_.AsSlice().WithoutPrefix(doc_read_context_.key_prefix_encoded_len()), row));
+  }
+  return true;
+}
+
+Status PgPointReader::Prefetch(const std::vector<Slice>& tuple_ids) {
+  std::vector<KeyBuffer> keys(tuple_ids.size());
+  std::vector<Slice> key_slices;
+  key_slices.reserve(tuple_ids.size());
+  for (size_t i = 0; i != tuple_ids.size(); ++i) {
+    FillKey(&keys[i], tuple_ids[i]);
+    key_slices.push_back(keys[i].AsSlice());
+  }
+  rocksdb::ReadOptions read_opts;
+  read_opts.query_id = rocksdb::kDefaultQueryId;
+  read_opts.statistics = statistics_ ? statistics_->RegularDBStatistics() : nullptr;
+  return doc_db_.regular->PrefetchKeys(read_opts, key_slices);
+}
+
+Result<HybridTime> PgPointReader::RestartReadHt() const {
+  return iter_ ? iter_->RestartReadHt() : HybridTime::kInvalid;
+}
+
+void PgPointReader::FillKey(KeyBuffer* out, Slice tuple_id) const {
+  out->Assign(doc_read_context_.table_key_prefix(), tuple_id);
+}
+
+}  // namespace yb::docdb
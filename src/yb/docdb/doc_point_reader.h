@@ -0,0 +1,89 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "yb/common/common_fwd.h"
+#include "yb/common/hybrid_time.h"
+#include "yb/common/transaction.h"
+
+#include "yb/docdb/docdb_fwd.h"
+#include "yb/docdb/key_bounds.h"
+#include "yb/docdb/read_operation_data.h"
+
+#include "yb/dockv/dockv_fwd.h"
+#include "yb/dockv/pg_key_decoder.h"
+
+#include "yb/util/kv_util.h"
+#include "yb/util/operation_counter.h"
+
+namespace yb::docdb {
+
+class DocDBTableReader;
+
+// Reads YSQL rows by exact tuple id, i.e. encoded doc key without cotable id / colocation id.
+//
+// Unlike DocRowwiseIterator it does not build scan spec and scan choices, and does not decode
+// fetched keys. Every fetch seeks to the row once and decodes only projected columns.
+// Key columns are decoded from the requested tuple id.
+class PgPointReader {
+ public:
+  PgPointReader(
+      const dockv::ReaderProjection& projection,
+      std::reference_wrapper<const DocReadContext> doc_read_context,
+      const TransactionOperationContext& txn_op_context,
+      const DocDB& doc_db,
+      const ReadOperationData& read_operation_data,
+      std::reference_wrapper<const ScopedRWOperation> pending_op,
+      const DocDBStatistics* statistics = nullptr);
+
+  ~PgPointReader();
+
+  // Prepares reader to fetch rows with tuple ids in [min_tuple_id, max_tuple_id].
+  Status Init(Slice min_tuple_id, Slice max_tuple_id);
+
+  // Fetches row with the specified tuple id. Returns false if there is no such row.
+  // Tuple ids of subsequent calls are expected to be ascending, but it is not required.
+  Result<bool> Fetch(Slice tuple_id, dockv::PgTableRow* row);
+
+  // Asks regular DB to prefetch data blocks of rows with the specified tuple ids, so following
+  // fetches of a large batch don't wait for IO one row at a time.
+  Status Prefetch(const std::vector<Slice>& tuple_ids);
+
+  Result<HybridTime> RestartReadHt() const;
+
+ private:
+  void FillKey(KeyBuffer* out, Slice tuple_id) const;
+
+  const dockv::ReaderProjection& projection_;
+  const DocReadContext& doc_read_context_;
+  const TransactionOperationContext txn_op_context_;
+  const DocDB doc_db_;
+  const ReadOperationData read_operation_data_;
+  const ScopedRWOperation& pending_op_;
+  const DocDBStatistics* statistics_;
+
+  KeyBounds read_bounds_;
+  std::unique_ptr<IntentAwareIterator> iter_;
+  std::unique_ptr<DocDBTableReader> doc_reader_;
+  std::optional<dockv::PgKeyDecoder> key_decoder_;
+  KeyBuffer row_key_;
+  KeyBuffer upperbound_;
+  KeyBuffer prev_row_key_;
+};
+
+}  // namespace yb::docdb
@@ -47,7 +47,9 @@
 #include "yb/util/logging.h"
 #include "yb/util/monotime.h"
 #include "yb/util/result.h"
+#include "yb/util/scope_exit.h"
 #include "yb/util/status.h"
+#include "yb/util/status_format.h"
 
 namespace yb::docdb {
 
@@ -195,6 +197,7 @@ struct GetId<FlatGetHelper<dockv::PgTableRow*>> {
 };
 
 constexpr size_t kNumDecoders = 5;
+constexpr size_t kNumCachedSchemaPackings = 4;
 
 } // namespace
 
@@ -313,48 +316,71 @@ class PackedRowData {
     DVLOG_WITH_FUNC(4)
         << "value: " << value.ToDebugHexString() << ", control fields: "
         << control_fields.ToString() << ", doc_ht: " << doc_ht->ToString()
-        << ", schema_packing_version: " << schema_packing_version_.AsSlice().ToDebugHexString();
+        << ", schema_packing_version: "
+        << (packing_ ? packing_->schema_packing_version.AsSlice().ToDebugHexString() : "<none>");
 
     doc_ht_ = doc_ht;
     control_fields_ = control_fields;
 
     size_t id = context->Id();
-    if (!schema_packing_version_.empty() &&
-        value.starts_with(schema_packing_version_.AsSlice())) {
-      value.remove_prefix(schema_packing_version_.size());
+    if (packing_ && value.starts_with(packing_->schema_packing_version.AsSlice())) {
+      value.remove_prefix(packing_->schema_packing_version.size());
     } else {
-      RETURN_NOT_OK(UpdateSchemaPacking(version, &value, context));
+      RETURN_NOT_OK(UpdateSchemaPacking(version, &value));
     }
-    auto& decoder = decoders_[id];
+    auto& decoder = packing_->decoders[id];
     if (!decoder.Valid()) {
-      decoder.Init(version_, *data_.projection, *schema_packing_, context, data_.schema);
+      decoder.Init(
+          packing_->version, *data_.projection, *packing_->schema_packing, context, data_.schema);
     }
 
     return decoder.Apply(value, context->Context());
   }
 
-  Status UpdateSchemaPacking(
-      dockv::PackedRowVersion version, Slice* value, PackedRowContext* factory) {
+  Status UpdateSchemaPacking(dockv::PackedRowVersion version, Slice* value) {
+    // Encoded schema version is self delimiting, so prefix match means the same version.
+    for (auto& packing : packings_) {
+      if (!packing.schema_packing_version.empty() &&
+          value->starts_with(packing.schema_packing_version.AsSlice())) {
+        value->remove_prefix(packing.schema_packing_version.size());
+        packing_ = &packing;
+        return Status::OK();
+      }
+    }
+
+    auto& packing = packings_[next_packing_to_replace_];
     const auto* start = value->cdata();
-    version_ = version;
     value->consume_byte();
-    schema_packing_ = &VERIFY_RESULT(schema_packing_storage_.GetPacking(value)).get();
-    schema_packing_version_.Assign(start, value->cdata());
-    for (auto& decoder : decoders_) {
+    auto& schema_packing = VERIFY_RESULT(schema_packing_storage_.GetPacking(value)).get();
+    next_packing_to_replace_ = (next_packing_to_replace_ + 1) % packings_.size();
+    packing.version = version;
+    packing.schema_packing = &schema_packing;
+    packing.schema_packing_version.Assign(start, value->cdata());
+    for (auto& decoder : packing.decoders) {
       decoder.Reset();
     }
+    packing_ = &packing;
 
     return Status::OK();
   }
 
  private:
+  // Schema packing of rows with the same encoded schema version, and decoders built for it.
+  struct PackingEntry {
+    dockv::PackedRowVersion version;
+    const dockv::SchemaPacking* schema_packing = nullptr;
+    ByteBuffer<0x10> schema_packing_version;
+    std::array<dockv::PackedRowDecoder, kNumDecoders> decoders;
+  };
+
   DocDBTableReaderData& data_;
   const dockv::SchemaPackingStorage& schema_packing_storage_;
 
-  dockv::PackedRowVersion version_;
-  const dockv::SchemaPacking* schema_packing_ = nullptr;
-  ByteBuffer<0x10> schema_packing_version_;
-  std::array<dockv::PackedRowDecoder, kNumDecoders> decoders_;
+  // Recently used schema packings, so rows of a table that went through schema changes could
+  // interleave versions without looking up the packing and rebuilding decoders on each switch.
+  std::array<PackingEntry, kNumCachedSchemaPackings> packings_;
+  PackingEntry* packing_ = nullptr;
+  size_t next_packing_to_replace_ = 0;
 
   const LazyDocHybridTime* doc_ht_;
   ValueControlFields control_fields_;
@@ -894,9 +920,12 @@ class GetHelperBase : public PackedRowContext {
 
     DCHECK(key_result.key.starts_with(root_doc_key_));
 
+    data_.root_value_only = false;
     root_write_time->Assign(data_.table_tombstone_time);
     if (root_doc_key_.size() != key_result.key.size() ||
         key_result.write_time < root_write_time->encoded()) {
+      RSTATUS_DCHECK(
+          !data_.decode_root_value_only, IllegalState, "Root value expected: $0", key_result);
       RETURN_NOT_OK(InitRowValue(Slice(), root_write_time, ValueControlFields()));
       return key_result;
     }
@@ -911,8 +940,16 @@ class GetHelperBase : public PackedRowContext {
     DVLOG_WITH_PREFIX_AND_FUNC(4)
         << "Write time: " << root_write_time->ToString() << ", control fields: "
         << control_fields.ToString();
+    if (data_.decode_root_value_only) {
+      static const FetchedEntry kNoEntry;
+      data_.root_value_only = true;
+      return kNoEntry;
+    }
     data_.iter->Next();
-    return data_.iter->Fetch();
+    const auto& next_entry = VERIFY_RESULT_REF(data_.iter->Fetch());
+    // Iterator is bounded by the row, so there are no more entries in the row.
+    data_.root_value_only = !next_entry;
+    return next_entry;
   }
 
   bool IsObsolete(const Expiration& expiration) {
@@ -1634,8 +1671,15 @@ void* FlatGetHelper<ResultType>::Context() {
 
 Result<DocReaderResult> DocDBTableReader::Get(
     KeyBuffer* root_doc_key, const FetchedEntry& fetched_entry, SubDocument* out) {
+  if (!out) {
+    // Only existence of the row is checked, e.g. to find the key of the next page. Any column
+    // makes the row exist, so there is no need to decode the projected columns first.
+    GetHelper<std::nullptr_t> helper(&data_, root_doc_key, nullptr);
+    return helper.Run(fetched_entry);
+  }
+
   {
-    GetHelper<SubDocument*> helper(&data_, root_doc_key, DCHECK_NOTNULL(out));
+    GetHelper<SubDocument*> helper(&data_, root_doc_key, out);
     auto result = VERIFY_RESULT(helper.Run(fetched_entry));
 
     if (result != DocReaderResult::kNotFound) {
@@ -1686,4 +1730,13 @@ Result<DocReaderResult> DocDBTableReader::GetFlat(
   return DoGetFlat(root_doc_key, fetched_entry, result);
 }
 
+Result<DocReaderResult> DocDBTableReader::GetFlatFromRootValue(
+    KeyBuffer* root_doc_key, const FetchedEntry& fetched_entry, dockv::PgTableRow* result) {
+  data_.decode_root_value_only = true;
+  auto se = ScopeExit([this] {
+    data_.decode_root_value_only = false;
+  });
+  return GetFlat(root_doc_key, fetched_entry, result);
+}
+
 }  // namespace yb::docdb
@@ -87,6 +87,11 @@ struct DocDBTableReaderData {
   EncodedDocHybridTime table_tombstone_time{EncodedDocHybridTime::kMin};
   dockv::Expiration table_expiration;
 
+  // Set when the last read row consisted of the root value only, without column entries after it.
+  bool root_value_only = false;
+  // When set, only the root value passed to the reader is decoded, the iterator is not used.
+  bool decode_root_value_only = false;
+
   DocDBTableReaderData(
       IntentAwareIterator* iter_, CoarseTimePoint deadline,
       const dockv::ReaderProjection* projection_,
@@ -124,6 +129,7 @@ class DocDBTableReader {
 
   // Read value (i.e. row), identified by root_doc_key to result.
   // Returns true if value was found, false otherwise.
+  // When result is nullptr, only existence of the row is checked.
   // FetchedEntry will contain last entry fetched by the iterator.
   Result<DocReaderResult> Get(
       KeyBuffer* root_doc_key, const FetchedEntry& fetched_entry, dockv::SubDocument* result);
@@ -137,6 +143,17 @@ class DocDBTableReader {
   Result<DocReaderResult> GetFlat(
       KeyBuffer* root_doc_key, const FetchedEntry& fetched_entry, dockv::PgTableRow* result);
 
+  // Whether the row read by the last Get or GetFlat call consisted of the root value only.
+  bool last_row_root_value_only() const {
+    return data_.root_value_only;
+  }
+
+  // Same as GetFlat, but decodes only the root value from fetched_entry and does not use the
+  // iterator. Used to decode more columns of a row, that was already read with another projection
+  // and consisted of the root value only.
+  Result<DocReaderResult> GetFlatFromRootValue(
+      KeyBuffer* root_doc_key, const FetchedEntry& fetched_entry, dockv::PgTableRow* result);
+
  private:
   void Init();
 
@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 
+#include "yb/docdb/doc_colocation_filter.h"
 #include "yb/docdb/doc_rowwise_iterator_base.h"
 #include "yb/docdb/docdb_statistics.h"
 #include "yb/docdb/intent_aware_iterator.h"
@@ -89,7 +90,8 @@ void DocRowwiseIterator::InitIterator(
     const boost::optional<const Slice>& user_key_for_filter,
     const rocksdb::QueryId query_id,
     std::shared_ptr<rocksdb::ReadFileFilter>
-        file_filter) {
+        file_filter,
+    const KeyBounds* read_bounds) {
   if (table_type_ == TableType::PGSQL_TABLE_TYPE) {
     ConfigureForYsql();
   }
@@ -105,7 +107,9 @@ void DocRowwiseIterator::InitIterator(
       read_operation_data_,
       file_filter,
       nullptr /* iterate_upper_bound */,
-      statistics_);
+      statistics_,
+      read_bounds,
+      CreateColocationFileFilter());
   InitResult();
 
   auto prefix = shared_key_prefix();
@@ -121,6 +125,26 @@ void DocRowwiseIterator::InitIterator(
   }
 }
 
+std::shared_ptr<rocksdb::TableAwareReadFileFilter>
+    DocRowwiseIterator::CreateColocationFileFilter() {
+  if (!schema_->has_colocation_id()) {
+    return nullptr;
+  }
+  // SST files with rows of the colocated table older than its truncation are skipped, so rows
+  // hidden by the table tombstone are not iterated until they are compacted away.
+  dockv::DocKey table_key(schema_->colocation_id());
+  auto table_tombstone_time = GetTableTombstoneTime(table_key.Encode().AsSlice());
+  if (!table_tombstone_time.ok()) {
+    // Error will be reported by CreateDocReader.
+    return std::make_shared<ColocationIdFileFilter>(schema_->colocation_id());
+  }
+  table_tombstone_time_ = *table_tombstone_time;
+  return std::make_shared<ColocationIdFileFilter>(
+      schema_->colocation_id(),
+      table_tombstone_time_->is_valid() ? table_tombstone_time_->hybrid_time()
+                                        : HybridTime::kInvalid);
+}
+
 void DocRowwiseIterator::ConfigureForYsql() {
   ignore_ttl_ = true;
   if (FLAGS_ysql_use_flat_doc_reader) {
@@ -213,6 +237,64 @@ Result<bool> DocRowwiseIterator::PgFetchNext(dockv::PgTableRow* table_row) {
   return FetchNextImpl(table_row);
 }
 
+Result<size_t> DocRowwiseIterator::PgFetchNextBatch(
+    size_t max_rows, dockv::PgTableRowBatch* batch) {
+  if (!batch_row_ || &batch_row_->projection() != &batch->projection()) {
+    batch_row_.emplace(batch->projection());
+  }
+  auto* row = &*batch_row_;
+  size_t result = 0;
+  while (result < max_rows) {
+    row->Reset();
+    if (!VERIFY_RESULT(FetchNextImpl(row))) {
+      break;
+    }
+    batch->Append(*row);
+    ++result;
+  }
+  return result;
+}
+
+Result<bool> DocRowwiseIterator::PgFetchNextPartial(dockv::PgTableRow* partial_row) {
+  partial_row->Reset();
+  return FetchNextImpl(PgPartialRow{partial_row});
+}
+
+Status DocRowwiseIterator::PgMaterializeRow(dockv::PgTableRow* table_row) {
+  RSTATUS_DCHECK(
+      prev_doc_found_ != DocReaderResult::kNotFound, IllegalState, "No fetched row to materialize");
+  if (!table_row) {
+    return Status::OK();
+  }
+  table_row->Reset();
+
+  if (partial_row_root_value_only_) {
+    // The row consists of the packed row only, so the rest of columns are decoded from the already
+    // fetched packed row, without moving the iterator.
+    auto doc_found = VERIFY_RESULT(doc_reader_->GetFlatFromRootValue(
+        row_key_.mutable_data(), partial_row_root_entry_, table_row));
+    if (doc_found == DocReaderResult::kNotFound) {
+      return STATUS_FORMAT(
+          IllegalState, "Row not found during materialization: $0",
+          dockv::DocKey::DebugSliceToString(row_key_.AsSlice()));
+    }
+    return FillRow(table_row);
+  }
+
+  // Decoding of the partial row could stop in the middle of the row, so seek back to its start.
+  db_iter_->Seek(row_key_.AsSlice());
+  const auto& key_data = VERIFY_RESULT_REF(db_iter_->Fetch());
+  if (key_data) {
+    prev_doc_found_ = VERIFY_RESULT(FetchRow(key_data, table_row));
+  }
+  if (!key_data || prev_doc_found_ == DocReaderResult::kNotFound) {
+    return STATUS_FORMAT(
+        IllegalState, "Row not found during materialization: $0",
+        dockv::DocKey::DebugSliceToString(row_key_.AsSlice()));
+  }
+  return FillRow(table_row);
+}
+
 Result<bool> DocRowwiseIterator::DoFetchNext(
     qlexpr::QLTableRow* table_row,
     const dockv::ReaderProjection* projection,
@@ -303,14 +385,7 @@ Result<bool> DocRowwiseIterator::FetchNextImpl(TableRow table_row) {
     }
 
     if (doc_reader_ == nullptr) {
-      doc_reader_ = std::make_unique<DocDBTableReader>(
-          db_iter_.get(), read_operation_data_.deadline, &projection_, table_type_,
-          schema_packing_storage(), schema());
-      RETURN_NOT_OK(doc_reader_->UpdateTableTombstoneTime(
-          VERIFY_RESULT(GetTableTombstoneTime(row_key))));
-      if (!ignore_ttl_) {
-        doc_reader_->SetTableTtl(schema());
-      }
+      doc_reader_ = VERIFY_RESULT(CreateDocReader(&projection_));
     }
 
     if (doc_mode_ == DocMode::kGeneric) {
@@ -342,17 +417,59 @@ Result<DocReaderResult> DocRowwiseIterator::FetchRow(
   return doc_reader_->GetFlat(row_key_.mutable_data(), fetched_entry, table_row);
 }
 
+Result<DocReaderResult> DocRowwiseIterator::FetchRow(
+    const FetchedEntry& fetched_entry, PgPartialRow table_row) {
+  CHECK_NE(doc_mode_, DocMode::kGeneric) << "Table type: " << table_type_;
+  const auto& projection = table_row.row->projection();
+  if (!partial_doc_reader_ || !(*partial_projection_ == projection)) {
+    partial_doc_reader_.reset();
+    partial_projection_.emplace(projection);
+    partial_doc_reader_ = VERIFY_RESULT(CreateDocReader(&*partial_projection_));
+  }
+  // Entry slices are invalidated when the reader moves the iterator, so keep a copy for
+  // PgMaterializeRow.
+  partial_row_key_.Assign(fetched_entry.key);
+  partial_row_value_.Assign(fetched_entry.value);
+  partial_row_root_entry_ = fetched_entry;
+  partial_row_root_entry_.key = partial_row_key_.AsSlice();
+  partial_row_root_entry_.value = partial_row_value_.AsSlice();
+  auto result = VERIFY_RESULT(partial_doc_reader_->GetFlat(
+      row_key_.mutable_data(), fetched_entry, table_row.row));
+  partial_row_root_value_only_ = partial_doc_reader_->last_row_root_value_only();
+  return result;
+}
+
 Result<DocReaderResult> DocRowwiseIterator::FetchRow(
     const FetchedEntry& fetched_entry, QLTableRowPair table_row) {
   return doc_mode_ == DocMode::kFlat
       ? doc_reader_->GetFlat(row_key_.mutable_data(), fetched_entry, table_row.table_row)
-      : doc_reader_->Get(row_key_.mutable_data(), fetched_entry, &*row_);
+      : doc_reader_->Get(
+            row_key_.mutable_data(), fetched_entry, table_row.table_row ? &*row_ : nullptr);
 }
 
 Status DocRowwiseIterator::FillRow(dockv::PgTableRow* out) {
   return CopyKeyColumnsToRow(projection_, out);
 }
 
+Status DocRowwiseIterator::FillRow(PgPartialRow out) {
+  return CopyKeyColumnsToRow(out.row->projection(), out.row);
+}
+
+Result<std::unique_ptr<DocDBTableReader>> DocRowwiseIterator::CreateDocReader(
+    const dockv::ReaderProjection* projection) {
+  auto result = std::make_unique<DocDBTableReader>(
+      db_iter_.get(), read_operation_data_.deadline, projection, table_type_,
+      schema_packing_storage(), schema());
+  if (!table_tombstone_time_) {
+    table_tombstone_time_ = VERIFY_RESULT(GetTableTombstoneTime(row_key_.AsSlice()));
+  }
+  RETURN_NOT_OK(result->UpdateTableTombstoneTime(*table_tombstone_time_));
+  if (!ignore_ttl_) {
+    result->SetTableTtl(schema());
+  }
+  return result;
+}
+
 Status DocRowwiseIterator::FillRow(QLTableRowPair out) {
   if (!out.table_row) {
     return Status::OK();
@@ -31,6 +31,7 @@
 #include "yb/docdb/key_bounds.h"
 #include "yb/docdb/ql_rowwise_iterator_interface.h"
 
+#include "yb/dockv/pg_row.h"
 #include "yb/dockv/subdocument.h"
 #include "yb/dockv/value.h"
 
@@ -38,6 +39,7 @@
 
 #include "yb/rocksdb/db.h"
 
+#include "yb/util/kv_util.h"
 #include "yb/util/operation_counter.h"
 #include "yb/util/status_fwd.h"
 
@@ -87,6 +89,14 @@ class DocRowwiseIterator final : public DocRowwiseIteratorBase {
   // So extended slice could be used as upperbound.
   Result<bool> PgFetchRow(Slice key, bool restart, dockv::PgTableRow* table_row);
   Result<bool> PgFetchNext(dockv::PgTableRow* table_row) override;
+  Result<size_t> PgFetchNextBatch(size_t max_rows, dockv::PgTableRowBatch* batch) override;
+
+  bool SupportsLateMaterialization() const override {
+    return doc_mode_ == DocMode::kFlat;
+  }
+
+  Result<bool> PgFetchNextPartial(dockv::PgTableRow* partial_row) override;
+  Status PgMaterializeRow(dockv::PgTableRow* table_row) override;
 
   bool TEST_is_flat_doc() const {
     return doc_mode_ == DocMode::kFlat;
@@ -101,7 +111,8 @@ class DocRowwiseIterator final : public DocRowwiseIteratorBase {
       BloomFilterMode bloom_filter_mode = BloomFilterMode::DONT_USE_BLOOM_FILTER,
       const boost::optional<const Slice>& user_key_for_filter = boost::none,
       const rocksdb::QueryId query_id = rocksdb::kDefaultQueryId,
-      std::shared_ptr<rocksdb::ReadFileFilter> file_filter = nullptr) override;
+      std::shared_ptr<rocksdb::ReadFileFilter> file_filter = nullptr,
+      const KeyBounds* read_bounds = nullptr) override;
 
   Result<bool> DoFetchNext(
       qlexpr::QLTableRow* table_row,
@@ -129,6 +140,11 @@ class DocRowwiseIterator final : public DocRowwiseIteratorBase {
   // Read next row into a value map using the specified projection.
   Status FillRow(qlexpr::QLTableRow* table_row, const dockv::ReaderProjection* projection);
 
+  // Row fetched by PgFetchNextPartial, decoded using its own projection.
+  struct PgPartialRow {
+    dockv::PgTableRow* row;
+  };
+
   struct QLTableRowPair {
     qlexpr::QLTableRow* table_row;
     const dockv::ReaderProjection* projection;
@@ -137,10 +153,17 @@ class DocRowwiseIterator final : public DocRowwiseIteratorBase {
   };
 
   Result<DocReaderResult> FetchRow(const FetchedEntry& fetched_entry, dockv::PgTableRow* table_row);
+  Result<DocReaderResult> FetchRow(const FetchedEntry& fetched_entry, PgPartialRow table_row);
   Result<DocReaderResult> FetchRow(const FetchedEntry& fetched_entry, QLTableRowPair table_row);
 
   Status FillRow(QLTableRowPair table_row);
   Status FillRow(dockv::PgTableRow* table_row);
+  Status FillRow(PgPartialRow table_row);
+
+  Result<std::unique_ptr<DocDBTableReader>> CreateDocReader(
+      const dockv::ReaderProjection* projection);
+
+  std::shared_ptr<rocksdb::TableAwareReadFileFilter> CreateColocationFileFilter();
 
   std::unique_ptr<IntentAwareIterator> db_iter_;
   KeyBuffer prefix_buffer_;
@@ -153,6 +176,22 @@ class DocRowwiseIterator final : public DocRowwiseIteratorBase {
 
   std::unique_ptr<DocDBTableReader> doc_reader_;
 
+  // Reader used by PgFetchNextPartial, with a copy of the partial row projection.
+  std::optional<dockv::ReaderProjection> partial_projection_;
+  std::unique_ptr<DocDBTableReader> partial_doc_reader_;
+  // Copy of the first entry of the row fetched by PgFetchNextPartial, and whether the row consists
+  // of this entry only. In this case PgMaterializeRow decodes the row from this entry.
+  KeyBuffer partial_row_key_;
+  ValueBuffer partial_row_value_;
+  FetchedEntry partial_row_root_entry_;
+  bool partial_row_root_value_only_ = false;
+
+  // Row used to decode entries fetched by PgFetchNextBatch.
+  std::optional<dockv::PgTableRow> batch_row_;
+
+  // Time of the table tombstone of the colocated table, looked up when the iterator is created.
+  std::optional<DocHybridTime> table_tombstone_time_;
+
   // DocReader result returned by the previous fetch.
   DocReaderResult prev_doc_found_ = DocReaderResult::kNotFound;
 
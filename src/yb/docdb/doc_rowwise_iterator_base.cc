@@ -13,6 +13,7 @@
 
 #include "yb/docdb/doc_rowwise_iterator_base.h"
 #include <iterator>
+#include <optional>
 
 #include <cstdint>
 #include <ostream>
@@ -199,7 +200,19 @@ Status DocRowwiseIteratorBase::Init(const qlexpr::YQLScanSpec& doc_spec, SkipSee
     }
   }
 
-  InitIterator(mode, bounds.lower.AsSlice(), doc_spec.QueryId(), CreateFileFilter(doc_spec));
+  // Only scans started from the spec bounds are guaranteed to stay within them, iterator
+  // with skipped seek could be positioned to an arbitrary key later.
+  std::optional<KeyBounds> read_bounds;
+  if (!skip_seek) {
+    read_bounds.emplace(bounds.lower.AsSlice(), bounds.upper.AsSlice());
+    if (!read_bounds->upper.empty()) {
+      // Spec upper bound is inclusive, while read bounds upper bound is exclusive.
+      read_bounds->upper.AppendKeyEntryType(dockv::KeyEntryType::kMaxByte);
+    }
+  }
+  InitIterator(
+      mode, bounds.lower.AsSlice(), doc_spec.QueryId(), CreateFileFilter(doc_spec),
+      read_bounds ? &*read_bounds : nullptr);
 
   if (has_bound_key_) {
     if (is_forward_scan_) {
@@ -107,7 +107,8 @@ class DocRowwiseIteratorBase : public YQLRowwiseIteratorIf {
       BloomFilterMode bloom_filter_mode = BloomFilterMode::DONT_USE_BLOOM_FILTER,
       const boost::optional<const Slice>& user_key_for_filter = boost::none,
       const rocksdb::QueryId query_id = rocksdb::kDefaultQueryId,
-      std::shared_ptr<rocksdb::ReadFileFilter> file_filter = nullptr) = 0;
+      std::shared_ptr<rocksdb::ReadFileFilter> file_filter = nullptr,
+      const KeyBounds* read_bounds = nullptr) = 0;
 
   virtual void Seek(Slice key) = 0;
   virtual void PrevDocKey(Slice key) = 0;
@@ -12,6 +12,8 @@
 //
 #include "yb/docdb/doc_write_batch.h"
 
+#include <algorithm>
+
 #include "yb/common/doc_hybrid_time.h"
 #include "yb/common/ql_value.h"
 
@@ -875,10 +877,20 @@ void DocWriteBatch::Clear() {
 
 // TODO(lw_uc) allocate entries on the same arena, then just reference them.
 void DocWriteBatch::MoveToWriteBatchPB(LWKeyValueWriteBatchPB *kv_pb) {
+  // Keys and values of all entries are still copied into the message arena, but into a single
+  // block allocated once per batch instead of two allocations per entry.
+  size_t total_size = 0;
+  for (const auto& entry : put_batch_) {
+    total_size += entry.key.size() + entry.value.size();
+  }
+  char* buffer = total_size ? static_cast<char*>(kv_pb->arena().AllocateBytes(total_size))
+                            : nullptr;
   for (auto& entry : put_batch_) {
     auto* kv_pair = kv_pb->add_write_pairs();
-    kv_pair->dup_key(entry.key);
-    kv_pair->dup_value(entry.value);
+    kv_pair->ref_key(Slice(buffer, entry.key.size()));
+    buffer = std::copy(entry.key.begin(), entry.key.end(), buffer);
+    kv_pair->ref_value(Slice(buffer, entry.value.size()));
+    buffer = std::copy(entry.value.begin(), entry.value.end(), buffer);
   }
   if (has_ttl()) {
     kv_pb->set_ttl(ttl_ns());
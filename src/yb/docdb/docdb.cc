@@ -283,7 +283,8 @@ Status AssembleDocWriteBatch(const vector<unique_ptr<DocOperation>>& doc_write_o
                              InitMarkerBehavior init_marker_behavior,
                              std::atomic<int64_t>* monotonic_counter,
                              HybridTime* restart_read_ht,
-                             const string& table_name) {
+                             const string& table_name,
+                             const DocDBStatistics* statistics) {
   DCHECK_ONLY_NOTNULL(restart_read_ht);
   DocWriteBatch doc_write_batch(doc_db, init_marker_behavior, pending_op, monotonic_counter);
 
@@ -294,6 +295,7 @@ Status AssembleDocWriteBatch(const vector<unique_ptr<DocOperation>>& doc_write_o
     .iterator = nullptr,
     .restart_seek = true,
     .schema_packing_provider = schema_packing_provider,
+    .statistics = statistics,
   };
 
   std::optional<DocRowwiseIterator> iterator;
@@ -1257,9 +1257,9 @@ std::shared_ptr<rocksdb::CompactionContextFactory> CreateCompactionContextFactor
     return std::make_unique<DocDBCompactionContext>(
         next_feed,
         retention_policy->GetRetentionDirective(),
-        MinHybridTime(options.level0_inputs),
+        MinHybridTime(options.inputs),
         delete_marker_retention_provider
-            ? delete_marker_retention_provider(options.level0_inputs)
+            ? delete_marker_retention_provider(options.inputs)
             : HybridTime::kMax,
         options.boundary_extractor,
         key_bounds,
@@ -1267,6 +1267,13 @@ std::shared_ptr<rocksdb::CompactionContextFactory> CreateCompactionContextFactor
   });
 }
 
+std::shared_ptr<rocksdb::SubcompactionBoundaryExtractor> CreateSubcompactionBoundaryExtractor() {
+  return std::make_shared<rocksdb::SubcompactionBoundaryExtractor>([](Slice user_key) -> size_t {
+    auto doc_key_size = dockv::DocKey::EncodedSize(user_key, dockv::DocKeyPart::kWholeDocKey);
+    return doc_key_size.ok() ? *doc_key_size : 0;
+  });
+}
+
 // ------------------------------------------------------------------------------------------------
 
 HistoryRetentionDirective ManualHistoryRetentionPolicy::GetRetentionDirective() {
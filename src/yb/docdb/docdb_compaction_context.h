@@ -153,6 +153,10 @@ std::shared_ptr<rocksdb::CompactionContextFactory> CreateCompactionContextFactor
     const DeleteMarkerRetentionTimeProvider& delete_marker_retention_provider,
     SchemaPackingProvider* schema_packing_provider);
 
+// Creates extractor that keeps all records of the same document in one subcompaction, since the
+// compaction feed garbage collects records of a document based on the records preceding them.
+std::shared_ptr<rocksdb::SubcompactionBoundaryExtractor> CreateSubcompactionBoundaryExtractor();
+
 // A history retention policy that can be configured manually. Useful in tests. This class is
 // useful for testing and is thread-safe.
 class ManualHistoryRetentionPolicy : public HistoryRetentionPolicy {
@@ -19,8 +19,11 @@ namespace yb::docdb {
 
 class DocDbAwareFilterPolicyBase : public rocksdb::FilterPolicy {
  public:
-  explicit DocDbAwareFilterPolicyBase(size_t filter_block_size_bits, rocksdb::Logger* logger) {
-    builtin_policy_.reset(rocksdb::NewFixedSizeFilterPolicy(
+  explicit DocDbAwareFilterPolicyBase(
+      size_t filter_block_size_bits, rocksdb::Logger* logger, bool use_ribbon = false) {
+    auto* new_policy = use_ribbon ? rocksdb::NewFixedSizeRibbonFilterPolicy
+                                  : rocksdb::NewFixedSizeFilterPolicy;
+    builtin_policy_.reset(new_policy(
         filter_block_size_bits, rocksdb::FilterPolicy::kDefaultFixedSizeFilterErrorRate, logger));
   }
 
@@ -70,12 +73,23 @@ class DocDbAwareV2FilterPolicy : public DocDbAwareFilterPolicyBase {
 // use first range component of the doc key.
 class DocDbAwareV3FilterPolicy : public DocDbAwareFilterPolicyBase {
  public:
-  DocDbAwareV3FilterPolicy(size_t filter_block_size_bits, rocksdb::Logger* logger)
-      : DocDbAwareFilterPolicyBase(filter_block_size_bits, logger) {}
+  DocDbAwareV3FilterPolicy(
+      size_t filter_block_size_bits, rocksdb::Logger* logger, bool use_ribbon = false)
+      : DocDbAwareFilterPolicyBase(filter_block_size_bits, logger, use_ribbon) {}
 
   const char* Name() const override { return "DocKeyV3Filter"; }
 
   const KeyTransformer* GetKeyTransformer() const override;
 };
 
+// The same as DocDbAwareV3FilterPolicy, but uses Ribbon filter blocks instead of bloom filter
+// blocks.
+class DocDbAwareV3RibbonFilterPolicy : public DocDbAwareV3FilterPolicy {
+ public:
+  DocDbAwareV3RibbonFilterPolicy(size_t filter_block_size_bits, rocksdb::Logger* logger)
+      : DocDbAwareV3FilterPolicy(filter_block_size_bits, logger, /* use_ribbon= */ true) {}
+
+  const char* Name() const override { return "DocKeyV3RibbonFilter"; }
+};
+
 }  // namespace yb::docdb
@@ -29,7 +29,12 @@ namespace yb::docdb {
 class ConsensusFrontier;
 class DeadlineInfo;
 class DocDBCompactionFilterFactory;
+class DocDBStatistics;
 class DocOperation;
+class DocPgBatchAggregator;
+class DocPgBlockSampler;
+class DocPgGroupedAggregator;
+class DocPgTopNHeap;
 class DocPgsqlScanSpec;
 class DocQLScanSpec;
 class DocRowwiseIterator;
@@ -39,9 +44,12 @@ class IntentAwareIterator;
 class IntentAwareIteratorIf;
 class IntentIterator;
 class ManualHistoryRetentionPolicy;
+class PgPointReader;
 class PgsqlWriteOperation;
 class QLWriteOperation;
 class RedisWriteOperation;
+class RocksDBIteratorPool;
+class RowCache;
 class ScanChoices;
 class SchemaPackingProvider;
 class SharedLockManager;
@@ -11,9 +11,20 @@
 // under the License.
 //
 
+#include "yb/common/doc_hybrid_time.h"
+
 #include "yb/docdb/docdb_rocksdb_util.h"
+
+#include "yb/dockv/doc_key.h"
+
+#include "yb/rocksdb/comparator.h"
+#include "yb/rocksdb/db/dbformat.h"
 #include "yb/rocksdb/table.h"
+#include "yb/rocksdb/table/block_builder.h"
 
+#include "yb/tablet/tablet_options.h"
+
+#include "yb/util/random_util.h"
 #include "yb/util/result.h"
 #include "yb/util/test_util.h"
 
@@ -33,6 +44,23 @@ namespace docdb {
 
 class DocDBRocksDBUtilTest : public YBTest {};
 
+namespace {
+
+size_t DataBlockSize(
+    const std::vector<std::string>& keys, rocksdb::KeyValueEncodingFormat format) {
+  rocksdb::BlockBuilder builder(FLAGS_block_restart_interval, format);
+  for (const auto& key : keys) {
+    builder.Add(key, Slice());
+  }
+  return builder.Finish().size();
+}
+
+std::string EncodeInternalKey(const dockv::KeyBytes& key, rocksdb::SequenceNumber seqno) {
+  return rocksdb::InternalKey(key.AsSlice(), seqno, rocksdb::kTypeValue).Encode().ToBuffer();
+}
+
+} // namespace
+
 TEST_F(DocDBRocksDBUtilTest, CaseInsensitiveCompressionType) {
   rocksdb::CompressionType got_compression_type =
       CHECK_RESULT(TEST_GetConfiguredCompressionType("snappy"));
@@ -254,5 +282,71 @@ TEST_F(DocDBRocksDBUtilTest, RocksDBRateLimiter) {
   }
 }
 
+// Hybrid times of consecutive DocDB keys differ only in their low bytes, so three_shared_parts
+// encoding, the target of regular_tablets_data_block_key_value_encoding, stores just those bytes.
+// shared_prefix encoding stores the whole hybrid time after the first differing byte of the key.
+TEST_F(DocDBRocksDBUtilTest, ThreeSharedPartsEncodingSharesHybridTime) {
+  constexpr int kRows = 1000;
+  constexpr int kColumns = 4;
+  constexpr uint64_t kBaseMicros = 1700000000000000;
+
+  std::vector<std::string> keys;
+  std::vector<std::string> keys_without_ht;
+  size_t total_ht_size = 0;
+  for (int row = 0; row != kRows; ++row) {
+    dockv::DocKey doc_key(dockv::KeyEntryValues{dockv::KeyEntryValue::Int32(row)});
+    auto hybrid_time = HybridTime::FromMicros(kBaseMicros + row * 1000);
+    for (int column = 0; column != kColumns; ++column) {
+      dockv::SubDocKey sub_doc_key(
+          doc_key, dockv::KeyEntryValue::MakeColumnId(ColumnId(column + 1)),
+          DocHybridTime(hybrid_time, column));
+      auto encoded = sub_doc_key.Encode();
+      auto encoded_without_ht = sub_doc_key.EncodeWithoutHt();
+      total_ht_size += encoded.size() - encoded_without_ht.size();
+      keys.push_back(EncodeInternalKey(encoded, row + 1));
+      keys_without_ht.push_back(EncodeInternalKey(encoded_without_ht, row + 1));
+    }
+  }
+
+  for (auto format : {rocksdb::KeyValueEncodingFormat::kKeyDeltaEncodingSharedPrefix,
+                      rocksdb::KeyValueEncodingFormat::kKeyDeltaEncodingThreeSharedParts}) {
+    auto ht_size = DataBlockSize(keys, format) - DataBlockSize(keys_without_ht, format);
+    LOG(INFO) << rocksdb::KeyValueEncodingFormatToString(format) << ": " << ht_size
+              << " bytes of hybrid times stored, " << total_ht_size << " bytes encoded";
+    if (format == rocksdb::KeyValueEncodingFormat::kKeyDeltaEncodingSharedPrefix) {
+      ASSERT_GE(ht_size, total_ht_size / 2);
+    } else {
+      ASSERT_LT(ht_size, total_ht_size / 2);
+    }
+  }
+}
+
+// DocDB RocksDB instances use the default bytewise comparator, which is correct because encoded
+// DocDB keys are ordered the same way as decoded keys, including descending components.
+TEST_F(DocDBRocksDBUtilTest, KeysAreComparedBytewise) {
+  constexpr int kNumKeys = 1000;
+
+  rocksdb::Options options;
+  InitRocksDBOptions(&options, "" /* log_prefix */, nullptr /* statistics */,
+                     tablet::TabletOptions());
+  ASSERT_EQ(options.comparator, rocksdb::BytewiseComparator());
+
+  std::vector<dockv::DocKey> doc_keys;
+  for (int i = 0; i != kNumKeys; ++i) {
+    doc_keys.emplace_back(dockv::KeyEntryValues{
+        dockv::KeyEntryValue::Int32(RandomUniformInt<int32_t>(-10, 10)),
+        dockv::KeyEntryValue::Int64(RandomUniformInt<int64_t>(), SortOrder::kDescending),
+        dockv::KeyEntryValue::Double(RandomUniformReal<double>(-1e6, 1e6))});
+  }
+  for (int i = 1; i != kNumKeys; ++i) {
+    const auto& lhs = doc_keys[i - 1];
+    const auto& rhs = doc_keys[i];
+    auto expected = lhs.CompareTo(rhs);
+    auto actual = options.comparator->Compare(lhs.Encode().AsSlice(), rhs.Encode().AsSlice());
+    ASSERT_EQ(expected < 0, actual < 0) << lhs.ToString() << " vs " << rhs.ToString();
+    ASSERT_EQ(expected == 0, actual == 0) << lhs.ToString() << " vs " << rhs.ToString();
+  }
+}
+
 }  // namespace docdb
 }  // namespace yb
@@ -14,10 +14,13 @@
 #include "yb/docdb/docdb_rocksdb_util.h"
 
 #include <memory>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include "yb/common/doc_hybrid_time.h"
 #include "yb/common/transaction.h"
 
 #include "yb/docdb/bounded_rocksdb_iterator.h"
@@ -40,6 +43,7 @@
 #include "yb/rocksdb/metadata.h"
 #include "yb/rocksdb/options.h"
 #include "yb/rocksdb/rate_limiter.h"
+#include "yb/rocksdb/slice_transform.h"
 #include "yb/rocksdb/table.h"
 #include "yb/rocksdb/table/filtering_iterator.h"
 #include "yb/rocksdb/types.h"
@@ -74,6 +78,12 @@ DEFINE_UNKNOWN_int32(rocksdb_max_background_flushes, -1,
 DEFINE_UNKNOWN_bool(rocksdb_disable_compactions, false, "Disable rocksdb compactions.");
 DEFINE_UNKNOWN_bool(rocksdb_compaction_measure_io_stats, false,
     "Measure stats for rocksdb compactions.");
+DEFINE_NON_RUNTIME_bool(rocksdb_use_direct_io_for_flush_and_compaction, false,
+    "Write SST files produced by flushes and compactions with O_DIRECT, so background writes do "
+    "not evict pages of hot SST files and WAL from the OS page cache.");
+DEFINE_NON_RUNTIME_bool(rocksdb_use_direct_reads_for_compaction_inputs, false,
+    "Read compaction input files with O_DIRECT. Compaction inputs are opened with separate file "
+    "descriptors, so reads of user queries still go through the OS page cache.");
 DEFINE_UNKNOWN_int32(rocksdb_base_background_compactions, -1,
              "Number threads to do background compactions.");
 DEFINE_UNKNOWN_int32(rocksdb_max_background_compactions, -1,
@@ -87,23 +97,65 @@ DEFINE_UNKNOWN_int32(rocksdb_level0_slowdown_writes_trigger, -1,
              "The number of files above which writes are slowed down.");
 DEFINE_UNKNOWN_int32(rocksdb_level0_stop_writes_trigger, -1,
              "The number of files above which compactions are stopped.");
+DEFINE_NON_RUNTIME_bool(rocksdb_proportional_write_delay, false,
+    "Delay writes proportionally to the pressure of pending flushes and compactions, growing "
+    "gradually from rocksdb_level0_slowdown_writes_trigger to rocksdb_level0_stop_writes_trigger, "
+    "instead of adjusting delayed write rate by a fixed ratio.");
 DEFINE_UNKNOWN_int32(rocksdb_universal_compaction_size_ratio, 20,
              "The percentage upto which files that are larger are include in a compaction.");
 DEFINE_UNKNOWN_uint64(rocksdb_universal_compaction_always_include_size_threshold, 64_MB,
              "Always include files of smaller or equal size in a compaction.");
 DEFINE_UNKNOWN_int32(rocksdb_universal_compaction_min_merge_width, 4,
              "The minimum number of files in a single compaction run.");
+DEFINE_NON_RUNTIME_bool(rocksdb_use_level_compaction, false,
+    "Use level style compactions for the regular DB instead of universal ones. Level 0 keeps "
+    "overlapping flushed files, which are compacted into the sorted levels below it, so a "
+    "compaction rewrites only a part of the data and does not require doubled disk space.");
+DEFINE_NON_RUNTIME_int32(rocksdb_level_compaction_num_levels, 5,
+    "Number of levels of the regular DB when level style compactions are used.");
+DEFINE_NON_RUNTIME_uint64(rocksdb_level_compaction_max_bytes_for_level_base, 256_MB,
+    "Target total size of level 1 when level style compactions are used.");
+DEFINE_NON_RUNTIME_int32(rocksdb_level_compaction_max_bytes_for_level_multiplier, 10,
+    "Ratio between target total sizes of consecutive levels when level style compactions are "
+    "used.");
+DEFINE_NON_RUNTIME_uint64(rocksdb_level_compaction_target_file_size_base, 64_MB,
+    "Target size of files produced by level style compactions.");
+DEFINE_NON_RUNTIME_bool(rocksdb_level_compaction_dynamic_level_bytes, true,
+    "Pick target sizes of levels dynamically, based on the size of the last level, when level "
+    "style compactions are used.");
 DEFINE_UNKNOWN_int64(rocksdb_compact_flush_rate_limit_bytes_per_sec, 1_GB,
              "Use to control write rate of flush and compaction.");
 DEFINE_UNKNOWN_string(rocksdb_compact_flush_rate_limit_sharing_mode, "tserver",
               "Allows to control rate limit sharing/calculation across RocksDB instances\n"
               "  tserver - rate limit is shared across all RocksDB instances"
               " at tabset server level\n"
+              "  disk - rate limit is shared across all RocksDB instances placed on the same disk\n"
               "  none - rate limit is calculated independently for every RocksDB instance");
 DEFINE_UNKNOWN_uint64(rocksdb_compaction_size_threshold_bytes, 2ULL * 1024 * 1024 * 1024,
              "Threshold beyond which compaction is considered large.");
+DEFINE_NON_RUNTIME_uint32(rocksdb_max_subcompactions, 1,
+    "Maximum number of threads a single full compaction of the regular DB is split into. Each "
+    "subcompaction processes a disjoint key range of the input files. 1 disables subcompactions.");
 DEFINE_UNKNOWN_uint64(rocksdb_max_file_size_for_compaction, 0,
              "Maximal allowed file size to participate in RocksDB compaction. 0 - unlimited.");
+DEFINE_NON_RUNTIME_bool(rocksdb_allow_concurrent_memtable_write, false,
+    "Insert write batches of a write group into the regular DB memtable concurrently by their "
+    "own writer threads, instead of the group leader inserting all of them.");
+DEFINE_NON_RUNTIME_uint64(rocksdb_memtable_hash_index_buckets, 0,
+    "Number of buckets in the hash index of regular DB memtables, that maps DocKey to its first "
+    "entry in the memtable, for cheaper point lookups of recently written rows. "
+    "0 disables the hash index.");
+DEFINE_NON_RUNTIME_uint64(rocksdb_min_blob_size, 0,
+    "Values of at least this size are written by flushes and compactions to separate blob files, "
+    "so compactions do not rewrite them unless they are changed. 0 keeps all values in SST "
+    "files.");
+DEFINE_NON_RUNTIME_double(rocksdb_blob_garbage_collection_ratio, 0.5,
+    "Compaction moves values out of a blob file when at least this fraction of the blob file is "
+    "not referenced by live SST files anymore.");
+DEFINE_NON_RUNTIME_bool(rocksdb_skip_stats_update_on_db_open, false,
+    "Do not read table properties of SST files when RocksDB is opened, so opening a tablet does "
+    "not open its SST files, and they are opened on first access instead. Statistics used for "
+    "level compaction picking are then updated only for files opened later.");
 DEFINE_UNKNOWN_int32(rocksdb_max_write_buffer_number, 2,
              "Maximum number of write buffers that are built up in memory.");
 DECLARE_int64(db_block_size_bytes);
@@ -111,6 +163,18 @@ DECLARE_int64(db_block_size_bytes);
 DEFINE_UNKNOWN_int64(db_filter_block_size_bytes, 64_KB,
              "Size of RocksDB filter block (in bytes).");
 
+DEFINE_NON_RUNTIME_bool(db_cache_filter_blocks_with_high_priority, false,
+             "Insert RocksDB filter blocks into the block cache as multi-touch entries, so they "
+             "are not evicted by blocks of large scans.");
+
+DEFINE_NON_RUNTIME_bool(db_cache_index_blocks_with_high_priority, false,
+             "Insert RocksDB index blocks into the block cache as multi-touch entries, so they "
+             "are not evicted by blocks of large scans.");
+
+DEFINE_NON_RUNTIME_bool(db_use_data_block_hash_index, false,
+             "Append hash index to RocksDB data blocks to speed up point lookups. Files written "
+             "with this flag could not be read by versions which do not support such index.");
+
 DEFINE_UNKNOWN_int64(db_index_block_size_bytes, 32_KB,
              "Size of RocksDB index block (in bytes).");
 
@@ -126,6 +190,12 @@ DEFINE_UNKNOWN_int32(memstore_size_mb, 128,
 DEFINE_UNKNOWN_bool(use_docdb_aware_bloom_filter, true,
             "Whether to use the DocDbAwareFilterPolicy for both bloom storage and seeks.");
 
+DEFINE_NON_RUNTIME_bool(use_docdb_aware_ribbon_filter, false,
+            "Whether to build RocksDB filter blocks of DocDbAwareFilterPolicy as Ribbon filters "
+            "instead of bloom filters. Ribbon filter needs less memory for the same false "
+            "positive rate. Files with both kinds of filters are readable regardless of this "
+            "flag.");
+
 DEFINE_UNKNOWN_bool(use_multi_level_index, true, "Whether to use multi-level data index.");
 
 // Using class kExternal as this change affects the format of data in the SST files which are sent
@@ -153,6 +223,20 @@ DEFINE_UNKNOWN_string(compression_type, "Snappy",
               "On-disk compression type to use in RocksDB."
               "By default, Snappy is used if supported.");
 
+DEFINE_NON_RUNTIME_uint32(compression_max_dict_bytes, 0,
+    "Maximum size of the dictionary trained per SST file for ZSTD compression. The dictionary is "
+    "trained on samples of the first data blocks of the file. 0 disables dictionary compression. "
+    "Only used when compression_type is ZSTD.");
+
+DEFINE_NON_RUNTIME_uint32(compression_zstd_max_train_bytes, 0,
+    "Maximum amount of data block contents buffered per SST file to train the ZSTD compression "
+    "dictionary. 0 means 100 times compression_max_dict_bytes.");
+
+DEFINE_NON_RUNTIME_uint32(compression_parallel_threads, 1,
+    "Number of threads used to compress data blocks of each SST file being written by flush or "
+    "compaction, while the next data blocks are filled. 1 disables parallel compression. Not used "
+    "with dictionary compression.");
+
 DEFINE_UNKNOWN_int32(block_restart_interval, kDefaultDataBlockRestartInterval,
              "Controls the number of keys to look at for computing the diff encoding.");
 
@@ -162,6 +246,11 @@ DEFINE_UNKNOWN_int32(index_block_restart_interval, kDefaultIndexBlockRestartInte
 DEFINE_UNKNOWN_bool(prioritize_tasks_by_disk, false,
             "Consider disk load when considering compaction and flush priorities.");
 
+DEFINE_RUNTIME_uint64(regular_db_scan_readahead_size_bytes, 0,
+    "If non zero, forward scans of regular DB that read consecutive data blocks of an SST file "
+    "asynchronously prefetch that number of bytes following the current data block into OS page "
+    "cache. Prefetch is not started after the read deadline.");
+
 namespace yb {
 
 namespace {
@@ -174,7 +263,8 @@ Result<rocksdb::CompressionType> GetConfiguredCompressionType(const std::string&
     rocksdb::kNoCompression,
     rocksdb::kSnappyCompression,
     rocksdb::kZlibCompression,
-    rocksdb::kLZ4Compression
+    rocksdb::kLZ4Compression,
+    rocksdb::kZSTDNotFinalCompression
   };
   for (const auto& compression_type : kValidRocksDBCompressionTypes) {
     if (boost::iequals(flag_value, rocksdb::CompressionTypeToString(compression_type))) {
@@ -255,6 +345,23 @@ KeyBytes AppendDocHt(Slice key, const DocHybridTime& doc_ht) {
 
 namespace {
 
+// Accepts SST file only if it is accepted by both filters.
+class CombinedTableAwareFileFilter : public rocksdb::TableAwareReadFileFilter {
+ public:
+  CombinedTableAwareFileFilter(
+      std::shared_ptr<rocksdb::TableAwareReadFileFilter> first,
+      std::shared_ptr<rocksdb::TableAwareReadFileFilter> second)
+      : first_(std::move(first)), second_(std::move(second)) {}
+
+  bool Filter(rocksdb::TableReader* reader) const override {
+    return first_->Filter(reader) && second_->Filter(reader);
+  }
+
+ private:
+  const std::shared_ptr<rocksdb::TableAwareReadFileFilter> first_;
+  const std::shared_ptr<rocksdb::TableAwareReadFileFilter> second_;
+};
+
 rocksdb::ReadOptions PrepareReadOptions(
     rocksdb::DB* rocksdb,
     BloomFilterMode bloom_filter_mode,
@@ -302,14 +409,24 @@ unique_ptr<IntentAwareIterator> CreateIntentAwareIterator(
     const ReadOperationData& read_operation_data,
     std::shared_ptr<rocksdb::ReadFileFilter> file_filter,
     const Slice* iterate_upper_bound,
-    const DocDBStatistics* statistics) {
+    const DocDBStatistics* statistics,
+    const KeyBounds* read_bounds,
+    std::shared_ptr<rocksdb::TableAwareReadFileFilter> table_file_filter) {
   // TODO(dtxn) do we need separate options for intents db?
   rocksdb::ReadOptions read_opts = PrepareReadOptions(doc_db.regular, bloom_filter_mode,
       user_key_for_filter, query_id, std::move(file_filter), iterate_upper_bound,
       statistics ? statistics->RegularDBStatistics() : nullptr);
+  if (table_file_filter) {
+    read_opts.table_aware_file_filter = read_opts.table_aware_file_filter
+        ? std::make_shared<CombinedTableAwareFileFilter>(
+              std::move(read_opts.table_aware_file_filter), std::move(table_file_filter))
+        : std::move(table_file_filter);
+  }
+  read_opts.readahead_size = FLAGS_regular_db_scan_readahead_size_bytes;
+  read_opts.readahead_deadline = read_operation_data.deadline;
   return std::make_unique<IntentAwareIterator>(
       doc_db, read_opts, read_operation_data, txn_op_context,
-      statistics ? statistics->IntentsDBStatistics() : nullptr);
+      statistics ? statistics->IntentsDBStatistics() : nullptr, read_bounds);
 }
 
 namespace {
@@ -380,6 +497,62 @@ int32_t GetBaseBackgroundCompactions() {
   return FLAGS_rocksdb_base_background_compactions;
 }
 
+// Strips kHybridTime marker and encoded DocHybridTime from the end of the key, so all versions of
+// the same SubDocKey and the seek key without hybrid time have the same data block hash key.
+// Key without hybrid time might be occasionally mistaken for a key with hybrid time, it just makes
+// data block hash index hint useless for such a key.
+class DocHybridTimeStrippingTransform : public rocksdb::SliceTransform {
+ public:
+  const char* Name() const override {
+    return "DocHybridTimeStrippingTransform";
+  }
+
+  Slice Transform(const Slice& src) const override {
+    const auto ht_size = DocHybridTime::EncodedSizeFromEndOrZero(src);
+    if (ht_size == 0 ||
+        src[src.size() - ht_size - 1] != dockv::KeyEntryTypeAsChar::kHybridTime) {
+      return src;
+    }
+    return src.Prefix(src.size() - ht_size - 1);
+  }
+
+  bool InDomain(const Slice& src) const override {
+    return true;
+  }
+
+  bool InRange(const Slice& dst) const override {
+    return true;
+  }
+};
+
+const std::shared_ptr<const rocksdb::SliceTransform>& DocHybridTimeStrippingTransformInstance() {
+  static const std::shared_ptr<const rocksdb::SliceTransform> kInstance =
+      std::make_shared<DocHybridTimeStrippingTransform>();
+  return kInstance;
+}
+
+// Extracts encoded DocKey from the key, so all entries of the same row share the memtable hash
+// index entry. Keys that could not be decoded as DocKey are used as is.
+class DocKeyExtractingTransform : public rocksdb::SliceTransform {
+ public:
+  const char* Name() const override {
+    return "DocKeyExtractingTransform";
+  }
+
+  Slice Transform(const Slice& src) const override {
+    auto doc_key_size = dockv::DocKey::EncodedSize(src, dockv::DocKeyPart::kWholeDocKey);
+    return doc_key_size.ok() ? src.Prefix(*doc_key_size) : src;
+  }
+
+  bool InDomain(const Slice& src) const override {
+    return true;
+  }
+
+  bool InRange(const Slice& dst) const override {
+    return true;
+  }
+};
+
 // Auto initialize some of the RocksDB flags.
 void AutoInitFromRocksDBFlags(rocksdb::Options* options) {
   std::unique_lock<std::mutex> lock(rocksdb_flags_mutex);
@@ -399,6 +572,13 @@ void AutoInitFromBlockBasedTableOptions(rocksdb::BlockBasedTableOptions* table_o
 
   table_options->block_size = FLAGS_db_block_size_bytes;
   table_options->filter_block_size = FLAGS_db_filter_block_size_bytes;
+  table_options->cache_filter_blocks_with_high_priority =
+      FLAGS_db_cache_filter_blocks_with_high_priority;
+  table_options->cache_index_blocks_with_high_priority =
+      FLAGS_db_cache_index_blocks_with_high_priority;
+  table_options->use_data_block_hash_index = FLAGS_db_use_data_block_hash_index;
+  // Always set, so data block hash index is used for files written before the flag was turned off.
+  table_options->data_block_hash_key_extractor = DocHybridTimeStrippingTransformInstance();
   table_options->index_block_size = FLAGS_db_index_block_size_bytes;
   table_options->min_keys_per_index_block = FLAGS_db_min_keys_per_index_block;
 
@@ -532,6 +712,18 @@ PriorityThreadPool* GetGlobalPriorityThreadPool() {
   return &priority_thread_pool_for_compactions_and_flushes;
 }
 
+// Returns rate limiter shared by all RocksDB instances placed on the disk with specified group no.
+std::shared_ptr<rocksdb::RateLimiter> GetDiskRateLimiter(uint64_t group_no) {
+  static std::mutex mutex;
+  static std::unordered_map<uint64_t, std::shared_ptr<rocksdb::RateLimiter>> rate_limiters;
+  std::lock_guard lock(mutex);
+  auto it = rate_limiters.find(group_no);
+  if (it == rate_limiters.end()) {
+    it = rate_limiters.emplace(group_no, CreateRocksDBRateLimiter()).first;
+  }
+  return it->second;
+}
+
 } // namespace
 
 rocksdb::Options TEST_AutoInitFromRocksDBFlags() {
@@ -606,8 +798,13 @@ void InitRocksDBOptions(
   options->initial_seqno = FLAGS_initial_seqno;
   options->boundary_extractor = DocBoundaryValuesExtractorInstance();
   options->compaction_measure_io_stats = FLAGS_rocksdb_compaction_measure_io_stats;
+  options->use_direct_io_for_flush_and_compaction =
+      FLAGS_rocksdb_use_direct_io_for_flush_and_compaction;
+  options->use_direct_reads_for_compaction_inputs =
+      FLAGS_rocksdb_use_direct_reads_for_compaction_inputs;
   options->memory_monitor = tablet_options.memory_monitor;
   options->disk_group_no = group_no;
+  options->skip_stats_update_on_db_open = FLAGS_rocksdb_skip_stats_update_on_db_open;
   if (FLAGS_db_write_buffer_size != -1) {
     options->write_buffer_size = FLAGS_db_write_buffer_size;
   } else {
@@ -625,6 +822,9 @@ void InitRocksDBOptions(
   // Since the flag validator for FLAGS_compression_type will fail if the result of this call is not
   // OK, this CHECK_RESULT should never fail and is safe.
   options->compression = CHECK_RESULT(GetConfiguredCompressionType(FLAGS_compression_type));
+  options->compression_opts.max_dict_bytes = FLAGS_compression_max_dict_bytes;
+  options->compression_opts.zstd_max_train_bytes = FLAGS_compression_zstd_max_train_bytes;
+  options->compression_opts.parallel_threads = FLAGS_compression_parallel_threads;
 
   options->listeners.insert(
       options->listeners.end(), tablet_options.listeners.begin(),
@@ -633,6 +833,7 @@ void InitRocksDBOptions(
   // Set block cache options.
   if (tablet_options.block_cache) {
     table_options.block_cache = tablet_options.block_cache;
+    table_options.block_cache_compressed = tablet_options.compressed_block_cache;
     // Cache the bloom filters in the block cache.
     table_options.cache_index_and_filter_blocks = true;
   } else {
@@ -645,10 +846,19 @@ void InitRocksDBOptions(
   // Set our custom bloom filter that is docdb aware.
   if (FLAGS_use_docdb_aware_bloom_filter) {
     const auto filter_block_size_bits = table_options.filter_block_size * 8;
-    table_options.filter_policy = std::make_shared<const DocDbAwareV3FilterPolicy>(
+    auto v3_filter_policy = std::make_shared<const DocDbAwareV3FilterPolicy>(
+        filter_block_size_bits, options->info_log.get());
+    auto v3_ribbon_filter_policy = std::make_shared<const DocDbAwareV3RibbonFilterPolicy>(
         filter_block_size_bits, options->info_log.get());
     table_options.supported_filter_policies =
         std::make_shared<rocksdb::BlockBasedTableOptions::FilterPoliciesMap>();
+    if (FLAGS_use_docdb_aware_ribbon_filter) {
+      table_options.filter_policy = v3_ribbon_filter_policy;
+      AddSupportedFilterPolicy(v3_filter_policy, &table_options);
+    } else {
+      table_options.filter_policy = v3_filter_policy;
+      AddSupportedFilterPolicy(v3_ribbon_filter_policy, &table_options);
+    }
     AddSupportedFilterPolicy(std::make_shared<const DocDbAwareHashedComponentsFilterPolicy>(
             filter_block_size_bits, options->info_log.get()), &table_options);
     AddSupportedFilterPolicy(std::make_shared<const DocDbAwareV2FilterPolicy>(
@@ -672,6 +882,16 @@ void InitRocksDBOptions(
     : rocksdb::CompactionStyle::kCompactionStyleNone;
   // Set the number of levels to 1.
   options->num_levels = 1;
+  if (compactions_enabled && FLAGS_rocksdb_use_level_compaction) {
+    options->compaction_style = rocksdb::CompactionStyle::kCompactionStyleLevel;
+    options->num_levels = std::max(FLAGS_rocksdb_level_compaction_num_levels, 2);
+    options->max_bytes_for_level_base = FLAGS_rocksdb_level_compaction_max_bytes_for_level_base;
+    options->max_bytes_for_level_multiplier =
+        FLAGS_rocksdb_level_compaction_max_bytes_for_level_multiplier;
+    options->target_file_size_base = FLAGS_rocksdb_level_compaction_target_file_size_base;
+    options->level_compaction_dynamic_level_bytes =
+        FLAGS_rocksdb_level_compaction_dynamic_level_bytes;
+  }
 
   AutoInitFromRocksDBFlags(options);
   if (compactions_enabled) {
@@ -679,6 +899,7 @@ void InitRocksDBOptions(
     options->level0_slowdown_writes_trigger = max_if_negative(
         FLAGS_rocksdb_level0_slowdown_writes_trigger);
     options->level0_stop_writes_trigger = max_if_negative(FLAGS_rocksdb_level0_stop_writes_trigger);
+    options->proportional_write_delay = FLAGS_rocksdb_proportional_write_delay;
     // This determines the algo used to compute which files will be included. The "total size" based
     // computation compares the size of every new file with the sum of all files included so far.
     options->compaction_options_universal.stop_style =
@@ -690,8 +911,14 @@ void InitRocksDBOptions(
     options->compaction_options_universal.min_merge_width =
         FLAGS_rocksdb_universal_compaction_min_merge_width;
     options->compaction_size_threshold_bytes = FLAGS_rocksdb_compaction_size_threshold_bytes;
-    options->rate_limiter = tablet_options.rate_limiter ? tablet_options.rate_limiter
-                                                        : CreateRocksDBRateLimiter();
+    options->max_subcompactions = FLAGS_rocksdb_max_subcompactions;
+    if (tablet_options.rate_limiter) {
+      options->rate_limiter = tablet_options.rate_limiter;
+    } else if (GetRocksDBRateLimiterSharingMode() == RateLimiterSharingMode::DISK) {
+      options->rate_limiter = GetDiskRateLimiter(group_no);
+    } else {
+      options->rate_limiter = CreateRocksDBRateLimiter();
+    }
   } else {
     options->level0_slowdown_writes_trigger = std::numeric_limits<int>::max();
     options->level0_stop_writes_trigger = std::numeric_limits<int>::max();
@@ -699,8 +926,19 @@ void InitRocksDBOptions(
 
   options->max_write_buffer_number = FLAGS_rocksdb_max_write_buffer_number;
 
-  options->memtable_factory = std::make_shared<rocksdb::SkipListFactory>(
-      0 /* lookahead */, rocksdb::ConcurrentWrites::kFalse);
+  options->allow_concurrent_memtable_write = FLAGS_rocksdb_allow_concurrent_memtable_write;
+  if (FLAGS_rocksdb_memtable_hash_index_buckets > 0) {
+    options->memtable_factory.reset(rocksdb::NewHashIndexedSkipListRepFactory(
+        std::make_shared<DocKeyExtractingTransform>(),
+        FLAGS_rocksdb_memtable_hash_index_buckets));
+  } else {
+    options->memtable_factory = std::make_shared<rocksdb::SkipListFactory>(
+        0 /* lookahead */,
+        rocksdb::ConcurrentWrites(FLAGS_rocksdb_allow_concurrent_memtable_write));
+  }
+
+  options->min_blob_size = FLAGS_rocksdb_min_blob_size;
+  options->blob_garbage_collection_ratio = FLAGS_rocksdb_blob_garbage_collection_ratio;
 
   options->iterator_replacer = std::make_shared<rocksdb::IteratorReplacer>(&WrapIterator);
 
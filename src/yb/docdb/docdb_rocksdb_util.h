@@ -58,6 +58,7 @@ BoundedRocksDbIterator CreateRocksDBIterator(
 
 // Values and transactions committed later than high_ht can be skipped, so we won't spend time
 // for re-requesting pending transaction status if we already know it wasn't committed at high_ht.
+// table_file_filter is applied to regular DB SST files in addition to the bloom filter.
 std::unique_ptr<IntentAwareIterator> CreateIntentAwareIterator(
     const DocDB& doc_db,
     BloomFilterMode bloom_filter_mode,
@@ -67,7 +68,9 @@ std::unique_ptr<IntentAwareIterator> CreateIntentAwareIterator(
     const ReadOperationData& read_operation_data,
     std::shared_ptr<rocksdb::ReadFileFilter> file_filter = nullptr,
     const Slice* iterate_upper_bound = nullptr,
-    const DocDBStatistics* statistics = nullptr);
+    const DocDBStatistics* statistics = nullptr,
+    const KeyBounds* read_bounds = nullptr,
+    std::shared_ptr<rocksdb::TableAwareReadFileFilter> table_file_filter = nullptr);
 
 std::shared_ptr<rocksdb::RocksDBPriorityThreadPoolMetrics> CreateRocksDBPriorityThreadPoolMetrics(
     scoped_refptr<yb::MetricEntity> entity);
@@ -85,7 +88,7 @@ Result<rocksdb::KeyValueEncodingFormat> GetConfiguredKeyValueEncodingFormat(
     const std::string& flag_value);
 
 // Defines how rate limiter is shared across a node
-YB_DEFINE_ENUM(RateLimiterSharingMode, (NONE)(TSERVER));
+YB_DEFINE_ENUM(RateLimiterSharingMode, (NONE)(TSERVER)(DISK));
 
 // Extracts rate limiter's sharing mode depending on the value of
 // flag `FLAGS_rocksdb_compact_flush_rate_limit_sharing_mode`;
@@ -21,6 +21,7 @@
 #include "yb/common/transaction-test-util.h"
 
 #include "yb/dockv/doc_key.h"
+#include "yb/docdb/doc_point_reader.h"
 #include "yb/docdb/doc_read_context.h"
 #include "yb/docdb/doc_rowwise_iterator.h"
 #include "yb/docdb/docdb.h"
@@ -54,7 +55,7 @@ using dockv::KeyEntryValue;
 using dockv::KeyEntryValues;
 using dockv::SubDocKey;
 
-YB_DEFINE_ENUM(IteratorMode, (kGeneric)(kPg));
+YB_DEFINE_ENUM(IteratorMode, (kGeneric)(kPg)(kPgBatch)(kPgLate));
 
 class DocRowwiseIteratorTest : public DocDBTestBase {
  protected:
@@ -414,6 +415,31 @@ Result<std::string> PgTableRowToString(
   return buffer.str();
 }
 
+Result<std::string> PgTableRowBatchEntryToString(
+    const Schema &schema, const dockv::PgTableRowBatch &batch, size_t row_idx,
+    const Schema *projection) {
+  std::stringstream buffer;
+  buffer << "{";
+  for (size_t idx = 0; idx < schema.num_columns(); idx++) {
+    if (idx != 0) {
+      buffer << ",";
+    }
+    if (projection &&
+        projection->find_column_by_id(schema.column_id(idx)) == Schema::kColumnNotFound) {
+      buffer << "missing";
+    } else {
+      auto column_idx = batch.projection().ColumnIdxById(schema.column_id(idx));
+      QLValue value;
+      if (column_idx != dockv::ReaderProjection::kNotFoundIndex) {
+        value = QLValue(batch.GetQLValuePB(column_idx, row_idx));
+      }
+      buffer << value.ToString();
+    }
+  }
+  buffer << "}";
+  return buffer.str();
+}
+
 Result<std::string> ConvertIteratorRowsToString(
     YQLRowwiseIteratorIf *iter,
     IteratorMode mode,
@@ -425,13 +451,52 @@ Result<std::string> ConvertIteratorRowsToString(
     while (VERIFY_RESULT(iter->FetchNext(&row))) {
       buffer << VERIFY_RESULT(QLTableRowToString(schema, row, projection)) << std::endl;
     }
-  } else {
+  } else if (mode == IteratorMode::kPg) {
     down_cast<docdb::DocRowwiseIterator*>(iter)->TEST_force_allow_fetch_pg_table_row();
     dockv::ReaderProjection reader_projection(projection ? *projection : schema);
     dockv::PgTableRow row(reader_projection);
     while (VERIFY_RESULT(iter->PgFetchNext(&row))) {
       buffer << VERIFY_RESULT(PgTableRowToString(schema, row, projection)) << std::endl;
     }
+  } else if (mode == IteratorMode::kPgLate) {
+    down_cast<docdb::DocRowwiseIterator*>(iter)->TEST_force_allow_fetch_pg_table_row();
+    dockv::ReaderProjection reader_projection(projection ? *projection : schema);
+    // Partial projection contains key columns and the first value column.
+    dockv::ReaderProjection partial_projection;
+    partial_projection.num_key_columns = reader_projection.num_key_columns;
+    partial_projection.columns.assign(
+        reader_projection.columns.begin(),
+        reader_projection.columns.begin() +
+            std::min(reader_projection.num_key_columns + 1, reader_projection.size()));
+    dockv::PgTableRow partial_row(partial_projection);
+    dockv::PgTableRow row(reader_projection);
+    while (VERIFY_RESULT(iter->PgFetchNextPartial(&partial_row))) {
+      RETURN_NOT_OK(iter->PgMaterializeRow(&row));
+      for (const auto& column : partial_projection.columns) {
+        SCHECK_EQ(
+            AsString(partial_row.GetQLValuePB(column.id)), AsString(row.GetQLValuePB(column.id)),
+            IllegalState, Format("Partial row mismatch for column $0", column.id));
+      }
+      buffer << VERIFY_RESULT(PgTableRowToString(schema, row, projection)) << std::endl;
+    }
+  } else {
+    // Use small batch size, so multiple batches are fetched in most tests.
+    constexpr size_t kBatchSize = 2;
+    down_cast<docdb::DocRowwiseIterator*>(iter)->TEST_force_allow_fetch_pg_table_row();
+    dockv::ReaderProjection reader_projection(projection ? *projection : schema);
+    dockv::PgTableRowBatch batch(reader_projection);
+    for (;;) {
+      batch.Reset();
+      auto fetched = VERIFY_RESULT(iter->PgFetchNextBatch(kBatchSize, &batch));
+      SCHECK_EQ(fetched, batch.size(), IllegalState, "Wrong number of rows in batch");
+      for (size_t row_idx = 0; row_idx != batch.size(); ++row_idx) {
+        buffer << VERIFY_RESULT(PgTableRowBatchEntryToString(schema, batch, row_idx, projection))
+               << std::endl;
+      }
+      if (fetched < kBatchSize) {
+        break;
+      }
+    }
   }
 
   return buffer.str();
@@ -444,7 +509,7 @@ void DocRowwiseIteratorTest::ValidateIterator(
     const Schema *projection,
     const std::string &expected,
     const HybridTime &expected_max_seen_ht) {
-  if (skip_pg_validation_ && mode == IteratorMode::kPg) {
+  if (skip_pg_validation_ && mode != IteratorMode::kGeneric) {
     return;
   }
 
@@ -888,6 +953,36 @@ void DocRowwiseIteratorTest::TestDocRowwiseIterator() {
       HybridTime::FromMicros(4000));
 }
 
+void DocRowwiseIteratorTest::TestPgPointReader() {
+  SetupDocRowwiseIteratorData();
+
+  const auto& schema = doc_read_context().schema();
+  dockv::ReaderProjection projection(schema);
+  auto pending_op = ScopedRWOperation::TEST_Create();
+  PgPointReader reader(
+      projection, doc_read_context(), kNonTransactionalOperationContext, doc_db(),
+      ReadOperationData::TEST_FromReadTimeMicros(5000), pending_op);
+  ASSERT_OK(reader.Init(kEncodedDocKey1.AsSlice(), kEncodedDocKey2.AsSlice()));
+
+  dockv::PgTableRow row(projection);
+  ASSERT_TRUE(ASSERT_RESULT(reader.Fetch(kEncodedDocKey1.AsSlice(), &row)));
+  ASSERT_EQ(ASSERT_RESULT(PgTableRowToString(schema, row, nullptr)),
+            R"#({string:"row1",int64:11111,string:"row1_c",int64:10000,string:"row1_e"})#");
+
+  // Missing row between existing ones.
+  const auto missing_key = dockv::MakeDocKey(std::string("row15"), int64_t{15555}).Encode();
+  ASSERT_FALSE(ASSERT_RESULT(reader.Fetch(missing_key.AsSlice(), &row)));
+
+  ASSERT_TRUE(ASSERT_RESULT(reader.Fetch(kEncodedDocKey2.AsSlice(), &row)));
+  ASSERT_EQ(ASSERT_RESULT(PgTableRowToString(schema, row, nullptr)),
+            R"#({string:"row2",int64:22222,null,int64:30000,string:"row2_e_prime"})#");
+
+  // Fetching backward requires a regular seek.
+  ASSERT_TRUE(ASSERT_RESULT(reader.Fetch(kEncodedDocKey1.AsSlice(), &row)));
+  ASSERT_EQ(ASSERT_RESULT(PgTableRowToString(schema, row, nullptr)),
+            R"#({string:"row1",int64:11111,string:"row1_c",int64:10000,string:"row1_e"})#");
+}
+
 void DocRowwiseIteratorTest::TestDocRowwiseIteratorDeletedDocument() {
   ASSERT_OK(SetPrimitive(
       DocPath(kEncodedDocKey1, KeyEntryValue::MakeColumnId(30_ColId)),
@@ -2138,5 +2233,9 @@ TEST_F(DocRowwiseIteratorTest, MaxNextsToAvoidSeek) {
   TestMaxNextsToAvoidSeek();
 }
 
+TEST_F(DocRowwiseIteratorTest, PgPointReader) {
+  TestPgPointReader();
+}
+
 }  // namespace docdb
 }  // namespace yb
@@ -52,6 +52,10 @@ DEFINE_RUNTIME_uint64(max_next_calls_while_skipping_future_records, 3,
                       "After number of next calls is reached this limit, use seek to find non "
                       "future record.");
 
+DEFINE_RUNTIME_bool(skip_intents_db_for_non_overlapping_reads, true,
+                    "Whether intent aware iterator should not read intents DB when read bounds "
+                    "don't overlap key ranges of running transaction intents.");
+
 namespace yb {
 namespace docdb {
 
@@ -127,7 +131,8 @@ IntentAwareIterator::IntentAwareIterator(
     const rocksdb::ReadOptions& read_opts,
     const ReadOperationData& read_operation_data,
     const TransactionOperationContext& txn_op_context,
-    rocksdb::Statistics* intentsdb_statistics)
+    rocksdb::Statistics* intentsdb_statistics,
+    const KeyBounds* read_bounds)
     : read_time_(read_operation_data.read_time),
       encoded_read_time_(read_operation_data.read_time),
       txn_op_context_(txn_op_context),
@@ -139,7 +144,11 @@ IntentAwareIterator::IntentAwareIterator(
           << ", txn_op_context: " << txn_op_context_;
 
   if (txn_op_context) {
-    if (txn_op_context.txn_status_manager->MinRunningHybridTime() != HybridTime::kMax) {
+    if (read_bounds && FLAGS_skip_intents_db_for_non_overlapping_reads &&
+        !txn_op_context.txn_status_manager->MayHaveIntentsInRange(
+            read_bounds->lower.AsSlice(), read_bounds->upper.AsSlice())) {
+      VLOG(4) << "No intents in read bounds: " << read_bounds->ToString();
+    } else if (txn_op_context.txn_status_manager->MinRunningHybridTime() != HybridTime::kMax) {
       intent_iter_ = docdb::CreateRocksDBIterator(doc_db.intents,
                                                   doc_db.key_bounds,
                                                   docdb::BloomFilterMode::DONT_USE_BLOOM_FILTER,
@@ -160,11 +169,23 @@ IntentAwareIterator::IntentAwareIterator(
   // 4) Transaction T1 is applied, k1->v1 is written into regular DB, intent k1->v1 is deleted.
   // 5) Intents DB iterator is created on an intents DB snapshot containing no intents for k1.
   // 6) Client reads no values for k1.
-  iter_ = BoundedRocksDbIterator(doc_db.regular, read_opts, doc_db.key_bounds);
+  if (doc_db.regular_iterator_pool && RocksDBIteratorPool::IsPoolable(read_opts)) {
+    iterator_pool_ = doc_db.regular_iterator_pool;
+    iter_ = BoundedRocksDbIterator(
+        iterator_pool_->Take(read_opts, &iterator_pool_tag_), doc_db.key_bounds);
+  } else {
+    iter_ = BoundedRocksDbIterator(doc_db.regular, read_opts, doc_db.key_bounds);
+  }
   iter_.UseFastNext(FLAGS_use_fast_next_for_iteration);
   VTRACE(2, "Created iterator");
 }
 
+IntentAwareIterator::~IntentAwareIterator() {
+  if (iterator_pool_ && iter_.Initialized()) {
+    iterator_pool_->Return(iterator_pool_tag_, iter_.Release());
+  }
+}
+
 void IntentAwareIterator::Seek(const dockv::DocKey &doc_key) {
   Seek(doc_key.Encode(), Full::kFalse);
 }
@@ -20,6 +20,7 @@
 
 #include "yb/docdb/bounded_rocksdb_iterator.h"
 #include "yb/docdb/intent_aware_iterator_interface.h"
+#include "yb/docdb/rocksdb_iterator_pool.h"
 #include "yb/docdb/transaction_status_cache.h"
 
 #include "yb/dockv/key_bytes.h"
@@ -58,7 +59,10 @@ class IntentAwareIterator final : public IntentAwareIteratorIf {
       const rocksdb::ReadOptions& read_opts,
       const ReadOperationData& read_operation_data,
       const TransactionOperationContext& txn_op_context,
-      rocksdb::Statistics* intentsdb_statistics = nullptr);
+      rocksdb::Statistics* intentsdb_statistics = nullptr,
+      const KeyBounds* read_bounds = nullptr);
+
+  ~IntentAwareIterator();
 
   IntentAwareIterator(const IntentAwareIterator& other) = delete;
   void operator=(const IntentAwareIterator& other) = delete;
@@ -279,6 +283,10 @@ class IntentAwareIterator final : public IntentAwareIteratorIf {
   BoundedRocksDbIterator intent_iter_;
   BoundedRocksDbIterator iter_;
 
+  // Pool that iter_ was taken from, iter_ is returned to it on destruction.
+  RocksDBIteratorPool* iterator_pool_ = nullptr;
+  RocksDBIteratorPool::Tag iterator_pool_tag_;
+
   // regular_value_ contains value for the current entry from regular db.
   // Empty if there is no current value in regular db.
   rocksdb::KeyValueEntry regular_entry_;
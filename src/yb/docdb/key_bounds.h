@@ -22,6 +22,7 @@ namespace yb {
 namespace docdb {
 
 class HistoryRetentionPolicy;
+class RocksDBIteratorPool;
 
 // Optional inclusive lower bound and exclusive upper bound for keys served by DocDB.
 // Could be used to split tablet without doing actual splitting of RocksDB files.
@@ -57,6 +58,8 @@ struct DocDB {
   const KeyBounds* key_bounds = nullptr;
   HistoryRetentionPolicy* retention_policy = nullptr;
   tablet::TabletMetrics* metrics = nullptr;
+  // Optional pool of regular DB iterators, reused by reads that do not require specific iterator.
+  RocksDBIteratorPool* regular_iterator_pool = nullptr;
 
   static DocDB FromRegularUnbounded(rocksdb::DB* regular) {
     return {regular, nullptr /* intents */, &KeyBounds::kNoBounds,
@@ -64,7 +67,8 @@ struct DocDB {
   }
 
   DocDB WithoutIntents() {
-    return {regular, nullptr /* intents */, key_bounds, retention_policy, metrics};
+    return {regular, nullptr /* intents */, key_bounds, retention_policy, metrics,
+        regular_iterator_pool};
   }
 };
 
@@ -29,8 +29,13 @@
 #include "yb/common/ql_value.h"
 #include "yb/common/row_mark.h"
 
+#include "yb/docdb/doc_pg_batch_aggregate.h"
+#include "yb/docdb/doc_pg_block_sampler.h"
 #include "yb/docdb/doc_pg_expr.h"
+#include "yb/docdb/doc_pg_grouped_aggregate.h"
+#include "yb/docdb/doc_pg_top_n.h"
 #include "yb/docdb/doc_pgsql_scanspec.h"
+#include "yb/docdb/doc_point_reader.h"
 #include "yb/docdb/doc_read_context.h"
 #include "yb/docdb/doc_rowwise_iterator.h"
 #include "yb/docdb/doc_write_batch.h"
@@ -55,12 +60,15 @@
 #include "yb/rpc/sidecars.h"
 
 #include "yb/util/algorithm_util.h"
+#include "yb/util/countdown_latch.h"
 #include "yb/util/enums.h"
 #include "yb/util/flags.h"
 #include "yb/util/logging.h"
 #include "yb/util/result.h"
 #include "yb/util/scope_exit.h"
 #include "yb/util/status_format.h"
+#include "yb/util/status_log.h"
+#include "yb/util/threadpool.h"
 #include "yb/util/trace.h"
 #include "yb/util/yb_pg_errcodes.h"
 
@@ -69,6 +77,7 @@
 using namespace std::literals;
 
 DECLARE_bool(ysql_disable_index_backfill);
+DECLARE_bool(ysql_use_flat_doc_reader);
 
 DEPRECATE_FLAG(double, ysql_scan_timeout_multiplier, "10_2022");
 
@@ -117,6 +126,50 @@ DEFINE_RUNTIME_bool(ysql_enable_pack_full_row_update, false,
 DEFINE_RUNTIME_PREVIEW_bool(ysql_use_packed_row_v2, false,
                             "Whether to use packed row V2 when row packing is enabled.");
 
+DEFINE_RUNTIME_bool(ysql_use_batch_aggregate, true,
+                    "Whether to evaluate pushed down COUNT/SUM/MIN/MAX over fixed width columns "
+                    "using column-major row batches instead of row by row evaluation.");
+
+DEFINE_RUNTIME_uint32(ysql_aggregate_batch_size, 1024,
+                      "Number of rows fetched at once by batch aggregate evaluation.");
+
+DEFINE_RUNTIME_uint32(ysql_late_materialization_min_deferred_columns, 8,
+                      "Min number of projected columns not referenced by the scan filter, to "
+                      "decode them only for rows accepted by the filter. 0 disables late "
+                      "materialization.");
+
+DEFINE_RUNTIME_uint32(ysql_parallel_scan_max_ranges, 0,
+                      "Max number of key ranges scanned in parallel by a batch aggregate "
+                      "evaluation over a single tablet. Values less than 2 disable parallel "
+                      "scan.");
+
+DEFINE_RUNTIME_uint64(ysql_parallel_scan_min_range_size_bytes, 1024 * 1024 * 1024,
+                      "Min amount of tablet data per key range scanned in parallel by a batch "
+                      "aggregate evaluation.");
+
+DEFINE_test_flag(int32, parallel_scan_stop_range, -1,
+                 "Index of the key range, whose parallel scan is stopped after the first batch "
+                 "as if the deadline was reached.");
+
+DEFINE_RUNTIME_uint32(ysql_sampling_block_stride, 1,
+                      "ANALYZE of a hash partitioned table reads one of this number of blocks of "
+                      "consecutive rows, picked at random, instead of all the rows, and estimates "
+                      "the number of rows in the table from the density of rows in the read "
+                      "blocks. 1 reads all the rows.");
+
+DEFINE_RUNTIME_uint32(ysql_sampling_block_rows, 256,
+                      "Number of consecutive rows in a block read by ANALYZE, see "
+                      "ysql_sampling_block_stride.");
+
+DEFINE_RUNTIME_bool(ysql_use_point_reader, true,
+                    "Whether to read rows of ybctid batches without where clauses by point "
+                    "lookups instead of the generic row iterator.");
+
+DEFINE_RUNTIME_uint32(ysql_prefetch_ybctid_batch_min_size, 16,
+                      "Minimal number of ybctids in a batch read by the point reader, for which "
+                      "data blocks of all rows are prefetched from SST files before reading the "
+                      "rows. 0 to disable prefetching.");
+
 namespace yb::docdb {
 
 using dockv::DocKey;
@@ -513,11 +566,10 @@ class FilteringIterator {
       bool is_explicit_request_read_time,
       std::reference_wrapper<const ScopedRWOperation> pending_op,
       const DocDBStatistics* statistics) {
-    RETURN_NOT_OK(InitCommon(request, read_context.get().schema(), projection));
     iterator_holder_ = VERIFY_RESULT(CreateIterator(
         ql_storage, request, projection, read_context, txn_op_context, read_operation_data,
         is_explicit_request_read_time, pending_op, statistics));
-    return Status::OK();
+    return InitCommon(request, read_context.get().schema(), projection);
   }
 
   Status InitForYbctid(
@@ -532,26 +584,19 @@ class FilteringIterator {
       std::reference_wrapper<const ScopedRWOperation> pending_op,
       const docdb::DocDBStatistics* statistics,
       SkipSeek skip_seek) {
-    RETURN_NOT_OK(InitCommon(request, read_context.get().schema(), projection));
-    return ql_storage.GetIteratorForYbctid(
+    RETURN_NOT_OK(ql_storage.GetIteratorForYbctid(
         request.stmt_id(), projection, read_context, txn_op_context, read_operation_data,
-        min_ybctid, max_ybctid, pending_op, &iterator_holder_, statistics, skip_seek);
+        min_ybctid, max_ybctid, pending_op, &iterator_holder_, statistics, skip_seek));
+    return InitCommon(request, read_context.get().schema(), projection);
   }
 
   Result<FetchResult> FetchNext(dockv::PgTableRow* table_row) {
-    if (!VERIFY_RESULT(iterator_holder_->PgFetchNext(table_row))) {
-      return FetchResult::NotFound;
-    }
-    return CheckFilter(*table_row);
+    return DoFetchNext(table_row, Slice());
   }
 
   Result<FetchResult> FetchTuple(const Slice& tuple_id, dockv::PgTableRow* row) {
     iterator_holder_->SeekTuple(tuple_id);
-    if (!VERIFY_RESULT(iterator_holder_->PgFetchNext(row)) ||
-        iterator_holder_->GetTupleId() != tuple_id) {
-      return FetchResult::NotFound;
-    }
-    return CheckFilter(*row);
+    return DoFetchNext(row, tuple_id);
   }
 
  private:
@@ -562,14 +607,73 @@ class FilteringIterator {
     if (where_clauses.empty()) {
       return Status::OK();
     }
-    DocPgExprExecutorBuilder builder(schema, projection);
+    if (iterator_holder_->SupportsLateMaterialization()) {
+      InitLateMaterialization(request, schema, projection);
+    }
+    DocPgExprExecutorBuilder builder(
+        schema, filter_projection_ ? *filter_projection_ : projection);
     for (const auto& exp : where_clauses) {
       RETURN_NOT_OK(builder.AddWhere(exp));
     }
     filter_.emplace(VERIFY_RESULT(builder.Build(request.col_refs())));
+    if (filter_projection_) {
+      partial_row_.emplace(*filter_projection_);
+    }
     return Status::OK();
   }
 
+  // Late materialization is used when where clauses are serialized Postgres expressions and
+  // enough columns of the projection are not referenced by them. Columns referenced by the
+  // expressions are listed in col_refs with Postgres type information.
+  void InitLateMaterialization(
+      const PgsqlReadRequestPB& request, const Schema& schema,
+      const dockv::ReaderProjection& projection) {
+    const auto min_deferred_columns = FLAGS_ysql_late_materialization_min_deferred_columns;
+    if (min_deferred_columns == 0 || projection.num_value_columns() < min_deferred_columns) {
+      return;
+    }
+    for (const auto& exp : request.where_clauses()) {
+      if (!exp.has_tscall() || exp.tscall().operands_size() != 1) {
+        return;
+      }
+    }
+    std::vector<ColumnId> filter_columns;
+    for (const auto& col_ref : request.col_refs()) {
+      if (col_ref.has_typid()) {
+        filter_columns.emplace_back(col_ref.column_id());
+      }
+    }
+    dockv::ReaderProjection filter_projection(schema, filter_columns);
+    if (projection.num_value_columns() <
+            filter_projection.num_value_columns() + min_deferred_columns) {
+      return;
+    }
+    VLOG(3) << "Late materialization, filter projection: " << filter_projection.ToString();
+    filter_projection_.emplace(std::move(filter_projection));
+  }
+
+  // Fetches next row. When tuple_id is not empty, the row is expected to have this tuple id.
+  Result<FetchResult> DoFetchNext(dockv::PgTableRow* row, Slice tuple_id) {
+    if (!partial_row_) {
+      if (!VERIFY_RESULT(iterator_holder_->PgFetchNext(row)) ||
+          (!tuple_id.empty() && iterator_holder_->GetTupleId() != tuple_id)) {
+        return FetchResult::NotFound;
+      }
+      return CheckFilter(*row);
+    }
+
+    // Decode columns referenced by the filter first, and the rest only if the row is accepted.
+    if (!VERIFY_RESULT(iterator_holder_->PgFetchNextPartial(&*partial_row_)) ||
+        (!tuple_id.empty() && iterator_holder_->GetTupleId() != tuple_id)) {
+      return FetchResult::NotFound;
+    }
+    if (VERIFY_RESULT(CheckFilter(*partial_row_)) != FetchResult::Found) {
+      return FetchResult::FilteredOut;
+    }
+    RETURN_NOT_OK(iterator_holder_->PgMaterializeRow(row));
+    return FetchResult::Found;
+  }
+
   Result<FetchResult> CheckFilter(const dockv::PgTableRow& row) {
     return filter_ && !VERIFY_RESULT(filter_->Exec(row))
         ? FetchResult::FilteredOut : FetchResult::Found;
@@ -577,6 +681,9 @@ class FilteringIterator {
 
   std::unique_ptr<YQLRowwiseIteratorIf>& iterator_holder_;
   boost::optional<DocPgExprExecutor> filter_;
+  // Projection of columns referenced by filter_, set when late materialization is used.
+  std::optional<dockv::ReaderProjection> filter_projection_;
+  std::optional<dockv::PgTableRow> partial_row_;
 };
 
 struct IndexState {
@@ -637,6 +744,117 @@ Result<FetchResult> FetchTableRow(
   return fetch_result;
 }
 
+// Key range of the tablet scanned in parallel by a batch aggregate evaluation.
+struct ParallelScanRange {
+  PgsqlReadRequestPB request;
+  YQLRowwiseIteratorIf::UniPtr iterator;
+  std::optional<DocPgBatchAggregator> aggregator;
+  std::unique_ptr<DocDBStatistics> statistics;
+  size_t match_count = 0;
+  // Whether all rows of the range were consumed, i.e. scan was not stopped by deadline.
+  bool completed = false;
+  Status status;
+};
+
+bool CanScanInParallel(const PgsqlReadRequestPB& request) {
+  return request.is_forward_scan() && request.prefix_length() == 0 &&
+         !request.has_index_request() && !request.has_ybctid_column_value() &&
+         !request.is_for_backfill() && !request.has_sampling_state() &&
+         request.batch_arguments().empty() && request.partition_column_values().empty() &&
+         request.range_column_values().empty() && !request.has_condition_expr() &&
+         request.where_clauses().empty();
+}
+
+// Splits request into requests reading adjacent key ranges, in the key order.
+// Only the first range continues from the paging state of the original request.
+std::vector<PgsqlReadRequestPB> SplitRequest(
+    const PgsqlReadRequestPB& request, const Schema& schema, const ScanSplitPoints& points) {
+  Slice paging_key;
+  if (request.has_paging_state() && request.paging_state().has_next_row_key()) {
+    paging_key = request.paging_state().next_row_key();
+  }
+
+  std::vector<PgsqlReadRequestPB> result;
+  if (schema.num_hash_key_columns() > 0) {
+    uint32_t min_hash = request.has_hash_code() ? request.hash_code() : 0;
+    const uint32_t max_hash = request.has_max_hash_code()
+        ? request.max_hash_code() : std::numeric_limits<uint16_t>::max();
+    auto first_hash = min_hash;
+    if (!paging_key.empty()) {
+      auto paging_hash = dockv::DecodeDocKeyHash(paging_key);
+      if (paging_hash.ok() && *paging_hash) {
+        first_hash = std::max<uint32_t>(first_hash, **paging_hash);
+      }
+    }
+    std::vector<uint32_t> starts = {min_hash};
+    for (auto hash : points.hash_codes) {
+      if (hash > first_hash && hash <= max_hash) {
+        starts.push_back(hash);
+      }
+    }
+    for (size_t i = 0; i != starts.size(); ++i) {
+      auto& range_request = result.emplace_back(request);
+      range_request.set_hash_code(starts[i]);
+      range_request.set_max_hash_code(i + 1 < starts.size() ? starts[i + 1] - 1 : max_hash);
+    }
+  } else {
+    Slice lower = request.has_lower_bound() ? Slice(request.lower_bound().key()) : Slice();
+    Slice upper = request.has_upper_bound() ? Slice(request.upper_bound().key()) : Slice();
+    std::vector<Slice> starts;
+    for (const auto& key : points.doc_keys) {
+      if (Slice(key) > lower && Slice(key) > paging_key && (upper.empty() || Slice(key) < upper)) {
+        starts.push_back(key);
+      }
+    }
+    for (size_t i = 0; i <= starts.size(); ++i) {
+      auto& range_request = result.emplace_back(request);
+      if (i > 0) {
+        auto& lower_bound = *range_request.mutable_lower_bound();
+        lower_bound.set_key(starts[i - 1].cdata(), starts[i - 1].size());
+        lower_bound.set_is_inclusive(true);
+      }
+      if (i < starts.size()) {
+        auto& upper_bound = *range_request.mutable_upper_bound();
+        upper_bound.set_key(starts[i].cdata(), starts[i].size());
+        upper_bound.set_is_inclusive(false);
+      }
+    }
+  }
+  for (size_t i = 1; i < result.size(); ++i) {
+    if (result[i].has_paging_state()) {
+      result[i].mutable_paging_state()->clear_next_row_key();
+    }
+  }
+  return result;
+}
+
+Status ScanParallelRange(
+    const YQLStorageIf& ql_storage, const dockv::ReaderProjection& projection,
+    const DocReadContext& doc_read_context, const TransactionOperationContext& txn_op_context,
+    const ReadOperationData& read_operation_data, bool is_explicit_request_read_time,
+    std::reference_wrapper<const ScopedRWOperation> pending_op, CoarseTimePoint stop_scan,
+    ParallelScanRange* range) {
+  range->iterator = VERIFY_RESULT(CreateIterator(
+      ql_storage, range->request, projection, doc_read_context, txn_op_context,
+      read_operation_data, is_explicit_request_read_time, pending_op, range->statistics.get()));
+  const size_t batch_size = std::max<size_t>(FLAGS_ysql_aggregate_batch_size, 1);
+  dockv::PgTableRowBatch batch(projection);
+  batch.Reserve(batch_size);
+  for (;;) {
+    batch.Reset();
+    const auto num_rows = VERIFY_RESULT(range->iterator->PgFetchNextBatch(batch_size, &batch));
+    if (num_rows == 0) {
+      range->completed = true;
+      return Status::OK();
+    }
+    range->match_count += num_rows;
+    range->aggregator->Consume(batch);
+    if (CoarseMonoClock::now() >= stop_scan) {
+      return Status::OK();
+    }
+  }
+}
+
 struct RowPackerData {
   SchemaVersion schema_version;
   const dockv::SchemaPacking& packing;
@@ -831,7 +1049,8 @@ Result<bool> PgsqlWriteOperation::HasDuplicateUniqueIndexValue(
       txn_op_context_,
       data.doc_write_batch->doc_db(),
       data.read_operation_data.WithAlteredReadTime(read_time),
-      data.doc_write_batch->pending_op());
+      data.doc_write_batch->pending_op(),
+      data.statistics);
   RETURN_NOT_OK(iterator.Init(spec));
 
   // It is a duplicate value if the index key exists already and the index value (corresponding to
@@ -1383,7 +1602,8 @@ Status PgsqlWriteOperation::UpdateIterator(
       txn_op_context_,
       data->doc_write_batch->doc_db(),
       data->read_operation_data,
-      data->doc_write_batch->pending_op());
+      data->doc_write_batch->pending_op(),
+      data->statistics);
 
   static const dockv::DocKey kEmptyDocKey;
   auto& key = single_operation ? doc_key_ : kEmptyDocKey;
@@ -1520,6 +1740,8 @@ Status PgsqlWriteOperation::GetDocPaths(GetDocPathsMode mode,
 
 //--------------------------------------------------------------------------------------------------
 
+PgsqlReadOperation::~PgsqlReadOperation() = default;
+
 Result<size_t> PgsqlReadOperation::Execute(
     const YQLStorageIf& ql_storage,
     const ReadOperationData& read_operation_data,
@@ -1561,12 +1783,20 @@ Result<size_t> PgsqlReadOperation::Execute(
   }
 
   VTRACE(1, "Fetched $0 rows. $1 paging state", fetched_rows, (has_paging_state ? "No" : "Has"));
-  SCHECK(table_iter_ != nullptr, InternalError, "table iterator is invalid");
+  SCHECK(table_iter_ != nullptr || point_reader_ != nullptr, InternalError,
+         "table iterator is invalid");
 
-  *restart_read_ht = VERIFY_RESULT(table_iter_->RestartReadHt());
+  *restart_read_ht = table_iter_ ? VERIFY_RESULT(table_iter_->RestartReadHt())
+                                 : HybridTime::kInvalid;
+  if (point_reader_) {
+    restart_read_ht->MakeAtLeast(VERIFY_RESULT(point_reader_->RestartReadHt()));
+  }
   if (index_iter_) {
     restart_read_ht->MakeAtLeast(VERIFY_RESULT(index_iter_->RestartReadHt()));
   }
+  for (const auto& iter : parallel_scan_iters_) {
+    restart_read_ht->MakeAtLeast(VERIFY_RESULT(iter->RestartReadHt()));
+  }
   return fetched_rows;
 }
 
@@ -1588,6 +1818,9 @@ Result<size_t> PgsqlReadOperation::ExecuteSample(
   int numrows = sampling_state.numrows();
   // Total number of rows scanned
   double samplerows = sampling_state.samplerows();
+  // Estimated number of rows in the scanned part of the table, including skipped blocks
+  double estimated_total_rows = sampling_state.has_estimated_total_rows()
+      ? sampling_state.estimated_total_rows() : samplerows;
   // Current number of rows to skip before collecting next one for sample
   double rowstoskip = sampling_state.rowstoskip();
   // Variables for the random numbers generator
@@ -1611,6 +1844,14 @@ Result<size_t> PgsqlReadOperation::ExecuteSample(
   table_iter_ = VERIFY_RESULT(CreateIterator(
       ql_storage, request_, projection, doc_read_context, txn_op_context_,
       read_operation_data, is_explicit_request_read_time, pending_op, statistics));
+  // Rows are uniformly distributed over hash codes, so blocks starting at random hash codes are
+  // random samples of the table.
+  std::optional<DocPgBlockSampler> block_sampler;
+  if (FLAGS_ysql_sampling_block_stride > 1 &&
+      doc_read_context.schema().num_hash_key_columns() > 0) {
+    block_sampler.emplace(FLAGS_ysql_sampling_block_stride, FLAGS_ysql_sampling_block_rows);
+  }
+  const double initial_samplerows = samplerows;
   bool scan_time_exceeded = false;
   auto stop_scan = read_operation_data.deadline - FLAGS_ysql_scan_deadline_margin_ms * 1ms;
   while (VERIFY_RESULT(table_iter_->FetchNext(nullptr))) {
@@ -1643,6 +1884,20 @@ Result<size_t> PgsqlReadOperation::ExecuteSample(
       }
     }
 
+    if (block_sampler) {
+      auto seek_hash = block_sampler->RowRead(
+          VERIFY_RESULT(DocKey::DecodeHash(table_iter_->GetTupleId())));
+      if (seek_hash) {
+        if (*seek_hash > std::numeric_limits<DocKeyHash>::max()) {
+          break;
+        }
+        dockv::KeyBytes seek_key;
+        seek_key.AppendKeyEntryType(dockv::KeyEntryType::kUInt16Hash);
+        seek_key.AppendUInt16(*seek_hash);
+        table_iter_->SeekTuple(seek_key.AsSlice());
+      }
+    }
+
     // Check if we are running out of time
     scan_time_exceeded = CoarseMonoClock::now() >= stop_scan;
     if (scan_time_exceeded) {
@@ -1672,6 +1927,9 @@ Result<size_t> PgsqlReadOperation::ExecuteSample(
   new_sampling_state->set_numrows(numrows);
   new_sampling_state->set_targrows(targrows);
   new_sampling_state->set_samplerows(samplerows);
+  estimated_total_rows += block_sampler ? block_sampler->EstimatedRows()
+                                        : samplerows - initial_samplerows;
+  new_sampling_state->set_estimated_total_rows(estimated_total_rows);
   new_sampling_state->set_rowstoskip(rowstoskip);
   uint64_t randstate = 0;
   double rstate_w = 0;
@@ -1723,6 +1981,31 @@ Result<size_t> PgsqlReadOperation::ExecuteScalar(
   // projection only to scan sub-documents. The query schema is used to select only referenced
   // columns and key columns.
   auto doc_projection = CreateProjection(doc_read_context.schema(), request_);
+
+  // Aggregates without filter could be evaluated over whole row batches.
+  std::optional<DocPgBatchAggregator> batch_aggregator;
+  if (FLAGS_ysql_use_batch_aggregate && !index_doc_read_context &&
+      request_.where_clauses().empty() && !request_.num_group_by_targets()) {
+    batch_aggregator = DocPgBatchAggregator::TryCreate(request_, doc_projection);
+  }
+
+  if (batch_aggregator && FLAGS_ysql_parallel_scan_max_ranges > 1 &&
+      ql_storage.ParallelScanPool() && batch_aggregator->IsMergeable() &&
+      CanScanInParallel(request_)) {
+    auto split_points = ql_storage.GetScanSplitPoints(
+        doc_read_context.schema(), FLAGS_ysql_parallel_scan_max_ranges,
+        FLAGS_ysql_parallel_scan_min_range_size_bytes);
+    if (!split_points.empty()) {
+      auto range_requests = SplitRequest(request_, doc_read_context.schema(), split_points);
+      if (range_requests.size() > 1) {
+        return ExecuteParallelBatchAggregate(
+            ql_storage, read_operation_data, is_explicit_request_read_time, doc_read_context,
+            pending_op, doc_projection, *batch_aggregator, std::move(range_requests),
+            result_buffer, has_paging_state, statistics);
+      }
+    }
+  }
+
   FilteringIterator table_iter(&table_iter_);
   RETURN_NOT_OK(table_iter.Init(
       ql_storage, request_, doc_projection, doc_read_context, txn_op_context_, read_operation_data,
@@ -1749,35 +2032,66 @@ Result<size_t> PgsqlReadOperation::ExecuteScalar(
   size_t match_count = 0;
   bool limit_exceeded = false;
   size_t fetched_rows = 0;
-  dockv::PgTableRow row(doc_projection);
-  const auto& table_id = request_.index_request().table_id();
-  do {
-    const auto fetch_result = VERIFY_RESULT(FetchTableRow(
-        table_id, &table_iter, index_state ? &*index_state : nullptr, &row));
-    // If changing this code, see also PgsqlReadOperation::ExecuteBatchYbctid.
-    if (fetch_result == FetchResult::NotFound) {
-      break;
-    }
-    if (fetch_result == FetchResult::Found) {
-      ++match_count;
-      if (request_.is_aggregate()) {
-        RETURN_NOT_OK(EvalAggregate(row));
-      } else {
-        RETURN_NOT_OK(PopulateResultSet(row, result_buffer));
-        ++fetched_rows;
+  if (batch_aggregator) {
+    const size_t batch_size = std::max<size_t>(FLAGS_ysql_aggregate_batch_size, 1);
+    dockv::PgTableRowBatch batch(doc_projection);
+    batch.Reserve(batch_size);
+    do {
+      batch.Reset();
+      const auto num_rows = VERIFY_RESULT(table_iter_->PgFetchNextBatch(batch_size, &batch));
+      if (num_rows == 0) {
+        break;
       }
+      match_count += num_rows;
+      batch_aggregator->Consume(batch);
+      scan_time_exceeded = CoarseMonoClock::now() >= stop_scan;
+      limit_exceeded = scan_time_exceeded;
+    } while (!limit_exceeded);
+    if (match_count > 0) {
+      batch_aggregator->Finish(&aggr_result_);
     }
-    scan_time_exceeded = CoarseMonoClock::now() >= stop_scan;
-    limit_exceeded =
-      (scan_time_exceeded ||
-       fetched_rows >= row_count_limit ||
-       result_buffer->size() >= response_size_limit);
-  } while (!limit_exceeded);
+  } else {
+    if (!request_.is_aggregate() && request_.top_n_limit() &&
+        !request_.top_n_sort_keys().empty()) {
+      top_n_heap_ = std::make_unique<DocPgTopNHeap>(request_, this);
+    }
+    dockv::PgTableRow row(doc_projection);
+    const auto& table_id = request_.index_request().table_id();
+    do {
+      const auto fetch_result = VERIFY_RESULT(FetchTableRow(
+          table_id, &table_iter, index_state ? &*index_state : nullptr, &row));
+      // If changing this code, see also PgsqlReadOperation::ExecuteBatchYbctid.
+      if (fetch_result == FetchResult::NotFound) {
+        break;
+      }
+      if (fetch_result == FetchResult::Found) {
+        ++match_count;
+        if (request_.is_aggregate()) {
+          RETURN_NOT_OK(EvalAggregate(row));
+        } else if (top_n_heap_) {
+          RETURN_NOT_OK(AddTopNCandidate(row));
+        } else {
+          RETURN_NOT_OK(PopulateResultSet(row, result_buffer));
+          ++fetched_rows;
+        }
+      }
+      scan_time_exceeded = CoarseMonoClock::now() >= stop_scan;
+      limit_exceeded =
+        (scan_time_exceeded ||
+         fetched_rows >= row_count_limit ||
+         result_buffer->size() >= response_size_limit ||
+         IsGroupedAggregateFull());
+    } while (!limit_exceeded);
+  }
 
   // Output aggregate values accumulated while looping over rows
   if (request_.is_aggregate() && match_count > 0) {
-    RETURN_NOT_OK(PopulateAggregate(result_buffer));
-    ++fetched_rows;
+    fetched_rows += VERIFY_RESULT(PopulateAggregate(result_buffer));
+  }
+
+  // Output top N rows collected while looping over rows
+  if (top_n_heap_) {
+    fetched_rows += top_n_heap_->Finish(result_buffer);
   }
 
   VLOG(1) << "Stopped iterator after " << match_count << " matches, " << fetched_rows
@@ -1807,6 +2121,118 @@ Result<size_t> PgsqlReadOperation::ExecuteScalar(
   return fetched_rows;
 }
 
+Result<size_t> PgsqlReadOperation::ExecuteParallelBatchAggregate(
+    const YQLStorageIf& ql_storage,
+    const ReadOperationData& read_operation_data,
+    bool is_explicit_request_read_time,
+    const DocReadContext& doc_read_context,
+    std::reference_wrapper<const ScopedRWOperation> pending_op,
+    const dockv::ReaderProjection& projection,
+    const DocPgBatchAggregator& aggregator,
+    std::vector<PgsqlReadRequestPB> range_requests,
+    WriteBuffer* result_buffer,
+    bool* has_paging_state,
+    const DocDBStatistics* statistics) {
+  VLOG(1) << "Scanning " << range_requests.size() << " key ranges in parallel";
+  const auto stop_scan = read_operation_data.deadline - FLAGS_ysql_scan_deadline_margin_ms * 1ms;
+  std::vector<ParallelScanRange> ranges(range_requests.size());
+  for (size_t i = 0; i != ranges.size(); ++i) {
+    auto& range = ranges[i];
+    range.request = std::move(range_requests[i]);
+    range.aggregator = aggregator;
+    if (statistics) {
+      // Scoped statistics are not thread safe, so every range collects its own.
+      range.statistics = std::make_unique<DocDBStatistics>();
+    }
+  }
+
+  auto scan_range = [&](ParallelScanRange* range) {
+    auto range_stop_scan = stop_scan;
+    if (PREDICT_FALSE(std::cmp_equal(
+            range - ranges.data(), FLAGS_TEST_parallel_scan_stop_range))) {
+      range_stop_scan = CoarseTimePoint::min();
+    }
+    range->status = ScanParallelRange(
+        ql_storage, projection, doc_read_context, txn_op_context_, read_operation_data,
+        is_explicit_request_read_time, pending_op, range_stop_scan, range);
+  };
+  auto* pool = ql_storage.ParallelScanPool();
+  CountDownLatch latch(ranges.size() - 1);
+  for (size_t i = 1; i != ranges.size(); ++i) {
+    auto task = [&scan_range, range = &ranges[i], &latch] {
+      scan_range(range);
+      latch.CountDown();
+    };
+    if (!pool->SubmitFunc(task).ok()) {
+      task();
+    }
+  }
+  // The first range is scanned by the current thread.
+  scan_range(&ranges.front());
+  latch.Wait();
+
+  // Results of ranges are merged in the key order, up to the first range that was not scanned
+  // completely. Rows after it will be read by the next page.
+  *has_paging_state = false;
+  size_t match_count = 0;
+  DocPgBatchAggregator* result = nullptr;
+  bool stopped = false;
+  for (auto& range : ranges) {
+    if (range.statistics) {
+      range.statistics->MergeAndClear(
+          statistics->RegularDBStatistics(), statistics->IntentsDBStatistics());
+    }
+    if (stopped) {
+      continue;
+    }
+    RETURN_NOT_OK(range.status);
+    match_count += range.match_count;
+    if (result) {
+      result->Merge(*range.aggregator);
+    } else {
+      result = &*range.aggregator;
+    }
+    if (!range.completed) {
+      stopped = !request_.return_paging_state() || VERIFY_RESULT(SetPagingState(
+          range.iterator.get(), doc_read_context.schema(), read_operation_data.read_time));
+      *has_paging_state = stopped && request_.return_paging_state();
+    }
+  }
+
+  for (auto& range : ranges) {
+    if (!range.iterator) {
+      continue;
+    }
+    if (!table_iter_) {
+      table_iter_ = std::move(range.iterator);
+    } else {
+      parallel_scan_iters_.push_back(std::move(range.iterator));
+    }
+  }
+
+  VLOG(1) << "Stopped parallel scan after " << match_count << " matches";
+
+  if (match_count == 0) {
+    return 0;
+  }
+  result->Finish(&aggr_result_);
+  return PopulateAggregate(result_buffer);
+}
+
+namespace {
+
+bool HasTupleIdTarget(const PgsqlReadRequestPB& request) {
+  for (const auto& target : request.targets()) {
+    if (target.expr_case() == PgsqlExpressionPB::kColumnId &&
+        target.column_id() == to_underlying(PgSystemAttrNum::kYBTupleId)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
 Result<size_t> PgsqlReadOperation::ExecuteBatchYbctid(
     const YQLStorageIf& ql_storage,
     const ReadOperationData& read_operation_data,
@@ -1838,26 +2264,53 @@ Result<size_t> PgsqlReadOperation::ExecuteBatchYbctid(
   auto projection = CreateProjection(doc_read_context.schema(), request_);
   dockv::PgTableRow row(projection);
   std::optional<FilteringIterator> iter;
+  // Without where clauses each ybctid is an independent point lookup, so there is no need to
+  // run it through the generic row iterator, that is designed for scans.
+  // Tuple id target is encoded from table_iter_, so such requests still use the iterator.
+  if (FLAGS_ysql_use_point_reader && FLAGS_ysql_use_flat_doc_reader &&
+      request_.where_clauses().empty() && !HasTupleIdTarget(request_)) {
+    RETURN_NOT_OK(ql_storage.GetPointReaderForYbctid(
+        projection, doc_read_context, txn_op_context_, read_operation_data,
+        min_arg->ybctid().value().binary_value(), max_arg->ybctid().value().binary_value(),
+        pending_op, &point_reader_, statistics));
+    const auto prefetch_min_size = FLAGS_ysql_prefetch_ybctid_batch_min_size;
+    if (prefetch_min_size && static_cast<size_t>(batch_args.size()) >= prefetch_min_size) {
+      std::vector<Slice> ybctids;
+      ybctids.reserve(batch_args.size());
+      for (const auto& batch_argument : batch_args) {
+        ybctids.push_back(batch_argument.ybctid().value().binary_value());
+      }
+      // Prefetch is an optimization only, so its failure should not fail the read.
+      WARN_NOT_OK(point_reader_->Prefetch(ybctids), "Failed to prefetch ybctid batch");
+    }
+  }
   size_t row_count = 0;
   size_t fetched_rows = 0;
   for (const auto& batch_argument : batch_args) {
-    if (!iter) {
-      // It can be the case like when there is a tablet split that we still want
-      // to continue seeking through all the given batch arguments even though one
-      // of them wasn't found. If it wasn't found, table_iter_ becomes invalid
-      // and we have to make a new iterator.
-      // TODO (dmitry): In case of iterator recreation info from RestartReadHt field will be lost.
-      //                The #17159 issue is created for this problem.
-      iter.emplace(&table_iter_);
-      RETURN_NOT_OK(iter->InitForYbctid(
-          ql_storage, request_, projection, doc_read_context, txn_op_context_, read_operation_data,
-          min_arg->ybctid().value(), max_arg->ybctid().value(), pending_op, statistics,
-          SkipSeek::kTrue));
+    const auto ybctid = batch_argument.ybctid().value().binary_value();
+    FetchResult fetch_result;
+    if (point_reader_) {
+      fetch_result = VERIFY_RESULT(point_reader_->Fetch(ybctid, &row))
+          ? FetchResult::Found : FetchResult::NotFound;
+    } else {
+      if (!iter) {
+        // It can be the case like when there is a tablet split that we still want
+        // to continue seeking through all the given batch arguments even though one
+        // of them wasn't found. If it wasn't found, table_iter_ becomes invalid
+        // and we have to make a new iterator.
+        // TODO (dmitry): In case of iterator recreation info from RestartReadHt field will be
+        //                lost. The #17159 issue is created for this problem.
+        iter.emplace(&table_iter_);
+        RETURN_NOT_OK(iter->InitForYbctid(
+            ql_storage, request_, projection, doc_read_context, txn_op_context_,
+            read_operation_data, min_arg->ybctid().value(), max_arg->ybctid().value(),
+            pending_op, statistics, SkipSeek::kTrue));
+      }
+      fetch_result = VERIFY_RESULT(iter->FetchTuple(ybctid, &row));
     }
 
     // If changing this code, see also PgsqlReadOperation::ExecuteScalar.
-    switch (VERIFY_RESULT(
-        iter->FetchTuple(batch_argument.ybctid().value().binary_value(), &row))) {
+    switch (fetch_result) {
       case FetchResult::NotFound:
         // rebuild iterator on next iteration
         iter = std::nullopt;
@@ -1887,8 +2340,7 @@ Result<size_t> PgsqlReadOperation::ExecuteBatchYbctid(
 
   // Output aggregate values accumulated while looping over rows
   if (request_.is_aggregate() && row_count > 0) {
-    RETURN_NOT_OK(PopulateAggregate(result_buffer));
-    ++fetched_rows;
+    fetched_rows += VERIFY_RESULT(PopulateAggregate(result_buffer));
   }
 
   // Set status for this batch.
@@ -2007,6 +2459,16 @@ Status PgsqlReadOperation::PopulateResultSet(const dockv::PgTableRow& table_row,
   return Status::OK();
 }
 
+Status PgsqlReadOperation::AddTopNCandidate(const dockv::PgTableRow& table_row) {
+  if (!VERIFY_RESULT(top_n_heap_->Accepts(table_row))) {
+    return Status::OK();
+  }
+  WriteBuffer row_buffer(0x100);
+  RETURN_NOT_OK(PopulateResultSet(table_row, &row_buffer));
+  top_n_heap_->Add(row_buffer.ToBuffer());
+  return Status::OK();
+}
+
 Status PgsqlReadOperation::GetSpecialColumn(ColumnIdRep column_id, QLValuePB* result) {
   // Get row key and save to QLValue.
   // TODO(neil) Check if we need to append a table_id and other info to TupleID. For example, we
@@ -2022,6 +2484,12 @@ Status PgsqlReadOperation::GetSpecialColumn(ColumnIdRep column_id, QLValuePB* re
 }
 
 Status PgsqlReadOperation::EvalAggregate(const dockv::PgTableRow& table_row) {
+  if (request_.num_group_by_targets()) {
+    if (!grouped_aggregator_) {
+      grouped_aggregator_ = std::make_unique<DocPgGroupedAggregator>(request_, this);
+    }
+    return grouped_aggregator_->Consume(table_row);
+  }
   if (aggr_result_.empty()) {
     int column_count = request_.targets().size();
     aggr_result_.resize(column_count);
@@ -2034,12 +2502,20 @@ Status PgsqlReadOperation::EvalAggregate(const dockv::PgTableRow& table_row) {
   return Status::OK();
 }
 
-Status PgsqlReadOperation::PopulateAggregate(WriteBuffer *result_buffer) {
+Result<size_t> PgsqlReadOperation::PopulateAggregate(WriteBuffer *result_buffer) {
+  if (grouped_aggregator_) {
+    RETURN_NOT_OK(grouped_aggregator_->Finish(result_buffer));
+    return grouped_aggregator_->num_groups();
+  }
   int column_count = request_.targets().size();
   for (int rscol_index = 0; rscol_index < column_count; rscol_index++) {
     RETURN_NOT_OK(pggate::WriteColumn(aggr_result_[rscol_index].Value(), result_buffer));
   }
-  return Status::OK();
+  return 1;
+}
+
+bool PgsqlReadOperation::IsGroupedAggregateFull() const {
+  return grouped_aggregator_ && grouped_aggregator_->IsFull();
 }
 
 Status PgsqlReadOperation::GetIntents(
@@ -15,6 +15,7 @@
 
 #include <functional>
 #include <utility>
+#include <vector>
 
 #include <boost/container/small_vector.hpp>
 
@@ -156,6 +157,8 @@ class PgsqlReadOperation : public DocExprExecutor {
       : request_(request), txn_op_context_(txn_op_context) {
   }
 
+  ~PgsqlReadOperation();
+
   const PgsqlReadRequestPB& request() const { return request_; }
   PgsqlResponsePB& response() { return response_; }
 
@@ -197,6 +200,21 @@ class PgsqlReadOperation : public DocExprExecutor {
                                bool* has_paging_state,
                                const DocDBStatistics* statistics);
 
+  // Evaluates batch aggregates over the specified key ranges of the tablet, scanning them in
+  // parallel.
+  Result<size_t> ExecuteParallelBatchAggregate(
+      const YQLStorageIf& ql_storage,
+      const ReadOperationData& read_operation_data,
+      bool is_explicit_request_read_time,
+      const DocReadContext& doc_read_context,
+      std::reference_wrapper<const ScopedRWOperation> pending_op,
+      const dockv::ReaderProjection& projection,
+      const DocPgBatchAggregator& aggregator,
+      std::vector<PgsqlReadRequestPB> range_requests,
+      WriteBuffer* result_buffer,
+      bool* has_paging_state,
+      const DocDBStatistics* statistics);
+
   // Execute a READ operator for a given batch of ybctids.
   Result<size_t> ExecuteBatchYbctid(const YQLStorageIf& ql_storage,
                                     const ReadOperationData& read_operation_data,
@@ -219,9 +237,16 @@ class PgsqlReadOperation : public DocExprExecutor {
   Status PopulateResultSet(const dockv::PgTableRow& table_row,
                            WriteBuffer *result_buffer);
 
+  // Passes the row to top_n_heap_, encoding it only when the heap keeps it.
+  Status AddTopNCandidate(const dockv::PgTableRow& table_row);
+
   Status EvalAggregate(const dockv::PgTableRow& table_row);
 
-  Status PopulateAggregate(WriteBuffer *result_buffer);
+  // Writes accumulated aggregate values, returns the number of written rows.
+  Result<size_t> PopulateAggregate(WriteBuffer *result_buffer);
+
+  // Whether the scan should stop to return partial results of grouped aggregates.
+  bool IsGroupedAggregateFull() const;
 
   // Checks whether we have processed enough rows for a page and sets the appropriate paging
   // state in the response object.
@@ -235,6 +260,14 @@ class PgsqlReadOperation : public DocExprExecutor {
   PgsqlResponsePB response_;
   YQLRowwiseIteratorIf::UniPtr table_iter_;
   YQLRowwiseIteratorIf::UniPtr index_iter_;
+  // Iterators of additional key ranges scanned in parallel, table_iter_ is used for the first one.
+  std::vector<YQLRowwiseIteratorIf::UniPtr> parallel_scan_iters_;
+  // Used instead of table_iter_ for ybctid batches that could be served by point lookups.
+  std::unique_ptr<PgPointReader> point_reader_;
+  // Used instead of aggr_result_ for aggregates with GROUP BY.
+  std::unique_ptr<DocPgGroupedAggregator> grouped_aggregator_;
+  // Collects rows of top N requests.
+  std::unique_ptr<DocPgTopNHeap> top_n_heap_;
 };
 
 }  // namespace yb::docdb
@@ -13,6 +13,8 @@
 
 #include "yb/docdb/ql_rocksdb_storage.h"
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 
 #include <boost/optional/optional.hpp>
@@ -21,6 +23,7 @@
 #include "yb/common/ql_protocol.pb.h"
 
 #include "yb/dockv/doc_key.h"
+#include "yb/docdb/doc_point_reader.h"
 #include "yb/docdb/doc_read_context.h"
 #include "yb/docdb/doc_rowwise_iterator.h"
 #include "yb/docdb/doc_ql_scanspec.h"
@@ -28,14 +31,17 @@
 
 #include "yb/qlexpr/ql_expr_util.h"
 
+#include "yb/rocksdb/db.h"
+#include "yb/rocksdb/metadata.h"
+
 #include "yb/util/result.h"
 
 namespace yb::docdb {
 
 using dockv::DocKey;
 
-QLRocksDBStorage::QLRocksDBStorage(const DocDB& doc_db)
-    : doc_db_(doc_db) {
+QLRocksDBStorage::QLRocksDBStorage(const DocDB& doc_db, ThreadPool* parallel_scan_pool)
+    : doc_db_(doc_db), parallel_scan_pool_(parallel_scan_pool) {
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -173,6 +179,24 @@ Status QLRocksDBStorage::GetIteratorForYbctid(
   return Status::OK();
 }
 
+Status QLRocksDBStorage::GetPointReaderForYbctid(
+    const dockv::ReaderProjection& projection,
+    std::reference_wrapper<const DocReadContext> doc_read_context,
+    const TransactionOperationContext& txn_op_context,
+    const ReadOperationData& read_operation_data,
+    Slice min_ybctid,
+    Slice max_ybctid,
+    std::reference_wrapper<const ScopedRWOperation> pending_op,
+    std::unique_ptr<PgPointReader>* reader,
+    const DocDBStatistics* statistics) const {
+  auto result = std::make_unique<PgPointReader>(
+      projection, doc_read_context, txn_op_context, doc_db_, read_operation_data, pending_op,
+      statistics);
+  RETURN_NOT_OK(result->Init(min_ybctid, max_ybctid));
+  *reader = std::move(result);
+  return Status::OK();
+}
+
 Status QLRocksDBStorage::GetIterator(
     const PgsqlReadRequestPB& request,
     const dockv::ReaderProjection& projection,
@@ -267,6 +291,102 @@ Status QLRocksDBStorage::GetIterator(
   return Status::OK();
 }
 
+ScanSplitPoints QLRocksDBStorage::GetScanSplitPoints(
+    const Schema& schema, size_t max_ranges, uint64_t min_range_size) const {
+  ScanSplitPoints result;
+  // Keys of colocated tables are interleaved with keys of other tables, so file boundaries don't
+  // describe distribution of the table rows.
+  if (!doc_db_.regular || schema.has_cotable_id() || schema.has_colocation_id()) {
+    return result;
+  }
+  auto files = doc_db_.regular->GetLiveFilesMetaData();
+  uint64_t total_size = 0;
+  for (const auto& file : files) {
+    total_size += file.total_size;
+  }
+  const auto num_ranges = std::min<uint64_t>(
+      max_ranges, total_size / std::max<uint64_t>(min_range_size, 1));
+  if (num_ranges < 2) {
+    return result;
+  }
+
+  const auto& key_bounds = doc_db_.key_bounds ? *doc_db_.key_bounds : KeyBounds::kNoBounds;
+  if (schema.num_hash_key_columns() > 0) {
+    // Rows are uniformly distributed over hash codes, so hash range of the data is split evenly.
+    uint32_t min_hash = std::numeric_limits<uint16_t>::max();
+    uint32_t max_hash = 0;
+    auto update_hash_range = [&min_hash, &max_hash](Slice key) {
+      auto hash = dockv::DecodeDocKeyHash(key);
+      if (hash.ok() && *hash) {
+        min_hash = std::min<uint32_t>(min_hash, **hash);
+        max_hash = std::max<uint32_t>(max_hash, **hash);
+      }
+    };
+    for (const auto& file : files) {
+      update_hash_range(file.smallest.key);
+      update_hash_range(file.largest.key);
+    }
+    // Files of split tablet could contain rows of the parent tablet.
+    if (!key_bounds.lower.empty()) {
+      auto hash = dockv::DecodeDocKeyHash(key_bounds.lower.AsSlice());
+      if (hash.ok() && *hash) {
+        min_hash = std::max<uint32_t>(min_hash, **hash);
+      }
+    }
+    if (!key_bounds.upper.empty()) {
+      auto hash = dockv::DecodeDocKeyHash(key_bounds.upper.AsSlice());
+      if (hash.ok() && *hash && **hash) {
+        max_hash = std::min<uint32_t>(max_hash, **hash - 1);
+      }
+    }
+    if (min_hash >= max_hash) {
+      return result;
+    }
+    const auto width = max_hash - min_hash + 1;
+    for (uint64_t i = 1; i != num_ranges; ++i) {
+      auto hash = static_cast<uint16_t>(min_hash + width * i / num_ranges);
+      if (hash > min_hash && (result.hash_codes.empty() || hash > result.hash_codes.back())) {
+        result.hash_codes.push_back(hash);
+      }
+    }
+    return result;
+  }
+
+  // Range partitioned rows are split using file boundaries and the middle key of the data.
+  std::vector<std::string> keys;
+  auto add_key = [&keys, &key_bounds](Slice key) {
+    auto size = DocKey::EncodedSize(key, dockv::DocKeyPart::kWholeDocKey);
+    if (!size.ok()) {
+      return;
+    }
+    key = key.Prefix(*size);
+    if (key_bounds.IsWithinBounds(key)) {
+      keys.push_back(key.ToBuffer());
+    }
+  };
+  for (const auto& file : files) {
+    add_key(file.smallest.key);
+    add_key(file.largest.key);
+  }
+  auto middle_key = doc_db_.regular->GetMiddleKey();
+  if (middle_key.ok()) {
+    add_key(*middle_key);
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  if (keys.size() < 2) {
+    return result;
+  }
+  // The first key is the start of the data, so it does not split anything.
+  for (uint64_t i = 1; i != num_ranges; ++i) {
+    const auto& key = keys[i * keys.size() / num_ranges];
+    if (key != keys.front() && (result.doc_keys.empty() || key > result.doc_keys.back())) {
+      result.doc_keys.push_back(key);
+    }
+  }
+  return result;
+}
+
 std::string QLRocksDBStorage::ToString() const {
   return doc_db_.regular->GetName();
 }
@@ -28,7 +28,7 @@ namespace docdb {
 // Implementation of YQLStorageIf with rocksdb as a backend. This is what all of our QL tables use.
 class QLRocksDBStorage : public YQLStorageIf {
  public:
-  explicit QLRocksDBStorage(const DocDB& doc_db);
+  explicit QLRocksDBStorage(const DocDB& doc_db, ThreadPool* parallel_scan_pool = nullptr);
 
   //------------------------------------------------------------------------------------------------
   // CQL Support.
@@ -90,10 +90,29 @@ class QLRocksDBStorage : public YQLStorageIf {
       const docdb::DocDBStatistics* statistics = nullptr,
       SkipSeek skip_seek = SkipSeek::kFalse) const override;
 
+  Status GetPointReaderForYbctid(
+      const dockv::ReaderProjection& projection,
+      std::reference_wrapper<const DocReadContext> doc_read_context,
+      const TransactionOperationContext& txn_op_context,
+      const ReadOperationData& read_operation_data,
+      Slice min_ybctid,
+      Slice max_ybctid,
+      std::reference_wrapper<const ScopedRWOperation> pending_op,
+      std::unique_ptr<PgPointReader>* reader,
+      const DocDBStatistics* statistics = nullptr) const override;
+
+  ThreadPool* ParallelScanPool() const override {
+    return parallel_scan_pool_;
+  }
+
+  ScanSplitPoints GetScanSplitPoints(
+      const Schema& schema, size_t max_ranges, uint64_t min_range_size) const override;
+
   std::string ToString() const override;
 
  private:
   const DocDB doc_db_;
+  ThreadPool* const parallel_scan_pool_;
 };
 
 }  // namespace docdb
@@ -15,6 +15,8 @@
 
 #include "yb/common/hybrid_time.h"
 
+#include "yb/dockv/pg_row.h"
+
 #include "yb/util/result.h"
 
 namespace yb {
@@ -33,6 +35,25 @@ void YQLRowwiseIteratorIf::SeekTuple(Slice tuple_id) {
   LOG(DFATAL) << "This iterator cannot seek by tuple id";
 }
 
+Result<size_t> YQLRowwiseIteratorIf::PgFetchNextBatch(
+    size_t max_rows, dockv::PgTableRowBatch* batch) {
+  dockv::PgTableRow row(batch->projection());
+  size_t result = 0;
+  while (result < max_rows && VERIFY_RESULT(PgFetchNext(&row))) {
+    batch->Append(row);
+    ++result;
+  }
+  return result;
+}
+
+Result<bool> YQLRowwiseIteratorIf::PgFetchNextPartial(dockv::PgTableRow* partial_row) {
+  return STATUS(NotSupported, "This iterator does not support late materialization");
+}
+
+Status YQLRowwiseIteratorIf::PgMaterializeRow(dockv::PgTableRow* table_row) {
+  return STATUS(NotSupported, "This iterator does not support late materialization");
+}
+
 HybridTime YQLRowwiseIteratorIf::TEST_MaxSeenHt() {
   return HybridTime::kInvalid;
 }
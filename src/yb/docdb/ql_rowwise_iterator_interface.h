@@ -48,6 +48,25 @@ class YQLRowwiseIteratorIf {
 
   virtual Result<bool> PgFetchNext(dockv::PgTableRow* table_row) = 0;
 
+  // Fetches up to max_rows next rows and appends them to the batch in column-major form.
+  // Returns number of appended rows, 0 means that there are no more rows.
+  // The iterator is positioned after the last appended row, so paging state and restart read time
+  // are the same as after the same number of PgFetchNext calls.
+  virtual Result<size_t> PgFetchNextBatch(size_t max_rows, dockv::PgTableRowBatch* batch);
+
+  // Late materialization support, i.e. decoding only columns required to filter the row first, and
+  // the rest of the projection only for rows accepted by the filter.
+  virtual bool SupportsLateMaterialization() const {
+    return false;
+  }
+
+  // Fetches the next row decoding only columns of partial_row projection, that should be a subset
+  // of the iterator projection. Iterates the same rows as PgFetchNext.
+  virtual Result<bool> PgFetchNextPartial(dockv::PgTableRow* partial_row);
+
+  // Decodes the row fetched by the last PgFetchNextPartial call using the iterator projection.
+  virtual Status PgMaterializeRow(dockv::PgTableRow* table_row);
+
   // If restart is required returns restart hybrid time, based on iterated records.
   // Otherwise returns invalid hybrid time.
   virtual Result<HybridTime> RestartReadHt() = 0;
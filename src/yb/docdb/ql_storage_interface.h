@@ -16,6 +16,7 @@
 #include <limits>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "yb/common/common_fwd.h"
 #include "yb/common/read_hybrid_time.h"
@@ -26,8 +27,27 @@
 
 #include "yb/util/monotime.h"
 #include "yb/util/operation_counter.h"
+#include "yb/util/slice.h"
 
-namespace yb::docdb {
+namespace yb {
+
+class ThreadPool;
+
+namespace docdb {
+
+// Points that split rows of a tablet into ranges of approximately equal size, used to scan a single
+// tablet in parallel. Every point is the start of a range, the first range starts at the beginning
+// of the tablet.
+struct ScanSplitPoints {
+  // Ascending hash codes, used for hash partitioned tables.
+  std::vector<uint16_t> hash_codes;
+  // Ascending encoded doc keys, used for range partitioned tables.
+  std::vector<std::string> doc_keys;
+
+  bool empty() const {
+    return hash_codes.empty() && doc_keys.empty();
+  }
+};
 
 // An interface to support various different storage backends for a QL table.
 class YQLStorageIf {
@@ -110,7 +130,36 @@ class YQLStorageIf {
       const DocDBStatistics* statistics = nullptr,
       SkipSeek skip_seek = SkipSeek::kFalse) const = 0;
 
+  // Create reader for point lookups of rows with ybctid in [min_ybctid, max_ybctid].
+  // Leaves reader empty when storage does not support point reads.
+  virtual Status GetPointReaderForYbctid(
+      const dockv::ReaderProjection& projection,
+      std::reference_wrapper<const DocReadContext> doc_read_context,
+      const TransactionOperationContext& txn_op_context,
+      const ReadOperationData& read_operation_data,
+      Slice min_ybctid,
+      Slice max_ybctid,
+      std::reference_wrapper<const ScopedRWOperation> pending_op,
+      std::unique_ptr<PgPointReader>* reader,
+      const DocDBStatistics* statistics = nullptr) const {
+    return Status::OK();
+  }
+
+  // Returns thread pool that could be used to scan ranges of a single tablet in parallel, or
+  // nullptr if parallel scan is not supported.
+  virtual ThreadPool* ParallelScanPool() const {
+    return nullptr;
+  }
+
+  // Returns points that split rows of the table into at most max_ranges ranges, each containing
+  // at least min_range_size bytes of data. Returns empty result when data could not be split.
+  virtual ScanSplitPoints GetScanSplitPoints(
+      const Schema& schema, size_t max_ranges, uint64_t min_range_size) const {
+    return ScanSplitPoints();
+  }
+
   virtual std::string ToString() const = 0;
 };
 
-}  // namespace yb::docdb
+}  // namespace docdb
+}  // namespace yb
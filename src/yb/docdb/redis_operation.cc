@@ -23,6 +23,7 @@
 #include "yb/docdb/doc_write_batch.h"
 #include "yb/docdb/doc_write_batch_cache.h"
 #include "yb/docdb/docdb_rocksdb_util.h"
+#include "yb/docdb/row_cache.h"
 #include "yb/dockv/subdocument.h"
 
 #include "yb/server/hybrid_clock.h"
@@ -539,6 +540,51 @@ void GetNormalizedBounds(int64 low_idx, int64 high_idx, int64 card, bool reverse
   }
 }
 
+// Fills result with the sorted set entries whose ranks counted from the highest score are in
+// [low_rank, high_rank]. The score to member mapping of the sorted set is walked backwards, and
+// every entry found is read with its ancestors, to skip entries deleted or overwritten by a later
+// write of the whole set. So the cost depends on high_rank instead of the cardinality of the set.
+Status GetSortedSetReverseRange(
+    IntentAwareIterator* iterator, const KeyBytes& encoded_forward_key, int64_t low_rank,
+    int64_t high_rank, DeadlineInfo* deadline_info, SubDocument* result, bool* doc_found) {
+  *result = SubDocument();
+  *doc_found = false;
+
+  KeyBytes seek_key(encoded_forward_key);
+  seek_key.AppendKeyEntryType(KeyEntryType::kMaxByte);
+  iterator->PrevSubDocKey(seek_key);
+
+  for (int64_t rank = 0; rank <= high_rank;) {
+    if (deadline_info) {
+      RETURN_NOT_OK(deadline_info->CheckDeadlinePassed());
+    }
+    auto key_data = VERIFY_RESULT_REF(iterator->Fetch());
+    if (!key_data || key_data.key.size() <= encoded_forward_key.size() ||
+        !key_data.key.starts_with(encoded_forward_key)) {
+      break;
+    }
+    KeyBytes entry_key(key_data.key);
+    SubDocument entry;
+    bool entry_found = false;
+    GetRedisSubDocumentData data = { entry_key.AsSlice(), &entry, &entry_found };
+    RETURN_NOT_OK(GetRedisSubDocument(
+        iterator, data, /* projection */ nullptr, SeekFwdSuffices::kFalse));
+    if (entry_found && entry.IsPrimitive()) {
+      if (rank >= low_rank) {
+        Slice subkeys = entry_key.AsSlice().WithoutPrefix(encoded_forward_key.size());
+        KeyEntryValue score, member;
+        RETURN_NOT_OK(score.DecodeFromKey(&subkeys));
+        RETURN_NOT_OK(member.DecodeFromKey(&subkeys));
+        result->GetOrAddChild(score).first->SetChild(member, std::move(entry));
+      }
+      *doc_found = true;
+      ++rank;
+    }
+    iterator->PrevSubDocKey(entry_key);
+  }
+  return Status::OK();
+}
+
 } // anonymous namespace
 
 void RedisWriteOperation::InitializeIterator(const DocOperationApplyData& data) {
@@ -1369,8 +1415,7 @@ Status RedisWriteOperation::ApplyRemove(const DocOperationApplyData& data) {
   return STATUS(NotSupported, "Redis operation has not been implemented");
 }
 
-Status RedisReadOperation::Execute() {
-  SimulateTimeoutIfTesting(const_cast<CoarseTimePoint*>(&read_operation_data_.deadline));
+void RedisReadOperation::CreateIterator() {
   // If we have a KEYS command, we don't specify any key for the iterator. Therefore, don't use
   // bloom filters for this command.
   SubDocKey doc_key(
@@ -1383,6 +1428,17 @@ Status RedisReadOperation::Execute() {
       redis_query_id(), TransactionOperationContext(), read_operation_data_);
   iterator_ = std::move(iter);
   deadline_info_.emplace(read_operation_data_.deadline);
+}
+
+Status RedisReadOperation::Execute() {
+  SimulateTimeoutIfTesting(const_cast<CoarseTimePoint*>(&read_operation_data_.deadline));
+  if (row_cache_ && request_.has_get_request() &&
+      request_.get_request().request_type() == RedisGetRequestPB::GET &&
+      request_.key_value().subkey().empty()) {
+    return ExecuteCachedGet();
+  }
+
+  CreateIterator();
 
   switch (request_.request_case()) {
     case RedisReadRequestPB::kGetForRenameRequest:
@@ -1666,6 +1722,28 @@ Status RedisReadOperation::ExecuteCollectionGetRange() {
 
       bool add_keys = request_.get_collection_range_request().with_scores();
 
+      // Ranks counted from the highest score, walking backwards skips fewer entries for the top
+      // of the set.
+      const int64 low_rank = card - 1 - high_idx_normalized;
+      const int64 high_rank = card - 1 - low_idx_normalized;
+      if (reverse && low_rank < low_idx_normalized) {
+        SubDocument doc;
+        bool doc_found = false;
+        RETURN_NOT_OK(GetSortedSetReverseRange(
+            iterator_.get(), encoded_doc_key, low_rank, high_rank, deadline_info_.get_ptr(), &doc,
+            &doc_found));
+        response_.set_allocated_array_response(new RedisArrayPB());
+        if (!doc_found) {
+          response_.set_code(RedisResponsePB::NIL);
+          return Status::OK();
+        }
+        response_.set_code(RedisResponsePB::OK);
+        RETURN_NOT_OK(PopulateResponseFrom(
+            doc.object_container(), AddResponseValuesSortedSets, &response_, add_keys,
+            /* add_values */ true, reverse));
+        break;
+      }
+
       IndexBound low_bound = IndexBound(low_idx_normalized, true /* is_lower */);
       IndexBound high_bound = IndexBound(high_idx_normalized, false /* is_lower */);
 
@@ -1813,6 +1891,32 @@ Status RedisReadOperation::ExecuteGet(RedisGetRequestPB::GetRequestType type) {
   return ExecuteGet(request);
 }
 
+Status RedisReadOperation::ExecuteCachedGet() {
+  const auto& key_value = request_.key_value();
+  if (!key_value.has_key()) {
+    return STATUS(Corruption, "Expected KeyValuePB");
+  }
+  const auto encoded_doc_key = DocKey::EncodedFromRedisKey(key_value.hash_code(), key_value.key());
+  const auto read_time = read_operation_data_.read_time.read;
+  auto cached_value = row_cache_->Get(encoded_doc_key.AsSlice(), read_time);
+  if (cached_value) {
+    response_.set_code(RedisResponsePB::OK);
+    response_.set_string_response(std::move(*cached_value));
+    return Status::OK();
+  }
+
+  // Snapshot is taken before reading, so writes applied during the read prevent caching of the
+  // value.
+  const auto snapshot = row_cache_->TakeSnapshot();
+  CreateIterator();
+  RETURN_NOT_OK(ExecuteGet());
+  if (cacheable_response_) {
+    row_cache_->Insert(
+        snapshot, encoded_doc_key.AsSlice(), response_.string_response(), read_time);
+  }
+  return Status::OK();
+}
+
 Status RedisReadOperation::ExecuteGet() { return ExecuteGet(request_.get_request()); }
 
 Status RedisReadOperation::ExecuteGet(const RedisGetRequestPB& get_request) {
@@ -1854,6 +1958,8 @@ Status RedisReadOperation::ExecuteGet(const RedisGetRequestPB& get_request) {
         if (VerifyTypeAndSetCode(RedisDataType::REDIS_TYPE_STRING, value->type, &response_,
             VerifySuccessIfMissing::kTrue)) {
           response_.set_string_response(value->value);
+          cacheable_response_ = request_type == RedisGetRequestPB::GET &&
+                                value->type == REDIS_TYPE_STRING && !value->exp;
         }
       }
       return Status::OK();
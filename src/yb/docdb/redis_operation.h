@@ -81,16 +81,22 @@ class RedisWriteOperation :
   // TODO: Currently we have a separate iterator per operation, but in future, we leave the option
   // open for operations to share iterators.
   std::unique_ptr<IntentAwareIterator> iterator_;
+  RowCache* const row_cache_;
+  // Set when response contains string value without TTL, that could be cached.
+  bool cacheable_response_ = false;
 
   rocksdb::QueryId redis_query_id() { return reinterpret_cast<rocksdb::QueryId > (&request_); }
 };
 
 class RedisReadOperation {
  public:
+  // When row_cache is specified, it is used to serve GETs of string values.
   explicit RedisReadOperation(const yb::RedisReadRequestPB& request,
                               const DocDB& doc_db,
-                              const ReadOperationData& read_operation_data)
-      : request_(request), doc_db_(doc_db), read_operation_data_(read_operation_data) {}
+                              const ReadOperationData& read_operation_data,
+                              RowCache* row_cache = nullptr)
+      : request_(request), doc_db_(doc_db), read_operation_data_(read_operation_data),
+        row_cache_(row_cache) {}
 
   Status Execute();
 
@@ -108,6 +114,8 @@ class RedisReadOperation {
 
   Result<RedisValue> GetValue(int subkey_index = kNilSubkeyIndex);
 
+  void CreateIterator();
+  Status ExecuteCachedGet();
   Status ExecuteGet();
   Status ExecuteGet(const RedisGetRequestPB& get_request);
   Status ExecuteGet(RedisGetRequestPB::GetRequestType type);
@@ -0,0 +1,95 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/common/ql_value.h"
+
+#include "yb/docdb/docdb_test_base.h"
+#include "yb/docdb/rocksdb_iterator_pool.h"
+
+#include "yb/dockv/doc_key.h"
+#include "yb/dockv/doc_path.h"
+
+#include "yb/rocksdb/statistics.h"
+
+#include "yb/util/test_macros.h"
+
+namespace yb::docdb {
+
+class RocksDBIteratorPoolTest : public DocDBTestBase {
+ protected:
+  Schema CreateSchema() override {
+    return Schema();
+  }
+
+  Status Write(const std::string& key, HybridTime ht) {
+    return SetPrimitive(
+        dockv::DocPath(dockv::MakeDocKey(key).Encode()), QLValue::Primitive("value"), ht);
+  }
+};
+
+TEST_F(RocksDBIteratorPoolTest, Reuse) {
+  ASSERT_OK(Write("a", 1000_usec_ht));
+  RocksDBIteratorPool pool(rocksdb());
+  rocksdb::ReadOptions read_opts;
+  ASSERT_TRUE(RocksDBIteratorPool::IsPoolable(read_opts));
+
+  RocksDBIteratorPool::Tag tag;
+  auto iter = pool.Take(read_opts, &tag);
+  auto* iter_ptr = iter.get();
+  pool.Return(tag, std::move(iter));
+  ASSERT_EQ(pool.TEST_size(), 1U);
+
+  // There were no changes, so the same iterator is reused.
+  iter = pool.Take(read_opts, &tag);
+  ASSERT_EQ(iter.get(), iter_ptr);
+  ASSERT_EQ(pool.TEST_size(), 0U);
+
+  // Iterator with different statistics is not reused.
+  auto statistics = rocksdb::CreateDBStatisticsForTests();
+  rocksdb::ReadOptions other_read_opts;
+  other_read_opts.statistics = statistics.get();
+  RocksDBIteratorPool::Tag other_tag;
+  pool.Return(tag, std::move(iter));
+  iter = pool.Take(other_read_opts, &other_tag);
+  ASSERT_NE(iter.get(), iter_ptr);
+  ASSERT_EQ(pool.TEST_size(), 1U);
+
+  // Write makes pooled iterators outdated.
+  ASSERT_OK(Write("b", 2000_usec_ht));
+  pool.Return(other_tag, std::move(iter));
+  ASSERT_EQ(pool.TEST_size(), 1U);
+  iter = pool.Take(read_opts, &tag);
+  ASSERT_EQ(pool.TEST_size(), 0U);
+  size_t num_keys = 0;
+  for (const auto* entry = &iter->SeekToFirst(); *entry; entry = &iter->Next()) {
+    ++num_keys;
+  }
+  ASSERT_OK(iter->status());
+  ASSERT_EQ(num_keys, 2U);
+
+  pool.Return(tag, std::move(iter));
+  ASSERT_EQ(pool.TEST_size(), 1U);
+  pool.Invalidate();
+  ASSERT_EQ(pool.TEST_size(), 0U);
+
+  // Iterator taken before invalidation is not returned to the pool.
+  iter = pool.Take(read_opts, &tag);
+  pool.Invalidate();
+  pool.Return(tag, std::move(iter));
+  ASSERT_EQ(pool.TEST_size(), 0U);
+
+  read_opts.readahead_size = 4096;
+  ASSERT_FALSE(RocksDBIteratorPool::IsPoolable(read_opts));
+}
+
+}  // namespace yb::docdb
@@ -0,0 +1,109 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/rocksdb_iterator_pool.h"
+
+#include "yb/rocksdb/db.h"
+
+#include "yb/util/flags.h"
+#include "yb/util/logging.h"
+
+DEFINE_RUNTIME_uint32(regular_db_iterator_pool_size, 8,
+                      "Max number of regular DB iterators kept per tablet for reuse by subsequent "
+                      "reads. 0 disables pooling.");
+
+namespace yb::docdb {
+
+RocksDBIteratorPool::RocksDBIteratorPool(rocksdb::DB* db) : db_(db) {
+}
+
+RocksDBIteratorPool::~RocksDBIteratorPool() = default;
+
+bool RocksDBIteratorPool::IsPoolable(const rocksdb::ReadOptions& read_opts) {
+  return read_opts.snapshot == nullptr && read_opts.iterate_upper_bound == nullptr &&
+         !read_opts.tailing && !read_opts.managed && !read_opts.pin_data &&
+         !read_opts.prefix_same_as_start && !read_opts.table_aware_file_filter &&
+         !read_opts.file_filter && read_opts.readahead_size == 0;
+}
+
+std::unique_ptr<rocksdb::Iterator> RocksDBIteratorPool::Take(
+    const rocksdb::ReadOptions& read_opts, Tag* tag) {
+  DCHECK(IsPoolable(read_opts));
+  // Generation and sequence are obtained before the iterator is created, so the iterator could be
+  // newer than its tag, but not older.
+  *tag = Tag {
+    .statistics = read_opts.statistics,
+    .query_id = read_opts.query_id,
+    .sequence = db_->GetLatestSequenceNumber(),
+    .generation = generation_.load(std::memory_order_acquire),
+  };
+
+  std::unique_ptr<rocksdb::Iterator> result;
+  std::vector<Entry> outdated;
+  {
+    std::lock_guard lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (it->tag.sequence != tag->sequence || it->tag.generation != tag->generation) {
+        outdated.push_back(std::move(*it));
+        it = entries_.erase(it);
+      } else if (!result && it->tag.IsSameKind(*tag)) {
+        result = std::move(it->iterator);
+        it = entries_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  if (!result) {
+    result.reset(db_->NewIterator(read_opts));
+  }
+  return result;
+}
+
+void RocksDBIteratorPool::Return(const Tag& tag, std::unique_ptr<rocksdb::Iterator> iterator) {
+  if (!iterator->status().ok()) {
+    return;
+  }
+  std::lock_guard lock(mutex_);
+  // Generation is checked under the lock, so iterator could not be added after Invalidate.
+  if (entries_.size() < FLAGS_regular_db_iterator_pool_size && IsActual(tag)) {
+    entries_.push_back(Entry {
+      .tag = tag,
+      .iterator = std::move(iterator),
+    });
+  }
+}
+
+void RocksDBIteratorPool::Invalidate() {
+  generation_.fetch_add(1, std::memory_order_acq_rel);
+  std::vector<Entry> entries;
+  {
+    std::lock_guard lock(mutex_);
+    entries.swap(entries_);
+  }
+}
+
+size_t RocksDBIteratorPool::TEST_size() const {
+  std::lock_guard lock(mutex_);
+  return entries_.size();
+}
+
+bool RocksDBIteratorPool::IsActual(const Tag& tag) const {
+  // Writes advance the latest sequence number, so iterator with the actual sequence would see
+  // the same data as a newly created one.
+  return tag.generation == generation_.load(std::memory_order_acquire) &&
+         tag.sequence == db_->GetLatestSequenceNumber();
+}
+
+}  // namespace yb::docdb
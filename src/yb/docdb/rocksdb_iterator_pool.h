@@ -0,0 +1,86 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "yb/gutil/thread_annotations.h"
+
+#include "yb/rocksdb/iterator.h"
+#include "yb/rocksdb/options.h"
+#include "yb/rocksdb/types.h"
+
+namespace yb::docdb {
+
+// Pool of RocksDB iterators that could be reused by subsequent reads of the same DB, to avoid
+// allocation of the iterator tree and referencing of the super version for every read.
+//
+// Iterator is taken from the pool only when it is equivalent to a newly created one, i.e. there
+// were no writes to the DB and no changes of DB files since it was created.
+// Invalidate should be called when DB files are changed, so pooled iterators release files and
+// memtables that are not part of the current DB version anymore.
+class RocksDBIteratorPool {
+ public:
+  // Identifies kind of the iterator and the DB state it was created for.
+  struct Tag {
+    rocksdb::Statistics* statistics = nullptr;
+    rocksdb::QueryId query_id = rocksdb::kDefaultQueryId;
+    rocksdb::SequenceNumber sequence = 0;
+    uint64_t generation = 0;
+
+    bool IsSameKind(const Tag& rhs) const {
+      return statistics == rhs.statistics && query_id == rhs.query_id;
+    }
+  };
+
+  explicit RocksDBIteratorPool(rocksdb::DB* db);
+  ~RocksDBIteratorPool();
+
+  // Whether iterator with specified read options could be reused. Options that refer to per read
+  // state, like file filters or iterate upper bound, prevent pooling.
+  static bool IsPoolable(const rocksdb::ReadOptions& read_opts);
+
+  // Returns pooled iterator for specified read options or creates a new one.
+  // Read options should be poolable. Tag should be passed to Return with the iterator.
+  std::unique_ptr<rocksdb::Iterator> Take(const rocksdb::ReadOptions& read_opts, Tag* tag)
+      EXCLUDES(mutex_);
+
+  // Returns iterator to the pool. Iterator is destroyed if it could not be reused.
+  void Return(const Tag& tag, std::unique_ptr<rocksdb::Iterator> iterator) EXCLUDES(mutex_);
+
+  // Destroys pooled iterators and prevents iterators that are currently in use from being
+  // returned to the pool.
+  void Invalidate() EXCLUDES(mutex_);
+
+  size_t TEST_size() const EXCLUDES(mutex_);
+
+ private:
+  struct Entry {
+    Tag tag;
+    std::unique_ptr<rocksdb::Iterator> iterator;
+  };
+
+  bool IsActual(const Tag& tag) const REQUIRES(mutex_);
+
+  rocksdb::DB* const db_;
+  std::atomic<uint64_t> generation_{0};
+
+  mutable std::mutex mutex_;
+  std::vector<Entry> entries_ GUARDED_BY(mutex_);
+};
+
+}  // namespace yb::docdb
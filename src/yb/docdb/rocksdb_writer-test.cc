@@ -0,0 +1,106 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/docdb_test_base.h"
+#include "yb/docdb/rocksdb_writer.h"
+
+#include "yb/dockv/doc_key.h"
+#include "yb/dockv/value_type.h"
+
+#include "yb/rocksdb/db.h"
+
+#include "yb/util/test_macros.h"
+
+namespace yb::docdb {
+
+class BufferedWriteHandlerTest : public DocDBTestBase {
+ protected:
+  Schema CreateSchema() override {
+    return Schema();
+  }
+
+  static std::string MakeKey(const std::string& key, HybridTime ht) {
+    return dockv::SubDocKey(dockv::MakeDocKey(key), ht).Encode().ToStringBuffer();
+  }
+
+  static void Put(const std::string& key, BufferedWriteHandler* handler) {
+    auto encoded_key = MakeKey(key, 1000_usec_ht);
+    char value_type = dockv::ValueEntryTypeAsChar::kNullLow;
+    Slice key_slice(encoded_key);
+    Slice value_slice(&value_type, 1);
+    handler->Put(SliceParts(&key_slice, 1), SliceParts(&value_slice, 1));
+  }
+
+  size_t CountRecords() {
+    std::unique_ptr<rocksdb::Iterator> iter(rocksdb()->NewIterator(rocksdb::ReadOptions()));
+    size_t result = 0;
+    for (const auto* entry = &iter->SeekToFirst(); *entry; entry = &iter->Next()) {
+      ++result;
+    }
+    EXPECT_OK(iter->status());
+    return result;
+  }
+
+  size_t NumSstFiles() {
+    std::vector<rocksdb::LiveFileMetaData> files;
+    rocksdb()->GetLiveFilesMetaData(&files);
+    return files.size();
+  }
+};
+
+TEST_F(BufferedWriteHandlerTest, Flush) {
+  const auto file_path = GetTestPath("apply.sst.tmp");
+  {
+    BufferedWriteHandler handler;
+    for (const auto* key : {"d", "b", "c", "a"}) {
+      Put(key, &handler);
+    }
+    ASSERT_EQ(handler.num_records(), 4U);
+
+    // Not enough records for ingestion.
+    rocksdb::WriteBatch write_batch;
+    ASSERT_EQ(handler.Flush(rocksdb(), file_path, 5, &write_batch), 0U);
+    ASSERT_EQ(write_batch.Count(), 4U);
+  }
+
+  {
+    BufferedWriteHandler handler;
+    for (const auto* key : {"d", "b", "c", "a"}) {
+      Put(key, &handler);
+    }
+    rocksdb::WriteBatch write_batch;
+    ASSERT_EQ(handler.Flush(rocksdb(), file_path, 4, &write_batch), 3U);
+    // The last record in key order is written through the write batch.
+    ASSERT_EQ(write_batch.Count(), 1U);
+    ASSERT_EQ(NumSstFiles(), 1U);
+    ASSERT_EQ(CountRecords(), 3U);
+    ASSERT_OK(rocksdb()->Write(write_options(), &write_batch));
+    ASSERT_EQ(CountRecords(), 4U);
+  }
+
+  {
+    // Records overlap the range of existing records, so all of them are written through the
+    // write batch.
+    BufferedWriteHandler handler;
+    for (const auto* key : {"a1", "b1", "c1"}) {
+      Put(key, &handler);
+    }
+    rocksdb::WriteBatch write_batch;
+    ASSERT_EQ(handler.Flush(rocksdb(), file_path, 2, &write_batch), 0U);
+    ASSERT_EQ(write_batch.Count(), 3U);
+    ASSERT_EQ(NumSstFiles(), 1U);
+    ASSERT_FALSE(env_->FileExists(file_path));
+  }
+}
+
+}  // namespace yb::docdb
@@ -13,6 +13,8 @@
 
 #include "yb/docdb/rocksdb_writer.h"
 
+#include <algorithm>
+
 #include "yb/common/row_mark.h"
 
 #include "yb/docdb/conflict_resolution.h"
@@ -29,11 +31,17 @@
 
 #include "yb/gutil/walltime.h"
 
+#include "yb/rocksdb/db.h"
+#include "yb/rocksdb/db/filename.h"
+#include "yb/rocksdb/sst_file_writer.h"
+
 #include "yb/util/bitmap.h"
 #include "yb/util/debug-util.h"
 #include "yb/util/fast_varint.h"
 #include "yb/util/flags.h"
 #include "yb/util/pb_util.h"
+#include "yb/util/size_literals.h"
+#include "yb/util/status_log.h"
 
 DEFINE_UNKNOWN_bool(enable_transaction_sealing, false,
             "Whether transaction sealing is enabled.");
@@ -322,6 +330,9 @@ Status TransactionalWriter::operator()(
     reverse_value_prefix = replicated_batches_state_;
   }
   AddIntent<kNumKeyParts>(transaction_id_, key_parts, value, handler_, reverse_value_prefix);
+  if (intent_key_callback_) {
+    intent_key_callback_(key->AsSlice(), dockv::HasStrong(intent_types));
+  }
 
   return Status::OK();
 }
@@ -382,6 +393,9 @@ Status TransactionalWriter::AddWeakIntent(
   }};
 
   AddIntent<kNumKeyParts>(transaction_id_, key, value, handler_);
+  if (intent_key_callback_) {
+    intent_key_callback_(intent_and_types.first.AsSlice(), /* strong= */ false);
+  }
 
   return Status::OK();
 }
@@ -391,8 +405,13 @@ DocHybridTimeBuffer::DocHybridTimeBuffer() {
 }
 
 IntentsWriterContext::IntentsWriterContext(const TransactionId& transaction_id)
+    : IntentsWriterContext(transaction_id, FLAGS_txn_max_apply_batch_records) {
+}
+
+IntentsWriterContext::IntentsWriterContext(
+    const TransactionId& transaction_id, int64_t max_records)
     : transaction_id_(transaction_id),
-      left_records_(FLAGS_txn_max_apply_batch_records) {
+      left_records_(max_records) {
 }
 
 IntentsWriter::IntentsWriter(const Slice& start_key,
@@ -660,6 +679,11 @@ RemoveIntentsContext::RemoveIntentsContext(const TransactionId& transaction_id,
     : IntentsWriterContext(transaction_id), reason_(reason) {
 }
 
+RemoveIntentsContext::RemoveIntentsContext(
+    const TransactionId& transaction_id, uint8_t reason, int64_t max_records)
+    : IntentsWriterContext(transaction_id, max_records), reason_(reason) {
+}
+
 Result<bool> RemoveIntentsContext::Entry(
     const Slice& key, const Slice& value, bool metadata, rocksdb::DirectWriteHandler* handler) {
   if (reached_records_limit()) {
@@ -670,11 +694,13 @@ Result<bool> RemoveIntentsContext::Entry(
   handler->SingleDelete(key);
   YB_TRANSACTION_DUMP(RemoveIntent, transaction_id(), reason_, key);
   RegisterRecord();
+  removed_bytes_ += key.size();
 
   if (!metadata) {
     handler->SingleDelete(value);
     YB_TRANSACTION_DUMP(RemoveIntent, transaction_id(), reason_, value);
     RegisterRecord();
+    removed_bytes_ += value.size();
   }
   return false;
 }
@@ -682,6 +708,30 @@ Result<bool> RemoveIntentsContext::Entry(
 void RemoveIntentsContext::Complete(rocksdb::DirectWriteHandler* handler) {
 }
 
+RemoveIntentsBatchWriter::RemoveIntentsBatchWriter(
+    std::vector<TransactionId> transaction_ids, uint8_t reason, rocksdb::DB* intents_db)
+    : transaction_ids_(std::move(transaction_ids)), reason_(reason), intents_db_(intents_db) {
+}
+
+Status RemoveIntentsBatchWriter::Apply(rocksdb::DirectWriteHandler* handler) {
+  last_batch_bytes_ = 0;
+  int64_t left_records = FLAGS_txn_max_apply_batch_records;
+  while (!Done() && left_records > 0) {
+    RemoveIntentsContext context(transaction_ids_[next_], reason_, left_records);
+    IntentsWriter writer(resume_key_, intents_db_, &context);
+    RETURN_NOT_OK(writer.Apply(handler));
+    last_batch_bytes_ += context.removed_bytes();
+    if (context.apply_state().active()) {
+      resume_key_ = std::move(context.apply_state().key);
+      return Status::OK();
+    }
+    resume_key_.clear();
+    left_records = context.left_records();
+    ++next_;
+  }
+  return Status::OK();
+}
+
 ExternalIntentsBatchWriter::ExternalIntentsBatchWriter(
     std::reference_wrapper<const LWKeyValueWriteBatchPB> put_batch, HybridTime write_hybrid_time,
     HybridTime batch_hybrid_time, rocksdb::DB* intents_db, rocksdb::WriteBatch* intents_write_batch,
@@ -903,5 +953,96 @@ Status ExternalIntentsBatchWriter::Apply(rocksdb::DirectWriteHandler* handler) {
   return Status::OK();
 }
 
+BufferedWriteHandler::BufferedWriteHandler() : arena_(Arena::kStartBlockSize, 1_MB) {
+}
+
+BufferedWriteHandler::~BufferedWriteHandler() = default;
+
+Slice BufferedWriteHandler::Store(const SliceParts& parts) {
+  auto size = parts.SumSizes();
+  auto* data = static_cast<char*>(arena_.AllocateBytes(size));
+  parts.CopyAllTo(data);
+  return Slice(data, size);
+}
+
+std::pair<Slice, Slice> BufferedWriteHandler::Put(const SliceParts& key, const SliceParts& value) {
+  records_.push_back(Record {
+    .key = Store(key),
+    .value = Store(value),
+  });
+  return {records_.back().key, records_.back().value};
+}
+
+void BufferedWriteHandler::SingleDelete(const Slice& key) {
+  single_deletes_.push_back(arena_.DupSlice(key));
+}
+
+size_t BufferedWriteHandler::Flush(
+    rocksdb::DB* db, const std::string& file_path, size_t min_ingest_records,
+    rocksdb::WriteBatch* write_batch) {
+  // Apply state records replace each other, so they are always written through the memtable to
+  // keep their order.
+  auto regular_end = std::stable_partition(
+      records_.begin(), records_.end(), [](const Record& record) {
+        return record.key.empty() ||
+               record.key[0] != KeyEntryTypeAsChar::kTransactionApplyState;
+      });
+  size_t num_regular = regular_end - records_.begin();
+
+  size_t num_ingested = 0;
+  // The last record is always written through the memtable, so the write batch is not empty and
+  // frontiers of the operation get to the memtable.
+  if (min_ingest_records && num_regular > 1 && num_regular >= min_ingest_records) {
+    const auto* comparator = db->GetOptions().comparator;
+    std::sort(records_.begin(), regular_end, [comparator](const Record& lhs, const Record& rhs) {
+      return comparator->Compare(lhs.key, rhs.key) < 0;
+    });
+    auto status = IngestSorted(db, file_path, records_.data(), records_.data() + num_regular - 1);
+    if (status.ok()) {
+      num_ingested = num_regular - 1;
+    } else {
+      LOG(INFO) << "Failed to ingest " << num_regular - 1 << " records into "
+                << db->GetName() << ", writing them through memtable: " << status;
+    }
+  }
+
+  for (auto it = records_.begin() + num_ingested; it != records_.end(); ++it) {
+    write_batch->Put(it->key, it->value);
+  }
+  for (const auto& key : single_deletes_) {
+    write_batch->SingleDelete(key);
+  }
+  return num_ingested;
+}
+
+Status BufferedWriteHandler::IngestSorted(
+    rocksdb::DB* db, const std::string& file_path, const Record* begin, const Record* end) {
+  const auto& options = db->GetOptions();
+  rocksdb::ImmutableCFOptions ioptions(options);
+  rocksdb::SstFileWriter writer(rocksdb::EnvOptions(), ioptions, options.comparator);
+  rocksdb::ExternalSstFileInfo file_info;
+  auto status = writer.Open(file_path);
+  for (auto it = begin; status.ok() && it != end; ++it) {
+    status = writer.Add(it->key, it->value);
+  }
+  if (status.ok()) {
+    status = writer.Finish(&file_info);
+  }
+  if (status.ok()) {
+    // Fails without changing the DB when file key range overlaps existing records. Writes are
+    // blocked while file is being added, so records could not appear in the range concurrently.
+    status = db->AddFile(&file_info, /* move_file= */ true);
+  }
+  if (!status.ok()) {
+    auto* env = db->GetEnv();
+    for (const auto& path : {file_path, rocksdb::TableBaseToDataFileName(file_path)}) {
+      if (env->FileExists(path).ok()) {
+        WARN_NOT_OK(env->DeleteFile(path), "Failed to delete " + path);
+      }
+    }
+  }
+  return status;
+}
+
 }  // namespace docdb
 } // namespace yb
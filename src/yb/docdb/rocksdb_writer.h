@@ -13,6 +13,9 @@
 
 #pragma once
 
+#include <functional>
+#include <vector>
+
 #include "yb/common/doc_hybrid_time.h"
 #include "yb/common/hybrid_time.h"
 #include "yb/common/transaction.h"
@@ -25,6 +28,8 @@
 
 #include "yb/rocksdb/write_batch.h"
 
+#include "yb/util/memory/arena.h"
+
 namespace yb {
 namespace docdb {
 
@@ -80,6 +85,13 @@ class TransactionalWriter : public rocksdb::DirectWriter {
     metadata_to_store_ = value;
   }
 
+  // Callback invoked with the doc path of every written intent and whether the intent is strong.
+  using IntentKeyCallback = std::function<void(Slice doc_path, bool strong)>;
+
+  void SetIntentKeyCallback(IntentKeyCallback callback) {
+    intent_key_callback_ = std::move(callback);
+  }
+
  private:
   Status operator()(
       dockv::IntentTypeSet intent_types, dockv::AncestorDocKey ancestor_doc_key,
@@ -101,6 +113,7 @@ class TransactionalWriter : public rocksdb::DirectWriter {
   IntraTxnWriteId intra_txn_write_id_;
   IntraTxnWriteId write_id_ = 0;
   const LWTransactionMetadataPB* metadata_to_store_ = nullptr;
+  IntentKeyCallback intent_key_callback_;
 
   // TODO(dtxn) weak & strong intent in one batch.
   // TODO(dtxn) extract part of code knowing about intents structure to lower level.
@@ -115,6 +128,7 @@ class TransactionalWriter : public rocksdb::DirectWriter {
 class IntentsWriterContext {
  public:
   explicit IntentsWriterContext(const TransactionId& transaction_id);
+  IntentsWriterContext(const TransactionId& transaction_id, int64_t max_records);
 
   virtual ~IntentsWriterContext() = default;
 
@@ -144,6 +158,10 @@ class IntentsWriterContext {
     return left_records_ <= 0;
   }
 
+  int64_t left_records() const {
+    return left_records_;
+  }
+
   void RegisterRecord() {
     --left_records_;
   }
@@ -234,14 +252,53 @@ class ApplyIntentsContext : public IntentsWriterContext, public FrontierSchemaVe
 class RemoveIntentsContext : public IntentsWriterContext {
  public:
   explicit RemoveIntentsContext(const TransactionId& transaction_id, uint8_t reason);
+  RemoveIntentsContext(const TransactionId& transaction_id, uint8_t reason, int64_t max_records);
 
   Result<bool> Entry(
       const Slice& key, const Slice& value, bool metadata,
       rocksdb::DirectWriteHandler* handler) override;
 
   void Complete(rocksdb::DirectWriteHandler* handler) override;
+
+  // Total size of removed keys.
+  size_t removed_bytes() const {
+    return removed_bytes_;
+  }
+
  private:
   uint8_t reason_;
+  size_t removed_bytes_ = 0;
+};
+
+// Removes intents of multiple transactions. Intents of as many transactions as fit into
+// txn_max_apply_batch_records are removed in a single write batch, so cleanup of a lot of small
+// transactions does not pay for a separate write per transaction.
+// Should be applied to new write batches until Done returns true.
+class RemoveIntentsBatchWriter : public rocksdb::DirectWriter {
+ public:
+  RemoveIntentsBatchWriter(
+      std::vector<TransactionId> transaction_ids, uint8_t reason, rocksdb::DB* intents_db);
+
+  Status Apply(rocksdb::DirectWriteHandler* handler) override;
+
+  bool Done() const {
+    return next_ == transaction_ids_.size();
+  }
+
+  // Total size of keys removed by the last Apply.
+  size_t last_batch_bytes() const {
+    return last_batch_bytes_;
+  }
+
+ private:
+  const std::vector<TransactionId> transaction_ids_;
+  const uint8_t reason_;
+  rocksdb::DB* const intents_db_;
+  // Index of the first transaction, whose intents were not removed yet.
+  size_t next_ = 0;
+  // Reverse index key to continue removal of intents of transaction_ids_[next_] from.
+  std::string resume_key_;
+  size_t last_batch_bytes_ = 0;
 };
 
 // Usually put_batch contains only records that should be applied to regular DB.
@@ -300,5 +357,46 @@ class ExternalIntentsBatchWriter : public rocksdb::DirectWriter,
   rocksdb::WriteBatch* intents_write_batch_;
 };
 
+// DirectWriteHandler that keeps copies of written records in memory, so they could be written to
+// the DB after the writer completes. Used to move large chunks of applied intents to the regular
+// DB as an externally created SST file, bypassing the memtable.
+class BufferedWriteHandler : public rocksdb::DirectWriteHandler {
+ public:
+  BufferedWriteHandler();
+  ~BufferedWriteHandler();
+
+  std::pair<Slice, Slice> Put(const SliceParts& key, const SliceParts& value) override;
+  void SingleDelete(const Slice& key) override;
+
+  size_t num_records() const {
+    return records_.size() + single_deletes_.size();
+  }
+
+  // Writes buffered records to db. When there are at least min_ingest_records regular records,
+  // all of them except the last one are sorted and written to an SST file at file_path, that is
+  // added to db. Remaining records, including transaction apply state, are added to write_batch,
+  // so the caller writes them with frontiers of the operation.
+  // Falls back to adding all records to write_batch when the file could not be added, for instance
+  // because its key range overlaps existing records.
+  // Returns number of records added to db in the SST file.
+  size_t Flush(
+      rocksdb::DB* db, const std::string& file_path, size_t min_ingest_records,
+      rocksdb::WriteBatch* write_batch);
+
+ private:
+  struct Record {
+    Slice key;
+    Slice value;
+  };
+
+  Slice Store(const SliceParts& parts);
+  Status IngestSorted(
+      rocksdb::DB* db, const std::string& file_path, const Record* begin, const Record* end);
+
+  Arena arena_;
+  std::vector<Record> records_;
+  std::vector<Slice> single_deletes_;
+};
+
 } // namespace docdb
 } // namespace yb
@@ -0,0 +1,83 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <gtest/gtest.h>
+
+#include "yb/docdb/row_cache.h"
+
+#include "yb/util/test_macros.h"
+
+namespace yb::docdb {
+
+namespace {
+
+HybridTime Ht(uint64_t micros) {
+  return HybridTime::FromMicros(micros);
+}
+
+} // namespace
+
+TEST(RowCacheTest, Visibility) {
+  RowCache cache(1024, Ht(100));
+
+  // Values stored before the cache was created could be newer than the read.
+  auto snapshot = cache.TakeSnapshot();
+  cache.Insert(snapshot, "key", "old", Ht(50));
+  ASSERT_EQ(cache.TEST_size(), 0);
+
+  snapshot = cache.TakeSnapshot();
+  cache.Insert(snapshot, "key", "v1", Ht(200));
+  ASSERT_EQ(cache.Get("key", Ht(300)), "v1");
+  // Value is not used by reads before the read that cached it.
+  ASSERT_EQ(cache.Get("key", Ht(150)), std::nullopt);
+
+  cache.Invalidate("key", Ht(400));
+  ASSERT_EQ(cache.Get("key", Ht(500)), std::nullopt);
+
+  // Write applied between the snapshot and the insert prevents caching.
+  snapshot = cache.TakeSnapshot();
+  cache.Invalidate("other", Ht(450));
+  cache.Insert(snapshot, "key", "v2", Ht(500));
+  ASSERT_EQ(cache.Get("key", Ht(600)), std::nullopt);
+
+  // Write with hybrid time after the read was applied before the snapshot.
+  cache.Invalidate("key", Ht(700));
+  snapshot = cache.TakeSnapshot();
+  cache.Insert(snapshot, "key", "v2", Ht(600));
+  ASSERT_EQ(cache.Get("key", Ht(800)), std::nullopt);
+
+  snapshot = cache.TakeSnapshot();
+  cache.Insert(snapshot, "key", "v3", Ht(800));
+  ASSERT_EQ(cache.Get("key", Ht(800)), "v3");
+
+  cache.Clear(Ht(900));
+  ASSERT_EQ(cache.Get("key", Ht(1000)), std::nullopt);
+}
+
+TEST(RowCacheTest, Eviction) {
+  constexpr size_t kValueSize = 100;
+  RowCache cache(1024, HybridTime::kMin);
+  const std::string value(kValueSize, 'x');
+  for (int i = 0; i != 20; ++i) {
+    auto key = std::to_string(i);
+    cache.Insert(cache.TakeSnapshot(), key, value, Ht(100));
+    // Keep the first key hot.
+    ASSERT_EQ(cache.Get("0", Ht(100)), value);
+  }
+  ASSERT_LT(cache.TEST_size(), 10);
+  ASSERT_EQ(cache.Get("0", Ht(100)), value);
+  ASSERT_EQ(cache.Get("1", Ht(100)), std::nullopt);
+  ASSERT_EQ(cache.Get("19", Ht(100)), value);
+}
+
+}  // namespace yb::docdb
@@ -0,0 +1,111 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/row_cache.h"
+
+namespace yb::docdb {
+
+namespace {
+
+// Approximate memory used by the list node and the index entry of a cached value.
+constexpr size_t kEntryOverhead = 96;
+
+} // namespace
+
+RowCache::RowCache(size_t capacity_bytes, HybridTime max_write_ht)
+    : capacity_bytes_(capacity_bytes), max_write_ht_(max_write_ht) {
+}
+
+RowCache::Snapshot RowCache::TakeSnapshot() {
+  std::lock_guard lock(mutex_);
+  return Snapshot {
+    .version = version_,
+    .max_write_ht = max_write_ht_,
+  };
+}
+
+std::optional<std::string> RowCache::Get(Slice key, HybridTime read_time) {
+  std::lock_guard lock(mutex_);
+  auto it = index_.find(key);
+  if (it == index_.end() || read_time < it->second->read_time) {
+    return std::nullopt;
+  }
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return it->second->value;
+}
+
+void RowCache::Insert(const Snapshot& snapshot, Slice key, Slice value, HybridTime read_time) {
+  if (snapshot.max_write_ht > read_time) {
+    return;
+  }
+  Entry entry {
+    .key = key.ToBuffer(),
+    .value = value.ToBuffer(),
+    .read_time = read_time,
+  };
+  const auto charge = Charge(entry);
+  if (charge > capacity_bytes_) {
+    return;
+  }
+
+  std::lock_guard lock(mutex_);
+  if (version_ != snapshot.version) {
+    return;
+  }
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    Erase(it->second);
+  }
+  while (size_bytes_ + charge > capacity_bytes_) {
+    Erase(std::prev(entries_.end()));
+  }
+  entries_.push_front(std::move(entry));
+  index_.emplace(entries_.front().key, entries_.begin());
+  size_bytes_ += charge;
+}
+
+void RowCache::Invalidate(Slice key, HybridTime write_ht) {
+  std::lock_guard lock(mutex_);
+  ++version_;
+  max_write_ht_.MakeAtLeast(write_ht);
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    Erase(it->second);
+  }
+}
+
+void RowCache::Clear(HybridTime max_write_ht) {
+  std::lock_guard lock(mutex_);
+  ++version_;
+  max_write_ht_.MakeAtLeast(max_write_ht);
+  index_.clear();
+  entries_.clear();
+  size_bytes_ = 0;
+}
+
+size_t RowCache::TEST_size() const {
+  std::lock_guard lock(mutex_);
+  return entries_.size();
+}
+
+size_t RowCache::Charge(const Entry& entry) {
+  return entry.key.size() + entry.value.size() + kEntryOverhead;
+}
+
+void RowCache::Erase(Entries::iterator it) {
+  size_bytes_ -= Charge(*it);
+  index_.erase(it->key);
+  entries_.erase(it);
+}
+
+}  // namespace yb::docdb
@@ -0,0 +1,90 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "yb/common/hybrid_time.h"
+
+#include "yb/gutil/thread_annotations.h"
+
+#include "yb/util/slice.h"
+
+namespace yb::docdb {
+
+// LRU cache of the latest values of hot keys of a tablet, keyed by encoded DocKey.
+//
+// A value is cached only when it is the latest version of the key in the DB, so it stays valid for
+// any later read until a write of the key is applied. Invalidate should be called after a write is
+// applied to the DB and before its hybrid time becomes safe for reads.
+class RowCache {
+ public:
+  // State of the cache, that should be taken before reading a value that would be inserted.
+  struct Snapshot {
+    uint64_t version;
+    HybridTime max_write_ht;
+  };
+
+  // All values stored in the DB before the cache was created should have hybrid time not greater
+  // than max_write_ht.
+  RowCache(size_t capacity_bytes, HybridTime max_write_ht);
+
+  Snapshot TakeSnapshot() EXCLUDES(mutex_);
+
+  // Returns cached value of the key, if it could be used by the read at read_time.
+  std::optional<std::string> Get(Slice key, HybridTime read_time) EXCLUDES(mutex_);
+
+  // Inserts value of the key read at read_time. The value is dropped if it might not be the latest
+  // version of the key, i.e. a write was applied after the snapshot was taken, or a write with
+  // hybrid time after read_time was applied before it.
+  void Insert(const Snapshot& snapshot, Slice key, Slice value, HybridTime read_time)
+      EXCLUDES(mutex_);
+
+  void Invalidate(Slice key, HybridTime write_ht) EXCLUDES(mutex_);
+
+  // Drops all values, e.g. when data was added to the DB bypassing regular writes. Values are not
+  // cached until reads at max_write_ht.
+  void Clear(HybridTime max_write_ht) EXCLUDES(mutex_);
+
+  size_t TEST_size() const EXCLUDES(mutex_);
+
+ private:
+  struct Entry {
+    std::string key;
+    std::string value;
+    HybridTime read_time;
+  };
+
+  using Entries = std::list<Entry>;
+
+  static size_t Charge(const Entry& entry);
+
+  void Erase(Entries::iterator it) REQUIRES(mutex_);
+
+  const size_t capacity_bytes_;
+
+  mutable std::mutex mutex_;
+  uint64_t version_ GUARDED_BY(mutex_) = 0;
+  HybridTime max_write_ht_ GUARDED_BY(mutex_);
+  size_t size_bytes_ GUARDED_BY(mutex_) = 0;
+  // Most recently used entries are at the front.
+  Entries entries_ GUARDED_BY(mutex_);
+  std::unordered_map<Slice, Entries::iterator, Slice::Hash> index_ GUARDED_BY(mutex_);
+};
+
+}  // namespace yb::docdb
@@ -11,13 +11,17 @@
 // under the License.
 //
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "yb/common/pgsql_protocol.pb.h"
+#include "yb/common/read_hybrid_time.h"
 #include "yb/common/schema.h"
 
 #include "yb/docdb/doc_pgsql_scanspec.h"
+#include "yb/docdb/intent_aware_iterator_interface.h"
 #include "yb/docdb/scan_choices.h"
 
 #include "yb/dockv/value_type.h"
@@ -27,6 +31,8 @@
 
 using std::string;
 
+DECLARE_bool(scan_choices_adaptive_advance);
+
 namespace yb {
 namespace docdb {
 
@@ -69,6 +75,61 @@ class TestCondition {
   std::vector<std::vector<int>> rhs_;
 };
 
+// Iterator that only remembers the last forward seek target, the position is maintained by the test.
+class SeekRecordingIterator : public IntentAwareIteratorIf {
+ public:
+  void Seek(Slice key, Full full) override {
+    SeekForward(key);
+  }
+
+  void SeekForward(Slice key) override {
+    seek_key_ = dockv::KeyBytes(key);
+    ++seeks_;
+  }
+
+  void SeekOutOfSubDoc(dockv::KeyBytes* key_bytes) override {
+    FAIL() << "Unexpected SeekOutOfSubDoc";
+  }
+
+  void PrevDocKey(Slice encoded_doc_key) override {
+    FAIL() << "Unexpected PrevDocKey";
+  }
+
+  const ReadHybridTime& read_time() const override {
+    return read_time_;
+  }
+
+  Result<HybridTime> RestartReadHt() const override {
+    return HybridTime::kInvalid;
+  }
+
+  Result<const FetchedEntry&> Fetch() override {
+    return entry_;
+  }
+
+  Slice SetUpperbound(Slice upperbound) override {
+    return Slice();
+  }
+
+  std::string DebugPosToString() override {
+    return "SeekRecordingIterator";
+  }
+
+  std::optional<dockv::KeyBytes> TakeSeekKey() {
+    return std::exchange(seek_key_, std::nullopt);
+  }
+
+  size_t seeks() const {
+    return seeks_;
+  }
+
+ private:
+  ReadHybridTime read_time_;
+  FetchedEntry entry_;
+  std::optional<dockv::KeyBytes> seek_key_;
+  size_t seeks_ = 0;
+};
+
 class ScanChoicesTest : public YBTest {
  protected:
   void AssertChoicesEqual(const std::vector<OptionRange> &lhs, const std::vector<OptionRange> &rhs);
@@ -92,6 +153,18 @@ class ScanChoicesTest : public YBTest {
       const std::vector<TestCondition> &conds,
       std::vector<std::vector<OptionRange>> &&expected);
 
+  struct SimulatedScanResult {
+    std::vector<std::vector<int>> matched_rows;
+    size_t seeks = 0;
+  };
+
+  // Scans the specified sorted rows of ascending int32 key columns, the way DocRowwiseIterator
+  // does, and returns rows accepted by scan choices.
+  Result<SimulatedScanResult> SimulateScan(
+      const Schema &schema,
+      const std::vector<TestCondition> &conds,
+      const std::vector<std::vector<int>> &rows);
+
  private:
   const Schema *current_schema_;
   std::unique_ptr<HybridScanChoices> choices_;
@@ -340,6 +413,52 @@ void ScanChoicesTest::CheckSkipTargetsUpTo(
   }
 }
 
+Result<ScanChoicesTest::SimulatedScanResult> ScanChoicesTest::SimulateScan(
+    const Schema &schema,
+    const std::vector<TestCondition> &conds,
+    const std::vector<std::vector<int>> &rows) {
+  PgsqlConditionPB cond;
+  SetupCondition(&cond, conds);
+  InitializeScanChoicesInstance(schema, cond);
+
+  std::vector<dockv::KeyBytes> keys;
+  for (const auto& row : rows) {
+    dockv::KeyEntryValues components;
+    for (auto value : row) {
+      components.push_back(KeyEntryValue::Int32(value));
+    }
+    keys.push_back(DocKey(components).Encode());
+  }
+
+  SeekRecordingIterator iter;
+  size_t pos = 0;
+  // Moves to the seek target if there was a seek, otherwise steps to the next row.
+  auto move = [&iter, &keys, &pos] {
+    auto seek_key = iter.TakeSeekKey();
+    if (!seek_key) {
+      ++pos;
+      return;
+    }
+    pos = std::lower_bound(
+        keys.begin(), keys.end(), *seek_key,
+        [](const dockv::KeyBytes& lhs, const dockv::KeyBytes& rhs) {
+          return lhs.AsSlice().compare(rhs.AsSlice()) < 0;
+        }) - keys.begin();
+  };
+
+  SimulatedScanResult result;
+  while (pos < keys.size() && !choices_->Finished()) {
+    auto row_key = keys[pos];
+    if (VERIFY_RESULT(choices_->InterestedInRow(&row_key, &iter))) {
+      result.matched_rows.push_back(rows[pos]);
+      RETURN_NOT_OK(choices_->AdvanceToNextRow(&row_key, &iter, false));
+    }
+    move();
+  }
+  result.seeks = iter.seeks();
+  return result;
+}
+
 // Tests begin here
 TEST_F(ScanChoicesTest, SimpleInFilterHybridScan) {
   std::vector<TestCondition> conds =
@@ -425,5 +544,48 @@ TEST_F(ScanChoicesTest, MixedTupleFilterHybridScan) {
        {{12, 11, 4, 23, 14, 22}, {12, 11, 4, 23, 14, 12}}});
 }
 
+TEST_F(ScanChoicesTest, AdaptiveAdvance) {
+  std::vector<std::vector<int>> r2_options;
+  for (int r2 = 1; r2 <= 32; ++r2) {
+    r2_options.push_back({r2});
+  }
+  std::vector<TestCondition> conds =
+      {{{10_ColId}, QL_OP_IN, {{5}, {6}}},
+       {{11_ColId}, QL_OP_IN, std::vector<std::vector<int>>(r2_options)}};
+  const Schema &schema = test_range_schema;
+
+  for (auto dense : {true, false}) {
+    std::vector<std::vector<int>> rows;
+    std::vector<std::vector<int>> expected_rows;
+    for (int r1 = 4; r1 <= 7; ++r1) {
+      for (int r2 = 0; r2 <= 33; ++r2) {
+        if (!dense && r2 % 2) {
+          continue;
+        }
+        rows.push_back({r1, r2});
+        if ((r1 == 5 || r1 == 6) && r2 >= 1 && r2 <= 32) {
+          expected_rows.push_back({r1, r2});
+        }
+      }
+    }
+
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_scan_choices_adaptive_advance) = false;
+    auto seek_result = ASSERT_RESULT(SimulateScan(schema, conds, rows));
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_scan_choices_adaptive_advance) = true;
+    auto adaptive_result = ASSERT_RESULT(SimulateScan(schema, conds, rows));
+    LOG(INFO) << "Dense: " << dense << ", seeks: " << seek_result.seeks
+              << ", adaptive seeks: " << adaptive_result.seeks;
+
+    ASSERT_EQ(seek_result.matched_rows, expected_rows);
+    ASSERT_EQ(adaptive_result.matched_rows, expected_rows);
+    if (dense) {
+      // Almost every advance should step to the next row once enough feedback is collected.
+      ASSERT_LT(adaptive_result.seeks * 2, seek_result.seeks);
+    } else {
+      ASSERT_LE(adaptive_result.seeks, seek_result.seeks);
+    }
+  }
+}
+
 }  // namespace docdb
 }  // namespace yb
@@ -24,16 +24,36 @@
 #include "yb/docdb/intent_aware_iterator_interface.h"
 #include "yb/dockv/value_type.h"
 
+#include "yb/util/flags.h"
 #include "yb/util/logging.h"
 #include "yb/util/result.h"
 #include "yb/util/status.h"
 
+DEFINE_RUNTIME_bool(scan_choices_adaptive_advance, true,
+                    "Whether forward scans with IN/EQ filters on all key columns should step to the "
+                    "next row instead of seeking to the next scan target, when most of the recent "
+                    "scan targets were found right after the previous ones.");
+
+DEFINE_RUNTIME_uint32(scan_choices_step_min_match_pct, 75,
+                      "Minimal percentage of recent scan targets that matched the row following "
+                      "the previous target, required for adaptive advance to step to the next row "
+                      "instead of seeking.");
+
 namespace yb {
 
 int TEST_scan_trivial_expectation = -1;
 
 namespace docdb {
 
+namespace {
+
+// Minimal number of advances observed for an option list before stepping could be chosen.
+constexpr uint32_t kAdvanceStatsMinSamples = 8;
+// Advance stats are halved after this number of samples, so recent feedback has more weight.
+constexpr uint32_t kAdvanceStatsWindow = 64;
+
+} // namespace
+
 using dockv::DocKey;
 using dockv::DocKeyDecoder;
 using dockv::KeyBytes;
@@ -64,7 +84,10 @@ HybridScanChoices::HybridScanChoices(
       lower_doc_key_(lower_doc_key),
       upper_doc_key_(upper_doc_key),
       col_groups_(col_groups),
-      prefix_length_(prefix_length) {
+      prefix_length_(prefix_length),
+      adaptive_advance_(
+          FLAGS_scan_choices_adaptive_advance && is_forward_scan && prefix_length == 0),
+      min_step_match_pct_(FLAGS_scan_choices_step_min_match_pct) {
   size_t last_filtered_idx = static_cast<size_t>(-1);
   has_hash_columns_ = schema.has_yb_hash_code();
   num_hash_cols_ = schema.num_hash_key_columns();
@@ -192,6 +215,10 @@ HybridScanChoices::HybridScanChoices(
     current_scan_target_ranges_[i] = scan_options_.at(i).begin();
   }
 
+  if (adaptive_advance_) {
+    advance_stats_.resize(scan_options_.size());
+  }
+
   schema_num_keys_ = schema.num_dockey_components();
 }
 
@@ -609,6 +636,7 @@ Status HybridScanChoices::IncrementScanTargetAtOptionList(ssize_t start_option_l
 
   for (; option_list_idx >= 0; option_list_idx--) {
     if (!is_extremal[option_list_idx]) {
+      last_incremented_option_list_idx_ = option_list_idx;
       option_list_idx++;
       start_with_infinity = true;
       break;
@@ -622,6 +650,7 @@ Status HybridScanChoices::IncrementScanTargetAtOptionList(ssize_t start_option_l
     if (it != end) {
       // and if this value is at the extremal bound
       DCHECK(is_extremal[option_list_idx]);
+      last_incremented_option_list_idx_ = option_list_idx;
 
       size_t idx = is_forward_scan_ ? it->begin_idx() : it->end_idx() - 1;
       SetGroup(option_list_idx, idx);
@@ -795,12 +824,47 @@ void HybridScanChoices::SeekToCurrentTarget(IntentAwareIteratorIf* db_iter) {
   }
 }
 
+bool HybridScanChoices::ShouldStepToNextRow() const {
+  if (!adaptive_advance_ || finished_ || current_scan_target_.empty()) {
+    return false;
+  }
+  const auto& stats = advance_stats_[advance_option_list_idx_];
+  return stats.samples >= kAdvanceStatsMinSamples &&
+         stats.matches * 100ULL >= stats.samples * static_cast<uint64_t>(min_step_match_pct_);
+}
+
+void HybridScanChoices::RecordAdvanceFeedback(bool matched) {
+  auto& stats = advance_stats_[advance_option_list_idx_];
+  stats.matches += matched;
+  if (++stats.samples >= kAdvanceStatsWindow) {
+    stats.matches /= 2;
+    stats.samples /= 2;
+  }
+}
+
 Result<bool> HybridScanChoices::InterestedInRow(
     dockv::KeyBytes* row_key, IntentAwareIteratorIf* iter) {
   auto row = row_key->AsSlice();
+  auto advance_mode = std::exchange(advance_mode_, AdvanceMode::kNone);
   if (CurrentTargetMatchesKey(row)) {
+    if (advance_mode != AdvanceMode::kNone) {
+      RecordAdvanceFeedback(true);
+    }
     return true;
   }
+  if (advance_mode == AdvanceMode::kStep) {
+    // After stepping to the row following the previous target we could be either before the
+    // current target or past it, when there is no row for the current target. In the first case
+    // the seek is required, while the second case is handled as after a regular seek.
+    const bool before_target = row.compare(current_scan_target_) < 0;
+    RecordAdvanceFeedback(!before_target);
+    if (before_target) {
+      SeekToCurrentTarget(iter);
+      return false;
+    }
+  } else if (advance_mode == AdvanceMode::kSeek) {
+    RecordAdvanceFeedback(false);
+  }
   // We must have seeked past the target key we are looking for (no result) so we can safely
   // skip all scan targets between the current target and row key (excluding row_key_ itself).
   // Update the target key and iterator and call HasNext again to try the next target.
@@ -838,6 +902,16 @@ Result<bool> HybridScanChoices::AdvanceToNextRow(
       CurrentTargetMatchesKey(row_key->AsSlice())) {
     return false;
   }
+  if (adaptive_advance_ && !advance_stats_.empty()) {
+    advance_option_list_idx_ = last_incremented_option_list_idx_;
+    if (ShouldStepToNextRow()) {
+      // Let the caller move to the next row, InterestedInRow will seek to the current target if
+      // that row precedes it.
+      advance_mode_ = AdvanceMode::kStep;
+      return false;
+    }
+    advance_mode_ = AdvanceMode::kSeek;
+  }
   SeekToCurrentTarget(iter);
   return true;
 }
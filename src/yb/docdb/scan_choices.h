@@ -252,6 +252,13 @@ class HybridScanChoices : public ScanChoices {
 
   bool CurrentTargetMatchesKey(Slice curr);
 
+  // Returns true if AdvanceToNextRow should let the caller step to the next row instead of seeking
+  // to the current target, based on feedback collected for advance_option_list_idx_.
+  bool ShouldStepToNextRow() const;
+
+  // Records whether the row observed after advancing to the current target matched it.
+  void RecordAdvanceFeedback(bool matched);
+
   // Append KeyEntryValue to target. After every append, we need to check if it is the last hash key
   // column. Subsequently, we need to add a kGroundEnd after that if it is the last hash key column.
   // Hence, appending to scan target should always be done using this function.
@@ -344,6 +351,35 @@ class HybridScanChoices : public ScanChoices {
   size_t prefix_length_ = 0;
 
   size_t schema_num_keys_;
+
+  // Adaptive advancing. When most of the scan targets are present in the table, seeking to every
+  // next target costs more than stepping to the next row with the underlying iterator, so
+  // AdvanceToNextRow switches between the two approaches based on the fraction of advances that
+  // landed on a row matching the new target. Feedback is tracked per option list that was
+  // incremented to produce the target, since options of different key columns could have very
+  // different density. Only used for forward scans without prefix length.
+  struct AdvanceStats {
+    uint32_t matches = 0;
+    uint32_t samples = 0;
+  };
+
+  enum class AdvanceMode {
+    kNone,
+    kSeek,
+    kStep,
+  };
+
+  const bool adaptive_advance_;
+  const uint32_t min_step_match_pct_;
+  std::vector<AdvanceStats> advance_stats_;
+
+  // Option list index that was incremented by the last IncrementScanTargetAtOptionList call.
+  size_t last_incremented_option_list_idx_ = 0;
+
+  // How the last AdvanceToNextRow moved to the current target and the option list index its
+  // feedback should be recorded into. Reset by the next InterestedInRow.
+  AdvanceMode advance_mode_ = AdvanceMode::kNone;
+  size_t advance_option_list_idx_ = 0;
 };
 
 }  // namespace docdb
@@ -11,6 +11,7 @@
 // under the License.
 //
 
+#include <algorithm>
 #include <atomic>
 #include <mutex>
 #include <stack>
@@ -164,6 +165,47 @@ TEST_F(SharedLockManagerTest, QuickLockUnlock) {
   }
 }
 
+// Measures throughput of non conflicting single key lock batches with increasing number of
+// threads, to check that lock manager scales across cores.
+TEST_F(SharedLockManagerTest, LockUnlockScalability) {
+  const auto kDuration = 2s;
+  const auto max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+  for (size_t num_threads = 1;; num_threads = std::min(num_threads * 2, max_threads)) {
+    std::atomic<bool> stop_requested{false};
+    std::atomic<size_t> total_locks{0};
+    std::vector<std::thread> threads;
+    while (threads.size() != num_threads) {
+      size_t thread_idx = threads.size();
+      threads.emplace_back([this, &stop_requested, &total_locks, thread_idx] {
+        RefCntPrefix key(Format("key_$0", thread_idx));
+        size_t locks = 0;
+        while (!stop_requested.load(std::memory_order_acquire)) {
+          LockBatch lb(&lm_, {{key, IntentTypeSet({IntentType::kStrongWrite})}},
+                       CoarseTimePoint::max());
+          ++locks;
+        }
+        total_locks.fetch_add(locks, std::memory_order_acq_rel);
+      });
+    }
+
+    std::this_thread::sleep_for(kDuration);
+    stop_requested.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    auto locks_per_sec = total_locks.load(std::memory_order_acquire) * 1000 /
+                         std::chrono::duration_cast<std::chrono::milliseconds>(kDuration).count();
+    LOG(INFO) << "Threads: " << num_threads << ", lock batches per second: " << locks_per_sec
+              << ", per thread: " << locks_per_sec / num_threads;
+    ASSERT_GT(locks_per_sec, 0);
+    if (num_threads == max_threads) {
+      break;
+    }
+  }
+}
+
 TEST_F(SharedLockManagerTest, LockConflicts) {
   rpc::ThreadPool tp(rpc::ThreadPoolOptions{
     .name = "test_pool"s,
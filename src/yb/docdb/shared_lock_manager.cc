@@ -25,6 +25,9 @@
 #include "yb/docdb/lock_batch.h"
 
 #include "yb/dockv/intent.h"
+
+#include "yb/gutil/port.h"
+
 #include "yb/util/enums.h"
 #include "yb/util/ref_cnt_buffer.h"
 #include "yb/util/scope_exit.h"
@@ -139,8 +142,8 @@ struct LockedBatchEntry {
 
   std::condition_variable cond_var;
 
-  // Refcounting for garbage collection. Can only be used while the global mutex is locked.
-  // Global mutex resides in lock manager and covers this field for all LockBatchEntries.
+  // Refcounting for garbage collection. Can only be used while the stripe mutex is locked.
+  // Stripe mutex resides in lock manager and covers this field for all entries of the stripe.
   size_t ref_count = 0;
 
   // Number of holders for each type
@@ -178,8 +181,11 @@ class SharedLockManager::Impl {
   void Unlock(const LockBatchEntries& key_to_intent_type);
 
   ~Impl() {
-    std::lock_guard lock(global_mutex_);
-    LOG_IF(DFATAL, !locks_.empty()) << "Locks not empty in dtor: " << yb::ToString(locks_);
+    for (auto& stripe : stripes_) {
+      std::lock_guard lock(stripe.mutex);
+      LOG_IF(DFATAL, !stripe.locks.empty()) << "Locks not empty in dtor: "
+                                            << yb::ToString(stripe.locks);
+    }
   }
 
   void DumpStatusHtml(std::ostream& out);
@@ -187,32 +193,47 @@ class SharedLockManager::Impl {
  private:
   typedef std::unordered_map<RefCntPrefix, LockedBatchEntry*, RefCntPrefixHash> LockEntryMap;
 
-  // Make sure the entries exist in the locks_ map and return pointers so we can access
-  // them without holding the global lock. Returns a vector with pointers in the same order
+  // Keys are distributed over independent stripes, so batches that lock different keys do not
+  // contend on the same mutex while reserving and releasing lock entries.
+  static constexpr size_t kNumStripes = 32;
+
+  struct Stripe {
+    // The mutex should be taken only for very short duration, with no blocking wait.
+    std::mutex mutex;
+    LockEntryMap locks GUARDED_BY(mutex);
+    // Cache of lock entries, to avoid allocation/deallocation of heavy LockedBatchEntry.
+    std::vector<std::unique_ptr<LockedBatchEntry>> lock_entries GUARDED_BY(mutex);
+    std::vector<LockedBatchEntry*> free_lock_entries GUARDED_BY(mutex);
+  } CACHELINE_ALIGNED;
+
+  Stripe& StripeForKey(const RefCntPrefix& key) {
+    // Map uses low bits of the hash to select a bucket, so take high bits for the stripe.
+    auto hash = RefCntPrefixHash()(key);
+    return stripes_[(hash ^ (hash >> 32)) % kNumStripes];
+  }
+
+  // Make sure the entries exist in the locks map and return pointers so we can access
+  // them without holding the stripe lock. Returns a vector with pointers in the same order
   // as the keys in the batch.
   void Reserve(LockBatchEntries* batch);
 
   // Update refcounts and maybe collect garbage.
   void Cleanup(const LockBatchEntries& key_to_intent_type);
 
-  // The global mutex should be taken only for very short duration, with no blocking wait.
-  std::mutex global_mutex_;
-
-  LockEntryMap locks_ GUARDED_BY(global_mutex_);
-  // Cache of lock entries, to avoid allocation/deallocation of heavy LockedBatchEntry.
-  std::vector<std::unique_ptr<LockedBatchEntry>> lock_entries_ GUARDED_BY(global_mutex_);
-  std::vector<LockedBatchEntry*> free_lock_entries_ GUARDED_BY(global_mutex_);
+  std::array<Stripe, kNumStripes> stripes_;
 };
 
 void SharedLockManager::Impl::DumpStatusHtml(std::ostream& out) {
   out << "<table>" << std::endl;
   out << "<tr><th>Prefix |</th><th>| LockBatchEntry</th></tr>" << std::endl;
-  std::lock_guard l(global_mutex_);
-  for (const auto& [prefix, entry] : locks_) {
-    out << "<tr>"
-          << "<td>" << (prefix.size() > 0 ? prefix.ToString() : "[empty]") << "</td>"
-          << "<td>" << entry->ToDebugString() << "</td>"
-        << "</tr>";
+  for (auto& stripe : stripes_) {
+    std::lock_guard l(stripe.mutex);
+    for (const auto& [prefix, entry] : stripe.locks) {
+      out << "<tr>"
+            << "<td>" << (prefix.size() > 0 ? prefix.ToString() : "[empty]") << "</td>"
+            << "<td>" << entry->ToDebugString() << "</td>"
+          << "</tr>";
+    }
   }
   out << "</table>" << std::endl;
 }
@@ -340,16 +361,17 @@ bool SharedLockManager::Impl::Lock(LockBatchEntries* key_to_intent_type, CoarseT
 }
 
 void SharedLockManager::Impl::Reserve(LockBatchEntries* key_to_intent_type) {
-  std::lock_guard lock(global_mutex_);
   for (auto& key_and_intent_type : *key_to_intent_type) {
-    auto& value = locks_[key_and_intent_type.key];
+    auto& stripe = StripeForKey(key_and_intent_type.key);
+    std::lock_guard lock(stripe.mutex);
+    auto& value = stripe.locks[key_and_intent_type.key];
     if (!value) {
-      if (!free_lock_entries_.empty()) {
-        value = free_lock_entries_.back();
-        free_lock_entries_.pop_back();
+      if (!stripe.free_lock_entries.empty()) {
+        value = stripe.free_lock_entries.back();
+        stripe.free_lock_entries.pop_back();
       } else {
-        lock_entries_.emplace_back(std::make_unique<LockedBatchEntry>());
-        value = lock_entries_.back().get();
+        stripe.lock_entries.emplace_back(std::make_unique<LockedBatchEntry>());
+        value = stripe.lock_entries.back().get();
       }
     }
     value->ref_count++;
@@ -368,11 +390,12 @@ void SharedLockManager::Impl::Unlock(const LockBatchEntries& key_to_intent_type)
 }
 
 void SharedLockManager::Impl::Cleanup(const LockBatchEntries& key_to_intent_type) {
-  std::lock_guard lock(global_mutex_);
   for (const auto& item : key_to_intent_type) {
+    auto& stripe = StripeForKey(item.key);
+    std::lock_guard lock(stripe.mutex);
     if (--(item.locked->ref_count) == 0) {
-      locks_.erase(item.key);
-      free_lock_entries_.push_back(item.locked);
+      stripe.locks.erase(item.key);
+      stripe.free_lock_entries.push_back(item.locked);
     }
   }
 }
@@ -45,7 +45,8 @@ YB_DEFINE_ENUM(CommitTimeSource,
                ((kLocalAfter, 2)) // Transaction was committed locally after the remote check.
                ((kRemoteAborted, 3)) // Coordinator responded that transaction was aborted.
                ((kRemoteCommitted, 4)) // Coordinator responded that transaction was committed.
-               ((kRemotePending, 5))); // Coordinator responded that transaction is pending.
+               ((kRemotePending, 5)) // Coordinator responded that transaction is pending.
+               ((kCachedOutcome, 6))); // Outcome received by a previous read of the tablet.
 
 } // namespace
 
@@ -101,6 +102,21 @@ Result<TransactionStatusCache::GetCommitDataResult> TransactionStatusCache::DoGe
     };
   }
 
+  auto cached_outcome_opt = txn_context_opt_.txn_status_manager->CachedTxnOutcome(transaction_id);
+  if (cached_outcome_opt != boost::none) {
+    // Outcome is final, but the same as for the local commit data, the transaction committed after
+    // the read time is not visible to this read.
+    if (cached_outcome_opt->commit_ht > read_time_.global_limit) {
+      cached_outcome_opt->commit_ht = HybridTime::kMin;
+    }
+    return GetCommitDataResult {
+      .transaction_local_state = std::move(*cached_outcome_opt),
+      .source = CommitTimeSource::kCachedOutcome,
+      .status_time = {},
+      .safe_time = {},
+    };
+  }
+
   // Since TransactionStatusResult does not have default ctor we should init it somehow.
   TransactionStatusResult txn_status(TransactionStatus::ABORTED, HybridTime());
   const auto kMaxWait = 50ms * kTimeMultiplier;
@@ -186,9 +202,10 @@ Result<TransactionStatusCache::GetCommitDataResult> TransactionStatusCache::DoGe
       };
     }
 
+    TransactionLocalState aborted_state {.commit_ht = HybridTime::kMin, .aborted_subtxn_set = {}};
+    txn_context_opt_.txn_status_manager->CacheTxnOutcome(transaction_id, aborted_state);
     return GetCommitDataResult{
-        .transaction_local_state =
-            TransactionLocalState {.commit_ht = HybridTime::kMin, .aborted_subtxn_set = {}},
+        .transaction_local_state = std::move(aborted_state),
         .source = CommitTimeSource::kRemoteAborted,
         .status_time = txn_status.status_time,
         .safe_time = safe_time,
@@ -196,11 +213,13 @@ Result<TransactionStatusCache::GetCommitDataResult> TransactionStatusCache::DoGe
   }
 
   if (txn_status.status == TransactionStatus::COMMITTED) {
+    TransactionLocalState committed_state {
+      .commit_ht = txn_status.status_time,
+      .aborted_subtxn_set = txn_status.aborted_subtxn_set
+    };
+    txn_context_opt_.txn_status_manager->CacheTxnOutcome(transaction_id, committed_state);
     return GetCommitDataResult {
-      .transaction_local_state = TransactionLocalState {
-        .commit_ht = txn_status.status_time,
-        .aborted_subtxn_set = txn_status.aborted_subtxn_set
-      },
+      .transaction_local_state = std::move(committed_state),
       .source = CommitTimeSource::kRemoteCommitted,
       .status_time = {},
       .safe_time = {},
@@ -21,6 +21,7 @@
 #include <memory>
 #include <queue>
 #include <sstream>
+#include <unordered_map>
 
 #include <boost/algorithm/string/join.hpp>
 
@@ -65,6 +66,12 @@ DEFINE_RUNTIME_uint64(wait_for_relock_unblocked_txn_keys_ms, 0,
 TAG_FLAG(wait_for_relock_unblocked_txn_keys_ms, advanced);
 TAG_FLAG(wait_for_relock_unblocked_txn_keys_ms, hidden);
 
+DEFINE_RUNTIME_bool(wait_queue_defer_conflicting_resumed_waiters, true,
+    "Whether waiters resumed together, e.g. when their common blocker is resolved, whose keys "
+    "conflict with keys of a waiter resumed before them should be resumed only after the other "
+    "waiters.");
+TAG_FLAG(wait_queue_defer_conflicting_resumed_waiters, advanced);
+
 DEFINE_UNKNOWN_uint64(force_single_shard_waiter_retry_ms, 30000,
               "The amount of time to wait before sending the client of a single shard transaction "
               "a retryable error. Such clients are periodically sent a retryable error to ensure "
@@ -511,12 +518,6 @@ class BlockerData {
       }
       return true;
     }, &post_resolve_waiters_);
-    // TODO(wait-queues): Instead of sorting here, we could modify the API of ResumedWaiterRunner to
-    // atomically accept a batch of waiters, and rework some of the upstream code to provide that.
-    std::sort(waiters_to_signal.begin(), waiters_to_signal.end(),
-        [](const auto& lhs, const auto& rhs) {
-      return lhs->ShouldResumeBefore(rhs);
-    });
     return waiters_to_signal;
   }
 
@@ -667,9 +668,20 @@ class BlockerData {
   std::unordered_map<SubTransactionId, IntentsByKey> subtxn_intents_by_key_ GUARDED_BY(mutex_);
 };
 
+// Waiter to be resumed by ResumedWaiterRunner with the specified status.
+struct ResumedWaiter {
+  WaiterDataPtr waiter;
+  Status status;
+  HybridTime resolve_ht = HybridTime::kInvalid;
+};
+
+struct DeferredWaiters;
+
 struct SerialWaiter {
   WaiterDataPtr waiter;
   HybridTime resolve_ht;
+  // Waiters of the same batch deferred until this and other waiters of the batch are resumed.
+  std::shared_ptr<DeferredWaiters> deferred = nullptr;
   bool operator()(const SerialWaiter& w1, const SerialWaiter& w2) const {
     // Reverse operator order to ensure we pop off items with lower start time first, since the
     // priority_queue implementation is a max PQ.
@@ -677,14 +689,41 @@ struct SerialWaiter {
   }
 };
 
+// Waiters of a batch whose keys conflict with keys of other waiters of the same batch.
+struct DeferredWaiters {
+  // Number of not yet resumed waiters of the batch, whose keys don't conflict with each other.
+  size_t num_remaining = 0;
+  std::vector<SerialWaiter> waiters;
+};
+
 // Resumes waiters async, in serial, and in the order of the waiter's serial_no, running the lowest
 // serial number first in a best effort manner.
+//
+// Waiters are submitted in batches, e.g. all waiters unblocked by a resolved blocker. If keys of a
+// waiter conflict with keys of a waiter resumed before it from the same batch, it would most likely
+// either wait to relock its keys or block again on the earlier waiter. Such waiters are resumed
+// only after all other waiters of the batch, so they don't delay resumption of the waiters whose
+// keys were actually released.
 class ResumedWaiterRunner {
  public:
   ResumedWaiterRunner(ThreadPoolToken* thread_pool_token, const std::string& log_prefix)
     : thread_pool_token_(DCHECK_NOTNULL(thread_pool_token)), log_prefix_(log_prefix) {}
 
   void Submit(const WaiterDataPtr& waiter, const Status& status, HybridTime resolve_ht) {
+    std::vector<ResumedWaiter> waiters;
+    waiters.push_back(ResumedWaiter {
+      .waiter = waiter,
+      .status = status,
+      .resolve_ht = resolve_ht,
+    });
+    Submit(std::move(waiters));
+  }
+
+  void Submit(std::vector<ResumedWaiter>&& waiters) {
+    if (waiters.empty()) {
+      return;
+    }
+    auto deferred = GetDeferredWaiters(&waiters);
     {
       UniqueLock l(mutex_);
       if (PREDICT_FALSE(shutting_down_)) {
@@ -693,10 +732,22 @@ class ResumedWaiterRunner {
         // callback here as the record might have already been erased from waiter_status_. Else,
         // we risk dropping execution of the callback all together.
         l.unlock();
-        waiter->InvokeCallback(kShuttingDownError);
+        for (const auto& waiter : waiters) {
+          waiter.waiter->InvokeCallback(kShuttingDownError);
+        }
+        if (deferred) {
+          for (const auto& waiter : deferred->waiters) {
+            waiter.waiter->InvokeCallback(kShuttingDownError);
+          }
+        }
+        return;
+      }
+      for (const auto& waiter : waiters) {
+        AddWaiter(waiter.waiter, waiter.status, waiter.resolve_ht, deferred);
+      }
+      if (!TryScheduleUnlocked()) {
         return;
       }
-      AddWaiter(waiter, status, resolve_ht);
     }
     TriggerPoll();
   }
@@ -712,7 +763,14 @@ class ResumedWaiterRunner {
       UniqueLock l(mutex_);
       waiters.reserve(pq_.size());
       while (!pq_.empty()) {
-        waiters.push_back(std::move(pq_.top().waiter));
+        const auto& top = pq_.top();
+        waiters.push_back(top.waiter);
+        if (top.deferred) {
+          for (auto& deferred_waiter : top.deferred->waiters) {
+            waiters.push_back(std::move(deferred_waiter.waiter));
+          }
+          top.deferred->waiters.clear();
+        }
         pq_.pop();
       }
       shutting_down_ = true;
@@ -731,33 +789,110 @@ class ResumedWaiterRunner {
   }
 
  private:
+  // Moves waiters whose keys conflict with keys of a waiter resumed before them from waiters to
+  // the returned DeferredWaiters. Returns nullptr if there are no such waiters.
+  std::shared_ptr<DeferredWaiters> GetDeferredWaiters(std::vector<ResumedWaiter>* waiters) {
+    if (waiters->size() < 2 ||
+        !GetAtomicFlag(&FLAGS_wait_queue_defer_conflicting_resumed_waiters)) {
+      return nullptr;
+    }
+    std::sort(waiters->begin(), waiters->end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.waiter->ShouldResumeBefore(rhs.waiter);
+    });
+
+    std::unordered_map<RefCntPrefix, dockv::IntentTypeSet, RefCntPrefixHash> resumed_keys;
+    std::vector<ResumedWaiter> resumed_waiters;
+    size_t num_resumed_ok = 0;
+    std::shared_ptr<DeferredWaiters> deferred;
+    for (auto& waiter : *waiters) {
+      // Waiters resumed with error don't relock their keys.
+      if (!waiter.status.ok()) {
+        resumed_waiters.push_back(std::move(waiter));
+        continue;
+      }
+      auto entries = waiter.waiter->GetLockBatchEntries();
+      auto has_conflict = std::any_of(entries.begin(), entries.end(), [&](const auto& entry) {
+        auto it = resumed_keys.find(entry.key);
+        return it != resumed_keys.end() && IntentTypeSetsConflict(it->second, entry.intent_types);
+      });
+      if (has_conflict) {
+        VLOG_WITH_PREFIX(4) << "Deferred resumption of waiter " << waiter.waiter->id
+                            << " with conflicting keys";
+        if (!deferred) {
+          deferred = std::make_shared<DeferredWaiters>();
+        }
+        deferred->waiters.push_back(SerialWaiter {
+          .waiter = std::move(waiter.waiter),
+          .resolve_ht = waiter.resolve_ht,
+        });
+        continue;
+      }
+      for (const auto& entry : entries) {
+        resumed_keys[entry.key] |= entry.intent_types;
+      }
+      ++num_resumed_ok;
+      resumed_waiters.push_back(std::move(waiter));
+    }
+    *waiters = std::move(resumed_waiters);
+    if (deferred) {
+      deferred->num_remaining = num_resumed_ok;
+    }
+    return deferred;
+  }
+
+  // Returns true if the caller should submit a poll task, i.e. there is no scheduled one.
+  bool TryScheduleUnlocked() REQUIRES(mutex_) {
+    if (poll_scheduled_) {
+      return false;
+    }
+    poll_scheduled_ = true;
+    return true;
+  }
+
+  // Submits a poll task, that resumes all waiters in pq_. There is at most one such task per
+  // tablet, since it also resumes waiters added while it is running.
   void TriggerPoll() {
-    WARN_NOT_OK(thread_pool_token_->SubmitFunc([this]() {
+    auto status = thread_pool_token_->SubmitFunc([this]() {
       for (;;) {
         WaiterDataPtr to_invoke;
         HybridTime resolve_ht;
         {
           UniqueLock l(this->mutex_);
           if (pq_.empty()) {
+            poll_scheduled_ = false;
             return;
           }
           to_invoke = pq_.top().waiter;
           resolve_ht = pq_.top().resolve_ht;
+          auto deferred = pq_.top().deferred;
           pq_.pop();
           VLOG_WITH_PREFIX(4) << "Popped waiter " << to_invoke->id
                               << " with start time (us) " << to_invoke->txn_start_us;
+          if (deferred && --deferred->num_remaining == 0) {
+            for (auto& deferred_waiter : deferred->waiters) {
+              pq_.push(std::move(deferred_waiter));
+            }
+            deferred->waiters.clear();
+          }
         }
         to_invoke->InvokeCallback(Status::OK(), resolve_ht);
       }
-    }), "Failed to trigger poll of ResumedWaiterRunner in wait queue");
+    });
+    if (!status.ok()) {
+      WARN_NOT_OK(status, "Failed to trigger poll of ResumedWaiterRunner in wait queue");
+      UniqueLock l(mutex_);
+      poll_scheduled_ = false;
+    }
   }
 
   void AddWaiter(const WaiterDataPtr& waiter, const Status& status,
-                 HybridTime resolve_ht) REQUIRES(mutex_) {
+                 HybridTime resolve_ht,
+                 const std::shared_ptr<DeferredWaiters>& deferred) REQUIRES(mutex_) {
     if (status.ok()) {
       pq_.push(SerialWaiter {
         .waiter = waiter,
         .resolve_ht = resolve_ht,
+        .deferred = deferred,
       });
       VLOG_WITH_PREFIX(4) << "Added waiter " << waiter->id
                           << " with start time (us) " << waiter->txn_start_us;
@@ -778,6 +913,7 @@ class ResumedWaiterRunner {
       SerialWaiter, std::vector<SerialWaiter>, SerialWaiter> pq_ GUARDED_BY(mutex_);
   ThreadPoolToken* thread_pool_token_;
   bool shutting_down_ GUARDED_BY(mutex_) = false;
+  bool poll_scheduled_ GUARDED_BY(mutex_) = false;
   const std::string log_prefix_;
 };
 
@@ -1194,9 +1330,15 @@ class WaitQueue::Impl {
     // queue to ensure their wait-for relationships are re-registered with their coordinator
     // pointing to the correct blocker status tablet.
     if (promoted_blocker) {
+      std::vector<ResumedWaiter> resumed_waiters;
       for (const auto& waiter : promoted_blocker->Signal(std::move(res), clock_->Now())) {
-        InvokeWaiterCallback(Status::OK(), waiter, res.status_time);
+        resumed_waiters.push_back(ResumedWaiter {
+          .waiter = waiter,
+          .status = Status::OK(),
+          .resolve_ht = res.status_time,
+        });
       }
+      InvokeWaiterCallbacks(std::move(resumed_waiters));
     }
   }
 
@@ -1549,46 +1691,64 @@ class WaitQueue::Impl {
       return;
     }
 
+    // Waiters unblocked by the resolved blocker are resumed as a single batch, so the runner could
+    // order them by their keys.
+    std::vector<ResumedWaiter> resumed_waiters;
     for (const auto& waiter : resolved_blocker->Signal(std::move(res), clock_->Now())) {
-      SignalWaiter(waiter);
+      SignalWaiter(waiter, &resumed_waiters);
     }
+    InvokeWaiterCallbacks(std::move(resumed_waiters));
   }
 
   void InvokeWaiterCallback(
       const Status& status, const WaiterDataPtr& waiter_data,
       HybridTime resume_ht = HybridTime::kInvalid) EXCLUDES(mutex_) {
-    if (waiter_data->IsSingleShard()) {
-      waiter_runner_.Submit(waiter_data, status, resume_ht);
+    std::vector<ResumedWaiter> resumed_waiters;
+    resumed_waiters.push_back(ResumedWaiter {
+      .waiter = waiter_data,
+      .status = status,
+      .resolve_ht = resume_ht,
+    });
+    InvokeWaiterCallbacks(std::move(resumed_waiters));
+  }
+
+  void InvokeWaiterCallbacks(std::vector<ResumedWaiter>&& resumed_waiters) EXCLUDES(mutex_) {
+    if (resumed_waiters.empty()) {
       return;
     }
-
     // We cannot use the passed in waiter_data here as it may have been replaced in waiter_status_
     // by a new WaiterData instance for the same transaction. Such a situation would indicate that
     // the previous request had returned to the caller and a new request for the same transaction
     // was now waiting. In this situation, we would want to signal the new waiter.
-    WaiterDataPtr found_waiter = nullptr;
+    std::vector<ResumedWaiter> found_waiters;
+    found_waiters.reserve(resumed_waiters.size());
     {
       UniqueLock l(mutex_);
-      auto it = waiter_status_.find(waiter_data->id);
-      if (it != waiter_status_.end()) {
-        found_waiter = it->second;
+      for (auto& resumed_waiter : resumed_waiters) {
+        if (resumed_waiter.waiter->IsSingleShard()) {
+          found_waiters.push_back(std::move(resumed_waiter));
+          continue;
+        }
+        auto it = waiter_status_.find(resumed_waiter.waiter->id);
+        if (it == waiter_status_.end()) {
+          LOG(WARNING)
+            << "Tried to invoke callback on waiter which has already been removed. "
+            << "This should be rare but is not an error otherwise.";
+          continue;
+        }
+        resumed_waiter.waiter = it->second;
+        found_waiters.push_back(std::move(resumed_waiter));
         waiter_status_.erase(it);
       }
     }
 
-    LOG_IF(WARNING, !found_waiter)
-      << "Tried to invoke callback on waiter which has already been removed. "
-      << "This should be rare but is not an error otherwise.";
-
     // Note -- it's important that we remove the waiter from waiter_status_ before invoking it's
     // callback. Otherwise, the callback will re-run conflict resolution, end up back in the wait
     // queue, and attempt to reuse the WaiterData still present in waiter_status_.
-    if (found_waiter) {
-      waiter_runner_.Submit(found_waiter, status, resume_ht);
-    }
+    waiter_runner_.Submit(std::move(found_waiters));
   }
 
-  void SignalWaiter(const WaiterDataPtr& waiter_data) {
+  void SignalWaiter(const WaiterDataPtr& waiter_data, std::vector<ResumedWaiter>* resumed_waiters) {
     VLOG_WITH_PREFIX(4) << "Signaling waiter " << waiter_data->id;
     Status status = Status::OK();
     size_t num_resolved_blockers = 0;
@@ -1611,7 +1771,11 @@ class WaitQueue::Impl {
       // TODO(wait-queues): Abort transactions without re-invoking conflict resolution when
       // possible, e.g. if the blocking transaction was not a lock-only conflict and was commited.
       // See https://github.com/yugabyte/yugabyte-db/issues/13577
-      InvokeWaiterCallback(status, waiter_data, max_unblock_ht);
+      resumed_waiters->push_back(ResumedWaiter {
+        .waiter = waiter_data,
+        .status = status,
+        .resolve_ht = max_unblock_ht,
+      });
     }
   }
 
@@ -37,6 +37,7 @@ class Partition;
 class PartitionSchema;
 class PgKeyDecoder;
 class PgTableRow;
+class PgTableRowBatch;
 class PgValue;
 class PrimitiveValue;
 class RowPackerV1;
@@ -30,6 +30,7 @@
 #include "yb/util/decimal.h"
 #include "yb/util/fast_varint.h"
 #include "yb/util/format.h"
+#include "yb/util/memory/memory_usage_test_util.h"
 #include "yb/util/random_util.h"
 #include "yb/util/test_macros.h"
 
@@ -140,6 +141,104 @@ void TestPackedRowDecode(const std::vector<DataType>& types) {
   RunPackedRowDecode(Packer::kVersion, schema, entries);
 }
 
+// Checks decoding of projections that skip runs of fixed size columns, with and without nulls.
+TEST(PgRowTest, PackedRowDecoderSkipColumnsV2) {
+  constexpr auto kNumEntries = 1000;
+  const std::vector<DataType> types = {
+      DataType::INT32, DataType::BOOL, DataType::INT64, DataType::INT8, DataType::DOUBLE,
+      DataType::STRING, DataType::INT16, DataType::FLOAT, DataType::INT32, DataType::INT64};
+
+  SchemaBuilder builder;
+  for (DataType type : types) {
+    ASSERT_OK(builder.AddNullableColumn(Format("v$0", builder.next_column_id()), type));
+  }
+  auto schema = builder.Build();
+  SchemaPacking schema_packing(TableType::PGSQL_TABLE_TYPE, schema);
+
+  std::vector<ValueBuffer> entries;
+  std::vector<std::vector<QLValuePB>> values;
+  for (int i = 0; i != kNumEntries; ++i) {
+    RowPackerV2 packer(0, schema_packing, std::numeric_limits<ssize_t>::max(), Slice(), schema);
+    auto& row_values = values.emplace_back();
+    for (size_t idx = 0; idx != types.size(); ++idx) {
+      auto value = RandomUniformInt(0, 3) == 0 ? QLValuePB() : RandomQLValue(types[idx]);
+      ASSERT_OK(packer.AddValue(schema.column_id(idx), value));
+      row_values.push_back(std::move(value));
+    }
+    entries.emplace_back(ASSERT_RESULT(packer.Complete()).WithoutPrefix(2));
+  }
+
+  for (const auto& column_indexes : std::vector<std::vector<size_t>>{{4}, {5, 9}, {1, 9}, {9}}) {
+    std::vector<ColumnId> column_ids;
+    for (auto idx : column_indexes) {
+      column_ids.push_back(schema.column_id(idx));
+    }
+    ReaderProjection projection(schema, column_ids);
+    PgTableRow row(projection);
+    PackedRowDecoder decoder;
+    ColumnDecoderFactory factory(projection);
+    decoder.Init(PackedRowVersion::kV2, projection, schema_packing, &factory, schema);
+    for (size_t i = 0; i != entries.size(); ++i) {
+      row.Reset();
+      ASSERT_OK(decoder.Apply(entries[i].AsSlice(), &row));
+      for (auto idx : column_indexes) {
+        ASSERT_EQ(row.GetQLValuePB(schema.column_id(idx).rep()).ShortDebugString(),
+                  values[i][idx].ShortDebugString());
+      }
+    }
+  }
+}
+
+// Row buffer is reused across Reset calls, so decoding rows with varlen columns allocates heap
+// memory only until the buffer grows to the size of the largest row.
+#if !defined(ADDRESS_SANITIZER) && !defined(THREAD_SANITIZER) && YB_GPERFTOOLS_TCMALLOC
+TEST(PgRowTest, PackedRowDecoderReusesBuffer) {
+#else
+TEST(PgRowTest, DISABLED_PackedRowDecoderReusesBuffer) {
+#endif
+  constexpr auto kNumEntries = 1000;
+  const std::vector<DataType> types = {
+      DataType::INT32, DataType::STRING, DataType::INT64, DataType::BINARY, DataType::STRING};
+
+  SchemaBuilder builder;
+  for (DataType type : types) {
+    ASSERT_OK(builder.AddColumn(Format("v$0", builder.next_column_id()), type));
+  }
+  auto schema = builder.Build();
+  SchemaPacking schema_packing(TableType::PGSQL_TABLE_TYPE, schema);
+
+  std::vector<ValueBuffer> entries;
+  for (int i = 0; i != kNumEntries; ++i) {
+    RowPackerV2 packer(0, schema_packing, std::numeric_limits<ssize_t>::max(), Slice(), schema);
+    for (size_t idx = 0; idx != types.size(); ++idx) {
+      ASSERT_OK(packer.AddValue(schema.column_id(idx), RandomQLValue(types[idx])));
+    }
+    entries.emplace_back(ASSERT_RESULT(packer.Complete()).WithoutPrefix(2));
+  }
+
+  ReaderProjection projection(schema);
+  PgTableRow row(projection);
+  PackedRowDecoder decoder;
+  ColumnDecoderFactory factory(projection);
+  decoder.Init(PackedRowVersion::kV2, projection, schema_packing, &factory, schema);
+  auto decode_all = [&entries, &row, &decoder]() -> Status {
+    for (const auto& entry : entries) {
+      row.Reset();
+      RETURN_NOT_OK(decoder.Apply(entry.AsSlice(), &row));
+    }
+    return Status::OK();
+  };
+
+  // The first pass grows the row buffer up to the size of the largest row.
+  ASSERT_OK(decode_all());
+
+  StartAllocationsTracking();
+  auto status = decode_all();
+  StopAllocationsTracking();
+  ASSERT_OK(status);
+  ASSERT_EQ(GetHeapRequestedBytes(), 0);
+}
+
 TEST(PgRowTest, KeyDecoderPerformance) {
   TestKeyDecode(std::vector<DataType>(10, DataType::INT32));
 }
@@ -893,4 +893,96 @@ PackedColumnDecoderEntry PgTableRow::GetPackedColumnSkipperV2(
   return GetPackedColumnDecoderEntryV2(ColumnStrategy::kSkip, data_type, packed_index);
 }
 
+PgTableRowBatch::PgTableRowBatch(std::reference_wrapper<const ReaderProjection> projection)
+    : projection_(&projection.get()) {
+  columns_.reserve(projection_->size());
+  for (const auto& column : projection_->columns) {
+    columns_.push_back(Column {
+      .fixed_width = StoreAsValue(column.data_type),
+    });
+  }
+}
+
+void PgTableRowBatch::Reset() {
+  for (auto& column : columns_) {
+    column.num_nulls = 0;
+    column.values.clear();
+    column.nulls.clear();
+  }
+  num_rows_ = 0;
+  buffer_.clear();
+}
+
+void PgTableRowBatch::Reserve(size_t num_rows) {
+  for (auto& column : columns_) {
+    column.values.reserve(num_rows);
+    column.nulls.reserve(BitmapSize(num_rows));
+  }
+}
+
+void PgTableRowBatch::Append(const PgTableRow& row) {
+  DCHECK_EQ(&row.projection(), projection_);
+  const auto row_idx = num_rows_++;
+  const bool new_bitmap_byte = (row_idx & 7) == 0;
+  for (size_t idx = 0; idx != columns_.size(); ++idx) {
+    auto& column = columns_[idx];
+    if (new_bitmap_byte) {
+      column.nulls.push_back(0);
+    }
+    if (row.IsNull(idx)) {
+      BitmapSet(column.nulls.data(), row_idx);
+      ++column.num_nulls;
+      column.values.push_back(0);
+    } else if (column.fixed_width) {
+      column.values.push_back(row.GetPrimitiveDatum(idx));
+    } else {
+      column.values.push_back(buffer_.size());
+      buffer_.Append(row.GetVarlenSlice(idx));
+    }
+  }
+}
+
+std::optional<PgValue> PgTableRowBatch::GetValue(size_t column_idx, size_t row_idx) const {
+  if (IsNull(column_idx, row_idx)) {
+    return std::nullopt;
+  }
+  const auto& column = columns_[column_idx];
+  auto datum = column.values[row_idx];
+  if (column.fixed_width) {
+    return PgValue(datum);
+  }
+  return PgValue(bit_cast<PgValueDatum>(buffer_.data() + datum));
+}
+
+QLValuePB PgTableRowBatch::GetQLValuePB(size_t column_idx, size_t row_idx) const {
+  auto value = GetValue(column_idx, row_idx);
+  if (!value) {
+    return QLValuePB();
+  }
+  return value->ToQLValuePB(projection_->columns[column_idx].data_type);
+}
+
+std::string PgTableRowBatch::ToString() const {
+  std::string result = "[ ";
+  for (size_t row_idx = 0; row_idx != num_rows_; ++row_idx) {
+    result += "{ ";
+    for (size_t idx = 0; idx != columns_.size(); ++idx) {
+      result += projection_->columns[idx].id.ToString();
+      result += ": ";
+      auto value = GetValue(idx, row_idx);
+      if (!value) {
+        result += "<NULL>";
+      } else if (columns_[idx].fixed_width) {
+        result += std::to_string(columns_[idx].values[row_idx]);
+      } else {
+        result += value->binary_value().ToDebugHexString();
+      }
+      result += " ";
+    }
+    result += "} ";
+  }
+  result += "]";
+  return result;
+}
+
 }  // namespace yb::dockv
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include <boost/container/small_vector.hpp>
 
@@ -27,6 +28,7 @@
 #include "yb/qlexpr/qlexpr_fwd.h"
 
 #include "yb/util/algorithm_util.h"
+#include "yb/util/bitmap.h"
 #include "yb/util/kv_util.h"
 
 namespace yb {
@@ -170,6 +172,88 @@ class PgTableRow {
   ValueBuffer buffer_;
 };
 
+// Column-major storage for a batch of rows decoded with the same projection.
+// For every projected column it keeps a vector of datums and a null bitmap, so consumers like
+// aggregates or filters could process whole columns without touching individual PgTableRow
+// instances.
+// Fixed width values are stored in place, variable length values are copied to the batch buffer
+// (with the same length prefixed layout as in PgTableRow) and the datum holds the offset.
+class PgTableRowBatch {
+ public:
+  explicit PgTableRowBatch(std::reference_wrapper<const ReaderProjection> projection);
+
+  const ReaderProjection& projection() const {
+    return *projection_;
+  }
+
+  size_t size() const {
+    return num_rows_;
+  }
+
+  bool empty() const {
+    return num_rows_ == 0;
+  }
+
+  size_t num_columns() const {
+    return columns_.size();
+  }
+
+  // Removes all rows from the batch, keeping allocated memory for reuse.
+  void Reset();
+
+  void Reserve(size_t num_rows);
+
+  // Appends the row to the batch. The row should be decoded using the same projection.
+  void Append(const PgTableRow& row);
+
+  bool IsNull(size_t column_idx, size_t row_idx) const {
+    return BitmapTest(columns_[column_idx].nulls.data(), row_idx);
+  }
+
+  // Whether any row in the batch has null value in the specified column.
+  bool HasNulls(size_t column_idx) const {
+    return columns_[column_idx].num_nulls != 0;
+  }
+
+  size_t NumNulls(size_t column_idx) const {
+    return columns_[column_idx].num_nulls;
+  }
+
+  // Null bitmap of the specified column, bit is set for rows with null value.
+  const uint8_t* null_bitmap(size_t column_idx) const {
+    return columns_[column_idx].nulls.data();
+  }
+
+  // Raw datums of the specified column. Null rows have 0 datum.
+  // Should be used only for fixed width columns, for variable length columns use GetValue.
+  const PgValueDatum* datums(size_t column_idx) const {
+    return columns_[column_idx].values.data();
+  }
+
+  bool IsFixedWidth(size_t column_idx) const {
+    return columns_[column_idx].fixed_width;
+  }
+
+  std::optional<PgValue> GetValue(size_t column_idx, size_t row_idx) const;
+
+  QLValuePB GetQLValuePB(size_t column_idx, size_t row_idx) const;
+
+  std::string ToString() const;
+
+ private:
+  struct Column {
+    bool fixed_width;
+    size_t num_nulls = 0;
+    std::vector<PgValueDatum> values;
+    std::vector<uint8_t> nulls;
+  };
+
+  const ReaderProjection* projection_;
+  std::vector<Column> columns_;
+  size_t num_rows_ = 0;
+  ValueBuffer buffer_;
+};
+
 template <bool kLast>
 void CallNextEncoder(const PgTableRow& row, WriteBuffer* buffer, const PgWireEncoderEntry* chain) {
   if (kLast) {
@@ -13,6 +13,8 @@
 
 #include "yb/dockv/schema_packing.h"
 
+#include <bit>
+
 #include "yb/common/ql_protocol.pb.h"
 #include "yb/common/schema_pbutil.h"
 #include "yb/common/schema.h"
@@ -84,6 +86,89 @@ struct DoGetValueVisitor {
   }
 };
 
+// Visitor that returns size of the V2 encoded fixed size value, or 0 for varlen value.
+struct FixedSizeVisitorV2 {
+  size_t Binary() const {
+    return 0;
+  }
+
+  size_t Decimal() const {
+    return 0;
+  }
+
+  size_t String() const {
+    return 0;
+  }
+
+  template <class T>
+  size_t Primitive() const {
+    return sizeof(T);
+  }
+};
+
+// Run of skipped fixed size columns is skipped by a single decoder entry, whose data contains
+// packed index of the first column in the run, number of columns and log2 of their sizes.
+constexpr size_t kMaxSkippedRunColumns = 12;
+constexpr size_t kSkippedRunCountShift = 32;
+constexpr size_t kSkippedRunSizesShift = 36;
+constexpr size_t kSkippedRunIndexMask = (1ULL << kSkippedRunCountShift) - 1;
+constexpr size_t kSkippedRunCountMask = 0xf;
+
+static_assert(kMaxSkippedRunColumns <= kSkippedRunCountMask);
+static_assert(kSkippedRunSizesShift + 2 * kMaxSkippedRunColumns <= 64);
+
+size_t FixedSizeV2(const SchemaPacking& schema_packing, size_t packed_index) {
+  return VisitDataType(
+      schema_packing.column_packing_data(packed_index).data_type, FixedSizeVisitorV2());
+}
+
+// Returns end of the run of fixed size columns that starts at begin and that could be skipped by a
+// single decoder.
+int64_t SkippedRunEnd(const SchemaPacking& schema_packing, int64_t begin, int64_t limit) {
+  auto end = begin;
+  while (end < limit && make_unsigned(end - begin) < kMaxSkippedRunColumns &&
+         FixedSizeV2(schema_packing, end) != 0) {
+    ++end;
+  }
+  return end;
+}
+
+template <bool kCheckNull>
+UnsafeStatus SkipColumnsRunV2(
+    const uint8_t* header, const uint8_t* body, void* context, size_t projection_index,
+    const PackedColumnDecoderEntry* chain) {
+  auto data = chain->data;
+  auto idx = data & kSkippedRunIndexMask;
+  auto end = idx + ((data >> kSkippedRunCountShift) & kSkippedRunCountMask);
+  auto sizes = data >> kSkippedRunSizesShift;
+  for (; idx != end; ++idx, sizes >>= 2) {
+    if (!kCheckNull || !PackedRowDecoderV2::IsNull(header, idx)) {
+      body += 1ULL << (sizes & 3);
+    }
+  }
+  return CallNextDecoderV2<kCheckNull, /* kLast= */ false, /* kIncrementProjectionIndex= */ false>(
+      header, body, context, projection_index, chain);
+}
+
+PackedColumnDecoderEntry SkipColumnsRunEntryV2(
+    const SchemaPacking& schema_packing, int64_t begin, int64_t end) {
+  size_t data = make_unsigned(begin) | (make_unsigned(end - begin) << kSkippedRunCountShift);
+  for (auto idx = begin; idx != end; ++idx) {
+    // Fixed size is always 1, 2, 4 or 8.
+    size_t size_log2 = std::countr_zero(FixedSizeV2(schema_packing, idx));
+    data |= size_log2 << (kSkippedRunSizesShift + 2 * (idx - begin));
+  }
+  return PackedColumnDecoderEntry {
+    .decoder = PackedColumnDecoderUnion {
+      .v2 = PackedColumnDecodersV2 {
+        .with_nulls = &SkipColumnsRunV2<true>,
+        .no_nulls = &SkipColumnsRunV2<false>,
+      },
+    },
+    .data = data,
+  };
+}
+
 UnsafeStatus NopRouter(
     const uint8_t* value, void* context, size_t projection_index,
     const PackedColumnDecoderEntry* chain) {
@@ -106,6 +191,13 @@ void FillDecoders(
     } else {
       if (kVersion == PackedRowVersion::kV2) {
         while (next_packed_index < packed_index) {
+          auto run_end = SkippedRunEnd(schema_packing, next_packed_index, packed_index);
+          if (run_end - next_packed_index > 1) {
+            decoders->push_back(
+                SkipColumnsRunEntryV2(schema_packing, next_packed_index, run_end));
+            next_packed_index = run_end;
+            continue;
+          }
           auto entry = PgTableRow::GetPackedColumnSkipperV2(
               schema_packing.column_packing_data(next_packed_index).data_type,
               next_packed_index);
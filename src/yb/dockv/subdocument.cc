@@ -455,6 +455,8 @@ void SubDocument::ToQLValuePB(const shared_ptr<QLType>& ql_type, QLValuePB* ql_v
       QLMapValuePB *value_pb = ql_value->mutable_map_value();
       value_pb->clear_keys();
       value_pb->clear_values();
+      value_pb->mutable_keys()->Reserve(object_num_keys());
+      value_pb->mutable_values()->Reserve(object_num_keys());
       for (auto &pair : object_container()) {
         pair.first.ToQLValuePB(keys_type, value_pb->add_keys());
         pair.second.ToQLValuePB(values_type, value_pb->add_values());
@@ -465,6 +467,7 @@ void SubDocument::ToQLValuePB(const shared_ptr<QLType>& ql_type, QLValuePB* ql_v
       const shared_ptr<QLType>& elems_type = ql_type->params()[0];
       QLSeqValuePB *value_pb = ql_value->mutable_set_value();
       value_pb->clear_elems();
+      value_pb->mutable_elems()->Reserve(object_num_keys());
       for (auto &pair : object_container()) {
         pair.first.ToQLValuePB(elems_type, value_pb->add_elems());
         // set elems are represented as subdocument keys so we ignore the (empty) values
@@ -475,6 +478,7 @@ void SubDocument::ToQLValuePB(const shared_ptr<QLType>& ql_type, QLValuePB* ql_v
       const shared_ptr<QLType>& elems_type = ql_type->params()[0];
       QLSeqValuePB *value_pb = ql_value->mutable_list_value();
       value_pb->clear_elems();
+      value_pb->mutable_elems()->Reserve(object_num_keys());
       for (auto &pair : object_container()) {
         // list elems are represented as subdocument values with keys only used for ordering
         pair.second.ToQLValuePB(elems_type, value_pb->add_elems());
@@ -486,6 +490,8 @@ void SubDocument::ToQLValuePB(const shared_ptr<QLType>& ql_type, QLValuePB* ql_v
       QLMapValuePB *value_pb = ql_value->mutable_map_value();
       value_pb->clear_keys();
       value_pb->clear_values();
+      value_pb->mutable_keys()->Reserve(object_num_keys());
+      value_pb->mutable_values()->Reserve(object_num_keys());
       for (auto &pair : object_container()) {
         QLValuePB *key = value_pb->add_keys();
         pair.first.ToQLValuePB(keys_type, key);
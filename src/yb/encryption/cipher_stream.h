@@ -15,10 +15,14 @@
 
 #include <openssl/ossl_typ.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "yb/encryption/cipher_stream_fwd.h"
 
+#include "yb/gutil/thread_annotations.h"
+
 #include "yb/util/status_fwd.h"
 #include "yb/util/locks.h"
 
@@ -69,9 +73,23 @@ class BlockAccessCipherStream {
   void IncrementCounter(const uint64_t start_idx, uint8_t* iv,
                         EncryptionOverflowWorkaround counter_overflow_workaround);
 
+  struct CipherContextDeleter {
+    void operator()(EVP_CIPHER_CTX* ctx) const;
+  };
+  using CipherContextPtr = std::unique_ptr<EVP_CIPHER_CTX, CipherContextDeleter>;
+
+  // Returns a context with the key already set, so only the IV has to be set for an operation.
+  Result<CipherContextPtr> AcquireContext();
+  void ReleaseContext(CipherContextPtr context);
+
   EncryptionParamsPtr encryption_params_;
-  std::unique_ptr<EVP_CIPHER_CTX, std::function<void(EVP_CIPHER_CTX*)>> encryption_context_;
+  // Context with the cipher and key set, copied to create new contexts. Never used for encryption
+  // directly.
+  CipherContextPtr keyed_context_;
   mutable simple_spinlock mutex_;
+  // Contexts are reused by concurrent operations without locking during encryption, and the key
+  // schedule is not recomputed for every operation.
+  std::vector<CipherContextPtr> free_contexts_ GUARDED_BY(mutex_);
 };
 
 } // namespace encryption
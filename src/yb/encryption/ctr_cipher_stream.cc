@@ -31,16 +31,25 @@ Result<std::unique_ptr<BlockAccessCipherStream>> BlockAccessCipherStream::FromEn
   return stream;
 }
 
+namespace {
+
+// Max number of unused contexts kept by a stream.
+constexpr size_t kMaxFreeContexts = 16;
+
+} // namespace
+
+void BlockAccessCipherStream::CipherContextDeleter::operator()(EVP_CIPHER_CTX* ctx) const {
+  EVP_CIPHER_CTX_cleanup(ctx);
+  EVP_CIPHER_CTX_free(ctx);
+}
+
 BlockAccessCipherStream::BlockAccessCipherStream(
     EncryptionParamsPtr encryption_params) :
     encryption_params_(std::move(encryption_params)),
-    encryption_context_(EVP_CIPHER_CTX_new(), [](EVP_CIPHER_CTX* ctx){
-      EVP_CIPHER_CTX_cleanup(ctx);
-      EVP_CIPHER_CTX_free(ctx);
-    }) {}
+    keyed_context_(EVP_CIPHER_CTX_new()) {}
 
 Status BlockAccessCipherStream::Init() {
-  EVP_CIPHER_CTX_init(encryption_context_.get());
+  EVP_CIPHER_CTX_init(keyed_context_.get());
   const EVP_CIPHER* cipher;
   switch (encryption_params_->key_size) {
     case 16:
@@ -58,7 +67,7 @@ Status BlockAccessCipherStream::Init() {
   }
 
   const auto encrypt_init_ex_result = EVP_EncryptInit_ex(
-      encryption_context_.get(), cipher, /* impl */ nullptr, /* key */ nullptr,
+      keyed_context_.get(), cipher, /* impl */ nullptr, encryption_params_->key,
       /* iv */ nullptr);
   if (encrypt_init_ex_result != 1) {
     return STATUS_FORMAT(InternalError,
@@ -66,7 +75,7 @@ Status BlockAccessCipherStream::Init() {
                          encrypt_init_ex_result);
   }
 
-  const auto set_padding_result = EVP_CIPHER_CTX_set_padding(encryption_context_.get(), 0);
+  const auto set_padding_result = EVP_CIPHER_CTX_set_padding(keyed_context_.get(), 0);
   if (set_padding_result != 1) {
     return STATUS_FORMAT(InternalError,
                          "EVP_CIPHER_CTX_set_padding returned $0",
@@ -76,6 +85,34 @@ Status BlockAccessCipherStream::Init() {
   return Status::OK();
 }
 
+Result<BlockAccessCipherStream::CipherContextPtr> BlockAccessCipherStream::AcquireContext() {
+  {
+    std::lock_guard l(mutex_);
+    if (!free_contexts_.empty()) {
+      auto result = std::move(free_contexts_.back());
+      free_contexts_.pop_back();
+      return result;
+    }
+  }
+
+  CipherContextPtr result(EVP_CIPHER_CTX_new());
+  if (!result) {
+    return STATUS(InternalError, "EVP_CIPHER_CTX_new failed");
+  }
+  const auto copy_result = EVP_CIPHER_CTX_copy(result.get(), keyed_context_.get());
+  if (copy_result != 1) {
+    return STATUS_FORMAT(InternalError, "EVP_CIPHER_CTX_copy returned $0", copy_result);
+  }
+  return result;
+}
+
+void BlockAccessCipherStream::ReleaseContext(CipherContextPtr context) {
+  std::lock_guard l(mutex_);
+  if (free_contexts_.size() < kMaxFreeContexts) {
+    free_contexts_.push_back(std::move(context));
+  }
+}
+
 Status BlockAccessCipherStream::Encrypt(
     uint64_t file_offset,
     const Slice& input,
@@ -149,12 +186,12 @@ Status BlockAccessCipherStream::EncryptByBlock(
   const uint64_t start_index = encryption_params_->counter + block_index;
   IncrementCounter(start_index, iv, counter_overflow_workaround);
 
-  // Lock the encryption op since we modify encryption context.
-  std::lock_guard l(mutex_);
+  // The context is used exclusively by this operation, and already has the key set.
+  auto context = VERIFY_RESULT(AcquireContext());
 
   const int init_result =
-      EVP_EncryptInit_ex(encryption_context_.get(), /* cipher */ nullptr, /* impl */ nullptr,
-                         encryption_params_->key, iv);
+      EVP_EncryptInit_ex(context.get(), /* cipher */ nullptr, /* impl */ nullptr,
+                         /* key */ nullptr, iv);
   if (init_result != 1) {
     return STATUS_FORMAT(InternalError,
                          "EVP_EncryptInit_ex returned $0 when encrypting/decrypting $1 bytes "
@@ -165,7 +202,7 @@ Status BlockAccessCipherStream::EncryptByBlock(
   // Perform the encryption.
   int bytes_updated = 0;
   const int update_result = EVP_EncryptUpdate(
-      encryption_context_.get(), static_cast<uint8_t*>(output), &bytes_updated, input.data(),
+      context.get(), static_cast<uint8_t*>(output), &bytes_updated, input.data(),
       data_size);
   if (update_result != 1) {
     return STATUS_FORMAT(InternalError,
@@ -181,6 +218,7 @@ Status BlockAccessCipherStream::EncryptByBlock(
 
   }
 
+  ReleaseContext(std::move(context));
   return Status::OK();
 }
 
@@ -48,6 +48,22 @@ std::vector<MetricDescriptor> inbound_metrics = {
     .units = "yb::MetricUnit::kMicroseconds",
     .description = "Microseconds spent handling",
   },
+  {
+    .name = "queue_time",
+    .prefix = "service_",
+    .kind = "histogram",
+    .extra_args = ",\n  60000000LU, 2",
+    .units = "yb::MetricUnit::kMicroseconds",
+    .description = "Microseconds spent in service queue by",
+  },
+  {
+    .name = "response_send_time",
+    .prefix = "service_",
+    .kind = "histogram",
+    .extra_args = ",\n  60000000LU, 2",
+    .units = "yb::MetricUnit::kMicroseconds",
+    .description = "Microseconds spent sending responses to",
+  },
 };
 
 } // namespace
@@ -67,6 +67,7 @@
 
 #include "yb/util/backoff_waiter.h"
 #include "yb/util/compare_util.h"
+#include "yb/util/countdown_latch.h"
 #include "yb/util/enums.h"
 #include "yb/util/metrics.h"
 #include "yb/util/monotime.h"
@@ -77,6 +78,7 @@
 #include "yb/util/status_format.h"
 #include "yb/util/strongly_typed_bool.h"
 #include "yb/util/sync_point.h"
+#include "yb/util/test_thread_holder.h"
 #include "yb/util/test_util.h"
 #include "yb/util/threadpool.h"
 #include "yb/util/tsan_util.h"
@@ -106,6 +108,9 @@ DECLARE_bool(TEST_disable_adding_last_compaction_to_tablet_metadata);
 DECLARE_int32(full_compaction_pool_max_queue_size);
 DECLARE_int32(full_compaction_pool_max_threads);
 DECLARE_bool(enable_load_balancing);
+DECLARE_uint64(full_compaction_input_size_limit_per_job_bytes);
+
+METRIC_DECLARE_gauge_uint32(full_compaction_progress_percent);
 
 namespace yb {
 
@@ -173,6 +178,32 @@ class RocksDbListener : public rocksdb::EventListener {
   CountByDbMap num_flushes_completed_ GUARDED_BY(mutex_);
 };
 
+// Blocks the first completed compaction until resumed, so the test could interrupt the rest of
+// the manual compaction.
+class PausingCompactionListener : public rocksdb::EventListener {
+ public:
+  void OnCompactionCompleted(rocksdb::DB*, const rocksdb::CompactionJobInfo&) override {
+    if (paused_.count() == 0) {
+      return;
+    }
+    paused_.CountDown();
+    resumed_.Wait();
+  }
+
+  Status WaitPaused(MonoDelta timeout) {
+    return paused_.WaitFor(timeout)
+        ? Status::OK() : STATUS(TimedOut, "Compaction has not been paused");
+  }
+
+  void Resume() {
+    resumed_.CountDown();
+  }
+
+ private:
+  CountDownLatch paused_{1};
+  CountDownLatch resumed_{1};
+};
+
 } // namespace
 
 class CompactionTest : public YBTest {
@@ -493,6 +524,77 @@ TEST_F(CompactionTest, ManualCompactionProducesOneFilePerDb) {
   }
 }
 
+TEST_F(CompactionTest, IncrementalFullCompactionResumesAfterRestart) {
+  constexpr size_t kNumFiles = 5;
+  auto pausing_listener = std::make_shared<PausingCompactionListener>();
+  ANNOTATE_IGNORE_WRITES_BEGIN();
+  cluster_->GetTabletManager(0)->TEST_tablet_options()->listeners.push_back(pausing_listener);
+  ANNOTATE_IGNORE_WRITES_END();
+
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_rocksdb_level0_file_num_compaction_trigger) = -1;
+  SetupWorkload(IsolationLevel::NON_TRANSACTIONAL, /* num_tablets = */ 1);
+  ASSERT_OK(WriteAtLeastFilesPerDb(kNumFiles));
+  const auto table_info = ASSERT_RESULT(FindTable(cluster_.get(), workload_->table_name()));
+
+  // Every step of the incremental full compaction picks a single file.
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_full_compaction_input_size_limit_per_job_bytes) = 1;
+
+  auto peers = cluster_->GetTabletManager(0)->GetTabletPeersWithTableId(table_info->id());
+  ASSERT_EQ(peers.size(), 1U);
+  const auto tablet_id = peers[0]->tablet_id();
+  auto tablet = ASSERT_RESULT(peers[0]->shared_tablet_safe());
+  peers.clear();
+  ASSERT_OK(tablet->TriggerManualCompactionIfNeeded(
+      rocksdb::CompactionReason::kManualCompaction));
+  ASSERT_OK(pausing_listener->WaitPaused(30s * kTimeMultiplier));
+
+  // The first step is done, the rest of the input is still pending.
+  const auto file_number_upper_bound =
+      tablet->metadata()->full_compaction_file_number_upper_bound();
+  ASSERT_NE(file_number_upper_bound, 0U);
+  ASSERT_GT(tablet->metadata()->full_compaction_input_size(), 0U);
+
+  // Interrupt the compaction by restarting the tablet server. RocksDB shutdown is requested before
+  // the full compaction task is waited for, so the remaining steps are aborted once released.
+  auto* ts = cluster_->mini_tablet_server(0);
+  TestThreadHolder thread_holder;
+  thread_holder.AddThreadFunctor([ts] {
+    ts->Shutdown();
+  });
+  ASSERT_OK(LoggedWaitFor(
+      [&tablet] { return tablet->IsShutdownRequested(); }, 30s * kTimeMultiplier,
+      "Waiting for tablet shutdown to start ...", kWaitDelay));
+  SleepFor(100ms * kTimeMultiplier);
+  pausing_listener->Resume();
+  thread_holder.JoinAll();
+  ASSERT_EQ(tablet->metadata()->full_compaction_file_number_upper_bound(),
+            file_number_upper_bound);
+  tablet.reset();
+
+  ASSERT_OK(ts->Start());
+  auto peer = ASSERT_RESULT(cluster_->GetTabletManager(0)->GetServingTablet(tablet_id));
+  tablet = ASSERT_RESULT(peer->shared_tablet_safe());
+
+  // The resumed compaction clears the stored progress once all steps are completed.
+  ASSERT_OK(LoggedWaitFor(
+      [&tablet] { return tablet->metadata()->full_compaction_file_number_upper_bound() == 0; },
+      60s * kTimeMultiplier, "Waiting for interrupted full compaction to resume ...",
+      kWaitDelay));
+  auto progress = METRIC_full_compaction_progress_percent.Instantiate(
+      tablet->GetTabletMetricsEntity(), 0);
+  ASSERT_EQ(progress->value(), 100U);
+
+  // Only files below the stored upper bound were compacted, one per step, i.e. no new full
+  // compaction was started.
+  auto files = tablet->regular_db()->GetLiveFilesMetaData();
+  ASSERT_GT(files.size(), 1U);
+  for (const auto& file : files) {
+    ASSERT_GE(file.name_id, file_number_upper_bound);
+  }
+
+  ASSERT_OK(ReadAtLeastRowsOk(100));
+}
+
 void CompactionTest::TestCompactionTaskMetrics(const int num_files, bool manual_compaction) {
   // Create and instantiate metric entity.
   METRIC_DEFINE_entity(test_entity);
@@ -3646,6 +3646,82 @@ TEST_F(RaftConsensusITest, CatchupAfterLeaderRestarted) {
   ASSERT_OK(WaitForServersToAgree(60s, tablet_servers_, tablet_id_, kNumOps));
 }
 
+// Followers should elect a new leader right after the tablet server of the current leader is
+// restarted, without waiting for the missed heartbeats. Restarts must not cause extra elections.
+TEST_F(RaftConsensusITest, FastFailoverOnLeaderRestart) {
+  constexpr auto kHeartbeatIntervalMs = 500;
+  constexpr auto kMissedHeartbeatPeriods = 120;
+  const auto kTimeout = 30s * kTimeMultiplier;
+  ASSERT_NO_FATALS(BuildAndStart({
+    Format("--raft_heartbeat_interval_ms=$0", kHeartbeatIntervalMs),
+    Format("--leader_failure_max_missed_heartbeat_periods=$0", kMissedHeartbeatPeriods),
+    "--raft_fast_failover_on_peer_crash=true",
+  }));
+  ASSERT_OK(WaitForServersToAgree(kTimeout, tablet_servers_, tablet_id_, 1));
+
+  auto get_cstate = [this, kTimeout](const std::string& uuid) {
+    consensus::ConsensusStatePB cstate;
+    CHECK_OK(itest::GetConsensusState(
+        tablet_servers_[uuid].get(), tablet_id_, consensus::CONSENSUS_CONFIG_ACTIVE, kTimeout,
+        &cstate));
+    return cstate;
+  };
+  auto check_term = [this, &get_cstate](int64_t term) {
+    for (const auto& [uuid, _] : tablet_servers_) {
+      if (cluster_->tablet_server_by_uuid(uuid)->IsProcessAlive()) {
+        ASSERT_EQ(term, get_cstate(uuid).current_term()) << uuid;
+      }
+    }
+  };
+
+  TServerDetails* leader;
+  ASSERT_OK(GetLeaderReplicaWithRetries(tablet_id_, &leader));
+  const auto old_leader_uuid = leader->uuid();
+  const auto old_term = get_cstate(old_leader_uuid).current_term();
+  std::vector<std::string> followers;
+  for (const auto& [uuid, _] : tablet_servers_) {
+    if (uuid != old_leader_uuid) {
+      followers.push_back(uuid);
+    }
+  }
+
+  // Without the restart notification followers would wait for the missed heartbeats.
+  auto start = MonoTime::Now();
+  auto* old_leader_ts = cluster_->tablet_server_by_uuid(old_leader_uuid);
+  old_leader_ts->Shutdown();
+  ASSERT_OK(old_leader_ts->Restart());
+  int64_t new_term = 0;
+  ASSERT_OK(LoggedWaitFor([&]() -> Result<bool> {
+    for (const auto& uuid : followers) {
+      auto cstate = get_cstate(uuid);
+      if (cstate.current_term() > old_term && !cstate.leader_uuid().empty()) {
+        new_term = cstate.current_term();
+        return true;
+      }
+    }
+    return false;
+  }, kTimeout, "New leader elected"));
+  auto failover_time = MonoTime::Now() - start;
+  LOG(INFO) << "Failover time: " << failover_time;
+  ASSERT_LT(failover_time, MonoDelta::FromMilliseconds(
+      kHeartbeatIntervalMs * kMissedHeartbeatPeriods / 2));
+
+  // The restarted leader keeps heartbeating the master, so there should be no more elections.
+  ASSERT_OK(WaitForServersToAgree(kTimeout, tablet_servers_, tablet_id_, 1));
+  SleepFor(5s * kTimeMultiplier);
+  ASSERT_NO_FATALS(check_term(new_term));
+
+  // Restarting a follower should not cause elections.
+  ASSERT_OK(GetLeaderReplicaWithRetries(tablet_id_, &leader));
+  const auto& follower_uuid = leader->uuid() == followers[0] ? followers[1] : followers[0];
+  auto* follower_ts = cluster_->tablet_server_by_uuid(follower_uuid);
+  follower_ts->Shutdown();
+  ASSERT_OK(follower_ts->Restart());
+  ASSERT_OK(WaitForServersToAgree(kTimeout, tablet_servers_, tablet_id_, 1));
+  SleepFor(5s * kTimeMultiplier);
+  ASSERT_NO_FATALS(check_term(new_term));
+}
+
 // Test old leader ts-1 has operations not majority replicated and crashed.
 // ts-2 becomes the new leader, but before NO_OP replicated on ts-3, it serves a read,
 // and advanced the safe time lower bound.
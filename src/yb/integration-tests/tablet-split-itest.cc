@@ -143,6 +143,7 @@ DECLARE_uint64(outstanding_tablet_split_limit);
 DECLARE_uint64(outstanding_tablet_split_limit_per_tserver);
 DECLARE_double(TEST_fail_tablet_split_probability);
 DECLARE_bool(TEST_skip_post_split_compaction);
+DECLARE_bool(enable_post_split_compaction);
 DECLARE_int32(TEST_nodes_per_cloud);
 DECLARE_int32(replication_factor);
 DECLARE_int32(txn_max_apply_batch_records);
@@ -165,6 +166,9 @@ DECLARE_bool(TEST_asyncrpc_finished_set_timedout);
 DECLARE_bool(enable_copy_retryable_requests_from_parent);
 DECLARE_bool(enable_flush_retryable_requests);
 DECLARE_int32(max_create_tablets_per_ts);
+DECLARE_bool(batch_apply_transaction_requests);
+
+METRIC_DECLARE_histogram(handler_latency_yb_tserver_TabletServerService_ApplyTransactions);
 
 namespace yb {
 
@@ -233,6 +237,28 @@ TEST_F(TabletSplitITest, SplitTabletIsAsync) {
   ASSERT_OK(WaitForTestTableTabletPeersPostSplitCompacted(15s * kTimeMultiplier));
 }
 
+TEST_F(TabletSplitITest, SplitWithoutPostSplitCompaction) {
+  constexpr auto kNumRows = kDefaultNumRows;
+
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_enable_post_split_compaction) = false;
+
+  ASSERT_OK(CreateSingleTabletAndSplit(kNumRows));
+
+  // Child tablets keep sharing files of the parent tablet.
+  std::this_thread::sleep_for(1s * kTimeMultiplier);
+  for (auto peer : ASSERT_RESULT(ListTestTableActiveTabletPeers())) {
+    EXPECT_FALSE(peer->tablet()->metadata()->parent_data_compacted());
+  }
+  ASSERT_OK(CheckRowsCount(kNumRows));
+
+  // Keys outside of the key bounds are dropped by any compaction of the child tablet.
+  for (auto peer : ASSERT_RESULT(ListTestTableActiveTabletPeers())) {
+    ASSERT_OK(peer->shared_tablet()->ForceManualRocksDBCompact());
+  }
+  ASSERT_OK(WaitForTestTableTabletPeersPostSplitCompacted(15s * kTimeMultiplier));
+  ASSERT_OK(CheckRowsCount(kNumRows));
+}
+
 TEST_F(TabletSplitITest, ParentTabletCleanup) {
   constexpr auto kNumRows = kDefaultNumRows;
 
@@ -2320,6 +2346,54 @@ TEST_F(TabletSplitSingleServerITest, TabletServerOrphanedPostSplitData) {
   }
 }
 
+// Checks that batched apply of a transaction fails for a tablet that was split after the
+// transaction wrote to it, and falls back to the per tablet path that applies it at the children.
+TEST_F(TabletSplitSingleServerITest, BatchedApplyAfterSplit) {
+  constexpr auto kNumRows = kDefaultNumRows;
+  constexpr auto kNumTxnRows = 100;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_batch_apply_transaction_requests) = true;
+
+  CreateSingleTablet();
+  client::TableHandle table2;
+  client::kv_table_test::CreateTable(
+      client::Transactional::kTrue, 1 /* num_tablets */, client_.get(), &table2,
+      client::YBTableName(YQL_DATABASE_CQL, client::kTableName.namespace_name(), "table2"));
+
+  // Single tablet transactions are applied through the per tablet path, so meta cache of the
+  // coordinator learns leaders of both tablets.
+  const auto split_hash_code = ASSERT_RESULT(WriteRowsAndGetMiddleHashCode(kNumRows));
+  ASSERT_OK(WriteRows(&table2, kNumRows, 1));
+
+  auto txn = CreateTransaction();
+  auto session = CreateSession(txn);
+  for (int32_t key = kNumRows + 1; key <= kNumRows + kNumTxnRows; ++key) {
+    for (auto* table : {&table_, &table2}) {
+      ASSERT_OK(client::kv_table_test::WriteRow(
+          table, session, key, key, client::WriteOpType::INSERT, client::Flush::kFalse));
+    }
+  }
+  ASSERT_OK(session->TEST_Flush());
+
+  SetAtomicFlag(true, &FLAGS_TEST_skip_deleting_split_tablets);
+  ASSERT_OK(SplitSingleTablet(split_hash_code));
+  ASSERT_OK(WaitForTabletSplitCompletion(
+      /* expected_non_split_tablets =*/ 2, /* expected_split_tablets = */ 1));
+
+  const auto& metric_entity = cluster_->mini_tablet_server(0)->server()->metric_entity();
+  auto apply_rpcs = METRIC_handler_latency_yb_tserver_TabletServerService_ApplyTransactions
+      .Instantiate(metric_entity);
+  const auto apply_rpcs_before = apply_rpcs->TotalCount();
+
+  ASSERT_OK(txn->CommitFuture().get());
+  ASSERT_OK(WaitForTestTableIntentsApplied());
+  ASSERT_OK(WaitForTableIntentsApplied(cluster_.get(), table2->id()));
+  ASSERT_GT(apply_rpcs->TotalCount(), apply_rpcs_before);
+
+  ASSERT_OK(CheckRowsCount(kNumRows + kNumTxnRows));
+  const auto rows_count = ASSERT_RESULT(CountRows(NewSession(), table2));
+  ASSERT_EQ(rows_count, kNumRows + kNumTxnRows);
+}
+
 TEST_F(TabletSplitSingleServerITest, TabletServerSplitAlreadySplitTablet) {
   constexpr auto kNumRows = 2000;
 
@@ -710,39 +710,44 @@ AsyncCreateReplica::AsyncCreateReplica(Master *master,
                                        ThreadPool *callback_pool,
                                        const string& permanent_uuid,
                                        const scoped_refptr<TabletInfo>& tablet,
+                                       const tserver::CreateTabletRequestPB& table_req,
                                        const std::vector<SnapshotScheduleId>& snapshot_schedules,
                                        LeaderEpoch epoch)
   : RetrySpecificTSRpcTaskWithTable(master, callback_pool, permanent_uuid, tablet->table(),
                            std::move(epoch), /* async_task_throttler */ nullptr),
-    tablet_id_(tablet->tablet_id()) {
+    tablet_id_(tablet->tablet_id()),
+    req_(table_req) {
   deadline_ = start_timestamp_;
   deadline_.AddDelta(MonoDelta::FromMilliseconds(FLAGS_tablet_creation_timeout_ms));
 
-  auto table_lock = tablet->table()->LockForRead();
   const SysTabletsEntryPB& tablet_pb = tablet->metadata().dirty().pb;
 
   req_.set_dest_uuid(permanent_uuid);
-  req_.set_table_id(tablet->table()->id());
   req_.set_tablet_id(tablet->tablet_id());
-  req_.set_table_type(tablet->table()->metadata().state().pb.table_type());
   req_.mutable_partition()->CopyFrom(tablet_pb.partition());
-  req_.set_namespace_id(table_lock->pb.namespace_id());
-  req_.set_namespace_name(table_lock->pb.namespace_name());
-  req_.set_table_name(table_lock->pb.name());
-  req_.mutable_schema()->CopyFrom(table_lock->pb.schema());
-  req_.mutable_partition_schema()->CopyFrom(table_lock->pb.partition_schema());
   req_.mutable_config()->CopyFrom(tablet_pb.committed_consensus_state().config());
   req_.set_colocated(tablet_pb.colocated());
-  if (table_lock->pb.has_index_info()) {
-    req_.mutable_index_info()->CopyFrom(table_lock->pb.index_info());
-  }
   auto& req_schedules = *req_.mutable_snapshot_schedules();
   req_schedules.Reserve(narrow_cast<int>(snapshot_schedules.size()));
   for (const auto& id : snapshot_schedules) {
     req_schedules.Add()->assign(id.AsSlice().cdata(), id.size());
   }
+}
 
-  req_.mutable_hosted_stateful_services()->CopyFrom(table_lock->pb.hosted_stateful_services());
+void AsyncCreateReplica::FillTableFields(
+    const TableInfo& table, tserver::CreateTabletRequestPB* req) {
+  auto table_lock = table.LockForRead();
+  req->set_table_id(table.id());
+  req->set_table_type(table_lock->pb.table_type());
+  req->set_namespace_id(table_lock->pb.namespace_id());
+  req->set_namespace_name(table_lock->pb.namespace_name());
+  req->set_table_name(table_lock->pb.name());
+  req->mutable_schema()->CopyFrom(table_lock->pb.schema());
+  req->mutable_partition_schema()->CopyFrom(table_lock->pb.partition_schema());
+  if (table_lock->pb.has_index_info()) {
+    req->mutable_index_info()->CopyFrom(table_lock->pb.index_info());
+  }
+  req->mutable_hosted_stateful_services()->CopyFrom(table_lock->pb.hosted_stateful_services());
 }
 
 std::string AsyncCreateReplica::description() const {
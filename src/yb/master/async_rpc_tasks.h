@@ -409,13 +409,19 @@ class AsyncTabletLeaderTask : public RetryingTSRpcTaskWithTable {
 // consensus configuration information has been filled into the 'dirty' data.
 class AsyncCreateReplica : public RetrySpecificTSRpcTaskWithTable {
  public:
+  // table_req should contain the table level fields of the request, filled by FillTableFields.
   AsyncCreateReplica(Master *master,
                      ThreadPool *callback_pool,
                      const std::string& permanent_uuid,
                      const scoped_refptr<TabletInfo>& tablet,
+                     const tserver::CreateTabletRequestPB& table_req,
                      const std::vector<SnapshotScheduleId>& snapshot_schedules,
                      LeaderEpoch epoch);
 
+  // Fills the fields of the request that are the same for all tablets of the table, so they could
+  // be filled once for all replicas of a newly created table.
+  static void FillTableFields(const TableInfo& table, tserver::CreateTabletRequestPB* req);
+
   server::MonitoredTaskType type() const override {
     return server::MonitoredTaskType::kCreateReplica;
   }
@@ -135,6 +135,8 @@ struct TabletReplicaDriveInfo {
   uint64 wal_files_size = 0;
   uint64 uncompressed_sst_file_size = 0;
   bool may_have_orphaned_post_split_data = true;
+  uint64 key_accesses_per_sec = 0;
+  bool is_hot = false;
 };
 
 struct FullCompactionStatus {
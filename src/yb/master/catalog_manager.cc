@@ -476,6 +476,11 @@ DEFINE_RUNTIME_int64(tablet_force_split_threshold_bytes, 100_GB,
     "tablets from forming in your cluster even if both automatic splitting phases have "
     "been finished.");
 
+DEFINE_RUNTIME_bool(enable_load_based_tablet_splitting, true,
+    "Whether to split tablets reported as hot by their leaders regardless of their size. Hot "
+    "tablets are split at the median of accessed keys. "
+    "See tablet_hot_key_accesses_per_sec_threshold.");
+
 DEFINE_test_flag(bool, crash_server_on_sys_catalog_leader_affinity_move, false,
                  "When set, crash the master process if it performs a sys catalog leader affinity "
                  "move.");
@@ -2880,6 +2885,11 @@ Status CatalogManager::ShouldSplitValidCandidate(
     return STATUS_FORMAT(IllegalState, "Tablet $0 may have uncompacted post-split data.",
         tablet_info.id());
   }
+  if (FLAGS_enable_load_based_tablet_splitting && drive_info.is_hot) {
+    VLOG(1) << Format("Tablet $0 is hot ($1 accesses per second), splitting regardless of size",
+                      tablet_info.id(), drive_info.key_accesses_per_sec);
+    return Status::OK();
+  }
   ssize_t size = drive_info.sst_files_size;
   DCHECK(size >= 0) << "Detected overflow in casting sst_files_size to signed int.";
   if (size < FLAGS_tablet_split_low_phase_size_threshold_bytes) {
@@ -6518,7 +6528,7 @@ void CatalogManager::CleanUpDeletedTables(const LeaderEpoch& epoch) {
   // Going through all tables under the global lock, copying them to not hold lock for too long.
   std::vector<scoped_refptr<TableInfo>> tables;
   {
-    LockGuard lock(mutex_);
+    SharedLock lock(mutex_);
     for (const auto& table : tables_->GetAllTables()) {
       tables.push_back(table);
     }
@@ -7001,6 +7011,8 @@ Status CatalogManager::AlterTable(const AlterTableRequestPB* req,
           namespace_id, table_name);
     LockGuard lock(mutex_);
     table_names_map_.erase({namespace_id, table_name});
+    // Commit tables map to increment its version, so vtable caches pick up the new name.
+    tables_.Commit();
   }
 
   // Update a task to rollback alter if the corresponding YSQL transaction
@@ -7921,13 +7933,16 @@ bool CatalogManager::ProcessCommittedConsensusState(
     // replica is reporting the same consensus configuration we already know about, but we
     // haven't yet heard from all the tservers in the config, update the in-memory
     // ReplicaLocations.
-    LOG(INFO) << "Tablet server " << ts_desc->permanent_uuid() << " sent "
-              << (is_incremental ? "incremental" : "full tablet")
-              << " report for " << tablet->tablet_id()
-              << ", prev state op id: " << prev_cstate.config().opid_index()
-              << ", prev state term: " << prev_cstate.current_term()
-              << ", prev state has_leader_uuid: " << prev_cstate.has_leader_uuid()
-              << ". Consensus state: " << cstate.ShortDebugString();
+    // Full reports, e.g. after a master failover, contain all tablets of the tserver, and
+    // logging every unchanged tablet of them slows down processing of the reports.
+    LOG_IF(INFO, is_incremental || VLOG_IS_ON(1))
+        << "Tablet server " << ts_desc->permanent_uuid() << " sent "
+        << (is_incremental ? "incremental" : "full tablet")
+        << " report for " << tablet->tablet_id()
+        << ", prev state op id: " << prev_cstate.config().opid_index()
+        << ", prev state term: " << prev_cstate.current_term()
+        << ", prev state has_leader_uuid: " << prev_cstate.has_leader_uuid()
+        << ". Consensus state: " << cstate.ShortDebugString();
     if (GetAtomicFlag(&FLAGS_enable_register_ts_from_raft) &&
         ReplicaMapDiffersFromConsensusState(tablet, cstate)) {
       LOG(INFO) << Format("Tablet replica map differs from reported consensus state. Replica map: "
@@ -8067,8 +8082,8 @@ Status CatalogManager::ProcessTabletReportBatch(
 
   map<TabletId, TabletInfo::WriteLock> tablet_write_locks;
   // Second Pass.
-  // Process each tablet. The list is sorted by ID. This may not be in the order that the tablets
-  // appear in 'full_report', but that has no bearing on correctness.
+  // Process each tablet. The list is sorted by table ID and tablet ID. This may not be in the order
+  // that the tablets appear in 'full_report', but that has no bearing on correctness.
   vector<TabletInfo*> mutated_tablets; // refcount protected by ReportedTablet::info
   std::unordered_map<TableId, std::set<TabletId>> new_running_tablets;
   vector<TableInfo*> mutated_tables;  // refcount protected by 'table_info_map'
@@ -8356,8 +8371,13 @@ Status CatalogManager::ProcessTabletReport(TSDescriptor* ts_desc,
     }
   }
 
+  // Group tablets of the same table, so a batch locks as few tables as possible and reports of
+  // other tservers for other tables are not blocked by it.
   std::sort(reported_tablets.begin(), reported_tablets.end(), [](const auto& lhs, const auto& rhs) {
-    return lhs.tablet_id < rhs.tablet_id;
+    const auto& lhs_table_id = lhs.info->table()->id();
+    const auto& rhs_table_id = rhs.info->table()->id();
+    return lhs_table_id != rhs_table_id ? lhs_table_id < rhs_table_id
+                                        : lhs.tablet_id < rhs.tablet_id;
   });
 
   // Process any delete requests from orphaned tablets, identified above.
@@ -8461,7 +8481,7 @@ Status CatalogManager::CreateTablegroup(
   TableId parent_table_id;
   TableName parent_table_name;
   {
-    LockGuard lock(mutex_);
+    SharedLock lock(mutex_);
     scoped_refptr<NamespaceInfo> ns = FindPtrOrNull(namespace_ids_map_, req->namespace_id());
     if (ns == nullptr) {
       Status s = STATUS_SUBSTITUTE(
@@ -8854,7 +8874,7 @@ void CatalogManager::ProcessPendingNamespace(
 
   scoped_refptr<NamespaceInfo> ns;
   {
-    LockGuard lock(mutex_);
+    SharedLock lock(mutex_);
     ns = FindPtrOrNull(namespace_ids_map_, id);
   }
   if (ns == nullptr) {
@@ -9596,7 +9616,7 @@ Status CatalogManager::GetNamespaceInfo(const GetNamespaceInfoRequestPB* req,
   resp->mutable_namespace_()->set_database_type(ns->database_type());
   resp->set_colocated(ns->colocated());
   if (ns->colocated()) {
-    LockGuard lock(mutex_);
+    SharedLock lock(mutex_);
     resp->set_legacy_colocated_database(colocated_db_tablets_map_.find(ns->id())
                                         != colocated_db_tablets_map_.end());
   }
@@ -9760,8 +9780,9 @@ Status CatalogManager::DeleteUDType(const DeleteUDTypeRequestPB* req,
     ns = VERIFY_NAMESPACE_FOUND(FindNamespace(req->type().namespace_()), resp);
   }
 
+  std::vector<TableInfoPtr> tables;
   {
-    LockGuard lock(mutex_);
+    SharedLock lock(mutex_);
     TRACE("Acquired catalog manager lock");
 
     if (req->type().has_type_id()) {
@@ -9775,29 +9796,9 @@ Status CatalogManager::DeleteUDType(const DeleteUDTypeRequestPB* req,
       return SetupError(resp->mutable_error(), MasterErrorPB::TYPE_NOT_FOUND, s);
     }
 
-    // Checking if any table uses this type.
-    // TODO: this could be more efficient.
+    // Copy the tables to check their schemas without holding the catalog manager lock.
     for (const auto& table : tables_->GetAllTables()) {
-      auto ltm = table->LockForRead();
-      if (!ltm->started_deleting()) {
-        for (const auto &col : ltm->schema().columns()) {
-          const Status tp_is_not_used = IterateAndDoForUDT(
-              col.type(),
-              [&tp](const QLTypePB::UDTypeInfo& udtype_info) -> Status {
-                return udtype_info.id() == tp->id()
-                    ? STATUS(QLError, Substitute("Used type $0 id $1", tp->name(), tp->id()))
-                    : Status::OK();
-              });
-
-          if (!tp_is_not_used.ok()) {
-            Status s = STATUS(QLError,
-                Substitute("Cannot delete type '$0.$1'. It is used in column $2 of table $3",
-                    ns->name(), tp->name(), col.name(), ltm->name()));
-            LOG_WITH_FUNC(WARNING) << s << ": " << tp_is_not_used;
-            return SetupError(resp->mutable_error(), MasterErrorPB::INVALID_REQUEST, s);
-          }
-        }
-      }
+      tables.push_back(table);
     }
 
     // Checking if any other type uses this type (i.e. in the case of nested types).
@@ -9820,6 +9821,31 @@ Status CatalogManager::DeleteUDType(const DeleteUDTypeRequestPB* req,
     }
   }
 
+  // Checking if any table uses this type.
+  // TODO: this could be more efficient.
+  for (const auto& table : tables) {
+    auto ltm = table->LockForRead();
+    if (!ltm->started_deleting()) {
+      for (const auto &col : ltm->schema().columns()) {
+        const Status tp_is_not_used = IterateAndDoForUDT(
+            col.type(),
+            [&tp](const QLTypePB::UDTypeInfo& udtype_info) -> Status {
+              return udtype_info.id() == tp->id()
+                  ? STATUS(QLError, Substitute("Used type $0 id $1", tp->name(), tp->id()))
+                  : Status::OK();
+            });
+
+        if (!tp_is_not_used.ok()) {
+          Status s = STATUS(QLError,
+              Substitute("Cannot delete type '$0.$1'. It is used in column $2 of table $3",
+                  ns->name(), tp->name(), col.name(), ltm->name()));
+          LOG_WITH_FUNC(WARNING) << s << ": " << tp_is_not_used;
+          return SetupError(resp->mutable_error(), MasterErrorPB::INVALID_REQUEST, s);
+        }
+      }
+    }
+  }
+
   auto l = tp->LockForWrite();
 
   Status s = sys_catalog_->Delete(leader_ready_term(), tp);
@@ -11196,7 +11222,7 @@ Status CatalogManager::ProcessPendingAssignmentsPerTable(
     // NOTE: if we fail to select replicas on the first pass (due to
     // insufficient Tablet Servers being online), we will still try
     // again unless the tablet/table creation is cancelled.
-    LOG(INFO) << "Selecting replicas for tablet " << tablet->id();
+    VLOG(1) << "Selecting replicas for tablet " << tablet->id();
     s = SelectReplicasForTablet(ts_descs, tablet, &table_load_state, global_load_state);
     if (!s.ok()) {
       s = s.CloneAndPrepend(Substitute(
@@ -11486,9 +11512,17 @@ Status CatalogManager::SendCreateTabletRequests(
     const vector<TabletInfo*>& tablets, const LeaderEpoch& epoch) {
   auto schedules_to_tablets_map =
       VERIFY_RESULT(MakeSnapshotSchedulesToObjectIdsMap(SysRowEntryType::TABLET));
+  // Table level fields of the requests, so schema is copied once per table instead of once per
+  // replica.
+  std::unordered_map<const TableInfo*, tserver::CreateTabletRequestPB> table_requests;
   for (TabletInfo* tablet : tablets) {
     const consensus::RaftConfigPB& config =
         tablet->metadata().dirty().pb.committed_consensus_state().config();
+    auto table = tablet->table();
+    auto [table_req_it, inserted] = table_requests.try_emplace(table.get());
+    if (inserted) {
+      AsyncCreateReplica::FillTableFields(*table, &table_req_it->second);
+    }
     tablet->set_last_update_time(MonoTime::Now());
     std::vector<SnapshotScheduleId> schedules;
     for (const auto& pair : schedules_to_tablets_map) {
@@ -11498,8 +11532,9 @@ Status CatalogManager::SendCreateTabletRequests(
     }
     for (const RaftPeerPB& peer : config.peers()) {
       auto task = std::make_shared<AsyncCreateReplica>(
-          master_, AsyncTaskPool(), peer.permanent_uuid(), tablet, schedules, epoch);
-      tablet->table()->AddTask(task);
+          master_, AsyncTaskPool(), peer.permanent_uuid(), tablet, table_req_it->second, schedules,
+          epoch);
+      table->AddTask(task);
       WARN_NOT_OK(ScheduleTask(task), "Failed to send new tablet request");
     }
   }
@@ -12942,7 +12977,9 @@ void CatalogManager::ProcessTabletMetadata(
         storage_metadata.sst_file_size(),
         storage_metadata.wal_file_size(),
         storage_metadata.uncompressed_sst_file_size(),
-        storage_metadata.may_have_orphaned_post_split_data()};
+        storage_metadata.may_have_orphaned_post_split_data(),
+        storage_metadata.key_accesses_per_sec(),
+        storage_metadata.is_hot()};
   tablet->UpdateReplicaInfo(ts_uuid, drive_info, leader_lease_info);
 }
 
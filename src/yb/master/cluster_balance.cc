@@ -74,6 +74,18 @@ DEFINE_RUNTIME_int32(load_balancer_max_over_replicated_tablets, 1,
 DEFINE_RUNTIME_int32(load_balancer_max_concurrent_adds, 1,
     "Maximum number of tablet peer replicas to add in any one run of the load balancer.");
 
+DEFINE_RUNTIME_int32(load_balancer_bulk_seed_max_concurrent_adds, 5,
+    "Maximum number of tablet peer replicas to add in any one run of the load balancer, and to "
+    "have over-replicated at once, while some tablet server runs fewer than "
+    "load_balancer_bulk_seed_load_fraction of the average number of tablets, e.g. right after "
+    "it was added to the cluster. This lets a new tablet server be seeded from many source "
+    "replicas in parallel. Remote bootstrap limits still apply. Has no effect when not greater "
+    "than load_balancer_max_concurrent_adds.");
+
+DEFINE_RUNTIME_double(load_balancer_bulk_seed_load_fraction, 0.5,
+    "Fraction of the average number of running tablets per tablet server, below which a tablet "
+    "server is seeded using load_balancer_bulk_seed_max_concurrent_adds.");
+
 DEFINE_RUNTIME_int32(load_balancer_max_concurrent_removals, 1,
     "Maximum number of over-replicated tablet peer removals to do in any one run of the "
     "load balancer.");
@@ -127,6 +139,10 @@ DEFINE_RUNTIME_bool(load_balancer_drive_aware, true,
 DEFINE_RUNTIME_bool(load_balancer_ignore_cloud_info_similarity, false,
     "If true, ignore the similarity between cloud infos when deciding which tablet to move");
 
+DEFINE_RUNTIME_bool(load_balancer_use_key_access_rates, true,
+    "If true, among the tablets that could equally be moved between two tablet servers, LB "
+    "prefers the tablet whose key access rate best evens out the access rates of the servers.");
+
 METRIC_DEFINE_gauge_int64(cluster,
                           is_load_balancing_enabled,
                           "Is Load Balancing Enabled",
@@ -478,6 +494,17 @@ void ClusterLoadBalancer::RunLoadBalancerWithOptions(Options* options) {
 
   VLOG(1) << "Global state after analyzing all tablets: " << global_state_->ToString();
 
+  const auto bulk_seed_max_adds = FLAGS_load_balancer_bulk_seed_max_concurrent_adds;
+  if (bulk_seed_max_adds > options->kMaxConcurrentAdds &&
+      global_state_->HasUnderloadedServer(FLAGS_load_balancer_bulk_seed_load_fraction)) {
+    global_state_->bulk_seeding_ = true;
+    remaining_adds = bulk_seed_max_adds;
+    set_remaining(pending_add_replica_tasks, &remaining_adds);
+    YB_LOG_EVERY_N_SECS_OR_VLOG(INFO, 30, 1)
+        << "Seeding underloaded tablet server, allowing up to " << bulk_seed_max_adds
+        << " concurrent adds";
+  }
+
   bool task_added = false;
 
   // Iterate over all the tables to take actions based on the data collected on the previous loop.
@@ -893,13 +920,17 @@ Result<bool> ClusterLoadBalancer::HandleAddReplicas(
     }
   }
 
+  auto max_over_replicated_tablets = state_->options_->kMaxOverReplicatedTablets;
+  if (global_state_->bulk_seeding_) {
+    max_over_replicated_tablets = std::max(
+        max_over_replicated_tablets, FLAGS_load_balancer_bulk_seed_max_concurrent_adds);
+  }
   if (state_->options_->kAllowLimitOverReplicatedTablets &&
-      get_total_over_replication() >=
-          implicit_cast<size_t>(state_->options_->kMaxOverReplicatedTablets)) {
+      get_total_over_replication() >= implicit_cast<size_t>(max_over_replicated_tablets)) {
     return STATUS_SUBSTITUTE(TryAgain,
         "Cannot add replicas. Currently have a total overreplication of $0, when max allowed is $1"
         ", overreplicated tablets: $2",
-        get_total_over_replication(), state_->options_->kMaxOverReplicatedTablets,
+        get_total_over_replication(), max_over_replicated_tablets,
         boost::algorithm::join(state_->tablets_over_replicated_, ", "));
   }
 
@@ -1058,9 +1089,37 @@ Result<bool> ClusterLoadBalancer::GetTabletToMove(
     all_filtered_tablets_by_drive.push_back(filtered_drive_tablets);
   }
 
+  // Moving a tablet with access rate close to half of the difference between the access rates of
+  // the servers evens them out the most. When to_ts is not less busy, the coldest tablet is
+  // preferred.
+  const bool use_access_rates = FLAGS_load_balancer_use_key_access_rates;
+  uint64_t target_access_rate = 0;
+  if (use_access_rates) {
+    auto total_access_rate = [this](const TabletServerId& ts_uuid) {
+      uint64_t result = 0;
+      const auto& ts_meta = state_->per_ts_meta_[ts_uuid];
+      for (const auto& [_, access_rate] : ts_meta.tablet_key_accesses_per_sec) {
+        result += access_rate;
+      }
+      return result;
+    };
+    auto from_ts_access_rate = total_access_rate(from_ts);
+    auto to_ts_access_rate = total_access_rate(to_ts);
+    if (from_ts_access_rate > to_ts_access_rate) {
+      target_access_rate = (from_ts_access_rate - to_ts_access_rate) / 2;
+    }
+  }
+  auto access_rate_distance = [&from_ts_meta, target_access_rate](const TabletId& tablet_id) {
+    auto it = from_ts_meta.tablet_key_accesses_per_sec.find(tablet_id);
+    uint64_t access_rate = it != from_ts_meta.tablet_key_accesses_per_sec.end() ? it->second : 0;
+    return access_rate > target_access_rate ? access_rate - target_access_rate
+                                            : target_access_rate - access_rate;
+  };
+
   // Below, we choose a tablet to move. We first filter out any tablets which cannot be moved
   // because of placement limitations. Then, we prioritize moving a tablet whose leader is in the
-  // same zone/region it is moving to (for faster remote bootstrapping).
+  // same zone/region it is moving to (for faster remote bootstrapping). Among such tablets, we
+  // prefer the one whose access rate is the closest to target_access_rate.
   for (const set<TabletId>& drive_tablets : all_filtered_tablets_by_drive) {
     VLOG(3) << Format("All tablets being considered for movement from ts $0 to ts $1 for this "
         "drive are: $2", from_ts, to_ts, drive_tablets);
@@ -1068,6 +1127,7 @@ Result<bool> ClusterLoadBalancer::GetTabletToMove(
     bool found_tablet_to_move = false;
     CatalogManagerUtil::CloudInfoSimilarity chosen_tablet_ci_similarity =
         CatalogManagerUtil::NO_MATCH;
+    uint64_t chosen_tablet_access_rate_distance = 0;
     for (const TabletId& tablet_id : drive_tablets) {
       const auto& placement_info = GetPlacementByTablet(tablet_id);
       // TODO(#15853): this should be augmented as well to allow dropping by one replica, if still
@@ -1103,13 +1163,18 @@ Result<bool> ClusterLoadBalancer::GetTabletToMove(
         ci_similarity = CatalogManagerUtil::ComputeCloudInfoSimilarity(leader_ci, to_ts_ci);
       }
 
-      if (found_tablet_to_move && ci_similarity <= chosen_tablet_ci_similarity) {
+      auto distance = use_access_rates ? access_rate_distance(tablet_id) : 0;
+      if (found_tablet_to_move &&
+          (ci_similarity < chosen_tablet_ci_similarity ||
+           (ci_similarity == chosen_tablet_ci_similarity &&
+            distance >= chosen_tablet_access_rate_distance))) {
         continue;
       }
       // This is the best tablet to move, so far.
       found_tablet_to_move = true;
       *moving_tablet_id = tablet_id;
       chosen_tablet_ci_similarity = ci_similarity;
+      chosen_tablet_access_rate_distance = distance;
     }
 
     // If there is any tablet we can move from this drive, choose it and return.
@@ -13,6 +13,8 @@
 
 #include "yb/master/cluster_balance_util.h"
 
+#include <limits>
+
 #include "yb/gutil/map-util.h"
 
 #include "yb/master/catalog_entity_info.h"
@@ -68,6 +70,24 @@ int GlobalLoadState::GetGlobalLeaderLoad(const TabletServerId& ts_uuid) const {
   return ts_meta.leaders_count;
 }
 
+bool GlobalLoadState::HasUnderloadedServer(double fraction) const {
+  int64_t total_running = 0;
+  int min_running = std::numeric_limits<int>::max();
+  size_t num_servers = 0;
+  for (const auto& [ts_uuid, ts_meta] : per_ts_global_meta_) {
+    if (blacklisted_servers_.count(ts_uuid)) {
+      continue;
+    }
+    total_running += ts_meta.running_tablets_count;
+    min_running = std::min(min_running, ts_meta.running_tablets_count);
+    ++num_servers;
+  }
+  if (num_servers < 2 || total_running == 0) {
+    return false;
+  }
+  return min_running < fraction * total_running / num_servers;
+}
+
 PerTableLoadState::PerTableLoadState(GlobalLoadState* global_state)
     : leader_balance_threshold_(FLAGS_leader_balance_threshold),
       current_time_(MonoTime::Now()),
@@ -236,6 +256,7 @@ Status PerTableLoadState::UpdateTablet(TabletInfo *tablet) {
     // 'RUNNING' state to maintain the existing behavior.
     if (tablet_state == tablet::UNKNOWN || tablet_state == tablet::RUNNING) {
       RETURN_NOT_OK(AddRunningTablet(tablet_id, ts_uuid, replica.fs_data_dir));
+      meta_ts.tablet_key_accesses_per_sec[tablet_id] = replica.drive_info.key_accesses_per_sec;
     } else if (!replica_is_stale &&
                 (tablet_state == tablet::BOOTSTRAPPING || tablet_state == tablet::NOT_STARTED)) {
       // Keep track of transitioning state (not running, but not in a stopped or failed state).
@@ -854,6 +875,7 @@ Status PerTableLoadState::RemoveRunningTablet(
   global_state_->per_ts_global_meta_[ts_uuid].running_tablets_count -= num_erased;
   total_running_ -= num_erased;
   per_tablet_meta_[tablet_id].running -= num_erased;
+  meta_ts.tablet_key_accesses_per_sec.erase(tablet_id);
   bool found = false;
   for (auto &path : meta_ts.path_to_tablets) {
     if (path.second.erase(tablet_id) == 0) {
@@ -156,6 +156,10 @@ struct CBTabletServerMetadata {
 
   // The set of tablet ids that this tablet server disabled (ex. after split).
   std::set<TabletId> disabled_by_ts_tablets;
+
+  // Map from tablet id to the key access rate reported for the running replica of the tablet on
+  // this tablet server.
+  std::unordered_map<TabletId, uint64_t> tablet_key_accesses_per_sec;
 };
 
 struct CBTabletServerLoadCounts {
@@ -263,6 +267,10 @@ class GlobalLoadState {
   // Get global leader load for a certain TS.
   int GetGlobalLeaderLoad(const TabletServerId& ts_uuid) const;
 
+  // Whether some non blacklisted TS runs fewer than fraction of the average number of running
+  // tablets per TS, e.g. because it was just added to the cluster.
+  bool HasUnderloadedServer(double fraction) const;
+
   std::string ToString() {
     std::string out = "{ drive_aware: " + std::to_string(drive_aware_) + ", ts_info: {[";
     for (const auto& ts_info : ts_descs_) {
@@ -278,6 +286,9 @@ class GlobalLoadState {
   // Used to determine how many tablets are being remote bootstrapped across the cluster.
   int total_starting_tablets_ = 0;
 
+  // Whether this run seeds an underloaded TS, so more replicas could be added at once.
+  bool bulk_seeding_ = false;
+
   TSDescriptorVector ts_descs_;
 
   bool drive_aware_ = true;
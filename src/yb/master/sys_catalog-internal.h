@@ -13,6 +13,9 @@
 
 #pragma once
 
+#include <future>
+#include <vector>
+
 #include "yb/qlexpr/ql_expr.h"
 
 #include "yb/docdb/doc_read_context.h"
@@ -39,7 +42,14 @@ class VisitorBase {
 
   virtual Status Visit(Slice id, Slice data) = 0;
 
+  // Should be called after all entries were passed to Visit.
+  virtual Status Finish() { return Status::OK(); }
+
+  // Number of threads used to parse entries. Entries are still visited one by one, in order.
+  void set_parse_parallelism(size_t value) { parse_parallelism_ = value; }
+
  protected:
+  size_t parse_parallelism_ = 1;
 };
 
 template <class PersistentDataEntryClass>
@@ -49,12 +59,24 @@ class Visitor : public VisitorBase {
   virtual ~Visitor() = default;
 
   virtual Status Visit(Slice id, Slice data) {
-    typename PersistentDataEntryClass::data_type metadata;
-    RETURN_NOT_OK_PREPEND(
-        pb_util::ParseFromArray(&metadata, data.data(), data.size()),
-        "Unable to parse metadata field for item id: " + id.ToBuffer());
+    if (parse_parallelism_ <= 1) {
+      typename PersistentDataEntryClass::data_type metadata;
+      RETURN_NOT_OK(Parse(id, data, &metadata));
+      return Visit(id.ToBuffer(), metadata);
+    }
+
+    pending_.push_back(PendingEntry {
+      .id = id.ToBuffer(),
+      .data = data.ToBuffer(),
+    });
+    if (pending_.size() >= kParseBatchSize) {
+      return VisitPending();
+    }
+    return Status::OK();
+  }
 
-    return Visit(id.ToBuffer(), metadata);
+  Status Finish() override {
+    return VisitPending();
   }
 
   int entry_type() const { return PersistentDataEntryClass::type(); }
@@ -64,6 +86,53 @@ class Visitor : public VisitorBase {
       const std::string& id, const typename PersistentDataEntryClass::data_type& metadata) = 0;
 
  private:
+  static constexpr size_t kParseBatchSize = 4096;
+
+  struct PendingEntry {
+    std::string id;
+    std::string data;
+    typename PersistentDataEntryClass::data_type metadata;
+    Status parse_status;
+  };
+
+  static Status Parse(
+      Slice id, Slice data, typename PersistentDataEntryClass::data_type* metadata) {
+    RETURN_NOT_OK_PREPEND(
+        pb_util::ParseFromArray(metadata, data.data(), data.size()),
+        "Unable to parse metadata field for item id: " + id.ToBuffer());
+    return Status::OK();
+  }
+
+  // Parses pending entries in parallel, then visits them in order.
+  Status VisitPending() {
+    auto parse_range = [this](size_t begin, size_t end) {
+      for (auto i = begin; i != end; ++i) {
+        auto& entry = pending_[i];
+        entry.parse_status = Parse(entry.id, entry.data, &entry.metadata);
+      }
+    };
+    const auto chunk_size = (pending_.size() + parse_parallelism_ - 1) / parse_parallelism_;
+    std::vector<std::future<void>> futures;
+    for (auto begin = chunk_size; begin < pending_.size(); begin += chunk_size) {
+      futures.push_back(std::async(
+          std::launch::async, parse_range, begin, std::min(begin + chunk_size, pending_.size())));
+    }
+    parse_range(0, std::min(chunk_size, pending_.size()));
+    for (auto& future : futures) {
+      future.wait();
+    }
+
+    auto pending = std::move(pending_);
+    pending_.clear();
+    for (const auto& entry : pending) {
+      RETURN_NOT_OK(entry.parse_status);
+      RETURN_NOT_OK(Visit(entry.id, entry.metadata));
+    }
+    return Status::OK();
+  }
+
+  std::vector<PendingEntry> pending_;
+
   DISALLOW_COPY_AND_ASSIGN(Visitor);
 };
 
@@ -146,6 +146,11 @@ DEFINE_UNKNOWN_int32(sys_catalog_write_timeout_ms, 60000, "Timeout for writes in
 DEFINE_UNKNOWN_uint64(copy_tables_batch_bytes, 500_KB,
     "Max bytes per batch for copy pg sql tables");
 
+DEFINE_NON_RUNTIME_uint32(sys_catalog_load_parse_threads, 4,
+    "Number of threads used to parse sys catalog entries while loading them into memory on "
+    "master leader election. 1 means parsing on the loading thread.");
+TAG_FLAG(sys_catalog_load_parse_threads, advanced);
+
 DEFINE_test_flag(int32, sys_catalog_write_rejection_percentage, 0,
   "Reject specified percentage of sys catalog writes.");
 
@@ -867,12 +872,14 @@ Status SysCatalogTable::Visit(VisitorBase* visitor) {
   auto start = CoarseMonoClock::Now();
 
   uint64_t count = 0;
+  visitor->set_parse_parallelism(std::max<uint32_t>(FLAGS_sys_catalog_load_parse_threads, 1));
   RETURN_NOT_OK(
       EnumerateSysCatalog(tablet.get(), doc_read_context_->schema(), visitor->entry_type(),
       [visitor, &count](const Slice& id, const Slice& data) {
     ++count;
     return visitor->Visit(id, data);
   }));
+  RETURN_NOT_OK(visitor->Finish());
 
   auto duration = CoarseMonoClock::Now() - start;
   string id = Format("num_entries_with_type_$0_loaded", std::to_string(visitor->entry_type()));
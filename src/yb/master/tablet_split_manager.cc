@@ -12,6 +12,7 @@
 //
 
 #include <chrono>
+#include <optional>
 
 #include "yb/common/constants.h"
 
@@ -85,10 +86,20 @@ DEFINE_RUNTIME_bool(sort_automatic_tablet_splitting_candidates, true,
 DEFINE_test_flag(bool, skip_partitioning_version_validation, false,
                  "When set, skips partitioning_version checks to prevent tablet splitting.");
 
+DEFINE_RUNTIME_uint64(tablet_merge_candidate_max_size_bytes, 0,
+    "Adjacent running tablets of a table are reported as merge candidates when their combined "
+    "leader SST files size is below this value. Tables that are not valid for automatic tablet "
+    "splitting are skipped. Detection is disabled if this value is set to 0.");
+
 METRIC_DEFINE_gauge_uint64(server, automatic_split_manager_time,
                            "Automatic Split Manager Time", yb::MetricUnit::kMilliseconds,
                            "Time for one run of the automatic tablet split manager.");
 
+METRIC_DEFINE_gauge_uint64(server, tablet_merge_candidates,
+                           "Tablet Merge Candidates", yb::MetricUnit::kUnits,
+                           "Number of pairs of adjacent small tablets found by the last run of "
+                           "the automatic tablet split manager.");
+
 namespace yb {
 namespace master {
 
@@ -129,7 +140,8 @@ TabletSplitManager::TabletSplitManager(
     cdc_split_driver_(cdcsdk_split_driver),
     last_run_time_(CoarseDuration::zero()),
     automatic_split_manager_time_ms_(
-        METRIC_automatic_split_manager_time.Instantiate(metric_entity, 0))
+        METRIC_automatic_split_manager_time.Instantiate(metric_entity, 0)),
+    tablet_merge_candidates_(METRIC_tablet_merge_candidates.Instantiate(metric_entity, 0))
     {}
 
 struct SplitCandidate {
@@ -780,6 +792,79 @@ void TabletSplitManager::DoSplitting(
   ScheduleSplits(state.GetSplitsToSchedule(), epoch);
 }
 
+// Unlike splitting, merging reduces the number of tablets, so the limits on the number of tablets
+// do not apply.
+Status TabletSplitManager::ValidateMergeCandidateTable(const TableInfo& table) {
+  if (table.LockForRead()->started_deleting()) {
+    return STATUS_FORMAT(NotSupported, "Table is deleted, table_id: $0", table.id());
+  }
+  if (table.is_system() || table.colocated() ||
+      table.GetTableType() == TableType::TRANSACTION_STATUS_TABLE_TYPE ||
+      table.GetTableType() == REDIS_TABLE_TYPE || table.id() == kPgSequencesDataTableId) {
+    return STATUS_FORMAT(
+        NotSupported, "Tablet merging is not supported for table: $0 with table_id: $1",
+        table.name(), table.id());
+  }
+  if (table.IsBackfilling()) {
+    return STATUS_FORMAT(IllegalState, "Backfill operation in progress, table_id: $0", table.id());
+  }
+  return filter_->XreplValidateSplitCandidateTable(table);
+}
+
+void TabletSplitManager::FindMergeCandidates(const std::vector<TableInfoPtr>& tables) {
+  const auto max_size = FLAGS_tablet_merge_candidate_max_size_bytes;
+  if (max_size == 0) {
+    tablet_merge_candidates_->set_value(0);
+    return;
+  }
+
+  uint64_t num_candidates = 0;
+  for (const auto& table : tables) {
+    if (auto status = ValidateMergeCandidateTable(*table); !status.ok()) {
+      VLOG(3) << "Skipping table for merging. " << status;
+      continue;
+    }
+
+    // Tablets are ordered by partition start, so adjacent tablets are next to each other.
+    // Candidates are paired greedily, each tablet is used in at most one pair.
+    std::optional<std::pair<TabletInfoPtr, uint64_t>> prev;
+    for (const auto& tablet : table->GetTablets()) {
+      auto size = [&tablet, max_size]() -> std::optional<uint64_t> {
+        if (!tablet->LockForRead()->is_running()) {
+          return std::nullopt;
+        }
+        auto drive_info = tablet->GetLeaderReplicaDriveInfo();
+        if (!drive_info.ok() || drive_info->sst_files_size >= max_size) {
+          return std::nullopt;
+        }
+        return drive_info->sst_files_size;
+      }();
+      if (!size) {
+        prev.reset();
+        continue;
+      }
+      if (prev && prev->second + *size < max_size &&
+          prev->first->LockForRead()->pb.partition().partition_key_end() ==
+              tablet->LockForRead()->pb.partition().partition_key_start()) {
+        VLOG(3) << Format(
+            "Tablets $0 and $1 of table $2 are merge candidates, combined SST files size: $3",
+            prev->first->tablet_id(), tablet->tablet_id(), table->id(), prev->second + *size);
+        ++num_candidates;
+        prev.reset();
+        continue;
+      }
+      prev.emplace(tablet, *size);
+    }
+  }
+
+  if (num_candidates > 0) {
+    YB_LOG_EVERY_N_SECS(INFO, 300)
+        << "Found " << num_candidates << " pairs of adjacent tablets with combined SST files "
+        << "size below " << max_size << " bytes";
+  }
+  tablet_merge_candidates_->set_value(num_candidates);
+}
+
 Status TabletSplitManager::WaitUntilIdle(CoarseTimePoint deadline) {
   std::shared_lock l(is_running_mutex_, deadline);
   if (!l.owns_lock()) {
@@ -858,6 +943,7 @@ void TabletSplitManager::MaybeDoSplitting(
   }
 
   DoSplitting(tables, tablet_info_map, epoch);
+  FindMergeCandidates(tables);
   last_run_time_ = CoarseMonoClock::Now();
   automatic_split_manager_time_ms_->set_value(ToMilliseconds(last_run_time_ - start_time));
 }
@@ -94,6 +94,12 @@ class TabletSplitManager {
       const TabletInfoMap& tablet_info_map,
       const LeaderEpoch& epoch);
 
+  // Finds pairs of adjacent running tablets that are small enough to be merged, and reports them
+  // via the tablet_merge_candidates metric. Tablets are not merged yet.
+  void FindMergeCandidates(const std::vector<TableInfoPtr>& tables);
+
+  Status ValidateMergeCandidateTable(const TableInfo& table);
+
   Status ValidateTableAgainstDisabledLists(const TableId& table_id);
   Status ValidateTabletAgainstDisabledList(const TabletId& tablet_id);
   Status ValidatePartitioningVersion(const TableInfo& table);
@@ -110,6 +116,9 @@ class TabletSplitManager {
   // Metric to monitor how long a tablet split manager run takes.
   scoped_refptr<yb::AtomicGauge<uint64_t>> automatic_split_manager_time_ms_;
 
+  // Metric with the number of merge candidates found by the last run.
+  scoped_refptr<yb::AtomicGauge<uint64_t>> tablet_merge_candidates_;
+
   template <typename IdType>
   using DisabledSet = std::unordered_map<IdType, CoarseTimePoint>;
 
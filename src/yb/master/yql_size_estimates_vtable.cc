@@ -20,11 +20,17 @@
 #include "yb/master/catalog_manager_if.h"
 #include "yb/master/master_client.pb.h"
 
+#include "yb/util/flags.h"
+#include "yb/util/shared_lock.h"
 #include "yb/util/status_log.h"
 #include "yb/util/yb_partition.h"
 
 using std::string;
 
+DEFINE_RUNTIME_bool(use_cache_for_size_estimates_vtable, true,
+    "Whether we should use caching for system.size_estimates table. The cached table is "
+    "regenerated when tables, tablets or tablet locations change.");
+
 namespace yb {
 namespace master {
 
@@ -35,6 +41,37 @@ YQLSizeEstimatesVTable::YQLSizeEstimatesVTable(const TableName& table_name,
 }
 
 Result<VTableDataPtr> YQLSizeEstimatesVTable::RetrieveData(const QLReadRequestPB& request) const {
+  if (!FLAGS_use_cache_for_size_estimates_vtable) {
+    return GenerateData();
+  }
+
+  auto& catalog_manager = this->catalog_manager();
+  // Versions are taken before generating the data, so concurrent changes could only make the
+  // cache look stale.
+  auto tablets_version = catalog_manager.tablets_version();
+  auto tablet_locations_version = catalog_manager.tablet_locations_version();
+  {
+    SharedLock<std::shared_timed_mutex> lock(mutex_);
+    if (cache_ && tablets_version == cached_tablets_version_ &&
+        tablet_locations_version == cached_tablet_locations_version_) {
+      return cache_;
+    }
+  }
+
+  auto vtable = VERIFY_RESULT(GenerateData());
+
+  std::lock_guard lock(mutex_);
+  // Don't replace a cache that was generated for newer versions in the meantime.
+  if (tablets_version >= cached_tablets_version_ &&
+      tablet_locations_version >= cached_tablet_locations_version_) {
+    cache_ = vtable;
+    cached_tablets_version_ = tablets_version;
+    cached_tablet_locations_version_ = tablet_locations_version;
+  }
+  return vtable;
+}
+
+Result<VTableDataPtr> YQLSizeEstimatesVTable::GenerateData() const {
   auto vtable = std::make_shared<qlexpr::QLRowBlock>(schema());
   auto* catalog_manager = &this->catalog_manager();
 
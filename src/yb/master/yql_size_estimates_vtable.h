@@ -13,6 +13,10 @@
 
 #pragma once
 
+#include <shared_mutex>
+
+#include "yb/gutil/thread_annotations.h"
+
 #include "yb/master/yql_virtual_table.h"
 
 namespace yb {
@@ -27,6 +31,10 @@ class YQLSizeEstimatesVTable : public YQLVirtualTable {
  protected:
   Schema CreateSchema() const;
  private:
+  static const intptr_t kInvalidCache = -1;
+
+  Result<VTableDataPtr> GenerateData() const;
+
   Status PopulateColumnInformation(const Schema& schema,
                                    const std::string& keyspace_name,
                                    const std::string& table_name,
@@ -38,6 +46,13 @@ class YQLSizeEstimatesVTable : public YQLVirtualTable {
   static constexpr const char* const kRangeEnd = "range_end";
   static constexpr const char* const kMeanPartitionSize = "mean_partition_size";
   static constexpr const char* const kPartitionsCount = "partitions_count";
+
+  // Rows only depend on the tables, their tablets and tablet locations, so the generated table is
+  // reused until one of the corresponding catalog manager versions changes.
+  mutable std::shared_timed_mutex mutex_;
+  mutable VTableDataPtr cache_ GUARDED_BY(mutex_);
+  mutable intptr_t cached_tablets_version_ GUARDED_BY(mutex_) = kInvalidCache;
+  mutable intptr_t cached_tablet_locations_version_ GUARDED_BY(mutex_) = kInvalidCache;
 };
 
 }  // namespace master
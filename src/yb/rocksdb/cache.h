@@ -66,6 +66,12 @@ extern std::shared_ptr<Cache> NewLRUCache(size_t capacity, int num_shard_bits);
 extern std::shared_ptr<Cache> NewLRUCache(size_t capacity, int num_shard_bits,
                                      bool strict_capacity_limit);
 
+// Create a new sharded cache with CLOCK eviction policy, see NewLRUCache for parameters.
+// Cache hits do not need exclusive lock on the shard, so this cache scales better than LRU cache
+// when a lot of threads are reading the same shard.
+extern std::shared_ptr<Cache> NewClockCache(size_t capacity, int num_shard_bits,
+                                            bool strict_capacity_limit = false);
+
 using QueryId = int64_t;
 // Query ids to represent values for the default query id.
 constexpr QueryId kDefaultQueryId = 0;
@@ -282,6 +282,20 @@ class DB {
                     keys, values);
   }
 
+  // Asynchronously prefetches data blocks of SST files that could contain specified user keys into
+  // OS page cache, so following reads of a batch of keys from a cold cache do not wait for IO one
+  // key at a time. Keys could be passed in any order, and could be prefixes of the stored user
+  // keys. Blocks present in the block cache are not prefetched. Default implementation does
+  // nothing.
+  virtual Status PrefetchKeys(const ReadOptions& options,
+                              ColumnFamilyHandle* column_family,
+                              const std::vector<Slice>& keys) {
+    return Status::OK();
+  }
+  virtual Status PrefetchKeys(const ReadOptions& options, const std::vector<Slice>& keys) {
+    return PrefetchKeys(options, DefaultColumnFamily(), keys);
+  }
+
   // If the key definitely does not exist in the database, then this method
   // returns false, else true. If the caller wants to obtain value when the key
   // is found in memory, a bool for 'value_found' must be passed. 'value_found'
@@ -841,6 +855,15 @@ class DB {
 
   virtual void ListenFilesChanged(std::function<void()> listener) {}
 
+  // Evaluates compaction_file_filter_factory against live files of the default column family, and
+  // schedules a background compaction which removes files that could be discarded, without
+  // waiting for other compaction triggers. Returns the number of such files.
+  virtual yb::Result<size_t> ScheduleFilteredFilesDeletion() { return 0; }
+
+  // Returns pressure of pending flushes and compactions on writes to the default column family,
+  // from 0 when writes are not delayed to 1 when writes are stopped.
+  virtual double GetWriteStallPressure() { return 0.0; }
+
   // Obtains the meta data of the specified column family of the DB.
   // STATUS(NotFound, "") will be returned if the current DB does not have
   // any column family match the specified name.
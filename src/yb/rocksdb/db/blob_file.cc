@@ -0,0 +1,436 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/rocksdb/db/blob_file.h"
+
+#include "yb/rocksdb/db/dbformat.h"
+#include "yb/rocksdb/db/filename.h"
+#include "yb/rocksdb/statistics.h"
+#include "yb/rocksdb/table/filtering_iterator.h"
+#include "yb/rocksdb/table/internal_iterator.h"
+#include "yb/rocksdb/util/arena.h"
+#include "yb/rocksdb/util/coding.h"
+#include "yb/rocksdb/util/crc32c.h"
+#include "yb/rocksdb/util/file_reader_writer.h"
+
+#include "yb/util/logging.h"
+#include "yb/util/status_format.h"
+#include "yb/util/status_log.h"
+#include "yb/util/tostring.h"
+
+namespace rocksdb {
+
+namespace {
+
+// Each value in a blob file is followed by its masked crc32c.
+constexpr size_t kBlobRecordTrailerSize = sizeof(uint32_t);
+
+// Blob file readers share the cache with table readers, which are keyed by the file number alone.
+constexpr char kBlobCacheKeySuffix = 'b';
+constexpr size_t kBlobCacheKeySize = sizeof(uint64_t) + 1;
+
+Slice BlobCacheKey(uint64_t file_number, char* buf) {
+  EncodeFixed64(buf, file_number);
+  buf[sizeof(uint64_t)] = kBlobCacheKeySuffix;
+  return Slice(buf, kBlobCacheKeySize);
+}
+
+void DeleteBlobFileReader(const Slice& key, void* value) {
+  delete static_cast<RandomAccessFileReader*>(value);
+}
+
+Status ReadBlob(const RandomAccessFileReader& reader, const BlobIndex& index, std::string* value) {
+  const size_t size = index.size + kBlobRecordTrailerSize;
+  value->resize(size);
+  Slice result;
+  RETURN_NOT_OK(reader.Read(index.offset, size, &result, &(*value)[0]));
+  if (result.size() != size) {
+    return STATUS_FORMAT(Corruption, "Truncated blob $0: $1 bytes read", index, result.size());
+  }
+  const auto expected_crc = crc32c::Unmask(DecodeFixed32(result.cdata() + index.size));
+  if (crc32c::Value(result.cdata(), index.size) != expected_crc) {
+    return STATUS_FORMAT(Corruption, "Blob checksum mismatch: $0", index);
+  }
+  if (result.cdata() == value->data()) {
+    value->resize(index.size);
+  } else {
+    value->assign(result.cdata(), index.size);
+  }
+  return Status::OK();
+}
+
+class BlobResolvingIterator final : public InternalIterator {
+ public:
+  BlobResolvingIterator(InternalIterator* iterator, BlobFileCache* blob_cache, bool arena_mode)
+      : iterator_(iterator, PossibleArenaDeleter(arena_mode)), blob_cache_(blob_cache) {}
+
+ private:
+  const KeyValueEntry& Entry() const override {
+    if (resolved_) {
+      return resolved_entry_;
+    }
+    return status_.ok() ? iterator_->Entry() : KeyValueEntry::Invalid();
+  }
+
+  const KeyValueEntry& SeekToFirst() override {
+    return Resolve(iterator_->SeekToFirst());
+  }
+
+  const KeyValueEntry& SeekToLast() override {
+    return Resolve(iterator_->SeekToLast());
+  }
+
+  const KeyValueEntry& Seek(Slice target) override {
+    return Resolve(iterator_->Seek(target));
+  }
+
+  const KeyValueEntry& Next() override {
+    return Resolve(iterator_->Next());
+  }
+
+  const KeyValueEntry& Prev() override {
+    return Resolve(iterator_->Prev());
+  }
+
+  Status status() const override {
+    return status_.ok() ? iterator_->status() : status_;
+  }
+
+  Status PinData() override {
+    return iterator_->PinData();
+  }
+
+  Status ReleasePinnedData() override {
+    return iterator_->ReleasePinnedData();
+  }
+
+  bool IsKeyPinned() const override {
+    // Key of resolved entry is stored in our own buffer.
+    return !resolved_ && iterator_->IsKeyPinned();
+  }
+
+  Status GetProperty(std::string prop_name, std::string* prop) override {
+    return iterator_->GetProperty(std::move(prop_name), prop);
+  }
+
+  ScanForwardResult ScanForward(
+      const Comparator* user_key_comparator, const Slice& upperbound,
+      KeyFilterCallback* key_filter_callback, ScanCallback* scan_callback) override {
+    LOG_IF(DFATAL, !Valid()) << "Iterator should be valid.";
+
+    ScanForwardResult result;
+    do {
+      const auto& entry = Entry();
+      const auto user_key = ExtractUserKey(entry.key);
+      if (!upperbound.empty() && user_key_comparator->Compare(user_key, upperbound) >= 0) {
+        break;
+      }
+
+      bool skip_key = false;
+      if (key_filter_callback) {
+        auto kf_result =
+            (*key_filter_callback)(/*prefixed_key=*/ Slice(), /*shared_bytes=*/ 0, user_key);
+        skip_key = kf_result.skip_key;
+      }
+
+      if (!skip_key && !(*scan_callback)(user_key, entry.value)) {
+        return result;
+      }
+
+      result.number_of_keys_visited++;
+      Next();
+    } while (Valid());
+
+    result.reached_upperbound = true;
+    return result;
+  }
+
+  const KeyValueEntry& Resolve(const KeyValueEntry& entry) {
+    resolved_ = false;
+    status_ = Status::OK();
+    if (!entry || ExtractValueType(entry.key) != kTypeBlobIndex) {
+      return entry;
+    }
+    BlobIndex index;
+    status_ = index.DecodeFrom(entry.value);
+    if (status_.ok()) {
+      status_ = blob_cache_->Get(index, &value_buffer_);
+    }
+    if (!status_.ok()) {
+      return KeyValueEntry::Invalid();
+    }
+    key_buffer_.assign(entry.key.cdata(), entry.key.size());
+    UpdateInternalKey(&key_buffer_, GetInternalKeySeqno(entry.key), kTypeValue);
+    resolved_entry_.key = key_buffer_;
+    resolved_entry_.value = value_buffer_;
+    resolved_ = true;
+    return resolved_entry_;
+  }
+
+  const std::unique_ptr<InternalIterator, PossibleArenaDeleter> iterator_;
+  BlobFileCache* const blob_cache_;
+  bool resolved_ = false;
+  KeyValueEntry resolved_entry_;
+  std::string key_buffer_;
+  std::string value_buffer_;
+  Status status_;
+};
+
+} // namespace
+
+void BlobIndex::EncodeTo(std::string* dst) const {
+  PutVarint64(dst, file_number);
+  PutVarint32(dst, path_id);
+  PutVarint64(dst, offset);
+  PutVarint64(dst, size);
+}
+
+Status BlobIndex::DecodeFrom(Slice src) {
+  if (!GetVarint64(&src, &file_number) || !GetVarint32(&src, &path_id) ||
+      !GetVarint64(&src, &offset) || !GetVarint64(&src, &size) || !src.empty()) {
+    return STATUS(Corruption, "Bad blob index");
+  }
+  return Status::OK();
+}
+
+std::string BlobIndex::ToString() const {
+  return YB_STRUCT_TO_STRING(file_number, path_id, offset, size);
+}
+
+BlobFileCache::BlobFileCache(
+    const ImmutableCFOptions& ioptions, const EnvOptions& env_options, Cache* cache)
+    : ioptions_(ioptions), env_options_(env_options), cache_(cache) {}
+
+Status BlobFileCache::Get(const BlobIndex& index, std::string* value) {
+  char key_buf[kBlobCacheKeySize];
+  const auto key = BlobCacheKey(index.file_number, key_buf);
+  auto* handle = cache_->Lookup(key, kDefaultQueryId);
+  if (handle == nullptr) {
+    std::unique_ptr<RandomAccessFile> file;
+    RETURN_NOT_OK(ioptions_.env->NewRandomAccessFile(
+        BlobFileName(ioptions_.db_paths, index.file_number, index.path_id), &file, env_options_));
+    RecordTick(ioptions_.statistics, NO_FILE_OPENS);
+    auto reader = std::make_unique<RandomAccessFileReader>(
+        std::move(file), ioptions_.env, ioptions_.statistics, SST_READ_MICROS);
+    RETURN_NOT_OK(cache_->Insert(
+        key, kDefaultQueryId, reader.get(), 1, &DeleteBlobFileReader, &handle));
+    reader.release();
+  }
+  auto status = ReadBlob(
+      *static_cast<RandomAccessFileReader*>(cache_->Value(handle)), index, value);
+  cache_->Release(handle);
+  return status;
+}
+
+void BlobFileCache::Evict(Cache* cache, uint64_t file_number) {
+  char key_buf[kBlobCacheKeySize];
+  cache->Erase(BlobCacheKey(file_number, key_buf));
+}
+
+InternalIterator* NewBlobResolvingIterator(
+    InternalIterator* iterator, BlobFileCache* blob_cache, Arena* arena) {
+  if (!arena) {
+    return new BlobResolvingIterator(iterator, blob_cache, /* arena_mode= */ false);
+  }
+  auto mem = arena->AllocateAligned(sizeof(BlobResolvingIterator));
+  return new (mem) BlobResolvingIterator(iterator, blob_cache, /* arena_mode= */ true);
+}
+
+void AddBlobFileRefs(const std::vector<FileMetaData*>& files, BlobFileInfoMap* blob_files) {
+  for (const auto* file : files) {
+    for (const auto& ref : file->blob_refs) {
+      auto& info = (*blob_files)[ref.file_number];
+      info.path_id = ref.path_id;
+      info.file_size = ref.file_size;
+      info.referenced_bytes += ref.referenced_bytes;
+    }
+  }
+}
+
+void MarkBlobFilesForRelocation(double garbage_ratio, BlobFileInfoMap* blob_files) {
+  for (auto& [file_number, info] : *blob_files) {
+    const auto garbage_bytes = info.file_size - std::min(info.referenced_bytes, info.file_size);
+    info.relocate = info.file_size > 0 && garbage_bytes >= garbage_ratio * info.file_size;
+  }
+}
+
+void ResolvedBlobs::Add(Slice user_key, const BlobIndex& index, Slice value) {
+  entries_.push_back(Entry {
+    .user_key = user_key.ToBuffer(),
+    .index = index,
+    .value = value.ToBuffer(),
+  });
+}
+
+const BlobIndex* ResolvedBlobs::Find(Slice user_key, Slice value) {
+  while (!entries_.empty() && comparator_->Compare(entries_.front().user_key, user_key) < 0) {
+    entries_.pop_front();
+  }
+  for (const auto& entry : entries_) {
+    if (comparator_->Compare(entry.user_key, user_key) != 0) {
+      break;
+    }
+    if (value == Slice(entry.value)) {
+      return &entry.index;
+    }
+  }
+  return nullptr;
+}
+
+BlobSeparator::BlobSeparator(
+    const ImmutableCFOptions& ioptions, const EnvOptions& env_options, BlobFileCache* blob_cache,
+    uint64_t file_number, uint32_t path_id, const BlobFileInfoMap* blob_files,
+    ResolvedBlobs* resolved_blobs)
+    : ioptions_(ioptions), env_options_(env_options), blob_cache_(blob_cache),
+      file_number_(file_number), path_id_(path_id), blob_files_(blob_files),
+      resolved_blobs_(resolved_blobs) {}
+
+BlobSeparator::~BlobSeparator() {
+  if (writer_) {
+    Abandon();
+  }
+}
+
+Status BlobSeparator::Process(Slice* key, Slice* value) {
+  const auto type = ExtractValueType(*key);
+  if (type == kTypeBlobIndex) {
+    BlobIndex index;
+    RETURN_NOT_OK(index.DecodeFrom(*value));
+    const BlobFileInfo* info = nullptr;
+    if (blob_files_) {
+      auto it = blob_files_->find(index.file_number);
+      info = it != blob_files_->end() ? &it->second : nullptr;
+    }
+    if (info && !info->relocate) {
+      AddRef(index, info->file_size);
+      return Status::OK();
+    }
+    // Blob file is garbage collected, so move the value to our blob file or back to the SST file.
+    std::string blob_value;
+    RETURN_NOT_OK(blob_cache_->Get(index, &blob_value));
+    if (ioptions_.min_blob_size == 0 || blob_value.size() < ioptions_.min_blob_size) {
+      key_buffer_.assign(key->cdata(), key->size());
+      UpdateInternalKey(&key_buffer_, GetInternalKeySeqno(*key), kTypeValue);
+      value_buffer_ = std::move(blob_value);
+      *key = key_buffer_;
+      *value = value_buffer_;
+      return Status::OK();
+    }
+    RETURN_NOT_OK(WriteBlob(blob_value, &index));
+    SetBlobIndex(index, key, value);
+    return Status::OK();
+  }
+
+  if (type != kTypeValue) {
+    return Status::OK();
+  }
+
+  const BlobIndex* resolved_index = nullptr;
+  if (resolved_blobs_ && !resolved_blobs_->empty()) {
+    resolved_index = resolved_blobs_->Find(ExtractUserKey(*key), *value);
+  }
+  if (ioptions_.min_blob_size == 0 || value->size() < ioptions_.min_blob_size) {
+    return Status::OK();
+  }
+
+  if (resolved_index && blob_files_) {
+    auto it = blob_files_->find(resolved_index->file_number);
+    if (it != blob_files_->end() && !it->second.relocate) {
+      // The value was read from a blob file, that is not garbage collected, so keep referring it.
+      AddRef(*resolved_index, it->second.file_size);
+      SetBlobIndex(*resolved_index, key, value);
+      return Status::OK();
+    }
+  }
+
+  BlobIndex index;
+  RETURN_NOT_OK(WriteBlob(*value, &index));
+  SetBlobIndex(index, key, value);
+  return Status::OK();
+}
+
+Status BlobSeparator::WriteBlob(Slice value, BlobIndex* index) {
+  if (!writer_) {
+    std::unique_ptr<WritableFile> file;
+    RETURN_NOT_OK(NewWritableFile(
+        ioptions_.env, BlobFileName(ioptions_.db_paths, file_number_, path_id_), &file,
+        env_options_));
+    file->SetIOPriority(yb::IOPriority::kLow);
+    writer_ = std::make_unique<WritableFileWriter>(std::move(file), env_options_);
+    created_file_ = true;
+  }
+
+  *index = BlobIndex {
+    .file_number = file_number_,
+    .path_id = path_id_,
+    .offset = writer_->GetFileSize(),
+    .size = value.size(),
+  };
+  RETURN_NOT_OK(writer_->Append(value));
+  char trailer[kBlobRecordTrailerSize];
+  EncodeFixed32(trailer, crc32c::Mask(crc32c::Value(value.cdata(), value.size())));
+  RETURN_NOT_OK(writer_->Append(Slice(trailer, sizeof(trailer))));
+  // Size of our own blob file is filled in Finish.
+  AddRef(*index, 0);
+  return Status::OK();
+}
+
+void BlobSeparator::AddRef(const BlobIndex& index, uint64_t file_size) {
+  auto& ref = refs_[index.file_number];
+  ref.file_number = index.file_number;
+  ref.path_id = index.path_id;
+  ref.referenced_bytes += index.size + kBlobRecordTrailerSize;
+  ref.file_size = file_size;
+}
+
+void BlobSeparator::SetBlobIndex(const BlobIndex& index, Slice* key, Slice* value) {
+  key_buffer_.assign(key->cdata(), key->size());
+  UpdateInternalKey(&key_buffer_, GetInternalKeySeqno(*key), kTypeBlobIndex);
+  value_buffer_.clear();
+  index.EncodeTo(&value_buffer_);
+  *key = key_buffer_;
+  *value = value_buffer_;
+}
+
+Status BlobSeparator::Finish(FileMetaData* meta) {
+  if (writer_) {
+    if (!ioptions_.disable_data_sync) {
+      RETURN_NOT_OK(writer_->Sync(ioptions_.use_fsync));
+    }
+    RETURN_NOT_OK(writer_->Close());
+    refs_[file_number_].file_size = writer_->GetFileSize();
+    writer_.reset();
+  }
+
+  std::vector<BlobFileRef> refs;
+  refs.reserve(refs_.size());
+  for (const auto& [file_number, ref] : refs_) {
+    refs.push_back(ref);
+  }
+  meta->SetBlobRefs(std::move(refs));
+  return Status::OK();
+}
+
+void BlobSeparator::Abandon() {
+  if (writer_) {
+    WARN_NOT_OK(writer_->Close(), "Failed to close blob file");
+    writer_.reset();
+  }
+  if (created_file_) {
+    ioptions_.env->CleanupFile(BlobFileName(ioptions_.db_paths, file_number_, path_id_));
+    created_file_ = false;
+  }
+  refs_.clear();
+}
+
+}  // namespace rocksdb
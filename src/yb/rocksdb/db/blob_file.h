@@ -0,0 +1,168 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+// Key-value separation for large values.
+//
+// When ColumnFamilyOptions::min_blob_size is set, flush and compaction write values of at least
+// this size to a blob file, and the SST file stores a kTypeBlobIndex entry with a reference to the
+// value instead. Each blob file has the same number as the SST file it was written with, and is
+// append-only: a record is the value followed by its masked crc32c.
+//
+// SST files list the blob files they refer to in FileMetaData::blob_refs, which is persisted in the
+// manifest. A blob file stays alive while any live SST file refers to it. Compactions keep the
+// references to unchanged values, so large values are not rewritten on every compaction. Values
+// are only moved to a new blob file when their blob file has accumulated enough garbage, see
+// ColumnFamilyOptions::blob_garbage_collection_ratio.
+
+#pragma once
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "yb/rocksdb/cache.h"
+#include "yb/rocksdb/db/version_edit.h"
+#include "yb/rocksdb/immutable_options.h"
+#include "yb/rocksdb/status.h"
+
+namespace rocksdb {
+
+class Arena;
+class InternalIterator;
+class WritableFileWriter;
+
+// Reference to a value stored in a blob file. Stored as the value of kTypeBlobIndex entries.
+struct BlobIndex {
+  uint64_t file_number = 0;
+  uint32_t path_id = 0;
+  uint64_t offset = 0;
+  uint64_t size = 0;
+
+  void EncodeTo(std::string* dst) const;
+  Status DecodeFrom(Slice src);
+
+  std::string ToString() const;
+};
+
+// Provides access to values stored in blob files. Readers of blob files are kept in the table
+// cache, next to the table readers.
+class BlobFileCache {
+ public:
+  BlobFileCache(const ImmutableCFOptions& ioptions, const EnvOptions& env_options, Cache* cache);
+
+  // Reads the value referenced by index into *value.
+  Status Get(const BlobIndex& index, std::string* value);
+
+  // Evict reader of the specified blob file.
+  static void Evict(Cache* cache, uint64_t file_number);
+
+ private:
+  const ImmutableCFOptions& ioptions_;
+  const EnvOptions& env_options_;
+  Cache* const cache_;
+};
+
+// Returns iterator that replaces kTypeBlobIndex entries of the specified iterator with values they
+// refer to.
+InternalIterator* NewBlobResolvingIterator(
+    InternalIterator* iterator, BlobFileCache* blob_cache, Arena* arena);
+
+// Blob file referenced from live SST files, see AddBlobFileRefs.
+struct BlobFileInfo {
+  uint32_t path_id = 0;
+  uint64_t file_size = 0;
+  uint64_t referenced_bytes = 0;
+  // Compaction should move values referenced from this blob file to a new blob file.
+  bool relocate = false;
+};
+
+using BlobFileInfoMap = std::unordered_map<uint64_t, BlobFileInfo>;
+
+// Adds blob files referenced from the specified SST files to blob_files.
+void AddBlobFileRefs(const std::vector<FileMetaData*>& files, BlobFileInfoMap* blob_files);
+
+// Marks for relocation blob files where at least garbage_ratio of bytes is not referenced anymore.
+void MarkBlobFilesForRelocation(double garbage_ratio, BlobFileInfoMap* blob_files);
+
+// Values that compaction read from blob files, in user key order. Used to keep referring to the
+// same blob when the compaction output contains the same value for the key.
+class ResolvedBlobs {
+ public:
+  explicit ResolvedBlobs(const Comparator* comparator) : comparator_(comparator) {}
+
+  void Add(Slice user_key, const BlobIndex& index, Slice value);
+
+  // Returns blob holding the value for user_key, or nullptr if there is no such blob.
+  // Forgets blobs for keys before user_key.
+  const BlobIndex* Find(Slice user_key, Slice value);
+
+  bool empty() const {
+    return entries_.empty();
+  }
+
+ private:
+  struct Entry {
+    std::string user_key;
+    BlobIndex index;
+    std::string value;
+  };
+
+  const Comparator* const comparator_;
+  std::deque<Entry> entries_;
+};
+
+// Converts entries written to a single SST file: large values are moved to the blob file with the
+// same number as the SST file, and references to blob files are kept or relocated.
+class BlobSeparator {
+ public:
+  // blob_files and resolved_blobs are optional. Without blob_files all blob references are kept.
+  BlobSeparator(
+      const ImmutableCFOptions& ioptions, const EnvOptions& env_options, BlobFileCache* blob_cache,
+      uint64_t file_number, uint32_t path_id, const BlobFileInfoMap* blob_files = nullptr,
+      ResolvedBlobs* resolved_blobs = nullptr);
+  ~BlobSeparator();
+
+  // Updates entry to the form it should be stored in the SST file. When entry is changed, key and
+  // value are pointed to internal buffers, that are valid until the next call.
+  Status Process(Slice* key, Slice* value);
+
+  // Finishes the blob file and stores references to blob files into meta.
+  Status Finish(FileMetaData* meta);
+
+  // Deletes the blob file written by this separator, if any.
+  void Abandon();
+
+ private:
+  void AddRef(const BlobIndex& index, uint64_t file_size);
+  Status WriteBlob(Slice value, BlobIndex* index);
+  void SetBlobIndex(const BlobIndex& index, Slice* key, Slice* value);
+
+  const ImmutableCFOptions& ioptions_;
+  const EnvOptions& env_options_;
+  BlobFileCache* const blob_cache_;
+  const uint64_t file_number_;
+  const uint32_t path_id_;
+  const BlobFileInfoMap* const blob_files_;
+  ResolvedBlobs* const resolved_blobs_;
+
+  std::unique_ptr<WritableFileWriter> writer_;
+  bool created_file_ = false;
+  std::map<uint64_t, BlobFileRef> refs_;
+  std::string key_buffer_;
+  std::string value_buffer_;
+};
+
+}  // namespace rocksdb
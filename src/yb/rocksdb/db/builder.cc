@@ -32,6 +32,7 @@
 #include <utility>
 #include <vector>
 
+#include "yb/rocksdb/db/blob_file.h"
 #include "yb/rocksdb/db/compaction_iterator.h"
 #include "yb/rocksdb/db/dbformat.h"
 #include "yb/rocksdb/db/filename.h"
@@ -151,6 +152,7 @@ Status BuildTable(const std::string& dbname,
       iter->SeekToFirst();
 
       bool do_retry = false;
+      std::unique_ptr<BlobSeparator> blob_separator;
 
       if (iter->Valid()) {
         std::shared_ptr<WritableFileWriter> base_file_writer;
@@ -177,14 +179,28 @@ Status BuildTable(const std::string& dbname,
             earliest_write_conflict_snapshot, true /* internal key corruption is not ok */);
         c_iter.SeekToFirst();
         const bool non_empty = c_iter.Valid();
-        if (non_empty) {
-          meta->UpdateKey(c_iter.key(), UpdateBoundariesType::kSmallest);
+
+        if (ioptions.min_blob_size > 0) {
+          blob_separator = std::make_unique<BlobSeparator>(
+              ioptions, env_options, table_cache->blob_cache(), meta->fd.GetNumber(),
+              meta->fd.GetPathId());
         }
 
         boost::container::small_vector<UserBoundaryValueRef, 0x10> user_values;
         for (; c_iter.Valid(); c_iter.Next()) {
-          const Slice& key = c_iter.key();
-          const Slice& value = c_iter.value();
+          Slice key = c_iter.key();
+          Slice value = c_iter.value();
+          if (blob_separator) {
+            s = blob_separator->Process(&key, &value);
+            if (!s.ok()) {
+              builder->Abandon();
+              blob_separator->Abandon();
+              return s;
+            }
+          }
+          if (builder->NumEntries() == 0) {
+            meta->UpdateKey(key, UpdateBoundariesType::kSmallest);
+          }
           builder->Add(key, value);
           meta->UpdateBoundarySeqNo(GetInternalKeySeqno(key));
           if (db_options.boundary_extractor) {
@@ -192,6 +208,9 @@ Status BuildTable(const std::string& dbname,
             auto status = db_options.boundary_extractor->Extract(ExtractUserKey(key), &user_values);
             if (!status.ok()) {
               builder->Abandon();
+              if (blob_separator) {
+                blob_separator->Abandon();
+              }
               return status;
             }
             meta->UpdateBoundaryUserValues(user_values, UpdateBoundariesType::kAll);
@@ -205,6 +224,9 @@ Status BuildTable(const std::string& dbname,
         // Finish and check for builder errors
         bool empty = builder->NumEntries() == 0;
         s = c_iter.status();
+        if (s.ok() && !empty && blob_separator) {
+          s = blob_separator->Finish(meta);
+        }
         if (!s.ok() || empty) {
           builder->Abandon();
         } else {
@@ -272,6 +294,9 @@ Status BuildTable(const std::string& dbname,
       }
 
       if (!s.ok() || meta->fd.GetTotalFileSize() == 0) {
+        if (blob_separator) {
+          blob_separator->Abandon();
+        }
         if (!env->CleanupFile(base_fname, db_options.log_prefix)) {
           do_retry = false;
         }
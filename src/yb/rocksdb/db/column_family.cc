@@ -538,6 +538,24 @@ std::unique_ptr<WriteControllerToken> SetupDelay(
   return write_controller->GetDelayToken(write_rate);
 }
 
+// Returns ratio of how far the value went from the slowdown limit to the stop limit.
+// Reaching the slowdown limit already gives non zero pressure, so writes are delayed.
+double StallPressure(uint64_t value, uint64_t slowdown_limit, uint64_t stop_limit) {
+  if (value < slowdown_limit || stop_limit <= slowdown_limit) {
+    return 0.0;
+  }
+  if (value >= stop_limit) {
+    return 1.0;
+  }
+  return static_cast<double>(value - slowdown_limit + 1) / (stop_limit - slowdown_limit + 1);
+}
+
+uint64_t ProportionalWriteRate(uint64_t max_write_rate, double write_stall_pressure) {
+  const uint64_t kMinWriteRate = 1024u;  // Minimum write rate 1KB/s.
+  return std::max(
+      kMinWriteRate, static_cast<uint64_t>(max_write_rate * (1.0 - write_stall_pressure)));
+}
+
 int GetL0ThresholdSpeedupCompaction(int level0_file_num_compaction_trigger,
                                     int level0_slowdown_writes_trigger) {
   // SanitizeOptions() ensures it.
@@ -565,6 +583,34 @@ void ColumnFamilyData::RecalculateWriteStallConditions(
     uint64_t compaction_needed_bytes =
         vstorage->estimated_compaction_needed_bytes();
 
+    // Compaction debt is predicted to keep growing at the same pace, as since the previous
+    // recalculation, so writers are slowed down before the limits are actually reached.
+    const uint64_t predicted_compaction_needed_bytes =
+        compaction_needed_bytes + (compaction_needed_bytes > prev_compaction_needed_bytes_
+            ? compaction_needed_bytes - prev_compaction_needed_bytes_ : 0);
+    double write_stall_pressure = 0.0;
+    if (imm()->NumNotFlushed() >= mutable_cf_options.max_write_buffer_number) {
+      write_stall_pressure = 1.0;
+    } else if (mutable_cf_options.max_write_buffer_number > 3 &&
+               imm()->NumNotFlushed() >= mutable_cf_options.max_write_buffer_number - 1) {
+      write_stall_pressure = 0.5;
+    }
+    if (mutable_cf_options.level0_slowdown_writes_trigger >= 0) {
+      write_stall_pressure = std::max(write_stall_pressure, StallPressure(
+          vstorage->l0_delay_trigger_count(), mutable_cf_options.level0_slowdown_writes_trigger,
+          mutable_cf_options.level0_stop_writes_trigger));
+    }
+    if (mutable_cf_options.hard_pending_compaction_bytes_limit > 0 &&
+        compaction_needed_bytes >= mutable_cf_options.hard_pending_compaction_bytes_limit) {
+      write_stall_pressure = 1.0;
+    } else if (mutable_cf_options.soft_pending_compaction_bytes_limit > 0) {
+      // Predicted debt alone never stops writes, so its pressure stays below 1.
+      write_stall_pressure = std::max(write_stall_pressure, std::min(0.99, StallPressure(
+          predicted_compaction_needed_bytes, mutable_cf_options.soft_pending_compaction_bytes_limit,
+          mutable_cf_options.hard_pending_compaction_bytes_limit)));
+    }
+    write_stall_pressure_.store(write_stall_pressure, std::memory_order_release);
+
     if (imm()->NumNotFlushed() >= mutable_cf_options.max_write_buffer_number) {
       write_controller_token_ = write_controller->GetStopToken();
       internal_stats_->AddCFStats(InternalStats::MEMTABLE_COMPACTION, 1);
@@ -594,6 +640,19 @@ void ColumnFamilyData::RecalculateWriteStallConditions(
           "[%s] Stopping writes because of estimated pending compaction "
           "bytes %" PRIu64,
           name_.c_str(), compaction_needed_bytes);
+    } else if (ioptions_.proportional_write_delay && write_stall_pressure > 0) {
+      write_controller_token_ = write_controller->GetDelayToken(
+          mutable_cf_options.disable_auto_compactions
+              ? ioptions_.delayed_write_rate
+              : ProportionalWriteRate(ioptions_.delayed_write_rate, write_stall_pressure));
+      internal_stats_->AddCFStats(InternalStats::PROPORTIONAL_WRITE_SLOWDOWN, 1);
+      RLOG(InfoLogLevel::WARN_LEVEL, ioptions_.info_log,
+          "[%s] Stalling writes because of write stall pressure %.2f, we have %d immutable "
+          "memtables, %d level-0 files, estimated pending compaction bytes %" PRIu64
+          " rate %" PRIu64,
+          name_.c_str(), write_stall_pressure, imm()->NumNotFlushed(),
+          vstorage->l0_delay_trigger_count(), compaction_needed_bytes,
+          write_controller->delayed_write_rate());
     } else if (mutable_cf_options.max_write_buffer_number > 3 &&
                imm()->NumNotFlushed() >=
                    mutable_cf_options.max_write_buffer_number - 1) {
@@ -338,6 +338,13 @@ class ColumnFamilyData {
   void RecalculateWriteStallConditions(
       const MutableCFOptions& mutable_cf_options);
 
+  // Pressure of pending flushes and compactions on writes, calculated by the last
+  // RecalculateWriteStallConditions. 0 means writes are not delayed, 1 means writes are stopped.
+  // Could be called without DB mutex.
+  double write_stall_pressure() const {
+    return write_stall_pressure_.load(std::memory_order_acquire);
+  }
+
  private:
   friend class ColumnFamilySet;
   ColumnFamilyData(uint32_t id, const std::string& name,
@@ -399,6 +406,7 @@ class ColumnFamilyData {
   ColumnFamilySet* column_family_set_;
 
   std::unique_ptr<WriteControllerToken> write_controller_token_;
+  std::atomic<double> write_stall_pressure_{0.0};
 
   // If true --> this ColumnFamily is currently present in DBImpl::flush_queue_
   bool pending_flush_;
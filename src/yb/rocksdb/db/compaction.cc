@@ -588,7 +588,13 @@ bool Compaction::ShouldFormSubcompactions() const {
   if (cfd_->ioptions()->compaction_style == kCompactionStyleLevel) {
     return start_level_ == 0 && !IsOutputLevelEmpty();
   } else if (IsCompactionStyleUniversal()) {
-    return number_levels_ > 1 && output_level_ > 0;
+    if (number_levels_ == 1) {
+      // Outputs of subcompactions stay in level 0 and are picked as a single sorted run later, see
+      // FileMetaData::sorted_run_id. Only full compactions are split, since those are the long
+      // running ones.
+      return is_full_compaction_;
+    }
+    return output_level_ > 0;
   } else {
     return false;
   }
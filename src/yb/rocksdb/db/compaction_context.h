@@ -58,8 +58,8 @@ class CompactionContext {
 };
 
 struct CompactionContextOptions {
-  // In YugabyteDB we use only level0, so for code simplicity pass level0 inputs only.
-  const std::vector<FileMetaData*>& level0_inputs;
+  // Input files of all levels of the compaction.
+  const std::vector<FileMetaData*>& inputs;
   BoundaryValuesExtractor* boundary_extractor;
 };
 
@@ -23,6 +23,7 @@
 #include "yb/rocksdb/db/compaction_iterator.h"
 #include <iterator>
 
+#include "yb/rocksdb/db/blob_file.h"
 #include "yb/rocksdb/table/internal_iterator.h"
 
 #include "yb/util/status_log.h"
@@ -82,6 +83,33 @@ void CompactionIterator::AddLiveRanges(const std::vector<std::pair<Slice, Slice>
   }
 }
 
+void CompactionIterator::SetBlobResolver(
+    BlobFileCache* blob_cache, ResolvedBlobs* resolved_blobs) {
+  blob_cache_ = blob_cache;
+  resolved_blobs_ = resolved_blobs;
+}
+
+bool CompactionIterator::ResolveBlobIndex() {
+  BlobIndex index;
+  status_ = index.DecodeFrom(value_);
+  if (status_.ok()) {
+    status_ = blob_cache_->Get(index, &blob_value_);
+  }
+  if (!status_.ok()) {
+    valid_ = false;
+    return false;
+  }
+  ikey_.type = kTypeValue;
+  current_key_.UpdateInternalKey(ikey_.sequence, kTypeValue);
+  key_ = current_key_.GetKey();
+  ikey_.user_key = current_key_.GetUserKey();
+  value_ = blob_value_;
+  if (resolved_blobs_) {
+    resolved_blobs_->Add(ikey_.user_key, index, value_);
+  }
+  return true;
+}
+
 void CompactionIterator::ResetRecordCounts() {
   iter_stats_.num_record_drop_user = 0;
   iter_stats_.num_record_drop_hidden = 0;
@@ -215,6 +243,11 @@ void CompactionIterator::NextFromInput() {
       current_user_key_sequence_ = kMaxSequenceNumber;
       current_user_key_snapshot_ = 0;
 
+      if (blob_cache_ != nullptr && compaction_filter_ != nullptr &&
+          ikey_.type == kTypeBlobIndex && !ResolveBlobIndex()) {
+        return;
+      }
+
       // apply the compaction filter to the first occurrence of the user key
       if (compaction_filter_ != nullptr && ikey_.type == kTypeValue &&
           (visible_at_tip_ || ikey_.sequence > latest_snapshot_ ||
@@ -267,9 +300,16 @@ void CompactionIterator::NextFromInput() {
       // In the previous iteration we encountered a single delete that we could
       // not compact out.  We will keep this Put, but can drop it's data.
       // (See Optimization 3, below.)
-      assert(ikey_.type == kTypeValue);
+      assert(ikey_.type == kTypeValue || ikey_.type == kTypeBlobIndex);
       assert(current_user_key_snapshot_ == last_snapshot);
 
+      if (ikey_.type == kTypeBlobIndex) {
+        // Value is dropped, so there is nothing to refer to.
+        ikey_.type = kTypeValue;
+        current_key_.UpdateInternalKey(ikey_.sequence, kTypeValue);
+        key_ = current_key_.GetKey();
+        ikey_.user_key = current_key_.GetUserKey();
+      }
       value_.clear();
       valid_ = true;
       clear_and_output_next_key_ = false;
@@ -459,6 +499,9 @@ void CompactionIterator::NextFromInput() {
         has_current_user_key_ = false;
       }
     } else {
+      if (blob_cache_ != nullptr && ikey_.type == kTypeBlobIndex && !ResolveBlobIndex()) {
+        return;
+      }
       valid_ = true;
     }
   }
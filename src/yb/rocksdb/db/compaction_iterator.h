@@ -34,6 +34,9 @@
 
 namespace rocksdb {
 
+class BlobFileCache;
+class ResolvedBlobs;
+
 struct CompactionIteratorStats {
   // Compaction statistics
   int64_t num_record_drop_user = 0;
@@ -67,6 +70,10 @@ class CompactionIterator {
   // See live_key_ranges_stack_ comment for details.
   void AddLiveRanges(const std::vector<std::pair<Slice, Slice>>& ranges);
 
+  // Makes iterator output values stored in blob files instead of kTypeBlobIndex entries.
+  // Values that were read are added to resolved_blobs, when it is specified.
+  void SetBlobResolver(BlobFileCache* blob_cache, ResolvedBlobs* resolved_blobs);
+
   // Seek to the beginning of the compaction iterator output.
   //
   // REQUIRED: Call only once.
@@ -95,6 +102,10 @@ class CompactionIterator {
   // compression.
   void PrepareOutput();
 
+  // Replaces current kTypeBlobIndex entry with the value it refers to.
+  // Returns false and sets status_ if the value could not be read.
+  bool ResolveBlobIndex();
+
   // Given a sequence number, return the sequence number of the
   // earliest snapshot that this sequence number is visible in.
   // The snapshots themselves are arranged in ascending order of
@@ -168,5 +179,9 @@ class CompactionIterator {
   // lexicographically first. Ranges are popped off the back of the stack as our iteration passes
   // them.
   std::vector<std::pair<Slice, Slice>> live_key_ranges_stack_;
+
+  BlobFileCache* blob_cache_ = nullptr;
+  ResolvedBlobs* resolved_blobs_ = nullptr;
+  std::string blob_value_;
 };
 }  // namespace rocksdb
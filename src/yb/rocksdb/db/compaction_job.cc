@@ -43,6 +43,7 @@
 #include "yb/rocksdb/statistics.h"
 #include "yb/rocksdb/table.h"
 
+#include "yb/rocksdb/db/blob_file.h"
 #include "yb/rocksdb/db/builder.h"
 #include "yb/rocksdb/db/compaction_context.h"
 #include "yb/rocksdb/db/dbformat.h"
@@ -52,10 +53,12 @@
 #include "yb/rocksdb/db/memtable.h"
 #include "yb/rocksdb/db/memtable_list.h"
 #include "yb/rocksdb/db/merge_helper.h"
+#include "yb/rocksdb/db/table_cache.h"
 #include "yb/rocksdb/db/version_set.h"
 
 #include "yb/rocksdb/table/internal_iterator.h"
 #include "yb/rocksdb/table/table_builder.h"
+#include "yb/rocksdb/table/table_reader.h"
 
 #include "yb/rocksdb/util/file_reader_writer.h"
 #include "yb/rocksdb/util/file_util.h"
@@ -104,9 +107,15 @@ struct CompactionJob::SubcompactionState : public CompactionFeed {
   std::unique_ptr<WritableFileWriter> base_outfile;
   std::unique_ptr<WritableFileWriter> data_outfile;
   std::unique_ptr<TableBuilder> builder;
+  // Moves large values of the current output to the blob file, see blob_file.h.
+  std::unique_ptr<BlobSeparator> blob_separator;
+  std::unique_ptr<ResolvedBlobs> resolved_blobs;
 
   CompactionFeed* feed = nullptr; // Owned externally.
   CompactionContextPtr context;
+  // Largest user frontier reported by context, merged into the job one when all subcompactions
+  // are done.
+  UserFrontierPtr largest_user_frontier;
 
   Output* current_output() {
     if (outputs.empty()) {
@@ -141,15 +150,24 @@ struct CompactionJob::SubcompactionState : public CompactionFeed {
 
   Status Feed(const Slice& key, const Slice& value) override {
     // Open output file if necessary
-    if (builder == nullptr) {
+    const bool first_key = builder == nullptr;
+    if (first_key) {
       RETURN_NOT_OK(open_compaction_output_file());
-      current_output()->meta.UpdateKey(key, UpdateBoundariesType::kSmallest);
     }
     DCHECK_ONLY_NOTNULL(builder);
     DCHECK_ONLY_NOTNULL(current_output());
 
-    builder->Add(key, value);
-    current_output()->meta.UpdateBoundarySeqNo(GetInternalKeySeqno(key));
+    Slice output_key = key;
+    Slice output_value = value;
+    if (blob_separator) {
+      RETURN_NOT_OK(blob_separator->Process(&output_key, &output_value));
+    }
+    if (first_key) {
+      current_output()->meta.UpdateKey(output_key, UpdateBoundariesType::kSmallest);
+    }
+
+    builder->Add(output_key, output_value);
+    current_output()->meta.UpdateBoundarySeqNo(GetInternalKeySeqno(output_key));
     num_output_records++;
     return Status::OK();
   }
@@ -172,6 +190,9 @@ struct CompactionJob::CompactionState {
   uint64_t num_input_records;
   uint64_t num_output_records;
 
+  // Blob files referenced from the current version, see blob_file.h.
+  BlobFileInfoMap blob_files;
+
   explicit CompactionState(Compaction* c)
       : compaction(c),
         total_bytes(0),
@@ -295,6 +316,15 @@ void CompactionJob::Prepare() {
   // Is this compaction producing files at the bottommost level?
   bottommost_level_ = c->bottommost_level();
 
+  {
+    const auto* storage_info = c->column_family_data()->current()->storage_info();
+    for (int level = 0; level < storage_info->num_levels(); ++level) {
+      AddBlobFileRefs(storage_info->LevelFiles(level), &compact_->blob_files);
+    }
+    MarkBlobFilesForRelocation(
+        c->column_family_data()->ioptions()->blob_garbage_collection_ratio, &compact_->blob_files);
+  }
+
   if (c->ShouldFormSubcompactions()) {
     const uint64_t start_micros = env_->NowMicros();
     GenSubcompactionBoundaries();
@@ -352,6 +382,11 @@ void CompactionJob::GenSubcompactionBoundaries() {
           bounds.emplace_back(flevel->files[i].smallest.key);
           bounds.emplace_back(flevel->files[i].largest.key);
         }
+        if (out_lvl == 0) {
+          // When level 0 is the only level, files usually cover the whole key space, so their
+          // smallest and largest keys do not split it. Use middle keys of the files as well.
+          SampleMiddleKeys(*flevel);
+        }
       } else {
         // For all other levels add the smallest/largest key in the level to
         // encompass the range covered by that level
@@ -370,6 +405,10 @@ void CompactionJob::GenSubcompactionBoundaries() {
     }
   }
 
+  for (const auto& key : sampled_keys_) {
+    bounds.emplace_back(key);
+  }
+
   std::sort(bounds.begin(), bounds.end(),
     [cfd_comparator] (const Slice& a, const Slice& b) -> bool {
       return cfd_comparator->Compare(ExtractUserKey(a), ExtractUserKey(b)) < 0;
@@ -401,9 +440,15 @@ void CompactionJob::GenSubcompactionBoundaries() {
 
   // Group the ranges into subcompactions
   const double min_file_fill_percent = 4.0 / 5;
+  const auto* mutable_cf_options = cfd->GetCurrentMutableCFOptions();
+  auto max_file_size = mutable_cf_options->MaxFileSizeForLevel(out_lvl);
+  if (max_file_size == std::numeric_limits<uint64_t>::max()) {
+    // Output file size is not limited for level 0 of universal compaction, use the base target
+    // file size to avoid splitting small compactions.
+    max_file_size = mutable_cf_options->target_file_size_base;
+  }
   uint64_t max_output_files = static_cast<uint64_t>(std::ceil(
-      sum / min_file_fill_percent /
-      cfd->GetCurrentMutableCFOptions()->MaxFileSizeForLevel(out_lvl)));
+      sum / min_file_fill_percent / max_file_size));
   uint64_t subcompactions =
       std::min({static_cast<uint64_t>(ranges.size()),
                 static_cast<uint64_t>(db_options_.max_subcompactions),
@@ -424,7 +469,19 @@ void CompactionJob::GenSubcompactionBoundaries() {
         continue;
       }
       if (sum >= mean) {
-        boundaries_.emplace_back(ExtractUserKey(ranges[i].range.limit));
+        auto boundary = ExtractUserKey(ranges[i].range.limit);
+        if (db_options_.subcompaction_boundary_extractor) {
+          // Keep keys sharing the extracted prefix in the same subcompaction.
+          const auto prefix_size = (*db_options_.subcompaction_boundary_extractor)(boundary);
+          if (prefix_size == 0) {
+            continue;
+          }
+          boundary.remove_suffix(boundary.size() - prefix_size);
+        }
+        if (!boundaries_.empty() && cfd_comparator->Compare(boundary, boundaries_.back()) <= 0) {
+          continue;
+        }
+        boundaries_.emplace_back(boundary);
         sizes_.emplace_back(sum);
         subcompactions--;
         sum = 0;
@@ -437,6 +494,26 @@ void CompactionJob::GenSubcompactionBoundaries() {
   }
 }
 
+void CompactionJob::SampleMiddleKeys(const LevelFilesBrief& files) {
+  auto* cfd = compact_->compaction->column_family_data();
+  for (size_t i = 0; i < files.num_files; i++) {
+    auto trwh = cfd->table_cache()->GetTableReader(
+        env_options_, cfd->internal_comparator(), files.files[i].fd, kDefaultQueryId,
+        /* no_io = */ false, /* file_read_hist = */ nullptr, /* skip_filters = */ true);
+    if (!trwh.ok()) {
+      RLOG(InfoLogLevel::WARN_LEVEL, db_options_.info_log,
+          "[JOB %d] Failed to open file %" PRIu64 " to sample subcompaction boundary: %s",
+          job_id_, files.files[i].fd.GetNumber(), trwh.status().ToString().c_str());
+      continue;
+    }
+    // Incomplete status is returned for files that are too small to have a middle key.
+    auto middle_key = trwh->table_reader->GetMiddleKey();
+    if (middle_key.ok()) {
+      sampled_keys_.push_back(std::move(*middle_key));
+    }
+  }
+}
+
 Result<FileNumbersHolder> CompactionJob::Run() {
   DEBUG_ONLY_TEST_SYNC_POINT("CompactionJob::Run():Start");
   log_buffer_->FlushBufferToLog();
@@ -484,6 +561,14 @@ Result<FileNumbersHolder> CompactionJob::Run() {
     }
   }
 
+  // Each subcompaction has its own compaction context, so persist the largest of their frontiers.
+  for (const auto& state : compact_->sub_compact_states) {
+    if (state.largest_user_frontier) {
+      UpdateUserFrontier(
+          &largest_user_frontier_, state.largest_user_frontier, UpdateUserValueType::kLargest);
+    }
+  }
+
   TablePropertiesCollection tp;
   for (const auto& state : compact_->sub_compact_states) {
     for (const auto& output : state.outputs) {
@@ -646,8 +731,13 @@ void CompactionJob::ProcessKeyValueCompaction(
     }
 
     if (db_options_.compaction_context_factory) {
+      std::vector<FileMetaData*> inputs;
+      for (size_t which = 0; which < compact_->compaction->num_input_levels(); ++which) {
+        const auto& level_inputs = *compact_->compaction->inputs(which);
+        inputs.insert(inputs.end(), level_inputs.begin(), level_inputs.end());
+      }
       auto context = CompactionContextOptions{
-          .level0_inputs = *compact_->compaction->inputs(0),
+          .inputs = inputs,
           .boundary_extractor = sub_compact->boundary_extractor,
       };
       sub_compact->context = (*db_options_.compaction_context_factory)(sub_compact, context);
@@ -665,6 +755,14 @@ void CompactionJob::ProcessKeyValueCompaction(
       sub_compact->c_iter->AddLiveRanges(sub_compact->context->GetLiveRanges());
     }
 
+    // Compaction filter and compaction context need actual values. Remember values that were read
+    // from blob files, so unchanged values keep referring to the same blobs.
+    if (!compact_->blob_files.empty() && (compaction_filter || sub_compact->context)) {
+      sub_compact->resolved_blobs = std::make_unique<ResolvedBlobs>(cfd->user_comparator());
+      sub_compact->c_iter->SetBlobResolver(
+          cfd->table_cache()->blob_cache(), sub_compact->resolved_blobs.get());
+    }
+
     sub_compact->open_compaction_output_file = [this, holder, sub_compact]() {
       if (sub_compact->output_file_number == 0) {
         // This is a first attempt - generate file number.
@@ -756,7 +854,7 @@ void CompactionJob::ProcessKeyValueCompaction(
   // This is used to persist the history cutoff hybrid time chosen for the DocDB compaction
   // filter.
   if (sub_compact->context) {
-    largest_user_frontier_ = sub_compact->context->GetLargestUserFrontier();
+    sub_compact->largest_user_frontier = sub_compact->context->GetLargestUserFrontier();
   }
 
   const auto& c_iter_stats = sub_compact->c_iter->iter_stats();
@@ -777,6 +875,9 @@ void CompactionJob::ProcessKeyValueCompaction(
   if (status.ok()) {
     status = input->status();
   }
+  if (status.ok()) {
+    status = sub_compact->c_iter->status();
+  }
 
   if (measure_io_stats_) {
     sub_compact->compaction_job_stats.file_write_nanos +=
@@ -905,6 +1006,9 @@ Status CompactionJob::FinishCompactionOutputFile(
   if (status.ok() && sub_compact->context) {
     status = sub_compact->context->UpdateMeta(&meta);
   }
+  if (status.ok() && sub_compact->blob_separator) {
+    status = sub_compact->blob_separator->Finish(&meta);
+  }
   if (status.ok()) {
     status = sub_compact->builder->Finish();
   } else {
@@ -998,6 +1102,10 @@ Status CompactionJob::FinishCompactionOutputFile(
     }
   }
 
+  if (!status.ok() && sub_compact->blob_separator) {
+    sub_compact->blob_separator->Abandon();
+  }
+  sub_compact->blob_separator.reset();
   sub_compact->builder.reset();
   return status;
 }
@@ -1032,8 +1140,25 @@ Status CompactionJob::InstallCompactionResults(
   // Add compaction outputs
   compaction->AddInputDeletions(compaction->edit());
 
-  for (const auto& sub_compact : compact_->sub_compact_states) {
-    for (const auto& out : sub_compact.outputs) {
+  // Outputs of level 0 subcompactions cover disjoint key ranges, so they are marked as a single
+  // sorted run for the universal compaction picker.
+  uint64_t sorted_run_id = 0;
+  size_t num_outputs = 0;
+  if (compaction->output_level() == 0 && compact_->sub_compact_states.size() > 1) {
+    for (const auto& sub_compact : compact_->sub_compact_states) {
+      for (const auto& out : sub_compact.outputs) {
+        const auto file_number = out.meta.fd.GetNumber();
+        sorted_run_id = num_outputs == 0 ? file_number : std::min(sorted_run_id, file_number);
+        ++num_outputs;
+      }
+    }
+  }
+
+  for (auto& sub_compact : compact_->sub_compact_states) {
+    for (auto& out : sub_compact.outputs) {
+      if (num_outputs > 1) {
+        out.meta.sorted_run_id = sorted_run_id;
+      }
       compaction->edit()->AddFile(compaction->output_level(), out.meta);
     }
   }
@@ -1140,6 +1265,12 @@ Status CompactionJob::OpenCompactionOutputFile(
       sub_compact->base_outfile.get(), sub_compact->data_outfile.get(),
       sub_compact->compaction->output_compression(), cfd->ioptions()->compression_opts,
       skip_filters);
+  if (cfd->ioptions()->min_blob_size > 0 || !compact_->blob_files.empty()) {
+    sub_compact->blob_separator = std::make_unique<BlobSeparator>(
+        *cfd->ioptions(), env_options_, cfd->table_cache()->blob_cache(), file_number,
+        sub_compact->compaction->output_path_id(), &compact_->blob_files,
+        sub_compact->resolved_blobs.get());
+  }
   LogFlush(db_options_.info_log);
   return Status::OK();
 }
@@ -1152,6 +1283,7 @@ void CompactionJob::CleanupCompaction() {
       // May happen if we get a shutdown call in the middle of compaction
       sub_compact.builder->Abandon();
       sub_compact.builder.reset();
+      sub_compact.blob_separator.reset();
     } else if (sub_status.ok() &&
         (sub_compact.base_outfile != nullptr || sub_compact.data_outfile != nullptr)) {
       std::string log_message;
@@ -1168,6 +1300,7 @@ void CompactionJob::CleanupCompaction() {
       // them here because this compaction was not committed.
       if (!sub_status.ok()) {
         TableCache::Evict(table_cache_.get(), out.meta.fd.GetNumber());
+        BlobFileCache::Evict(table_cache_.get(), out.meta.fd.GetNumber());
       }
     }
   }
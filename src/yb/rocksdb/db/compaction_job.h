@@ -60,6 +60,7 @@ using yb::Result;
 
 class MemTable;
 class TableCache;
+struct LevelFilesBrief;
 class Version;
 class VersionEdit;
 class VersionSet;
@@ -105,6 +106,8 @@ class CompactionJob {
 
   void AggregateStatistics();
   void GenSubcompactionBoundaries();
+  // Adds middle keys of the specified files to sampled_keys_.
+  void SampleMiddleKeys(const LevelFilesBrief& files);
 
   // update the thread status for starting a compaction.
   void ReportStartedCompaction(Compaction* compaction);
@@ -180,6 +183,8 @@ class CompactionJob {
   bool measure_io_stats_;
   // Stores the Slices that designate the boundaries for each subcompaction
   std::vector<Slice> boundaries_;
+  // Owns keys sampled from input files that boundaries_ could point to.
+  std::vector<std::string> sampled_keys_;
   // Stores the approx size of keys covered in the range of each subcompaction
   std::vector<uint64_t> sizes_;
 
@@ -464,25 +464,46 @@ void CompactionPicker::GetGrandparents(
   }
 }
 
-void CompactionPicker::MarkL0FilesForDeletion(
+size_t CompactionPicker::MarkFilesForDeletion(
     const VersionStorageInfo* vstorage,
     const ImmutableCFOptions* ioptions) {
   // CompactionFileFilterFactory is used to determine files that can be directly removed during
   // compaction rather than requiring a full iteration through the files.
   if (!ioptions->compaction_file_filter_factory) {
-    return;
+    return 0;
+  }
+  // Compaction file filter factory should look at files of all levels, so a file is not expired
+  // while newer data that is still kept resides in another level.
+  std::vector<FileMetaData*> files;
+  for (int level = 0; level < vstorage->num_levels(); ++level) {
+    const auto& level_files = vstorage->LevelFiles(level);
+    files.insert(files.end(), level_files.begin(), level_files.end());
   }
-  // Compaction file filter factory should only look at files in Level 0.
-  auto file_filter = ioptions->compaction_file_filter_factory->CreateCompactionFileFilter(
-      vstorage->LevelFiles(0));
+  auto file_filter = ioptions->compaction_file_filter_factory->CreateCompactionFileFilter(files);
   if (!file_filter) {
-    return;
+    return 0;
   }
-  for (FileMetaData* f : vstorage->LevelFiles(0)) {
+  size_t result = 0;
+  for (FileMetaData* f : files) {
     if (file_filter->Filter(f) == FilterDecision::kDiscard) {
       f->set_delete_after_compaction(true);
     }
+    if (f->delete_after_compaction() && !f->being_compacted) {
+      ++result;
+    }
   }
+  return result;
+}
+
+bool CompactionPicker::HasFilesToDelete(const VersionStorageInfo* vstorage) {
+  for (int level = 0; level < vstorage->num_levels(); ++level) {
+    for (const auto* f : vstorage->LevelFiles(level)) {
+      if (f->delete_after_compaction() && !f->being_compacted) {
+        return true;
+      }
+    }
+  }
+  return false;
 }
 
 std::unique_ptr<Compaction> CompactionPicker::CompactRangeLevel0WithSizeLimit(
@@ -609,7 +630,7 @@ std::unique_ptr<Compaction> CompactionPicker::CompactRangeAllLevels(
       /* is_manual = */ true, /* score = */ -1, /* deletion_compaction = */ false,
       compaction_reason);
   if (compaction && start_level == 0) {
-    MarkL0FilesForDeletion(vstorage, &ioptions_);
+    MarkFilesForDeletion(vstorage, &ioptions_);
     level0_compactions_in_progress_.insert(compaction.get());
   }
   return compaction;
@@ -756,7 +777,7 @@ std::unique_ptr<Compaction> CompactionPicker::CompactRange(
 
   DEBUG_ONLY_TEST_SYNC_POINT_CALLBACK("CompactionPicker::CompactRange:Return", compaction.get());
   if (input_level == 0) {
-    MarkL0FilesForDeletion(vstorage, &ioptions_);
+    MarkFilesForDeletion(vstorage, &ioptions_);
     level0_compactions_in_progress_.insert(compaction.get());
   }
 
@@ -1000,7 +1021,7 @@ Status CompactionPicker::SanitizeCompactionInputFiles(
 
 bool LevelCompactionPicker::NeedsCompaction(const VersionStorageInfo* vstorage)
     const {
-  if (!vstorage->FilesMarkedForCompaction().empty()) {
+  if (!vstorage->FilesMarkedForCompaction().empty() || HasFilesToDelete(vstorage)) {
     return true;
   }
   for (int i = 0; i <= vstorage->MaxInputLevel(); i++) {
@@ -1065,6 +1086,13 @@ std::unique_ptr<Compaction> LevelCompactionPicker::PickCompaction(
   double score = 0;
   CompactionReason compaction_reason = CompactionReason::kUnknown;
 
+  // Expired files are removed first, since it does not require any I/O and frees space.
+  auto deletion_compaction = PickDirectDeletionCompaction(
+      cf_name, mutable_cf_options, vstorage, log_buffer);
+  if (deletion_compaction) {
+    return deletion_compaction;
+  }
+
   // Find the compactions by size on all levels.
   bool skipped_l0 = false;
   for (int i = 0; i < NumberLevels() - 1; i++) {
@@ -1189,6 +1217,60 @@ std::unique_ptr<Compaction> LevelCompactionPicker::PickCompaction(
   return c;
 }
 
+std::unique_ptr<Compaction> LevelCompactionPicker::PickDirectDeletionCompaction(
+    const std::string& cf_name, const MutableCFOptions& mutable_cf_options,
+    VersionStorageInfo* vstorage, LogBuffer* log_buffer) {
+  if (!ioptions_.compaction_file_filter_factory) {
+    return nullptr;
+  }
+  MarkFilesForDeletion(vstorage, &ioptions_);
+
+  // Pick marked files from the bottom level first, since they usually are the largest ones.
+  for (int level = NumberLevels() - 1; level >= 0; --level) {
+    // Level 0 files could be removed only when no other level 0 compaction is running, because
+    // the running compaction could generate a level 0 file which has to be ordered before them.
+    if (level == 0 && !level0_compactions_in_progress_.empty()) {
+      continue;
+    }
+    CompactionInputFiles inputs;
+    inputs.level = level;
+    for (auto* f : vstorage->LevelFiles(level)) {
+      if (!f->being_compacted && f->delete_after_compaction()) {
+        inputs.files.push_back(f);
+        LOG_TO_BUFFER(log_buffer, "[%s] Level: file deletion picking L%d file %" PRIu64,
+                      cf_name.c_str(), level, f->fd.GetNumber());
+      }
+    }
+    if (inputs.empty()) {
+      continue;
+    }
+
+    auto c = Compaction::Create(
+        vstorage, mutable_cf_options, {std::move(inputs)},
+        /* output_level = */ level,
+        mutable_cf_options.MaxFileSizeForLevel(level),
+        /* max_grandparent_overlap_bytes = */ LLONG_MAX,
+        GetPathId(ioptions_, mutable_cf_options, level),
+        GetCompressionType(ioptions_, level, vstorage->base_level()),
+        /* grandparents = */ {},
+        ioptions_.info_log,
+        /* is_manual = */ false,
+        /* score = */ 1,
+        /* deletion_compaction = */ false,
+        CompactionReason::kLevelDirectDeletion);
+    if (!c) {
+      continue;
+    }
+    if (level == 0) {
+      level0_compactions_in_progress_.insert(c.get());
+    }
+    CompactionOptionsFIFO dummy_compaction_options_fifo;
+    vstorage->ComputeCompactionScore(mutable_cf_options, dummy_compaction_options_fifo);
+    return c;
+  }
+  return nullptr;
+}
+
 /*
  * Find the optimal path to place a file
  * Given a level, finds the path where levels up to it will fit in levels
@@ -1291,7 +1373,7 @@ bool LevelCompactionPicker::PickCompactionBySize(VersionStorageInfo* vstorage,
 bool UniversalCompactionPicker::NeedsCompaction(
     const VersionStorageInfo* vstorage) const {
   const int kLevel0 = 0;
-  return vstorage->CompactionScore(kLevel0) >= 1;
+  return vstorage->CompactionScore(kLevel0) >= 1 || HasFilesToDelete(vstorage);
 }
 
 struct UniversalCompactionPicker::SortedRun {
@@ -1305,6 +1387,21 @@ struct UniversalCompactionPicker::SortedRun {
     assert(compensated_file_size > 0);
     // Allowed either one of level and file.
     assert((level != 0) != (file != nullptr));
+    if (file) {
+      files.push_back(file);
+    }
+  }
+
+  // Returns true if `f` follows the files of this level 0 sorted run in the same sorted run.
+  bool IsContinuedBy(const FileMetaData& f) const {
+    return file && file->sorted_run_id != 0 && f.sorted_run_id == file->sorted_run_id;
+  }
+
+  void Add(FileMetaData* f) {
+    files.push_back(f);
+    size += f->fd.GetTotalFileSize();
+    compensated_file_size += f->compensated_file_size;
+    being_compacted = being_compacted || f->being_compacted;
   }
 
   void Dump(char* out_buf, size_t out_buf_size,
@@ -1321,13 +1418,23 @@ struct UniversalCompactionPicker::SortedRun {
   }
 
   bool delete_after_compaction() const {
-    return file ? file->delete_after_compaction() : false;
+    if (files.empty()) {
+      return false;
+    }
+    for (const auto* f : files) {
+      if (!f->delete_after_compaction()) {
+        return false;
+      }
+    }
+    return true;
   }
 
   int level;
   // `file` Will be null for level > 0. For level = 0, the sorted run is
-  // for this file.
+  // for this file, and the files following it with the same sorted_run_id.
   FileMetaData* file;
+  // All files of a level 0 sorted run, starting with `file`.
+  std::vector<FileMetaData*> files;
   // For level > 0, `size` and `compensated_file_size` are sum of sizes all
   // files in the level. `being_compacted` should be the same for all files
   // in a non-zero level. Use the value here.
@@ -1362,8 +1469,7 @@ void UniversalCompactionPicker::SortedRun::DumpSizeInfo(
              "file %" PRIu64 "[%" ROCKSDB_PRIszt
              "] "
              "with size %" PRIu64 " (compensated size %" PRIu64 ")",
-             file->fd.GetNumber(), sorted_run_count, file->fd.GetTotalFileSize(),
-             file->compensated_file_size);
+             file->fd.GetNumber(), sorted_run_count, size, compensated_file_size);
   } else {
     snprintf(out_buf, out_buf_size,
              "level %d[%" ROCKSDB_PRIszt
@@ -1378,12 +1484,16 @@ std::vector<std::vector<UniversalCompactionPicker::SortedRun>>
                                                    const ImmutableCFOptions& ioptions,
                                                    uint64_t max_file_size) {
   std::vector<std::vector<SortedRun>> ret(1);
-  MarkL0FilesForDeletion(&vstorage, &ioptions);
+  MarkFilesForDeletion(&vstorage, &ioptions);
 
   for (FileMetaData* f : vstorage.LevelFiles(0)) {
     // Any files that can be directly removed during compaction can be included, even if they
     // exceed the "max file size for compaction."
     if (f->fd.GetTotalFileSize() <= max_file_size || f->delete_after_compaction()) {
+      if (!ret.back().empty() && ret.back().back().IsContinuedBy(*f)) {
+        ret.back().back().Add(f);
+        continue;
+      }
       ret.back().emplace_back(0, f, f->fd.GetTotalFileSize(), f->compensated_file_size,
           f->being_compacted);
     // If last sequence is empty it means that there are multiple too-large-to-compact files in
@@ -1868,8 +1978,8 @@ std::unique_ptr<Compaction> UniversalCompactionPicker::PickCompactionUniversalRe
   for (size_t i = start_index; i < first_index_after; i++) {
     auto& picking_sr = sorted_runs[i];
     if (picking_sr.level == 0) {
-      FileMetaData* picking_file = picking_sr.file;
-      inputs[0].files.push_back(picking_file);
+      inputs[0].files.insert(inputs[0].files.end(), picking_sr.files.begin(),
+                             picking_sr.files.end());
     } else {
       auto& files = inputs[picking_sr.level - start_level].files;
       for (auto* f : vstorage->LevelFiles(picking_sr.level)) {
@@ -1921,8 +2031,7 @@ std::unique_ptr<Compaction> UniversalCompactionPicker::PickCompactionUniversalDe
     const auto sr = &sorted_runs[loop];
 
     if (!sr->being_compacted && sr->delete_after_compaction()) {
-      FileMetaData* f = sr->file;
-      input_files.files.push_back(f);
+      input_files.files.insert(input_files.files.end(), sr->files.begin(), sr->files.end());
 
       char file_num_buf[kFormatFileSizeInfoBufSize];
       sr->DumpSizeInfo(file_num_buf, sizeof(file_num_buf), loop);
@@ -2059,8 +2168,8 @@ std::unique_ptr<Compaction> UniversalCompactionPicker::PickCompactionUniversalSi
   for (size_t loop = start_index; loop < sorted_runs.size(); loop++) {
     auto& picking_sr = sorted_runs[loop];
     if (picking_sr.level == 0) {
-      FileMetaData* f = picking_sr.file;
-      inputs[0].files.push_back(f);
+      inputs[0].files.insert(inputs[0].files.end(), picking_sr.files.begin(),
+                             picking_sr.files.end());
     } else {
       auto& files = inputs[picking_sr.level - start_level].files;
       for (auto* f : vstorage->LevelFiles(picking_sr.level)) {
@@ -2085,7 +2194,7 @@ std::unique_ptr<Compaction> UniversalCompactionPicker::PickCompactionUniversalSi
 bool FIFOCompactionPicker::NeedsCompaction(const VersionStorageInfo* vstorage)
     const {
   const int kLevel0 = 0;
-  return vstorage->CompactionScore(kLevel0) >= 1;
+  return vstorage->CompactionScore(kLevel0) >= 1 || HasFilesToDelete(vstorage);
 }
 
 std::unique_ptr<Compaction> FIFOCompactionPicker::PickCompaction(
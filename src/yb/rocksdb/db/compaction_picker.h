@@ -132,6 +132,16 @@ class CompactionPicker {
     return !level0_compactions_in_progress_.empty();
   }
 
+  // Marks files which could be directly removed according to compaction_file_filter_factory.
+  // Returns the number of marked files which are not being compacted.
+  //
+  // Requirement: DB mutex held
+  static size_t MarkFilesForDeletion(const VersionStorageInfo* vstorage,
+                                     const ImmutableCFOptions* ioptions);
+
+  // Returns true if there are files marked for deletion which are not being compacted.
+  static bool HasFilesToDelete(const VersionStorageInfo* vstorage);
+
  protected:
   int NumberLevels() const { return ioptions_.num_levels; }
 
@@ -192,8 +202,6 @@ class CompactionPicker {
                        const CompactionInputFiles& output_level_inputs,
                        std::vector<FileMetaData*>* grandparents);
 
-  static void MarkL0FilesForDeletion(const VersionStorageInfo* vstorage,
-                                     const ImmutableCFOptions* ioptions);
 
   const ImmutableCFOptions& ioptions_;
 
@@ -248,6 +256,13 @@ class LevelCompactionPicker : public CompactionPicker {
                                                 VersionStorageInfo* vstorage,
                                                 CompactionInputFiles* inputs,
                                                 int* level, int* output_level);
+
+  // Marks files which could be removed by the compaction file filter and picks a compaction that
+  // drops the marked files of a single level without rewriting any data.
+  // Returns nullptr if there are no such files.
+  std::unique_ptr<Compaction> PickDirectDeletionCompaction(
+      const std::string& cf_name, const MutableCFOptions& mutable_cf_options,
+      VersionStorageInfo* vstorage, LogBuffer* log_buffer);
 };
 
 class UniversalCompactionPicker : public CompactionPicker {
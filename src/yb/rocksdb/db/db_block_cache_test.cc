@@ -23,8 +23,12 @@
 #include "yb/rocksdb/db/db_test_util.h"
 #include "yb/rocksdb/port/stack_trace.h"
 
+#include "yb/util/mem_tracker.h"
+
 DECLARE_double(cache_single_touch_ratio);
 DECLARE_bool(cache_overflow_single_touch);
+DECLARE_bool(rocksdb_prefetch_keys_with_multi_read);
+DECLARE_bool(use_io_uring_for_multi_read);
 
 namespace rocksdb {
 
@@ -177,6 +181,179 @@ TEST_F(DBBlockCacheTest, TestWithoutCompressedBlockCache) {
   ANNOTATE_UNPROTECTED_WRITE(FLAGS_cache_overflow_single_touch) = true;
 }
 
+TEST_F(DBBlockCacheTest, DataBlockReadahead) {
+  auto table_options = GetTableOptions();
+  auto options = GetOptions(table_options);
+  options.compression = kNoCompression;
+  Reopen(options);
+  InitTable(options);
+  ASSERT_OK(Flush());
+
+  auto scan = [this, &options](const ReadOptions& read_options) -> Result<uint64_t> {
+    auto start = TestGetTickerCount(options, NUMBER_DATA_BLOCK_READAHEADS);
+    std::unique_ptr<Iterator> iter(db_->NewIterator(read_options));
+    size_t num_keys = 0;
+    for (iter->SeekToFirst(); VERIFY_RESULT(iter->CheckedValid()); iter->Next()) {
+      ++num_keys;
+    }
+    if (num_keys != kNumBlocks) {
+      return STATUS_FORMAT(IllegalState, "Wrong number of keys: $0", num_keys);
+    }
+    return TestGetTickerCount(options, NUMBER_DATA_BLOCK_READAHEADS) - start;
+  };
+
+  ReadOptions read_options;
+  ASSERT_EQ(ASSERT_RESULT(scan(read_options)), 0U);
+
+  // Every key has its own data block, so readahead of a few blocks should be started multiple
+  // times, but not for every block.
+  read_options.readahead_size = 4 * kValueSize;
+  auto readaheads = ASSERT_RESULT(scan(read_options));
+  ASSERT_GT(readaheads, 1U);
+  ASSERT_LT(readaheads, kNumBlocks - 2);
+
+  read_options.readahead_deadline = yb::CoarseMonoClock::Now();
+  ASSERT_EQ(ASSERT_RESULT(scan(read_options)), 0U);
+
+  // Seeks don't read data blocks sequentially.
+  read_options.readahead_deadline = yb::CoarseTimePoint::max();
+  readaheads = TestGetTickerCount(options, NUMBER_DATA_BLOCK_READAHEADS);
+  for (size_t i = kNumBlocks; i-- > 0;) {
+    std::unique_ptr<Iterator> iter(db_->NewIterator(read_options));
+    iter->Seek(ToString(i));
+    ASSERT_TRUE(ASSERT_RESULT(iter->CheckedValid()));
+  }
+  ASSERT_EQ(TestGetTickerCount(options, NUMBER_DATA_BLOCK_READAHEADS), readaheads);
+}
+
+TEST_F(DBBlockCacheTest, PrefetchKeys) {
+  auto table_options = GetTableOptions();
+  auto options = GetOptions(table_options);
+  options.compression = kNoCompression;
+  Reopen(options);
+  InitTable(options);
+  ASSERT_OK(Flush());
+
+  auto prefetches = [this, &options](const std::vector<Slice>& keys) -> Result<uint64_t> {
+    auto start = TestGetTickerCount(options, NUMBER_DATA_BLOCK_KEY_PREFETCHES);
+    RETURN_NOT_OK(db_->PrefetchKeys(ReadOptions(), keys));
+    return TestGetTickerCount(options, NUMBER_DATA_BLOCK_KEY_PREFETCHES) - start;
+  };
+
+  // Close data blocks are coalesced into a single prefetch, keys can be passed in any order.
+  ASSERT_EQ(ASSERT_RESULT(prefetches({"5", "1", "3", "1"})), 1U);
+  ASSERT_EQ(ASSERT_RESULT(prefetches({"99"})), 0U);
+  ASSERT_EQ(ASSERT_RESULT(prefetches({})), 0U);
+
+  // Blocks present in the block cache are not prefetched.
+  ASSERT_EQ(Get("1"), std::string(kValueSize, 'a'));
+  ASSERT_EQ(ASSERT_RESULT(prefetches({"1"})), 0U);
+  ASSERT_EQ(ASSERT_RESULT(prefetches({"1", "2"})), 1U);
+}
+
+// Keys passed to PrefetchKeys could be prefixes of the stored user keys, like DocKey without
+// hybrid time.
+TEST_F(DBBlockCacheTest, PrefetchKeyPrefixes) {
+  auto table_options = GetTableOptions();
+  auto options = GetOptions(table_options);
+  options.compression = kNoCompression;
+  Reopen(options);
+  std::string value(kValueSize, 'a');
+  for (size_t i = 0; i != kNumBlocks; ++i) {
+    ASSERT_OK(Put(ToString(i) + "#suffix", value));
+  }
+  ASSERT_OK(Flush());
+
+  auto prefetches = [this, &options](const std::vector<Slice>& keys) -> Result<uint64_t> {
+    auto start = TestGetTickerCount(options, NUMBER_DATA_BLOCK_KEY_PREFETCHES);
+    RETURN_NOT_OK(db_->PrefetchKeys(ReadOptions(), keys));
+    return TestGetTickerCount(options, NUMBER_DATA_BLOCK_KEY_PREFETCHES) - start;
+  };
+
+  // "0" is a prefix of the smallest key of the SST file, "9" is a prefix of the largest one.
+  ASSERT_EQ(ASSERT_RESULT(prefetches({"0"})), 1U);
+  ASSERT_EQ(ASSERT_RESULT(prefetches({"9"})), 1U);
+  ASSERT_EQ(ASSERT_RESULT(prefetches({"/"})), 0U);
+}
+
+TEST_F(DBBlockCacheTest, PrefetchKeysWithMultiRead) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_rocksdb_prefetch_keys_with_multi_read) = true;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_use_io_uring_for_multi_read) = true;
+  auto table_options = GetTableOptions();
+  auto options = GetOptions(table_options);
+  options.compression = kNoCompression;
+  Reopen(options);
+  InitTable(options);
+  ASSERT_OK(Flush());
+
+  auto prefetches = [this, &options](const std::vector<Slice>& keys) -> Result<uint64_t> {
+    auto start = TestGetTickerCount(options, NUMBER_DATA_BLOCK_KEY_PREFETCHES);
+    RETURN_NOT_OK(db_->PrefetchKeys(ReadOptions(), keys));
+    return TestGetTickerCount(options, NUMBER_DATA_BLOCK_KEY_PREFETCHES) - start;
+  };
+
+  // Every data block is read separately, but all of them by a single batch.
+  ASSERT_EQ(ASSERT_RESULT(prefetches({"5", "1", "3", "1"})), 3U);
+
+  // Prefetched blocks are already in the block cache.
+  auto data_misses = TestGetTickerCount(options, BLOCK_CACHE_DATA_MISS);
+  for (const auto* key : {"1", "3", "5"}) {
+    ASSERT_EQ(Get(key), std::string(kValueSize, 'a'));
+  }
+  ASSERT_EQ(TestGetTickerCount(options, BLOCK_CACHE_DATA_MISS), data_misses);
+  ASSERT_EQ(ASSERT_RESULT(prefetches({"1", "2", "3"})), 1U);
+  ASSERT_EQ(ASSERT_RESULT(prefetches({"2"})), 0U);
+}
+
+TEST_F(DBBlockCacheTest, IndexBlocksWithHighPriority) {
+  auto table_options = GetTableOptions();
+  table_options.cache_index_and_filter_blocks = true;
+  table_options.cache_index_blocks_with_high_priority = true;
+  auto options = GetOptions(table_options);
+  Reopen(options);
+  InitTable(options);
+  ASSERT_OK(Flush());
+
+  table_options.block_cache = NewLRUCache(1 << 20);
+  options.table_factory.reset(new BlockBasedTableFactory(table_options));
+  auto multi_touch_adds = TestGetTickerCount(options, BLOCK_CACHE_MULTI_TOUCH_ADD);
+  auto index_misses = TestGetTickerCount(options, BLOCK_CACHE_INDEX_MISS);
+  Reopen(options);
+  ASSERT_EQ(Get("1"), std::string(kValueSize, 'a'));
+
+  // Data blocks are read once, so only index blocks could get to the multi-touch part of the cache.
+  multi_touch_adds = TestGetTickerCount(options, BLOCK_CACHE_MULTI_TOUCH_ADD) - multi_touch_adds;
+  index_misses = TestGetTickerCount(options, BLOCK_CACHE_INDEX_MISS) - index_misses;
+  ASSERT_GT(multi_touch_adds, 0U);
+  ASSERT_LE(multi_touch_adds, index_misses);
+}
+
+TEST_F(DBBlockCacheTest, TableQuota) {
+  auto table_options = GetTableOptions();
+  table_options.block_cache = NewLRUCache(1 << 20);
+  auto options = GetOptions(table_options);
+  options.compression = kNoCompression;
+  options.block_based_table_mem_tracker = yb::MemTracker::CreateTracker(
+      1, "quota", /* parent= */ nullptr, yb::AddToParent::kFalse, yb::CreateMetrics::kFalse);
+  Reopen(options);
+  InitTable(options);
+  ASSERT_OK(Flush());
+
+  // Any block read by the table takes more than its quota.
+  ASSERT_EQ(Get("0"), std::string(kValueSize, 'a'));
+  ASSERT_TRUE(options.block_based_table_mem_tracker->LimitExceeded());
+
+  auto usage = table_options.block_cache->GetUsage();
+  auto bypasses = TestGetTickerCount(options, BLOCK_CACHE_DATA_QUOTA_BYPASSES);
+  auto data_misses = TestGetTickerCount(options, BLOCK_CACHE_DATA_MISS);
+  for (int i = 0; i != 2; ++i) {
+    ASSERT_EQ(Get("1"), std::string(kValueSize, 'a'));
+  }
+  ASSERT_EQ(TestGetTickerCount(options, BLOCK_CACHE_DATA_QUOTA_BYPASSES) - bypasses, 2U);
+  ASSERT_EQ(TestGetTickerCount(options, BLOCK_CACHE_DATA_MISS) - data_misses, 2U);
+  ASSERT_EQ(table_options.block_cache->GetUsage(), usage);
+}
+
 #ifdef SNAPPY
 TEST_F(DBBlockCacheTest, TestWithCompressedBlockCache) {
   ReadOptions read_options;
@@ -215,6 +392,39 @@ TEST_F(DBBlockCacheTest, TestWithCompressedBlockCache) {
   ASSERT_EQ(0, compressed_cache->GetPinnedUsage());
   ANNOTATE_UNPROTECTED_WRITE(FLAGS_cache_overflow_single_touch) = true;
 }
+
+TEST_F(DBBlockCacheTest, TableQuotaWithCompressedBlockCache) {
+  auto table_options = GetTableOptions();
+  table_options.block_cache = NewLRUCache(1 << 20);
+  table_options.block_cache_compressed = NewLRUCache(1 << 20);
+  auto options = GetOptions(table_options);
+  options.compression = CompressionType::kSnappyCompression;
+  auto mem_tracker = yb::MemTracker::CreateTracker(
+      1, "quota", /* parent= */ nullptr, yb::AddToParent::kFalse, yb::CreateMetrics::kFalse);
+  options.block_based_table_mem_tracker = mem_tracker;
+  Reopen(options);
+  InitTable(options);
+  ASSERT_OK(Flush());
+
+  ASSERT_EQ(Get("0"), std::string(kValueSize, 'a'));
+  ASSERT_TRUE(mem_tracker->LimitExceeded());
+
+  // Blocks read while the table is over its quota are not added to any of the caches, and are
+  // freed after use.
+  auto consumption = mem_tracker->consumption();
+  auto usage = table_options.block_cache->GetUsage();
+  auto compressed_usage = table_options.block_cache_compressed->GetUsage();
+  auto compressed_adds = TestGetTickerCount(options, BLOCK_CACHE_COMPRESSED_ADD);
+  auto bypasses = TestGetTickerCount(options, BLOCK_CACHE_DATA_QUOTA_BYPASSES);
+  for (int i = 0; i != 2; ++i) {
+    ASSERT_EQ(Get("1"), std::string(kValueSize, 'a'));
+  }
+  ASSERT_EQ(TestGetTickerCount(options, BLOCK_CACHE_DATA_QUOTA_BYPASSES) - bypasses, 2U);
+  ASSERT_EQ(TestGetTickerCount(options, BLOCK_CACHE_COMPRESSED_ADD), compressed_adds);
+  ASSERT_EQ(table_options.block_cache->GetUsage(), usage);
+  ASSERT_EQ(table_options.block_cache_compressed->GetUsage(), compressed_usage);
+  ASSERT_EQ(mem_tracker->consumption(), consumption);
+}
 #endif
 
 }  // namespace rocksdb
@@ -258,7 +258,7 @@ void TestFlushedOpId(bool compact, DBCompactionTest* test) {
     files.clear();
     test->dbfull()->GetLiveFilesMetaData(&files);
 
-    ASSERT_EQ(1, files.size());
+    ASSERT_EQ(1U, files.size());
   }
 
   ASSERT_OK(test->TryReopen(options));
@@ -2723,6 +2723,54 @@ INSTANTIATE_TEST_CASE_P(DBCompactionTestWithParam, DBCompactionTestWithParam,
                                           std::make_tuple(4, true),
                                           std::make_tuple(4, false)));
 
+// Files of non-zero levels marked by the compaction file filter should be removed by level style
+// compaction without rewriting them.
+TEST_F(DBCompactionTest, LevelDirectDeletion) {
+  auto file_filter_factory = std::make_shared<DiscardUpToFileFilterFactory>();
+  Options options = CurrentOptions();
+  options.compaction_style = kCompactionStyleLevel;
+  options.num_levels = 3;
+  options.level0_file_num_compaction_trigger = 2;
+  options.compaction_file_filter_factory = file_filter_factory;
+  options.statistics = rocksdb::CreateDBStatisticsForTests();
+  DestroyAndReopen(options);
+
+  constexpr int kNumKeys = 100;
+  for (int i = 0; i < kNumKeys; ++i) {
+    ASSERT_OK(Put(Key(i), "expired"));
+  }
+  ASSERT_OK(Flush());
+  MoveFilesToLevel(2);
+  ASSERT_EQ("0,0,1", FilesPerLevel());
+
+  std::vector<LiveFileMetaData> files;
+  db_->GetLiveFilesMetaData(&files);
+  ASSERT_EQ(1U, files.size());
+  ASSERT_EQ(2, files[0].level);
+  const auto expired_file = files[0].name_id;
+  file_filter_factory->SetMaxDiscardedFile(expired_file);
+
+  // Trigger level 0 compaction, which should remove the marked file of level 2.
+  for (int file = 0; file < options.level0_file_num_compaction_trigger; ++file) {
+    ASSERT_OK(Put(Key(kNumKeys + file), "live"));
+    ASSERT_OK(Flush());
+  }
+  ASSERT_OK(dbfull()->TEST_WaitForCompact());
+
+  ASSERT_EQ(1, TestGetTickerCount(options, COMPACTION_FILES_FILTERED));
+  files.clear();
+  db_->GetLiveFilesMetaData(&files);
+  for (const auto& file : files) {
+    ASSERT_NE(expired_file, file.name_id);
+  }
+  for (int i = 0; i < kNumKeys; ++i) {
+    ASSERT_EQ("NOT_FOUND", Get(Key(i)));
+  }
+  for (int file = 0; file < options.level0_file_num_compaction_trigger; ++file) {
+    ASSERT_EQ("live", Get(Key(kNumKeys + file)));
+  }
+}
+
 class CompactionPriTest : public DBTestBase,
                           public testing::WithParamInterface<uint32_t> {
  public:
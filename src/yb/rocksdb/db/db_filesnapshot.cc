@@ -30,6 +30,7 @@
 #include <inttypes.h>
 #include <algorithm>
 #include <string>
+#include <unordered_set>
 #include "yb/rocksdb/db/db_impl.h"
 #include "yb/rocksdb/db/filename.h"
 #include "yb/rocksdb/db/job_context.h"
@@ -132,11 +133,13 @@ Status DBImpl::GetLiveFiles(std::vector<std::string> &ret,
 
   // Make a set of all of the live *.sst files
   std::vector<FileDescriptor> live;
+  std::unordered_set<uint64_t> live_blobs;
   for (auto cfd : *versions_->GetColumnFamilySet()) {
     if (cfd->IsDropped()) {
       continue;
     }
     cfd->current()->AddLiveFiles(&live);
+    cfd->current()->AddLiveBlobFiles(&live_blobs);
   }
 
   ret.clear();
@@ -155,6 +158,9 @@ Status DBImpl::GetLiveFiles(std::vector<std::string> &ret,
       ret.push_back(TableBaseToDataFileName(base_fname));
     }
   }
+  for (auto number : live_blobs) {
+    ret.push_back(MakeBlobFileName("", number));
+  }
 
   ret.push_back(CurrentFileName(""));
   ret.push_back(DescriptorFileName("", versions_->manifest_file_number()));
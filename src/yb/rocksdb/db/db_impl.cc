@@ -56,6 +56,7 @@
 #include "yb/util/priority_thread_pool.h"
 #include "yb/util/atomic.h"
 
+#include "yb/rocksdb/db/blob_file.h"
 #include "yb/rocksdb/db/builder.h"
 #include "yb/rocksdb/db/compaction_job.h"
 #include "yb/rocksdb/db/compaction_picker.h"
@@ -635,7 +636,7 @@ DBOptions SanitizeOptions(const std::string& dbname, const DBOptions& src) {
     result.db_paths.emplace_back(dbname, std::numeric_limits<uint64_t>::max());
   }
 
-  if (result.compaction_readahead_size > 0) {
+  if (result.compaction_readahead_size > 0 || result.use_direct_reads_for_compaction_inputs) {
     result.new_table_reader_for_compaction_inputs = true;
   }
 
@@ -735,6 +736,8 @@ DBImpl::DBImpl(const DBOptions& options, const std::string& dbname)
       next_job_id_(1),
       has_unpersisted_data_(false),
       env_options_(db_options_),
+      env_options_for_compaction_(
+          env_->OptimizeForCompactionTableWrite(env_options_, db_options_)),
       wal_manager_(db_options_, env_options_),
       event_logger_(db_options_.info_log.get()),
       bg_work_paused_(0),
@@ -1027,6 +1030,7 @@ void DBImpl::FindObsoleteFiles(JobContext* job_context, bool force,
   job_context->prev_log_number = versions_->prev_log_number();
 
   versions_->AddLiveFiles(&job_context->sst_live);
+  versions_->AddLiveBlobFiles(&job_context->blob_live);
   if (doing_the_full_scan) {
     InfoLogPrefix info_log_prefix(!db_options_.db_log_dir.empty(), dbname_);
     for (size_t path_id = 0; path_id < db_options_.db_paths.size(); path_id++) {
@@ -1150,6 +1154,10 @@ void DBImpl::PurgeObsoleteFiles(const JobContext& state) {
     candidate_files.emplace_back(
         MakeTableFileName(kDumbDbName, file->fd.GetNumber()),
         file->fd.GetPathId());
+    // Blob files referenced from this file could become obsolete as well.
+    for (const auto& ref : file->blob_refs) {
+      candidate_files.emplace_back(MakeBlobFileName(kDumbDbName, ref.file_number), ref.path_id);
+    }
     delete file;
   }
 
@@ -1198,6 +1206,11 @@ void DBImpl::PurgeObsoleteFiles(const JobContext& state) {
         keep = (sst_live_map.find(number) != sst_live_map.end()) ||
                pending_outputs_->HasFileNumber(number);
         break;
+      case kBlobFile:
+        // Blob file is written together with the sstable with the same number, so it is protected
+        // by pending outputs until the sstable is installed.
+        keep = state.blob_live.count(number) || pending_outputs_->HasFileNumber(number);
+        break;
       case kTableSBlockFile:
         // Just skip, since we will process SST data file during processing of corresponding
         // SST base file.
@@ -1240,6 +1253,9 @@ void DBImpl::PurgeObsoleteFiles(const JobContext& state) {
       // evict from cache
       TableCache::Evict(table_cache_.get(), number);
       fname = TableFileName(db_options_.db_paths, number, path_id);
+    } else if (type == kBlobFile) {
+      BlobFileCache::Evict(table_cache_.get(), number);
+      fname = BlobFileName(db_options_.db_paths, number, path_id);
     } else {
       fname = ((type == kLogFile) ?
           db_options_.wal_dir : dbname_) + "/" + to_delete;
@@ -1889,7 +1905,7 @@ Status DBImpl::WriteLevel0TableForRecovery(int job_id, ColumnFamilyData* cfd,
         s = BuildTable(dbname_,
                        db_options_,
                        *cfd->ioptions(),
-                       env_options_,
+                       env_options_for_compaction_,
                        cfd->table_cache(),
                        iter.get(),
                        &meta,
@@ -1964,7 +1980,7 @@ Result<FileNumbersHolder> DBImpl::FlushMemTableToOutputFile(
   }
 
   FlushJob flush_job(
-      dbname_, cfd, db_options_, mutable_cf_options, env_options_,
+      dbname_, cfd, db_options_, mutable_cf_options, env_options_for_compaction_,
       versions_.get(), &mutex_, &shutting_down_, &disable_flush_on_shutdown_, snapshot_seqs,
       earliest_write_conflict_snapshot, mem_table_flush_filter, pending_outputs_.get(),
       job_context, log_buffer, directories_.GetDbDir(), directories_.GetDataDir(0U),
@@ -2380,7 +2396,7 @@ Status DBImpl::CompactFilesImpl(
 
   assert(is_snapshot_supported_ || snapshots_.empty());
   CompactionJob compaction_job(
-      job_context->job_id, c.get(), db_options_, env_options_, versions_.get(),
+      job_context->job_id, c.get(), db_options_, env_options_for_compaction_, versions_.get(),
       &shutting_down_, log_buffer, directories_.GetDbDir(),
       directories_.GetDataDir(c->output_path_id()), stats_.get(), &mutex_, &bg_error_,
       snapshot_seqs, earliest_write_conflict_snapshot, pending_outputs_.get(), table_cache_,
@@ -3766,7 +3782,7 @@ Result<FileNumbersHolder> DBImpl::BackgroundCompaction(
 
     assert(is_snapshot_supported_ || snapshots_.empty());
     CompactionJob compaction_job(
-        job_context->job_id, c.get(), db_options_, env_options_,
+        job_context->job_id, c.get(), db_options_, env_options_for_compaction_,
         versions_.get(), &shutting_down_, log_buffer, directories_.GetDbDir(),
         directories_.GetDataDir(c->output_path_id()), stats_.get(), &mutex_,
         &bg_error_, snapshot_seqs, earliest_write_conflict_snapshot,
@@ -4148,6 +4164,41 @@ Status DBImpl::GetImpl(const ReadOptions& read_options,
   return s;
 }
 
+Status DBImpl::PrefetchKeys(const ReadOptions& read_options,
+                            ColumnFamilyHandle* column_family,
+                            const std::vector<Slice>& keys) {
+  if (keys.empty()) {
+    return Status::OK();
+  }
+  auto cfh = down_cast<ColumnFamilyHandleImpl*>(column_family);
+  auto cfd = cfh->cfd();
+  auto* ucmp = cfd->user_comparator();
+
+  // Sorted keys let table readers share index lookups and coalesce prefetches of close blocks.
+  std::vector<InternalKey> internal_keys;
+  internal_keys.reserve(keys.size());
+  for (const auto& key : keys) {
+    internal_keys.push_back(InternalKey::MaxPossibleForUserKey(key));
+  }
+  std::sort(internal_keys.begin(), internal_keys.end(),
+            [ucmp](const InternalKey& lhs, const InternalKey& rhs) {
+    return ucmp->Compare(lhs.user_key(), rhs.user_key()) < 0;
+  });
+  std::vector<Slice> encoded_keys;
+  encoded_keys.reserve(internal_keys.size());
+  for (const auto& key : internal_keys) {
+    if (encoded_keys.empty() ||
+        ucmp->Compare(ExtractUserKey(encoded_keys.back()), key.user_key()) != 0) {
+      encoded_keys.push_back(key.Encode());
+    }
+  }
+
+  SuperVersion* sv = GetAndRefSuperVersion(cfd);
+  auto s = sv->current->PrefetchKeys(read_options, encoded_keys);
+  ReturnAndCleanupSuperVersion(cfd, sv);
+  return s;
+}
+
 std::vector<Status> DBImpl::MultiGet(
     const ReadOptions& read_options,
     const std::vector<ColumnFamilyHandle*>& column_family,
@@ -5046,12 +5097,13 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
       InsertFlags insert_flags{InsertFlag::kConcurrentMemtableWrites};
       w.status = WriteBatchInternal::InsertInto(
           w.batch, &column_family_memtables, &flush_scheduler_,
-          write_options.ignore_missing_column_families, 0 /*log_number*/, this, insert_flags);
+          write_options.ignore_missing_column_families, 0 /*log_number*/, this, insert_flags,
+          &w.parallel_group->next_direct_sequence);
     }
 
     if (write_thread_.CompleteParallelWorker(&w)) {
       // we're responsible for early exit
-      auto last_sequence = w.parallel_group->last_sequence;
+      auto last_sequence = w.parallel_group->LastSequenceWithDirectEntries();
       SetTickerCount(stats_.get(), SEQUENCE_NUMBER, last_sequence);
       versions_->SetLastSequence(last_sequence);
       write_thread_.EarlyExitParallelGroup(&w);
@@ -5363,6 +5415,7 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
         pg.leader = &w;
         pg.last_writer = last_writer;
         pg.last_sequence = last_sequence;
+        pg.next_direct_sequence.store(last_sequence + 1, std::memory_order_relaxed);
         pg.early_exit_allowed = !need_log_sync;
         pg.running.store(static_cast<uint32_t>(write_group.size()),
                          std::memory_order_relaxed);
@@ -5378,13 +5431,16 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
           w.status = WriteBatchInternal::InsertInto(
               w.batch, &column_family_memtables, &flush_scheduler_,
               write_options.ignore_missing_column_families, 0 /*log_number*/,
-              this, insert_flags);
+              this, insert_flags, &pg.next_direct_sequence);
         }
 
         // CompleteParallelWorker returns true if this thread should
         // handle exit, false means somebody else did
         exit_completed_early = !write_thread_.CompleteParallelWorker(&w);
         status = w.FinalStatus();
+        if (!exit_completed_early) {
+          last_sequence = pg.LastSequenceWithDirectEntries();
+        }
       }
 
       if (!exit_completed_early && w.status.ok()) {
@@ -6142,6 +6198,26 @@ UserFrontierPtr DBImpl::GetFlushedFrontier() {
   return accumulated;
 }
 
+yb::Result<size_t> DBImpl::ScheduleFilteredFilesDeletion() {
+  InstrumentedMutexLock l(&mutex_);
+  if (IsShuttingDown()) {
+    return STATUS(ShutdownInProgress, "Shutdown in progress");
+  }
+  auto cfd = default_cf_handle_->cfd();
+  auto result = CompactionPicker::MarkFilesForDeletion(
+      cfd->current()->storage_info(), cfd->ioptions());
+  if (result != 0) {
+    SchedulePendingCompaction(cfd);
+    MaybeScheduleFlushOrCompaction();
+  }
+  return result;
+}
+
+double DBImpl::GetWriteStallPressure() {
+  // Pressure is atomic, so DB mutex is not required.
+  return default_cf_handle_->cfd()->write_stall_pressure();
+}
+
 UserFrontierPtr DBImpl::CalcMemTableFrontier(UpdateUserValueType frontier_type) {
   InstrumentedMutexLock l(&mutex_);
   auto cfd = default_cf_handle_->cfd();
@@ -6627,7 +6703,7 @@ Status DestroyDB(const std::string& dbname, const Options& options) {
       for (size_t i = 0; i < filenames.size(); i++) {
         if (ParseFileName(filenames[i], &number, &type) &&
             // Lock file will be deleted at end
-            (type == kTableFile || type == kTableSBlockFile)) {
+            (type == kTableFile || type == kTableSBlockFile || type == kBlobFile)) {
           std::string table_path = db_path.path + "/" + filenames[i];
           Status del = DeleteSSTFile(&options, table_path,
                                      static_cast<uint32_t>(path_id));
@@ -111,6 +111,11 @@ class DBImpl : public DB {
       const std::vector<Slice>& keys,
       std::vector<std::string>* values) override;
 
+  using DB::PrefetchKeys;
+  virtual Status PrefetchKeys(const ReadOptions& options,
+                              ColumnFamilyHandle* column_family,
+                              const std::vector<Slice>& keys) override;
+
   virtual Status CreateColumnFamily(const ColumnFamilyOptions& options,
                                     const std::string& column_family,
                                     ColumnFamilyHandle** handle) override;
@@ -226,6 +231,10 @@ class DBImpl : public DB {
 
   UserFrontierPtr GetFlushedFrontier() override;
 
+  yb::Result<size_t> ScheduleFilteredFilesDeletion() override;
+
+  double GetWriteStallPressure() override;
+
   Status ModifyFlushedFrontier(
       UserFrontierPtr frontier,
       FrontierModificationMode mode) override;
@@ -982,6 +991,9 @@ class DBImpl : public DB {
   // The options to access storage files
   const EnvOptions env_options_;
 
+  // The options to write SST files by flush and compaction.
+  const EnvOptions env_options_for_compaction_;
+
   WalManager wal_manager_;
 
   // Unified interface for logging events
@@ -26,6 +26,7 @@
 // which is a pity, it is a good test
 #include <fcntl.h>
 #include <algorithm>
+#include <map>
 #include <thread>
 #include <unordered_set>
 #include <utility>
@@ -3601,6 +3602,68 @@ TEST_F(DBTest, FlushOneColumnFamily) {
   }
 }
 
+TEST_F(DBTest, BlobFiles) {
+  Options options = CurrentOptions();
+  options.min_blob_size = 100;
+  options.blob_garbage_collection_ratio = 0.5;
+  options.disable_auto_compactions = true;
+  DestroyAndReopen(options);
+
+  auto check_values = [this](const std::map<std::string, std::string>& expected) {
+    for (const auto& [key, value] : expected) {
+      ASSERT_EQ(value, Get(key));
+    }
+    std::unique_ptr<Iterator> iter(db_->NewIterator(ReadOptions()));
+    auto it = expected.begin();
+    for (iter->SeekToFirst(); iter->Valid(); iter->Next(), ++it) {
+      ASSERT_NE(it, expected.end());
+      ASSERT_EQ(it->first, iter->key().ToString());
+      ASSERT_EQ(it->second, iter->value().ToString());
+    }
+    ASSERT_OK(iter->status());
+    ASSERT_EQ(it, expected.end());
+  };
+
+  std::map<std::string, std::string> expected = {
+    {"a", "small"},
+    {"b", DummyString(1000, 'b')},
+    {"c", DummyString(1000, 'c')},
+  };
+  for (const auto& [key, value] : expected) {
+    ASSERT_OK(Put(key, value));
+  }
+  ASSERT_OK(Flush());
+
+  auto blobs = ListSpecificFiles(env_, dbname_, kBlobFile);
+  ASSERT_EQ(blobs, ListTableFiles(env_, dbname_));
+  ASSERT_EQ(blobs.size(), 1);
+  const auto first_blob = blobs[0];
+  ASSERT_NO_FATALS(check_values(expected));
+
+  // Overwrite half of the first blob file. Compaction keeps referring the first blob file, since
+  // it does not have enough garbage yet.
+  expected["b"] = DummyString(1000, 'B');
+  ASSERT_OK(Put("b", expected["b"]));
+  ASSERT_OK(Flush());
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+  blobs = ListSpecificFiles(env_, dbname_, kBlobFile);
+  ASSERT_EQ(blobs.size(), 2);
+  ASSERT_NE(std::find(blobs.begin(), blobs.end(), first_blob), blobs.end());
+  ASSERT_NO_FATALS(check_values(expected));
+
+  // Now the first blob file is garbage collected.
+  expected["d"] = DummyString(1000, 'd');
+  ASSERT_OK(Put("d", expected["d"]));
+  ASSERT_OK(Flush());
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+  blobs = ListSpecificFiles(env_, dbname_, kBlobFile);
+  ASSERT_EQ(std::find(blobs.begin(), blobs.end(), first_blob), blobs.end());
+  ASSERT_NO_FATALS(check_values(expected));
+
+  Reopen(options);
+  ASSERT_NO_FATALS(check_values(expected));
+}
+
 // In https://reviews.facebook.net/D20661 we change
 // recovery behavior: previously for each log file each column family
 // memtable was flushed, even it was empty. Now it's changed:
@@ -5357,6 +5420,157 @@ TEST_F(DBTest, ConcurrentMemtableNotSupported) {
   ASSERT_NOK(db_->CreateColumnFamily(cf_options, "name", &handle));
 }
 
+namespace {
+
+class KeyRangeDirectWriter : public DirectWriter {
+ public:
+  KeyRangeDirectWriter(std::string prefix, size_t num_keys)
+      : prefix_(std::move(prefix)), num_keys_(num_keys) {}
+
+  Status Apply(DirectWriteHandler* handler) override {
+    for (size_t i = 0; i != num_keys_; ++i) {
+      auto key = Key(i);
+      Slice key_slice(key);
+      Slice value_slice(key);
+      handler->Put(SliceParts(&key_slice, 1), SliceParts(&value_slice, 1));
+    }
+    return Status::OK();
+  }
+
+  std::string Key(size_t idx) const {
+    return yb::Format("$0_$1", prefix_, idx);
+  }
+
+ private:
+  const std::string prefix_;
+  const size_t num_keys_;
+};
+
+} // namespace
+
+TEST_F(DBTest, ConcurrentDirectWrites) {
+  constexpr size_t kNumThreads = 8;
+  constexpr size_t kNumBatches = 100;
+  constexpr size_t kKeysPerBatch = 10;
+
+  Options options = CurrentOptions();
+  options.allow_concurrent_memtable_write = true;
+  options.memtable_factory = std::make_shared<SkipListFactory>(0, ConcurrentWrites::kTrue);
+  options.create_if_missing = true;
+  DestroyAndReopen(options);
+
+  yb::TestThreadHolder workers;
+  for (size_t thread_idx = 0; thread_idx != kNumThreads; ++thread_idx) {
+    workers.AddThread([this, thread_idx] {
+      for (size_t batch_idx = 0; batch_idx != kNumBatches; ++batch_idx) {
+        KeyRangeDirectWriter direct_writer(
+            yb::Format("key_$0_$1", thread_idx, batch_idx), kKeysPerBatch);
+        WriteBatch batch;
+        batch.SetDirectWriter(&direct_writer);
+        ASSERT_OK(db_->Write(WriteOptions(), &batch));
+        ASSERT_EQ(batch.DirectEntries(), kKeysPerBatch);
+      }
+    });
+  }
+  workers.JoinAll();
+
+  constexpr size_t kTotalKeys = kNumThreads * kNumBatches * kKeysPerBatch;
+  // Every direct entry should consume its own sequence number.
+  ASSERT_GE(db_->GetLatestSequenceNumber(), kTotalKeys);
+  {
+    std::unordered_set<SequenceNumber> sequence_numbers;
+    Arena arena;
+    ScopedArenaIterator iter(dbfull()->NewInternalIterator(&arena));
+    iter->SeekToFirst();
+    while (iter->Valid()) {
+      ParsedInternalKey ikey;
+      ASSERT_TRUE(ParseInternalKey(iter->key(), &ikey));
+      ASSERT_TRUE(sequence_numbers.insert(ikey.sequence).second)
+          << "Duplicate sequence number " << ikey.sequence << " of "
+          << ikey.user_key.ToDebugString();
+      ASSERT_LE(ikey.sequence, db_->GetLatestSequenceNumber());
+      iter->Next();
+    }
+    ASSERT_OK(iter->status());
+    ASSERT_EQ(sequence_numbers.size(), kTotalKeys);
+  }
+
+  for (size_t thread_idx = 0; thread_idx != kNumThreads; ++thread_idx) {
+    for (size_t batch_idx = 0; batch_idx != kNumBatches; ++batch_idx) {
+      KeyRangeDirectWriter direct_writer(
+          yb::Format("key_$0_$1", thread_idx, batch_idx), kKeysPerBatch);
+      for (size_t i = 0; i != kKeysPerBatch; ++i) {
+        auto key = direct_writer.Key(i);
+        ASSERT_EQ(Get(key), key);
+      }
+    }
+  }
+}
+
+TEST_F(DBTest, HashIndexedSkipListMemTable) {
+  constexpr size_t kNumThreads = 4;
+  constexpr size_t kNumPrefixes = 50;
+  constexpr size_t kKeysPerPrefix = 20;
+
+  Options options = CurrentOptions();
+  options.allow_concurrent_memtable_write = true;
+  options.memtable_factory.reset(NewHashIndexedSkipListRepFactory(
+      std::shared_ptr<const SliceTransform>(NewFixedPrefixTransform(4)), 16 /* bucket_count */,
+      2 /* lookahead */));
+  options.create_if_missing = true;
+  DestroyAndReopen(options);
+
+  auto key_for = [](size_t prefix, size_t idx) {
+    return yb::Format("$0_$1", 1000 + prefix, 100 + idx);
+  };
+
+  std::map<std::string, std::string> expected;
+  yb::TestThreadHolder workers;
+  for (size_t thread_idx = 0; thread_idx != kNumThreads; ++thread_idx) {
+    workers.AddThread([this, thread_idx, &key_for] {
+      // Write keys of each prefix in reverse order, so the first indexed entry gets replaced.
+      for (size_t idx = kKeysPerPrefix; idx-- > 0;) {
+        for (size_t prefix = thread_idx; prefix < kNumPrefixes; prefix += kNumThreads) {
+          auto key = key_for(prefix, idx);
+          ASSERT_OK(Put(key, key));
+        }
+      }
+    });
+  }
+  workers.JoinAll();
+  for (size_t prefix = 0; prefix != kNumPrefixes; ++prefix) {
+    for (size_t idx = 0; idx != kKeysPerPrefix; ++idx) {
+      auto key = key_for(prefix, idx);
+      expected.emplace(key, key);
+    }
+  }
+
+  for (const auto& [key, value] : expected) {
+    ASSERT_EQ(Get(key), value);
+  }
+  ASSERT_EQ(Get(key_for(kNumPrefixes, 0)), "NOT_FOUND");
+  ASSERT_EQ(Get(key_for(0, kKeysPerPrefix)), "NOT_FOUND");
+
+  // Seek to every existing key, keys before the first key of the prefix, keys inside of the
+  // prefix range and keys after the last one, and compare results with the model.
+  std::unique_ptr<Iterator> iter(db_->NewIterator(ReadOptions()));
+  for (size_t prefix = 0; prefix <= kNumPrefixes; ++prefix) {
+    for (size_t idx = 0; idx <= kKeysPerPrefix; ++idx) {
+      auto key = key_for(prefix, idx);
+      for (const auto& target : {key, key + "0", key.substr(0, 5), key.substr(0, 4)}) {
+        iter->Seek(target);
+        auto it = expected.lower_bound(target);
+        if (it == expected.end()) {
+          ASSERT_FALSE(ASSERT_RESULT(iter->CheckedValid())) << target;
+        } else {
+          ASSERT_TRUE(ASSERT_RESULT(iter->CheckedValid())) << target;
+          ASSERT_EQ(iter->key().ToBuffer(), it->first) << target;
+        }
+      }
+    }
+  }
+}
+
 TEST_F(DBTest, SanitizeNumThreads) {
   for (int attempt = 0; attempt < 2; attempt++) {
     const size_t kTotalTasks = 8;
@@ -7121,6 +7335,57 @@ TEST_F(DBTest, SoftLimit) {
   sleeping_task_low.WaitUntilDone();
 }
 
+TEST_F(DBTest, ProportionalWriteDelay) {
+  constexpr uint64_t kDelayedWriteRate = 1000000;
+  Options options;
+  options.env = env_;
+  options = CurrentOptions(options);
+  options.write_buffer_size = 100000;  // Small write buffer
+  options.level0_file_num_compaction_trigger = 1;
+  options.level0_slowdown_writes_trigger = 2;
+  options.level0_stop_writes_trigger = 6;
+  options.delayed_write_rate = kDelayedWriteRate;
+  options.proportional_write_delay = true;
+  options.max_background_compactions = 1;
+  options.compression = kNoCompression;
+
+  Reopen(options);
+
+  test::SleepingBackgroundTask sleeping_task_low;
+  // Block compactions
+  env_->Schedule(&test::SleepingBackgroundTask::DoSleepTask, &sleeping_task_low,
+                 Env::Priority::LOW);
+  sleeping_task_low.WaitUntilSleeping();
+
+  ASSERT_OK(Put(Key(0), std::string(5000, 'x')));
+  ASSERT_OK(Flush());
+  ASSERT_EQ(db_->GetWriteStallPressure(), 0.0);
+  ASSERT_FALSE(dbfull()->TEST_write_controler().NeedsDelay());
+
+  // Every new L0 file increases pressure, so writes are gradually slowed down instead of sudden
+  // stall.
+  double prev_pressure = 0;
+  uint64_t prev_rate = kDelayedWriteRate;
+  for (int i = 1; i < options.level0_stop_writes_trigger - 1; ++i) {
+    ASSERT_OK(Put(Key(i), std::string(5000, 'x')));
+    ASSERT_OK(Flush());
+    auto pressure = db_->GetWriteStallPressure();
+    ASSERT_GT(pressure, prev_pressure);
+    ASSERT_LT(pressure, 1.0);
+    ASSERT_TRUE(dbfull()->TEST_write_controler().NeedsDelay());
+    auto rate = dbfull()->TEST_write_controler().delayed_write_rate();
+    ASSERT_LT(rate, prev_rate);
+    prev_pressure = pressure;
+    prev_rate = rate;
+  }
+
+  sleeping_task_low.WakeUp();
+  sleeping_task_low.WaitUntilDone();
+  ASSERT_OK(dbfull()->TEST_WaitForCompact());
+  ASSERT_EQ(db_->GetWriteStallPressure(), 0.0);
+  ASSERT_FALSE(dbfull()->TEST_write_controler().NeedsDelay());
+}
+
 TEST_F(DBTest, LastWriteBufferDelay) {
   Options options;
   options.env = env_;
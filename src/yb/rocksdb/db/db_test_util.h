@@ -128,6 +128,38 @@ class CompactionStartedListener : public EventListener {
   std::atomic<int> num_compactions_started_;
 };
 
+// Discards files with numbers up to the specified one.
+class DiscardUpToFileFilter : public CompactionFileFilter {
+ public:
+  explicit DiscardUpToFileFilter(uint64_t max_discarded_file)
+      : max_discarded_file_(max_discarded_file) {}
+
+  FilterDecision Filter(const FileMetaData* file) override {
+    return file->fd.GetNumber() <= max_discarded_file_ ? FilterDecision::kDiscard
+                                                       : FilterDecision::kKeep;
+  }
+
+  const char* Name() const override { return "DiscardUpToFileFilter"; }
+
+ private:
+  const uint64_t max_discarded_file_;
+};
+
+class DiscardUpToFileFilterFactory : public CompactionFileFilterFactory {
+ public:
+  std::unique_ptr<CompactionFileFilter> CreateCompactionFileFilter(
+      const std::vector<FileMetaData*>& input_files) override {
+    return std::make_unique<DiscardUpToFileFilter>(max_discarded_file_.load());
+  }
+
+  const char* Name() const override { return "DiscardUpToFileFilterFactory"; }
+
+  void SetMaxDiscardedFile(uint64_t value) { max_discarded_file_ = value; }
+
+ private:
+  std::atomic<uint64_t> max_discarded_file_{0};
+};
+
 namespace anon {
 class AtomicCounter {
  public:
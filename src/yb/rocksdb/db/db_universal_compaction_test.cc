@@ -1465,6 +1465,101 @@ TEST_F(DBTestUniversalCompaction, IncludeFilesSmallerThanThreshold) {
   GenerateFilesAndCheckCompactionResult(options, file_sizes, value_size, 1);
 }
 
+TEST_F(DBTestUniversalCompaction, SingleLevelSubcompactions) {
+  constexpr int kNumFiles = 4;
+  constexpr int kNumKeys = 2000;
+  Options options;
+  options.compaction_style = kCompactionStyleUniversal;
+  options.num_levels = 1;
+  options.max_subcompactions = 4;
+  options.target_file_size_base = 16_KB;
+  options.write_buffer_size = 10_MB;
+  options.level0_file_num_compaction_trigger = 2;
+  options.disable_auto_compactions = true;
+  options = CurrentOptions(options);
+  DestroyAndReopen(options);
+
+  // Shift key ranges of the files, so their boundaries split the key space.
+  std::map<std::string, std::string> expected;
+  for (int file = 0; file < kNumFiles; ++file) {
+    for (int i = file * kNumKeys / kNumFiles; i < file * kNumKeys / kNumFiles + kNumKeys; ++i) {
+      const auto value = "value_" + std::to_string(i) + "_" + std::to_string(file);
+      ASSERT_OK(Put(Key(i), value));
+      expected[Key(i)] = value;
+    }
+    ASSERT_OK(Flush());
+  }
+  ASSERT_EQ(kNumFiles, NumTableFilesAtLevel(0));
+
+  // Full compaction is split into subcompactions, each of them producing its own output file.
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+  const auto num_output_files = NumTableFilesAtLevel(0);
+  ASSERT_GT(num_output_files, 1);
+
+  auto check_values = [this, &expected] {
+    for (const auto& [key, value] : expected) {
+      ASSERT_EQ(value, Get(key));
+    }
+  };
+  check_values();
+
+  // Output files form a single sorted run, so they should not trigger another compaction.
+  ASSERT_OK(dbfull()->SetOptions({{"disable_auto_compactions", "false"}}));
+  ASSERT_OK(dbfull()->TEST_WaitForCompact());
+  ASSERT_EQ(num_output_files, NumTableFilesAtLevel(0));
+
+  // Check that the sorted run is restored from the manifest.
+  options.disable_auto_compactions = false;
+  Reopen(options);
+  ASSERT_OK(dbfull()->TEST_WaitForCompact());
+  ASSERT_EQ(num_output_files, NumTableFilesAtLevel(0));
+  check_values();
+}
+
+TEST_F(DBTestUniversalCompaction, ScheduleFilteredFilesDeletion) {
+  constexpr int kNumFiles = 3;
+  constexpr int kNumKeys = 10;
+  auto file_filter_factory = std::make_shared<DiscardUpToFileFilterFactory>();
+  Options options;
+  options.compaction_style = kCompactionStyleUniversal;
+  options.num_levels = 1;
+  options.level0_file_num_compaction_trigger = kNumFiles + 1;
+  options.compaction_file_filter_factory = file_filter_factory;
+  options = CurrentOptions(options);
+  DestroyAndReopen(options);
+
+  for (int file = 0; file < kNumFiles; ++file) {
+    for (int i = 0; i < kNumKeys; ++i) {
+      ASSERT_OK(Put(Key(file * kNumKeys + i), "value"));
+    }
+    ASSERT_OK(Flush());
+  }
+  ASSERT_OK(dbfull()->TEST_WaitForCompact());
+  ASSERT_EQ(kNumFiles, NumTableFilesAtLevel(0));
+
+  // Number of files is below the compaction trigger, so nothing should be scheduled.
+  ASSERT_EQ(0U, ASSERT_RESULT(db_->ScheduleFilteredFilesDeletion()));
+
+  // Discard the oldest file.
+  auto files = db_->GetLiveFilesMetaData();
+  ASSERT_EQ(static_cast<size_t>(kNumFiles), files.size());
+  auto oldest_file = files[0].name_id;
+  for (const auto& file : files) {
+    oldest_file = std::min(oldest_file, file.name_id);
+  }
+  file_filter_factory->SetMaxDiscardedFile(oldest_file);
+  ASSERT_EQ(1U, ASSERT_RESULT(db_->ScheduleFilteredFilesDeletion()));
+  ASSERT_OK(dbfull()->TEST_WaitForCompact());
+
+  ASSERT_EQ(kNumFiles - 1, NumTableFilesAtLevel(0));
+  for (int i = 0; i < kNumKeys; ++i) {
+    ASSERT_EQ("NOT_FOUND", Get(Key(i)));
+  }
+  for (int i = kNumKeys; i < kNumFiles * kNumKeys; ++i) {
+    ASSERT_EQ("value", Get(Key(i)));
+  }
+}
+
 }  // namespace rocksdb
 
 
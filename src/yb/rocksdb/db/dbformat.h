@@ -61,6 +61,7 @@ enum ValueType : unsigned char {
   kTypeColumnFamilyMerge = 0x6,     // WAL only.
   kTypeSingleDeletion = 0x7,
   kTypeColumnFamilySingleDeletion = 0x8,  // WAL only.
+  kTypeBlobIndex = 0x11,                  // SST only. Value is a reference into a blob file.
   kMaxValue = 0x7F                        // Not used for storing records.
 };
 
@@ -70,12 +71,12 @@ enum ValueType : unsigned char {
 // and the value type is embedded as the low 8 bits in the sequence
 // number in internal keys, we need to use the highest-numbered
 // ValueType, not the lowest).
-static const ValueType kValueTypeForSeek = kTypeSingleDeletion;
+static const ValueType kValueTypeForSeek = kTypeBlobIndex;
 
 // Checks whether a type is a value type (i.e. a type used in memtables and sst
 // files).
 inline bool IsValueType(ValueType t) {
-  return t <= kTypeMerge || t == kTypeSingleDeletion;
+  return t <= kTypeMerge || t == kTypeSingleDeletion || t == kTypeBlobIndex;
 }
 
 // We leave eight bits empty at the bottom so a type and sequence#
@@ -43,6 +43,7 @@ static const char kRocksDbTFileExt[] = "sst";
 static const char kLevelDbTFileExt[] = "ldb";
 static const char kRocksDbTSBlockExtSuffix[] = "sblock";
 static const char kRocksDbTSBlockFileExt[] = "sst.sblock.0";
+static const char kRocksDbBlobFileExt[] = "blob";
 
 // Given a path, flatten the path name by replacing all chars not in
 // {[0-9,a-z,A-Z,-,_,.]} with _. And append '_LOG\0' at the end.
@@ -140,6 +141,17 @@ extern std::string TableBaseToDataFileName(const std::string& base_fname) {
   return base_fname + "." + kRocksDbTSBlockExtSuffix + ".0";
 }
 
+std::string BlobFileName(const std::vector<DbPath>& db_paths, uint64_t number,
+                         uint32_t path_id) {
+  assert(number > 0);
+  const auto& path = path_id >= db_paths.size() ? db_paths.back().path : db_paths[path_id].path;
+  return MakeBlobFileName(path, number);
+}
+
+std::string MakeBlobFileName(const std::string& path, uint64_t number) {
+  return MakeFileName(path, number, kRocksDbBlobFileExt);
+}
+
 void FormatFileNumber(uint64_t number, uint32_t path_id, char* out_buf,
                       size_t out_buf_size) {
   if (path_id == 0) {
@@ -240,7 +252,7 @@ std::string IdentityFileName(const std::string& dbname) {
 //    dbname/<info_log_name_prefix>
 //    dbname/<info_log_name_prefix>.old.[0-9]+
 //    dbname/MANIFEST-[0-9]+
-//    dbname/[0-9]+.(log|sst)
+//    dbname/[0-9]+.(log|sst|blob)
 //    dbname/METADB-[0-9]+
 //    dbname/OPTIONS-[0-9]+
 //    dbname/OPTIONS-[0-9]+.dbtmp
@@ -357,6 +369,8 @@ bool ParseFileName(const std::string& fname, uint64_t* number,
       *type = kTableFile;
     } else if (suffix == Slice(kRocksDbTSBlockFileExt)) {
       *type = kTableSBlockFile;
+    } else if (suffix == Slice(kRocksDbBlobFileExt)) {
+      *type = kBlobFile;
     } else if (suffix == Slice(kTempFileNameSuffix)) {
       *type = kTempFile;
     } else {
@@ -48,6 +48,7 @@ enum FileType {
   kDBLockFile,
   kTableFile,
   kTableSBlockFile,
+  kBlobFile,
   kDescriptorFile,
   kCurrentFile,
   kTempFile,
@@ -90,6 +91,13 @@ extern std::string TableFileName(const std::vector<DbPath>& db_paths,
 
 // Return data file name of the sstable for specific base file name.
 extern std::string TableBaseToDataFileName(const std::string& base_fname);
+
+// Return the name of the blob file with the specified number. Blob file holds large values
+// separated from the sstable with the same number.
+extern std::string BlobFileName(const std::vector<DbPath>& db_paths,
+                                uint64_t number, uint32_t path_id);
+std::string MakeBlobFileName(const std::string& path, uint64_t number);
+
 // Sufficient buffer size for FormatFileNumber.
 const size_t kFormatFileNumberBufSize = 38;
 
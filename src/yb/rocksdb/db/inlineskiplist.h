@@ -153,6 +153,10 @@ class InlineSkipList {
     // Final state of iterator is Valid() iff list is not empty.
     const char* SeekToLast();
 
+    // Position at the specified entry.
+    // REQUIRES: key was allocated by AllocateKey of this list and already inserted.
+    const char* SeekToEntry(const char* key);
+
    private:
     const InlineSkipList* list_;
     Node* node_;
@@ -339,6 +343,12 @@ inline const char* InlineSkipList<Comparator>::Iterator::Seek(const char* target
   return Entry();
 }
 
+template <class Comparator>
+inline const char* InlineSkipList<Comparator>::Iterator::SeekToEntry(const char* key) {
+  node_ = reinterpret_cast<Node*>(const_cast<char*>(key)) - 1;
+  return Entry();
+}
+
 template <class Comparator>
 inline const char* InlineSkipList<Comparator>::Iterator::SeekToFirst() {
   node_ = list_->head_->Next(0);
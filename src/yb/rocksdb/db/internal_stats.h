@@ -83,6 +83,7 @@ class InternalStats {
     LEVEL0_NUM_FILES_WITH_COMPACTION,
     SOFT_PENDING_COMPACTION_BYTES_LIMIT,
     HARD_PENDING_COMPACTION_BYTES_LIMIT,
+    PROPORTIONAL_WRITE_SLOWDOWN,
     WRITE_STALLS_ENUM_MAX,
     BYTES_FLUSHED,
     INTERNAL_CF_STATS_ENUM_MAX,
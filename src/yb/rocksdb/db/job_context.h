@@ -25,6 +25,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "yb/rocksdb/db/column_family.h"
@@ -65,6 +66,9 @@ struct JobContext {
   // the list of all live sst files that cannot be deleted
   std::vector<FileDescriptor> sst_live;
 
+  // numbers of blob files referenced from live sst files
+  std::unordered_set<uint64_t> blob_live;
+
   // a list of sst files that we need to delete
   std::vector<FileMetaData*> sst_delete_files;
 
@@ -41,11 +41,17 @@
 #include "yb/rocksdb/util/statistics.h"
 #include "yb/rocksdb/util/stop_watch.h"
 
+#include "yb/util/flags.h"
 #include "yb/util/mem_tracker.h"
 #include "yb/util/stats/perf_step_timer.h"
 
 using std::ostringstream;
 
+DEFINE_NON_RUNTIME_uint64(memtable_huge_page_size, 0,
+    "If greater than 0, memtable arena blocks are allocated from huge pages of this size, "
+    "should be the huge page size supported by the system, e.g. 2097152. Explicitly reserved "
+    "huge pages are used when available, otherwise see arena_transparent_huge_pages_fallback.");
+
 namespace rocksdb {
 
 MemTableOptions::MemTableOptions(
@@ -79,7 +85,7 @@ MemTable::MemTable(const InternalKeyComparator& cmp,
       moptions_(ioptions, mutable_cf_options),
       refs_(0),
       kArenaBlockSize(OptimizeBlockSize(moptions_.arena_block_size)),
-      arena_(moptions_.arena_block_size, 0),
+      arena_(moptions_.arena_block_size, FLAGS_memtable_huge_page_size),
       allocator_(&arena_, write_buffer),
       table_(ioptions.memtable_factory->CreateMemTableRep(
           comparator_, &allocator_, ioptions.prefix_extractor,
@@ -531,7 +537,7 @@ void MemTable::ApplyPreparedAdd(
     while (
         (cur_earliest_seqno == kMaxSequenceNumber ||
              prepared_add.min_seq_no < cur_earliest_seqno) &&
-        !first_seqno_.compare_exchange_weak(cur_earliest_seqno, prepared_add.min_seq_no)) {
+        !earliest_seqno_.compare_exchange_weak(cur_earliest_seqno, prepared_add.min_seq_no)) {
     }
   }
 
@@ -81,7 +81,8 @@ void AppendVarint64(IterKey* key, uint64_t v) {
 
 TableCache::TableCache(const ImmutableCFOptions& ioptions,
     const EnvOptions& env_options, Cache* const cache)
-    : ioptions_(ioptions), env_options_(env_options), cache_(cache) {
+    : ioptions_(ioptions), env_options_(env_options), cache_(cache),
+      blob_cache_(ioptions, env_options, cache) {
   if (ioptions_.row_cache) {
     // If the same cache is shared by multiple instances, we need to
     // disambiguate its entries.
@@ -206,7 +207,7 @@ Status TableCache::FindTable(const EnvOptions& env_options,
 
 TableCache::TableReaderWithHandle::TableReaderWithHandle(TableReaderWithHandle&& rhs)
     : table_reader(rhs.table_reader), handle(rhs.handle), cache(rhs.cache),
-      created_new(rhs.created_new) {
+      created_new(rhs.created_new), has_blob_refs(rhs.has_blob_refs) {
   rhs.Release();
 }
 
@@ -218,6 +219,7 @@ TableCache::TableReaderWithHandle& TableCache::TableReaderWithHandle::operator=(
     handle = rhs.handle;
     cache = rhs.cache;
     created_new = rhs.created_new;
+    has_blob_refs = rhs.has_blob_refs;
     rhs.Release();
   }
   return *this;
@@ -228,6 +230,7 @@ void TableCache::TableReaderWithHandle::Release() {
   handle = nullptr;
   cache = nullptr;
   created_new = false;
+  has_blob_refs = false;
 }
 
 void TableCache::TableReaderWithHandle::Reset() {
@@ -270,6 +273,7 @@ Status TableCache::DoGetTableReaderForIterator(
         /* no_io =*/ options.read_tier == kBlockCacheTier, file_read_hist, skip_filters));
   }
   trwh->created_new = create_new_table_reader;
+  trwh->has_blob_refs = fd.has_blob_refs;
   return Status::OK();
 }
 
@@ -307,6 +311,9 @@ InternalIterator* TableCache::DoNewIterator(
 
   if (for_compaction) {
     trwh->table_reader->SetupForCompaction();
+  } else if (trwh->has_blob_refs) {
+    // Compaction resolves blob references itself, so it could keep referring unchanged values.
+    result = NewBlobResolvingIterator(result, &blob_cache_, arena);
   }
 
   if (ioptions_.iterator_replacer) {
@@ -421,6 +428,7 @@ Status TableCache::Get(const ReadOptions& options,
     }
   }
   if (s.ok()) {
+    get_context->SetBlobCache(&blob_cache_);
     get_context->SetReplayLog(row_cache_entry);  // nullptr if no cache.
     s = t->Get(options, k, get_context, skip_filters);
     get_context->SetReplayLog(nullptr);
@@ -445,6 +453,27 @@ Status TableCache::Get(const ReadOptions& options,
   return s;
 }
 
+Status TableCache::PrefetchKeys(const ReadOptions& options,
+    const InternalKeyComparatorPtr& internal_comparator,
+    const FileDescriptor& fd, const Slice* internal_keys, size_t num_keys) {
+  TableReader* t = fd.table_reader;
+  Cache::Handle* handle = nullptr;
+  if (!t) {
+    auto s = FindTable(env_options_, internal_comparator, fd, &handle,
+                       options.query_id, options.read_tier == kBlockCacheTier /* no_io */);
+    if (!s.ok()) {
+      // Table is not opened yet and IO is not allowed, so there is nothing to prefetch.
+      return options.read_tier == kBlockCacheTier && s.IsIncomplete() ? Status::OK() : s;
+    }
+    t = GetTableReaderFromHandle(handle);
+  }
+  auto s = t->PrefetchKeys(options, internal_keys, num_keys);
+  if (handle != nullptr) {
+    ReleaseHandle(handle);
+  }
+  return s;
+}
+
 yb::Result<TableCache::TableReaderWithHandle> TableCache::GetTableReader(
     const EnvOptions& env_options, const InternalKeyComparatorPtr& internal_comparator,
     const FileDescriptor& fd, const QueryId query_id, const bool no_io,
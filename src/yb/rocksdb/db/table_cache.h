@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "yb/rocksdb/cache.h"
+#include "yb/rocksdb/db/blob_file.h"
 #include "yb/rocksdb/env.h"
 #include "yb/rocksdb/immutable_options.h"
 #include "yb/rocksdb/metadata.h"
@@ -56,6 +57,7 @@ class TableCache {
     Cache::Handle* handle = nullptr;
     Cache* cache = nullptr;
     bool created_new = false;
+    bool has_blob_refs = false;
 
     TableReaderWithHandle() = default;
     TableReaderWithHandle(TableReaderWithHandle&& rhs);
@@ -110,6 +112,13 @@ class TableCache {
              GetContext* get_context, HistogramImpl* file_read_hist = nullptr,
              bool skip_filters = false);
 
+  // Prefetches data blocks of the specified file that could contain specified internal keys.
+  // REQUIRES: internal_keys are sorted.
+  Status PrefetchKeys(const ReadOptions& options,
+                      const InternalKeyComparatorPtr& internal_comparator,
+                      const FileDescriptor& file_fd, const Slice* internal_keys,
+                      size_t num_keys);
+
   // Evict any entry for the specified file number
   static void Evict(Cache* cache, uint64_t file_number);
 
@@ -166,6 +175,10 @@ class TableCache {
   // Release the handle from a cache
   void ReleaseHandle(Cache::Handle* handle);
 
+  BlobFileCache* blob_cache() {
+    return &blob_cache_;
+  }
+
  private:
   // Build a table reader
   Status DoGetTableReader(
@@ -189,6 +202,7 @@ class TableCache {
   const ImmutableCFOptions& ioptions_;
   const EnvOptions& env_options_;
   Cache* const cache_;
+  BlobFileCache blob_cache_;
   std::string row_cache_id_;
 };
 
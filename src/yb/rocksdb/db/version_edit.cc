@@ -155,11 +155,21 @@ std::string FileMetaData::FrontiersToString() const {
       largest.user_frontier ? largest.user_frontier->ToString() : "none");
 }
 
+void FileMetaData::SetBlobRefs(std::vector<BlobFileRef> refs) {
+  blob_refs = std::move(refs);
+  fd.has_blob_refs = !blob_refs.empty();
+}
+
 std::string FileMetaData::ToString() const {
   return yb::Format("{ number: $0 total_size: $1 base_size: $2 "
-                    "being_compacted: $3 smallest: $4 largest: $5 }",
+                    "being_compacted: $3 smallest: $4 largest: $5 blob_refs: $6 }",
                     fd.GetNumber(), fd.GetTotalFileSize(), fd.GetBaseFileSize(),
-                    being_compacted, smallest, largest);
+                    being_compacted, smallest, largest, blob_refs);
+}
+
+std::string BlobFileRef::ToString() const {
+  return yb::Format("{ file_number: $0 path_id: $1 referenced_bytes: $2 file_size: $3 }",
+                    file_number, path_id, referenced_bytes, file_size);
 }
 
 void VersionEdit::Clear() {
@@ -282,6 +292,18 @@ bool VersionEdit::EncodeTo(VersionEditPB* dst) const {
     if (f.imported) {
       new_file.set_imported(true);
     }
+    if (f.sorted_run_id != 0) {
+      new_file.set_sorted_run_id(f.sorted_run_id);
+    }
+    for (const auto& ref : f.blob_refs) {
+      auto& blob_ref = *new_file.add_blob_refs();
+      blob_ref.set_file_number(ref.file_number);
+      if (ref.path_id != 0) {
+        blob_ref.set_path_id(ref.path_id);
+      }
+      blob_ref.set_referenced_bytes(ref.referenced_bytes);
+      blob_ref.set_file_size(ref.file_size);
+    }
   }
 
   // 0 is default and does not need to be explicitly written
@@ -370,6 +392,20 @@ Status VersionEdit::DecodeFrom(BoundaryValuesExtractor* extractor, const Slice&
     meta.marked_for_compaction = source.marked_for_compaction();
     max_level_ = std::max(max_level_, level);
     meta.imported = source.imported();
+    meta.sorted_run_id = source.sorted_run_id();
+    if (source.blob_refs_size() != 0) {
+      std::vector<BlobFileRef> blob_refs;
+      blob_refs.reserve(source.blob_refs_size());
+      for (const auto& ref : source.blob_refs()) {
+        blob_refs.push_back(BlobFileRef{
+            .file_number = ref.file_number(),
+            .path_id = ref.path_id(),
+            .referenced_bytes = ref.referenced_bytes(),
+            .file_size = ref.file_size(),
+        });
+      }
+      meta.SetBlobRefs(std::move(blob_refs));
+    }
 
     // Use the relevant fields in the "largest" frontier to update the "flushed" frontier for this
     // version edit. In practice this will only look at OpId and will discard hybrid time and
@@ -451,6 +487,8 @@ void VersionEdit::AddCleanedFile(int level, const FileMetaData& f) {
   nf.largest = f.largest;
   nf.marked_for_compaction = f.marked_for_compaction;
   nf.imported = f.imported;
+  nf.sorted_run_id = f.sorted_run_id;
+  nf.blob_refs = f.blob_refs;
   new_files_.emplace_back(level, std::move(nf));
 }
 
@@ -75,6 +75,8 @@ struct FileDescriptor {
   uint64_t packed_number_and_path_id;
   uint64_t total_file_size;  // total file(s) size in bytes
   uint64_t base_file_size;  // base file size in bytes
+  // True if some values of this SST are stored in blob files, see FileMetaData::blob_refs.
+  bool has_blob_refs = false;
 
   FileDescriptor() : FileDescriptor(0, 0, 0, 0) {}
 
@@ -100,6 +102,17 @@ struct FileDescriptor {
 
 YB_DEFINE_ENUM(UpdateBoundariesType, (kAll)(kSmallest)(kLargest));
 
+// Blob file referenced from an SST file, and the total size of values in it that the SST file
+// refers to.
+struct BlobFileRef {
+  uint64_t file_number = 0;
+  uint32_t path_id = 0;
+  uint64_t referenced_bytes = 0;
+  uint64_t file_size = 0;
+
+  std::string ToString() const;
+};
+
 struct FileMetaData {
   typedef FileBoundaryValues<InternalKey> BoundaryValues;
 
@@ -110,6 +123,13 @@ struct FileMetaData {
   BoundaryValues smallest;     // The smallest values in this file
   BoundaryValues largest;      // The largest values in this file
   bool imported = false;       // Was this file imported from another DB.
+  // Outputs of a compaction split into subcompactions cover disjoint key ranges and together form
+  // a single sorted run. They share this id, which is the smallest file number among them.
+  // 0 means that the file is a sorted run of its own.
+  uint64_t sorted_run_id = 0;
+  // Blob files holding values separated from this file, see ColumnFamilyOptions::min_blob_size.
+  // Ordered by file number.
+  std::vector<BlobFileRef> blob_refs;
 
   // Needs to be disposed when refs becomes 0.
   Cache::Handle* table_reader_handle;
@@ -151,6 +171,8 @@ struct FileMetaData {
 
   void UpdateBoundaryUserValues(const UserBoundaryValueRefs& source, UpdateBoundariesType type);
 
+  void SetBlobRefs(std::vector<BlobFileRef> refs);
+
   bool Unref(TableCache* table_cache);
 
   Slice UserFilter() const; // Extracts user filter from largest boundary value if present.
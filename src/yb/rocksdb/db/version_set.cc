@@ -32,6 +32,7 @@
 #include <stdio.h>
 #include <algorithm>
 #include <map>
+#include <optional>
 #include <set>
 #include <climits>
 #include <unordered_map>
@@ -1071,6 +1072,40 @@ void Version::Get(const ReadOptions& read_options, const LookupKey& k,
   }
 }
 
+Status Version::PrefetchKeys(
+    const ReadOptions& read_options, const std::vector<Slice>& internal_keys) {
+  auto* ucmp = user_comparator();
+  auto user_key_less = [ucmp](const Slice& lhs, const Slice& rhs) {
+    return ucmp->Compare(ExtractUserKey(lhs), rhs) < 0;
+  };
+  auto user_key_greater = [ucmp](const Slice& lhs, const Slice& rhs) {
+    return ucmp->Compare(lhs, ExtractUserKey(rhs)) < 0;
+  };
+  for (int level = 0; level < storage_info_.num_non_empty_levels(); ++level) {
+    for (auto* file : storage_info_.LevelFiles(level)) {
+      // Only keys in the [smallest, largest] range of the file could be present in it.
+      // Keys could also be prefixes of the stored user keys, e.g. DocDB prefetches DocKey while
+      // stored keys also contain hybrid time. So keys that are prefixes of the smallest user key
+      // also belong to the file.
+      const auto smallest = file->smallest.key.user_key();
+      auto begin = std::lower_bound(
+          internal_keys.begin(), internal_keys.end(), smallest, user_key_less);
+      while (begin != internal_keys.begin() &&
+             smallest.starts_with(ExtractUserKey(*(begin - 1)))) {
+        --begin;
+      }
+      auto end = std::upper_bound(
+          begin, internal_keys.end(), file->largest.key.user_key(), user_key_greater);
+      if (begin == end) {
+        continue;
+      }
+      RETURN_NOT_OK(table_cache_->PrefetchKeys(
+          read_options, internal_comparator(), file->fd, &*begin, end - begin));
+    }
+  }
+  return Status::OK();
+}
+
 bool Version::IsFilterSkipped(int level, bool is_file_last_in_level) {
   // Reaching the bottom level implies misses at all upper levels, so we'll
   // skip checking the filters when we predict a hit.
@@ -1306,10 +1341,16 @@ void VersionStorageInfo::ComputeCompactionScore(
       // overwrites/deletions).
       int num_sorted_runs = 0;
       uint64_t total_size = 0;
+      const FileMetaData* prev_file = nullptr;
       for (auto* f : files_[level]) {
         if (!f->being_compacted) {
           total_size += f->compensated_file_size;
-          num_sorted_runs++;
+          // Outputs of subcompactions form a single sorted run, see FileMetaData::sorted_run_id.
+          if (!prev_file || f->sorted_run_id == 0 ||
+              f->sorted_run_id != prev_file->sorted_run_id) {
+            num_sorted_runs++;
+          }
+          prev_file = f;
         }
       }
       if (compaction_style_ == kCompactionStyleUniversal) {
@@ -2102,6 +2143,16 @@ void Version::AddLiveFiles(std::vector<FileDescriptor>* live) {
   }
 }
 
+void Version::AddLiveBlobFiles(std::unordered_set<uint64_t>* live) {
+  for (int level = 0; level < storage_info_.num_levels(); level++) {
+    for (const auto* file : storage_info_.files_[level]) {
+      for (const auto& ref : file->blob_refs) {
+        live->insert(ref.file_number);
+      }
+    }
+  }
+}
+
 std::string Version::DebugString(bool hex) const {
   std::string r;
   for (int level = 0; level < storage_info_.num_levels_; level++) {
@@ -2233,7 +2284,8 @@ VersionSet::VersionSet(const std::string& dbname, const DBOptions* db_options,
       dbname_(dbname),
       db_options_(db_options),
       env_options_(storage_options),
-      env_options_compactions_(env_options_) {}
+      env_options_compactions_(
+          db_options->env->OptimizeForCompactionTableRead(env_options_, *db_options)) {}
 
 VersionSet::~VersionSet() {
   // we need to delete column_family_set_ because its destructor depends on
@@ -2984,7 +3036,12 @@ Status VersionSet::Import(const std::string& source_dir,
     return status;
   }
   std::vector<FileMetaData> files;
-  std::vector<std::pair<SequenceNumber, SequenceNumber>> segments;
+  struct SeqNoSegment {
+    SequenceNumber first;
+    SequenceNumber second;
+    bool imported;
+  };
+  std::vector<SeqNoSegment> segments;
   for (;;) {
     status = manifest_reader.Next();
     if (!status.ok()) {
@@ -2999,6 +3056,13 @@ Status VersionSet::Import(const std::string& source_dir,
       filemeta.largest.user_frontier.reset();
       filemeta.smallest.user_frontier.reset();
       filemeta.imported = true;
+      // Imported files get new numbers, so they could not refer to sorted runs of this DB.
+      filemeta.sorted_run_id = 0;
+      if (!filemeta.blob_refs.empty()) {
+        return STATUS_FORMAT(NotSupported,
+                             "Import of files with values in blob files is not supported: $0",
+                             filemeta.fd.GetNumber());
+      }
       if (filemeta.largest.seqno >= seqno) {
         return STATUS_FORMAT(InvalidArgument,
                              "Imported DB contains seqno ($0) greater than active seqno ($1)",
@@ -3006,7 +3070,7 @@ Status VersionSet::Import(const std::string& source_dir,
                              seqno);
       }
       files.push_back(filemeta);
-      segments.emplace_back(filemeta.smallest.seqno, filemeta.largest.seqno);
+      segments.push_back({filemeta.smallest.seqno, filemeta.largest.seqno, /* imported= */ true});
     }
   }
   if (!status.IsEndOfFile()) {
@@ -3020,24 +3084,30 @@ Status VersionSet::Import(const std::string& source_dir,
   std::vector<LiveFileMetaData> live_files;
   GetLiveFilesMetaData(&live_files);
   for (const auto& file : live_files) {
-    segments.emplace_back(file.smallest.seqno, file.largest.seqno);
+    segments.push_back({file.smallest.seqno, file.largest.seqno, /* imported= */ false});
   }
 
   std::sort(segments.begin(), segments.end(), [](const auto& lhs, const auto& rhs) {
     return lhs.first < rhs.first;
   });
-  auto prev = segments.front();
-  for (size_t i = 1; i != segments.size(); ++i) {
-    const auto& segment = segments[i];
-    if (segment.first <= prev.second) {
+  // Files of the same DB could have overlapping seqno ranges when they were produced by one
+  // compaction split into subcompactions, so only imported files are checked against live ones.
+  // Index is SeqNoSegment::imported.
+  std::optional<SeqNoSegment> last_segment[2];
+  for (const auto& segment : segments) {
+    const auto& other = last_segment[!segment.imported];
+    if (other && segment.first <= other->second) {
       return STATUS_FORMAT(Corruption,
                            "Overlapping seqno ranges: [$0, $1] and [$2, $3]",
-                           prev.first,
-                           prev.second,
+                           other->first,
+                           other->second,
                            segment.first,
                            segment.second);
     }
-    prev = segment;
+    auto& last = last_segment[segment.imported];
+    if (!last || last->second < segment.second) {
+      last = segment;
+    }
   }
 
   std::vector<std::string> revert_list;
@@ -3667,6 +3737,15 @@ void VersionSet::AddLiveFiles(std::vector<FileDescriptor>* live_list) {
   }
 }
 
+void VersionSet::AddLiveBlobFiles(std::unordered_set<uint64_t>* live) {
+  for (auto cfd : *column_family_set_) {
+    Version* dummy_versions = cfd->dummy_versions();
+    for (Version* v = dummy_versions->next_; v != dummy_versions; v = v->next_) {
+      v->AddLiveBlobFiles(live);
+    }
+  }
+}
+
 InternalIterator* VersionSet::MakeInputIterator(Compaction* c) {
   auto cfd = c->column_family_data();
   ReadOptions read_options;
@@ -3709,6 +3788,22 @@ InternalIterator* VersionSet::MakeInputIterator(Compaction* c) {
               true /* for compaction */);
         }
       } else {
+        // Files of a non-zero level are removed only when all of them are marked for deletion,
+        // that is the case for compactions picked by the file deletion picker of level style.
+        const auto& level_files = *c->inputs(which);
+        if (std::all_of(level_files.begin(), level_files.end(),
+                        [](FileMetaData* f) { return f->delete_after_compaction(); })) {
+          for (auto* fmd : level_files) {
+            RLOG(
+                InfoLogLevel::INFO_LEVEL, db_options_->info_log,
+                yb::Format(
+                    "[$0] File marked for deletion, will be removed after compaction. file: $1",
+                    c->column_family_data()->GetName(), fmd->ToString()).c_str());
+          }
+          RecordTick(cfd->ioptions()->statistics, COMPACTION_FILES_FILTERED, level_files.size());
+          continue;
+        }
+        RecordTick(cfd->ioptions()->statistics, COMPACTION_FILES_NOT_FILTERED, level_files.size());
         // Create concatenating iterator for the files from this level
         list[num++] = NewTwoLevelIterator(
             new LevelFileIteratorState(
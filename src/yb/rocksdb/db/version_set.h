@@ -41,6 +41,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -469,6 +470,10 @@ class Version {
            bool* value_found = nullptr, bool* key_exists = nullptr,
            SequenceNumber* seq = nullptr);
 
+  // Prefetches data blocks of SST files that could contain specified internal keys.
+  // REQUIRES: internal_keys are sorted.
+  Status PrefetchKeys(const ReadOptions& read_options, const std::vector<Slice>& internal_keys);
+
   // Loads some stats information from files. Call without mutex held. It needs
   // to be called before applying the version to the version set.
   void PrepareApply(const MutableCFOptions& mutable_cf_options,
@@ -484,6 +489,9 @@ class Version {
   // Add all files listed in the current version to *live.
   void AddLiveFiles(std::vector<FileDescriptor>* live);
 
+  // Add numbers of blob files referenced from files of the current version to *live.
+  void AddLiveBlobFiles(std::unordered_set<uint64_t>* live);
+
   // Return a human readable string that describes this version's contents.
   std::string DebugString(bool hex = false) const;
 
@@ -739,6 +747,9 @@ class VersionSet {
   // Add all files listed in any live version to *live.
   void AddLiveFiles(std::vector<FileDescriptor>* live_list);
 
+  // Add numbers of blob files referenced from files of any live version to *live.
+  void AddLiveBlobFiles(std::unordered_set<uint64_t>* live);
+
   // Return the approximate size of data to be scanned for range [start, end)
   // in levels [start_level, end_level). If end_level == 0 it will search
   // through all non-empty levels
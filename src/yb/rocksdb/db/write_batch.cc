@@ -105,9 +105,11 @@ struct BatchContentClassifier : public WriteBatch::Handler {
 
 class DirectWriteHandlerImpl : public DirectWriteHandler {
  public:
-  explicit DirectWriteHandlerImpl(
-      MemTable* mem_table, SequenceNumber seq, WriteBatch::Handler* handler_for_logging)
-      : mem_table_(mem_table), seq_(seq), handler_for_logging_(handler_for_logging) {}
+  DirectWriteHandlerImpl(
+      MemTable* mem_table, SequenceNumber seq, std::atomic<SequenceNumber>* shared_seq,
+      bool concurrent, WriteBatch::Handler* handler_for_logging)
+      : mem_table_(mem_table), seq_(seq), shared_seq_(shared_seq), concurrent_(concurrent),
+        handler_for_logging_(handler_for_logging) {}
 
   std::pair<Slice, Slice> Put(const SliceParts& key, const SliceParts& value) override {
     if (handler_for_logging_) {
@@ -123,7 +125,8 @@ class DirectWriteHandlerImpl : public DirectWriteHandler {
       WARN_NOT_OK(handler_for_logging_->SingleDeleteCF(0 /* column_family_id */, key),
                   "Logging handler failed on SingleDeleteCF");
     }
-    if (mem_table_->Erase(key)) {
+    // In memory erase is not supported by memtables that allow concurrent writes.
+    if (!concurrent_ && mem_table_->Erase(key)) {
       return;
     }
     Add(ValueType::kTypeSingleDeletion, SliceParts(&key, 1), SliceParts());
@@ -140,18 +143,22 @@ class DirectWriteHandlerImpl : public DirectWriteHandler {
       return comparator->Compare(lhs_slice, rhs_slice) < 0;
     };
     std::sort(keys_.begin(), keys_.end(), compare);
-    mem_table_->ApplyPreparedAdd(keys_.data(), keys_.size(), prepared_add_, false);
+    mem_table_->ApplyPreparedAdd(keys_.data(), keys_.size(), prepared_add_, concurrent_);
     return keys_.size();
   }
 
  private:
   void Add(ValueType value_type, const SliceParts& key, const SliceParts& value) {
-    keys_.push_back(
-        mem_table_->PrepareAdd(seq_++, value_type, key, value, &prepared_add_));
+    auto seq = shared_seq_ ? shared_seq_->fetch_add(1, std::memory_order_acq_rel) : seq_++;
+    keys_.push_back(mem_table_->PrepareAdd(seq, value_type, key, value, &prepared_add_));
   }
 
   MemTable* mem_table_;
   SequenceNumber seq_;
+  // Sequence number counter shared by writers of a parallel group, see
+  // WriteThread::ParallelGroup::next_direct_sequence.
+  std::atomic<SequenceNumber>* const shared_seq_;
+  const bool concurrent_;
   WriteBatch::Handler* handler_for_logging_;
   PreparedAdd prepared_add_;
   boost::container::small_vector<KeyHandle, 128> keys_;
@@ -652,19 +659,22 @@ class MemTableInserter : public WriteBatch::Handler {
   const uint64_t log_number_;
   DBImpl* db_;
   const InsertFlags insert_flags_;
+  std::atomic<SequenceNumber>* const direct_sequence_;
 
   // cf_mems should not be shared with concurrent inserters
   MemTableInserter(SequenceNumber sequence, ColumnFamilyMemTables* cf_mems,
                    FlushScheduler* flush_scheduler,
                    bool ignore_missing_column_families, uint64_t log_number,
-                   DB* db, InsertFlags insert_flags)
+                   DB* db, InsertFlags insert_flags,
+                   std::atomic<SequenceNumber>* direct_sequence = nullptr)
       : sequence_(sequence),
         cf_mems_(cf_mems),
         flush_scheduler_(flush_scheduler),
         ignore_missing_column_families_(ignore_missing_column_families),
         log_number_(log_number),
         db_(reinterpret_cast<DBImpl*>(db)),
-        insert_flags_(insert_flags) {
+        insert_flags_(insert_flags),
+        direct_sequence_(direct_sequence) {
     assert(cf_mems_);
     if (insert_flags_.Test(InsertFlag::kFilterDeletes)) {
       assert(db_);
@@ -771,6 +781,7 @@ class MemTableInserter : public WriteBatch::Handler {
     MemTable* mem = cf_mems_->GetMemTable();
     if ((delete_type == ValueType::kTypeSingleDeletion ||
          delete_type == ValueType::kTypeColumnFamilySingleDeletion) &&
+        !insert_flags_.Test(InsertFlag::kConcurrentMemtableWrites) &&
         mem->Erase(key)) {
       return Status::OK();
     }
@@ -951,10 +962,11 @@ Status WriteBatchInternal::InsertInto(const WriteBatch* batch,
                                       FlushScheduler* flush_scheduler,
                                       bool ignore_missing_column_families,
                                       uint64_t log_number, DB* db,
-                                      InsertFlags insert_flags) {
+                                      InsertFlags insert_flags,
+                                      std::atomic<SequenceNumber>* direct_sequence) {
   MemTableInserter inserter(WriteBatchInternal::Sequence(batch), memtables,
                             flush_scheduler, ignore_missing_column_families,
-                            log_number, db, insert_flags);
+                            log_number, db, insert_flags, direct_sequence);
   return batch->Iterate(&inserter);
 }
 
@@ -993,9 +1005,16 @@ Result<size_t> DirectInsert(
     current = mems->current();
   }
   DirectWriteHandlerImpl direct_write_handler(
-      current->mem(), mem_table_inserter->sequence_, handler_for_logging);
+      current->mem(), mem_table_inserter->sequence_, mem_table_inserter->direct_sequence_,
+      mem_table_inserter->insert_flags_.Test(InsertFlag::kConcurrentMemtableWrites),
+      handler_for_logging);
   RETURN_NOT_OK(writer->Apply(&direct_write_handler));
   auto result = direct_write_handler.Complete();
+  if (!mem_table_inserter->direct_sequence_) {
+    // Following entries, including ones of the next batches of the group, use sequence numbers
+    // after the direct entries.
+    mem_table_inserter->sequence_ += result;
+  }
   mem_table_inserter->CheckMemtableFull();
   return result;
 }
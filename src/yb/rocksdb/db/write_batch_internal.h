@@ -166,13 +166,16 @@ class WriteBatchInternal {
                            uint64_t log_number = 0, DB* db = nullptr,
                            InsertFlags insert_flags = InsertFlags());
 
-  // Convenience form of InsertInto when you have only one batch
+  // Convenience form of InsertInto when you have only one batch.
+  // When direct_sequence is specified, sequence numbers for direct entries of the batch are
+  // allocated from it, so batches of a parallel group could be inserted concurrently.
   static Status InsertInto(const WriteBatch* batch,
                            ColumnFamilyMemTables* memtables,
                            FlushScheduler* flush_scheduler,
                            bool ignore_missing_column_families = false,
                            uint64_t log_number = 0, DB* db = nullptr,
-                           InsertFlags insert_flags = InsertFlags());
+                           InsertFlags insert_flags = InsertFlags(),
+                           std::atomic<SequenceNumber>* direct_sequence = nullptr);
 
   static void Append(WriteBatch* dst, const WriteBatch* src);
 
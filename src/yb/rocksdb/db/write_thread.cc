@@ -341,6 +341,10 @@ void WriteThread::LaunchParallelFollowers(ParallelGroup* pg,
   }
 }
 
+SequenceNumber WriteThread::ParallelGroup::LastSequenceWithDirectEntries() const {
+  return next_direct_sequence.load(std::memory_order_acquire) - 1;
+}
+
 bool WriteThread::CompleteParallelWorker(Writer* w) {
   static AdaptationContext ctx("CompleteParallelWorker");
 
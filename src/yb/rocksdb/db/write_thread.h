@@ -92,6 +92,13 @@ class WriteThread {
     // before running goes to zero, status needs leader->StateMutex()
     Status status;
     std::atomic<uint32_t> running;
+    // Number of entries of direct writers is known only after they were inserted, so sequence
+    // numbers for them are allocated from this counter, starting right after last_sequence.
+    std::atomic<SequenceNumber> next_direct_sequence;
+
+    // Returns last_sequence extended by entries of direct writers of the group.
+    // Could be used only after all workers completed.
+    SequenceNumber LastSequenceWithDirectEntries() const;
   };
 
   // Information kept for every waiting writer.
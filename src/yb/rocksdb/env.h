@@ -420,6 +420,14 @@ class Env {
   // files. Default implementation returns the copy of the same object.
   virtual EnvOptions OptimizeForManifestWrite(const EnvOptions& env_options)
       const;
+  // OptimizeForCompactionTableWrite will create a new EnvOptions object that is a copy of the
+  // EnvOptions in the parameters, but is optimized for writing SST files by flush and compaction.
+  virtual EnvOptions OptimizeForCompactionTableWrite(const EnvOptions& env_options,
+                                                     const DBOptions& db_options) const;
+  // OptimizeForCompactionTableRead will create a new EnvOptions object that is a copy of the
+  // EnvOptions in the parameters, but is optimized for reading compaction inputs.
+  virtual EnvOptions OptimizeForCompactionTableRead(const EnvOptions& env_options,
+                                                    const DBOptions& db_options) const;
 
   virtual bool IsPlainText() const {
     return true;
@@ -214,4 +214,11 @@ extern const FilterPolicy* NewBloomFilterPolicy(int bits_per_key,
 extern const FilterPolicy* NewFixedSizeFilterPolicy(size_t total_bits,
                                                     double error_rate,
                                                     Logger* logger);
+
+// Same as NewFixedSizeFilterPolicy, but each filter block is a Ribbon filter, that needs about
+// 20% fewer bits per key than bloom filter for the same false positive rate. So filter block of
+// the same size holds more keys, and fewer filter blocks are needed for the same SST file.
+extern const FilterPolicy* NewFixedSizeRibbonFilterPolicy(size_t total_bits,
+                                                          double error_rate,
+                                                          Logger* logger);
 }  // namespace rocksdb
@@ -74,6 +74,8 @@ struct ImmutableCFOptions {
 
   uint64_t delayed_write_rate;
 
+  bool proportional_write_delay;
+
   // Allow the OS to mmap file for reading sst tables. Default: false
   bool allow_mmap_reads;
 
@@ -121,6 +123,10 @@ struct ImmutableCFOptions {
 
   bool optimize_filters_for_hits;
 
+  uint64_t min_blob_size;
+
+  double blob_garbage_collection_ratio;
+
   // A vector of EventListeners which call-back functions will be called
   // when specific RocksDB event happens.
   std::vector<std::shared_ptr<EventListener>> listeners;
@@ -81,7 +81,9 @@ YB_DEFINE_ENUM(CompactionReason,
   // Scheduled full compaction
   (kScheduledFullCompaction)
   // Post-split compaction
-  (kPostSplitCompaction));
+  (kPostSplitCompaction)
+  // [Level] files have been marked for direct deletion
+  (kLevelDirectDeletion));
 
 
 struct TableFileDeletionInfo {
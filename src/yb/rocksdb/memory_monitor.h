@@ -32,7 +32,15 @@ class MemoryMonitor {
     return memory_used_.load(std::memory_order_relaxed);
   }
 
-  size_t limit() const { return limit_; }
+  size_t limit() const { return limit_.load(std::memory_order_relaxed); }
+
+  // Changes the limit, notifying the callback if the new limit is already exceeded.
+  void SetLimit(size_t limit) {
+    limit_.store(limit, std::memory_order_relaxed);
+    if (Exceeded()) {
+      exceeded_callback_();
+    }
+  }
 
   bool Exceeded() const {
     return Exceeded(memory_usage());
@@ -59,7 +67,7 @@ class MemoryMonitor {
     return limit() > 0 && size >= limit();
   }
 
-  const size_t limit_;
+  std::atomic<size_t> limit_;
   const std::function<void()> exceeded_callback_;
   std::atomic<size_t> memory_used_ {0};
 
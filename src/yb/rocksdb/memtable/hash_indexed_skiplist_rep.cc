@@ -0,0 +1,261 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <atomic>
+
+#include "yb/rocksdb/db/inlineskiplist.h"
+#include "yb/rocksdb/db/memtable.h"
+#include "yb/rocksdb/memtablerep.h"
+#include "yb/rocksdb/slice_transform.h"
+#include "yb/rocksdb/util/arena.h"
+#include "yb/rocksdb/util/murmurhash.h"
+
+namespace rocksdb {
+namespace {
+
+// Skip list memtable rep paired with a lock-free hash index. The index maps a prefix of the user
+// key, produced by key_extractor, to the smallest memtable entry having this prefix.
+//
+// Since all keys with the same prefix are adjacent in the skip list, a seek to a target, that is
+// not greater than the smallest entry with the same prefix, lands exactly on that entry. So point
+// lookups of recently written rows avoid the O(log n) skip list search, and lookups of keys with
+// a prefix that is absent in the index are answered without touching the skip list at all.
+class HashIndexedSkipListRep : public MemTableRep {
+ public:
+  typedef InlineSkipList<const MemTableRep::KeyComparator&> SkipListImpl;
+
+  HashIndexedSkipListRep(
+      const MemTableRep::KeyComparator& compare, MemTableAllocator* allocator,
+      const SliceTransform* key_extractor, size_t bucket_count, size_t lookahead)
+      : MemTableRep(allocator), skip_list_(compare, allocator), cmp_(compare),
+        key_extractor_(key_extractor), bucket_count_(bucket_count), lookahead_(lookahead) {
+    auto mem = allocator->AllocateAligned(sizeof(std::atomic<IndexNode*>) * bucket_count_);
+    buckets_ = reinterpret_cast<std::atomic<IndexNode*>*>(mem);
+    for (size_t i = 0; i != bucket_count_; ++i) {
+      new (&buckets_[i]) std::atomic<IndexNode*>(nullptr);
+    }
+  }
+
+  KeyHandle Allocate(const size_t len, char** buf) override {
+    *buf = skip_list_.AllocateKey(len);
+    return static_cast<KeyHandle>(*buf);
+  }
+
+  void Insert(KeyHandle handle) override {
+    auto key = static_cast<char*>(handle);
+    skip_list_.Insert(key);
+    UpdateIndex(key);
+  }
+
+  void InsertConcurrently(KeyHandle handle) override {
+    auto key = static_cast<char*>(handle);
+    skip_list_.InsertConcurrently(key);
+    UpdateIndex(key);
+  }
+
+  bool Contains(const char* key) const override {
+    return skip_list_.Contains(key);
+  }
+
+  size_t ApproximateMemoryUsage() override {
+    // All memory is allocated through allocator; nothing to report here
+    return 0;
+  }
+
+  void Get(const LookupKey& k, void* callback_args,
+           bool (*callback_func)(void* arg, const char* entry)) override {
+    auto first = FindFirstEntry(key_extractor_->Transform(k.user_key()));
+    if (!first) {
+      return;
+    }
+    Iterator iter(*this);
+    for (iter.SeekFrom(first, k.memtable_key().cdata());; iter.Next()) {
+      auto entry = iter.Entry();
+      if (!entry || !callback_func(callback_args, entry)) {
+        break;
+      }
+    }
+  }
+
+  uint64_t ApproximateNumEntries(const Slice& start_ikey, const Slice& end_ikey) override {
+    std::string tmp;
+    uint64_t start_count = skip_list_.EstimateCount(EncodeKey(&tmp, start_ikey));
+    uint64_t end_count = skip_list_.EstimateCount(EncodeKey(&tmp, end_ikey));
+    return (end_count >= start_count) ? (end_count - start_count) : 0;
+  }
+
+  class Iterator final : public MemTableRep::Iterator {
+   public:
+    explicit Iterator(const HashIndexedSkipListRep& rep) : rep_(rep), iter_(&rep.skip_list_) {}
+
+    const char* Entry() const override {
+      return iter_.Entry();
+    }
+
+    const char* Next() override {
+      return iter_.Next();
+    }
+
+    const char* Prev() override {
+      return iter_.Prev();
+    }
+
+    const char* Seek(Slice internal_key) override {
+      return SeekMemTableKey(internal_key, EncodeKey(&tmp_, internal_key));
+    }
+
+    const char* SeekMemTableKey(Slice internal_key, const char* memtable_key) override {
+      auto first = rep_.FindFirstEntry(rep_.key_extractor_->Transform(rep_.UserKey(memtable_key)));
+      if (first) {
+        return SeekFrom(first, memtable_key);
+      }
+      return iter_.Seek(memtable_key);
+    }
+
+    const char* SeekToFirst() override {
+      return iter_.SeekToFirst();
+    }
+
+    const char* SeekToLast() override {
+      return iter_.SeekToLast();
+    }
+
+    // Seeks to memtable_key, using first, the smallest entry with the same prefix as memtable_key,
+    // as a hint.
+    const char* SeekFrom(const char* first, const char* memtable_key) {
+      if (rep_.cmp_(memtable_key, first) <= 0) {
+        return iter_.SeekToEntry(first);
+      }
+      // Target is inside of the prefix range, do a quick linear search (at most lookahead_ steps)
+      // starting from first.
+      auto entry = iter_.SeekToEntry(first);
+      for (size_t i = 0; entry && i != rep_.lookahead_; ++i) {
+        entry = iter_.Next();
+        if (entry && rep_.cmp_(memtable_key, entry) <= 0) {
+          return entry;
+        }
+      }
+      return iter_.Seek(memtable_key);
+    }
+
+   private:
+    const HashIndexedSkipListRep& rep_;
+    SkipListImpl::Iterator iter_;
+    std::string tmp_; // For passing to EncodeKey
+  };
+
+  MemTableRep::Iterator* GetIterator(Arena* arena = nullptr) override {
+    void* mem = arena ? arena->AllocateAligned(sizeof(Iterator)) : operator new(sizeof(Iterator));
+    return new (mem) Iterator(*this);
+  }
+
+ private:
+  struct IndexNode {
+    // Points into the user key of the first entry inserted with this prefix, so it remains valid
+    // for the lifetime of the memtable.
+    Slice prefix;
+    // The smallest entry with this prefix.
+    std::atomic<const char*> first;
+    IndexNode* next;
+  };
+
+  size_t GetHash(const Slice& prefix) const {
+    return MurmurHash(prefix.data(), static_cast<int>(prefix.size()), 0) % bucket_count_;
+  }
+
+  static IndexNode* FindNode(IndexNode* node, const Slice& prefix) {
+    while (node && node->prefix != prefix) {
+      node = node->next;
+    }
+    return node;
+  }
+
+  const char* FindFirstEntry(const Slice& prefix) const {
+    auto node = FindNode(buckets_[GetHash(prefix)].load(std::memory_order_acquire), prefix);
+    return node ? node->first.load(std::memory_order_acquire) : nullptr;
+  }
+
+  void UpdateIndex(const char* key) {
+    auto prefix = key_extractor_->Transform(UserKey(key));
+    auto& bucket = buckets_[GetHash(prefix)];
+    auto head = bucket.load(std::memory_order_acquire);
+    IndexNode* new_node = nullptr;
+    for (;;) {
+      auto node = FindNode(head, prefix);
+      if (node) {
+        UpdateFirst(node, key);
+        return;
+      }
+      if (!new_node) {
+        auto mem = allocator_->AllocateAligned(sizeof(IndexNode));
+        new_node = new (mem) IndexNode;
+        new_node->prefix = prefix;
+        new_node->first.store(key, std::memory_order_relaxed);
+      }
+      new_node->next = head;
+      // On failure head is reloaded, and nodes added by concurrent writers are checked again.
+      if (bucket.compare_exchange_weak(head, new_node, std::memory_order_acq_rel)) {
+        return;
+      }
+    }
+  }
+
+  void UpdateFirst(IndexNode* node, const char* key) {
+    auto first = node->first.load(std::memory_order_acquire);
+    while (cmp_(key, first) < 0) {
+      if (node->first.compare_exchange_weak(first, key, std::memory_order_acq_rel)) {
+        return;
+      }
+    }
+  }
+
+  SkipListImpl skip_list_;
+  const MemTableRep::KeyComparator& cmp_;
+  const SliceTransform* const key_extractor_;
+  const size_t bucket_count_;
+  const size_t lookahead_;
+  std::atomic<IndexNode*>* buckets_;
+};
+
+class HashIndexedSkipListRepFactory : public MemTableRepFactory {
+ public:
+  HashIndexedSkipListRepFactory(
+      std::shared_ptr<const SliceTransform> key_extractor, size_t bucket_count, size_t lookahead)
+      : key_extractor_(std::move(key_extractor)), bucket_count_(bucket_count),
+        lookahead_(lookahead) {}
+
+  MemTableRep* CreateMemTableRep(
+      const MemTableRep::KeyComparator& compare, MemTableAllocator* allocator,
+      const SliceTransform* transform, Logger* logger) override {
+    return new HashIndexedSkipListRep(
+        compare, allocator, key_extractor_.get(), bucket_count_, lookahead_);
+  }
+
+  const char* Name() const override { return "HashIndexedSkipListRepFactory"; }
+
+  bool IsInsertConcurrentlySupported() const override { return true; }
+
+ private:
+  const std::shared_ptr<const SliceTransform> key_extractor_;
+  const size_t bucket_count_;
+  const size_t lookahead_;
+};
+
+} // namespace
+
+MemTableRepFactory* NewHashIndexedSkipListRepFactory(
+    std::shared_ptr<const SliceTransform> key_extractor, size_t bucket_count, size_t lookahead) {
+  return new HashIndexedSkipListRepFactory(std::move(key_extractor), bucket_count, lookahead);
+}
+
+} // namespace rocksdb
@@ -326,4 +326,19 @@ extern MemTableRepFactory* NewHashLinkListRepFactory(
     bool if_log_bucket_dist_when_flash = true,
     uint32_t threshold_use_skiplist = 256);
 
+// This creates MemTableReps that are backed by a skip list paired with a lock-free hash index,
+// that maps prefix of the user key to the smallest entry with this prefix. Point lookups and
+// seeks to a key, whose prefix is present in the index, start directly from the indexed entry
+// instead of searching the whole skip list.
+//
+// Parameters:
+//   key_extractor: Extracts prefix from any user key, including seek targets. All keys with the
+//     same prefix should be adjacent in the comparator order.
+//   bucket_count: Number of hash index buckets allocated for each memtable.
+//   lookahead: Max number of entries that are examined after the indexed entry, when seeking
+//     inside a prefix, before falling back to the regular skip list search.
+extern MemTableRepFactory* NewHashIndexedSkipListRepFactory(
+    std::shared_ptr<const SliceTransform> key_extractor, size_t bucket_count = 65536,
+    size_t lookahead = 8);
+
 }  // namespace rocksdb
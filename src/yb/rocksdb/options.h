@@ -37,6 +37,7 @@
 #include "yb/rocksdb/metadata.h"
 #include "yb/rocksdb/universal_compaction.h"
 
+#include "yb/util/monotime.h"
 #include "yb/util/slice.h"
 
 #ifdef max
@@ -168,9 +169,23 @@ struct CompressionOptions {
   int window_bits;
   int level;
   int strategy;
-  CompressionOptions() : window_bits(-14), level(-1), strategy(0) {}
-  CompressionOptions(int wbits, int _lev, int _strategy)
-      : window_bits(wbits), level(_lev), strategy(_strategy) {}
+  // Maximum size of dictionary used to compress data blocks of SST file, 0 disables dictionary.
+  // Dictionary is trained per SST file on its first data blocks, that are buffered by the table
+  // builder until zstd_max_train_bytes of them are collected, and stored in the SST file.
+  // Used only by kZSTDNotFinalCompression.
+  uint32_t max_dict_bytes;
+  // Size of data blocks used to train dictionary. 0 means 100 * max_dict_bytes.
+  uint32_t zstd_max_train_bytes;
+  // Number of threads used by each table builder to compress data blocks, while the builder keeps
+  // filling the following blocks. 1 means data blocks are compressed by the builder thread itself.
+  // Not used together with dictionary compression, block based filter and hash index.
+  uint32_t parallel_threads = 1;
+  CompressionOptions()
+      : window_bits(-14), level(-1), strategy(0), max_dict_bytes(0), zstd_max_train_bytes(0) {}
+  CompressionOptions(int wbits, int _lev, int _strategy, uint32_t _max_dict_bytes = 0,
+                     uint32_t _zstd_max_train_bytes = 0)
+      : window_bits(wbits), level(_lev), strategy(_strategy), max_dict_bytes(_max_dict_bytes),
+        zstd_max_train_bytes(_zstd_max_train_bytes) {}
 };
 
 enum UpdateStatus {    // Return status For inplace update callback
@@ -814,6 +829,19 @@ struct ColumnFamilyOptions {
   // Default: false
   bool compaction_measure_io_stats;
 
+  // Values of at least this size are written to a separate blob file during flush and
+  // compaction, and the SST file stores only a reference to them. This keeps large values out
+  // of the LSM tree, so compactions don't have to rewrite them over and over.
+  // Blob separation is not used when merge_operator is set.
+  // Default: 0 (disabled)
+  uint64_t min_blob_size;
+
+  // A compaction rewrites the values still referenced from a blob file when at least this
+  // fraction of the blob file is garbage, so the blob file can be deleted afterwards.
+  // Values stored in other blob files are carried over as references.
+  // Default: 0.5
+  double blob_garbage_collection_ratio;
+
   // Create ColumnFamilyOptions with default values for all fields
   ColumnFamilyOptions();
   // Create ColumnFamilyOptions from Options
@@ -830,6 +858,10 @@ using IteratorReplacer =
 using CompactionContextFactory = std::function<CompactionContextPtr(
     CompactionFeed* feed, const CompactionContextOptions& options)>;
 
+// Returns size of the prefix of the specified user key that could be used as a boundary between
+// subcompactions, or 0 if there is no such prefix.
+using SubcompactionBoundaryExtractor = std::function<size_t(Slice user_key)>;
+
 struct DBOptions {
   // Some functions that make it easier to optimize RocksDB
 
@@ -1172,6 +1204,22 @@ struct DBOptions {
   // Default: 0
   size_t compaction_readahead_size;
 
+  // Use O_DIRECT for SST files written by flush and compaction, so background writes do not evict
+  // pages used by foreground reads from the OS page cache. Files wrapped by the environment, e.g.
+  // encrypted ones, are still written through the OS page cache, since wrappers use Append.
+  //
+  // Default: false
+  bool use_direct_io_for_flush_and_compaction;
+
+  // Use O_DIRECT for reading compaction inputs. Reads are aligned internally, so it is recommended
+  // to set compaction_readahead_size as well to avoid small reads bypassing OS page cache.
+  //
+  // When true, we also force new_table_reader_for_compaction_inputs to true, so file descriptors
+  // used by user queries are not affected.
+  //
+  // Default: false
+  bool use_direct_reads_for_compaction_inputs;
+
   // This is a maximum buffer size that is used by WinMmapReadableFile in
   // unbuffered disk I/O mode. We need to maintain an aligned buffer for
   // reads. We allow the buffer to grow until the specified value and then
@@ -1248,6 +1296,15 @@ struct DBOptions {
   // Default: 2MB/s
   uint64_t delayed_write_rate;
 
+  // If true, instead of starting from delayed_write_rate and adjusting it by a fixed ratio,
+  // delayed write rate is set proportionally to the write stall pressure, which grows gradually
+  // from 0 when level0_slowdown_writes_trigger or soft_pending_compaction_bytes_limit (checked
+  // against the pending compaction bytes predicted from their recent growth) is reached, to 1
+  // when writes would be stopped.
+  //
+  // Default: false
+  bool proportional_write_delay;
+
   // If true, allow multi-writers to update mem tables in parallel.
   // Only some memtable_factory-s support concurrent writes; currently it
   // is implemented only for SkipListFactory.  Concurrent memtable writes
@@ -1329,6 +1386,11 @@ struct DBOptions {
 
   std::shared_ptr<CompactionContextFactory> compaction_context_factory;
 
+  // Used to adjust boundaries between subcompactions, so that records which should be processed by
+  // the same compaction feed (e.g. belong to the same document) are not split between them.
+  // All keys sharing the extracted prefix are processed by the same subcompaction.
+  std::shared_ptr<SubcompactionBoundaryExtractor> subcompaction_boundary_extractor;
+
   // Function that returns max file size for compaction.
   // Supported only for level0 of universal style compactions.
   std::shared_ptr<std::function<uint64_t()>> max_file_size_for_compaction;
@@ -1527,6 +1589,15 @@ struct ReadOptions {
   // Statistics object to use instead of the DB statistics object (default).
   Statistics* statistics = nullptr;
 
+  // If non zero, once iterator detects that consecutive data blocks of an SST file are read in
+  // forward direction, it asks the file to asynchronously prefetch readahead_size bytes following
+  // the current data block into OS page cache.
+  // Default: 0
+  size_t readahead_size = 0;
+
+  // New prefetches are not started after this time.
+  yb::CoarseTimePoint readahead_deadline = yb::CoarseTimePoint::max();
+
   static const ReadOptions kDefault;
 
   ReadOptions();
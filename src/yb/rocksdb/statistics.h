@@ -218,6 +218,15 @@ enum Tickers : uint32_t {
   COMPACTION_FILES_FILTERED,
   COMPACTION_FILES_NOT_FILTERED,
 
+  // Number of data block readaheads started by sequential iteration.
+  NUMBER_DATA_BLOCK_READAHEADS,
+
+  // Number of data block prefetches started by DB::PrefetchKeys.
+  NUMBER_DATA_BLOCK_KEY_PREFETCHES,
+
+  // Number of data blocks not added to the block cache because the table went over its quota.
+  BLOCK_CACHE_DATA_QUOTA_BYPASSES,
+
   // End of ticker enum.
   TICKER_ENUM_MAX,
 };
@@ -321,6 +330,10 @@ const std::vector<std::pair<Tickers, std::string>> TickersNameMap = {
 
     {COMPACTION_FILES_FILTERED, "rocksdb_compaction_files_filtered"},
     {COMPACTION_FILES_NOT_FILTERED, "rocksdb_compaction_files_not_filtered"},
+
+    {NUMBER_DATA_BLOCK_READAHEADS, "rocksdb_number_data_block_readaheads"},
+    {NUMBER_DATA_BLOCK_KEY_PREFETCHES, "rocksdb_number_data_block_key_prefetches"},
+    {BLOCK_CACHE_DATA_QUOTA_BYPASSES, "rocksdb_block_cache_data_quota_bypasses"},
 };
 
 /**
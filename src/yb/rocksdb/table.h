@@ -93,6 +93,17 @@ struct BlockBasedTableOptions {
   // Note: Fixed-size bloom filter data blocks are never pre-loaded.
   bool cache_index_and_filter_blocks = false;
 
+  // Insert filter blocks into the block cache as multi-touch entries, so they are not pushed out
+  // by data blocks of scans. Fixed-size bloom filter is partitioned: only its filter index is kept
+  // by the table reader, filter blocks are loaded on demand through the block cache, so this
+  // keeps hot filter blocks resident while the rest of filter memory is shared with data blocks.
+  bool cache_filter_blocks_with_high_priority = false;
+
+  // Insert index blocks into the block cache as multi-touch entries. Together with
+  // cache_filter_blocks_with_high_priority this keeps index and filter blocks of the table
+  // resident when scans of other tables flood the single-touch part of the cache.
+  bool cache_index_blocks_with_high_priority = false;
+
   IndexType index_type = IndexType::kMultiLevelBinarySearch;
 
   // Influence the behavior when kHashSearch is used.
@@ -163,6 +174,18 @@ struct BlockBasedTableOptions {
   KeyValueEncodingFormat data_block_key_value_encoding_format =
       KeyValueEncodingFormat::kKeyDeltaEncodingSharedPrefix;
 
+  // Append hash index to data blocks to narrow down binary search over restart points on seek.
+  // Data blocks with hash index can't be read by versions without hash index support.
+  //
+  // Default: false
+  bool use_data_block_hash_index = false;
+
+  // Optional transform applied to user keys before hashing them into the data block hash index.
+  // Keys that differ only by version could be transformed to the same key, so seek for a key
+  // without version could use the index. Transformed key must be a prefix of the user key.
+  // Should not be changed for existing SST files, otherwise index won't be useful for them.
+  std::shared_ptr<const SliceTransform> data_block_hash_key_extractor;
+
   // If non-nullptr, use the specified filter policy for new SST files to reduce disk reads.
   // Many applications will benefit from passing the result of
   // NewBloomFilterPolicy() here.
@@ -36,6 +36,7 @@
 #include "yb/rocksdb/table/block_hash_index.h"
 #include "yb/rocksdb/table/block_internal.h"
 #include "yb/rocksdb/table/block_prefix_index.h"
+#include "yb/rocksdb/table/data_block_hash_index.h"
 #include "yb/rocksdb/table/format.h"
 #include "yb/rocksdb/util/coding.h"
 #include "yb/rocksdb/util/perf_context_imp.h"
@@ -175,6 +176,8 @@ void BlockIter::Initialize(
   restart_index_ = num_restarts_;
   hash_index_ = hash_index;
   prefix_index_ = prefix_index;
+  data_block_hash_index_ = nullptr;
+  data_block_hash_key_extractor_ = nullptr;
 }
 
 const KeyValueEntry& BlockIter::Seek(Slice target) {
@@ -186,9 +189,12 @@ const KeyValueEntry& BlockIter::Seek(Slice target) {
   bool ok = false;
   if (prefix_index_) {
     ok = PrefixSeek(target, &index);
+  } else if (hash_index_) {
+    ok = HashSeek(target, &index);
+  } else if (data_block_hash_index_) {
+    ok = DataBlockHashSeek(target, &index);
   } else {
-    ok = hash_index_ ? HashSeek(target, &index)
-      : BinarySeek(target, 0, num_restarts_ - 1, &index);
+    ok = BinarySeek(target, 0, num_restarts_ - 1, &index);
   }
 
   if (!ok) {
@@ -545,9 +551,44 @@ bool BlockIter::PrefixSeek(const Slice& target, uint32_t* index) {
   }
 }
 
+bool BlockIter::DataBlockHashSeek(const Slice& target, uint32_t* index) {
+  uint32_t first, last;
+  if (!data_block_hash_index_->Lookup(
+          DataBlockHashIndexHash(target, data_block_hash_key_extractor_), &first, &last) ||
+      last >= num_restarts_) {
+    return BinarySeek(target, 0, num_restarts_ - 1, index);
+  }
+
+  // Index only gives a hint, target might be absent in the block or have the same hash as another
+  // key. So check that restart key at `first` is before the target, BinarySeek does the rest.
+  if (first > 0) {
+    int cmp = CompareBlockKey(first, target);
+    if (!status_.ok()) {
+      return false;
+    }
+    if (cmp >= 0) {
+      // Usually happens when the run of the target starts at the restart point, so the target
+      // belongs to the previous restart interval if its restart key is before the target.
+      --first;
+      if (first > 0) {
+        cmp = CompareBlockKey(first, target);
+        if (!status_.ok()) {
+          return false;
+        }
+        if (cmp >= 0) {
+          return BinarySeek(target, 0, first, index);
+        }
+      }
+      *index = first;
+      return true;
+    }
+  }
+  return BinarySeek(target, first, last, index);
+}
+
 uint32_t Block::NumRestarts() const {
   assert(size_ >= kMinBlockSize);
-  return DecodeFixed32(data_ + size_ - sizeof(uint32_t));
+  return num_restarts_;
 }
 
 Block::Block(BlockContents&& contents)
@@ -556,20 +597,29 @@ Block::Block(BlockContents&& contents)
       size_(contents_.data.size()) {
   if (size_ < sizeof(uint32_t)) {
     size_ = 0;  // Error marker
-  } else {
-    restart_offset_ =
-        static_cast<uint32_t>(size_) - (1 + NumRestarts()) * sizeof(uint32_t);
-    if (restart_offset_ > size_ - sizeof(uint32_t)) {
-      // The size is too small for NumRestarts() and therefore
-      // restart_offset_ wrapped around.
+    return;
+  }
+  const auto footer = DecodeFixed32(data_ + size_ - sizeof(uint32_t));
+  num_restarts_ = footer & kDataBlockMaxNumRestartsMask;
+  auto restarts_end = static_cast<uint32_t>(size_ - sizeof(uint32_t));
+  if (footer & kDataBlockHashIndexFlag) {
+    if (!data_block_hash_index_.Initialize(data_, restarts_end, &restarts_end)) {
       size_ = 0;
+      return;
     }
   }
+  const uint64_t restarts_size = static_cast<uint64_t>(num_restarts_) * sizeof(uint32_t);
+  if (restarts_size > restarts_end) {
+    // The size is too small for NumRestarts().
+    size_ = 0;
+    return;
+  }
+  restart_offset_ = static_cast<uint32_t>(restarts_end - restarts_size);
 }
 
 InternalIterator* Block::NewIterator(
     const Comparator* cmp, const KeyValueEncodingFormat key_value_encoding_format, BlockIter* iter,
-    const bool total_order_seek) const {
+    const bool total_order_seek, const SliceTransform* data_block_hash_key_extractor) const {
   if (size_ < kMinBlockSize) {
     if (iter != nullptr) {
       iter->SetStatus(BadBlockContentsError());
@@ -592,12 +642,15 @@ InternalIterator* Block::NewIterator(
     BlockPrefixIndex* prefix_index_ptr =
         total_order_seek ? nullptr : prefix_index_.get();
 
-    if (iter != nullptr) {
-      iter->Initialize(cmp, data_, key_value_encoding_format, restart_offset_, num_restarts,
-                    hash_index_ptr, prefix_index_ptr);
-    } else {
-      iter = new BlockIter(cmp, data_, key_value_encoding_format, restart_offset_, num_restarts,
-                           hash_index_ptr, prefix_index_ptr);
+    if (iter == nullptr) {
+      iter = new BlockIter();
+    }
+    iter->Initialize(cmp, data_, key_value_encoding_format, restart_offset_, num_restarts,
+                     hash_index_ptr, prefix_index_ptr);
+    if (data_block_hash_index_.Initialized()) {
+      // Hash index is only used as a hint for binary search, so it is used even for total order
+      // seek.
+      iter->SetDataBlockHashIndex(&data_block_hash_index_, data_block_hash_key_extractor);
     }
   }
 
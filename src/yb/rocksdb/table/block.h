@@ -34,6 +34,7 @@
 #include "yb/rocksdb/db/dbformat.h"
 #include "yb/rocksdb/table/block_prefix_index.h"
 #include "yb/rocksdb/table/block_hash_index.h"
+#include "yb/rocksdb/table/data_block_hash_index.h"
 #include "yb/rocksdb/table/format.h"
 #include "yb/rocksdb/table/internal_iterator.h"
 
@@ -46,6 +47,7 @@ class Comparator;
 class BlockIter;
 class BlockHashIndex;
 class BlockPrefixIndex;
+class SliceTransform;
 
 // Determines which middle point should be taken in case of even number of total points.
 // NOTE! This enum must not be changed unless all the usages are verified!
@@ -90,10 +92,12 @@ class Block {
   // This option only applies for index block. For data block, hash_index_
   // and prefix_index_ are null, so this option does not matter.
   // key_value_encoding_format specifies what kind of algorithm to use for decoding entries.
-  InternalIterator* NewIterator(const Comparator* comparator,
-                                KeyValueEncodingFormat key_value_encoding_format,
-                                BlockIter* iter = nullptr,
-                                bool total_order_seek = true) const;
+  // data_block_hash_key_extractor should be the same as the one used to build data block hash
+  // index, it is only used if block contains such index.
+  InternalIterator* NewIterator(
+      const Comparator* comparator, KeyValueEncodingFormat key_value_encoding_format,
+      BlockIter* iter = nullptr, bool total_order_seek = true,
+      const SliceTransform* data_block_hash_key_extractor = nullptr) const;
 
   inline InternalIterator* NewIndexIterator(
       const Comparator* comparator, BlockIter* iter = nullptr, bool total_order_seek = true) const {
@@ -138,9 +142,11 @@ class Block {
   BlockContents contents_;
   const char* data_;            // contents_.data.data()
   size_t size_;                 // contents_.data.size()
-  uint32_t restart_offset_;     // Offset in data_ of restart array
+  uint32_t restart_offset_ = 0; // Offset in data_ of restart array
+  uint32_t num_restarts_ = 0;
   std::unique_ptr<BlockHashIndex> hash_index_;
   std::unique_ptr<BlockPrefixIndex> prefix_index_;
+  DataBlockHashIndex data_block_hash_index_;
 
   // No copying allowed
   Block(const Block&);
@@ -179,6 +185,12 @@ class BlockIter final : public InternalIterator {
     status_ = s;
   }
 
+  void SetDataBlockHashIndex(
+      const DataBlockHashIndex* data_block_hash_index, const SliceTransform* hash_key_extractor) {
+    data_block_hash_index_ = data_block_hash_index;
+    data_block_hash_key_extractor_ = hash_key_extractor;
+  }
+
   virtual Status status() const override { return status_; }
 
   virtual const KeyValueEntry& Entry() const override {
@@ -236,6 +248,8 @@ class BlockIter final : public InternalIterator {
   Status status_;
   const BlockHashIndex* hash_index_;
   const BlockPrefixIndex* prefix_index_;
+  const DataBlockHashIndex* data_block_hash_index_ = nullptr;
+  const SliceTransform* data_block_hash_key_extractor_ = nullptr;
 
   inline int Compare(const Slice& a, const Slice& b) const {
     return comparator_->Compare(a, b);
@@ -283,6 +297,8 @@ class BlockIter final : public InternalIterator {
 
   bool PrefixSeek(const Slice& target, uint32_t* index);
 
+  bool DataBlockHashSeek(const Slice& target, uint32_t* index);
+
 };
 
 }  // namespace rocksdb
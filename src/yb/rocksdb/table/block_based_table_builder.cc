@@ -27,9 +27,13 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 
@@ -110,7 +114,8 @@ bool GoodCompressionRatio(size_t compressed_size, size_t raw_size) {
 Slice CompressBlock(const Slice& raw,
                     const CompressionOptions& compression_options,
                     CompressionType* type, uint32_t format_version,
-                    std::string* compressed_output) {
+                    std::string* compressed_output,
+                    const CompressionDict* compression_dict) {
   if (*type == kNoCompression) {
     return raw;
   }
@@ -163,7 +168,7 @@ Slice CompressBlock(const Slice& raw,
       break;     // fall back to no compression.
     case kZSTDNotFinalCompression:
       if (ZSTD_Compress(compression_options, raw.cdata(), raw.size(),
-                        compressed_output) &&
+                        compressed_output, compression_dict) &&
           GoodCompressionRatio(compressed_output->size(), raw.size())) {
         return *compressed_output;
       }
@@ -177,6 +182,133 @@ Slice CompressBlock(const Slice& raw,
   return raw;
 }
 
+// Compresses data blocks on worker threads, while the builder thread keeps filling the following
+// data blocks. Compressed blocks are handed back to the builder thread in their original order,
+// since block handles and index entries depend on the sizes of all preceding blocks.
+class ParallelCompressionRep {
+ public:
+  struct BlockRep {
+    std::string raw_contents;
+    std::string compressed_output;
+    // Either raw_contents or compressed_output, depending on the compression outcome.
+    Slice contents;
+    CompressionType type;
+    std::string last_key;
+    std::string next_block_first_key;
+    bool compressed = false;
+  };
+
+  ParallelCompressionRep(
+      size_t num_threads, CompressionType compression_type,
+      const CompressionOptions& compression_opts, uint32_t format_version,
+      uint64_t compression_size_limit, Statistics* statistics)
+      : compression_type_(compression_type), compression_opts_(compression_opts),
+        format_version_(format_version), compression_size_limit_(compression_size_limit),
+        statistics_(statistics), max_blocks_in_flight_(2 * num_threads) {
+    threads_.reserve(num_threads);
+    for (size_t i = 0; i != num_threads; ++i) {
+      threads_.emplace_back([this] { Execute(); });
+    }
+  }
+
+  ~ParallelCompressionRep() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    compress_cond_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  void Add(std::unique_ptr<BlockRep> block) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      raw_bytes_in_flight_ += block->raw_contents.size();
+      blocks_.push_back(std::move(block));
+    }
+    compress_cond_.notify_one();
+  }
+
+  // Returns the oldest block if it was already compressed. Waits for its compression if there are
+  // more than max_blocks_in_flight blocks in flight, so memory used by queued blocks is bounded.
+  // Returns nullptr if there is no block ready.
+  std::unique_ptr<BlockRep> Pop(size_t max_blocks_in_flight) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (blocks_.empty()) {
+      return nullptr;
+    }
+    if (blocks_.size() > max_blocks_in_flight) {
+      done_cond_.wait(lock, [this] { return blocks_.front()->compressed; });
+    } else if (!blocks_.front()->compressed) {
+      return nullptr;
+    }
+    auto result = std::move(blocks_.front());
+    blocks_.pop_front();
+    --next_to_compress_;
+    raw_bytes_in_flight_ -= result->raw_contents.size();
+    return result;
+  }
+
+  size_t max_blocks_in_flight() const {
+    return max_blocks_in_flight_;
+  }
+
+  size_t raw_bytes_in_flight() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return raw_bytes_in_flight_;
+  }
+
+ private:
+  void Execute() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      compress_cond_.wait(lock, [this] { return stop_ || next_to_compress_ < blocks_.size(); });
+      if (stop_) {
+        return;
+      }
+      auto* block = blocks_[next_to_compress_++].get();
+      lock.unlock();
+      Compress(block);
+      lock.lock();
+      block->compressed = true;
+      done_cond_.notify_all();
+    }
+  }
+
+  void Compress(BlockRep* block) {
+    block->type = compression_type_;
+    if (block->raw_contents.size() < compression_size_limit_) {
+      block->contents = CompressBlock(
+          block->raw_contents, compression_opts_, &block->type, format_version_,
+          &block->compressed_output, nullptr /* compression_dict */);
+    } else {
+      RecordTick(statistics_, NUMBER_BLOCK_NOT_COMPRESSED);
+      block->type = kNoCompression;
+      block->contents = block->raw_contents;
+    }
+  }
+
+  const CompressionType compression_type_;
+  const CompressionOptions compression_opts_;
+  const uint32_t format_version_;
+  const uint64_t compression_size_limit_;
+  Statistics* const statistics_;
+  const size_t max_blocks_in_flight_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable compress_cond_;
+  std::condition_variable done_cond_;
+  // Blocks in the order they should be written to the file.
+  std::deque<std::unique_ptr<BlockRep>> blocks_;
+  // Index in blocks_ of the first block not picked by compression threads.
+  size_t next_to_compress_ = 0;
+  size_t raw_bytes_in_flight_ = 0;
+  bool stop_ = false;
+  std::vector<std::thread> threads_;
+};
+
 }  // namespace
 
 // kBlockBasedTableMagicNumber was picked by running
@@ -301,6 +433,23 @@ struct BlockBasedTableBuilder::Rep {
   std::string compressed_output;
   std::unique_ptr<FlushBlockPolicy> flush_block_policy;
 
+  // Data blocks are buffered until there is enough of them to train compression dictionary, see
+  // CompressionOptions::max_dict_bytes.
+  struct BufferedDataBlock {
+    size_t size;
+    std::string last_key;
+    std::string next_block_first_key;
+  };
+  bool buffer_data_blocks = false;
+  size_t dict_train_bytes = 0;
+  // Concatenated contents of buffered data blocks.
+  std::string buffered_data;
+  std::vector<BufferedDataBlock> buffered_data_blocks;
+  std::unique_ptr<CompressionDict> compression_dict;
+
+  // Not null when data blocks are compressed in parallel, see CompressionOptions::parallel_threads.
+  std::unique_ptr<ParallelCompressionRep> parallel_compression;
+
   std::vector<std::unique_ptr<IntTblPropCollector>> table_properties_collectors;
 
   yb::MemTrackerPtr mem_tracker;
@@ -316,7 +465,8 @@ struct BlockBasedTableBuilder::Rep {
       WritableFileWriter* data_file,
       const CompressionType _compression_type,
       const CompressionOptions& _compression_opts,
-      const bool skip_filters);
+      const bool skip_filters,
+      uint64_t compression_size_limit);
 
   bool is_split_sst() const { return data_writer != metadata_writer; }
 };
@@ -353,7 +503,8 @@ BlockBasedTableBuilder::Rep::Rep(
     WritableFileWriter* data_file,
     const CompressionType _compression_type,
     const CompressionOptions& _compression_opts,
-    const bool skip_filters)
+    const bool skip_filters,
+    uint64_t compression_size_limit)
     : ioptions(_ioptions),
       table_options(table_opt),
       internal_comparator(icomparator),
@@ -362,7 +513,9 @@ BlockBasedTableBuilder::Rep::Rep(
           _ioptions, table_options, filter_type)),
       data_block_builder(
           table_options.block_restart_interval,
-          table_options.data_block_key_value_encoding_format, table_options.use_delta_encoding),
+          table_options.data_block_key_value_encoding_format, table_options.use_delta_encoding,
+          table_options.use_data_block_hash_index,
+          table_options.data_block_hash_key_extractor.get()),
       internal_prefix_transform(_ioptions.prefix_extractor),
       filter_key_transformer(table_opt.filter_policy ?
           table_opt.filter_policy->GetKeyTransformer() : nullptr),
@@ -386,6 +539,26 @@ BlockBasedTableBuilder::Rep::Rep(
         "BlockBasedTableBuilder", _ioptions.mem_tracker);
   }
 
+  // Buffered blocks get their offsets only after dictionary is trained, so dictionary is not used
+  // with block based filter and hash index, that need data block offsets while keys are added.
+  if (compression_type == kZSTDNotFinalCompression && compression_opts.max_dict_bytes > 0 &&
+      ZSTD_Supported() && filter_type != FilterType::kBlockBasedFilter &&
+      table_options.index_type != IndexType::kHashSearch) {
+    buffer_data_blocks = true;
+    dict_train_bytes = compression_opts.zstd_max_train_bytes > 0
+        ? compression_opts.zstd_max_train_bytes : 100ULL * compression_opts.max_dict_bytes;
+  }
+
+  // Same as for buffered blocks, offsets of data blocks compressed in parallel are known only
+  // after all preceding blocks are compressed.
+  if (compression_opts.parallel_threads > 1 && compression_type != kNoCompression &&
+      !buffer_data_blocks && filter_type != FilterType::kBlockBasedFilter &&
+      table_options.index_type != IndexType::kHashSearch) {
+    parallel_compression = std::make_unique<ParallelCompressionRep>(
+        compression_opts.parallel_threads, compression_type, compression_opts,
+        table_options.format_version, compression_size_limit, ioptions.statistics);
+  }
+
   metadata_writer = std::make_shared<FileWriterWithOffsetAndCachePrefix>();
   metadata_writer->writer = metadata_file;
   if (data_file != nullptr) {
@@ -427,7 +600,7 @@ BlockBasedTableBuilder::BlockBasedTableBuilder(
 
   rep_ = new Rep(ioptions, sanitized_table_options, internal_comparator,
                  int_tbl_prop_collector_factories, column_family_id, metadata_file, data_file,
-                 compression_type, compression_opts, skip_filters);
+                 compression_type, compression_opts, skip_filters, kCompressionSizeLimit);
 
   if (rep_->filter_block_builder != nullptr) {
     rep_->filter_block_builder->StartBlock(0);
@@ -498,12 +671,90 @@ void BlockBasedTableBuilder::FlushDataBlock(const Slice& next_block_first_key) {
   Rep* const r = rep_;
   assert(!r->closed);
   if (!ok()) return;
-  size_t data_block_size = 0;
 
-  if (!r->data_block_builder.empty()) {
-    data_block_size = WriteBlock(&r->data_block_builder, &r->data_pending_handle,
-        r->data_writer.get());
+  if (r->buffer_data_blocks) {
+    auto block_contents = r->data_block_builder.Finish();
+    r->buffered_data.append(block_contents.cdata(), block_contents.size());
+    r->buffered_data_blocks.push_back(Rep::BufferedDataBlock {
+        block_contents.size(), r->last_key, next_block_first_key.ToBuffer() });
+    r->data_block_builder.Reset();
+    if (r->buffered_data.size() >= r->dict_train_bytes) {
+      WriteBufferedDataBlocks();
+    }
+    return;
   }
+
+  if (r->parallel_compression) {
+    auto block = std::make_unique<ParallelCompressionRep::BlockRep>();
+    block->raw_contents = r->data_block_builder.Finish().ToBuffer();
+    block->last_key = r->last_key;
+    block->next_block_first_key = next_block_first_key.ToBuffer();
+    r->data_block_builder.Reset();
+    r->parallel_compression->Add(std::move(block));
+    WriteCompressedDataBlocks(r->parallel_compression->max_blocks_in_flight());
+    return;
+  }
+
+  WriteDataBlock(r->data_block_builder.Finish(), &r->last_key, next_block_first_key);
+  r->data_block_builder.Reset();
+}
+
+void BlockBasedTableBuilder::WriteCompressedDataBlocks(size_t max_blocks_in_flight) {
+  Rep* const r = rep_;
+  while (ok()) {
+    auto block = r->parallel_compression->Pop(max_blocks_in_flight);
+    if (!block) {
+      break;
+    }
+    WriteDataBlock(
+        block->contents, block->type, &block->last_key, block->next_block_first_key);
+  }
+}
+
+void BlockBasedTableBuilder::WriteBufferedDataBlocks() {
+  Rep* const r = rep_;
+  r->buffer_data_blocks = false;
+
+  std::vector<size_t> sample_sizes;
+  sample_sizes.reserve(r->buffered_data_blocks.size());
+  for (const auto& block : r->buffered_data_blocks) {
+    sample_sizes.push_back(block.size);
+  }
+  auto dict = ZSTD_TrainDictionary(
+      r->buffered_data, sample_sizes, r->compression_opts.max_dict_bytes);
+  if (!dict.empty()) {
+    r->compression_dict = std::make_unique<CompressionDict>(
+        std::move(dict), r->compression_opts.level);
+  }
+
+  size_t offset = 0;
+  for (auto& block : r->buffered_data_blocks) {
+    WriteDataBlock(
+        Slice(r->buffered_data.data() + offset, block.size), &block.last_key,
+        block.next_block_first_key);
+    if (!ok()) break;
+    offset += block.size;
+  }
+  std::string().swap(r->buffered_data);
+  std::vector<Rep::BufferedDataBlock>().swap(r->buffered_data_blocks);
+}
+
+void BlockBasedTableBuilder::WriteDataBlock(
+    const Slice& block_contents, std::string* last_key, const Slice& next_block_first_key) {
+  Rep* const r = rep_;
+  auto type = r->compression_type;
+  auto contents = CompressBlockContents(
+      block_contents, &type, &r->compressed_output, r->compression_dict.get());
+  WriteDataBlock(contents, type, last_key, next_block_first_key);
+  r->compressed_output.clear();
+}
+
+void BlockBasedTableBuilder::WriteDataBlock(
+    const Slice& block_contents, CompressionType type, std::string* last_key,
+    const Slice& next_block_first_key) {
+  Rep* const r = rep_;
+  const size_t data_block_size = WriteRawBlock(
+      block_contents, type, &r->data_pending_handle, r->data_writer.get());
   if (!ok()) return;
 
   if (!r->table_options.skip_table_builder_flush) {
@@ -526,7 +777,7 @@ void BlockBasedTableBuilder::FlushDataBlock(const Slice& next_block_first_key) {
   // "the r" as the key for the index block entry since it is >= all
   // entries in the first block and < all entries in subsequent
   // blocks.
-  r->data_index_builder->AddIndexEntry(&r->last_key,
+  r->data_index_builder->AddIndexEntry(last_key,
       next_block_first_key.empty() ? nullptr : &next_block_first_key,
       r->data_pending_handle);
   while (r->data_index_builder->ShouldFlush()) {
@@ -583,7 +834,8 @@ size_t BlockBasedTableBuilder::WriteBlock(BlockBuilder* block,
 
 size_t BlockBasedTableBuilder::WriteBlock(const Slice& raw_block_contents,
     BlockHandle* handle,
-    FileWriterWithOffsetAndCachePrefix* writer_info) {
+    FileWriterWithOffsetAndCachePrefix* writer_info,
+    const CompressionDict* compression_dict) {
   // File format contains a sequence of blocks where each block has:
   //    block_data: uint8[n]
   //    type: uint8
@@ -592,21 +844,26 @@ size_t BlockBasedTableBuilder::WriteBlock(const Slice& raw_block_contents,
   Rep* r = rep_;
 
   auto type = r->compression_type;
-  Slice block_contents;
-  if (raw_block_contents.size() < kCompressionSizeLimit) {
-    block_contents =
-        CompressBlock(raw_block_contents, r->compression_opts, &type,
-                      r->table_options.format_version, &r->compressed_output);
-  } else {
-    RecordTick(r->ioptions.statistics, NUMBER_BLOCK_NOT_COMPRESSED);
-    type = kNoCompression;
-    block_contents = raw_block_contents;
-  }
+  auto block_contents = CompressBlockContents(
+      raw_block_contents, &type, &r->compressed_output, compression_dict);
   size_t block_size = WriteRawBlock(block_contents, type, handle, writer_info);
   r->compressed_output.clear();
   return block_size;
 }
 
+Slice BlockBasedTableBuilder::CompressBlockContents(
+    const Slice& raw_block_contents, CompressionType* type, std::string* compressed_output,
+    const CompressionDict* compression_dict) {
+  Rep* r = rep_;
+  if (raw_block_contents.size() < kCompressionSizeLimit) {
+    return CompressBlock(raw_block_contents, r->compression_opts, type,
+                         r->table_options.format_version, compressed_output, compression_dict);
+  }
+  RecordTick(r->ioptions.statistics, NUMBER_BLOCK_NOT_COMPRESSED);
+  *type = kNoCompression;
+  return raw_block_contents;
+}
+
 size_t BlockBasedTableBuilder::WriteRawBlock(const Slice& block_contents,
                                              CompressionType type,
                                              BlockHandle* handle,
@@ -717,6 +974,13 @@ Status BlockBasedTableBuilder::Finish() {
   if (!r->data_block_builder.empty()) {
     FlushDataBlock(end_slice);  // no more data block
   }
+  if (r->buffer_data_blocks) {
+    WriteBufferedDataBlocks();
+  }
+  if (r->parallel_compression) {
+    WriteCompressedDataBlocks(0 /* max_blocks_in_flight */);
+    r->parallel_compression.reset();
+  }
   if (r->filter_block_builder != nullptr) {
     FlushFilterBlock(nullptr);  // no more filter block
   }
@@ -743,6 +1007,15 @@ Status BlockBasedTableBuilder::Finish() {
     meta_index_builder.Add(item.first, block_handle);
   }
 
+  if (ok() && r->compression_dict) {
+    BlockHandle compression_dict_block_handle;
+    WriteRawBlock(
+        r->compression_dict->raw(), kNoCompression, &compression_dict_block_handle,
+        r->metadata_writer.get());
+    meta_index_builder.Add(
+        block_based_table::kCompressionDictBlock, compression_dict_block_handle);
+  }
+
   if (ok()) {
     if (r->filter_block_builder != nullptr) {
       // Add mapping from "<filter_block_prefix>.Name" to location of either filter block or
@@ -858,6 +1131,7 @@ void BlockBasedTableBuilder::Abandon() {
   Rep* r = rep_;
   assert(!r->closed);
   r->closed = true;
+  r->parallel_compression.reset();
 }
 
 uint64_t BlockBasedTableBuilder::NumEntries() const {
@@ -865,8 +1139,11 @@ uint64_t BlockBasedTableBuilder::NumEntries() const {
 }
 
 uint64_t BlockBasedTableBuilder::TotalFileSize() const {
-  return rep_->is_split_sst() ? rep_->metadata_writer->offset + rep_->data_writer->offset :
-      rep_->metadata_writer->offset;
+  // Buffered data blocks are taken into account, so compaction does not overshoot output file size.
+  // Blocks being compressed in parallel are accounted by their raw size.
+  return (rep_->is_split_sst() ? rep_->metadata_writer->offset + rep_->data_writer->offset :
+      rep_->metadata_writer->offset) + rep_->buffered_data.size() +
+      (rep_->parallel_compression ? rep_->parallel_compression->raw_bytes_in_flight() : 0);
 }
 
 uint64_t BlockBasedTableBuilder::BaseFileSize() const {
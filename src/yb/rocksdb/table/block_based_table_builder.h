@@ -38,6 +38,7 @@
 namespace rocksdb {
 
 class BlockBuilder;
+class CompressionDict;
 class BlockHandle;
 class WritableFile;
 struct BlockBasedTableOptions;
@@ -116,9 +117,15 @@ class BlockBasedTableBuilder : public TableBuilder {
                     FileWriterWithOffsetAndCachePrefix* writer_info);
   // Directly write block content to the file. Returns number of bytes written to file.
   size_t WriteBlock(const Slice& block_contents, BlockHandle* handle,
-      FileWriterWithOffsetAndCachePrefix* writer_info);
+      FileWriterWithOffsetAndCachePrefix* writer_info,
+      const CompressionDict* compression_dict = nullptr);
   size_t WriteRawBlock(const Slice& data, CompressionType, BlockHandle* handle,
       FileWriterWithOffsetAndCachePrefix* writer_info);
+  // Returns compressed block contents, either stored in compressed_output or raw_block_contents
+  // itself if block was not compressed. Updates type accordingly.
+  Slice CompressBlockContents(
+      const Slice& raw_block_contents, CompressionType* type, std::string* compressed_output,
+      const CompressionDict* compression_dict);
   Status InsertBlockInCache(const Slice& block_contents,
                             const CompressionType type,
       const BlockHandle* handle,
@@ -134,6 +141,22 @@ class BlockBasedTableBuilder : public TableBuilder {
   // REQUIRES: Finish(), Abandon() have not been called.
   void FlushDataBlock(const Slice& next_block_first_key);
 
+  // Writes data block to data file and adds it to the data index.
+  void WriteDataBlock(
+      const Slice& block_contents, std::string* last_key, const Slice& next_block_first_key);
+
+  // Same as above, but block_contents is already compressed using type.
+  void WriteDataBlock(
+      const Slice& block_contents, CompressionType type, std::string* last_key,
+      const Slice& next_block_first_key);
+
+  // Writes data blocks compressed in parallel, in the order they were flushed. Waits for
+  // compression of the oldest blocks while there are more than max_blocks_in_flight of them.
+  void WriteCompressedDataBlocks(size_t max_blocks_in_flight);
+
+  // Trains compression dictionary on buffered data blocks and writes them.
+  void WriteBufferedDataBlocks();
+
   // Flush the current filter block into disk. next_block_first_filter_key should be nullptr if this
   // is the last block written to disk.
   // REQUIRES: Finish(), Abandon() have not been called.
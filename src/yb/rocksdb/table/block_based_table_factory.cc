@@ -139,6 +139,12 @@ std::string BlockBasedTableFactory::GetPrintableTableOptions() const {
   snprintf(buffer, kBufferSize, "  cache_index_and_filter_blocks: %d\n",
            table_options_.cache_index_and_filter_blocks);
   ret.append(buffer);
+  snprintf(buffer, kBufferSize, "  cache_filter_blocks_with_high_priority: %d\n",
+           table_options_.cache_filter_blocks_with_high_priority);
+  ret.append(buffer);
+  snprintf(buffer, kBufferSize, "  cache_index_blocks_with_high_priority: %d\n",
+           table_options_.cache_index_blocks_with_high_priority);
+  ret.append(buffer);
   snprintf(buffer, kBufferSize, "  index_type: %d\n",
            yb::to_underlying(table_options_.index_type));
   ret.append(buffer);
@@ -180,6 +186,9 @@ std::string BlockBasedTableFactory::GetPrintableTableOptions() const {
   snprintf(buffer, kBufferSize, "  index_block_restart_interval: %d\n",
            table_options_.index_block_restart_interval);
   ret.append(buffer);
+  snprintf(buffer, kBufferSize, "  use_data_block_hash_index: %d\n",
+           table_options_.use_data_block_hash_index);
+  ret.append(buffer);
   snprintf(buffer, kBufferSize, "  filter_policy: %s\n",
            table_options_.filter_policy == nullptr ?
              "nullptr" : table_options_.filter_policy->Name());
@@ -23,6 +23,8 @@
 
 #include "yb/rocksdb/table/block_based_table_reader.h"
 
+#include <algorithm>
+#include <limits>
 #include <string>
 #include <utility>
 
@@ -55,6 +57,7 @@
 #include "yb/rocksdb/table/two_level_iterator.h"
 #include "yb/rocksdb/table_properties.h"
 #include "yb/rocksdb/util/coding.h"
+#include "yb/rocksdb/util/compression.h"
 #include "yb/rocksdb/util/file_reader_writer.h"
 #include "yb/rocksdb/util/perf_context_imp.h"
 #include "yb/rocksdb/util/statistics.h"
@@ -62,6 +65,7 @@
 
 #include "yb/util/atomic.h"
 #include "yb/util/bytes_formatter.h"
+#include "yb/util/flags.h"
 #include "yb/util/logging.h"
 #include "yb/util/mem_tracker.h"
 #include "yb/util/scope_exit.h"
@@ -69,6 +73,12 @@
 #include "yb/util/status_format.h"
 #include "yb/util/string_util.h"
 
+DEFINE_RUNTIME_bool(rocksdb_prefetch_keys_with_multi_read, false,
+    "Read data blocks requested by DB::PrefetchKeys into the block cache with a single batched "
+    "read (see use_io_uring_for_multi_read) instead of asking OS to prefetch them into page "
+    "cache.");
+TAG_FLAG(rocksdb_prefetch_keys_with_multi_read, advanced);
+
 namespace rocksdb {
 
 extern const uint64_t kBlockBasedTableMagicNumber;
@@ -243,11 +253,15 @@ struct BlockBasedTable::Rep {
 
   DataIndexLoadMode data_index_load_mode = static_cast<DataIndexLoadMode>(0);
   yb::MemTrackerPtr mem_tracker;
+
+  // Digested dictionary used to decompress data blocks, shared by all readers of the file.
+  std::unique_ptr<UncompressionDict> uncompression_dict;
 };
 
-// BlockEntryIteratorState doesn't actually store any iterator state and is only used as an adapter
-// to BlockBasedTable. It is used by TwoLevelIterator and MultiLevelIterator to call BlockBasedTable
-// functions in order to check if prefix may match or to create a secondary iterator.
+// BlockEntryIteratorState doesn't actually store any iterator state except readahead tracking and
+// is only used as an adapter to BlockBasedTable. It is used by TwoLevelIterator and
+// MultiLevelIterator to call BlockBasedTable functions in order to check if prefix may match or to
+// create a secondary iterator.
 class BlockBasedTable::BlockEntryIteratorState : public TwoLevelIteratorState {
  public:
   BlockEntryIteratorState(
@@ -260,6 +274,9 @@ class BlockBasedTable::BlockEntryIteratorState : public TwoLevelIteratorState {
         block_type_(block_type) {}
 
   InternalIterator* NewSecondaryIterator(const Slice& index_value) override {
+    if (read_options_.readahead_size != 0 && block_type_ == BlockType::kData) {
+      MaybeReadahead(index_value);
+    }
     return table_->NewDataBlockIterator(read_options_, index_value, block_type_);
   }
 
@@ -271,6 +288,42 @@ class BlockBasedTable::BlockEntryIteratorState : public TwoLevelIteratorState {
   }
 
  private:
+  // Prefetches data following the data block with specified handle, when it is read right after
+  // the previous data block. New prefetch is started before the end of the previously prefetched
+  // range is reached, so sequential scan does not wait for IO.
+  void MaybeReadahead(const Slice& index_value) {
+    BlockHandle handle;
+    Slice input = index_value;
+    if (!handle.DecodeFrom(&input).ok()) {
+      return;
+    }
+    const uint64_t block_end = handle.offset() + handle.size() + kBlockTrailerSize;
+    if (handle.offset() == next_block_offset_) {
+      ++sequential_blocks_;
+    } else {
+      sequential_blocks_ = 0;
+      readahead_end_ = 0;
+    }
+    next_block_offset_ = block_end;
+
+    const uint64_t readahead_size = read_options_.readahead_size;
+    if (sequential_blocks_ < kReadaheadMinSequentialBlocks ||
+        block_end + readahead_size / 2 < readahead_end_ ||
+        yb::CoarseMonoClock::Now() >= read_options_.readahead_deadline) {
+      return;
+    }
+    const auto readahead_start = std::max(block_end, readahead_end_);
+    readahead_end_ = block_end + readahead_size;
+    table_->rep_->data_reader_with_cache_prefix->reader->file()->Prefetch(
+        readahead_start, readahead_end_ - readahead_start);
+    RecordTick(
+        read_options_.statistics ? read_options_.statistics : table_->rep_->ioptions.statistics,
+        NUMBER_DATA_BLOCK_READAHEADS);
+  }
+
+  // Number of consecutive data blocks that should be read before readahead is started.
+  static constexpr size_t kReadaheadMinSequentialBlocks = 2;
+
   // Don't own table_. BlockEntryIteratorState should only be stored in iterators or in
   // corresponding BlockBasedTable. TableReader (superclass of BlockBasedTable) is only destroyed
   // after iterator is deleted.
@@ -278,6 +331,12 @@ class BlockBasedTable::BlockEntryIteratorState : public TwoLevelIteratorState {
   const ReadOptions read_options_;
   const bool skip_filters_;
   const BlockType block_type_;
+
+  // Readahead tracking. Only used by data block iterators with non zero readahead_size, so the
+  // index iterator state shared by the table is never modified.
+  uint64_t next_block_offset_ = std::numeric_limits<uint64_t>::max();
+  size_t sequential_blocks_ = 0;
+  uint64_t readahead_end_ = 0;
 };
 
 
@@ -437,6 +496,8 @@ Status BlockBasedTable::Open(const ImmutableCFOptions& ioptions,
 
   RETURN_NOT_OK(new_table->ReadPropertiesBlock(meta_iter.get()));
 
+  RETURN_NOT_OK(new_table->ReadCompressionDictBlock(meta_iter.get()));
+
   RETURN_NOT_OK(new_table->SetupFilter(meta_iter.get()));
 
   if (data_index_load_mode == DataIndexLoadMode::PRELOAD_ON_OPEN) {
@@ -525,6 +586,19 @@ Status BlockBasedTable::Open(const ImmutableCFOptions& ioptions,
   return Status::OK();
 }
 
+Status BlockBasedTable::ReadCompressionDictBlock(InternalIterator* meta_iter) {
+  BlockHandle handle;
+  if (!FindMetaBlock(meta_iter, block_based_table::kCompressionDictBlock, &handle).ok()) {
+    return Status::OK();
+  }
+  BlockContents contents;
+  RETURN_NOT_OK(ReadBlockContents(
+      rep_->base_reader_with_cache_prefix->reader.get(), rep_->footer, ReadOptions::kDefault,
+      handle, &contents, rep_->ioptions.env, rep_->mem_tracker, /* do_uncompress = */ false));
+  rep_->uncompression_dict = std::make_unique<UncompressionDict>(contents.data.ToBuffer());
+  return Status::OK();
+}
+
 Status BlockBasedTable::ReadPropertiesBlock(InternalIterator* meta_iter) {
   // Read the properties
   bool found_properties_block = true;
@@ -701,6 +775,9 @@ size_t BlockBasedTable::ApproximateMemoryUsage() const {
   if (data_index_reader) {
     usage += data_index_reader->ApproximateMemoryUsage();
   }
+  if (rep_->uncompression_dict) {
+    usage += rep_->uncompression_dict->memory_footprint();
+  }
   return usage;
 }
 
@@ -763,9 +840,10 @@ Tickers GetBlockCacheHitTicker(BlockType block_type) {
 Status BlockBasedTable::GetDataBlockFromCache(
     const Slice& block_cache_key, const Slice& compressed_block_cache_key,
     Cache* block_cache, Cache* block_cache_compressed, Statistics* statistics,
-    const ReadOptions& read_options, BlockBasedTable::CachableEntry<Block>* block,
-    uint32_t format_version, BlockType block_type,
-    const std::shared_ptr<yb::MemTracker>& mem_tracker) {
+    const ReadOptions& read_options, QueryId insert_query_id,
+    BlockBasedTable::CachableEntry<Block>* block, uint32_t format_version, BlockType block_type,
+    const std::shared_ptr<yb::MemTracker>& mem_tracker,
+    const UncompressionDict* uncompression_dict) {
   Status s;
   Block* compressed_block = nullptr;
   Cache::Handle* block_cache_compressed_handle = nullptr;
@@ -809,7 +887,7 @@ Status BlockBasedTable::GetDataBlockFromCache(
   // Retrieve the uncompressed contents into a new buffer
   BlockContents contents;
   s = UncompressBlockContents(compressed_block->data(), compressed_block->size(), &contents,
-                              format_version, mem_tracker);
+                              format_version, mem_tracker, uncompression_dict);
 
   // Insert uncompressed block into block cache
   if (s.ok()) {
@@ -817,7 +895,7 @@ Status BlockBasedTable::GetDataBlockFromCache(
     assert(block->value->compression_type() == kNoCompression);
     if (block_cache != nullptr && block->value->cachable() &&
         read_options.fill_cache) {
-      s = block_cache->Insert(block_cache_key, read_options.query_id, block->value,
+      s = block_cache->Insert(block_cache_key, insert_query_id, block->value,
                               block->value->usable_size(), &DeleteCachedEntry<Block>,
                               &block->cache_handle, statistics);
       if (!s.ok()) {
@@ -835,9 +913,10 @@ Status BlockBasedTable::GetDataBlockFromCache(
 Status BlockBasedTable::PutDataBlockToCache(
     const Slice& block_cache_key, const Slice& compressed_block_cache_key,
     Cache* block_cache, Cache* block_cache_compressed,
-    const ReadOptions& read_options, Statistics* statistics,
+    QueryId insert_query_id, Statistics* statistics,
     CachableEntry<Block>* block, Block* raw_block, uint32_t format_version,
-    const std::shared_ptr<yb::MemTracker>& mem_tracker) {
+    const std::shared_ptr<yb::MemTracker>& mem_tracker,
+    const UncompressionDict* uncompression_dict) {
   assert(raw_block->compression_type() == kNoCompression ||
          block_cache_compressed != nullptr);
 
@@ -846,7 +925,7 @@ Status BlockBasedTable::PutDataBlockToCache(
   BlockContents contents;
   if (raw_block->compression_type() != kNoCompression) {
     s = UncompressBlockContents(raw_block->data(), raw_block->size(), &contents,
-                                format_version, mem_tracker);
+                                format_version, mem_tracker, uncompression_dict);
   }
   if (!s.ok()) {
     delete raw_block;
@@ -862,9 +941,11 @@ Status BlockBasedTable::PutDataBlockToCache(
 
   // Insert compressed block into compressed block cache.
   // Release the hold on the compressed cache entry immediately.
+  // Cache does not take ownership of the value inserted with kNoCacheQueryId, so raw block is
+  // deleted below in this case.
   if (block_cache_compressed != nullptr && raw_block != nullptr &&
-      raw_block->cachable()) {
-    s = block_cache_compressed->Insert(compressed_block_cache_key, read_options.query_id, raw_block,
+      raw_block->cachable() && insert_query_id != kNoCacheQueryId) {
+    s = block_cache_compressed->Insert(compressed_block_cache_key, insert_query_id, raw_block,
                                        raw_block->usable_size(), &DeleteCachedEntry<Block>);
     if (s.ok()) {
       // Avoid the following code to delete this cached block.
@@ -879,7 +960,7 @@ Status BlockBasedTable::PutDataBlockToCache(
   // insert into uncompressed block cache
   assert((block->value->compression_type() == kNoCompression));
   if (block_cache != nullptr && block->value->cachable()) {
-    s = block_cache->Insert(block_cache_key, read_options.query_id, block->value,
+    s = block_cache->Insert(block_cache_key, insert_query_id, block->value,
                             block->value->usable_size(),
                             &DeleteCachedEntry<Block>, &block->cache_handle, statistics);
     if (!s.ok()) {
@@ -1060,7 +1141,9 @@ BlockBasedTable::CachableEntry<FilterBlockReader> BlockBasedTable::GetFilter(
     filter = ReadFilterBlock(*filter_block_handle, rep_, &filter_size, effective_statistics);
     if (filter != nullptr) {
       assert(filter_size > 0);
-      Status s = block_cache->Insert(filter_block_cache_key, query_id,
+      Status s = block_cache->Insert(filter_block_cache_key,
+                                     rep_->table_options.cache_filter_blocks_with_high_priority
+                                         ? kInMultiTouchId : query_id,
                                      filter, filter_size,
                                      &DeleteCachedEntry<FilterBlockReader>, &cache_handle,
                                      effective_statistics);
@@ -1125,7 +1208,8 @@ yb::Result<BlockBasedTable::CachableEntry<IndexReader>> BlockBasedTable::GetInde
       std::unique_ptr<IndexReader> index_reader_unique;
       RETURN_NOT_OK(CreateDataBlockIndexReader(&index_reader_unique));
       RETURN_NOT_OK(block_cache->Insert(
-          key, read_options.query_id, index_reader_unique.get(), index_reader_unique->usable_size(),
+          key, GetBlockInsertQueryId(read_options, BlockType::kIndex, statistics),
+          index_reader_unique.get(), index_reader_unique->usable_size(),
           &DeleteCachedEntry<IndexReader>, &cache_handle, statistics));
       assert(cache_handle);
       index_reader = index_reader_unique.release();
@@ -1214,9 +1298,11 @@ yb::Result<BlockBasedTable::CachableEntry<Block>> BlockBasedTable::RetrieveBlock
       ckey = GetCacheKey(reader->compressed_cache_key_prefix, handle, compressed_cache_key);
     }
 
+    const auto insert_query_id = GetBlockInsertQueryId(ro, block_type, statistics);
     Status status = GetDataBlockFromCache(
-        key, ckey, block_cache, block_cache_compressed, statistics, ro, &block,
-        rep_->table_options.format_version, block_type, rep_->mem_tracker);
+        key, ckey, block_cache, block_cache_compressed, statistics, ro, insert_query_id, &block,
+        rep_->table_options.format_version, block_type, rep_->mem_tracker,
+        rep_->uncompression_dict.get());
 
     if (block.value == nullptr && !no_io && ro.fill_cache) {
       std::unique_ptr<Block> raw_block;
@@ -1224,12 +1310,14 @@ yb::Result<BlockBasedTable::CachableEntry<Block>> BlockBasedTable::RetrieveBlock
         StopWatch sw(rep_->ioptions.env, statistics, READ_BLOCK_GET_MICROS);
         RETURN_NOT_OK(block_based_table::ReadBlockFromFile(
             reader->reader.get(), rep_->footer, ro, handle, &raw_block, rep_->ioptions.env,
-            rep_->mem_tracker, block_cache_compressed == nullptr));
+            rep_->mem_tracker, block_cache_compressed == nullptr,
+            rep_->uncompression_dict.get()));
       }
 
       RETURN_NOT_OK(PutDataBlockToCache(key, ckey, block_cache, block_cache_compressed,
-                                        ro, statistics, &block, raw_block.release(),
-                                        rep_->table_options.format_version, rep_->mem_tracker));
+                                        insert_query_id, statistics, &block, raw_block.release(),
+                                        rep_->table_options.format_version, rep_->mem_tracker,
+                                        rep_->uncompression_dict.get()));
       status = Status::OK();
     }
 
@@ -1249,7 +1337,7 @@ yb::Result<BlockBasedTable::CachableEntry<Block>> BlockBasedTable::RetrieveBlock
   std::unique_ptr<Block> block_value;
   RETURN_NOT_OK(block_based_table::ReadBlockFromFile(
       reader->reader.get(), rep_->footer, ro, handle, &block_value, rep_->ioptions.env,
-      rep_->mem_tracker));
+      rep_->mem_tracker, /* do_uncompress = */ true, rep_->uncompression_dict.get()));
 
   block.value = block_value.release();
   RSTATUS_DCHECK(block.value, Incomplete, "No data block"); // Not expected to happen.
@@ -1257,6 +1345,22 @@ yb::Result<BlockBasedTable::CachableEntry<Block>> BlockBasedTable::RetrieveBlock
   return block;
 }
 
+QueryId BlockBasedTable::GetBlockInsertQueryId(
+    const ReadOptions& ro, BlockType block_type, Statistics* statistics) const {
+  switch (block_type) {
+    case BlockType::kIndex:
+      return rep_->table_options.cache_index_blocks_with_high_priority ? kInMultiTouchId
+                                                                       : ro.query_id;
+    case BlockType::kData:
+      if (rep_->mem_tracker && rep_->mem_tracker->LimitExceeded()) {
+        RecordTick(statistics, BLOCK_CACHE_DATA_QUOTA_BYPASSES);
+        return kNoCacheQueryId;
+      }
+      return ro.query_id;
+  }
+  FATAL_INVALID_ENUM_VALUE(BlockType, block_type);
+}
+
 yb::Result<std::unique_ptr<Block>> BlockBasedTable::RetrieveBlockFromFile(const ReadOptions& ro,
     const Slice& index_value, const BlockType block_type) {
   auto block = VERIFY_RESULT(RetrieveBlock(ro, index_value, block_type, /* use_cache = */ false));
@@ -1271,7 +1375,8 @@ InternalIterator* BlockBasedTable::NewDataBlockIterator(const ReadOptions& ro,
   auto block = RetrieveBlock(ro, index_value, block_type);
   if (block) {
     InternalIterator* iter = block->value->NewIterator(
-        rep_->comparator.get(), GetKeyValueEncodingFormat(block_type), input_iter);
+        rep_->comparator.get(), GetKeyValueEncodingFormat(block_type), input_iter,
+        /* total_order_seek = */ true, rep_->table_options.data_block_hash_key_extractor.get());
     if (block->cache_handle) {
       Cache* block_cache = rep_->table_options.block_cache.get();
       iter->RegisterCleanup(&ReleaseCachedEntry, block_cache, block->cache_handle);
@@ -1557,6 +1662,156 @@ Status BlockBasedTable::Prefetch(const Slice* const begin,
   return Status::OK();
 }
 
+Status BlockBasedTable::PrefetchKeys(
+    const ReadOptions& read_options, const Slice* internal_keys, size_t num_keys) {
+  // Blocks separated by less than this number of bytes are prefetched by a single request.
+  constexpr uint64_t kMaxPrefetchGap = 16_KB;
+
+  if (num_keys == 0) {
+    return Status::OK();
+  }
+
+  const bool no_io = read_options.read_tier == kBlockCacheTier;
+  const bool use_filter = rep_->filter_type != FilterType::kBlockBasedFilter;
+  auto& comparator = *rep_->comparator;
+  IndexIteratorHolder iiter_holder(this, read_options);
+  InternalIterator& iiter = *iiter_holder.iter();
+  RETURN_NOT_OK(iiter.status());
+
+  std::vector<BlockHandle> handles;
+  for (const auto* key = internal_keys; key != internal_keys + num_keys; ++key) {
+    if (use_filter) {
+      auto filter_key = GetFilterKeyFromInternalKey(*key);
+      if (!filter_key.empty()) {
+        auto filter_entry = GetFilter(
+            read_options.query_id, no_io, &filter_key, read_options.statistics);
+        const bool may_match = NonBlockBasedFilterKeyMayMatch(filter_entry.value, filter_key);
+        filter_entry.Release(rep_->table_options.block_cache.get());
+        if (!may_match) {
+          RecordTick(rep_->ioptions.statistics, BLOOM_FILTER_USEFUL);
+          continue;
+        }
+      }
+    }
+    // Index entry key is not less than the last key of its data block, so the key belongs to the
+    // block of the previous key if it is not greater than the current index entry.
+    if (!iiter.Valid() || comparator.Compare(*key, iiter.key()) > 0) {
+      iiter.Seek(*key);
+      if (!iiter.Valid()) {
+        // Rest of the keys are after the last data block.
+        break;
+      }
+    }
+    BlockHandle handle;
+    Slice input = iiter.value();
+    RETURN_NOT_OK(handle.DecodeFrom(&input));
+    if (handles.empty() || handles.back().offset() != handle.offset()) {
+      handles.push_back(handle);
+    }
+  }
+  RETURN_NOT_OK(iiter.status());
+  if (no_io) {
+    return Status::OK();
+  }
+
+  Cache* block_cache = rep_->table_options.block_cache.get();
+  auto* statistics =
+      read_options.statistics ? read_options.statistics : rep_->ioptions.statistics;
+  if (FLAGS_rocksdb_prefetch_keys_with_multi_read && block_cache && read_options.fill_cache) {
+    const auto insert_query_id = GetBlockInsertQueryId(read_options, BlockType::kData, statistics);
+    if (insert_query_id != kNoCacheQueryId) {
+      return ReadDataBlocksToCache(read_options, insert_query_id, statistics, &handles);
+    }
+  }
+
+  auto* file = rep_->data_reader_with_cache_prefix->reader->file();
+  uint64_t range_start = 0;
+  uint64_t range_end = 0;
+  auto prefetch_range = [file, statistics, &range_start, &range_end] {
+    if (range_end > range_start) {
+      file->Prefetch(range_start, range_end - range_start);
+      RecordTick(statistics, NUMBER_DATA_BLOCK_KEY_PREFETCHES);
+    }
+  };
+  for (const auto& handle : handles) {
+    if (block_cache) {
+      char cache_key_storage[block_based_table::kCacheKeyBufferSize];
+      auto cache_key = GetCacheKey(
+          rep_->data_reader_with_cache_prefix->cache_key_prefix, handle, cache_key_storage);
+      auto* cache_handle = block_cache->Lookup(cache_key, read_options.query_id);
+      if (cache_handle) {
+        block_cache->Release(cache_handle);
+        continue;
+      }
+    }
+    const auto block_end = handle.offset() + handle.size() + kBlockTrailerSize;
+    if (range_end == 0 || handle.offset() > range_end + kMaxPrefetchGap) {
+      prefetch_range();
+      range_start = handle.offset();
+    }
+    range_end = block_end;
+  }
+  prefetch_range();
+  return Status::OK();
+}
+
+Status BlockBasedTable::ReadDataBlocksToCache(
+    const ReadOptions& read_options, QueryId insert_query_id, Statistics* statistics,
+    std::vector<BlockHandle>* handles) {
+  Cache* block_cache = rep_->table_options.block_cache.get();
+  Cache* block_cache_compressed = rep_->table_options.block_cache_compressed.get();
+  const auto& reader = *rep_->data_reader_with_cache_prefix;
+
+  auto is_cached = [block_cache, &reader, &read_options](const BlockHandle& handle) {
+    char cache_key_storage[block_based_table::kCacheKeyBufferSize];
+    auto* cache_handle = block_cache->Lookup(
+        GetCacheKey(reader.cache_key_prefix, handle, cache_key_storage), read_options.query_id);
+    if (!cache_handle) {
+      return false;
+    }
+    block_cache->Release(cache_handle);
+    return true;
+  };
+  handles->erase(std::remove_if(handles->begin(), handles->end(), is_cached), handles->end());
+  if (handles->empty()) {
+    return Status::OK();
+  }
+
+  // Blocks are decompressed by PutDataBlockToCache when they should also be added to the
+  // compressed block cache.
+  std::vector<BlockContents> contents(handles->size());
+  {
+    StopWatch sw(rep_->ioptions.env, statistics, READ_BLOCK_GET_MICROS);
+    RETURN_NOT_OK(MultiReadBlockContents(
+        reader.reader.get(), rep_->footer, read_options, handles->data(), handles->size(),
+        contents.data(), rep_->mem_tracker, block_cache_compressed == nullptr,
+        rep_->uncompression_dict.get()));
+  }
+  RecordTick(statistics, NUMBER_DATA_BLOCK_KEY_PREFETCHES, handles->size());
+
+  for (size_t i = 0; i != handles->size(); ++i) {
+    const auto& handle = (*handles)[i];
+    char cache_key[block_based_table::kCacheKeyBufferSize];
+    char compressed_cache_key[block_based_table::kCacheKeyBufferSize];
+    Slice key = GetCacheKey(reader.cache_key_prefix, handle, cache_key);
+    Slice ckey;
+    if (block_cache_compressed != nullptr) {
+      ckey = GetCacheKey(reader.compressed_cache_key_prefix, handle, compressed_cache_key);
+    }
+    CachableEntry<Block> block;
+    RETURN_NOT_OK(PutDataBlockToCache(
+        key, ckey, block_cache, block_cache_compressed, insert_query_id, statistics, &block,
+        new Block(std::move(contents[i])), rep_->table_options.format_version, rep_->mem_tracker,
+        rep_->uncompression_dict.get()));
+    if (block.cache_handle) {
+      block.Release(block_cache);
+    } else {
+      delete block.value;
+    }
+  }
+  return Status::OK();
+}
+
 bool BlockBasedTable::TEST_KeyInCache(const ReadOptions& options,
                                       const Slice& key) {
   std::unique_ptr<InternalIterator> iiter(NewIndexIterator(options));
@@ -1576,8 +1831,9 @@ bool BlockBasedTable::TEST_KeyInCache(const ReadOptions& options,
       GetCacheKey(rep_->data_reader_with_cache_prefix->cache_key_prefix, handle, cache_key_storage);
   Slice ckey;
 
-  s = GetDataBlockFromCache(cache_key, ckey, block_cache, nullptr, nullptr, options, &block,
-      rep_->table_options.format_version, BlockType::kData, rep_->mem_tracker);
+  s = GetDataBlockFromCache(cache_key, ckey, block_cache, nullptr, nullptr, options,
+      options.query_id, &block, rep_->table_options.format_version, BlockType::kData,
+      rep_->mem_tracker, rep_->uncompression_dict.get());
   assert(s.ok());
   bool in_cache = block.value != nullptr;
   if (in_cache) {
@@ -28,6 +28,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "yb/rocksdb/immutable_options.h"
 #include "yb/rocksdb/options.h"
@@ -41,6 +42,7 @@ namespace rocksdb {
 
 class Block;
 class BlockIter;
+class UncompressionDict;
 class BlockHandle;
 class Cache;
 class FilterBlockReader;
@@ -158,6 +160,14 @@ class BlockBasedTable : public TableReader {
   // IO or iteration error.
   Status Prefetch(const Slice* begin, const Slice* end) override;
 
+  // Looks up data blocks of all keys with a single index iterator, skips keys rejected by filter
+  // and blocks present in the block cache, and prefetches remaining blocks into OS page cache
+  // coalescing close blocks into a single request.
+  // When rocksdb_prefetch_keys_with_multi_read is set, remaining blocks are read into the block
+  // cache with a single batched read instead.
+  Status PrefetchKeys(
+      const ReadOptions& read_options, const Slice* internal_keys, size_t num_keys) override;
+
   // Given a key, return an approximate byte offset in the file where
   // the data for that key begins (or would begin if the key were
   // present in the file).  The returned value is in terms of file
@@ -261,27 +271,32 @@ class BlockBasedTable : public TableReader {
   // block_cache_compressed.
   // On success, Status::OK with be returned and @block will be populated with
   // pointer to the block as well as its block handle.
+  // Block found in compressed cache is inserted into block_cache with insert_query_id.
   static Status GetDataBlockFromCache(
       const Slice& block_cache_key, const Slice& compressed_block_cache_key,
       Cache* block_cache, Cache* block_cache_compressed, Statistics* statistics,
-      const ReadOptions& read_options, BlockBasedTable::CachableEntry<Block>* block,
+      const ReadOptions& read_options, QueryId insert_query_id,
+      BlockBasedTable::CachableEntry<Block>* block,
       uint32_t format_version, BlockType block_type,
-      const std::shared_ptr<yb::MemTracker>& mem_tracker);
+      const std::shared_ptr<yb::MemTracker>& mem_tracker,
+      const UncompressionDict* uncompression_dict);
 
   // Put a raw block (maybe compressed) to the corresponding block caches.
   // This method will perform decompression against raw_block if needed and then
   // populate the block caches.
   // On success, Status::OK will be returned; also @block will be populated with
-  // uncompressed block and its cache handle.
+  // uncompressed block and its cache handle. Cache handle is not set if insert_query_id is
+  // kNoCacheQueryId, so the caller owns the block in this case.
   //
   // REQUIRES: raw_block is heap-allocated. PutDataBlockToCache() will be
   // responsible for releasing its memory if error occurs.
   static Status PutDataBlockToCache(
       const Slice& block_cache_key, const Slice& compressed_block_cache_key,
       Cache* block_cache, Cache* block_cache_compressed,
-      const ReadOptions& read_options, Statistics* statistics,
+      QueryId insert_query_id, Statistics* statistics,
       CachableEntry<Block>* block, Block* raw_block, uint32_t format_version,
-      const std::shared_ptr<yb::MemTracker>& mem_tracker);
+      const std::shared_ptr<yb::MemTracker>& mem_tracker,
+      const UncompressionDict* uncompression_dict);
 
   // Calls (*handle_result)(arg, ...) repeatedly, starting with the entry found
   // after a call to Seek(key), until handle_result returns false.
@@ -304,6 +319,9 @@ class BlockBasedTable : public TableReader {
 
   Status ReadPropertiesBlock(InternalIterator* meta_iter);
 
+  // Loads dictionary used to compress data blocks, if the file has one.
+  Status ReadCompressionDictBlock(InternalIterator* meta_iter);
+
   Status SetupFilter(InternalIterator* meta_iter);
 
   // Read the meta block from sst.
@@ -329,6 +347,19 @@ class BlockBasedTable : public TableReader {
   yb::Result<CachableEntry<Block>> RetrieveBlock(const ReadOptions& ro, const Slice& index_value,
       BlockType block_type, bool use_cache = true);
 
+  // Returns query id to insert block of specified type into the block cache with.
+  // Index blocks go to multi-touch part of the cache if cache_index_blocks_with_high_priority is
+  // set. Data blocks are not cached while block based table memory tracker of this table is over
+  // its limit, so a table could not take more than its quota of the shared block cache.
+  QueryId GetBlockInsertQueryId(
+      const ReadOptions& ro, BlockType block_type, Statistics* statistics) const;
+
+  // Reads data blocks that are not present in the block cache with a single batched read and
+  // inserts them into the block cache. Used by PrefetchKeys, handles are sorted by offset.
+  Status ReadDataBlocksToCache(
+      const ReadOptions& read_options, QueryId insert_query_id, Statistics* statistics,
+      std::vector<BlockHandle>* handles);
+
   explicit BlockBasedTable(Rep* rep) : rep_(rep) {}
 
   // Helper functions for DumpTable()
@@ -44,6 +44,8 @@
 //     restarts: uint32[num_restarts]
 //     num_restarts: uint32
 // restarts[i] contains the offset within the block of the ith restart point.
+// When data block hash index is used, it is placed between the restart array and num_restarts,
+// see data_block_hash_index.h.
 
 #include "yb/rocksdb/table/block_builder.h"
 
@@ -62,7 +64,8 @@ namespace rocksdb {
 
 BlockBuilder::BlockBuilder(
     int block_restart_interval, const KeyValueEncodingFormat key_value_encoding_format,
-    const bool use_delta_encoding)
+    const bool use_delta_encoding, const bool use_hash_index,
+    const SliceTransform* hash_key_extractor)
     : block_restart_interval_(block_restart_interval),
       use_delta_encoding_(use_delta_encoding),
       key_value_encoding_format_(key_value_encoding_format),
@@ -71,6 +74,9 @@ BlockBuilder::BlockBuilder(
       finished_(false) {
   assert(block_restart_interval_ >= 1);
   restarts_.push_back(0);       // First restart point is at offset 0
+  if (use_hash_index) {
+    hash_index_builder_.emplace(hash_key_extractor);
+  }
 }
 
 void BlockBuilder::Reset() {
@@ -80,6 +86,9 @@ void BlockBuilder::Reset() {
   counter_ = 0;
   finished_ = false;
   last_key_.clear();
+  if (hash_index_builder_) {
+    hash_index_builder_->Reset();
+  }
 }
 
 size_t BlockBuilder::CurrentSizeEstimate() const {
@@ -88,6 +97,9 @@ size_t BlockBuilder::CurrentSizeEstimate() const {
     // Restarts haven't been flushed to buffer yet.
     size += restarts_.size() * sizeof(uint32_t) +    // Restart array.
             sizeof(uint32_t);                        // Restart array length.
+    if (hash_index_builder_) {
+      size += hash_index_builder_->EstimateSize();
+    }
   }
   return size;
 }
@@ -335,7 +347,12 @@ Slice BlockBuilder::Finish() {
   for (size_t i = 0; i < restarts_.size(); i++) {
     PutFixed32(&buffer_, restarts_[i]);
   }
-  PutFixed32(&buffer_, static_cast<uint32_t>(restarts_.size()));
+  auto num_restarts = static_cast<uint32_t>(restarts_.size());
+  if (hash_index_builder_ && hash_index_builder_->Valid(num_restarts)) {
+    hash_index_builder_->Finish(&buffer_);
+    num_restarts |= kDataBlockHashIndexFlag;
+  }
+  PutFixed32(&buffer_, num_restarts);
   finished_ = true;
   return Slice(buffer_);
 }
@@ -405,6 +422,9 @@ void BlockBuilder::Add(const Slice& key, const Slice& value) {
 
   assert(Slice(last_key_) == key);
   counter_++;
+  if (hash_index_builder_) {
+    hash_index_builder_->Add(key, static_cast<uint32_t>(restarts_.size() - 1));
+  }
 }
 
 }  // namespace rocksdb
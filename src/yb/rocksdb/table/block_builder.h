@@ -24,8 +24,11 @@
 #pragma once
 
 #include <stdint.h>
+
+#include <optional>
 #include <vector>
 
+#include "yb/rocksdb/table/data_block_hash_index.h"
 #include "yb/rocksdb/types.h"
 
 #include "yb/util/slice.h"
@@ -37,9 +40,13 @@ class BlockBuilder {
   BlockBuilder(const BlockBuilder&) = delete;
   void operator=(const BlockBuilder&) = delete;
 
+  // If use_hash_index is true, data block hash index is appended to the block, keys are expected
+  // to be internal keys in this case. See data_block_hash_index.h for details.
   explicit BlockBuilder(int block_restart_interval,
                         KeyValueEncodingFormat key_value_encoding_format,
-                        bool use_delta_encoding = true);
+                        bool use_delta_encoding = true,
+                        bool use_hash_index = false,
+                        const SliceTransform* hash_key_extractor = nullptr);
 
   // Reset the contents as if the BlockBuilder was just constructed.
   void Reset();
@@ -77,6 +84,7 @@ class BlockBuilder {
   int                   counter_;   // Number of entries emitted since restart
   bool                  finished_;  // Has Finish() been called?
   std::string           last_key_;
+  std::optional<DataBlockHashIndexBuilder> hash_index_builder_;
 };
 
 }  // namespace rocksdb
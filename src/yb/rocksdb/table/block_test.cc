@@ -38,6 +38,7 @@
 #include "yb/rocksdb/util/testutil.h"
 
 #include "yb/util/env.h"
+#include "yb/util/format.h"
 #include "yb/util/logging.h"
 #include "yb/util/random_util.h"
 #include "yb/util/test_macros.h"
@@ -412,6 +413,74 @@ void CheckMiddleKey(
 
 } // namespace
 
+TEST_F(BlockTest, DataBlockHashIndex) {
+  constexpr int kNumRows = 200;
+  constexpr size_t kRowKeySize = 9;
+  std::unique_ptr<const SliceTransform> extractor(NewFixedPrefixTransform(kRowKeySize));
+  InternalKeyComparator comparator(BytewiseComparator());
+  for (auto key_value_encoding_format : KeyValueEncodingFormatList()) {
+    Random rnd(301);
+    BlockBuilder builder(4, key_value_encoding_format);
+    BlockBuilder hash_index_builder(
+        4, key_value_encoding_format, /* use_delta_encoding = */ true,
+        /* use_hash_index = */ true, extractor.get());
+
+    // Only even rows are present, each row has a few versions.
+    std::vector<std::string> targets;
+    for (int row = 0; row < kNumRows; ++row) {
+      const auto row_key = yb::Format("row$0", 100000 + row);
+      targets.push_back(InternalKey::MaxPossibleForUserKey(row_key).Encode().ToBuffer());
+      if (row % 2) {
+        continue;
+      }
+      const auto num_versions = 1 + rnd.Uniform(6);
+      for (uint32_t version = 0; version < num_versions; ++version) {
+        const auto key = InternalKey(
+            yb::Format("$0v$1", row_key, version), 100, kTypeValue).Encode().ToBuffer();
+        targets.push_back(key);
+        builder.Add(key, RandomString(&rnd, 10));
+        hash_index_builder.Add(key, RandomString(&rnd, 10));
+      }
+    }
+    targets.push_back(InternalKey::MaxPossibleForUserKey("a").Encode().ToBuffer());
+    targets.push_back(InternalKey::MaxPossibleForUserKey("z").Encode().ToBuffer());
+
+    const auto raw_block = builder.Finish();
+    const auto raw_block_with_hash_index = hash_index_builder.Finish();
+    ASSERT_GT(raw_block_with_hash_index.size(), raw_block.size());
+
+    BlockContents contents;
+    contents.data = raw_block;
+    contents.cachable = false;
+    Block block(std::move(contents));
+    BlockContents hash_index_contents;
+    hash_index_contents.data = raw_block_with_hash_index;
+    hash_index_contents.cachable = false;
+    Block block_with_hash_index(std::move(hash_index_contents));
+    ASSERT_EQ(block.NumRestarts(), block_with_hash_index.NumRestarts());
+
+    std::unique_ptr<InternalIterator> iter(
+        block.NewIterator(&comparator, key_value_encoding_format));
+    std::unique_ptr<InternalIterator> hash_iter(block_with_hash_index.NewIterator(
+        &comparator, key_value_encoding_format, nullptr, true, extractor.get()));
+    // Index is just a hint, so seek results should not depend on key extractor.
+    std::unique_ptr<InternalIterator> no_extractor_iter(block_with_hash_index.NewIterator(
+        &comparator, key_value_encoding_format));
+    for (const auto& target : targets) {
+      iter->Seek(target);
+      hash_iter->Seek(target);
+      no_extractor_iter->Seek(target);
+      ASSERT_EQ(iter->Valid(), hash_iter->Valid());
+      ASSERT_EQ(iter->Valid(), no_extractor_iter->Valid());
+      if (iter->Valid()) {
+        ASSERT_EQ(iter->key(), hash_iter->key());
+        ASSERT_EQ(iter->key(), no_extractor_iter->key());
+      }
+    }
+    ASSERT_OK(hash_iter->status());
+  }
+}
+
 TEST_F(BlockTest, GetMiddleKey) {
   // Checking of explicit values
   for (const auto key_value_encoding_format : KeyValueEncodingFormatList()) {
@@ -0,0 +1,115 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/rocksdb/table/data_block_hash_index.h"
+
+#include "yb/rocksdb/db/dbformat.h"
+#include "yb/rocksdb/slice_transform.h"
+#include "yb/rocksdb/util/coding.h"
+#include "yb/rocksdb/util/hash.h"
+
+namespace rocksdb {
+
+namespace {
+
+constexpr uint32_t kDataBlockHashIndexSeed = 0x5a7e1d2b;
+
+// Ratio of runs to buckets, lower values decrease collision probability but make index bigger.
+constexpr double kDataBlockHashIndexUtilRatio = 0.75;
+
+constexpr size_t kBucketSize = 2;
+
+}  // namespace
+
+uint32_t DataBlockHashIndexHash(Slice internal_key, const SliceTransform* hash_key_extractor) {
+  auto key = internal_key.size() >= kLastInternalComponentSize
+      ? ExtractUserKey(internal_key) : internal_key;
+  if (hash_key_extractor && hash_key_extractor->InDomain(key)) {
+    key = hash_key_extractor->Transform(key);
+  }
+  return Hash(key.cdata(), key.size(), kDataBlockHashIndexSeed);
+}
+
+void DataBlockHashIndexBuilder::Add(Slice internal_key, uint32_t restart_index) {
+  if (restart_index >= kDataBlockHashIndexMaxNumRestarts) {
+    // Index won't be used for this block, see Valid().
+    return;
+  }
+  const auto hash = DataBlockHashIndexHash(internal_key, hash_key_extractor_);
+  if (!runs_.empty() && runs_.back().hash == hash) {
+    runs_.back().last_restart = static_cast<uint8_t>(restart_index);
+    return;
+  }
+  runs_.push_back(Run {
+    .hash = hash,
+    .first_restart = static_cast<uint8_t>(restart_index),
+    .last_restart = static_cast<uint8_t>(restart_index),
+  });
+}
+
+size_t DataBlockHashIndexBuilder::NumBuckets() const {
+  auto result = static_cast<size_t>(runs_.size() / kDataBlockHashIndexUtilRatio);
+  // Odd number of buckets gives better distribution of hashes.
+  return result | 1;
+}
+
+size_t DataBlockHashIndexBuilder::EstimateSize() const {
+  return runs_.empty() ? 0 : NumBuckets() * kBucketSize + sizeof(uint32_t);
+}
+
+void DataBlockHashIndexBuilder::Finish(std::string* buffer) const {
+  const auto num_buckets = NumBuckets();
+  std::vector<uint8_t> buckets(num_buckets * kBucketSize, kDataBlockHashIndexNoEntry);
+  for (const auto& run : runs_) {
+    auto* bucket = buckets.data() + (run.hash % num_buckets) * kBucketSize;
+    if (bucket[0] == kDataBlockHashIndexNoEntry) {
+      bucket[0] = run.first_restart;
+      bucket[1] = run.last_restart;
+    } else {
+      // Either different hash keys or the same hash key in non contiguous runs.
+      bucket[0] = bucket[1] = kDataBlockHashIndexCollision;
+    }
+  }
+  buffer->append(reinterpret_cast<const char*>(buckets.data()), buckets.size());
+  PutFixed32(buffer, static_cast<uint32_t>(num_buckets));
+}
+
+bool DataBlockHashIndex::Initialize(
+    const char* data, uint32_t hash_index_end, uint32_t* hash_index_start) {
+  if (hash_index_end < sizeof(uint32_t)) {
+    return false;
+  }
+  const auto num_buckets = DecodeFixed32(data + hash_index_end - sizeof(uint32_t));
+  const uint64_t buckets_size = static_cast<uint64_t>(num_buckets) * kBucketSize;
+  if (num_buckets == 0 || hash_index_end - sizeof(uint32_t) < buckets_size) {
+    return false;
+  }
+  *hash_index_start = static_cast<uint32_t>(hash_index_end - sizeof(uint32_t) - buckets_size);
+  buckets_ = data + *hash_index_start;
+  num_buckets_ = num_buckets;
+  return true;
+}
+
+bool DataBlockHashIndex::Lookup(
+    uint32_t hash, uint32_t* first_restart, uint32_t* last_restart) const {
+  const auto* bucket = buckets_ + (hash % num_buckets_) * kBucketSize;
+  const auto first = static_cast<uint8_t>(bucket[0]);
+  if (first >= kDataBlockHashIndexCollision) {
+    return false;
+  }
+  *first_restart = first;
+  *last_restart = static_cast<uint8_t>(bucket[1]);
+  return *first_restart <= *last_restart;
+}
+
+}  // namespace rocksdb
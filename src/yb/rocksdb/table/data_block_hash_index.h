@@ -0,0 +1,111 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "yb/util/slice.h"
+
+namespace rocksdb {
+
+class SliceTransform;
+
+// Data block hash index maps hash of a data block key to the range of restart intervals containing
+// keys with the same hash key. It is appended to the data block after the restart array:
+//
+//   restarts: uint32[num_restarts]
+//   buckets: {first_restart: uint8, last_restart: uint8}[num_buckets]
+//   num_buckets: uint32
+//   num_restarts: uint32, with kDataBlockHashIndexFlag bit set.
+//
+// Hash key is the user key of the internal key transformed by optional hash key extractor, so
+// all versions of the same key (DocDB appends DocHybridTime to the key) and the seek key without
+// version could be mapped to the same entry. Keys with the same hash key have to be stored
+// contiguously in the block, otherwise the bucket is marked as collided.
+//
+// Index lookup result is used by BlockIter::Seek as a hint to narrow down the binary search, the
+// hint is verified against restart keys, so seek results don't depend on the index contents.
+
+constexpr uint32_t kDataBlockHashIndexFlag = 1u << 31;
+constexpr uint32_t kDataBlockMaxNumRestartsMask = kDataBlockHashIndexFlag - 1;
+
+// Restart index values stored in the bucket should be less than these markers.
+constexpr uint8_t kDataBlockHashIndexNoEntry = 255;
+constexpr uint8_t kDataBlockHashIndexCollision = 254;
+constexpr uint32_t kDataBlockHashIndexMaxNumRestarts = kDataBlockHashIndexCollision;
+
+// Returns hash of the hash key of the specified internal key.
+uint32_t DataBlockHashIndexHash(Slice internal_key, const SliceTransform* hash_key_extractor);
+
+class DataBlockHashIndexBuilder {
+ public:
+  explicit DataBlockHashIndexBuilder(const SliceTransform* hash_key_extractor)
+      : hash_key_extractor_(hash_key_extractor) {}
+
+  // REQUIRES: restart_index is not less than restart_index passed to the previous call.
+  void Add(Slice internal_key, uint32_t restart_index);
+
+  // Returns false if index could not be built for the block, in this case block should be
+  // written without hash index.
+  bool Valid(uint32_t num_restarts) const {
+    return !runs_.empty() && num_restarts <= kDataBlockHashIndexMaxNumRestarts;
+  }
+
+  // Appends buckets and num_buckets to the buffer.
+  // REQUIRES: Valid().
+  void Finish(std::string* buffer) const;
+
+  size_t EstimateSize() const;
+
+  void Reset() {
+    runs_.clear();
+  }
+
+ private:
+  struct Run {
+    uint32_t hash;
+    uint8_t first_restart;
+    uint8_t last_restart;
+  };
+
+  size_t NumBuckets() const;
+
+  const SliceTransform* hash_key_extractor_;
+  std::vector<Run> runs_;
+};
+
+class DataBlockHashIndex {
+ public:
+  // Parses hash index stored in the block data_[0..hash_index_end), sets `*hash_index_start` to
+  // the offset of buckets.
+  // Returns false if data is corrupted.
+  bool Initialize(const char* data, uint32_t hash_index_end, uint32_t* hash_index_start);
+
+  // Fills restart interval range for the specified hash.
+  // Returns false when there is no entry for the hash or the bucket has collision.
+  bool Lookup(uint32_t hash, uint32_t* first_restart, uint32_t* last_restart) const;
+
+  bool Initialized() const {
+    return buckets_ != nullptr;
+  }
+
+ private:
+  const char* buckets_ = nullptr;
+  uint32_t num_buckets_ = 0;
+};
+
+}  // namespace rocksdb
@@ -26,6 +26,7 @@
 #include <inttypes.h>
 
 #include <string>
+#include <vector>
 
 #include "yb/rocksdb/env.h"
 #include "yb/rocksdb/util/coding.h"
@@ -440,7 +441,8 @@ BlockContents::BlockContents(
 Status ReadBlockContents(RandomAccessFileReader* file, const Footer& footer,
                          const ReadOptions& options, const BlockHandle& handle,
                          BlockContents* contents, Env* env,
-                         const yb::MemTrackerPtr& mem_tracker, bool decompression_requested) {
+                         const yb::MemTrackerPtr& mem_tracker, bool decompression_requested,
+                         const UncompressionDict* uncompression_dict) {
   Status status;
   Slice slice;
   size_t n = static_cast<size_t>(handle.size());
@@ -471,7 +473,8 @@ Status ReadBlockContents(RandomAccessFileReader* file, const Footer& footer,
   compression_type = static_cast<rocksdb::CompressionType>(slice.data()[n]);
 
   if (decompression_requested && compression_type != kNoCompression) {
-    return UncompressBlockContents(slice.cdata(), n, contents, footer.version(), mem_tracker);
+    return UncompressBlockContents(
+        slice.cdata(), n, contents, footer.version(), mem_tracker, uncompression_dict);
   }
 
   if (slice.cdata() != used_buf) {
@@ -488,6 +491,62 @@ Status ReadBlockContents(RandomAccessFileReader* file, const Footer& footer,
   return status;
 }
 
+Status MultiReadBlockContents(RandomAccessFileReader* file, const Footer& footer,
+                              const ReadOptions& options, const BlockHandle* handles,
+                              size_t num_handles, BlockContents* contents,
+                              const yb::MemTrackerPtr& mem_tracker, bool decompression_requested,
+                              const UncompressionDict* uncompression_dict) {
+  std::vector<std::unique_ptr<char[]>> bufs(num_handles);
+  std::vector<ReadRequest> requests(num_handles);
+  for (size_t i = 0; i != num_handles; ++i) {
+    const auto expected_read_size = static_cast<size_t>(handles[i].size()) + kBlockTrailerSize;
+    bufs[i].reset(new char[expected_read_size]);
+    requests[i] = ReadRequest {
+      .offset = handles[i].offset(),
+      .length = expected_read_size,
+      .scratch = reinterpret_cast<uint8_t*>(bufs[i].get()),
+      .result = Slice(),
+    };
+  }
+
+  {
+    PERF_TIMER_GUARD(block_read_time);
+    RETURN_NOT_OK(file->MultiRead(requests.data(), num_handles, options.statistics));
+  }
+
+  for (size_t i = 0; i != num_handles; ++i) {
+    const auto& handle = handles[i];
+    const auto& request = requests[i];
+    const size_t n = static_cast<size_t>(handle.size());
+    PERF_COUNTER_ADD(block_read_count, 1);
+    PERF_COUNTER_ADD(block_read_byte, request.length);
+
+    if (request.result.size() != request.length) {
+      return STATUS_FORMAT(
+          Corruption, "Truncated block read in file: $0, block handle: $1, expected size: $2",
+          file->file()->filename(), handle.ToDebugString(), request.length);
+    }
+    // Read implementations that do not copy to scratch (e.g. mmap) could return data from
+    // another location.
+    if (request.result.data() != request.scratch) {
+      memcpy(bufs[i].get(), request.result.data(), request.length);
+    }
+    if (options.verify_checksums) {
+      RETURN_NOT_OK(VerifyBlockChecksum(file, footer, handle, bufs[i].get(), n));
+    }
+
+    PERF_TIMER_GUARD(block_decompress_time);
+    const auto compression_type = static_cast<rocksdb::CompressionType>(bufs[i][n]);
+    if (decompression_requested && compression_type != kNoCompression) {
+      RETURN_NOT_OK(UncompressBlockContents(
+          bufs[i].get(), n, &contents[i], footer.version(), mem_tracker, uncompression_dict));
+    } else {
+      contents[i] = BlockContents(std::move(bufs[i]), n, true, compression_type, mem_tracker);
+    }
+  }
+  return Status::OK();
+}
+
 //
 // The 'data' points to the raw block contents that was read in from file.
 // This method allocates a new heap buffer and the raw block
@@ -498,7 +557,8 @@ Status ReadBlockContents(RandomAccessFileReader* file, const Footer& footer,
 Status UncompressBlockContents(const char* data, size_t n,
                                BlockContents* contents,
                                uint32_t format_version,
-                               const std::shared_ptr<yb::MemTracker>& mem_tracker) {
+                               const std::shared_ptr<yb::MemTracker>& mem_tracker,
+                               const UncompressionDict* uncompression_dict) {
   std::unique_ptr<char[]> ubuf;
   int decompress_size = 0;
   assert(data[n] != kNoCompression);
@@ -566,8 +626,8 @@ Status UncompressBlockContents(const char* data, size_t n,
           BlockContents(std::move(ubuf), decompress_size, true, kNoCompression, mem_tracker);
       break;
     case kZSTDNotFinalCompression:
-      ubuf =
-          std::unique_ptr<char[]>(ZSTD_Uncompress(data, n, &decompress_size));
+      ubuf = std::unique_ptr<char[]>(
+          ZSTD_Uncompress(data, n, &decompress_size, uncompression_dict));
       if (!ubuf) {
         static char zstd_corrupt_msg[] =
             "ZSTD not supported or corrupted ZSTD compressed block contents";
@@ -39,6 +39,7 @@ class MemTracker;
 namespace rocksdb {
 
 class Block;
+class UncompressionDict;
 struct ReadOptions;
 
 // the length of the magic number in bytes.
@@ -255,7 +256,21 @@ extern Status ReadBlockContents(RandomAccessFileReader* file,
                                 const BlockHandle& handle,
                                 BlockContents* contents, Env* env,
                                 const std::shared_ptr<yb::MemTracker>& mem_tracker,
-                                bool do_uncompress);
+                                bool do_uncompress,
+                                const UncompressionDict* uncompression_dict = nullptr);
+
+// Reads blocks identified by handles[0..num_handles) with a single RandomAccessFile::MultiRead
+// call and fills contents[0..num_handles). Returns first error, in which case contents are
+// undefined.
+extern Status MultiReadBlockContents(RandomAccessFileReader* file,
+                                     const Footer& footer,
+                                     const ReadOptions& options,
+                                     const BlockHandle* handles,
+                                     size_t num_handles,
+                                     BlockContents* contents,
+                                     const std::shared_ptr<yb::MemTracker>& mem_tracker,
+                                     bool do_uncompress,
+                                     const UncompressionDict* uncompression_dict = nullptr);
 
 // The 'data' points to the raw block contents read in from file.
 // This method allocates a new heap buffer and the raw block
@@ -264,10 +279,12 @@ extern Status ReadBlockContents(RandomAccessFileReader* file,
 // free this buffer.
 // For description of compress_format_version and possible values, see
 // util/compression.h
+// uncompression_dict is the dictionary of the file the block belongs to, if any.
 extern Status UncompressBlockContents(const char* data, size_t n,
                                       BlockContents* contents,
                                       uint32_t compress_format_version,
-                                      const std::shared_ptr<yb::MemTracker>& mem_tracker);
+                                      const std::shared_ptr<yb::MemTracker>& mem_tracker,
+                                      const UncompressionDict* uncompression_dict = nullptr);
 
 // Implementation details follow.  Clients should ignore,
 
@@ -20,6 +20,7 @@
 
 #include "yb/rocksdb/table/get_context.h"
 
+#include "yb/rocksdb/db/blob_file.h"
 #include "yb/rocksdb/db/merge_context.h"
 #include "yb/rocksdb/env.h"
 #include "yb/rocksdb/merge_operator.h"
@@ -98,6 +99,10 @@ bool GetContext::SaveValue(const ParsedInternalKey& parsed_key,
   assert((state_ != kMerge && parsed_key.type != kTypeMerge) ||
          merge_context_ != nullptr);
   if (ucmp_->Equal(parsed_key.user_key, user_key_)) {
+    if (parsed_key.type == kTypeBlobIndex) {
+      return SaveBlobValue(parsed_key, value);
+    }
+
     appendToReplayLog(replay_log_, parsed_key.type, value);
 
     if (seq_ != nullptr) {
@@ -182,6 +187,24 @@ bool GetContext::SaveValue(const ParsedInternalKey& parsed_key,
   return false;
 }
 
+bool GetContext::SaveBlobValue(const ParsedInternalKey& parsed_key, const Slice& blob_index) {
+  BlobIndex index;
+  Status s = blob_cache_ ? index.DecodeFrom(blob_index)
+                         : STATUS(Corruption, "Blob reference without blob cache");
+  std::string value;
+  if (s.ok()) {
+    s = blob_cache_->Get(index, &value);
+  }
+  if (!s.ok()) {
+    RLOG(InfoLogLevel::ERROR_LEVEL, logger_, "Failed to read blob %s: %s",
+         index.ToString().c_str(), s.ToString().c_str());
+    state_ = kCorrupt;
+    return false;
+  }
+  // Replay log receives the resolved value, so row cache does not depend on the blob file.
+  return SaveValue(ParsedInternalKey(parsed_key.user_key, parsed_key.sequence, kTypeValue), value);
+}
+
 void replayGetContextLog(const Slice& replay_log, const Slice& user_key,
                          GetContext* get_context) {
   Slice s = replay_log;
@@ -40,6 +40,7 @@
 #include "yb/rocksdb/types.h"
 
 namespace rocksdb {
+class BlobFileCache;
 class MergeContext;
 
 class GetContext {
@@ -81,7 +82,12 @@ class GetContext {
   // Do we need to fetch the SequenceNumber for this key?
   bool NeedToReadSequence() const { return (seq_ != nullptr); }
 
+  // Blob cache used to read values of kTypeBlobIndex entries.
+  void SetBlobCache(BlobFileCache* blob_cache) { blob_cache_ = blob_cache; }
+
  private:
+  bool SaveBlobValue(const ParsedInternalKey& parsed_key, const Slice& blob_index);
+
   const Comparator* ucmp_;
   const MergeOperator* merge_operator_;
   // the merge operations encountered;
@@ -98,6 +104,7 @@ class GetContext {
   // write to the key or kMaxSequenceNumber if unknown
   SequenceNumber* seq_;
   std::string* replay_log_;
+  BlobFileCache* blob_cache_ = nullptr;
 };
 
 void replayGetContextLog(const Slice& replay_log, const Slice& user_key,
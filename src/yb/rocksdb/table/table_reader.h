@@ -117,6 +117,15 @@ class TableReader {
     return Status::OK();
   }
 
+  // Asynchronously prefetches data blocks that could contain specified internal keys, so following
+  // reads of these keys do not wait for IO one key at a time.
+  // REQUIRES: internal_keys are sorted according to the table comparator.
+  virtual Status PrefetchKeys(
+      const ReadOptions& read_options, const Slice* internal_keys, size_t num_keys) {
+    // Default implementation is NOOP.
+    return Status::OK();
+  }
+
   // convert db file to a human readable form
   virtual Status DumpTable(WritableFile* out_file) {
     return STATUS(NotSupported, "DumpTable() not supported");
@@ -334,7 +334,7 @@ class TableConstructor: public Constructor {
                             internal_comparator,
                             int_tbl_prop_collector_factories,
                             options.compression,
-                            CompressionOptions(),
+                            options.compression_opts,
                             /* skip_filters */ false),
         TablePropertiesCollectorFactory::Context::kUnknownColumnFamily,
         file_writer_.get());
@@ -2023,6 +2023,90 @@ TEST_F(BlockBasedTableTest, BlockReadCountTest) {
   }
 }
 
+TEST_F(BlockBasedTableTest, ZSTDDictionaryCompression) {
+  if (!ZSTD_Supported()) {
+    fprintf(stderr, "skipping zstd dictionary compression test\n");
+    return;
+  }
+
+  Options opt;
+  auto ikc = std::make_shared<test::PlainInternalKeyComparator>(opt.comparator);
+  opt.compression = kZSTDNotFinalCompression;
+  opt.compression_opts.max_dict_bytes = 4096;
+  opt.compression_opts.zstd_max_train_bytes = 64 * 1024;
+  BlockBasedTableOptions table_options;
+  table_options.block_size = 1024;
+  opt.table_factory.reset(NewBlockBasedTableFactory(table_options));
+
+  TableConstructor c(BytewiseComparator());
+  Random rnd(301);
+  for (int i = 0; i < 2000; ++i) {
+    c.Add("key" + std::to_string(i), "value_" + std::to_string(i % 17) + RandomString(&rnd, 20));
+  }
+  std::vector<std::string> keys;
+  stl_wrappers::KVMap kvmap;
+  const ImmutableCFOptions ioptions(opt);
+  c.Finish(opt, ioptions, table_options, ikc, &keys, &kvmap);
+  ASSERT_GT(c.GetTableProperties().num_data_blocks, 1U);
+
+  // Blocks are compressed with the dictionary trained for this file, so they could only be read
+  // back if the reader has loaded the dictionary meta block.
+  ASSERT_OK(c.Reopen(ioptions));
+  std::unique_ptr<InternalIterator> iter(c.NewIterator());
+  auto expected = kvmap.begin();
+  for (iter->SeekToFirst(); iter->Valid(); iter->Next(), ++expected) {
+    ASSERT_NE(expected, kvmap.end());
+    ASSERT_EQ(expected->first, iter->key().ToString());
+    ASSERT_EQ(expected->second, iter->value().ToString());
+  }
+  ASSERT_OK(iter->status());
+  ASSERT_EQ(expected, kvmap.end());
+}
+
+TEST_F(BlockBasedTableTest, ParallelCompression) {
+  if (!Snappy_Supported()) {
+    fprintf(stderr, "skipping parallel compression test\n");
+    return;
+  }
+
+  BlockBasedTableOptions table_options;
+  table_options.block_size = 1024;
+  std::vector<TableProperties> props;
+  for (uint32_t parallel_threads : {1, 4}) {
+    Options opt;
+    auto ikc = std::make_shared<test::PlainInternalKeyComparator>(opt.comparator);
+    opt.compression = kSnappyCompression;
+    opt.compression_opts.parallel_threads = parallel_threads;
+    opt.table_factory.reset(NewBlockBasedTableFactory(table_options));
+
+    TableConstructor c(BytewiseComparator());
+    Random rnd(301);
+    for (int i = 0; i < 5000; ++i) {
+      c.Add("key" + std::to_string(i), "value_" + std::to_string(i % 17) + RandomString(&rnd, 20));
+    }
+    std::vector<std::string> keys;
+    stl_wrappers::KVMap kvmap;
+    const ImmutableCFOptions ioptions(opt);
+    c.Finish(opt, ioptions, table_options, ikc, &keys, &kvmap);
+    props.push_back(c.GetTableProperties());
+
+    std::unique_ptr<InternalIterator> iter(c.NewIterator());
+    auto expected = kvmap.begin();
+    for (iter->SeekToFirst(); iter->Valid(); iter->Next(), ++expected) {
+      ASSERT_NE(expected, kvmap.end());
+      ASSERT_EQ(expected->first, iter->key().ToString());
+      ASSERT_EQ(expected->second, iter->value().ToString());
+    }
+    ASSERT_OK(iter->status());
+    ASSERT_EQ(expected, kvmap.end());
+  }
+
+  // Blocks are compressed the same way, only on different threads.
+  ASSERT_GT(props[0].num_data_blocks, 1U);
+  ASSERT_EQ(props[0].num_data_blocks, props[1].num_data_blocks);
+  ASSERT_EQ(props[0].data_size, props[1].data_size);
+}
+
 TEST_F(BlockBasedTableTest, BlockCacheLeak) {
   // Check that when we reopen a table we don't lose access to blocks already
   // in the cache. This test checks whether the Table actually makes use of the
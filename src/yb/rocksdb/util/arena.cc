@@ -24,6 +24,7 @@
 #include "yb/rocksdb/util/arena.h"
 
 #include <algorithm>
+#include <atomic>
 
 #ifdef ROCKSDB_MALLOC_USABLE_SIZE
 #include <malloc.h>
@@ -35,10 +36,32 @@
 #include "yb/rocksdb/port/port.h"
 #include "yb/rocksdb/env.h"
 
+#include "yb/util/flags.h"
 #include "yb/util/mem_tracker.h"
 
+DEFINE_RUNTIME_bool(arena_transparent_huge_pages_fallback, true,
+    "When an arena configured to use huge pages fails to allocate a block from explicitly "
+    "reserved huge pages, allocate it aligned to the huge page size and advise the kernel to "
+    "back it with transparent huge pages.");
+
 namespace rocksdb {
 
+namespace {
+
+std::atomic<uint64_t> explicit_huge_page_blocks{0};
+std::atomic<uint64_t> transparent_huge_page_blocks{0};
+std::atomic<uint64_t> huge_page_fallback_blocks{0};
+
+} // namespace
+
+ArenaHugePageStats GetArenaHugePageStats() {
+  return ArenaHugePageStats {
+    .explicit_blocks = explicit_huge_page_blocks.load(std::memory_order_relaxed),
+    .transparent_blocks = transparent_huge_page_blocks.load(std::memory_order_relaxed),
+    .fallback_blocks = huge_page_fallback_blocks.load(std::memory_order_relaxed),
+  };
+}
+
 // MSVC complains that it is already defined since it is static in the header.
 #ifndef OS_WIN
 const size_t Arena::kInlineSize;
@@ -144,17 +167,53 @@ char* Arena::AllocateFromHugePage(size_t bytes) {
   void* addr = mmap(nullptr, bytes, (PROT_READ | PROT_WRITE),
                     (MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB), 0, 0);
 
-  if (addr == MAP_FAILED) {
+  if (addr != MAP_FAILED) {
+    explicit_huge_page_blocks.fetch_add(1, std::memory_order_relaxed);
+  } else if (FLAGS_arena_transparent_huge_pages_fallback &&
+             (addr = MapTransparentHugePages(bytes)) != MAP_FAILED) {
+    transparent_huge_page_blocks.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    huge_page_fallback_blocks.fetch_add(1, std::memory_order_relaxed);
     return nullptr;
   }
   // the following shouldn't throw because of the above reserve()
   huge_blocks_.emplace_back(MmapInfo(addr, bytes));
+  // Huge page blocks should be accounted as well, otherwise the memtable size is underestimated.
+  Consumed(bytes);
   return reinterpret_cast<char*>(addr);
 #else
   return nullptr;
 #endif
 }
 
+void* Arena::MapTransparentHugePages(size_t bytes) {
+#if defined(MAP_HUGETLB) && defined(MADV_HUGEPAGE)
+  // Transparent huge pages are used only for ranges aligned to the huge page size, so map extra
+  // hugetlb_size_ bytes and unmap the unaligned head and tail.
+  const size_t mapped_size = bytes + hugetlb_size_;
+  void* addr = mmap(nullptr, mapped_size, (PROT_READ | PROT_WRITE),
+                    (MAP_PRIVATE | MAP_ANONYMOUS), 0, 0);
+  if (addr == MAP_FAILED) {
+    return MAP_FAILED;
+  }
+  auto* start = static_cast<char*>(addr);
+  auto* aligned = reinterpret_cast<char*>(
+      (reinterpret_cast<uintptr_t>(start) + hugetlb_size_ - 1) / hugetlb_size_ * hugetlb_size_);
+  if (aligned != start) {
+    munmap(start, aligned - start);
+  }
+  auto tail = start + mapped_size - (aligned + bytes);
+  if (tail) {
+    munmap(aligned + bytes, tail);
+  }
+  // The block is still usable when the kernel does not support transparent huge pages.
+  madvise(aligned, bytes, MADV_HUGEPAGE);
+  return aligned;
+#else
+  return MAP_FAILED;
+#endif
+}
+
 char* Arena::AllocateAligned(size_t bytes, size_t huge_page_size,
                              Logger* logger) {
   assert((kAlignUnit & (kAlignUnit - 1)) ==
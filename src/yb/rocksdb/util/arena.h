@@ -49,6 +49,19 @@ class MemTracker;
 
 namespace rocksdb {
 
+// Process wide statistics of arena blocks allocated from huge pages.
+struct ArenaHugePageStats {
+  // Number of blocks allocated from explicitly reserved huge pages (MAP_HUGETLB).
+  uint64_t explicit_blocks = 0;
+  // Number of blocks backed by transparent huge pages, because explicit huge pages were not
+  // available.
+  uint64_t transparent_blocks = 0;
+  // Number of blocks allocated from regular pages, because huge pages were not available.
+  uint64_t fallback_blocks = 0;
+};
+
+ArenaHugePageStats GetArenaHugePageStats();
+
 class Arena : public Allocator {
  public:
   // No copying allowed
@@ -61,7 +74,8 @@ class Arena : public Allocator {
 
   // huge_page_size: if 0, don't use huge page TLB. If > 0 (should set to the
   // supported hugepage size of the system), block allocation will try huge
-  // page TLB first. If allocation fails, will fall back to normal case.
+  // page TLB first. If allocation fails, will try transparent huge pages when
+  // arena_transparent_huge_pages_fallback is set, and then fall back to normal case.
   explicit Arena(size_t block_size = kMinBlockSize, size_t huge_page_size = 0);
   ~Arena();
 
@@ -135,6 +149,9 @@ class Arena : public Allocator {
   size_t hugetlb_size_ = 0;
 #endif  // MAP_HUGETLB
   char* AllocateFromHugePage(size_t bytes);
+  // Maps bytes aligned to hugetlb_size_ and advises the kernel to back them with transparent huge
+  // pages.
+  void* MapTransparentHugePages(size_t bytes);
   char* AllocateFallback(size_t bytes, bool aligned);
   char* AllocateNewBlock(size_t block_bytes);
 
@@ -21,6 +21,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file. See the AUTHORS file for names of contributors.
 
+#include <cstring>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -208,6 +209,29 @@ TEST_F(ArenaTest, Simple) {
   SimpleTest(0);
   SimpleTest(kHugePageSize);
 }
+
+TEST_F(ArenaTest, HugePageBlocks) {
+  Arena arena(Arena::kMinBlockSize, kHugePageSize);
+  // Fill the inline block, so the next allocation requires a new block.
+  arena.AllocateAligned(Arena::kInlineSize);
+  auto stats_before = GetArenaHugePageStats();
+  auto* block = arena.AllocateAligned(8);
+  auto stats_after = GetArenaHugePageStats();
+
+  auto explicit_blocks = stats_after.explicit_blocks - stats_before.explicit_blocks;
+  auto transparent_blocks = stats_after.transparent_blocks - stats_before.transparent_blocks;
+  auto fallback_blocks = stats_after.fallback_blocks - stats_before.fallback_blocks;
+  ASSERT_EQ(explicit_blocks + transparent_blocks + fallback_blocks, 1U);
+  if (fallback_blocks) {
+    ASSERT_PRED2(CheckMemoryAllocated, arena.MemoryAllocatedBytes(),
+                 Arena::kMinBlockSize + Arena::kInlineSize);
+    return;
+  }
+  ASSERT_EQ(arena.MemoryAllocatedBytes(), kHugePageSize + Arena::kInlineSize);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % kHugePageSize, 0U);
+  // The whole block should be usable.
+  memset(block, 1, kHugePageSize);
+}
 }  // namespace rocksdb
 
 int main(int argc, char** argv) {
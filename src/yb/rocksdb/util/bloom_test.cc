@@ -236,7 +236,25 @@ class FixedSizeFilterBloomTestContext : public BloomTestContext {
           nullptr)};
 };
 
-YB_DEFINE_ENUM(BuilderReaderBloomTestType, (kFullFilter)(kFixedSizeFilter));
+class FixedSizeRibbonFilterTestContext : public BloomTestContext {
+ public:
+  const FilterPolicy& filter_policy() const override { return *filter_policy_.get(); }
+
+  size_t max_keys() const override { return std::numeric_limits<size_t>::max(); }
+
+  void CheckFilterSize(size_t filter_size, size_t num_keys) const override {
+    ASSERT_LE(filter_size, FilterPolicy::kDefaultFixedSizeFilterBits / 8 + 5) << num_keys;
+  }
+
+ private:
+  std::unique_ptr<const FilterPolicy> filter_policy_{
+      NewFixedSizeRibbonFilterPolicy(
+          FilterPolicy::kDefaultFixedSizeFilterBits, FilterPolicy::kDefaultFixedSizeFilterErrorRate,
+          nullptr)};
+};
+
+YB_DEFINE_ENUM(BuilderReaderBloomTestType,
+               (kFullFilter)(kFixedSizeFilter)(kFixedSizeRibbonFilter));
 
 namespace {
 
@@ -246,6 +264,8 @@ std::unique_ptr<const BloomTestContext> CreateContext(BuilderReaderBloomTestType
       return std::make_unique<FullFilterBloomTestContext>();
     case BuilderReaderBloomTestType::kFixedSizeFilter:
       return std::make_unique<FixedSizeFilterBloomTestContext>();
+    case BuilderReaderBloomTestType::kFixedSizeRibbonFilter:
+      return std::make_unique<FixedSizeRibbonFilterTestContext>();
   }
   FATAL_INVALID_ENUM_VALUE(BuilderReaderBloomTestType, type);
 }
@@ -374,7 +394,31 @@ TEST_P(BuilderReaderBloomTest, FullVaryingLengths) {
 
 INSTANTIATE_TEST_CASE_P(, BuilderReaderBloomTest, ::testing::Values(
     BuilderReaderBloomTestType::kFullFilter,
-    BuilderReaderBloomTestType::kFixedSizeFilter));
+    BuilderReaderBloomTestType::kFixedSizeFilter,
+    BuilderReaderBloomTestType::kFixedSizeRibbonFilter));
+
+// Ribbon filter block should fit more keys than bloom filter block of the same size.
+TEST_F(BloomTest, FixedSizeRibbonFilterCapacity) {
+  auto max_keys = [](const FilterPolicy& policy) {
+    std::unique_ptr<FilterBitsBuilder> builder(policy.GetFilterBitsBuilder());
+    char buffer[sizeof(size_t)];
+    size_t result = 0;
+    while (!builder->IsFull()) {
+      builder->AddKey(Key(result++, buffer));
+    }
+    return result;
+  };
+  std::unique_ptr<const FilterPolicy> bloom(NewFixedSizeFilterPolicy(
+      FilterPolicy::kDefaultFixedSizeFilterBits, FilterPolicy::kDefaultFixedSizeFilterErrorRate,
+      nullptr));
+  std::unique_ptr<const FilterPolicy> ribbon(NewFixedSizeRibbonFilterPolicy(
+      FilterPolicy::kDefaultFixedSizeFilterBits, FilterPolicy::kDefaultFixedSizeFilterErrorRate,
+      nullptr));
+  auto bloom_keys = max_keys(*bloom);
+  auto ribbon_keys = max_keys(*ribbon);
+  LOG(INFO) << "Max keys, bloom: " << bloom_keys << ", ribbon: " << ribbon_keys;
+  ASSERT_GE(ribbon_keys, bloom_keys * 5 / 4);
+}
 
 }  // namespace rocksdb
 
@@ -50,6 +50,8 @@ DEFINE_UNKNOWN_int64(cache_size, 8 * KB * KB,
              "Number of bytes to use as a cache of uncompressed data.");
 DEFINE_UNKNOWN_int32(num_shard_bits, 4, "shard_bits.");
 
+DEFINE_UNKNOWN_bool(use_clock_cache, false, "Use CLOCK cache instead of LRU cache.");
+
 DEFINE_UNKNOWN_int64(max_key, 1 * KB * KB * KB, "Max number of key to place in cache");
 DEFINE_UNKNOWN_uint64(ops_per_thread, 1200000, "Number of operations per thread.");
 
@@ -145,7 +147,8 @@ struct ThreadState {
 class CacheBench {
  public:
   CacheBench() :
-      cache_(NewLRUCache(FLAGS_cache_size, FLAGS_num_shard_bits)),
+      cache_(FLAGS_use_clock_cache ? NewClockCache(FLAGS_cache_size, FLAGS_num_shard_bits)
+                                   : NewLRUCache(FLAGS_cache_size, FLAGS_num_shard_bits)),
       num_threads_(FLAGS_threads) {}
 
   ~CacheBench() {}
@@ -256,6 +259,7 @@ class CacheBench {
     printf("Ops per thread      : %" PRIu64 "\n", FLAGS_ops_per_thread);
     printf("Cache size          : %" PRIu64 "\n", FLAGS_cache_size);
     printf("Num shard bits      : %d\n", FLAGS_num_shard_bits);
+    printf("Cache type          : %s\n", FLAGS_use_clock_cache ? "clock" : "lru");
     printf("Max key             : %" PRIu64 "\n", FLAGS_max_key);
     printf("Populate cache      : %d\n", FLAGS_populate_cache);
     printf("Insert percentage   : %d%%\n", FLAGS_insert_percent);
@@ -583,7 +583,7 @@ TEST_F(CacheTest, SetStrictCapacityLimit) {
   // test insert without handle
   s = cache->Insert(extra_key, kTestQueryId, extra_value, 1, &deleter);
   ASSERT_TRUE(s.IsIncomplete());
-  ASSERT_EQ(2, cache->GetUsage());
+  ASSERT_EQ(2U, cache->GetUsage());
 
   for (size_t i = 0; i < 2; i++) {
     cache->Release(handles[i]);
@@ -745,6 +745,86 @@ TEST_F(CacheTest, OverFlowTest) {
   cache->Release(h);
 }
 
+TEST_F(CacheTest, ClockCacheEviction) {
+  constexpr QueryId kOtherQueryId = 100;
+  auto cache = NewClockCache(10, 0);
+  for (int i = 0; i != 10; ++i) {
+    ASSERT_OK(Insert(cache, i, i));
+  }
+  // Entries touched by another query survive eviction.
+  for (int i = 0; i != 5; ++i) {
+    ASSERT_EQ(i, Lookup(cache, i, kOtherQueryId));
+  }
+  for (int i = 10; i != 15; ++i) {
+    ASSERT_OK(Insert(cache, i, i));
+  }
+  ASSERT_EQ(10U, cache->GetUsage());
+  ASSERT_EQ((std::vector<int>{5, 6, 7, 8, 9}), deleted_keys_);
+  for (int i = 0; i != 5; ++i) {
+    ASSERT_EQ(i, Lookup(cache, i));
+  }
+}
+
+TEST_F(CacheTest, ClockCacheScanResistance) {
+  constexpr QueryId kOtherQueryId = 100;
+  auto cache = NewClockCache(10, 0);
+  for (int i = 0; i != 10; ++i) {
+    ASSERT_OK(Insert(cache, i, i));
+  }
+  // Repeated touches by the query that inserted entries does not protect them as much as touch
+  // by another query.
+  for (int i = 0; i != 5; ++i) {
+    ASSERT_EQ(i, Lookup(cache, i));
+    ASSERT_EQ(i, Lookup(cache, i));
+  }
+  for (int i = 5; i != 10; ++i) {
+    ASSERT_EQ(i, Lookup(cache, i, kOtherQueryId));
+  }
+  for (int i = 10; i != 15; ++i) {
+    ASSERT_OK(Insert(cache, i, i));
+  }
+  ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4}), deleted_keys_);
+}
+
+TEST_F(CacheTest, ClockCachePinnedEntries) {
+  auto cache = NewClockCache(2, 0);
+  Cache::Handle* handle = nullptr;
+  ASSERT_OK(cache->Insert(
+      EncodeKey(1), kTestQueryId, EncodeValue(101), 1, &CacheTest::Deleter, &handle));
+  ASSERT_OK(Insert(cache, 2, 102));
+  ASSERT_OK(Insert(cache, 3, 103));
+  // Pinned entry is skipped by eviction.
+  ASSERT_EQ((std::vector<int>{2}), deleted_keys_);
+  ASSERT_EQ(101, Lookup(cache, 1));
+  ASSERT_EQ(1U, cache->GetPinnedUsage());
+
+  // Erased entry is kept until the last handle is released.
+  Erase(cache, 1);
+  ASSERT_EQ(-1, Lookup(cache, 1));
+  ASSERT_EQ((std::vector<int>{2}), deleted_keys_);
+  ASSERT_EQ(2U, cache->GetUsage());
+  cache->Release(handle);
+  ASSERT_EQ((std::vector<int>{2, 1}), deleted_keys_);
+  ASSERT_EQ(1U, cache->GetUsage());
+  ASSERT_EQ(0U, cache->GetPinnedUsage());
+}
+
+TEST_F(CacheTest, ClockCacheStrictCapacityLimit) {
+  auto cache = NewClockCache(1, 0, /* strict_capacity_limit= */ true);
+  Cache::Handle* handle1 = nullptr;
+  Cache::Handle* handle2 = nullptr;
+  ASSERT_OK(cache->Insert(
+      EncodeKey(1), kTestQueryId, EncodeValue(101), 1, &CacheTest::Deleter, &handle1));
+  auto s = cache->Insert(
+      EncodeKey(2), kTestQueryId, EncodeValue(102), 1, &CacheTest::Deleter, &handle2);
+  ASSERT_TRUE(s.IsIncomplete()) << s;
+  ASSERT_EQ(nullptr, handle2);
+  cache->Release(handle1);
+  ASSERT_OK(Insert(cache, 2, 102));
+  ASSERT_EQ((std::vector<int>{1}), deleted_keys_);
+  ASSERT_EQ(102, Lookup(cache, 2));
+}
+
 }  // namespace rocksdb
 
 int main(int argc, char** argv) {
@@ -0,0 +1,647 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "yb/rocksdb/cache.h"
+#include "yb/rocksdb/port/port.h"
+#include "yb/rocksdb/statistics.h"
+#include "yb/rocksdb/util/autovector.h"
+#include "yb/rocksdb/util/hash.h"
+#include "yb/rocksdb/util/mutexlock.h"
+#include "yb/rocksdb/util/statistics.h"
+
+#include "yb/util/cache_metrics.h"
+#include "yb/util/metrics.h"
+#include "yb/util/random_util.h"
+
+using std::shared_ptr;
+
+namespace rocksdb {
+
+namespace {
+
+// CLOCK cache implementation.
+//
+// Entries of a shard are kept in a hash table and in a circular list, the clock. Hit takes the
+// shard lock in shared mode and only changes atomic reference count and priority of the entry, so
+// lookups of the same shard do not serialize. Insert, erase and eviction take the lock in exclusive
+// mode.
+//
+// Eviction moves the clock hand over entries that are not referenced externally. An entry with non
+// zero priority survives the pass and its priority is decremented, otherwise it is evicted.
+// Any hit raises the priority to at least 1, as the reference bit of classic CLOCK does. Only hits
+// from a query other than the one that inserted the entry raise it further, so a scan that touches
+// its blocks several times could not push frequently used entries out of the cache. This is the
+// same scan resistance that query ids provide to the single-touch and multi-touch LRU.
+constexpr uint8_t kMaxClockPriority = 3;
+
+struct ClockHandle {
+  void* value;
+  void (*deleter)(const Slice&, void* value);
+  ClockHandle* next_hash;
+  // Neighbours in the clock, protected by exclusive shard lock.
+  ClockHandle* next;
+  ClockHandle* prev;
+  size_t charge;
+  size_t key_length;
+  // One reference is held by the cache while entry is in the hash table, and one by each handle
+  // returned to the user.
+  std::atomic<uint32_t> refs;
+  std::atomic<uint8_t> priority;
+  uint32_t hash;
+  QueryId query_id;  // Query id that added the value to the cache.
+  char key_data[1];  // Beginning of key
+
+  Slice key() const {
+    return Slice(key_data, key_length);
+  }
+
+  static ClockHandle* Create(const Slice& key) {
+    auto* result = new (new char[sizeof(ClockHandle) - 1 + key.size()]) ClockHandle;
+    result->key_length = key.size();
+    memcpy(result->key_data, key.data(), key.size());
+    return result;
+  }
+
+  void Destroy() {
+    this->~ClockHandle();
+    delete[] reinterpret_cast<char*>(this);
+  }
+};
+
+class ClockHandleTable {
+ public:
+  ClockHandleTable() : list_(16) {}
+
+  ClockHandle* Lookup(const Slice& key, uint32_t hash) const {
+    return *FindPointer(key, hash);
+  }
+
+  // Returns entry with the same key that was replaced by h, if any.
+  ClockHandle* Insert(ClockHandle* h) {
+    ClockHandle** ptr = FindPointer(h->key(), h->hash);
+    ClockHandle* old = *ptr;
+    h->next_hash = (old == nullptr ? nullptr : old->next_hash);
+    *ptr = h;
+    if (old == nullptr && ++elems_ > list_.size()) {
+      Resize();
+    }
+    return old;
+  }
+
+  ClockHandle* Remove(const Slice& key, uint32_t hash) {
+    ClockHandle** ptr = FindPointer(key, hash);
+    ClockHandle* result = *ptr;
+    if (result != nullptr) {
+      *ptr = result->next_hash;
+      --elems_;
+    }
+    return result;
+  }
+
+ private:
+  ClockHandle** FindPointer(const Slice& key, uint32_t hash) const {
+    auto* ptr = const_cast<ClockHandle**>(&list_[hash & (list_.size() - 1)]);
+    while (*ptr != nullptr && ((*ptr)->hash != hash || key != (*ptr)->key())) {
+      ptr = &(*ptr)->next_hash;
+    }
+    return ptr;
+  }
+
+  void Resize() {
+    std::vector<ClockHandle*> new_list(list_.size() * 2);
+    for (auto* h : list_) {
+      while (h != nullptr) {
+        auto* next = h->next_hash;
+        auto& bucket = new_list[h->hash & (new_list.size() - 1)];
+        h->next_hash = bucket;
+        bucket = h;
+        h = next;
+      }
+    }
+    list_.swap(new_list);
+  }
+
+  // Number of buckets is always a power of 2.
+  std::vector<ClockHandle*> list_;
+  size_t elems_ = 0;
+};
+
+// A single shard of sharded cache.
+class ClockCacheShard {
+ public:
+  ClockCacheShard() = default;
+  ~ClockCacheShard();
+
+  void SetCapacity(size_t capacity);
+
+  void SetStrictCapacityLimit(bool strict_capacity_limit) {
+    WriteLock l(&mutex_);
+    strict_capacity_limit_ = strict_capacity_limit;
+  }
+
+  void SetMetrics(shared_ptr<yb::CacheMetrics> metrics) {
+    WriteLock l(&mutex_);
+    metrics_ = std::move(metrics);
+  }
+
+  Status Insert(const Slice& key, uint32_t hash, const QueryId query_id,
+                void* value, size_t charge, void (*deleter)(const Slice& key, void* value),
+                Cache::Handle** handle, Statistics* statistics);
+  Cache::Handle* Lookup(const Slice& key, uint32_t hash, const QueryId query_id,
+                        Statistics* statistics);
+  void Release(Cache::Handle* handle);
+  void Erase(const Slice& key, uint32_t hash);
+  size_t Evict(size_t required);
+
+  size_t GetUsage() const {
+    return usage_.load(std::memory_order_acquire);
+  }
+
+  size_t GetPinnedUsage() const;
+
+  void ApplyToAllCacheEntries(void (*callback)(void*, size_t), bool thread_safe);
+
+ private:
+  // Drops a reference to the entry, and frees it if it was the last one.
+  void Unref(ClockHandle* e);
+  void Free(ClockHandle* e);
+
+  void ClockAppend(ClockHandle* e);
+  void ClockRemove(ClockHandle* e);
+
+  // Removes entries not referenced externally from the cache, until usage of not removed entries
+  // is not greater than target_usage or every entry was visited by the clock hand
+  // kMaxClockPriority + 1 times. Removed entries are added to evicted, with their references held
+  // by the cache, those references should be dropped after releasing the lock.
+  // Returns total charge of removed entries.
+  size_t EvictFromClock(size_t target_usage, autovector<ClockHandle*>* evicted);
+
+  void UnrefEvicted(const autovector<ClockHandle*>& evicted);
+
+  // We don't count mutex_ as the cache's internal state so semantically we
+  // don't mind mutex_ invoking the non-const actions.
+  mutable port::RWMutex mutex_;
+
+  ClockHandleTable table_;
+
+  // Next entry to be visited during eviction, new entries are added right before it.
+  ClockHandle* hand_ = nullptr;
+  size_t clock_size_ = 0;
+
+  // Read without lock by Release.
+  std::atomic<size_t> capacity_{0};
+  bool strict_capacity_limit_ = false;
+
+  // Memory size for entries residing in the cache, including erased entries that are still
+  // referenced externally.
+  std::atomic<size_t> usage_{0};
+
+  shared_ptr<yb::CacheMetrics> metrics_;
+};
+
+ClockCacheShard::~ClockCacheShard() {
+  while (hand_ != nullptr) {
+    auto* e = hand_;
+    ClockRemove(e);
+    Unref(e);
+  }
+}
+
+void ClockCacheShard::Free(ClockHandle* e) {
+  usage_.fetch_sub(e->charge, std::memory_order_acq_rel);
+  if (metrics_ != nullptr) {
+    metrics_->cache_usage->DecrementBy(e->charge);
+  }
+  (*e->deleter)(e->key(), e->value);
+  e->Destroy();
+}
+
+void ClockCacheShard::Unref(ClockHandle* e) {
+  if (e->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    Free(e);
+  }
+}
+
+void ClockCacheShard::UnrefEvicted(const autovector<ClockHandle*>& evicted) {
+  for (auto* e : evicted) {
+    Unref(e);
+  }
+}
+
+void ClockCacheShard::ClockAppend(ClockHandle* e) {
+  if (hand_ == nullptr) {
+    e->next = e->prev = e;
+    hand_ = e;
+  } else {
+    e->next = hand_;
+    e->prev = hand_->prev;
+    e->prev->next = e;
+    hand_->prev = e;
+  }
+  ++clock_size_;
+}
+
+void ClockCacheShard::ClockRemove(ClockHandle* e) {
+  if (e->next == e) {
+    hand_ = nullptr;
+  } else {
+    e->next->prev = e->prev;
+    e->prev->next = e->next;
+    if (hand_ == e) {
+      hand_ = e->next;
+    }
+  }
+  e->next = e->prev = nullptr;
+  --clock_size_;
+}
+
+size_t ClockCacheShard::EvictFromClock(size_t target_usage, autovector<ClockHandle*>* evicted) {
+  size_t evicted_charge = 0;
+  size_t steps_left = clock_size_ * (kMaxClockPriority + 1);
+  while (hand_ != nullptr && steps_left-- > 0 &&
+         usage_.load(std::memory_order_acquire) > target_usage + evicted_charge) {
+    auto* e = hand_;
+    hand_ = e->next;
+    // Lookup could not add reference while we are holding exclusive lock, so entry that is not
+    // referenced externally at this point could be safely removed.
+    if (e->refs.load(std::memory_order_acquire) != 1) {
+      continue;
+    }
+    auto priority = e->priority.load(std::memory_order_relaxed);
+    if (priority != 0) {
+      e->priority.store(priority - 1, std::memory_order_relaxed);
+      continue;
+    }
+    ClockRemove(e);
+    table_.Remove(e->key(), e->hash);
+    evicted_charge += e->charge;
+    evicted->push_back(e);
+    if (metrics_ != nullptr) {
+      metrics_->evictions->Increment();
+    }
+  }
+  return evicted_charge;
+}
+
+void ClockCacheShard::SetCapacity(size_t capacity) {
+  autovector<ClockHandle*> evicted;
+  {
+    WriteLock l(&mutex_);
+    capacity_ = capacity;
+    EvictFromClock(capacity_, &evicted);
+  }
+  UnrefEvicted(evicted);
+}
+
+size_t ClockCacheShard::Evict(size_t required) {
+  autovector<ClockHandle*> evicted;
+  size_t result;
+  {
+    WriteLock l(&mutex_);
+    auto usage = usage_.load(std::memory_order_acquire);
+    result = EvictFromClock(usage > required ? usage - required : 0, &evicted);
+  }
+  UnrefEvicted(evicted);
+  return result;
+}
+
+size_t ClockCacheShard::GetPinnedUsage() const {
+  ReadLock l(&mutex_);
+  size_t unpinned_usage = 0;
+  auto* e = hand_;
+  for (size_t i = 0; i != clock_size_; ++i, e = e->next) {
+    if (e->refs.load(std::memory_order_acquire) == 1) {
+      unpinned_usage += e->charge;
+    }
+  }
+  auto usage = usage_.load(std::memory_order_acquire);
+  return usage > unpinned_usage ? usage - unpinned_usage : 0;
+}
+
+void ClockCacheShard::ApplyToAllCacheEntries(void (*callback)(void*, size_t), bool thread_safe) {
+  if (thread_safe) {
+    mutex_.ReadLock();
+  }
+  auto* e = hand_;
+  for (size_t i = 0; i != clock_size_; ++i, e = e->next) {
+    callback(e->value, e->charge);
+  }
+  if (thread_safe) {
+    mutex_.ReadUnlock();
+  }
+}
+
+Cache::Handle* ClockCacheShard::Lookup(const Slice& key, uint32_t hash, const QueryId query_id,
+                                       Statistics* statistics) {
+  ClockHandle* e;
+  {
+    ReadLock l(&mutex_);
+    e = table_.Lookup(key, hash);
+    if (e != nullptr) {
+      e->refs.fetch_add(1, std::memory_order_acq_rel);
+      uint8_t max_priority = e->query_id != query_id ? kMaxClockPriority : 1;
+      auto priority = e->priority.load(std::memory_order_relaxed);
+      while (priority < max_priority &&
+             !e->priority.compare_exchange_weak(
+                 priority, static_cast<uint8_t>(priority + 1), std::memory_order_relaxed)) {
+      }
+    }
+  }
+
+  if (statistics != nullptr) {
+    if (e != nullptr) {
+      RecordTick(statistics, BLOCK_CACHE_HIT);
+      RecordTick(statistics, BLOCK_CACHE_BYTES_READ, e->charge);
+    } else {
+      RecordTick(statistics, BLOCK_CACHE_MISS);
+    }
+  }
+  if (metrics_ != nullptr) {
+    metrics_->lookups->Increment();
+    if (e != nullptr) {
+      metrics_->cache_hits->Increment();
+    } else {
+      metrics_->cache_misses->Increment();
+    }
+  }
+  return reinterpret_cast<Cache::Handle*>(e);
+}
+
+void ClockCacheShard::Release(Cache::Handle* handle) {
+  if (handle == nullptr) {
+    return;
+  }
+  auto* e = reinterpret_cast<ClockHandle*>(handle);
+  auto refs = e->refs.fetch_sub(1, std::memory_order_acq_rel);
+  if (refs == 1) {
+    Free(e);
+    return;
+  }
+  // Entry that could not be evicted while it was referenced is evicted now, if the cache is still
+  // over capacity.
+  if (refs == 2 && usage_.load(std::memory_order_acquire) > capacity_) {
+    autovector<ClockHandle*> evicted;
+    {
+      WriteLock l(&mutex_);
+      EvictFromClock(capacity_, &evicted);
+    }
+    UnrefEvicted(evicted);
+  }
+}
+
+Status ClockCacheShard::Insert(
+    const Slice& key, uint32_t hash, const QueryId query_id, void* value, size_t charge,
+    void (*deleter)(const Slice& key, void* value), Cache::Handle** handle,
+    Statistics* statistics) {
+  // Allocate the memory here outside of the mutex.
+  auto* e = ClockHandle::Create(key);
+  e->value = value;
+  e->deleter = deleter;
+  e->charge = charge;
+  e->hash = hash;
+  // One from the cache, one for the returned handle.
+  e->refs.store(handle == nullptr ? 1 : 2, std::memory_order_relaxed);
+  e->priority.store(query_id == kInMultiTouchId ? 1 : 0, std::memory_order_relaxed);
+  e->next = e->prev = nullptr;
+  e->query_id = query_id;
+
+  Status s;
+  autovector<ClockHandle*> evicted;
+  {
+    WriteLock l(&mutex_);
+    auto target_usage = capacity_ > charge ? capacity_ - charge : 0;
+    auto evicted_charge = EvictFromClock(target_usage, &evicted);
+    if (strict_capacity_limit_ &&
+        usage_.load(std::memory_order_acquire) - evicted_charge + charge > capacity_) {
+      s = STATUS(Incomplete, "Insert failed due to CLOCK cache being full.");
+    } else {
+      usage_.fetch_add(charge, std::memory_order_acq_rel);
+      auto* old = table_.Insert(e);
+      if (old != nullptr) {
+        ClockRemove(old);
+        evicted.push_back(old);
+      }
+      ClockAppend(e);
+      if (metrics_ != nullptr) {
+        metrics_->cache_usage->IncrementBy(charge);
+      }
+    }
+  }
+  UnrefEvicted(evicted);
+
+  if (statistics != nullptr) {
+    if (s.ok()) {
+      RecordTick(statistics, BLOCK_CACHE_ADD);
+      RecordTick(statistics, BLOCK_CACHE_BYTES_WRITE, charge);
+    } else {
+      RecordTick(statistics, BLOCK_CACHE_ADD_FAILURES);
+    }
+  }
+
+  if (!s.ok()) {
+    // In case of error caller is responsible to cleanup the value when handle was requested.
+    if (handle == nullptr) {
+      (*deleter)(key, value);
+    } else {
+      *handle = nullptr;
+    }
+    e->Destroy();
+  } else if (handle != nullptr) {
+    *handle = reinterpret_cast<Cache::Handle*>(e);
+  }
+  return s;
+}
+
+void ClockCacheShard::Erase(const Slice& key, uint32_t hash) {
+  ClockHandle* e;
+  {
+    WriteLock l(&mutex_);
+    e = table_.Remove(key, hash);
+    if (e != nullptr) {
+      ClockRemove(e);
+    }
+  }
+  // mutex not held here
+  if (e != nullptr) {
+    Unref(e);
+  }
+}
+
+class ShardedClockCache : public Cache {
+ public:
+  ShardedClockCache(size_t capacity, int num_shard_bits, bool strict_capacity_limit)
+      : num_shard_bits_(num_shard_bits),
+        shards_(new ClockCacheShard[1ULL << num_shard_bits]),
+        capacity_(capacity),
+        strict_capacity_limit_(strict_capacity_limit) {
+    for (size_t s = 0; s != num_shards(); ++s) {
+      shards_[s].SetStrictCapacityLimit(strict_capacity_limit);
+    }
+    SetCapacity(capacity);
+  }
+
+  virtual ~ShardedClockCache() {
+    delete[] shards_;
+  }
+
+  void SetCapacity(size_t capacity) override {
+    const size_t per_shard = (capacity + (num_shards() - 1)) / num_shards();
+    MutexLock l(&capacity_mutex_);
+    for (size_t s = 0; s != num_shards(); ++s) {
+      shards_[s].SetCapacity(per_shard);
+    }
+    capacity_ = capacity;
+  }
+
+  Status Insert(const Slice& key, const QueryId query_id, void* value, size_t charge,
+                void (*deleter)(const Slice& key, void* value),
+                Handle** handle, Statistics* statistics) override {
+    // Queries with no cache query ids are not cached.
+    if (query_id == kNoCacheQueryId) {
+      return Status::OK();
+    }
+    const uint32_t hash = HashSlice(key);
+    return shards_[Shard(hash)].Insert(key, hash, query_id, value, charge, deleter,
+                                       handle, statistics);
+  }
+
+  size_t Evict(size_t bytes_to_evict) override {
+    size_t total_evicted = 0;
+    // Start at random shard.
+    auto index = Shard(yb::RandomUniformInt<uint32_t>());
+    for (size_t i = 0; bytes_to_evict > total_evicted && i != num_shards(); ++i) {
+      total_evicted += shards_[index].Evict(bytes_to_evict - total_evicted);
+      index = (index + 1) & (num_shards() - 1);
+    }
+    return total_evicted;
+  }
+
+  Handle* Lookup(const Slice& key, const QueryId query_id, Statistics* statistics) override {
+    if (query_id == kNoCacheQueryId) {
+      return nullptr;
+    }
+    const uint32_t hash = HashSlice(key);
+    return shards_[Shard(hash)].Lookup(key, hash, query_id, statistics);
+  }
+
+  void Release(Handle* handle) override {
+    if (handle == nullptr) {
+      return;
+    }
+    shards_[Shard(reinterpret_cast<ClockHandle*>(handle)->hash)].Release(handle);
+  }
+
+  void Erase(const Slice& key) override {
+    const uint32_t hash = HashSlice(key);
+    shards_[Shard(hash)].Erase(key, hash);
+  }
+
+  void* Value(Handle* handle) override {
+    return reinterpret_cast<ClockHandle*>(handle)->value;
+  }
+
+  uint64_t NewId() override {
+    return last_id_.fetch_add(1, std::memory_order_acq_rel) + 1;
+  }
+
+  size_t GetCapacity() const override { return capacity_; }
+
+  bool HasStrictCapacityLimit() const override {
+    return strict_capacity_limit_;
+  }
+
+  size_t GetUsage() const override {
+    size_t usage = 0;
+    for (size_t s = 0; s != num_shards(); ++s) {
+      usage += shards_[s].GetUsage();
+    }
+    return usage;
+  }
+
+  size_t GetUsage(Handle* handle) const override {
+    return reinterpret_cast<ClockHandle*>(handle)->charge;
+  }
+
+  size_t GetPinnedUsage() const override {
+    size_t usage = 0;
+    for (size_t s = 0; s != num_shards(); ++s) {
+      usage += shards_[s].GetPinnedUsage();
+    }
+    return usage;
+  }
+
+  void DisownData() override {
+    shards_ = nullptr;
+  }
+
+  void ApplyToAllCacheEntries(void (*callback)(void*, size_t), bool thread_safe) override {
+    for (size_t s = 0; s != num_shards(); ++s) {
+      shards_[s].ApplyToAllCacheEntries(callback, thread_safe);
+    }
+  }
+
+  void SetMetrics(const scoped_refptr<yb::MetricEntity>& entity) override {
+    metrics_ = std::make_shared<yb::CacheMetrics>(entity);
+    for (size_t s = 0; s != num_shards(); ++s) {
+      shards_[s].SetMetrics(metrics_);
+    }
+  }
+
+  // CLOCK cache does not have sub caches, so all usage is reported as multi-touch.
+  std::vector<std::pair<size_t, size_t>> TEST_GetIndividualUsages() override {
+    std::vector<std::pair<size_t, size_t>> cache_sizes;
+    cache_sizes.reserve(num_shards());
+    for (size_t s = 0; s != num_shards(); ++s) {
+      cache_sizes.emplace_back(0, shards_[s].GetUsage());
+    }
+    return cache_sizes;
+  }
+
+ private:
+  static inline uint32_t HashSlice(const Slice& s) {
+    return Hash(s.data(), s.size(), 0);
+  }
+
+  uint32_t Shard(uint32_t hash) const {
+    // Note, hash >> 32 yields hash in gcc, not the zero we expect!
+    return (num_shard_bits_ > 0) ? (hash >> (32 - num_shard_bits_)) : 0;
+  }
+
+  size_t num_shards() const {
+    return 1ULL << num_shard_bits_;
+  }
+
+  const size_t num_shard_bits_;
+  ClockCacheShard* shards_;
+  port::Mutex capacity_mutex_;
+  std::atomic<uint64_t> last_id_{0};
+  size_t capacity_;
+  const bool strict_capacity_limit_;
+  shared_ptr<yb::CacheMetrics> metrics_;
+};
+
+}  // end anonymous namespace
+
+shared_ptr<Cache> NewClockCache(size_t capacity, int num_shard_bits, bool strict_capacity_limit) {
+  if (num_shard_bits > kSharedLRUCacheMaxNumShardBits) {
+    return nullptr;  // the cache cannot be sharded into too many fine pieces
+  }
+  return std::make_shared<ShardedClockCache>(capacity, num_shard_bits, strict_capacity_limit);
+}
+
+}  // namespace rocksdb
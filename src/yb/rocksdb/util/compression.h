@@ -25,7 +25,9 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "yb/rocksdb/options.h"
 #include "yb/rocksdb/util/coding.h"
@@ -48,6 +50,7 @@
 #endif
 
 #if defined(ZSTD)
+#include <zdict.h>
 #include <zstd.h>
 #endif
 
@@ -620,8 +623,114 @@ inline bool LZ4HC_Compress(const CompressionOptions& opts,
   return false;
 }
 
+// Dictionary used to compress data blocks of a single SST file, see
+// CompressionOptions::max_dict_bytes. Keeps digested dictionary and compression context, so they
+// are not recreated for each block. Not thread safe.
+class CompressionDict {
+ public:
+  CompressionDict(std::string dict, int level) : dict_(std::move(dict)) {
+#ifdef ZSTD
+    cdict_ = ZSTD_createCDict(dict_.data(), dict_.size(), level);
+    cctx_ = ZSTD_createCCtx();
+#endif
+  }
+
+  CompressionDict(const CompressionDict&) = delete;
+  void operator=(const CompressionDict&) = delete;
+
+  ~CompressionDict() {
+#ifdef ZSTD
+    ZSTD_freeCCtx(cctx_);
+    ZSTD_freeCDict(cdict_);
+#endif
+  }
+
+  const std::string& raw() const {
+    return dict_;
+  }
+
+#ifdef ZSTD
+  ZSTD_CCtx* cctx() const {
+    return cctx_;
+  }
+
+  const ZSTD_CDict* cdict() const {
+    return cdict_;
+  }
+#endif
+
+ private:
+  std::string dict_;
+#ifdef ZSTD
+  ZSTD_CDict* cdict_ = nullptr;
+  ZSTD_CCtx* cctx_ = nullptr;
+#endif
+};
+
+// Digested dictionary used to decompress data blocks of a single SST file. Thread safe, so it is
+// shared by all readers of the file.
+class UncompressionDict {
+ public:
+  explicit UncompressionDict(std::string dict) : dict_(std::move(dict)) {
+#ifdef ZSTD
+    ddict_ = ZSTD_createDDict(dict_.data(), dict_.size());
+#endif
+  }
+
+  UncompressionDict(const UncompressionDict&) = delete;
+  void operator=(const UncompressionDict&) = delete;
+
+  ~UncompressionDict() {
+#ifdef ZSTD
+    ZSTD_freeDDict(ddict_);
+#endif
+  }
+
+  size_t memory_footprint() const {
+#ifdef ZSTD
+    return dict_.size() + ZSTD_sizeof_DDict(ddict_);
+#else
+    return dict_.size();
+#endif
+  }
+
+#ifdef ZSTD
+  const ZSTD_DDict* ddict() const {
+    return ddict_;
+  }
+#endif
+
+ private:
+  std::string dict_;
+#ifdef ZSTD
+  ZSTD_DDict* ddict_ = nullptr;
+#endif
+};
+
+// Trains dictionary of at most max_dict_bytes on samples, that are concatenated in samples, with
+// sizes of individual samples in sample_sizes.
+// Returns empty string if dictionary could not be trained, for instance when there are too few
+// samples.
+inline std::string ZSTD_TrainDictionary(const std::string& samples,
+                                        const std::vector<size_t>& sample_sizes,
+                                        size_t max_dict_bytes) {
+#ifdef ZSTD
+  std::string dict(max_dict_bytes, '\0');
+  size_t dict_size = ZDICT_trainFromBuffer(
+      &dict[0], max_dict_bytes, samples.data(), sample_sizes.data(),
+      static_cast<unsigned>(sample_sizes.size()));
+  if (ZDICT_isError(dict_size)) {
+    return std::string();
+  }
+  dict.resize(dict_size);
+  return dict;
+#endif
+  return std::string();
+}
+
 inline bool ZSTD_Compress(const CompressionOptions& opts, const char* input,
-                          size_t length, ::std::string* output) {
+                          size_t length, ::std::string* output,
+                          const CompressionDict* dict = nullptr) {
 #ifdef ZSTD
   if (length > std::numeric_limits<uint32_t>::max()) {
     // Can't compress more than 4GB
@@ -633,9 +742,16 @@ inline bool ZSTD_Compress(const CompressionOptions& opts, const char* input,
 
   size_t compressBound = ZSTD_compressBound(length);
   output->resize(static_cast<size_t>(output_header_len + compressBound));
-  size_t outlen = ZSTD_compress(&(*output)[output_header_len], compressBound,
-                                input, length, opts.level);
-  if (outlen == 0) {
+  size_t outlen;
+  if (dict) {
+    outlen = ZSTD_compress_usingCDict(
+        dict->cctx(), &(*output)[output_header_len], compressBound, input, length,
+        dict->cdict());
+  } else {
+    outlen = ZSTD_compress(&(*output)[output_header_len], compressBound,
+                           input, length, opts.level);
+  }
+  if (outlen == 0 || ZSTD_isError(outlen)) {
     return false;
   }
   output->resize(output_header_len + outlen);
@@ -644,8 +760,30 @@ inline bool ZSTD_Compress(const CompressionOptions& opts, const char* input,
   return false;
 }
 
+#ifdef ZSTD
+namespace compression {
+
+struct ZSTDDecompressionContextDeleter {
+  void operator()(ZSTD_DCtx* dctx) const {
+    ZSTD_freeDCtx(dctx);
+  }
+};
+
+// Decompression context is reused by all blocks decompressed by the thread.
+inline ZSTD_DCtx* ZSTDThreadLocalDecompressionContext() {
+  static thread_local std::unique_ptr<ZSTD_DCtx, ZSTDDecompressionContextDeleter> dctx(
+      ZSTD_createDCtx());
+  return dctx.get();
+}
+
+}  // namespace compression
+#endif
+
+// Blocks compressed without dictionary could be decompressed with dictionary, so dict could be
+// passed for any block of the file.
 inline char* ZSTD_Uncompress(const char* input_data, size_t input_length,
-                             int* decompress_size) {
+                             int* decompress_size,
+                             const UncompressionDict* dict = nullptr) {
 #ifdef ZSTD
   uint32_t output_len = 0;
   if (!compression::GetDecompressedSizeInfo(&input_data, &input_length,
@@ -653,12 +791,17 @@ inline char* ZSTD_Uncompress(const char* input_data, size_t input_length,
     return nullptr;
   }
 
-  char* output = new char[output_len];
-  size_t actual_output_length =
-      ZSTD_decompress(output, output_len, input_data, input_length);
-  assert(actual_output_length == output_len);
+  std::unique_ptr<char[]> output(new char[output_len]);
+  auto* dctx = compression::ZSTDThreadLocalDecompressionContext();
+  size_t actual_output_length = dict
+      ? ZSTD_decompress_usingDDict(
+            dctx, output.get(), output_len, input_data, input_length, dict->ddict())
+      : ZSTD_decompressDCtx(dctx, output.get(), output_len, input_data, input_length);
+  if (ZSTD_isError(actual_output_length) || actual_output_length != output_len) {
+    return nullptr;
+  }
   *decompress_size = static_cast<int>(actual_output_length);
-  return output;
+  return output.release();
 #endif
   return nullptr;
 }
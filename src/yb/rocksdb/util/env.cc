@@ -527,6 +527,20 @@ EnvOptions Env::OptimizeForManifestWrite(const EnvOptions& env_options) const {
   return env_options;
 }
 
+EnvOptions Env::OptimizeForCompactionTableWrite(const EnvOptions& env_options,
+                                                const DBOptions& db_options) const {
+  EnvOptions optimized_env_options(env_options);
+  optimized_env_options.use_direct_writes = db_options.use_direct_io_for_flush_and_compaction;
+  return optimized_env_options;
+}
+
+EnvOptions Env::OptimizeForCompactionTableRead(const EnvOptions& env_options,
+                                               const DBOptions& db_options) const {
+  EnvOptions optimized_env_options(env_options);
+  optimized_env_options.use_direct_reads = db_options.use_direct_reads_for_compaction_inputs;
+  return optimized_env_options;
+}
+
 Status Env::LinkFile(const std::string& src, const std::string& target) {
   return STATUS(NotSupported, "LinkFile is not supported for this Env");
 }
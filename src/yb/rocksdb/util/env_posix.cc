@@ -129,6 +129,27 @@ void SetFD_CLOEXEC(int fd, const EnvOptions* options) {
   }
 }
 
+// Opens file with O_DIRECT when *direct is true. Falls back to buffered IO and resets *direct when
+// O_DIRECT is not supported by the file system, e.g. tmpfs.
+int OpenMaybeDirect(const std::string& fname, int flags, bool* direct) {
+  int fd = -1;
+#ifdef O_DIRECT
+  if (*direct) {
+    do {
+      fd = open(fname.c_str(), flags | O_DIRECT, 0644);
+    } while (fd < 0 && errno == EINTR);
+    if (fd >= 0 || errno != EINVAL) {
+      return fd;
+    }
+  }
+#endif
+  *direct = false;
+  do {
+    fd = open(fname.c_str(), flags, 0644);
+  } while (fd < 0 && errno == EINTR);
+  return fd;
+}
+
 class PosixFileLock : public FileLock {
  public:
   int fd_;
@@ -597,15 +618,17 @@ class PosixRocksDBFileFactory : public RocksDBFileFactory {
                              const EnvOptions& options) override {
     result->reset();
     Status s;
+    const bool use_mmap_reads = options.use_mmap_reads && sizeof(void*) >= 8;
+    bool direct = options.use_direct_reads && !use_mmap_reads;
     int fd;
     {
       IOSTATS_TIMER_GUARD(open_nanos);
-      fd = open(fname.c_str(), O_RDONLY);
+      fd = OpenMaybeDirect(fname, O_RDONLY, &direct);
     }
     SetFD_CLOEXEC(fd, &options);
     if (fd < 0) {
       s = STATUS_IO_ERROR(fname, errno);
-    } else if (options.use_mmap_reads && sizeof(void*) >= 8) {
+    } else if (use_mmap_reads) {
       // Use of mmap for random reads has been removed because it
       // kills performance when storage is fast.
       // Use mmap when virtual address-space is plentiful.
@@ -621,7 +644,9 @@ class PosixRocksDBFileFactory : public RocksDBFileFactory {
       }
       close(fd);
     } else {
-      *result = std::make_unique<yb::PosixRandomAccessFile>(fname, fd, options);
+      EnvOptions file_options = options;
+      file_options.use_direct_reads = direct;
+      *result = std::make_unique<yb::PosixRandomAccessFile>(fname, fd, file_options);
     }
     return s;
   }
@@ -631,11 +656,12 @@ class PosixRocksDBFileFactory : public RocksDBFileFactory {
                          const EnvOptions& options) override {
     result->reset();
     Status s;
+    bool direct = options.use_direct_writes && !options.use_mmap_writes;
     int fd = -1;
-    do {
+    {
       IOSTATS_TIMER_GUARD(open_nanos);
-      fd = open(fname.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
-    } while (fd < 0 && errno == EINTR);
+      fd = OpenMaybeDirect(fname, O_CREAT | O_RDWR | O_TRUNC, &direct);
+    }
     if (fd < 0) {
       s = STATUS_IO_ERROR(fname, errno);
     } else {
@@ -656,6 +682,7 @@ class PosixRocksDBFileFactory : public RocksDBFileFactory {
         // disable mmap writes
         EnvOptions no_mmap_writes_options = options;
         no_mmap_writes_options.use_mmap_writes = false;
+        no_mmap_writes_options.use_direct_writes = direct;
         *result = std::make_unique<PosixWritableFile>(fname, fd, no_mmap_writes_options);
       }
     }
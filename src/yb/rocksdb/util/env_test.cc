@@ -44,8 +44,10 @@
 #include "yb/rocksdb/env.h"
 #include "yb/rocksdb/port/port.h"
 #include "yb/rocksdb/util/coding.h"
+#include "yb/rocksdb/util/file_reader_writer.h"
 #include "yb/rocksdb/util/log_buffer.h"
 #include "yb/rocksdb/util/mutexlock.h"
+#include "yb/rocksdb/util/random.h"
 #include "yb/rocksdb/util/testharness.h"
 #include "yb/rocksdb/util/testutil.h"
 
@@ -969,6 +971,51 @@ TEST_F(EnvPosixTest, Preallocation) {
   ASSERT_EQ(last_allocated_block, 7UL);
 }
 
+// File systems without O_DIRECT support fall back to buffered IO, so the test checks that data is
+// the same in both cases.
+TEST_F(EnvPosixTest, DirectIO) {
+  const std::string fname = test::TmpDir() + "/" + "testfile";
+  EnvOptions soptions;
+  soptions.use_mmap_writes = false;
+  soptions.use_direct_writes = true;
+  soptions.use_direct_reads = true;
+
+  Random rnd(301);
+  std::string data;
+  {
+    unique_ptr<WritableFile> wfile;
+    ASSERT_OK(env_->NewWritableFile(fname, &wfile, soptions));
+    WritableFileWriter writer(std::move(wfile), soptions);
+    for (int i = 0; i != 100; ++i) {
+      auto chunk = RandomString(&rnd, 1 + rnd.Uniform(10000));
+      ASSERT_OK(writer.Append(chunk));
+      data += chunk;
+      // Flush in the middle of the block, so the padded tail is rewritten by the next flush.
+      if (i % 10 == 0) {
+        ASSERT_OK(writer.Flush());
+      }
+    }
+    ASSERT_OK(writer.Close());
+  }
+
+  uint64_t size = 0;
+  ASSERT_OK(env_->GetFileSize(fname, &size));
+  ASSERT_EQ(size, data.size());
+
+  {
+    constexpr size_t kReadSize = 5000;
+    unique_ptr<RandomAccessFile> file;
+    ASSERT_OK(env_->NewRandomAccessFile(fname, &file, soptions));
+    std::string scratch(kReadSize, '\0');
+    for (uint64_t offset : {0UL, 1UL, 4095UL, 4096UL, 12345UL, size - 10, size}) {
+      Slice result;
+      ASSERT_OK(file->Read(offset, kReadSize, &result, scratch.data()));
+      ASSERT_EQ(result.ToBuffer(), data.substr(offset, kReadSize)) << "Offset: " << offset;
+    }
+  }
+  ASSERT_OK(env_->DeleteFile(fname));
+}
+
 // Test that the two ways to get children file attributes (in bulk or
 // individually) behave consistently.
 TEST_F(EnvPosixTest, ConsistentChildrenAttributes) {
@@ -98,6 +98,28 @@ Status RandomAccessFileReader::ReadAndValidate(
   return s;
 }
 
+Status RandomAccessFileReader::MultiRead(
+    ReadRequest* requests, size_t num_requests, Statistics* statistics) const {
+  Status s;
+  uint64_t elapsed = 0;
+  auto* effective_statistics = statistics ? statistics : stats_;
+  {
+    StopWatch sw(env_, effective_statistics, hist_type_,
+                 (effective_statistics != nullptr) ? &elapsed : nullptr);
+    IOSTATS_TIMER_GUARD(read_nanos);
+    s = file_->MultiRead(requests, num_requests);
+    if (s.ok()) {
+      for (size_t i = 0; i != num_requests; ++i) {
+        IOSTATS_ADD_IF_POSITIVE(bytes_read, requests[i].result.size());
+      }
+    }
+  }
+  if (effective_statistics == stats_ && stats_ != nullptr && file_read_hist_ != nullptr) {
+    file_read_hist_->Add(elapsed);
+  }
+  return s;
+}
+
 WritableFileWriter::~WritableFileWriter() {
   WARN_NOT_OK(Close(), "Failed to close file");
 }
@@ -340,6 +362,9 @@ size_t WritableFileWriter::RequestToken(size_t bytes, bool align) {
     }
     rate_limiter_->Request(bytes, io_priority);
   }
+  if (suspender_) {
+    suspender_->RecordIO(bytes);
+  }
   return bytes;
 }
 
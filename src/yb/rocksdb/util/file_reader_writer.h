@@ -118,6 +118,8 @@ class RandomAccessFileReader {
   Status ReadAndValidate(
       uint64_t offset, size_t n, Slice* result, char* scratch, const yb::ReadValidator& validator,
       Statistics* statistics = nullptr);
+  Status MultiRead(
+      ReadRequest* requests, size_t num_requests, Statistics* statistics = nullptr) const;
 
   RandomAccessFile* file() { return file_.get(); }
 };
@@ -65,6 +65,7 @@ ImmutableCFOptions::ImmutableCFOptions(const Options& options)
       statistics(options.statistics.get()),
       env(options.env),
       delayed_write_rate(options.delayed_write_rate),
+      proportional_write_delay(options.proportional_write_delay),
       allow_mmap_reads(options.allow_mmap_reads),
       allow_mmap_writes(options.allow_mmap_writes),
       db_paths(options.db_paths),
@@ -89,6 +90,8 @@ ImmutableCFOptions::ImmutableCFOptions(const Options& options)
       compaction_readahead_size(options.compaction_readahead_size),
       num_levels(options.num_levels),
       optimize_filters_for_hits(options.optimize_filters_for_hits),
+      min_blob_size(options.merge_operator ? 0 : options.min_blob_size),
+      blob_garbage_collection_ratio(options.blob_garbage_collection_ratio),
       listeners(options.listeners),
       row_cache(options.row_cache),
       mem_tracker(options.mem_tracker),
@@ -148,7 +151,9 @@ ColumnFamilyOptions::ColumnFamilyOptions()
       min_partial_merge_operands(2),
       optimize_filters_for_hits(false),
       paranoid_file_checks(false),
-      compaction_measure_io_stats(false) {
+      compaction_measure_io_stats(false),
+      min_blob_size(0),
+      blob_garbage_collection_ratio(0.5) {
   assert(memtable_factory.get() != nullptr);
 }
 
@@ -217,7 +222,9 @@ ColumnFamilyOptions::ColumnFamilyOptions(const Options& options)
       min_partial_merge_operands(options.min_partial_merge_operands),
       optimize_filters_for_hits(options.optimize_filters_for_hits),
       paranoid_file_checks(options.paranoid_file_checks),
-      compaction_measure_io_stats(options.compaction_measure_io_stats) {
+      compaction_measure_io_stats(options.compaction_measure_io_stats),
+      min_blob_size(options.min_blob_size),
+      blob_garbage_collection_ratio(options.blob_garbage_collection_ratio) {
   assert(memtable_factory.get() != nullptr);
   if (max_bytes_for_level_multiplier_additional.size() <
       static_cast<unsigned int>(num_levels)) {
@@ -276,6 +283,8 @@ DBOptions::DBOptions()
       access_hint_on_compaction_start(NORMAL),
       new_table_reader_for_compaction_inputs(false),
       compaction_readahead_size(0),
+      use_direct_io_for_flush_and_compaction(false),
+      use_direct_reads_for_compaction_inputs(false),
       random_access_max_buffer_size(1024 * 1024),
       writable_file_max_buffer_size(1024 * 1024),
       use_adaptive_mutex(false),
@@ -284,6 +293,7 @@ DBOptions::DBOptions()
       listeners(),
       enable_thread_tracking(false),
       delayed_write_rate(2 * 1024U * 1024U),
+      proportional_write_delay(false),
       allow_concurrent_memtable_write(false),
       enable_write_thread_adaptive_yield(false),
       write_thread_max_yield_usec(100),
@@ -375,6 +385,10 @@ void DBOptions::Dump(Logger* log) const {
       "               Options.compaction_readahead_size: %" ROCKSDB_PRIszt
          "d",
          compaction_readahead_size);
+  RHEADER(log, "  Options.use_direct_io_for_flush_and_compaction: %d",
+      use_direct_io_for_flush_and_compaction);
+  RHEADER(log, "  Options.use_direct_reads_for_compaction_inputs: %d",
+      use_direct_reads_for_compaction_inputs);
   RHEADER(
       log,
       "               Options.random_access_max_buffer_size: %" ROCKSDB_PRIszt
@@ -455,6 +469,12 @@ void ColumnFamilyOptions::Dump(Logger* log) const {
       compression_opts.level);
   RHEADER(log, "              Options.compression_opts.strategy: %d",
       compression_opts.strategy);
+  RHEADER(log, "        Options.compression_opts.max_dict_bytes: %" PRIu32,
+      compression_opts.max_dict_bytes);
+  RHEADER(log, "  Options.compression_opts.zstd_max_train_bytes: %" PRIu32,
+      compression_opts.zstd_max_train_bytes);
+  RHEADER(log, "      Options.compression_opts.parallel_threads: %" PRIu32,
+      compression_opts.parallel_threads);
   RHEADER(log, "     Options.level0_file_num_compaction_trigger: %d",
       level0_file_num_compaction_trigger);
   RHEADER(log, "         Options.level0_slowdown_writes_trigger: %d",
@@ -559,6 +579,10 @@ void ColumnFamilyOptions::Dump(Logger* log) const {
       paranoid_file_checks);
   RHEADER(log, "               Options.compaction_measure_io_stats: %d",
       compaction_measure_io_stats);
+  RHEADER(log, "                           Options.min_blob_size: %" PRIu64,
+      min_blob_size);
+  RHEADER(log, "           Options.blob_garbage_collection_ratio: %f",
+      blob_garbage_collection_ratio);
 }  // ColumnFamilyOptions::Dump
 
 void Options::Dump(Logger* log) const {
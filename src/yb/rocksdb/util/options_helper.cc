@@ -824,8 +824,20 @@ Status ParseColumnFamilyOption(const std::string& name,
         return STATUS(InvalidArgument,
             "unable to parse the specified CF option " + name);
       }
+      end = value.find(':', start);
       new_options->compression_opts.strategy =
-          ParseInt(value.substr(start, value.size() - start));
+          ParseInt(value.substr(start, end - start));
+      // Dictionary options are optional.
+      if (end != std::string::npos) {
+        start = end + 1;
+        end = value.find(':', start);
+        new_options->compression_opts.max_dict_bytes =
+            ParseUint32(value.substr(start, end - start));
+        if (end != std::string::npos) {
+          new_options->compression_opts.zstd_max_train_bytes =
+              ParseUint32(value.substr(end + 1));
+        }
+      }
     } else if (name == "compaction_options_fifo") {
       new_options->compaction_options_fifo.max_table_files_size =
           ParseUint64(value);
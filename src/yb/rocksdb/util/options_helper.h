@@ -221,6 +221,12 @@ static std::unordered_map<std::string, OptionTypeInfo> db_options_type_info = {
     {"compaction_readahead_size",
      {offsetof(struct DBOptions, compaction_readahead_size), OptionType::kSizeT,
       OptionVerificationType::kNormal}},
+    {"use_direct_io_for_flush_and_compaction",
+     {offsetof(struct DBOptions, use_direct_io_for_flush_and_compaction),
+      OptionType::kBoolean, OptionVerificationType::kNormal}},
+    {"use_direct_reads_for_compaction_inputs",
+     {offsetof(struct DBOptions, use_direct_reads_for_compaction_inputs),
+      OptionType::kBoolean, OptionVerificationType::kNormal}},
     {"random_access_max_buffer_size",
      {offsetof(struct DBOptions, random_access_max_buffer_size),
       OptionType::kSizeT, OptionVerificationType::kNormal}},
@@ -296,6 +302,9 @@ static std::unordered_map<std::string, OptionTypeInfo> db_options_type_info = {
     {"delayed_write_rate",
      {offsetof(struct DBOptions, delayed_write_rate), OptionType::kUInt64T,
       OptionVerificationType::kNormal}},
+    {"proportional_write_delay",
+     {offsetof(struct DBOptions, proportional_write_delay), OptionType::kBoolean,
+      OptionVerificationType::kNormal}},
     {"delete_obsolete_files_period_micros",
      {offsetof(struct DBOptions, delete_obsolete_files_period_micros),
       OptionType::kUInt64T, OptionVerificationType::kNormal}},
@@ -379,6 +388,12 @@ static std::unordered_map<std::string, OptionTypeInfo> cf_options_type_info = {
     {"paranoid_file_checks",
      {offsetof(struct ColumnFamilyOptions, paranoid_file_checks),
       OptionType::kBoolean, OptionVerificationType::kNormal}},
+    {"min_blob_size",
+     {offsetof(struct ColumnFamilyOptions, min_blob_size),
+      OptionType::kUInt64T, OptionVerificationType::kNormal}},
+    {"blob_garbage_collection_ratio",
+     {offsetof(struct ColumnFamilyOptions, blob_garbage_collection_ratio),
+      OptionType::kDouble, OptionVerificationType::kNormal}},
     {"purge_redundant_kvs_while_flush",
      {offsetof(struct ColumnFamilyOptions, purge_redundant_kvs_while_flush),
       OptionType::kBoolean, OptionVerificationType::kNormal}},
@@ -519,6 +534,12 @@ static std::unordered_map<std::string,
     {"cache_index_and_filter_blocks",
      {offsetof(struct BlockBasedTableOptions, cache_index_and_filter_blocks),
       OptionType::kBoolean, OptionVerificationType::kNormal}},
+    {"cache_filter_blocks_with_high_priority",
+     {offsetof(struct BlockBasedTableOptions, cache_filter_blocks_with_high_priority),
+      OptionType::kBoolean, OptionVerificationType::kNormal}},
+    {"cache_index_blocks_with_high_priority",
+     {offsetof(struct BlockBasedTableOptions, cache_index_blocks_with_high_priority),
+      OptionType::kBoolean, OptionVerificationType::kNormal}},
     {"index_type",
      {offsetof(struct BlockBasedTableOptions, index_type),
       OptionType::kBlockBasedTableIndexType, OptionVerificationType::kNormal}},
@@ -546,6 +567,9 @@ static std::unordered_map<std::string,
     {"index_block_restart_interval",
      {offsetof(struct BlockBasedTableOptions, index_block_restart_interval),
       OptionType::kInt, OptionVerificationType::kNormal}},
+    {"use_data_block_hash_index",
+     {offsetof(struct BlockBasedTableOptions, use_data_block_hash_index),
+      OptionType::kBoolean, OptionVerificationType::kNormal}},
     {"index_block_size",
      {offsetof(struct BlockBasedTableOptions, index_block_size), OptionType::kSizeT,
       OptionVerificationType::kNormal}},
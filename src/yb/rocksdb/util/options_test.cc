@@ -126,7 +126,7 @@ TEST_F(OptionsTest, GetOptionsFromMapTest) {
        "kLZ4Compression:"
        "kLZ4HCCompression:"
        "kZSTDNotFinalCompression"},
-      {"compression_opts", "4:5:6"},
+      {"compression_opts", "4:5:6:7:8"},
       {"num_levels", "7"},
       {"level0_file_num_compaction_trigger", "8"},
       {"level0_slowdown_writes_trigger", "9"},
@@ -196,6 +196,8 @@ TEST_F(OptionsTest, GetOptionsFromMapTest) {
       {"use_adaptive_mutex", "false"},
       {"new_table_reader_for_compaction_inputs", "true"},
       {"compaction_readahead_size", "100"},
+      {"use_direct_io_for_flush_and_compaction", "true"},
+      {"use_direct_reads_for_compaction_inputs", "true"},
       {"random_access_max_buffer_size", "3145728"},
       {"writable_file_max_buffer_size", "314159"},
       {"bytes_per_sync", "47"},
@@ -222,6 +224,8 @@ TEST_F(OptionsTest, GetOptionsFromMapTest) {
   ASSERT_EQ(new_cf_opt.compression_opts.window_bits, 4);
   ASSERT_EQ(new_cf_opt.compression_opts.level, 5);
   ASSERT_EQ(new_cf_opt.compression_opts.strategy, 6);
+  ASSERT_EQ(new_cf_opt.compression_opts.max_dict_bytes, 7U);
+  ASSERT_EQ(new_cf_opt.compression_opts.zstd_max_train_bytes, 8U);
   ASSERT_EQ(new_cf_opt.num_levels, 7);
   ASSERT_EQ(new_cf_opt.level0_file_num_compaction_trigger, 8);
   ASSERT_EQ(new_cf_opt.level0_slowdown_writes_trigger, 9);
@@ -308,6 +312,8 @@ TEST_F(OptionsTest, GetOptionsFromMapTest) {
   ASSERT_EQ(new_db_opt.use_adaptive_mutex, false);
   ASSERT_EQ(new_db_opt.new_table_reader_for_compaction_inputs, true);
   ASSERT_EQ(new_db_opt.compaction_readahead_size, 100);
+  ASSERT_EQ(new_db_opt.use_direct_io_for_flush_and_compaction, true);
+  ASSERT_EQ(new_db_opt.use_direct_reads_for_compaction_inputs, true);
   ASSERT_EQ(new_db_opt.random_access_max_buffer_size, 3145728);
   ASSERT_EQ(new_db_opt.writable_file_max_buffer_size, 314159);
   ASSERT_EQ(new_db_opt.bytes_per_sync, static_cast<uint64_t>(47));
@@ -478,14 +484,19 @@ TEST_F(OptionsTest, GetBlockBasedTableOptionsFromString) {
   BlockBasedTableOptions new_opt;
   // make sure default values are overwritten by something else
   ASSERT_OK(GetBlockBasedTableOptionsFromString(table_opt,
-            "cache_index_and_filter_blocks=1;index_type=kHashSearch;"
+            "cache_index_and_filter_blocks=1;cache_filter_blocks_with_high_priority=1;"
+            "cache_index_blocks_with_high_priority=1;index_type=kHashSearch;"
             "checksum=kxxHash;hash_index_allow_collision=1;no_block_cache=1;"
             "block_cache=1M;block_cache_compressed=1k;block_size=1024;filter_block_size=4096;"
             "block_size_deviation=8;block_restart_interval=4;index_block_size=16384;"
+            "use_data_block_hash_index=1;"
             "min_keys_per_index_block=16;filter_policy=bloomfilter:4:true;whole_key_filtering=1;"
             "skip_table_builder_flush=1",
             &new_opt));
   ASSERT_TRUE(new_opt.cache_index_and_filter_blocks);
+  ASSERT_TRUE(new_opt.cache_filter_blocks_with_high_priority);
+  ASSERT_TRUE(new_opt.cache_index_blocks_with_high_priority);
+  ASSERT_TRUE(new_opt.use_data_block_hash_index);
   ASSERT_EQ(new_opt.index_type, IndexType::kHashSearch);
   ASSERT_EQ(new_opt.checksum, ChecksumType::kxxHash);
   ASSERT_TRUE(new_opt.hash_index_allow_collision);
@@ -1636,6 +1647,8 @@ Status GetFromString(DBOptions* source, DBOptions* destination) {
       "use_adaptive_mutex=true;"
       "max_total_wal_size=4295005604;"
       "compaction_readahead_size=0;"
+      "use_direct_io_for_flush_and_compaction=false;"
+      "use_direct_reads_for_compaction_inputs=false;"
       "new_table_reader_for_compaction_inputs=true;"
       "keep_log_file_num=4890;"
       "skip_stats_update_on_db_open=true;"
@@ -1657,6 +1670,7 @@ Status GetFromString(DBOptions* source, DBOptions* destination) {
       "error_if_exists=true;"
       "allow_os_buffer=true;"
       "delayed_write_rate=4294976214;"
+      "proportional_write_delay=true;"
       "manifest_preallocation_size=1222;"
       "allow_mmap_writes=true;"
       "stats_dump_period_sec=70127;"
@@ -1742,7 +1756,9 @@ Status GetFromString(ColumnFamilyOptions* source, ColumnFamilyOptions* destinati
       "filter_deletes=false;"
       "hard_pending_compaction_bytes_limit=0;"
       "disable_auto_compactions=false;"
-      "compaction_measure_io_stats=true;";
+      "compaction_measure_io_stats=true;"
+      "min_blob_size=7261;"
+      "blob_garbage_collection_ratio=0.25;";
 
   RETURN_NOT_OK(GetColumnFamilyOptionsFromString(*source, kOptionsString, destination));
 
@@ -1911,6 +1927,7 @@ TEST_F(OptionsParserTest, DBOptionsAllFieldsSettable) {
       BLACKLIST_ENTRY(DBOptions, wal_filter),
       BLACKLIST_ENTRY(DBOptions, boundary_extractor),
       BLACKLIST_ENTRY(DBOptions, compaction_context_factory),
+      BLACKLIST_ENTRY(DBOptions, subcompaction_boundary_extractor),
       BLACKLIST_ENTRY(DBOptions, max_file_size_for_compaction),
       BLACKLIST_ENTRY(DBOptions, mem_table_flush_filter_factory),
       BLACKLIST_ENTRY(DBOptions, log_prefix),
@@ -0,0 +1,283 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <math.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "yb/rocksdb/env.h"
+#include "yb/rocksdb/filter_policy.h"
+#include "yb/rocksdb/util/coding.h"
+
+#include "yb/util/hash_util.h"
+#include "yb/util/slice.h"
+
+namespace rocksdb {
+
+typedef FilterPolicy::FilterType FilterType;
+
+namespace {
+
+// Homogeneous Ribbon filter, see "Ribbon filter: practically smaller than Bloom and Xor" by
+// Peter C. Dillinger and Stefan Walzer.
+//
+// Filter is a solution Z of a linear system over GF(2) with num_slots rows of kNumResultBits bits.
+// Each key is mapped to a start slot s and a 64-bit coefficient vector c with the lowest bit set,
+// the key must satisfy c * Z[s..s+63] == 0 for each of result bits. Query checks the same equation
+// and random key satisfies it with probability about 2^-num_result_bits. Since right hand side is
+// always zero, the system is always solvable, so adding a key never fails, the false positive rate
+// just grows quickly when number of keys approaches number of slots.
+//
+// Solution is stored in interleaved column-major layout: for each 64 slots num_result_bits
+// 64-bit words, j-th word contains j-th result bit of each slot. So query reads at most
+// 2 * num_result_bits consecutive words and needs a parity of AND per result bit.
+//
+// Serialized format:
+// +-------------------------------------------------------------------------------+
+// | solution: num_blocks * num_result_bits fixed 64-bit words                     |
+// +-------------------------------------------------------------------------------+
+// | num_result_bits : 1 byte | num_blocks : 4 bytes                               |
+// +-------------------------------------------------------------------------------+
+// Size of metadata is the same as for bloom filter. Filter without keys has zero blocks and does
+// not match any key.
+constexpr size_t kSlotsPerBlock = 64;
+constexpr size_t kMetaDataSize = 5;
+constexpr uint64_t kHashSeed = 0x4b1d3d1e4f0de7edULL;
+
+// Fraction of slots that could be used by keys. The false positive rate stays close to
+// 2^-num_result_bits up to ~95% load and grows exponentially after that.
+constexpr double kMaxLoadFactor = 0.94;
+
+inline uint64_t Remix(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+inline uint64_t RibbonHash(const Slice& key) {
+  return yb::HashUtil::MurmurHash2_64(key.data(), key.size(), kHashSeed);
+}
+
+// Maps key hash to start slot in [0, num_slots - kSlotsPerBlock] and coefficients.
+inline void GetStartAndCoefficients(
+    uint64_t hash, size_t num_slots, size_t* start, uint64_t* coefficients) {
+  *start = static_cast<size_t>(
+      (static_cast<unsigned __int128>(hash) * (num_slots - kSlotsPerBlock + 1)) >> 64);
+  *coefficients = Remix(hash) | 1;
+}
+
+inline size_t NumResultBits(double error_rate) {
+  auto result = static_cast<size_t>(ceil(-log2(error_rate)));
+  return std::clamp<size_t>(result, 1, 32);
+}
+
+class FixedSizeRibbonFilterBitsBuilder : public FilterBitsBuilder {
+ public:
+  FixedSizeRibbonFilterBitsBuilder(const FixedSizeRibbonFilterBitsBuilder&) = delete;
+  void operator=(const FixedSizeRibbonFilterBitsBuilder&) = delete;
+
+  FixedSizeRibbonFilterBitsBuilder(size_t total_bits, double error_rate)
+      : num_result_bits_(NumResultBits(error_rate)),
+        num_blocks_(std::max<size_t>(total_bits / (kSlotsPerBlock * num_result_bits_), 1)),
+        max_keys_(static_cast<size_t>(num_slots() * kMaxLoadFactor)) {
+    DCHECK_GT(error_rate, 0);
+    DCHECK_GT(total_bits, 0);
+  }
+
+  void AddKey(const Slice& key) override {
+    if (coefficients_.empty()) {
+      coefficients_.resize(num_slots());
+    }
+    ++keys_added_;
+    size_t start;
+    uint64_t coefficients;
+    GetStartAndCoefficients(RibbonHash(key), num_slots(), &start, &coefficients);
+    // On the fly Gaussian elimination, keeps row with lowest bit at slot i in coefficients_[i].
+    for (;;) {
+      auto& row = coefficients_[start];
+      if (row == 0) {
+        row = coefficients;
+        return;
+      }
+      coefficients ^= row;
+      if (coefficients == 0) {
+        // Linearly dependent with already added keys, for instance duplicate.
+        return;
+      }
+      auto shift = __builtin_ctzll(coefficients);
+      start += shift;
+      coefficients >>= shift;
+    }
+  }
+
+  bool IsFull() const override { return keys_added_ >= max_keys_; }
+
+  Slice Finish(std::unique_ptr<const char[]>* buf) override {
+    const size_t num_blocks = keys_added_ ? num_blocks_ : 0;
+    const size_t num_words = num_blocks * num_result_bits_;
+    const size_t size = num_words * sizeof(uint64_t) + kMetaDataSize;
+    auto* data = new char[size];
+    buf->reset(data);
+
+    std::vector<uint64_t> solution(num_words);
+    // state[j] keeps j-th result bit of slots i+1..i+64 at bits 0..63.
+    std::vector<uint64_t> state(num_result_bits_);
+    for (size_t i = num_blocks * kSlotsPerBlock; i-- > 0;) {
+      const auto row = coefficients_[i];
+      // Free variables are filled with pseudo random bits, so keys that are not in the filter
+      // match it with the expected probability.
+      const auto free_bits = row ? 0 : Remix(i + kHashSeed);
+      auto* words = solution.data() + (i / kSlotsPerBlock) * num_result_bits_;
+      for (size_t j = 0; j != num_result_bits_; ++j) {
+        uint64_t bit = row ? __builtin_parityll((row >> 1) & state[j]) : (free_bits >> j) & 1;
+        state[j] = (state[j] << 1) | bit;
+        words[j] |= bit << (i % kSlotsPerBlock);
+      }
+    }
+
+    for (size_t i = 0; i != num_words; ++i) {
+      EncodeFixed64(data + i * sizeof(uint64_t), solution[i]);
+    }
+    data[num_words * sizeof(uint64_t)] = static_cast<char>(num_result_bits_);
+    EncodeFixed32(data + num_words * sizeof(uint64_t) + 1, static_cast<uint32_t>(num_blocks));
+
+    coefficients_.clear();
+    keys_added_ = 0;
+    return Slice(data, size);
+  }
+
+ private:
+  size_t num_slots() const {
+    return num_blocks_ * kSlotsPerBlock;
+  }
+
+  const size_t num_result_bits_;
+  const size_t num_blocks_;
+  const size_t max_keys_;
+  size_t keys_added_ = 0;
+  std::vector<uint64_t> coefficients_;
+};
+
+class FixedSizeRibbonFilterBitsReader : public FilterBitsReader {
+ public:
+  FixedSizeRibbonFilterBitsReader(const FixedSizeRibbonFilterBitsReader&) = delete;
+  void operator=(const FixedSizeRibbonFilterBitsReader&) = delete;
+
+  FixedSizeRibbonFilterBitsReader(const Slice& contents, Logger* logger)
+      : data_(contents.cdata()) {
+    if (contents.size() < kMetaDataSize) {
+      RLOG(InfoLogLevel::ERROR_LEVEL, logger, "Ribbon filter data is broken, won't be used.");
+      FAIL_IF_NOT_PRODUCTION();
+      broken_ = true;
+      return;
+    }
+    const auto* meta = contents.cend() - kMetaDataSize;
+    num_result_bits_ = static_cast<uint8_t>(meta[0]);
+    num_blocks_ = DecodeFixed32(meta + 1);
+    if (num_result_bits_ == 0 ||
+        contents.size() !=
+            num_blocks_ * num_result_bits_ * sizeof(uint64_t) + kMetaDataSize) {
+      RLOG(InfoLogLevel::ERROR_LEVEL, logger, "Ribbon filter data is broken, won't be used.");
+      FAIL_IF_NOT_PRODUCTION();
+      broken_ = true;
+    }
+  }
+
+  bool MayMatch(const Slice& entry) override {
+    // Broken filter is regarded as match.
+    if (broken_) {
+      return true;
+    }
+    if (num_blocks_ == 0) {
+      return false;
+    }
+    size_t start;
+    uint64_t coefficients;
+    GetStartAndCoefficients(
+        RibbonHash(entry), num_blocks_ * kSlotsPerBlock, &start, &coefficients);
+    const size_t shift = start % kSlotsPerBlock;
+    const char* words = data_ + (start / kSlotsPerBlock) * num_result_bits_ * sizeof(uint64_t);
+    const char* next_words = words + num_result_bits_ * sizeof(uint64_t);
+    for (size_t j = 0; j != num_result_bits_; ++j) {
+      uint64_t value = DecodeFixed64(words + j * sizeof(uint64_t)) >> shift;
+      // Start slot could be in the last block only when shift is 0.
+      if (shift) {
+        value |= DecodeFixed64(next_words + j * sizeof(uint64_t)) << (kSlotsPerBlock - shift);
+      }
+      if (__builtin_parityll(value & coefficients)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  const char* data_;
+  size_t num_result_bits_ = 0;
+  size_t num_blocks_ = 0;
+  bool broken_ = false;
+};
+
+class FixedSizeRibbonFilterPolicy : public FilterPolicy {
+ public:
+  FixedSizeRibbonFilterPolicy(size_t total_bits, double error_rate, Logger* logger)
+      : total_bits_(total_bits),
+        error_rate_(error_rate),
+        logger_(logger) {
+    DCHECK_GT(error_rate, 0);
+  }
+
+  FilterType GetFilterType() const override { return FilterType::kFixedSizeFilter; }
+
+  const char* Name() const override {
+    return "rocksdb.FixedSizeRibbonFilter";
+  }
+
+  // Not used in FixedSizeFilter. GetFilterBitsBuilder/Reader interface should be used.
+  void CreateFilter(const Slice* keys, int n, std::string* dst) const override {
+    assert(!"FixedSizeRibbonFilterPolicy::CreateFilter is not supported");
+  }
+
+  bool KeyMayMatch(const Slice& key, const Slice& filter) const override {
+    assert(!"FixedSizeRibbonFilterPolicy::KeyMayMatch is not supported");
+    return true;
+  }
+
+  FilterBitsBuilder* GetFilterBitsBuilder() const override {
+    return new FixedSizeRibbonFilterBitsBuilder(total_bits_, error_rate_);
+  }
+
+  FilterBitsReader* GetFilterBitsReader(const Slice& contents) const override {
+    return new FixedSizeRibbonFilterBitsReader(contents, logger_);
+  }
+
+ private:
+  size_t total_bits_;
+  double error_rate_;
+  Logger* logger_;
+};
+
+}  // namespace
+
+const FilterPolicy* NewFixedSizeRibbonFilterPolicy(size_t total_bits,
+                                                   double error_rate,
+                                                   Logger* logger) {
+  return new FixedSizeRibbonFilterPolicy(total_bits, error_rate, logger);
+}
+
+}  // namespace rocksdb
@@ -103,6 +103,8 @@ struct RocksDBTaskStateMetrics {
         FALLTHROUGH_INTENDED;
       case CompactionReason::kUniversalDirectDeletion:
         FALLTHROUGH_INTENDED;
+      case CompactionReason::kLevelDirectDeletion:
+        FALLTHROUGH_INTENDED;
       case CompactionReason::kFIFOMaxSize:
         FALLTHROUGH_INTENDED;
       case CompactionReason::kFilesMarkedForCompaction:
@@ -107,17 +107,17 @@ Status CreateCheckpoint(DB* db, const std::string& checkpoint_dir) {
       s = STATUS(Corruption, "Can't parse file name. This is very bad");
       break;
     }
-    // we should only get sst, manifest and current files here
-    assert(type == kTableFile || type == kTableSBlockFile || type == kDescriptorFile ||
-           type == kCurrentFile);
+    // we should only get sst, blob, manifest and current files here
+    assert(type == kTableFile || type == kTableSBlockFile || type == kBlobFile ||
+           type == kDescriptorFile || type == kCurrentFile);
     assert(live_files[i].size() > 0 && live_files[i][0] == '/');
     std::string src_fname = live_files[i];
 
     // rules:
-    // * if it's kTableFile or kTableSBlockFile, then it's shared
+    // * if it's kTableFile, kTableSBlockFile or kBlobFile, then it's shared
     // * if it's kDescriptorFile, limit the size to manifest_file_size
     // * always copy if cross-device link
-    bool is_table_file = type == kTableFile || type == kTableSBlockFile;
+    bool is_table_file = type == kTableFile || type == kTableSBlockFile || type == kBlobFile;
     if (is_table_file && same_fs) {
       RLOG(db->GetOptions().info_log, "Hard Linking %s", src_fname.c_str());
       s = db->GetCheckpointEnv()->LinkFile(db->GetName() + src_fname,
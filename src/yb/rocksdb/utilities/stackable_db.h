@@ -80,6 +80,13 @@ class StackableDB : public DB {
     return db_->MultiGet(options, column_family, keys, values);
   }
 
+  using DB::PrefetchKeys;
+  virtual Status PrefetchKeys(const ReadOptions& options,
+                              ColumnFamilyHandle* column_family,
+                              const std::vector<Slice>& keys) override {
+    return db_->PrefetchKeys(options, column_family, keys);
+  }
+
   using DB::AddFile;
   virtual Status AddFile(ColumnFamilyHandle* column_family,
                          const ExternalSstFileInfo* file_info,
@@ -277,6 +284,14 @@ class StackableDB : public DB {
     return db_->GetFlushedFrontier();
   }
 
+  yb::Result<size_t> ScheduleFilteredFilesDeletion() override {
+    return db_->ScheduleFilteredFilesDeletion();
+  }
+
+  double GetWriteStallPressure() override {
+    return db_->GetWriteStallPressure();
+  }
+
   Status ModifyFlushedFrontier(
       UserFrontierPtr values,
       FrontierModificationMode mode) override {
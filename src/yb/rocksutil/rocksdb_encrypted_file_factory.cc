@@ -55,8 +55,8 @@ class EncryptedSequentialFile : public SequentialFileWrapper {
     if (!scratch) {
       return STATUS(InvalidArgument, "scratch argument is null.");
     }
-    uint8_t* buf = static_cast<uint8_t*>(encryption::EncryptionBuffer::Get()->GetBuffer(n));
-    RETURN_NOT_OK(SequentialFileWrapper::Read(n, result, buf));
+    // Decrypt in place, CTR mode allows input and output to be the same buffer.
+    RETURN_NOT_OK(SequentialFileWrapper::Read(n, result, scratch));
     RETURN_NOT_OK(stream_->Decrypt(offset_, *result, scratch));
     *result = Slice(scratch, result->size());
     offset_ += result->size();
@@ -39,6 +39,17 @@ using namespace std::literals;
 DEFINE_UNKNOWN_int32(stream_compression_algo, 0, "Algorithm used for stream compression. "
                                          "0 - no compression, 1 - gzip, 2 - snappy, 3 - lz4.");
 
+DEFINE_RUNTIME_uint64(stream_compression_min_message_bytes, 0,
+    "Messages smaller than this are sent without being compressed on LZ4 compressed streams. "
+    "Such messages are still framed as LZ4 blocks, so peers decode them as usual.");
+TAG_FLAG(stream_compression_min_message_bytes, advanced);
+
+DEFINE_RUNTIME_double(stream_compression_max_ratio, 1.0,
+    "When a chunk of a message sent over an LZ4 compressed stream does not compress below this "
+    "ratio, the rest of the message is sent without being compressed, since it is likely already "
+    "compressed data. Set to a large value to always compress.");
+TAG_FLAG(stream_compression_max_ratio, advanced);
+
 namespace yb {
 namespace rpc {
 
@@ -664,6 +675,26 @@ class LZ4DecompressState {
   size_t total_consumed_ = 0;
 };
 
+// Encodes input as an LZ4 block that consists of literals only, without trying to find matches.
+// Returns size of the block written to out, that should have space for LZ4_compressBound bytes.
+size_t EncodeLZ4Literals(Slice input, char* out) {
+  constexpr size_t kMaxTokenLength = 15;
+  auto* pos = out;
+  auto length = input.size();
+  if (length < kMaxTokenLength) {
+    *pos++ = static_cast<char>(length << 4);
+  } else {
+    *pos++ = static_cast<char>(kMaxTokenLength << 4);
+    length -= kMaxTokenLength;
+    for (; length >= 255; length -= 255) {
+      *pos++ = static_cast<char>(255);
+    }
+    *pos++ = static_cast<char>(length);
+  }
+  memcpy(pos, input.cdata(), input.size());
+  return pos + input.size() - out;
+}
+
 class LZ4Compressor : public Compressor {
  public:
   static constexpr char kId = 'L';
@@ -695,6 +726,14 @@ class LZ4Compressor : public Compressor {
     VLOG_WITH_FUNC(4) << "input: " << CollectionToString(input, [](const auto& buf) {
       return buf.size();
     });
+    // Small messages are not worth compressing, and already compressed data does not shrink, so
+    // such data is sent as literals.
+    size_t input_size = 0;
+    for (const auto& buf : input) {
+      input_size += buf.size();
+    }
+    bool send_literals = input_size < FLAGS_stream_compression_min_message_bytes;
+    const auto max_ratio = FLAGS_stream_compression_max_ratio;
     for (auto input_it = input.begin(); input_it != input.end();) {
       Slice input_slice = input_it->AsSlice();
       ++input_it;
@@ -709,10 +748,16 @@ class LZ4Compressor : public Compressor {
         VLOG_WITH_FUNC(4) << "chunk: " << chunk.size();
         input_slice.remove_prefix(chunk.size());
         RefCntBuffer output(kHeaderLen + LZ4_compressBound(narrow_cast<int>(chunk.size())));
-        int res = LZ4_compress(
-            chunk.cdata(), output.data() + kHeaderLen, narrow_cast<int>(chunk.size()));
-        if (res <= 0) {
-          return STATUS_FORMAT(RuntimeError, "LZ4 compression failed: $0", res);
+        int res;
+        if (send_literals) {
+          res = narrow_cast<int>(EncodeLZ4Literals(chunk, output.data() + kHeaderLen));
+        } else {
+          res = LZ4_compress(
+              chunk.cdata(), output.data() + kHeaderLen, narrow_cast<int>(chunk.size()));
+          if (res <= 0) {
+            return STATUS_FORMAT(RuntimeError, "LZ4 compression failed: $0", res);
+          }
+          send_literals = res > max_ratio * chunk.size();
         }
         BigEndian::Store16(output.data(), res);
         output.Shrink(kHeaderLen + res);
@@ -551,13 +551,31 @@ Status Connection::DumpPB(const DumpRunningRpcsRequestPB& req,
       stream_->DumpPB(req, resp);
       return Status::OK();
     }
-    case Direction::SERVER:
+    case Direction::SERVER: {
+      auto calls = inbound_calls_transferred_.load(std::memory_order_relaxed);
+      if (calls) {
+        auto* timing = resp->mutable_inbound_calls_timing();
+        timing->set_calls(calls);
+        timing->set_queue_time_us(inbound_queue_time_us_.load(std::memory_order_relaxed));
+        timing->set_handler_time_us(inbound_handler_time_us_.load(std::memory_order_relaxed));
+        timing->set_response_send_time_us(
+            inbound_response_send_time_us_.load(std::memory_order_relaxed));
+      }
       return Status::OK();
+    }
   }
 
   FATAL_INVALID_ENUM_VALUE(Direction, direction_);
 }
 
+void Connection::InboundCallTransferred(
+    MonoDelta queue_time, MonoDelta handler_time, MonoDelta send_time) {
+  inbound_calls_transferred_.fetch_add(1, std::memory_order_relaxed);
+  inbound_queue_time_us_.fetch_add(queue_time.ToMicroseconds(), std::memory_order_relaxed);
+  inbound_handler_time_us_.fetch_add(handler_time.ToMicroseconds(), std::memory_order_relaxed);
+  inbound_response_send_time_us_.fetch_add(send_time.ToMicroseconds(), std::memory_order_relaxed);
+}
+
 void Connection::QueueOutboundDataBatch(const OutboundDataBatch& batch) {
   for (const auto& call : batch) {
     // If one of these calls fails and shuts down the connection, all calls after that will fail
@@ -180,6 +180,10 @@ class Connection final : public StreamContext, public std::enable_shared_from_th
 
   Status DumpPB(const DumpRunningRpcsRequestPB& req, RpcConnectionPB* resp) ON_REACTOR_THREAD;
 
+  // Accumulates timing of an inbound call whose response was sent over this connection, so rpcz
+  // could show where calls from this peer spend their time.
+  void InboundCallTransferred(MonoDelta queue_time, MonoDelta handler_time, MonoDelta send_time);
+
   // Do appropriate actions after adding outbound call. If the connection is shutting down,
   // returns the connection's shutdown status.
   Status OutboundQueued() ON_REACTOR_THREAD EXCLUDES(outbound_data_queue_mtx_);
@@ -342,6 +346,12 @@ class Connection final : public StreamContext, public std::enable_shared_from_th
   // ----------------------------------------------------------------------------------------------
 
   std::atomic<uint64_t> responded_call_count_{0};
+
+  // Total timing of inbound calls responded over this connection, see InboundCallTransferred.
+  std::atomic<uint64_t> inbound_calls_transferred_{0};
+  std::atomic<uint64_t> inbound_queue_time_us_{0};
+  std::atomic<uint64_t> inbound_handler_time_us_{0};
+  std::atomic<uint64_t> inbound_response_send_time_us_{0};
   std::atomic<size_t> active_calls_during_shutdown_{0};
   std::atomic<size_t> calls_queued_after_shutdown_{0};
   std::atomic<size_t> responses_queued_after_shutdown_{0};
@@ -94,6 +94,7 @@ InboundCall::~InboundCall() {
 void InboundCall::NotifyTransferred(const Status& status, const ConnectionPtr& conn) {
   if (status.ok()) {
     TRACE_TO(trace(), "Transfer finished");
+    RecordTransferred(conn);
   } else {
     YB_LOG_EVERY_N_SECS(WARNING, 10) << LogPrefix() << "Connection torn down before " << ToString()
                                      << " could send its response: " << status.ToString();
@@ -103,6 +104,20 @@ void InboundCall::NotifyTransferred(const Status& status, const ConnectionPtr& c
   }
 }
 
+void InboundCall::RecordTransferred(const ConnectionPtr& conn) {
+  if (!timing_.time_completed.Initialized()) {
+    return;
+  }
+  auto send_time = MonoTime::Now() - timing_.time_completed;
+  if (conn && timing_.time_handled.Initialized()) {
+    conn->InboundCallTransferred(
+        GetTimeInQueue(), timing_.time_completed - timing_.time_handled, send_time);
+  }
+  if (rpc_method_response_send_time_) {
+    rpc_method_response_send_time_->Increment(send_time.ToMicroseconds());
+  }
+}
+
 void InboundCall::EnsureTraceCreated() {
   scoped_refptr<Trace> trace = nullptr;
   {
@@ -259,6 +274,10 @@ void InboundCall::SetRpcMethodMetrics(std::reference_wrapper<const RpcMethodMetr
   const auto& metrics = value.get();
   rpc_method_response_bytes_ = metrics.response_bytes;
   rpc_method_handler_latency_ = metrics.handler_latency;
+  rpc_method_response_send_time_ = metrics.response_send_time;
+  if (metrics.queue_time && timing_.time_handled.Initialized()) {
+    metrics.queue_time->Increment(GetTimeInQueue().ToMicroseconds());
+  }
   if (metrics.request_bytes) {
     auto request_size = request_data_.size();
     if (request_size) {
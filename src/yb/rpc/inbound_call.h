@@ -58,6 +58,7 @@
 #include "yb/util/monotime.h"
 #include "yb/util/net/net_fwd.h"
 #include "yb/util/ref_cnt_buffer.h"
+#include "yb/util/size_class_pool.h"
 #include "yb/util/slice.h"
 #include "yb/util/status_fwd.h"
 
@@ -96,7 +97,9 @@ class InboundCallHandler {
 };
 
 // Inbound call on server
-class InboundCall : public RpcCall, public MPSCQueueEntry<InboundCall> {
+class InboundCall : public RpcCall,
+                    public MPSCQueueEntry<InboundCall>,
+                    public SizeClassPooled {
  public:
   class CallProcessedListener {
    public:
@@ -254,11 +257,15 @@ class InboundCall : public RpcCall, public MPSCQueueEntry<InboundCall> {
 
   scoped_refptr<Counter> rpc_method_response_bytes_;
   scoped_refptr<Histogram> rpc_method_handler_latency_;
+  scoped_refptr<Histogram> rpc_method_response_send_time_;
 
   mutable simple_spinlock mutex_;
   bool cleared_ GUARDED_BY(mutex_) = false;
 
  private:
+  // Records timing of the call after its response was written to the connection.
+  void RecordTransferred(const ConnectionPtr& conn);
+
   // The trace buffer.
   scoped_refptr<Trace> trace_holder_ GUARDED_BY(mutex_);
   std::atomic<Trace*> trace_ = nullptr;
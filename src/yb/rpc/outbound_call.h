@@ -72,6 +72,7 @@
 #include "yb/util/object_pool.h"
 #include "yb/util/ref_cnt_buffer.h"
 #include "yb/util/shared_lock.h"
+#include "yb/util/size_class_pool.h"
 #include "yb/util/slice.h"
 #include "yb/util/status_fwd.h"
 #include "yb/util/trace.h"
@@ -267,7 +268,7 @@ YB_DEFINE_ENUM(ActiveCallState,
 // then passed to the reactor thread to send on the wire. It's typically
 // kept using a shared_ptr because a call may terminate in any number
 // of different threads, making it tricky to enforce single ownership.
-class OutboundCall : public RpcCall {
+class OutboundCall : public RpcCall, public SizeClassPooled {
  public:
   OutboundCall(const RemoteMethod& remote_method,
                const std::shared_ptr<OutboundCallMetrics>& outbound_call_metrics,
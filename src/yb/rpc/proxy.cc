@@ -34,12 +34,16 @@
 
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <sstream>
+#include <unordered_set>
 #include <vector>
 
 #include "yb/util/logging.h"
 
+#include "yb/gutil/strings/split.h"
+
 #include "yb/rpc/local_call.h"
 #include "yb/rpc/lightweight_message.h"
 #include "yb/rpc/proxy_context.h"
@@ -55,6 +59,7 @@
 #include "yb/util/net/sockaddr.h"
 #include "yb/util/net/socket.h"
 #include "yb/util/result.h"
+#include "yb/util/size_class_pool.h"
 #include "yb/util/status.h"
 #include "yb/util/flags.h"
 
@@ -64,6 +69,17 @@ DEFINE_UNKNOWN_int32(num_connections_to_server, 8,
 DEFINE_UNKNOWN_int32(proxy_resolve_cache_ms, 5000,
              "Time in milliseconds to cache resolution result in Proxy");
 
+DEFINE_NON_RUNTIME_bool(rpc_proxy_least_loaded_connection, false,
+    "Send each outbound call over the connection to the server that has the fewest calls in "
+    "flight from this proxy, instead of picking connections round robin.");
+TAG_FLAG(rpc_proxy_least_loaded_connection, advanced);
+
+DEFINE_NON_RUNTIME_string(rpc_bulk_transfer_services, "yb.tserver.RemoteBootstrapService",
+    "Comma separated list of services whose calls transfer large payloads. Calls to those "
+    "services use a separate set of connections to the server, so they do not delay other calls "
+    "sent over the same socket.");
+TAG_FLAG(rpc_bulk_transfer_services, advanced);
+
 using namespace std::literals;
 
 using std::string;
@@ -72,6 +88,22 @@ using std::shared_ptr;
 namespace yb {
 namespace rpc {
 
+namespace {
+
+bool IsBulkTransferService(const std::string& service_name) {
+  static const std::unordered_set<std::string> services = [] {
+    std::unordered_set<std::string> result;
+    for (const auto& service : strings::Split(
+             FLAGS_rpc_bulk_transfer_services, ",", strings::SkipEmpty())) {
+      result.emplace(service);
+    }
+    return result;
+  }();
+  return !services.empty() && services.count(service_name);
+}
+
+} // namespace
+
 Proxy::Proxy(ProxyContext* context,
              const HostPort& remote,
              const Protocol* protocol,
@@ -89,7 +121,8 @@ Proxy::Proxy(ProxyContext* context,
       latency_stats_(ScopedDnsTracker::active_metric()),
       // Use the context->num_connections_to_server() here as opposed to directly reading the
       // FLAGS_num_connections_to_server, because the flag value could have changed since then.
-      num_connections_to_server_(context_->num_connections_to_server()) {
+      num_connections_to_server_(context_->num_connections_to_server()),
+      in_flight_calls_(std::make_shared<InFlightCalls>(num_connections_to_server_ * 2)) {
   VLOG(1) << "Create proxy to " << remote << " with num_connections_to_server="
           << num_connections_to_server_;
   if (context_->parent_mem_tracker()) {
@@ -181,9 +214,9 @@ void Proxy::AsyncLocalCall(
     const RemoteMethod* method, AnyMessageConstPtr req, AnyMessagePtr resp,
     RpcController* controller, ResponseCallback callback,
     const bool force_run_callback_on_reactor) {
-  controller->call_ = std::make_shared<LocalOutboundCall>(
-      *method, outbound_call_metrics_, resp, controller, context_->rpc_metrics(),
-      std::move(callback),
+  controller->call_ = std::allocate_shared<LocalOutboundCall>(
+      SizeClassAllocator<LocalOutboundCall>(), *method, outbound_call_metrics_, resp, controller,
+      context_->rpc_metrics(), std::move(callback),
       GetCallbackThreadPool(force_run_callback_on_reactor, controller->invoke_callback_mode()));
   if (!PrepareCall(req, controller)) {
     return;
@@ -211,6 +244,18 @@ void Proxy::AsyncRemoteCall(
     const RemoteMethod* method, std::shared_ptr<const OutboundMethodMetrics> method_metrics,
     AnyMessageConstPtr req, AnyMessagePtr resp, RpcController* controller,
     ResponseCallback callback, const bool force_run_callback_on_reactor) {
+  if (FLAGS_rpc_proxy_least_loaded_connection) {
+    // Track calls in flight per connection. Calls that failed before being queued do not have
+    // a connection assigned.
+    callback = [in_flight_calls = in_flight_calls_, controller,
+                callback = std::move(callback)]() {
+      const auto& conn_id = controller->call_->conn_id();
+      if (!conn_id.remote().address().is_unspecified()) {
+        (*in_flight_calls)[conn_id.idx()].fetch_sub(1, std::memory_order_acq_rel);
+      }
+      callback();
+    };
+  }
   // Do not use make_shared to allow for long-lived weak OutboundCall pointers without wasting
   // memory.
   controller->call_ = std::shared_ptr<OutboundCall>(new OutboundCall(
@@ -328,12 +373,37 @@ void Proxy::ResolveDone(const Result<IpAddress>& result) {
 }
 
 void Proxy::QueueCall(RpcController* controller, const Endpoint& endpoint) {
-  uint8_t idx = num_calls_.fetch_add(1) % num_connections_to_server_;
+  size_t idx = num_calls_.fetch_add(1) % num_connections_to_server_;
+  // Bulk transfers use connections with indexes after the regular ones.
+  if (IsBulkTransferService(controller->call_->remote_method().service_name())) {
+    idx += num_connections_to_server_;
+  }
+  if (FLAGS_rpc_proxy_least_loaded_connection) {
+    idx = LeastLoadedConnection(idx);
+    (*in_flight_calls_)[idx].fetch_add(1, std::memory_order_acq_rel);
+  }
   ConnectionId conn_id(endpoint, idx, protocol_);
   controller->call_->SetConnectionId(conn_id, &remote_.host());
   context_->QueueOutboundCall(controller->call_);
 }
 
+size_t Proxy::LeastLoadedConnection(size_t start_idx) const {
+  // Start from the round robin choice, so connections with equal load are used evenly.
+  const size_t num_connections = num_connections_to_server_;
+  const auto base = start_idx - start_idx % num_connections;
+  auto result = start_idx;
+  auto min_calls = std::numeric_limits<int64_t>::max();
+  for (size_t i = 0; i != num_connections; ++i) {
+    auto idx = base + (start_idx + i) % num_connections;
+    auto calls = (*in_flight_calls_)[idx].load(std::memory_order_acquire);
+    if (calls < min_calls) {
+      min_calls = calls;
+      result = idx;
+    }
+  }
+  return result;
+}
+
 void Proxy::NotifyFailed(RpcController* controller, const Status& status) {
   // We should retain reference to call, so it would not be destroyed during SetFailed.
   auto call = controller->call_;
@@ -36,6 +36,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/lockfree/queue.hpp>
@@ -191,6 +192,10 @@ class Proxy {
 
   bool PrepareCall(AnyMessageConstPtr req, RpcController* controller);
 
+  // Returns index of the connection with the fewest calls in flight, among the regular or the
+  // bulk transfer connections, depending on which of them start_idx belongs to.
+  size_t LeastLoadedConnection(size_t start_idx) const;
+
   ProxyContext* context_;
   HostPort remote_;
   const Protocol* const protocol_;
@@ -205,8 +210,14 @@ class Proxy {
   scoped_refptr<EventStats> latency_stats_;
 
   // Number of outbound connections to create per each destination server address.
+  // The same number of additional connections is used for bulk transfers.
   int num_connections_to_server_;
 
+  // Number of calls in flight per connection index, when rpc_proxy_least_loaded_connection is
+  // set. Shared with call callbacks, since they could be invoked after the proxy is destroyed.
+  using InFlightCalls = std::vector<std::atomic<int64_t>>;
+  std::shared_ptr<InFlightCalls> in_flight_calls_;
+
   std::shared_ptr<MemTracker> mem_tracker_;
 };
 
@@ -70,6 +70,7 @@
 #include "yb/util/metrics.h"
 #include "yb/util/monotime.h"
 #include "yb/util/net/socket.h"
+#include "yb/util/numa_util.h"
 #include "yb/util/scope_exit.h"
 #include "yb/util/size_literals.h"
 #include "yb/util/status_format.h"
@@ -108,6 +109,13 @@ DEFINE_RUNTIME_int32(reactor_based_outbound_call_expiration_delay_ms, 1000,
     "disabled if this flag is set to 0.");
 TAG_FLAG(reactor_based_outbound_call_expiration_delay_ms, advanced);
 
+DEFINE_NON_RUNTIME_bool(rpc_numa_pin_threads, false,
+    "Pin reactor threads and RPC thread pool workers to NUMA nodes in round robin order, so "
+    "memory they allocate is local to their node. Has no effect on machines with a single NUMA "
+    "node. Setting rpc_thread_pool_task_queue_shards to the number of NUMA nodes makes workers "
+    "of the same node share a task queue.");
+TAG_FLAG(rpc_numa_pin_threads, advanced);
+
 namespace yb {
 namespace rpc {
 
@@ -248,6 +256,7 @@ Reactor::Reactor(Messenger* messenger,
                  int index,
                  const MessengerBuilder &bld)
     : messenger_(*messenger),
+      index_(index),
       name_(StringPrintf("%s_R%03d", messenger->name().c_str(), index)),
       log_prefix_(name_ + ": "),
       loop_(kDefaultLibEvFlags),
@@ -258,7 +267,8 @@ Reactor::Reactor(Messenger* messenger,
                                  SOURCE_LOCATION())),
       num_connections_to_server_(bld.num_connections_to_server()),
       completed_call_queue_(std::make_shared<CompletedCallQueue>()),
-      cur_time_(CoarseMonoClock::Now()) {
+      cur_time_(CoarseMonoClock::Now()),
+      tracked_outbound_calls_(coarse_timer_granularity_, cur_time_.load()) {
   static std::once_flag libev_once;
   std::call_once(libev_once, DoInitLibEv);
 
@@ -562,13 +572,11 @@ ConnectionPtr Reactor::AssignOutboundCall(const OutboundCallPtr& call) {
 
   if (ShouldTrackOutboundCalls()) {
     auto expires_at = call->expires_at();
-    tracked_outbound_calls_.insert(TrackedOutboundCall {
-      .call_id = call->call_id(),
-      .call_weak = call,
-      .next_check_time = expires_at == CoarseTimePoint::max()
-          ? call->start_time() + FLAGS_stuck_outbound_call_default_timeout_sec * 1s
-          : expires_at + FLAGS_reactor_based_outbound_call_expiration_delay_ms * 1ms
-    });
+    tracked_outbound_calls_.Schedule(
+        call->call_id(), call,
+        expires_at == CoarseTimePoint::max()
+            ? call->start_time() + FLAGS_stuck_outbound_call_default_timeout_sec * 1s
+            : expires_at + FLAGS_reactor_based_outbound_call_expiration_delay_ms * 1ms);
   }
   return conn;
 }
@@ -649,24 +657,14 @@ void Reactor::ScanForStuckOutboundCalls(CoarseTimePoint now) {
     return;
   }
 
-  auto& index_by_call_id = tracked_outbound_calls_.get<CallIdTag>();
   while (auto call_id_opt = completed_call_queue_->Pop()) {
-    index_by_call_id.erase(*call_id_opt);
+    tracked_outbound_calls_.Erase(*call_id_opt);
   }
 
-  auto& index_by_next_check_time = tracked_outbound_calls_.get<NextCheckTimeTag>();
-  while (!index_by_next_check_time.empty()) {
-    auto& entry = *index_by_next_check_time.begin();
-    // It is useful to check the next entry even if its scheduled next check time is later than
-    // now, to erase entries corresponding to completed calls as soon as possible. This alone,
-    // even without the completed call queue, mostly solves #19090.
-    auto call = entry.call_weak.lock();
+  tracked_outbound_calls_.Advance(now, [this, now](int32_t call_id, OutboundCallWeakPtr call_weak) {
+    auto call = call_weak.lock();
     if (!call || call->callback_invoked()) {
-      index_by_next_check_time.erase(index_by_next_check_time.begin());
-      continue;
-    }
-    if (entry.next_check_time > now) {
-      break;
+      return;
     }
 
     // Normally, timeout should be enforced at the connection level. Here, we will catch failures
@@ -695,10 +693,9 @@ void Reactor::ScanForStuckOutboundCalls(CoarseTimePoint now) {
       }
     }
 
-    index_by_next_check_time.modify(index_by_next_check_time.begin(), [now](auto& tracked_call) {
-      tracked_call.next_check_time = now + FLAGS_stuck_outbound_call_check_interval_sec * 1s;
-    });
-  }
+    tracked_outbound_calls_.Schedule(
+        call_id, std::move(call_weak), now + FLAGS_stuck_outbound_call_check_interval_sec * 1s);
+  });
 
   if (tracked_outbound_calls_.size() >= 1000) {
     YB_LOG_WITH_PREFIX_EVERY_N_SECS(WARNING, 1)
@@ -721,6 +718,9 @@ void Reactor::CheckCurrentThread() const {
 void Reactor::RunThread() {
   ThreadRestrictions::SetWaitAllowed(false);
   ThreadRestrictions::SetIOAllowed(false);
+  if (FLAGS_rpc_numa_pin_threads) {
+    WARN_NOT_OK(PinCurrentThreadToNumaNode(index_), LogPrefix() + "Failed to pin thread");
+  }
   DVLOG_WITH_PREFIX(6) << "Calling Reactor::RunThread()...";
   loop_.run(/* flags */ 0);
   VLOG_WITH_PREFIX(1) << "thread exiting.";
@@ -75,6 +75,7 @@
 #include "yb/util/shared_lock.h"
 #include "yb/util/source_location.h"
 #include "yb/util/status_fwd.h"
+#include "yb/util/timing_wheel.h"
 
 namespace yb {
 namespace rpc {
@@ -295,6 +296,9 @@ class Reactor {
   // parent messenger
   Messenger& messenger_;
 
+  // Index of this reactor in the messenger.
+  const int index_;
+
   const std::string name_;
 
   const std::string log_prefix_;
@@ -402,28 +406,9 @@ class Reactor {
   // called. We add calls to tracked_outbound_calls_ in AssignOutboundCall and remove them as soon
   // as we find out the callback has been invoked.
 
-  struct TrackedOutboundCall {
-    int32_t call_id = 0;
-    OutboundCallWeakPtr call_weak;  // If this cannot be locked, we remove the entry.
-    CoarseTimePoint next_check_time;  // Next time to check the callback status.
-  };
-
-  class CallIdTag;
-  class NextCheckTimeTag;
-  using TrackedOutboundCalls = boost::multi_index_container<
-      TrackedOutboundCall,
-      boost::multi_index::indexed_by<
-          boost::multi_index::hashed_unique<
-              boost::multi_index::tag<CallIdTag>,
-              boost::multi_index::member<TrackedOutboundCall,
-                                         int32_t,
-                                         &TrackedOutboundCall::call_id>>,
-          boost::multi_index::ordered_non_unique<
-              boost::multi_index::tag<NextCheckTimeTag>,
-              boost::multi_index::member<TrackedOutboundCall,
-                                         CoarseTimePoint,
-                                         &TrackedOutboundCall::next_check_time>
-          >>>;
+  // Weak pointers to tracked calls by call id, with the next time to check the callback status.
+  // If the pointer cannot be locked, the entry is removed.
+  using TrackedOutboundCalls = TimingWheel<int32_t, OutboundCallWeakPtr, CoarseMonoClock>;
 
   TrackedOutboundCalls tracked_outbound_calls_ GUARDED_BY_REACTOR_THREAD;
 
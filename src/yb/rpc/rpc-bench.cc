@@ -35,17 +35,47 @@
 
 #include <gtest/gtest.h>
 
+#include "yb/gutil/strings/split.h"
+
+#include "yb/rpc/compressed_stream.h"
 #include "yb/rpc/proxy.h"
 #include "yb/rpc/rpc-test-base.h"
 #include "yb/rpc/rpc_controller.h"
 #include "yb/rpc/rtest.proxy.h"
+#include "yb/rpc/secure_stream.h"
+#include "yb/rpc/tcp_stream.h"
 
 #include "yb/util/countdown_latch.h"
+#include "yb/util/flags.h"
+#include "yb/util/hdr_histogram.h"
 #include "yb/util/net/net_util.h"
+#include "yb/util/random_util.h"
 #include "yb/util/status_log.h"
 #include "yb/util/test_util.h"
 #include "yb/util/thread.h"
 
+DEFINE_NON_RUNTIME_int32(rpc_bench_duration_sec, 10, "Duration of the mixed workload benchmark.");
+DEFINE_NON_RUNTIME_int32(rpc_bench_client_threads, 16,
+    "Number of threads that send calls in the mixed workload benchmark.");
+DEFINE_NON_RUNTIME_int32(rpc_bench_client_messengers, 4,
+    "Number of client messengers in the mixed workload benchmark. Each messenger has its own "
+    "connections to the server.");
+DEFINE_NON_RUNTIME_int32(rpc_bench_client_reactors, 2, "Number of reactors per client messenger.");
+DEFINE_NON_RUNTIME_int32(rpc_bench_connections_to_server, 1,
+    "Number of connections from each client messenger to the server.");
+DEFINE_NON_RUNTIME_int32(rpc_bench_server_reactors, 4, "Number of server reactors.");
+DEFINE_NON_RUNTIME_int32(rpc_bench_server_workers, 8, "Number of server worker threads.");
+DEFINE_NON_RUNTIME_string(rpc_bench_payload_sizes, "64,1024,16384,262144",
+    "Comma separated list of payload sizes, each call picks one of them at random.");
+DEFINE_NON_RUNTIME_uint64(rpc_bench_sidecar_min_bytes, 4096,
+    "Payloads of at least this size are sent as sidecars, smaller ones are sent in the request.");
+DEFINE_NON_RUNTIME_bool(rpc_bench_tls, false, "Use TLS in the mixed workload benchmark.");
+DEFINE_NON_RUNTIME_int32(rpc_bench_compression, 0,
+    "Stream compression algorithm used in the mixed workload benchmark, see "
+    "stream_compression_algo. 0 - no compression.");
+
+DECLARE_int32(stream_compression_algo);
+
 using namespace std::literals; // NOLINT
 
 using std::string;
@@ -155,5 +185,134 @@ TEST_F(RpcBench, BenchmarkCalls) {
   LOG(INFO) << "Sys CPU per req:  " << sys_cpu_micros_per_req << "us";
 }
 
+// Models tablet server traffic: many connections from several clients, and calls with mixed
+// payload sizes, where big payloads are sent as sidecars. TLS, compression, number of reactors
+// and workers are controlled by rpc_bench_* flags.
+class MixedWorkloadBench : public RpcTestBase {
+ public:
+  void SetUp() override {
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_stream_compression_algo) = FLAGS_rpc_bench_compression;
+    RpcTestBase::SetUp();
+    if (FLAGS_rpc_bench_tls) {
+      secure_context_ = std::make_unique<SecureContext>(
+          RequireClientCertificate::kFalse, UseClientCertificate::kFalse);
+      ASSERT_OK(secure_context_->TEST_GenerateKeys(
+          1024, "127.0.0.1", MatchingCertKeyPair::kTrue));
+    }
+    for (const auto& size : strings::Split(
+             FLAGS_rpc_bench_payload_sizes, ",", strings::SkipEmpty())) {
+      payload_sizes_.push_back(std::stoull(size.ToString()));
+    }
+    ASSERT_FALSE(payload_sizes_.empty());
+  }
+
+ protected:
+  std::unique_ptr<Messenger> CreateBenchMessenger(
+      const std::string& name, const MessengerOptions& options) {
+    auto builder = CreateMessengerBuilder(name, options);
+    StreamFactoryPtr factory = TcpStream::Factory();
+    const Protocol* protocol = TcpStream::StaticProtocol();
+    if (secure_context_) {
+      factory = SecureStreamFactory(
+          std::move(factory), MemTracker::GetRootTracker(), secure_context_.get());
+      protocol = SecureStreamProtocol();
+    }
+    if (FLAGS_rpc_bench_compression) {
+      factory = CompressedStreamFactory(std::move(factory), MemTracker::GetRootTracker());
+      protocol = CompressedStreamProtocol();
+    }
+    builder.SetListenProtocol(protocol);
+    builder.AddStreamFactory(protocol, std::move(factory));
+    return EXPECT_RESULT(builder.Build());
+  }
+
+  void RunClient(rpc_test::CalculatorServiceProxy* proxy, size_t* num_calls) {
+    std::string payload = RandomHumanReadableString(
+        *std::max_element(payload_sizes_.begin(), payload_sizes_.end()));
+    while (should_run_.load(std::memory_order_acquire)) {
+      auto size = RandomElement(payload_sizes_);
+      RpcController controller;
+      controller.set_timeout(10s);
+      auto start = MonoTime::Now();
+      if (size >= FLAGS_rpc_bench_sidecar_min_bytes) {
+        controller.outbound_sidecars().Start().Append(Slice(payload.data(), size));
+        rpc_test::SidecarRequestPB req;
+        req.set_num_sidecars(1);
+        rpc_test::SidecarResponsePB resp;
+        CHECK_OK(proxy->Sidecar(req, &resp, &controller));
+        CHECK_EQ(CHECK_RESULT(controller.ExtractSidecar(0)).size(), size);
+      } else {
+        rpc_test::EchoRequestPB req;
+        req.set_data(payload.data(), size);
+        rpc_test::EchoResponsePB resp;
+        CHECK_OK(proxy->Echo(req, &resp, &controller));
+        CHECK_EQ(resp.data().size(), size);
+      }
+      latency_us_.Increment((MonoTime::Now() - start).ToMicroseconds());
+      ++*num_calls;
+    }
+  }
+
+  std::unique_ptr<SecureContext> secure_context_;
+  std::vector<size_t> payload_sizes_;
+  std::atomic<bool> should_run_{true};
+  HdrHistogram latency_us_{60000000, 2};
+};
+
+TEST_F(MixedWorkloadBench, Benchmark) {
+  TestServerOptions server_options;
+  server_options.messenger_options.n_reactors = FLAGS_rpc_bench_server_reactors;
+  server_options.n_worker_threads = FLAGS_rpc_bench_server_workers;
+  HostPort server_hostport;
+  StartTestServerWithGeneratedCode(
+      CreateBenchMessenger("TestServer", server_options.messenger_options), &server_hostport,
+      server_options);
+
+  MessengerOptions client_options = kDefaultClientMessengerOptions;
+  client_options.n_reactors = FLAGS_rpc_bench_client_reactors;
+  client_options.num_connections_to_server = FLAGS_rpc_bench_connections_to_server;
+  std::vector<AutoShutdownMessengerHolder> messengers;
+  std::vector<std::unique_ptr<ProxyCache>> proxy_caches;
+  std::vector<std::unique_ptr<rpc_test::CalculatorServiceProxy>> proxies;
+  for (int i = 0; i != FLAGS_rpc_bench_client_messengers; ++i) {
+    messengers.push_back(rpc::CreateAutoShutdownMessengerHolder(
+        CreateBenchMessenger(Format("Client-$0", i), client_options)));
+    proxy_caches.push_back(std::make_unique<ProxyCache>(messengers.back().get()));
+    proxies.push_back(std::make_unique<rpc_test::CalculatorServiceProxy>(
+        proxy_caches.back().get(), server_hostport, messengers.back()->DefaultProtocol()));
+  }
+
+  Stopwatch sw(Stopwatch::ALL_THREADS);
+  sw.start();
+
+  std::vector<size_t> num_calls(FLAGS_rpc_bench_client_threads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i != FLAGS_rpc_bench_client_threads; ++i) {
+    threads.emplace_back([this, proxy = proxies[i % proxies.size()].get(), &num_calls, i] {
+      RunClient(proxy, &num_calls[i]);
+    });
+  }
+
+  std::this_thread::sleep_for(FLAGS_rpc_bench_duration_sec * 1s);
+  should_run_.store(false, std::memory_order_release);
+
+  size_t total_calls = 0;
+  for (size_t i = 0; i != threads.size(); ++i) {
+    threads[i].join();
+    total_calls += num_calls[i];
+  }
+  sw.stop();
+
+  LOG(INFO) << "TLS: " << FLAGS_rpc_bench_tls << ", compression: " << FLAGS_rpc_bench_compression
+            << ", payload sizes: " << FLAGS_rpc_bench_payload_sizes;
+  LOG(INFO) << "Calls/sec:         " << total_calls / sw.elapsed().wall_seconds();
+  LOG(INFO) << "User CPU per call: " << sw.elapsed().user / 1000.0 / total_calls << "us";
+  LOG(INFO) << "Sys CPU per call:  " << sw.elapsed().system / 1000.0 / total_calls << "us";
+  LOG(INFO) << "Latency p50:       " << latency_us_.ValueAtPercentile(50) << "us";
+  LOG(INFO) << "Latency p99:       " << latency_us_.ValueAtPercentile(99) << "us";
+  LOG(INFO) << "Latency p99.9:     " << latency_us_.ValueAtPercentile(99.9) << "us";
+  LOG(INFO) << "Latency max:       " << latency_us_.MaxValue() << "us";
+}
+
 } // namespace rpc
 } // namespace yb
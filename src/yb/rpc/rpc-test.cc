@@ -86,6 +86,8 @@ DECLARE_bool(enable_rpc_keepalive);
 DECLARE_int32(num_connections_to_server);
 DECLARE_int64(rpc_throttle_threshold_bytes);
 DECLARE_int32(stream_compression_algo);
+DECLARE_double(stream_compression_max_ratio);
+DECLARE_uint64(stream_compression_min_message_bytes);
 DECLARE_int64(memory_limit_hard_bytes);
 DECLARE_string(vmodule);
 DECLARE_uint64(rpc_connection_timeout_ms);
@@ -1336,6 +1338,23 @@ TEST_P(TestRpcCompression, CantAllocateReadBuffer) {
   RunCompressionTest(&TestCantAllocateReadBuffer, SetupServerForTestCantAllocateReadBuffer());
 }
 
+TEST_P(TestRpcCompression, UncompressedMessages) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_stream_compression_min_message_bytes) = 64_KB;
+  RunCompressionTest([](CalculatorServiceProxy* proxy) {
+    TestManyOps(proxy);
+    TestBigOp(proxy);
+  });
+}
+
+TEST_P(TestRpcCompression, IncompressibleMessages) {
+  // Every message switches to uncompressed chunks after its first chunk.
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_stream_compression_max_ratio) = 0;
+  RunCompressionTest([](CalculatorServiceProxy* proxy) {
+    TestManyOps(proxy);
+    TestBigOp(proxy);
+  });
+}
+
 void TestCompression(
     CalculatorServiceProxy* proxy, const MetricEntityPtr& metric_entity) {
   CounterPtr sent_counter;
@@ -56,11 +56,11 @@ namespace rpc {
 
 RpcMetrics::RpcMetrics(const scoped_refptr<MetricEntity>& metric_entity) {
   if (metric_entity) {
-    connections_alive = METRIC_rpc_connections_alive.Instantiate(metric_entity, 0);
+    connections_alive = METRIC_rpc_connections_alive.InstantiateStriped(metric_entity);
     connections_created = METRIC_rpc_connections_created.Instantiate(metric_entity);
-    inbound_calls_alive = METRIC_rpc_inbound_calls_alive.Instantiate(metric_entity, 0);
+    inbound_calls_alive = METRIC_rpc_inbound_calls_alive.InstantiateStriped(metric_entity);
     inbound_calls_created = METRIC_rpc_inbound_calls_created.Instantiate(metric_entity);
-    outbound_calls_alive = METRIC_rpc_outbound_calls_alive.Instantiate(metric_entity, 0);
+    outbound_calls_alive = METRIC_rpc_outbound_calls_alive.InstantiateStriped(metric_entity);
     outbound_calls_created = METRIC_rpc_outbound_calls_created.Instantiate(metric_entity);
     outbound_calls_stuck = METRIC_rpc_outbound_calls_stuck.Instantiate(metric_entity);
   }
@@ -21,11 +21,11 @@ namespace rpc {
 struct RpcMetrics {
   explicit RpcMetrics(const scoped_refptr<MetricEntity>& metric_entity);
 
-  scoped_refptr<AtomicGauge<int64_t>> connections_alive;
+  scoped_refptr<StripedGauge> connections_alive;
   scoped_refptr<Counter> connections_created;
-  scoped_refptr<AtomicGauge<int64_t>> inbound_calls_alive;
+  scoped_refptr<StripedGauge> inbound_calls_alive;
   scoped_refptr<Counter> inbound_calls_created;
-  scoped_refptr<AtomicGauge<int64_t>> outbound_calls_alive;
+  scoped_refptr<StripedGauge> outbound_calls_alive;
   scoped_refptr<Counter> outbound_calls_created;
   scoped_refptr<Counter> outbound_calls_stuck;
 };
@@ -70,6 +70,8 @@ METRIC_DECLARE_counter(service_request_bytes_yb_rpc_test_CalculatorService_Echo)
 METRIC_DECLARE_counter(service_response_bytes_yb_rpc_test_CalculatorService_Echo);
 METRIC_DECLARE_counter(proxy_request_bytes_yb_rpc_test_CalculatorService_Echo);
 METRIC_DECLARE_counter(proxy_response_bytes_yb_rpc_test_CalculatorService_Echo);
+METRIC_DECLARE_histogram(service_queue_time_yb_rpc_test_CalculatorService_Echo);
+METRIC_DECLARE_histogram(service_response_send_time_yb_rpc_test_CalculatorService_Echo);
 
 using namespace std::chrono_literals;
 
@@ -881,6 +883,35 @@ TEST_F(RpcStubTest, TrafficMetrics) {
   ASSERT_LT(proxy_request_bytes->value(), kUpperBytesLimit);
 }
 
+TEST_F(RpcStubTest, LatencyBreakdownMetrics) {
+  CalculatorServiceProxy proxy(proxy_cache_.get(), server_hostport_);
+
+  RpcController controller;
+  rpc_test::EchoRequestPB req;
+  req.set_data("test");
+  rpc_test::EchoResponsePB resp;
+  ASSERT_OK(proxy.Echo(req, &resp, &controller));
+
+  auto server_metrics = server_messenger()->metric_entity()->UnsafeMetricsMapForTests();
+  auto* queue_time = down_cast<Histogram*>(FindOrDie(
+      server_metrics, &METRIC_service_queue_time_yb_rpc_test_CalculatorService_Echo).get());
+  auto* response_send_time = down_cast<Histogram*>(FindOrDie(
+      server_metrics, &METRIC_service_response_send_time_yb_rpc_test_CalculatorService_Echo).get());
+  ASSERT_EQ(queue_time->TotalCount(), 1U);
+  // Transfer is recorded on the server reactor thread, so it could happen after the client
+  // received the response.
+  ASSERT_OK(WaitFor([response_send_time] {
+    return response_send_time->TotalCount() == 1U;
+  }, 5s, "Response send time recorded"));
+
+  DumpRunningRpcsRequestPB dump_req;
+  DumpRunningRpcsResponsePB dump_resp;
+  ASSERT_OK(server_messenger()->DumpRunningRpcs(dump_req, &dump_resp));
+  ASSERT_EQ(dump_resp.inbound_connections_size(), 1);
+  const auto& timing = dump_resp.inbound_connections(0).inbound_calls_timing();
+  ASSERT_EQ(timing.calls(), 1U);
+}
+
 template <class T>
 std::string ReversedAsString(T t) {
   std::reverse(t.begin(), t.end());
@@ -20,20 +20,13 @@
 #include <boost/asio/steady_timer.hpp>
 #include <boost/asio/strand.hpp>
 
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/mem_fun.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-
 #include "yb/util/errno.h"
 #include "yb/util/logging.h"
 #include "yb/util/status.h"
+#include "yb/util/timing_wheel.h"
 
 using namespace std::literals;
 using namespace std::placeholders;
-using boost::multi_index::const_mem_fun;
-using boost::multi_index::hashed_unique;
-using boost::multi_index::ordered_non_unique;
 
 namespace yb {
 namespace rpc {
@@ -42,12 +35,18 @@ namespace {
 
 constexpr int64_t kShutdownMark = -(1ULL << 32U);
 
+// Tasks are run up to this duration later than scheduled.
+constexpr auto kTimingWheelTick = 1ms;
+
 }
 
 class Scheduler::Impl {
  public:
   explicit Impl(IoService* io_service)
-      : io_service_(*io_service), strand_(*io_service), timer_(*io_service) {}
+      : io_service_(*io_service),
+        tasks_(kTimingWheelTick, std::chrono::steady_clock::now()),
+        strand_(*io_service),
+        timer_(*io_service) {}
 
   ~Impl() {
     Shutdown();
@@ -57,11 +56,9 @@ class Scheduler::Impl {
 
   void Abort(ScheduledTaskId task_id) {
     strand_.dispatch([this, task_id] {
-      auto& index = tasks_.get<IdTag>();
-      auto it = index.find(task_id);
-      if (it != index.end()) {
-        io_service_.post([task = *it] { task->Run(STATUS(Aborted, "Task aborted")); });
-        index.erase(it);
+      auto task = tasks_.Erase(task_id);
+      if (task) {
+        io_service_.post([task = std::move(*task)] { task->Run(STATUS(Aborted, "Task aborted")); });
       }
     });
   }
@@ -78,10 +75,10 @@ class Scheduler::Impl {
             ServiceUnavailable, "Scheduler is shutting down", "" /* msg2 */, Errno(ESHUTDOWN));
         // Abort all scheduled tasks. It is ok to run task earlier than it was scheduled because
         // we pass error status to it.
-        for (auto task : tasks_) {
+        tasks_.ForEach([this, &status](ScheduledTaskId, const auto& task) {
           io_service_.post([task, status] { task->Run(status); });
-        }
-        tasks_.clear();
+        });
+        tasks_.Clear();
       });
     }
   }
@@ -95,9 +92,8 @@ class Scheduler::Impl {
         return;
       }
 
-      auto pair = tasks_.insert(task);
-      CHECK(pair.second);
-      if (pair.first == tasks_.begin()) {
+      tasks_.Schedule(task->id(), task, task->time());
+      if (tasks_.NextExpirationTime() < timer_expires_at_) {
         StartTimer();
       }
     });
@@ -117,7 +113,8 @@ class Scheduler::Impl {
     DCHECK(!tasks_.empty());
 
     boost::system::error_code ec;
-    timer_.expires_at((*tasks_.begin())->time(), ec);
+    timer_expires_at_ = tasks_.NextExpirationTime();
+    timer_.expires_at(timer_expires_at_, ec);
     LOG_IF(ERROR, ec) << "Reschedule timer failed: " << ec.message();
     ++timer_counter_;
     timer_.async_wait(strand_.wrap(std::bind(&Impl::HandleTimer, this, _1)));
@@ -131,35 +128,24 @@ class Scheduler::Impl {
       LOG_IF(ERROR, ec != boost::asio::error::operation_aborted) << "Wait failed: " << ec.message();
       return;
     }
+    timer_expires_at_ = SteadyTimePoint::max();
     if (closing_.load(std::memory_order_acquire)) {
       return;
     }
 
-    auto now = std::chrono::steady_clock::now();
-    while (!tasks_.empty() && (*tasks_.begin())->time() <= now) {
-      io_service_.post([task = *tasks_.begin()] { task->Run(Status::OK()); });
-      tasks_.erase(tasks_.begin());
-    }
+    tasks_.Advance(std::chrono::steady_clock::now(), [this](ScheduledTaskId, auto&& task) {
+      io_service_.post([task = std::move(task)] { task->Run(Status::OK()); });
+    });
 
     if (!tasks_.empty()) {
       StartTimer();
     }
   }
 
-  class IdTag;
-
-  typedef boost::multi_index_container<
-      std::shared_ptr<ScheduledTaskBase>,
-      boost::multi_index::indexed_by<
-          ordered_non_unique<
-              const_mem_fun<ScheduledTaskBase, SteadyTimePoint, &ScheduledTaskBase::time>
-          >,
-          hashed_unique<
-              boost::multi_index::tag<IdTag>,
-              const_mem_fun<ScheduledTaskBase, ScheduledTaskId, &ScheduledTaskBase::id>
-          >
-      >
-  > Tasks;
+  // Tasks are tracked in a timing wheel, so scheduling and aborting a task takes constant time
+  // regardless of the number of scheduled tasks.
+  using Tasks = TimingWheel<
+      ScheduledTaskId, std::shared_ptr<ScheduledTaskBase>, std::chrono::steady_clock>;
 
   IoService& io_service_;
   std::atomic<ScheduledTaskId> id_ = {0};
@@ -167,6 +153,8 @@ class Scheduler::Impl {
   // Strand that protects tasks_ and timer_ fields.
   boost::asio::io_service::strand strand_;
   boost::asio::steady_timer timer_;
+  // Expiration time of the pending timer wait, max if there is no pending wait.
+  SteadyTimePoint timer_expires_at_ = SteadyTimePoint::max();
   int timer_counter_ = 0;
   std::atomic<bool> closing_ = {false};
 };
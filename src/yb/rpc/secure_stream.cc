@@ -53,6 +53,17 @@ DEFINE_UNKNOWN_string(cipher_list, "",
 DEFINE_UNKNOWN_string(ciphersuites, "",
               "Define the available TLSv1.3 ciphersuites.");
 
+DEFINE_NON_RUNTIME_uint64(ssl_bio_buffer_size_bytes, 0,
+    "Size of the buffers between OpenSSL and the underlying stream of a secure connection. "
+    "Larger buffers let large messages be encrypted and decrypted in fewer rounds. "
+    "0 to use the OpenSSL default.");
+TAG_FLAG(ssl_bio_buffer_size_bytes, advanced);
+
+DEFINE_RUNTIME_uint64(ssl_coalesce_write_bytes, 16 * 1024,
+    "Consecutive pieces of an outbound message smaller than this are combined before encryption, "
+    "so they are sent as a single TLS record. 0 to encrypt each piece separately.");
+TAG_FLAG(ssl_coalesce_write_bytes, advanced);
+
 #define YB_RPC_SSL_TYPE(name) \
   struct BOOST_PP_CAT(name, Free) { \
     void operator()(name* value) const { \
@@ -684,6 +695,7 @@ class SecureRefiner : public StreamRefiner {
   bool MatchUid(X509* cert, GENERAL_NAMES* gens);
   bool MatchUidEntry(const Slice& value, const char* name);
   Result<bool> WriteEncrypted(OutboundDataPtr data) ON_REACTOR_THREAD;
+  Status WritePlain(Slice slice) ON_REACTOR_THREAD;
   void DecryptReceived();
 
   Status Established(RefinedStreamState state) ON_REACTOR_THREAD {
@@ -710,33 +722,53 @@ class SecureRefiner : public StreamRefiner {
 Status SecureRefiner::Send(OutboundDataPtr data) {
   boost::container::small_vector<RefCntSlice, 10> queue;
   data->Serialize(&queue);
+  // Each SSL_write produces at least one TLS record, so small pieces, like headers, are combined
+  // to avoid paying per record overhead for each of them.
+  const auto coalesce_limit = FLAGS_ssl_coalesce_write_bytes;
+  std::string coalesced;
   for (const auto& buf : queue) {
     Slice slice(buf.data(), buf.size());
-    for (;;) {
-      int slice_size = narrow_cast<int>(slice.size());
-      auto len = SSL_write(ssl_.get(), slice.data(), slice_size);
-      if (len == slice_size) {
-        break;
-      }
-      auto error = len <= 0 ? SSL_get_error(ssl_.get(), len) : SSL_ERROR_NONE;
-      VLOG_WITH_PREFIX(4) << "SSL_write was not full: " << slice.size() << ", written: " << len
-                          << ", error: " << error;
-      if (error != SSL_ERROR_NONE) {
-        if (error != SSL_ERROR_WANT_WRITE || !VERIFY_RESULT(WriteEncrypted(nullptr))) {
-          return STATUS_FORMAT(
-              NetworkError, "SSL write failed: $0 ($1)", SSLErrorMessage(error), error);
-        }
-      } else {
-        RETURN_NOT_OK(WriteEncrypted(nullptr));
-      }
-      if (len > 0) {
-        slice.remove_prefix(len);
-      }
+    if (coalesced.size() + slice.size() > coalesce_limit && !coalesced.empty()) {
+      RETURN_NOT_OK(WritePlain(coalesced));
+      coalesced.clear();
+    }
+    if (slice.size() < coalesce_limit) {
+      coalesced.append(slice.cdata(), slice.size());
+    } else {
+      RETURN_NOT_OK(WritePlain(slice));
     }
   }
+  if (!coalesced.empty()) {
+    RETURN_NOT_OK(WritePlain(coalesced));
+  }
   return ResultToStatus(WriteEncrypted(std::move(data)));
 }
 
+Status SecureRefiner::WritePlain(Slice slice) {
+  for (;;) {
+    int slice_size = narrow_cast<int>(slice.size());
+    auto len = SSL_write(ssl_.get(), slice.data(), slice_size);
+    if (len == slice_size) {
+      break;
+    }
+    auto error = len <= 0 ? SSL_get_error(ssl_.get(), len) : SSL_ERROR_NONE;
+    VLOG_WITH_PREFIX(4) << "SSL_write was not full: " << slice.size() << ", written: " << len
+                        << ", error: " << error;
+    if (error != SSL_ERROR_NONE) {
+      if (error != SSL_ERROR_WANT_WRITE || !VERIFY_RESULT(WriteEncrypted(nullptr))) {
+        return STATUS_FORMAT(
+            NetworkError, "SSL write failed: $0 ($1)", SSLErrorMessage(error), error);
+      }
+    } else {
+      RETURN_NOT_OK(WriteEncrypted(nullptr));
+    }
+    if (len > 0) {
+      slice.remove_prefix(len);
+    }
+  }
+  return Status::OK();
+}
+
 Result<bool> SecureRefiner::WriteEncrypted(OutboundDataPtr data) {
   auto pending = BIO_ctrl_pending(bio_.get());
   if (pending == 0) {
@@ -897,7 +929,8 @@ Status SecureRefiner::Init() {
 
   BIO* int_bio = nullptr;
   BIO* temp_bio = nullptr;
-  BIO_new_bio_pair(&int_bio, 0, &temp_bio, 0);
+  BIO_new_bio_pair(
+      &int_bio, FLAGS_ssl_bio_buffer_size_bytes, &temp_bio, FLAGS_ssl_bio_buffer_size_bytes);
   SSL_set_bio(ssl_.get(), int_bio, int_bio);
   bio_.reset(temp_bio);
 
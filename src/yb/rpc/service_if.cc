@@ -50,9 +50,12 @@ RpcMethodMetrics::RpcMethodMetrics() = default;
 
 RpcMethodMetrics::RpcMethodMetrics(const scoped_refptr<Counter>& request_bytes_,
                                    const scoped_refptr<Counter>& response_bytes_,
-                                   const scoped_refptr<Histogram>& handler_latency_)
+                                   const scoped_refptr<Histogram>& handler_latency_,
+                                   const scoped_refptr<Histogram>& queue_time_,
+                                   const scoped_refptr<Histogram>& response_send_time_)
     : request_bytes(request_bytes_), response_bytes(response_bytes_),
-      handler_latency(handler_latency_) {
+      handler_latency(handler_latency_), queue_time(queue_time_),
+      response_send_time(response_send_time_) {
 }
 
 RpcMethodMetrics::~RpcMethodMetrics() = default;
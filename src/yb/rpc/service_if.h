@@ -56,11 +56,17 @@ struct RpcMethodMetrics {
   scoped_refptr<Counter> request_bytes;
   scoped_refptr<Counter> response_bytes;
   scoped_refptr<Histogram> handler_latency;
+  // Time between receiving the call and starting its handler.
+  scoped_refptr<Histogram> queue_time;
+  // Time between queueing the response and writing it to the socket.
+  scoped_refptr<Histogram> response_send_time;
 
   RpcMethodMetrics();
   RpcMethodMetrics(const scoped_refptr<Counter>& request_bytes,
                    const scoped_refptr<Counter>& response_bytes,
-                   const scoped_refptr<Histogram>& handler_latency);
+                   const scoped_refptr<Histogram>& handler_latency,
+                   const scoped_refptr<Histogram>& queue_time,
+                   const scoped_refptr<Histogram>& response_send_time);
   RpcMethodMetrics(const RpcMethodMetrics&);
   ~RpcMethodMetrics();
 };
@@ -36,6 +36,7 @@
 #include <sys/types.h>
 
 #include <functional>
+#include <limits>
 #include <memory>
 #include <queue>
 #include <string>
@@ -54,6 +55,7 @@
 #include "yb/rpc/scheduler.h"
 #include "yb/rpc/service_if.h"
 
+#include "yb/util/atomic.h"
 #include "yb/util/countdown_latch.h"
 #include "yb/util/flags.h"
 #include "yb/util/lockfree.h"
@@ -76,6 +78,15 @@ DEFINE_RUNTIME_int64(backpressure_recovery_period_ms, 600000,
     "Once we hit a backpressure/service-overflow we will consider dropping stale requests "
     "for this duration (in ms)");
 TAG_FLAG(backpressure_recovery_period_ms, advanced);
+DEFINE_RUNTIME_int64(rpc_queue_delay_target_ms, 0,
+    "CoDel style queue delay target. When the minimal time that calls spent in the service queue "
+    "during the last rpc_queue_delay_interval_ms exceeds this target, the queue is considered "
+    "overloaded and calls that waited for more than twice the target are rejected, instead of "
+    "waiting up to max_time_in_queue_ms. 0 to disable.");
+TAG_FLAG(rpc_queue_delay_target_ms, advanced);
+DEFINE_RUNTIME_int64(rpc_queue_delay_interval_ms, 100,
+    "Interval used to track the minimal queue delay, see rpc_queue_delay_target_ms.");
+TAG_FLAG(rpc_queue_delay_interval_ms, advanced);
 DEFINE_test_flag(bool, enable_backpressure_mode_for_testing, false,
             "For testing purposes. Enables the rpc's to be considered timed out in the queue even "
             "when we have not had any backpressure in the recent past.");
@@ -254,6 +265,8 @@ class ServicePoolImpl final : public InboundCallHandler {
       error_message = kTimedOutInQueue;
     } else if (PREDICT_FALSE(ShouldDropRequestDuringHighLoad(incoming))) {
       error_message = "The server is overloaded. Call waited in the queue past max_time_in_queue.";
+    } else if (PREDICT_FALSE(ShouldDropRequestOnQueueDelay(incoming))) {
+      error_message = "The server is overloaded. Call waited in the queue past delay target.";
     } else {
       if (incoming->TryStartProcessing()) {
         TRACE_TO(incoming->trace(), "Handling call $0", AsString(incoming->method_name()));
@@ -300,6 +313,31 @@ class ServicePoolImpl final : public InboundCallHandler {
     return incoming->GetTimeInQueue().ToMilliseconds() > FLAGS_max_time_in_queue_ms;
   }
 
+  // Tracks the minimal queue delay over intervals, like CoDel does. A standing queue, i.e. a queue
+  // where even the fastest call waited longer than the target during the whole interval, means
+  // that the service cannot keep up. In this state calls that waited too long are rejected, so
+  // the queue drains and fresh calls, including heartbeats, are served in time.
+  bool ShouldDropRequestOnQueueDelay(const InboundCallPtr& incoming) {
+    auto target_ms = FLAGS_rpc_queue_delay_target_ms;
+    if (target_ms <= 0) {
+      return false;
+    }
+    auto queue_delay = incoming->GetTimeInQueue().ToMicroseconds();
+    UpdateAtomicMin(&min_queue_delay_us_, queue_delay);
+
+    auto now = CoarseMonoClock::Now().time_since_epoch();
+    auto interval_start = queue_delay_interval_start_.load(std::memory_order_acquire);
+    if (now >= interval_start + FLAGS_rpc_queue_delay_interval_ms * 1ms &&
+        queue_delay_interval_start_.compare_exchange_strong(
+            interval_start, now, std::memory_order_acq_rel)) {
+      auto min_delay = min_queue_delay_us_.exchange(
+          std::numeric_limits<int64_t>::max(), std::memory_order_acq_rel);
+      queue_overloaded_.store(min_delay > target_ms * 1000, std::memory_order_release);
+    }
+
+    return queue_overloaded_.load(std::memory_order_acquire) && queue_delay > 2 * target_ms * 1000;
+  }
+
   void CheckTimeout(ScheduledTaskId task_id, CoarseTimePoint time, const Status& status) {
     auto se = ScopeExit([this, task_id, time] {
       auto expected_duration = time.time_since_epoch();
@@ -411,6 +449,11 @@ class ServicePoolImpl final : public InboundCallHandler {
   std::atomic<CoarseDuration> last_backpressure_at_{CoarseTimePoint().time_since_epoch()};
   std::atomic<int64_t> queued_calls_{0};
 
+  // Queue delay tracking, see ShouldDropRequestOnQueueDelay.
+  std::atomic<CoarseDuration> queue_delay_interval_start_{CoarseDuration::zero()};
+  std::atomic<int64_t> min_queue_delay_us_{std::numeric_limits<int64_t>::max()};
+  std::atomic<bool> queue_overloaded_{false};
+
   // It is too expensive to update timeout priority queue when each call is received.
   // So we are doing the following trick.
   // All calls are added to pre_check_timeout_queue_, w/o priority.
@@ -33,6 +33,11 @@ using namespace std::literals;
 DECLARE_uint64(rpc_connection_timeout_ms);
 DEFINE_test_flag(int32, delay_connect_ms, 0,
                  "Delay connect in tests for specified amount of milliseconds.");
+DEFINE_RUNTIME_bool(rpc_stop_io_on_short_transfer, true,
+    "Stop reading from (writing to) a socket after a read (write) that transferred less than "
+    "requested, instead of issuing one more syscall that would fail with EAGAIN. The reactor "
+    "polls sockets in level triggered mode, so it is notified again when the socket is ready.");
+TAG_FLAG(rpc_stop_io_on_short_transfer, advanced);
 
 METRIC_DEFINE_simple_counter(
   server, tcp_bytes_sent, "Bytes sent over TCP connections", yb::MetricUnit::kBytes);
@@ -218,6 +223,10 @@ Status TcpStream::DoWrite() {
     auto result = fill_result.len != 0
         ? socket_.Writev(iov, fill_result.len)
         : 0;
+    size_t requested = 0;
+    for (int i = 0; i != fill_result.len; ++i) {
+      requested += iov[i].iov_len;
+    }
     DVLOG_WITH_PREFIX(4) << "Queued writes " << queued_bytes_to_send_ << " bytes. Result "
                          << result << ", sending_.size(): " << sending_.size();
 
@@ -253,6 +262,11 @@ Status TcpStream::DoWrite() {
         context_->Transferred(data, Status::OK());
       }
     }
+
+    // Socket send buffer is full, so the next write would fail with EAGAIN.
+    if (*result < requested && FLAGS_rpc_stop_io_on_short_transfer) {
+      break;
+    }
   }
 
   return Status::OK();
@@ -321,7 +335,8 @@ Status TcpStream::ReadHandler() {
   context_->UpdateLastRead();
 
   for (;;) {
-    auto received = Receive();
+    bool drained = false;
+    auto received = Receive(&drained);
     if (PREDICT_FALSE(!received.ok())) {
       if (Errno(received.status()) == ESHUTDOWN) {
         VLOG_WITH_PREFIX(1) << "Shut down by remote end.";
@@ -340,13 +355,13 @@ Status TcpStream::ReadHandler() {
     if (!continue_receiving.ok()) {
       return continue_receiving.status();
     }
-    if (!continue_receiving.get()) {
+    if (!continue_receiving.get() || drained) {
       return Status::OK();
     }
   }
 }
 
-Result<bool> TcpStream::Receive() {
+Result<bool> TcpStream::Receive(bool* drained) {
   auto iov = ReadBuffer().PrepareAppend();
   if (!iov.ok()) {
     VLOG_WITH_PREFIX(3) << "ReadBuffer().PrepareAppend() error: " << iov.status();
@@ -387,6 +402,15 @@ Result<bool> TcpStream::Receive() {
   }
   DVLOG_WITH_PREFIX(4) << "socket_.Recvv() bytes: " << *nread;
 
+  if (FLAGS_rpc_stop_io_on_short_transfer) {
+    size_t capacity = 0;
+    for (const auto& vec : *iov) {
+      capacity += vec.iov_len;
+    }
+    // Socket does not have more data for now, so the next read would fail with EAGAIN.
+    *drained = *nread < capacity;
+  }
+
   IncrementCounterBy(bytes_received_counter_, *nread);
   ReadBuffer().DataAppended(*nread);
   return *nread != 0;
@@ -101,7 +101,9 @@ class TcpStream : public Stream {
   Status ReadHandler();
   Status WriteHandler(bool just_connected);
 
-  Result<bool> Receive();
+  // Reads available data into the read buffer. Sets drained to true when the socket is known to
+  // have no more data to read.
+  Result<bool> Receive(bool* drained);
   // Try to parse received data and process it.
   Result<bool> TryProcessReceived();
 
@@ -28,6 +28,7 @@
 #include "yb/util/tsan_util.h"
 
 DECLARE_int32(TEST_strand_done_inject_delay_ms);
+DECLARE_uint64(rpc_thread_pool_task_queue_shards);
 
 using namespace std::literals;
 
@@ -126,7 +127,7 @@ TEST_F(ThreadPoolTest, TestSingleProducer) {
   }
 }
 
-TEST_F(ThreadPoolTest, TestMultiProducers) {
+void TestMultiProducers() {
   constexpr size_t kTotalTasks = 10000;
   constexpr size_t kTotalWorkers = 4;
   constexpr size_t kProducers = 4;
@@ -159,6 +160,15 @@ TEST_F(ThreadPoolTest, TestMultiProducers) {
   }
 }
 
+TEST_F(ThreadPoolTest, TestMultiProducers) {
+  TestMultiProducers();
+}
+
+TEST_F(ThreadPoolTest, TestMultiProducersShardedQueues) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_rpc_thread_pool_task_queue_shards) = 4;
+  TestMultiProducers();
+}
+
 TEST_F(ThreadPoolTest, TestQueueOverflow) {
   constexpr size_t kTotalTasks = 10000;
   constexpr size_t kTotalWorkers = 4;
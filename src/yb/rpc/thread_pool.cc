@@ -15,16 +15,30 @@
 
 #include "yb/rpc/thread_pool.h"
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
+#include <vector>
 
 #include <cds/container/basket_queue.h>
 #include <cds/gc/dhp.h>
 
+#include "yb/util/flags.h"
+#include "yb/util/numa_util.h"
 #include "yb/util/scope_exit.h"
+#include "yb/util/status_log.h"
 #include "yb/util/status_format.h"
 #include "yb/util/thread.h"
 
+DEFINE_NON_RUNTIME_uint64(rpc_thread_pool_task_queue_shards, 1,
+    "Number of task queues in each RPC thread pool. Tasks are added to the queue picked by the "
+    "enqueuing thread, and each worker prefers its own queue, taking tasks from other queues "
+    "when it is empty. Several queues reduce contention on the queue with many cores.");
+TAG_FLAG(rpc_thread_pool_task_queue_shards, advanced);
+
+DECLARE_bool(rpc_numa_pin_threads);
+
 namespace yb {
 namespace rpc {
 
@@ -35,13 +49,56 @@ class Worker;
 typedef cds::container::BasketQueue<cds::gc::DHP, ThreadPoolTask*> TaskQueue;
 typedef cds::container::BasketQueue<cds::gc::DHP, Worker*> WaitingWorkers;
 
+// Used to pick the task queue of the thread that enqueues a task, so tasks from the same
+// reactor thread tend to be picked by the same workers.
+std::atomic<size_t> next_thread_queue_hint{0};
+
+size_t ThreadQueueHint() {
+  static thread_local size_t hint = next_thread_queue_hint.fetch_add(1, std::memory_order_relaxed);
+  return hint;
+}
+
 struct ThreadPoolShare {
   ThreadPoolOptions options;
-  TaskQueue task_queue;
+  std::vector<std::unique_ptr<TaskQueue>> task_queues;
   WaitingWorkers waiting_workers;
 
   explicit ThreadPoolShare(ThreadPoolOptions o)
-      : options(std::move(o)) {}
+      : options(std::move(o)) {
+    auto num_queues = std::max<size_t>(
+        1, std::min<size_t>(FLAGS_rpc_thread_pool_task_queue_shards, options.max_workers));
+    task_queues.reserve(num_queues);
+    for (size_t i = 0; i != num_queues; ++i) {
+      task_queues.push_back(std::make_unique<TaskQueue>());
+    }
+  }
+
+  void Push(ThreadPoolTask* task) {
+    auto& queue = task_queues.size() == 1
+        ? *task_queues.front() : *task_queues[ThreadQueueHint() % task_queues.size()];
+    bool added = queue.push(task);
+    DCHECK(added); // BasketQueue always succeed.
+  }
+
+  // Pops task from the queue with the specified index, or from any other queue when it is empty.
+  bool Pop(size_t home_queue, ThreadPoolTask** task) {
+    const auto num_queues = task_queues.size();
+    for (size_t i = 0; i != num_queues; ++i) {
+      if (task_queues[(home_queue + i) % num_queues]->pop(*task)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool Empty() const {
+    for (const auto& queue : task_queues) {
+      if (!queue->empty()) {
+        return false;
+      }
+    }
+    return true;
+  }
 };
 
 namespace {
@@ -57,6 +114,8 @@ class Worker {
   }
 
   Status Start(size_t index) {
+    index_ = index;
+    home_queue_ = index % share_->task_queues.size();
     auto name = strings::Substitute("rpc_tp_$0_$1", share_->options.name, index);
     return yb::Thread::Create(kRpcThreadCategory, name, &Worker::Execute, this, &thread_);
   }
@@ -98,6 +157,9 @@ class Worker {
   // does not have free hands (worker queue empty)
   void Execute() {
     Thread::current_thread()->SetUserData(share_);
+    if (FLAGS_rpc_numa_pin_threads) {
+      WARN_NOT_OK(PinCurrentThreadToNumaNode(index_), "Failed to pin RPC worker thread");
+    }
     while (!stop_requested_) {
       ThreadPoolTask* task = nullptr;
       if (PopTask(&task)) {
@@ -110,7 +172,7 @@ class Worker {
   bool PopTask(ThreadPoolTask** task) {
     // First of all we try to get already queued task, w/o locking.
     // If there is no task, so we could go to waiting state.
-    if (share_->task_queue.pop(*task)) {
+    if (share_->Pop(home_queue_, task)) {
       return true;
     }
     std::unique_lock<std::mutex> lock(mutex_);
@@ -126,7 +188,7 @@ class Worker {
       // the worker queue. So worker queue could be empty in this case, and nobody was notified
       // about new task. So we check there for this case. This technique is similar to
       // double check.
-      if (share_->task_queue.pop(*task)) {
+      if (share_->Pop(home_queue_, task)) {
         return true;
       }
 
@@ -134,7 +196,7 @@ class Worker {
 
       // Sometimes another worker could steal task before we wake up. In this case we will
       // just enqueue ourselves back.
-      if (share_->task_queue.pop(*task)) {
+      if (share_->Pop(home_queue_, task)) {
         return true;
       }
     }
@@ -150,6 +212,8 @@ class Worker {
   }
 
   ThreadPoolShare* share_;
+  size_t index_ = 0;
+  size_t home_queue_ = 0;
   scoped_refptr<yb::Thread> thread_;
   std::mutex mutex_;
   std::condition_variable cond_;
@@ -179,8 +243,7 @@ class ThreadPool::Impl {
       task->Done(shutdown_status_);
       return false;
     }
-    bool added = share_.task_queue.push(task);
-    DCHECK(added); // BasketQueue always succeed.
+    share_.Push(task);
     Worker* worker = nullptr;
     while (share_.waiting_workers.pop(worker)) {
       if (worker->Notify()) {
@@ -219,7 +282,7 @@ class ThreadPool::Impl {
     {
       std::lock_guard lock(mutex_);
       if (closing_) {
-        CHECK(share_.task_queue.empty());
+        CHECK(share_.Empty());
         CHECK(workers_.empty());
         return;
       }
@@ -238,7 +301,7 @@ class ThreadPool::Impl {
     }
     workers_.clear();
     ThreadPoolTask* task = nullptr;
-    while (share_.task_queue.pop(task)) {
+    while (share_.Pop(0, &task)) {
       task->Done(shutdown_status_);
     }
   }
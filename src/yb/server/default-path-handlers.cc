@@ -48,8 +48,10 @@
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include <set>
@@ -80,6 +82,7 @@
 #include "yb/util/mem_tracker.h"
 #include "yb/util/memory/memory.h"
 #include "yb/util/metrics.h"
+#include "yb/util/monotime.h"
 #include "yb/util/jsonwriter.h"
 #include "yb/util/result.h"
 #include "yb/util/status_log.h"
@@ -94,6 +97,10 @@ TAG_FLAG(web_log_bytes, advanced);
 DEFINE_RUNTIME_bool(export_help_and_type_in_prometheus_metrics, true,
     "Include #TYPE and #HELP in Prometheus metrics output by default");
 
+DEFINE_RUNTIME_uint32(prometheus_metrics_snapshot_ttl_ms, 0,
+    "When positive, /prometheus-metrics output is kept for this time, and scrapes with the same "
+    "arguments are served from it instead of walking all metric entities again. 0 disables it.");
+
 DECLARE_int32(max_tables_metrics_breakdowns);
 DECLARE_bool(TEST_mini_cluster_mode);
 
@@ -107,6 +114,7 @@ using std::map;
 using std::vector;
 using strings::Substitute;
 
+using namespace std::literals;
 using namespace std::placeholders;
 
 namespace {
@@ -624,8 +632,9 @@ static void WriteMetricsAsJson(const MetricRegistry* const metrics,
               "Couldn't write JSON metrics over HTTP");
 }
 
-static void WriteMetricsForPrometheus(const MetricRegistry* const metrics,
-                               const Webserver::WebRequest& req, Webserver::WebResponse* resp) {
+static void DoWriteMetricsForPrometheus(const MetricRegistry* const metrics,
+                                        const Webserver::WebRequest& req,
+                                        Webserver::WebResponse* resp) {
   MetricPrometheusOptions opts;
   opts.export_help_and_type =
       ExportHelpAndType(GetAtomicFlag(&FLAGS_export_help_and_type_in_prometheus_metrics));
@@ -654,6 +663,67 @@ static void WriteMetricsForPrometheus(const MetricRegistry* const metrics,
   }
 }
 
+// Recent /prometheus-metrics outputs, keyed by registry and request arguments.
+class PrometheusMetricsSnapshots {
+ public:
+  static PrometheusMetricsSnapshots& Instance() {
+    static PrometheusMetricsSnapshots instance;
+    return instance;
+  }
+
+  bool Get(const std::string& key, std::stringstream* output) {
+    const auto ttl = GetAtomicFlag(&FLAGS_prometheus_metrics_snapshot_ttl_ms) * 1ms;
+    std::lock_guard lock(mutex_);
+    auto it = snapshots_.find(key);
+    if (it == snapshots_.end() || CoarseMonoClock::Now() > it->second.time + ttl) {
+      return false;
+    }
+    *output << it->second.output;
+    return true;
+  }
+
+  void Set(const std::string& key, std::string output) {
+    const auto now = CoarseMonoClock::Now();
+    const auto ttl = GetAtomicFlag(&FLAGS_prometheus_metrics_snapshot_ttl_ms) * 1ms;
+    std::lock_guard lock(mutex_);
+    std::erase_if(snapshots_, [now, ttl](const auto& entry) {
+      return now > entry.second.time + ttl;
+    });
+    snapshots_[key] = Snapshot {
+      .time = now,
+      .output = std::move(output),
+    };
+  }
+
+ private:
+  struct Snapshot {
+    CoarseTimePoint time;
+    std::string output;
+  };
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, Snapshot> snapshots_ GUARDED_BY(mutex_);
+};
+
+static void WriteMetricsForPrometheus(const MetricRegistry* const metrics,
+                               const Webserver::WebRequest& req, Webserver::WebResponse* resp) {
+  if (GetAtomicFlag(&FLAGS_prometheus_metrics_snapshot_ttl_ms) == 0) {
+    DoWriteMetricsForPrometheus(metrics, req, resp);
+    return;
+  }
+
+  auto key = Format("$0", static_cast<const void*>(metrics));
+  for (const auto& [name, value] : req.parsed_args) {
+    key += Format("&$0=$1", name, value);
+  }
+  auto& snapshots = PrometheusMetricsSnapshots::Instance();
+  if (snapshots.Get(key, &resp->output)) {
+    return;
+  }
+  DoWriteMetricsForPrometheus(metrics, req, resp);
+  snapshots.Set(key, resp->output.str());
+}
+
 static void HandleGetVersionInfo(
     const Webserver::WebRequest& req, Webserver::WebResponse* resp) {
   std::stringstream *output = &resp->output;
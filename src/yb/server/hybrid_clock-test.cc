@@ -31,6 +31,7 @@
 //
 
 #include <algorithm>
+#include <thread>
 
 #include "yb/util/logging.h"
 #include <gtest/gtest.h>
@@ -174,6 +175,37 @@ void HybridClockTest::RunMultiThreadedTest(int num_reads_per_update) {
   }
 }
 
+// Hybrid times assigned by concurrent threads should be unique, including ones assigned by
+// incrementing the logical component.
+TEST_F(HybridClockTest, ConcurrentNowIsUnique) {
+  constexpr int kNumThreads = 8;
+  constexpr int kReadsPerThread = 100000;
+
+  std::vector<std::vector<HybridTime>> results(kNumThreads);
+  std::vector<std::thread> threads;
+  for (auto& thread_results : results) {
+    threads.emplace_back([this, &thread_results] {
+      thread_results.reserve(kReadsPerThread);
+      for (int i = 0; i != kReadsPerThread; ++i) {
+        thread_results.push_back(clock_->Now());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<HybridTime> all;
+  for (const auto& thread_results : results) {
+    for (size_t i = 1; i < thread_results.size(); ++i) {
+      ASSERT_LT(thread_results[i - 1], thread_results[i]);
+    }
+    all.insert(all.end(), thread_results.begin(), thread_results.end());
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_TRUE(std::adjacent_find(all.begin(), all.end()) == all.end());
+}
+
 TEST_F(HybridClockTest, CompareHybridClocksToDelta) {
   EXPECT_EQ(1, CompareHybridTimesToDelta(
       HybridTime::FromMicrosecondsAndLogicalValue(1000, 10),
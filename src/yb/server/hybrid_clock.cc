@@ -150,7 +150,7 @@ HybridTimeRange HybridClock::NowRange() {
 void HybridClock::NowWithError(HybridTime *hybrid_time, uint64_t *max_error_usec) {
   DCHECK_EQ(state_, kInitialized) << "Clock not initialized. Must call Init() first.";
 
-  HybridClockComponents current_components = components_.load(boost::memory_order_acquire);
+  auto current = next_hybrid_time_.load(std::memory_order_acquire);
 
   auto now = clock_->Now();
   if (PREDICT_FALSE(!now.ok())) {
@@ -159,12 +159,14 @@ void HybridClock::NowWithError(HybridTime *hybrid_time, uint64_t *max_error_usec
   }
 
   // If the current time surpasses the last update just return it
-  HybridClockComponents new_components = { now->time_point, 1 };
+  auto now_hybrid_time = HybridTime::FromMicros(now->time_point).ToUint64();
+  auto current_usec = HybridTime(current).GetPhysicalValueMicros();
 
-  VLOG(4) << __func__ << ", new: " << new_components << ", current: " << current_components;
+  VLOG(4) << __func__ << ", now: " << HybridTime(now_hybrid_time)
+          << ", current: " << HybridTime(current);
 
-  if (now->time_point < current_components.last_usec) {
-    auto delta_us = current_components.last_usec - now->time_point;
+  if (now->time_point < current_usec) {
+    auto delta_us = current_usec - now->time_point;
     if (delta_us > FLAGS_max_clock_skew_usec) {
       auto delta = MonoDelta::FromMicroseconds(delta_us);
       auto max_allowed = MonoDelta::FromMicroseconds(FLAGS_max_clock_skew_usec);
@@ -186,9 +188,9 @@ void HybridClock::NowWithError(HybridTime *hybrid_time, uint64_t *max_error_usec
     }
   } else {
     // Loop over the check in case of concurrent updates making the CAS fail.
-    while (now->time_point > current_components.last_usec) {
-      if (components_.compare_exchange_weak(current_components, new_components)) {
-        *hybrid_time = HybridTime::FromMicros(new_components.last_usec);
+    while (now_hybrid_time >= current) {
+      if (next_hybrid_time_.compare_exchange_weak(current, now_hybrid_time + 1)) {
+        *hybrid_time = HybridTime(now_hybrid_time);
         *max_error_usec = now->max_error;
         if (PREDICT_FALSE(VLOG_IS_ON(2))) {
           VLOG(2) << "Current clock is higher than the last one. Resetting logical values."
@@ -217,19 +219,15 @@ void HybridClock::NowWithError(HybridTime *hybrid_time, uint64_t *max_error_usec
   // This broadens the error interval for both cases but always returns
   // a correct error interval.
 
-  do {
-    new_components.last_usec = current_components.last_usec;
-    new_components.logical = current_components.logical + 1;
-    new_components.HandleLogicalComponentOverflow();
-    // Loop over the check until the CAS succeeds, in case there are concurrent updates.
-  } while (!components_.compare_exchange_weak(current_components, new_components));
+  // Logical component is stored in the lowest bits, so its overflow is carried to the physical
+  // component by the increment itself.
+  *hybrid_time = HybridTime(next_hybrid_time_.fetch_add(1, std::memory_order_acq_rel));
+  if (PREDICT_FALSE(hybrid_time->GetLogicalValue() == 0)) {
+    YB_LOG_EVERY_N_SECS(WARNING, 5) << "Logical component overflow: " << *hybrid_time;
+  }
 
-  *max_error_usec = new_components.last_usec - (now->time_point - now->max_error);
+  *max_error_usec = hybrid_time->GetPhysicalValueMicros() - (now->time_point - now->max_error);
 
-  // We've already atomically incremented the logical, so subtract 1.
-  *hybrid_time = HybridTime::FromMicrosecondsAndLogicalValue(
-      new_components.last_usec,
-      narrow_cast<LogicalTimeComponent>(new_components.logical)).Decremented();
   if (PREDICT_FALSE(VLOG_IS_ON(2))) {
     VLOG(2) << "Current clock is lower than the last one. Returning last read and incrementing"
         " logical values. Hybrid time: " << *hybrid_time << " Error: " << *max_error_usec;
@@ -241,21 +239,16 @@ void HybridClock::Update(const HybridTime& to_update) {
     return;
   }
 
-  HybridClockComponents current_components = components_.load(boost::memory_order_acquire);
-  HybridClockComponents new_components = {
-    to_update.GetPhysicalValueMicros(), to_update.GetLogicalValue() + 1
-  };
+  auto current = next_hybrid_time_.load(std::memory_order_acquire);
+  auto new_next = to_update.ToUint64() + 1;
 
   // VLOG(4) crashes in TSAN mode
   if (VLOG_IS_ON(4)) {
-    LOG(INFO) << __func__ << ", new: " << new_components << ", current: " << current_components;
+    LOG(INFO) << __func__ << ", new: " << to_update << ", current: " << HybridTime(current);
   }
 
-  new_components.HandleLogicalComponentOverflow();
-
   // Keep trying to CAS until it works or until HT has advanced past this update.
-  while (current_components < new_components &&
-      !components_.compare_exchange_weak(current_components, new_components)) {}
+  while (current < new_next && !next_hybrid_time_.compare_exchange_weak(current, new_next)) {}
 }
 
 // Used to get the hybrid_time for metrics.
@@ -273,7 +266,7 @@ uint64_t HybridClock::ErrorForMetrics() {
 }
 
 int64_t HybridClock::SkewForMetrics() {
-  HybridClockComponents current_components = components_.load(boost::memory_order_acquire);
+  auto current = HybridTime(next_hybrid_time_.load(std::memory_order_acquire));
   auto now = clock_->Now();
   if (PREDICT_FALSE(!now.ok())) {
     LOG(DFATAL) << Substitute("Couldn't get the current time: Clock unsynchronized. "
@@ -281,33 +274,10 @@ int64_t HybridClock::SkewForMetrics() {
     return 0;
   }
   // Making sure we don't return a negative value.
-  int64_t potential_skew = current_components.last_usec - now->time_point;
+  int64_t potential_skew = current.GetPhysicalValueMicros() - now->time_point;
   return std::max<int64_t>(0, potential_skew);
 }
 
-std::string HybridClockComponents::ToString() const {
-  return Format("{ last_usec: $0 logical: $1 }", last_usec, logical);
-}
-
-std::ostream& operator<<(std::ostream& out, const HybridClockComponents& components) {
-  return out << components.ToString();
-}
-
-void HybridClockComponents::HandleLogicalComponentOverflow() {
-  if (logical > HybridTime::kLogicalBitMask) {
-    static constexpr uint64_t kMaxOverflowValue = 1ULL << HybridTime::kBitsForLogicalComponent;
-    if (logical > kMaxOverflowValue) {
-      LOG(FATAL) << "Logical component is too high: last_usec=" << last_usec
-                 << "logical=" << logical << ", max allowed is " << kMaxOverflowValue;
-    }
-    YB_LOG_EVERY_N_SECS(WARNING, 5) << "Logical component overflow: "
-        << "last_usec=" << last_usec << ", logical=" << logical;
-
-    last_usec += logical >> HybridTime::kBitsForLogicalComponent;
-    logical &= HybridTime::kLogicalBitMask;
-  }
-}
-
 void HybridClock::RegisterMetrics(const scoped_refptr<MetricEntity>& metric_entity) {
   METRIC_hybrid_clock_hybrid_time.InstantiateFunctionGauge(
       metric_entity,
@@ -38,8 +38,6 @@
 #include <sys/timex.h>
 #endif // !defined(__APPLE__)
 
-#include <boost/atomic.hpp>
-
 #include "yb/gutil/ref_counted.h"
 #include "yb/server/clock.h"
 #include "yb/util/locks.h"
@@ -48,40 +46,6 @@
 namespace yb {
 namespace server {
 
-struct HybridClockComponents {
-  // The last clock read/update, in microseconds.
-  MicrosTime last_usec = 0;
-
-  // The next logical value to be assigned to a hybrid time.
-  uint64_t logical = 0;
-
-  HybridClockComponents() noexcept {}
-
-  HybridClockComponents(MicrosTime last_usec_, LogicalTimeComponent logical_)
-      : last_usec(last_usec_),
-        logical(logical_) {
-  }
-
-  HybridClockComponents(HybridClockComponents&& other) = default;
-  HybridClockComponents(const HybridClockComponents& other) = default;
-  HybridClockComponents& operator=(const HybridClockComponents& other) = default;
-  HybridClockComponents& operator=(HybridClockComponents&& other) = default;
-
-  bool operator< (const HybridClockComponents& o) const {
-    return last_usec < o.last_usec || (last_usec == o.last_usec && logical < o.logical);
-  }
-
-  bool operator<= (const HybridClockComponents& o) const {
-    return last_usec < o.last_usec || (last_usec == o.last_usec && logical <= o.logical);
-  }
-
-  void HandleLogicalComponentOverflow();
-
-  std::string ToString() const;
-};
-
-std::ostream& operator<<(std::ostream& out, const HybridClockComponents& components);
-
 // The HybridTime clock.
 //
 // HybridTime should not be used on a distributed cluster running on OS X hosts,
@@ -133,7 +97,10 @@ class HybridClock : public Clock {
   int64_t SkewForMetrics();
 
   PhysicalClockPtr clock_;
-  boost::atomic<HybridClockComponents> components_{HybridClockComponents(0, 0)};
+  // The next hybrid time to be assigned, i.e. physical and logical components packed as in
+  // HybridTime. Logical values are assigned with fetch_add, so compare-and-swap is required only
+  // when the physical clock advances past this value or on Update with a higher hybrid time.
+  std::atomic<HybridTimeRepr> next_hybrid_time_{0};
   State state_ = kNotInitialized;
 
   // Clock metrics are set to detach to their last value. This means
@@ -50,11 +50,15 @@
 #endif  // YB_GPERFTOOLS_TCMALLOC
 
 #include <fstream>
+#include <map>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "yb/util/logging.h"
 
+#include "yb/ash/wait_state.h"
+
 #include "yb/gutil/map-util.h"
 #include "yb/gutil/strings/numbers.h"
 #include "yb/gutil/strings/split.h"
@@ -69,6 +73,7 @@
 #include "yb/util/monotime.h"
 #include "yb/util/size_literals.h"
 #include "yb/util/spinlock_profiling.h"
+#include "yb/util/stack_trace.h"
 #include "yb/util/status_log.h"
 #include "yb/util/status.h"
 #include "yb/util/symbolize.h"
@@ -89,6 +94,7 @@ using std::vector;
 namespace yb {
 
 const int PPROF_DEFAULT_SAMPLE_SECS = 30; // pprof default sample time in seconds.
+const int WAIT_STATES_DEFAULT_SAMPLE_INTERVAL_MS = 10;
 
 // pprof asks for the url /pprof/cmdline to figure out what application it's profiling.
 // The server should respond by sending the executable path.
@@ -287,6 +293,68 @@ static void PprofContentionHandler(const Webserver::WebRequest& req,
 }
 
 
+// Samples stacks of threads that adopted an ASH wait state every interval_ms during the requested
+// number of seconds. Each sampled stack is tagged with the wait state code, query id and tablet id
+// of the thread at the time of the sample, so CPU and wait time can be attributed to queries and
+// tablets. Samples can be restricted to a query or tablet with the query_id and tablet_id args.
+static void PprofWaitStatesHandler(const Webserver::WebRequest& req,
+                                   Webserver::WebResponse* resp) {
+  std::stringstream *output = &resp->output;
+  string secs_str = FindWithDefault(req.parsed_args, "seconds", "");
+  int32_t seconds = ParseLeadingInt32Value(secs_str.c_str(), PPROF_DEFAULT_SAMPLE_SECS);
+  string interval_str = FindWithDefault(req.parsed_args, "interval_ms", "");
+  int32_t interval_ms = std::max(ParseLeadingInt32Value(
+      interval_str.c_str(), WAIT_STATES_DEFAULT_SAMPLE_INTERVAL_MS), 1);
+  string query_id_str = FindWithDefault(req.parsed_args, "query_id", "");
+  int64_t query_id_filter = ParseLeadingInt64Value(query_id_str.c_str(), 0);
+  string tablet_id_filter = FindWithDefault(req.parsed_args, "tablet_id", "");
+
+  using SampleKey = std::tuple<ash::WaitStateCode, int64_t, TabletId, StackTrace>;
+  std::map<SampleKey, int64_t> samples;
+  int64_t num_rounds = 0;
+  int64_t failed_samples = 0;
+  const auto deadline = CoarseMonoClock::Now() + MonoDelta::FromSeconds(seconds);
+  while (CoarseMonoClock::Now() < deadline) {
+    auto thread_wait_states = ash::WaitStateInfo::AllThreadWaitStates();
+    vector<ThreadIdForStack> tids;
+    tids.reserve(thread_wait_states.size());
+    for (const auto& thread_wait_state : thread_wait_states) {
+      tids.push_back(thread_wait_state.tid);
+    }
+    auto stacks = ThreadStacks(tids);
+    for (size_t i = 0; i != thread_wait_states.size(); ++i) {
+      if (!stacks[i].ok()) {
+        ++failed_samples;
+        continue;
+      }
+      auto& wait_state = *thread_wait_states[i].wait_state;
+      auto query_id = wait_state.query_id();
+      auto tablet_id = wait_state.tablet_id();
+      if ((query_id_filter != 0 && query_id != query_id_filter) ||
+          (!tablet_id_filter.empty() && tablet_id != tablet_id_filter)) {
+        continue;
+      }
+      ++samples[SampleKey(wait_state.code(), query_id, std::move(tablet_id), *stacks[i])];
+    }
+    ++num_rounds;
+    SleepFor(MonoDelta::FromMilliseconds(interval_ms));
+  }
+
+  *output << "--- wait states" << endl;
+  *output << "sampling period ms = " << interval_ms << endl;
+  *output << "sampling rounds = " << num_rounds << endl;
+  *output << "Format: Count\tWait State\tQuery Id\tTablet Id @ Call Stack" << endl;
+  for (const auto& [key, count] : samples) {
+    const auto& [code, query_id, tablet_id, stack] = key;
+    *output << count << "\t" << code << "\t" << query_id << "\t" << tablet_id
+            << " @ " << stack.ToHexString(StackTrace::NO_FIX_CALLER_ADDRESSES)
+            << "\n" << stack.Symbolize()
+            << "\n-----------"
+            << endl;
+  }
+  *output << "Failed samples = " << failed_samples << endl;
+}
+
 // pprof asks for the url /pprof/symbol to map from hex addresses to variable names.
 // When the server receives a GET request for /pprof/symbol, it should return a line
 // formatted like: num_symbols: ###
@@ -366,6 +434,8 @@ void AddPprofPathHandlers(Webserver* webserver) {
       false /* is_styled */, false /* is_on_nav_bar */);
   webserver->RegisterPathHandler("/pprof/heap_snapshot", "", PprofHeapSnapshotHandler,
       true /* is_styled */, false /* is_on_nav_bar */);
+  webserver->RegisterPathHandler("/pprof/wait_states", "", PprofWaitStatesHandler,
+      false /* is_styled */, false /* is_on_nav_bar */);
 }
 
 } // namespace yb
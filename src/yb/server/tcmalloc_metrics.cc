@@ -38,6 +38,7 @@
 
 #include "yb/util/mem_tracker.h"
 #include "yb/util/metrics.h"
+#include "yb/util/size_class_pool.h"
 #include "yb/util/tcmalloc_util.h"
 #include "yb/util/logging.h"
 
@@ -88,6 +89,16 @@ METRIC_DEFINE_gauge_uint64(server, tcmalloc_current_total_thread_cache_bytes,
 
 #undef TCMALLOC_DISABLED_MSG
 
+METRIC_DEFINE_gauge_uint64(server, size_class_pool_hits,
+    "Size Class Pool Hits", yb::MetricUnit::kRequests,
+    "Number of allocations of hot objects, like RPC calls and tablet queries, that reused a block "
+    "cached by the size class pool.");
+
+METRIC_DEFINE_gauge_uint64(server, size_class_pool_misses,
+    "Size Class Pool Misses", yb::MetricUnit::kRequests,
+    "Number of allocations of hot objects, like RPC calls and tablet queries, that allocated a new "
+    "block from the heap because the size class pool had no cached blocks.");
+
 namespace yb {
 namespace tcmalloc {
 
@@ -105,6 +116,14 @@ static uint64_t GetTCMallocPropValue(const char* prop) {
   return value;
 }
 
+static uint64_t GetSizeClassPoolHits() {
+  return SizeClassPool::GetStats().hits;
+}
+
+static uint64_t GetSizeClassPoolMisses() {
+  return SizeClassPool::GetStats().misses;
+}
+
 #define REGISTER_TCMALLOC_METRIC(name1, name2) \
   entity->NeverRetire( \
       BOOST_PP_CAT(BOOST_PP_CAT(BOOST_PP_CAT(METRIC_, name1), _), name2).\
@@ -119,6 +138,10 @@ void RegisterMetrics(const scoped_refptr<MetricEntity>& entity) {
   REGISTER_TCMALLOC_METRIC(tcmalloc, pageheap_unmapped_bytes);
   REGISTER_TCMALLOC_METRIC(tcmalloc, max_total_thread_cache_bytes);
   REGISTER_TCMALLOC_METRIC(tcmalloc, current_total_thread_cache_bytes);
+  entity->NeverRetire(METRIC_size_class_pool_hits.InstantiateFunctionGauge(
+      entity, Bind(GetSizeClassPoolHits)));
+  entity->NeverRetire(METRIC_size_class_pool_misses.InstantiateFunctionGauge(
+      entity, Bind(GetSizeClassPoolMisses)));
 }
 
 #undef REGISTER_TCMALLOC_METRIC
@@ -0,0 +1,79 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <gtest/gtest.h>
+
+#include "yb/tablet/key_access_sampler.h"
+
+#include "yb/util/flags.h"
+#include "yb/util/format.h"
+#include "yb/util/test_macros.h"
+
+DECLARE_uint32(tablet_key_access_sampling_interval);
+DECLARE_uint32(tablet_key_access_window_sec);
+DECLARE_uint64(tablet_hot_key_accesses_per_sec_threshold);
+
+using namespace std::literals;
+
+namespace yb::tablet {
+
+TEST(KeyAccessSamplerTest, RateAndMedian) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_tablet_key_access_sampling_interval) = 2;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_tablet_key_access_window_sec) = 10;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_tablet_hot_key_accesses_per_sec_threshold) = 100;
+
+  const auto start = CoarseMonoClock::Now();
+  KeyAccessSampler sampler;
+
+  // Keys of most accesses are at the end of the key range, so the median of accessed keys is
+  // there as well.
+  constexpr uint64_t kNumAccesses = 2000;
+  uint64_t num_sampled = 0;
+  for (uint64_t i = 0; i != kNumAccesses; ++i) {
+    if (!sampler.RecordAccess()) {
+      continue;
+    }
+    ++num_sampled;
+    auto key = Format("key_$0", i % 10 == 0 ? 100 + i % 100 : 900 + i % 100);
+    sampler.AddSample(key, start + 1s);
+  }
+  ASSERT_EQ(num_sampled, kNumAccesses / 2);
+
+  // The rate is known only after the first window completes.
+  ASSERT_EQ(sampler.AccessesPerSecond(start + 5s), 0U);
+  ASSERT_FALSE(sampler.IsHot(start + 5s));
+
+  // The sampler was created a bit after start, so the first window ends before start + 11s.
+  const auto window_end = start + 11s;
+  auto rate = sampler.AccessesPerSecond(window_end);
+  ASSERT_GE(rate, kNumAccesses / 11);
+  ASSERT_LE(rate, kNumAccesses / 10);
+  ASSERT_TRUE(sampler.IsHot(window_end));
+  ASSERT_GE(sampler.MedianKey(window_end), "key_900");
+
+  // Idle tablet cools down.
+  ASSERT_EQ(sampler.AccessesPerSecond(window_end + 10s), 0U);
+  ASSERT_FALSE(sampler.IsHot(window_end + 10s));
+  ASSERT_EQ(sampler.MedianKey(window_end + 10s), "");
+}
+
+TEST(KeyAccessSamplerTest, Disabled) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_tablet_key_access_sampling_interval) = 0;
+  KeyAccessSampler sampler;
+  for (int i = 0; i != 100; ++i) {
+    ASSERT_FALSE(sampler.RecordAccess());
+  }
+  ASSERT_EQ(sampler.MedianKey(), "");
+}
+
+} // namespace yb::tablet
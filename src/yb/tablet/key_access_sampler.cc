@@ -0,0 +1,121 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/tablet/key_access_sampler.h"
+
+#include <algorithm>
+
+#include "yb/util/flags.h"
+#include "yb/util/random_util.h"
+
+using namespace std::literals;
+
+DEFINE_RUNTIME_uint32(tablet_key_access_sampling_interval, 64,
+    "Keys of one of this number of tablet reads and writes are sampled to detect the median of "
+    "accessed keys of hot tablets. 0 disables tracking of tablet accesses.");
+TAG_FLAG(tablet_key_access_sampling_interval, advanced);
+
+DEFINE_RUNTIME_uint32(tablet_key_access_max_samples, 256,
+    "Max number of accessed keys sampled per tablet during one tablet_key_access_window_sec "
+    "window.");
+TAG_FLAG(tablet_key_access_max_samples, advanced);
+
+DEFINE_RUNTIME_uint32(tablet_key_access_window_sec, 60,
+    "Duration of the window used to calculate the tablet access rate.");
+TAG_FLAG(tablet_key_access_window_sec, advanced);
+
+DEFINE_RUNTIME_uint64(tablet_hot_key_accesses_per_sec_threshold, 0,
+    "A tablet that gets at least this number of reads and writes per second is reported as hot, "
+    "and is split at the median of accessed keys, regardless of its size. 0 disables load based "
+    "tablet splitting.");
+
+namespace yb::tablet {
+
+namespace {
+
+// Median of too few samples does not reflect the distribution of accessed keys.
+constexpr size_t kMinSamplesForMedian = 16;
+
+} // namespace
+
+KeyAccessSampler::KeyAccessSampler() : window_start_(CoarseMonoClock::Now()) {
+}
+
+bool KeyAccessSampler::RecordAccess() {
+  auto interval = FLAGS_tablet_key_access_sampling_interval;
+  if (interval == 0) {
+    return false;
+  }
+  return num_accesses_.fetch_add(1, std::memory_order_relaxed) % interval == 0;
+}
+
+void KeyAccessSampler::AddSample(Slice key, CoarseTimePoint now) {
+  const size_t max_samples = FLAGS_tablet_key_access_max_samples;
+  std::lock_guard lock(mutex_);
+  RollWindowIfNeeded(now);
+  ++num_offered_samples_;
+  if (samples_.size() < max_samples) {
+    samples_.push_back(key.ToBuffer());
+    return;
+  }
+  // Reservoir sampling keeps each of the offered keys with the same probability.
+  auto idx = RandomUniformInt<uint64_t>(0, num_offered_samples_ - 1);
+  if (idx < samples_.size()) {
+    samples_[idx] = key.ToBuffer();
+  }
+}
+
+uint64_t KeyAccessSampler::AccessesPerSecond(CoarseTimePoint now) {
+  std::lock_guard lock(mutex_);
+  RollWindowIfNeeded(now);
+  return accesses_per_second_;
+}
+
+bool KeyAccessSampler::IsHot(CoarseTimePoint now) {
+  auto threshold = FLAGS_tablet_hot_key_accesses_per_sec_threshold;
+  return threshold != 0 && AccessesPerSecond(now) >= threshold;
+}
+
+std::string KeyAccessSampler::MedianKey(CoarseTimePoint now) {
+  std::vector<Slice> keys;
+  std::lock_guard lock(mutex_);
+  RollWindowIfNeeded(now);
+  keys.reserve(prev_samples_.size() + samples_.size());
+  for (const auto* samples : {&prev_samples_, &samples_}) {
+    keys.insert(keys.end(), samples->begin(), samples->end());
+  }
+  if (keys.size() < kMinSamplesForMedian) {
+    return std::string();
+  }
+  auto middle = keys.begin() + keys.size() / 2;
+  std::nth_element(keys.begin(), middle, keys.end());
+  return middle->ToBuffer();
+}
+
+void KeyAccessSampler::RollWindowIfNeeded(CoarseTimePoint now) {
+  const auto window = FLAGS_tablet_key_access_window_sec * 1s;
+  const auto elapsed = now - window_start_;
+  if (elapsed < window) {
+    return;
+  }
+  const auto num_accesses = num_accesses_.load(std::memory_order_relaxed);
+  const auto elapsed_ms = std::max<int64_t>(ToMilliseconds(elapsed), 1);
+  accesses_per_second_ = (num_accesses - window_start_accesses_) * 1000 / elapsed_ms;
+  window_start_accesses_ = num_accesses;
+  window_start_ = now;
+  num_offered_samples_ = 0;
+  prev_samples_.swap(samples_);
+  samples_.clear();
+}
+
+} // namespace yb::tablet
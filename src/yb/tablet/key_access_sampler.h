@@ -0,0 +1,67 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "yb/gutil/thread_annotations.h"
+
+#include "yb/util/monotime.h"
+#include "yb/util/slice.h"
+
+namespace yb::tablet {
+
+// Tracks the access rate of a tablet and keeps a uniform sample of accessed keys, so a hot tablet
+// could be split at the median of accessed keys instead of the median of stored data.
+//
+// Accesses are accounted in windows of tablet_key_access_window_sec. The rate and the sampled keys
+// of the last complete window are used, together with the keys sampled in the current window.
+class KeyAccessSampler {
+ public:
+  KeyAccessSampler();
+
+  // Registers an access to the tablet. Returns true when the key of this access should be passed
+  // to AddSample, i.e. for one of tablet_key_access_sampling_interval accesses.
+  bool RecordAccess();
+
+  void AddSample(Slice key, CoarseTimePoint now = CoarseMonoClock::Now());
+
+  // Returns the number of accesses per second during the last complete window.
+  uint64_t AccessesPerSecond(CoarseTimePoint now = CoarseMonoClock::Now());
+
+  // Returns true if the access rate reached tablet_hot_key_accesses_per_sec_threshold.
+  bool IsHot(CoarseTimePoint now = CoarseMonoClock::Now());
+
+  // Returns the median of sampled keys, or an empty string if there are not enough samples.
+  std::string MedianKey(CoarseTimePoint now = CoarseMonoClock::Now());
+
+ private:
+  void RollWindowIfNeeded(CoarseTimePoint now) REQUIRES(mutex_);
+
+  std::atomic<uint64_t> num_accesses_{0};
+
+  std::mutex mutex_;
+  CoarseTimePoint window_start_ GUARDED_BY(mutex_);
+  uint64_t window_start_accesses_ GUARDED_BY(mutex_) = 0;
+  uint64_t accesses_per_second_ GUARDED_BY(mutex_) = 0;
+  // Number of keys passed to AddSample in the current window, used for reservoir sampling.
+  uint64_t num_offered_samples_ GUARDED_BY(mutex_) = 0;
+  std::vector<std::string> samples_ GUARDED_BY(mutex_);
+  std::vector<std::string> prev_samples_ GUARDED_BY(mutex_);
+};
+
+} // namespace yb::tablet
@@ -0,0 +1,98 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <gtest/gtest.h>
+
+#include "yb/tablet/live_intent_ranges.h"
+
+#include "yb/util/test_macros.h"
+
+namespace yb::tablet {
+
+TEST(LiveIntentRangesTest, MayOverlap) {
+  LiveIntentRanges ranges;
+  ASSERT_FALSE(ranges.MayOverlap(Slice(), Slice()));
+
+  auto txn1 = TransactionId::GenerateRandom();
+  auto txn2 = TransactionId::GenerateRandom();
+  ranges.Extend(txn1, "c", "e");
+  ASSERT_TRUE(ranges.MayOverlap(Slice(), Slice()));
+  ASSERT_TRUE(ranges.MayOverlap("d", "f"));
+  ASSERT_TRUE(ranges.MayOverlap("a", "d"));
+  ASSERT_TRUE(ranges.MayOverlap("a", Slice()));
+  ASSERT_FALSE(ranges.MayOverlap("a", "c"));
+  ASSERT_FALSE(ranges.MayOverlap("e", "g"));
+  ASSERT_FALSE(ranges.MayOverlap("e", Slice()));
+
+  ranges.Extend(txn2, "g", "h");
+  ASSERT_FALSE(ranges.MayOverlap("e", "g"));
+  ASSERT_TRUE(ranges.MayOverlap("e", Slice()));
+
+  // Extending range of the first transaction merges it with range of the second one.
+  ranges.Extend(txn1, "b", "g");
+  ASSERT_TRUE(ranges.MayOverlap("e", "g"));
+  ASSERT_FALSE(ranges.MayOverlap("a", "b"));
+
+  ranges.Remove(txn1);
+  ASSERT_EQ(ranges.num_transactions(), 1U);
+  ASSERT_FALSE(ranges.MayOverlap("a", "b"));
+  ASSERT_TRUE(ranges.MayOverlap("g", "h"));
+
+  ranges.Remove(txn2);
+  ASSERT_FALSE(ranges.MayOverlap(Slice(), Slice()));
+}
+
+TEST(LiveIntentRangesTest, Unbounded) {
+  LiveIntentRanges ranges;
+  auto txn1 = TransactionId::GenerateRandom();
+  auto txn2 = TransactionId::GenerateRandom();
+  ranges.Extend(txn1, "c", "e");
+  ranges.SetUnbounded(txn2);
+  ASSERT_TRUE(ranges.MayOverlap("x", "y"));
+
+  // Extend does not make unbounded transaction bounded.
+  ranges.Extend(txn2, "c", "d");
+  ASSERT_TRUE(ranges.MayOverlap("x", "y"));
+
+  ranges.Remove(txn2);
+  ASSERT_FALSE(ranges.MayOverlap("x", "y"));
+  ASSERT_TRUE(ranges.MayOverlap("c", "d"));
+
+  ranges.SetUnbounded(txn2);
+  ranges.Clear();
+  ASSERT_EQ(ranges.num_transactions(), 0U);
+  ASSERT_FALSE(ranges.MayOverlap(Slice(), Slice()));
+}
+
+TEST(LiveIntentRangesTest, Rebuild) {
+  LiveIntentRanges ranges;
+  std::vector<TransactionId> transactions;
+  for (char ch = 'a'; ch <= 'z'; ++ch) {
+    transactions.push_back(TransactionId::GenerateRandom());
+    std::string start(1, ch);
+    ranges.Extend(transactions.back(), start, start + '\xff');
+  }
+  auto kept = transactions.back();
+  transactions.pop_back();
+  for (const auto& id : transactions) {
+    ranges.Remove(id);
+  }
+  ASSERT_EQ(ranges.num_transactions(), 1U);
+  // Union is rebuilt after enough removals, so it does not cover removed transactions anymore.
+  ASSERT_FALSE(ranges.MayOverlap("a", "y"));
+  ASSERT_TRUE(ranges.MayOverlap("z", Slice()));
+  ranges.Remove(kept);
+  ASSERT_FALSE(ranges.MayOverlap(Slice(), Slice()));
+}
+
+}  // namespace yb::tablet
@@ -0,0 +1,133 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/tablet/live_intent_ranges.h"
+
+#include <mutex>
+
+namespace yb::tablet {
+
+void LiveIntentRanges::Extend(const TransactionId& id, Slice start, Slice end) {
+  std::lock_guard lock(mutex_);
+  auto& range = transactions_[id];
+  if (range.unbounded) {
+    return;
+  }
+  if (range.end.empty()) {
+    range.start = start.ToBuffer();
+    range.end = end.ToBuffer();
+  } else {
+    bool changed = false;
+    if (start < Slice(range.start)) {
+      range.start = start.ToBuffer();
+      changed = true;
+    }
+    if (end > Slice(range.end)) {
+      range.end = end.ToBuffer();
+      changed = true;
+    }
+    if (!changed) {
+      return;
+    }
+  }
+  AddToMergedUnlocked(start, end);
+}
+
+void LiveIntentRanges::SetUnbounded(const TransactionId& id) {
+  std::lock_guard lock(mutex_);
+  auto& range = transactions_[id];
+  if (!range.unbounded) {
+    range.unbounded = true;
+    ++num_unbounded_;
+  }
+}
+
+void LiveIntentRanges::Remove(const TransactionId& id) {
+  std::lock_guard lock(mutex_);
+  auto it = transactions_.find(id);
+  if (it == transactions_.end()) {
+    return;
+  }
+  if (it->second.unbounded) {
+    --num_unbounded_;
+  }
+  ++removed_since_rebuild_;
+  transactions_.erase(it);
+  if (transactions_.empty()) {
+    merged_.clear();
+    removed_since_rebuild_ = 0;
+  } else if (removed_since_rebuild_ > transactions_.size()) {
+    // Amortizes the cost of rebuild over removed transactions.
+    RebuildMergedUnlocked();
+  }
+}
+
+void LiveIntentRanges::Clear() {
+  std::lock_guard lock(mutex_);
+  transactions_.clear();
+  merged_.clear();
+  num_unbounded_ = 0;
+  removed_since_rebuild_ = 0;
+}
+
+bool LiveIntentRanges::MayOverlap(Slice lower, Slice upper) const {
+  std::shared_lock lock(mutex_);
+  if (num_unbounded_) {
+    return true;
+  }
+  auto it = merged_.upper_bound(lower.AsStringView());
+  if (it != merged_.begin() && Slice(std::prev(it)->second) > lower) {
+    return true;
+  }
+  return it != merged_.end() && (upper.empty() || Slice(it->first) < upper);
+}
+
+size_t LiveIntentRanges::num_transactions() const {
+  std::shared_lock lock(mutex_);
+  return transactions_.size();
+}
+
+void LiveIntentRanges::AddToMergedUnlocked(Slice start, Slice end) {
+  auto new_start = start.ToBuffer();
+  auto new_end = end.ToBuffer();
+  auto it = merged_.upper_bound(start.AsStringView());
+  if (it != merged_.begin()) {
+    auto prev = std::prev(it);
+    if (Slice(prev->second) >= start) {
+      if (Slice(prev->second) >= end) {
+        return;
+      }
+      new_start = prev->first;
+      merged_.erase(prev);
+    }
+  }
+  while (it != merged_.end() && Slice(it->first) <= end) {
+    if (Slice(it->second) > Slice(new_end)) {
+      new_end = it->second;
+    }
+    it = merged_.erase(it);
+  }
+  merged_.emplace_hint(it, std::move(new_start), std::move(new_end));
+}
+
+void LiveIntentRanges::RebuildMergedUnlocked() {
+  merged_.clear();
+  removed_since_rebuild_ = 0;
+  for (const auto& [id, range] : transactions_) {
+    if (!range.unbounded && !range.end.empty()) {
+      AddToMergedUnlocked(range.start, range.end);
+    }
+  }
+}
+
+}  // namespace yb::tablet
@@ -0,0 +1,76 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "yb/common/transaction.h"
+
+#include "yb/gutil/thread_annotations.h"
+
+#include "yb/util/slice.h"
+
+namespace yb::tablet {
+
+// In memory summary of intents DB key ranges that could contain intents of live transactions.
+//
+// Each transaction is tracked with a single [start, end) range that covers all its intent keys,
+// or as unbounded when its keys are not known, e.g. for transactions loaded from intents DB.
+// The summary is conservative: it could report overlap for a range without intents, but never
+// the opposite, as long as the range is extended before the intents are written and removed only
+// after intents were applied or cleaned.
+class LiveIntentRanges {
+ public:
+  // Extends range of the specified transaction to cover [start, end).
+  void Extend(const TransactionId& id, Slice start, Slice end) EXCLUDES(mutex_);
+
+  // Marks the specified transaction as one that could have intents anywhere.
+  void SetUnbounded(const TransactionId& id) EXCLUDES(mutex_);
+
+  void Remove(const TransactionId& id) EXCLUDES(mutex_);
+
+  void Clear() EXCLUDES(mutex_);
+
+  // Returns false if no tracked range overlaps [lower, upper).
+  // Empty upper means that the range is not bounded from above.
+  bool MayOverlap(Slice lower, Slice upper) const EXCLUDES(mutex_);
+
+  size_t num_transactions() const EXCLUDES(mutex_);
+
+ private:
+  struct TransactionRange {
+    std::string start;
+    std::string end;
+    bool unbounded = false;
+  };
+
+  void AddToMergedUnlocked(Slice start, Slice end) REQUIRES(mutex_);
+  void RebuildMergedUnlocked() REQUIRES(mutex_);
+
+  mutable std::shared_mutex mutex_;
+  std::unordered_map<TransactionId, TransactionRange, TransactionIdHash> transactions_
+      GUARDED_BY(mutex_);
+  size_t num_unbounded_ GUARDED_BY(mutex_) = 0;
+
+  // Union of ranges of bounded transactions, maps start of the range to its end. Ranges are
+  // disjoint. Removal of transactions does not shrink the union immediately, it is rebuilt only
+  // after enough removals, so it could also cover ranges of recently removed transactions.
+  std::map<std::string, std::string, std::less<>> merged_ GUARDED_BY(mutex_);
+  size_t removed_since_rebuild_ GUARDED_BY(mutex_) = 0;
+};
+
+}  // namespace yb::tablet
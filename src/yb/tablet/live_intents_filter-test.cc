@@ -0,0 +1,91 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <gtest/gtest.h>
+
+#include "yb/tablet/live_intents_filter.h"
+
+#include "yb/util/flags.h"
+#include "yb/util/test_macros.h"
+
+DECLARE_uint64(live_intents_filter_max_keys_per_transaction);
+
+namespace yb::tablet {
+
+namespace {
+
+constexpr size_t kNumCounters = 1 << 16;
+
+std::vector<uint64_t> Hashes(
+    std::initializer_list<std::pair<const char*, bool>> keys) {
+  std::vector<uint64_t> result;
+  for (const auto& [key, strong] : keys) {
+    result.push_back(LiveIntentsFilter::KeyHash(key, strong));
+  }
+  return result;
+}
+
+} // namespace
+
+TEST(LiveIntentsFilterTest, MayConflict) {
+  LiveIntentsFilter filter(kNumCounters);
+  ASSERT_FALSE(filter.MayConflict("a", /* strong= */ true));
+
+  auto txn1 = TransactionId::GenerateRandom();
+  auto txn2 = TransactionId::GenerateRandom();
+  filter.Add(txn1, Hashes({{"row", true}, {"table", false}}));
+
+  // Strong intent conflicts with any intent, weak intent conflicts only with strong intent.
+  ASSERT_TRUE(filter.MayConflict("row", /* strong= */ true));
+  ASSERT_TRUE(filter.MayConflict("row", /* strong= */ false));
+  ASSERT_TRUE(filter.MayConflict("table", /* strong= */ true));
+  ASSERT_FALSE(filter.MayConflict("table", /* strong= */ false));
+  ASSERT_FALSE(filter.MayConflict("other_row", /* strong= */ true));
+
+  filter.Add(txn2, Hashes({{"row", true}, {"table", false}}));
+  filter.Remove(txn1);
+  ASSERT_EQ(filter.num_transactions(), 1U);
+  ASSERT_TRUE(filter.MayConflict("row", /* strong= */ false));
+  ASSERT_TRUE(filter.MayConflict("table", /* strong= */ true));
+
+  filter.Remove(txn2);
+  ASSERT_FALSE(filter.MayConflict("row", /* strong= */ true));
+  ASSERT_FALSE(filter.MayConflict("table", /* strong= */ true));
+}
+
+TEST(LiveIntentsFilterTest, Unbounded) {
+  LiveIntentsFilter filter(kNumCounters);
+  auto txn1 = TransactionId::GenerateRandom();
+  auto txn2 = TransactionId::GenerateRandom();
+  filter.Add(txn1, Hashes({{"row", true}}));
+  filter.SetUnbounded(txn2);
+  ASSERT_TRUE(filter.MayConflict("other_row", /* strong= */ false));
+
+  filter.Remove(txn2);
+  ASSERT_FALSE(filter.MayConflict("other_row", /* strong= */ true));
+  ASSERT_TRUE(filter.MayConflict("row", /* strong= */ false));
+
+  // Transaction with too many keys becomes unbounded.
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_live_intents_filter_max_keys_per_transaction) = 2;
+  filter.Add(txn2, Hashes({{"a", true}, {"b", true}, {"c", true}}));
+  ASSERT_TRUE(filter.MayConflict("other_row", /* strong= */ false));
+  filter.Remove(txn2);
+  ASSERT_FALSE(filter.MayConflict("a", /* strong= */ true));
+  ASSERT_TRUE(filter.MayConflict("row", /* strong= */ true));
+
+  filter.Clear();
+  ASSERT_EQ(filter.num_transactions(), 0U);
+  ASSERT_FALSE(filter.MayConflict("row", /* strong= */ true));
+}
+
+}  // namespace yb::tablet
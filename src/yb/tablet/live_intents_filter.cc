@@ -0,0 +1,174 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/tablet/live_intents_filter.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "yb/util/flags.h"
+#include "yb/util/hash_util.h"
+
+DEFINE_RUNTIME_uint64(live_intents_filter_max_keys_per_transaction, 10000,
+                      "Max number of intent keys of a single transaction tracked by the live "
+                      "intents filter. Transaction with more keys makes the filter report possible "
+                      "conflict for any key while the transaction is live.");
+
+namespace yb::tablet {
+
+namespace {
+
+constexpr uint64_t kWeakSeed = 0x9e3779b97f4a7c15ULL;
+constexpr uint64_t kStrongSeed = 0xc2b2ae3d27d4eb4fULL;
+constexpr size_t kNumProbes = 2;
+constexpr uint8_t kMaxCounter = std::numeric_limits<uint8_t>::max();
+
+size_t RoundUpToPowerOf2(size_t value) {
+  size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+// Double hashing, second hash is odd so probes are distinct for power of 2 size.
+template <class F>
+void ForEachProbe(uint64_t key_hash, size_t mask, const F& f) {
+  auto h1 = key_hash & 0xffffffff;
+  auto h2 = (key_hash >> 32) | 1;
+  for (size_t i = 0; i != kNumProbes; ++i) {
+    f((h1 + i * h2) & mask);
+  }
+}
+
+} // namespace
+
+LiveIntentsFilter::LiveIntentsFilter(size_t num_counters)
+    : mask_(RoundUpToPowerOf2(std::max<size_t>(num_counters, 1)) - 1),
+      counters_(new std::atomic<uint8_t>[mask_ + 1]) {
+  for (size_t i = 0; i <= mask_; ++i) {
+    counters_[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+LiveIntentsFilter::~LiveIntentsFilter() = default;
+
+uint64_t LiveIntentsFilter::KeyHash(Slice doc_path, bool strong) {
+  return HashUtil::MurmurHash2_64(
+      doc_path.data(), doc_path.size(), strong ? kStrongSeed : kWeakSeed);
+}
+
+void LiveIntentsFilter::Add(const TransactionId& id, const std::vector<uint64_t>& key_hashes) {
+  std::lock_guard lock(mutex_);
+  auto& keys = transactions_[id];
+  if (keys.unbounded) {
+    return;
+  }
+  if (keys.key_hashes.size() + key_hashes.size() >
+          FLAGS_live_intents_filter_max_keys_per_transaction) {
+    for (auto key_hash : keys.key_hashes) {
+      Decrement(key_hash);
+    }
+    keys.key_hashes = std::vector<uint64_t>();
+    keys.unbounded = true;
+    num_unbounded_.fetch_add(1, std::memory_order_acq_rel);
+    return;
+  }
+  for (auto key_hash : key_hashes) {
+    Increment(key_hash);
+  }
+  keys.key_hashes.insert(keys.key_hashes.end(), key_hashes.begin(), key_hashes.end());
+}
+
+void LiveIntentsFilter::SetUnbounded(const TransactionId& id) {
+  std::lock_guard lock(mutex_);
+  auto& keys = transactions_[id];
+  if (!keys.unbounded) {
+    for (auto key_hash : keys.key_hashes) {
+      Decrement(key_hash);
+    }
+    keys.key_hashes = std::vector<uint64_t>();
+    keys.unbounded = true;
+    num_unbounded_.fetch_add(1, std::memory_order_acq_rel);
+  }
+}
+
+void LiveIntentsFilter::Remove(const TransactionId& id) {
+  std::lock_guard lock(mutex_);
+  auto it = transactions_.find(id);
+  if (it == transactions_.end()) {
+    return;
+  }
+  if (it->second.unbounded) {
+    num_unbounded_.fetch_sub(1, std::memory_order_acq_rel);
+  }
+  for (auto key_hash : it->second.key_hashes) {
+    Decrement(key_hash);
+  }
+  transactions_.erase(it);
+}
+
+void LiveIntentsFilter::Clear() {
+  std::lock_guard lock(mutex_);
+  transactions_.clear();
+  num_unbounded_.store(0, std::memory_order_release);
+  for (size_t i = 0; i <= mask_; ++i) {
+    counters_[i].store(0, std::memory_order_release);
+  }
+}
+
+bool LiveIntentsFilter::MayConflict(Slice doc_path, bool strong) const {
+  if (num_unbounded_.load(std::memory_order_acquire) != 0) {
+    return true;
+  }
+  if (Contains(KeyHash(doc_path, /* strong= */ true))) {
+    return true;
+  }
+  return strong && Contains(KeyHash(doc_path, /* strong= */ false));
+}
+
+size_t LiveIntentsFilter::num_transactions() const {
+  std::lock_guard lock(mutex_);
+  return transactions_.size();
+}
+
+void LiveIntentsFilter::Increment(uint64_t key_hash) {
+  ForEachProbe(key_hash, mask_, [this](size_t index) {
+    auto& counter = counters_[index];
+    auto value = counter.load(std::memory_order_relaxed);
+    // Saturated counter is never decremented, since the number of its keys is unknown.
+    if (value != kMaxCounter) {
+      counter.store(value + 1, std::memory_order_release);
+    }
+  });
+}
+
+void LiveIntentsFilter::Decrement(uint64_t key_hash) {
+  ForEachProbe(key_hash, mask_, [this](size_t index) {
+    auto& counter = counters_[index];
+    auto value = counter.load(std::memory_order_relaxed);
+    if (value != kMaxCounter) {
+      counter.store(value - 1, std::memory_order_release);
+    }
+  });
+}
+
+bool LiveIntentsFilter::Contains(uint64_t key_hash) const {
+  bool result = true;
+  ForEachProbe(key_hash, mask_, [this, &result](size_t index) {
+    result = result && counters_[index].load(std::memory_order_acquire) != 0;
+  });
+  return result;
+}
+
+}  // namespace yb::tablet
@@ -0,0 +1,87 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "yb/common/transaction.h"
+
+#include "yb/gutil/thread_annotations.h"
+
+#include "yb/util/slice.h"
+
+namespace yb::tablet {
+
+// In memory counting bloom filter of doc paths that have intents of live transactions.
+//
+// Strong and weak intents are tracked separately, so it could answer whether an intent of
+// specified strength could conflict with intents of live transactions on the same doc path.
+// The filter is conservative: it could report possible conflict when there is no conflicting
+// intent, but never the opposite, as long as keys are added before they become visible to conflict
+// resolution and the transaction is removed only after its intents were applied or cleaned.
+//
+// Keys of each transaction are remembered as hashes, so they could be removed from the filter with
+// the transaction. Transactions with too many keys, or with unknown keys, make the filter report
+// possible conflict for any key while they are live.
+class LiveIntentsFilter {
+ public:
+  // num_counters is rounded up to the power of 2.
+  explicit LiveIntentsFilter(size_t num_counters);
+  ~LiveIntentsFilter();
+
+  // Hash of the doc path of an intent, that is passed to Add.
+  static uint64_t KeyHash(Slice doc_path, bool strong);
+
+  // Adds specified key hashes of intents of the transaction to the filter.
+  void Add(const TransactionId& id, const std::vector<uint64_t>& key_hashes) EXCLUDES(mutex_);
+
+  // Marks the specified transaction as one that could have intents on any key.
+  void SetUnbounded(const TransactionId& id) EXCLUDES(mutex_);
+
+  void Remove(const TransactionId& id) EXCLUDES(mutex_);
+
+  void Clear() EXCLUDES(mutex_);
+
+  // Returns false if there is no intent of a live transaction on doc_path that conflicts with
+  // intent of specified strength. Strong intent conflicts with all intents on the same doc path,
+  // while weak intent conflicts with strong intents only.
+  bool MayConflict(Slice doc_path, bool strong) const;
+
+  size_t num_transactions() const EXCLUDES(mutex_);
+
+ private:
+  struct TransactionKeys {
+    std::vector<uint64_t> key_hashes;
+    bool unbounded = false;
+  };
+
+  void Increment(uint64_t key_hash) REQUIRES(mutex_);
+  void Decrement(uint64_t key_hash) REQUIRES(mutex_);
+  bool Contains(uint64_t key_hash) const;
+
+  const size_t mask_;
+  std::unique_ptr<std::atomic<uint8_t>[]> counters_;
+  // Number of live unbounded transactions, conflict is possible with any key while it is not zero.
+  std::atomic<size_t> num_unbounded_{0};
+
+  mutable std::mutex mutex_;
+  std::unordered_map<TransactionId, TransactionKeys, TransactionIdHash> transactions_
+      GUARDED_BY(mutex_);
+};
+
+}  // namespace yb::tablet
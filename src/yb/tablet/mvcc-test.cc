@@ -42,6 +42,7 @@
 
 #include "yb/util/atomic.h"
 #include "yb/util/enums.h"
+#include "yb/util/flags.h"
 #include "yb/util/random_util.h"
 #include "yb/util/scope_exit.h"
 #include "yb/util/status.h"
@@ -52,6 +53,8 @@ using std::vector;
 
 using yb::server::LogicalClock;
 
+DECLARE_bool(mvcc_lock_free_safe_time);
+
 namespace yb {
 namespace tablet {
 
@@ -367,5 +370,63 @@ TEST_F(MvccTest, WaitForSafeTime) {
   ASSERT_FALSE(manager_.SafeTime(ht3, CoarseMonoClock::now() + 100ms, FixedHybridTimeLease()));
 }
 
+TEST_F(MvccTest, PromiseSafeTime) {
+  constexpr uint64_t kLead = 10;
+  constexpr uint64_t kLease = 20;
+  auto now = clock_->Now();
+  FixedHybridTimeLease ht_lease {
+    .time = now,
+    .lease = AddLogical(now, kLease),
+  };
+  auto promised_time = AddLogical(now, kLead);
+  ASSERT_EQ(promised_time, manager_.PromiseSafeTime(promised_time, ht_lease));
+
+  // Operations added after the promise get hybrid time past the promised one, and the clock is
+  // advanced past it.
+  HybridTime ht1 = manager_.AddLeaderPending(OpId(1, 1));
+  ASSERT_GT(ht1, promised_time);
+  ASSERT_GT(clock_->Now(), ht1);
+
+  // Safe time does not pass pending operations.
+  ASSERT_EQ(ht1.Decremented(), manager_.PromiseSafeTime(AddLogical(ht1, kLead), ht_lease));
+  manager_.Replicated(ht1, OpId(1, 1));
+
+  // Promised time is limited by the lease.
+  now = clock_->Now();
+  ht_lease = {
+    .time = now,
+    .lease = AddLogical(now, kLease),
+  };
+  ASSERT_EQ(ht_lease.lease, manager_.PromiseSafeTime(AddLogical(now, kLease * 2), ht_lease));
+  HybridTime ht2 = manager_.AddLeaderPending(OpId(1, 2));
+  ASSERT_GT(ht2, ht_lease.lease);
+  manager_.Replicated(ht2, OpId(1, 2));
+}
+
+TEST_F(MvccTest, LockFreeSafeTime) {
+  auto safe_time = manager_.SafeTime(FixedHybridTimeLease());
+  HybridTime ht1 = manager_.AddLeaderPending(OpId(1, 1));
+  ASSERT_GT(ht1, safe_time);
+
+  // Already returned safe time satisfies the request, so it is returned as is.
+  ASSERT_EQ(safe_time, manager_.SafeTime(
+      safe_time, CoarseMonoClock::now() + 100ms, FixedHybridTimeLease()));
+
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_mvcc_lock_free_safe_time) = false;
+  ASSERT_EQ(ht1.Decremented(), manager_.SafeTime(
+      safe_time, CoarseMonoClock::now() + 100ms, FixedHybridTimeLease()));
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_mvcc_lock_free_safe_time) = true;
+
+  // Safe time returned under the mutex is remembered.
+  ASSERT_EQ(ht1.Decremented(), manager_.SafeTime(
+      AddLogical(safe_time, 1), CoarseMonoClock::now() + 100ms, FixedHybridTimeLease()));
+
+  // Requests past the already returned safe time still wait for pending operations.
+  ASSERT_FALSE(manager_.SafeTime(ht1, CoarseMonoClock::now() + 100ms, FixedHybridTimeLease()));
+  // Replicated operations are covered without acquiring the mutex.
+  manager_.Replicated(ht1, OpId(1, 1));
+  ASSERT_EQ(ht1, manager_.SafeTime(ht1, CoarseMonoClock::now() + 100ms, FixedHybridTimeLease()));
+}
+
 } // namespace tablet
 } // namespace yb
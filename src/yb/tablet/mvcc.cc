@@ -54,6 +54,11 @@ DEFINE_test_flag(int64, mvcc_op_trace_num_items, 32,
                  "Number of items to keep in an MvccManager operation trace. Set to 0 to disable "
                  "MVCC operation tracing.");
 
+DEFINE_RUNTIME_bool(mvcc_lock_free_safe_time, true,
+                    "Whether MvccManager::SafeTime could return already known safe time, that "
+                    "satisfies the requested minimum, without acquiring the MVCC mutex.");
+TAG_FLAG(mvcc_lock_free_safe_time, advanced);
+
 DEFINE_test_flag(int32, inject_mvcc_delay_add_leader_pending_ms, 0,
                  "Inject delay after MvccManager::AddLeaderPending read clock.");
 
@@ -275,6 +280,7 @@ void MvccManager::Replicated(HybridTime ht, const OpId& op_id) {
              (QueueItem{ .hybrid_time = ht, .op_id = op_id })) << InvariantViolationLogPrefix();
     queue_.pop_front();
     last_replicated_ = ht;
+    UpdateAtomicMax(&known_safe_time_, ht);
   }
   cond_.notify_all();
 }
@@ -309,6 +315,12 @@ bool BadNextOpId(const OpId& prev, const OpId& next) {
 HybridTime MvccManager::AddLeaderPending(const OpId& op_id) {
   std::lock_guard lock(mutex_);
   auto ht = clock_->Now();
+  if (ht <= promised_safe_time_) {
+    // Keep the promise given to followers. Also advance the clock, so reads that start after this
+    // operation on this server see it.
+    ht = promised_safe_time_.Incremented();
+    clock_->Update(ht);
+  }
   AtomicFlagSleepMs(&FLAGS_TEST_inject_mvcc_delay_add_leader_pending_ms);
   VLOG_WITH_PREFIX(1) << __func__ << "(" << op_id << "), time: " << ht;
   AddPending(ht, op_id, /* is_follower_side= */ false);
@@ -418,6 +430,7 @@ void MvccManager::SetLastReplicated(HybridTime ht) {
       op_trace_->Add(SetLastReplicatedTraceItem { .ht = ht });
     }
     last_replicated_ = ht;
+    UpdateAtomicMax(&known_safe_time_, ht);
   }
   cond_.notify_all();
 }
@@ -538,6 +551,7 @@ HybridTime MvccManager::SafeTimeForFollower(
   VTRACE(2, "Returning safe time $0. Source $1", yb::ToString(result.safe_time),
          yb::ToString(result.source));
   max_safe_time_returned_for_follower_ = result;
+  UpdateAtomicMax(&known_safe_time_, result.safe_time);
   if (op_trace_) {
     op_trace_->Add(SafeTimeForFollowerTraceItem {
       .min_allowed = min_allowed,
@@ -553,6 +567,18 @@ HybridTime MvccManager::SafeTime(
     HybridTime min_allowed,
     CoarseTimePoint deadline,
     const FixedHybridTimeLease& ht_lease) const NO_THREAD_SAFETY_ANALYSIS {
+  // Readers that specify the minimal safe time they need do not have to get the latest one. Known
+  // safe time covers all operations replicated before this call, so there is no need to contend on
+  // the mutex with operations that are being added and replicated.
+  if (min_allowed != HybridTime::kMin && GetAtomicFlag(&FLAGS_mvcc_lock_free_safe_time)) {
+    auto known_safe_time = known_safe_time_.load(std::memory_order_acquire);
+    if (known_safe_time >= min_allowed) {
+      VTRACE(2, "Returning known safe time $0. Min requested safe time was $1",
+             yb::ToString(known_safe_time), yb::ToString(min_allowed));
+      return known_safe_time;
+    }
+  }
+
   std::unique_lock<std::mutex> lock(mutex_);
   auto safe_time = DoGetSafeTime(min_allowed, deadline, ht_lease, &lock);
   if (op_trace_) {
@@ -566,6 +592,30 @@ HybridTime MvccManager::SafeTime(
   return safe_time;
 }
 
+HybridTime MvccManager::PromiseSafeTime(
+    HybridTime promised_time, const FixedHybridTimeLease& ht_lease) NO_THREAD_SAFETY_ANALYSIS {
+  FixedHybridTimeLease promised_lease = ht_lease;
+  if (!ht_lease.empty() && promised_time > ht_lease.time) {
+    promised_lease.time = std::min(promised_time, ht_lease.lease);
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  // Record the promise in the same critical section where safe time is calculated, so it is
+  // respected by all operations that are not taken into account by this safe time.
+  promised_safe_time_ = std::max(promised_safe_time_, promised_lease.time);
+  auto safe_time = DoGetSafeTime(
+      HybridTime::kMin, CoarseTimePoint::max(), promised_lease, &lock);
+  if (op_trace_) {
+    op_trace_->Add(SafeTimeTraceItem {
+      .min_allowed = HybridTime::kMin,
+      .deadline = CoarseTimePoint::max(),
+      .ht_lease = promised_lease,
+      .safe_time = safe_time
+    });
+  }
+  return safe_time;
+}
+
 HybridTime MvccManager::DoGetSafeTime(const HybridTime min_allowed,
                                       const CoarseTimePoint deadline,
                                       const FixedHybridTimeLease& ht_lease,
@@ -644,6 +694,7 @@ HybridTime MvccManager::DoGetSafeTime(const HybridTime min_allowed,
   } else {
     max_safe_time_returned_without_lease_ = { result, source };
   }
+  UpdateAtomicMax(&known_safe_time_, result);
   VTRACE(2, "Returning safe time $0. Source $1. Min requested safe time was $2",
          yb::ToString(result), yb::ToString(source), yb::ToString(min_allowed));
   return result;
@@ -31,6 +31,7 @@
 //
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <vector>
@@ -131,6 +132,9 @@ class MvccManager {
   //
   // Returns invalid hybrid time in case it cannot satisfy provided requirements, for instance
   // because of timeout.
+  //
+  // When `min_allowed` is not greater than a safe time that was already returned or the hybrid time
+  // of the last replicated operation, that value is returned without acquiring the mutex.
   HybridTime SafeTime(
       HybridTime min_allowed, CoarseTimePoint deadline, const FixedHybridTimeLease& ht_lease) const
       EXCLUDES(mutex_);
@@ -140,6 +144,13 @@ class MvccManager {
                     ht_lease);
   }
 
+  // Returns safe time to propagate to followers. The leader promises that operations added after
+  // this call receive hybrid time greater than `promised_time`, so when there are no pending
+  // operations, followers could serve reads up to `promised_time` until the next update.
+  // `promised_time` is limited by the hybrid time leader lease expiration in `ht_lease`.
+  HybridTime PromiseSafeTime(HybridTime promised_time, const FixedHybridTimeLease& ht_lease)
+      EXCLUDES(mutex_);
+
   HybridTime SafeTimeForFollower(HybridTime min_allowed, CoarseTimePoint deadline) const
       EXCLUDES(mutex_);
 
@@ -204,6 +215,9 @@ class MvccManager {
   // leader, this is a safe time that gets updated every time the majority-replicated watermarks
   // change.
   HybridTime propagated_safe_time_ = HybridTime::kMin;
+  // Hybrid time promised to followers by PromiseSafeTime. New leader operations get hybrid time
+  // after it.
+  HybridTime promised_safe_time_ = HybridTime::kMin;
   // Special flag for RF==1 mode when propagated_safe_time_ can be not up-to-date.
   bool leader_only_mode_ = false;
 
@@ -211,6 +225,11 @@ class MvccManager {
   mutable SafeTimeWithSource max_safe_time_returned_without_lease_;
   mutable SafeTimeWithSource max_safe_time_returned_for_follower_ { HybridTime::kMin };
 
+  // Max of the safe times returned above and last_replicated_. No operation could be added with
+  // hybrid time less than or equal to it, and all replicated operations are covered by it, so it is
+  // a safe time that could be read without the mutex.
+  mutable std::atomic<HybridTime> known_safe_time_{HybridTime::kMin};
+
   std::unique_ptr<MvccOpTrace> op_trace_ GUARDED_BY(mutex_);
 };
 
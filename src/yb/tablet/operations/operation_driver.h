@@ -51,6 +51,7 @@
 #include "yb/util/status_fwd.h"
 #include "yb/util/lockfree.h"
 #include "yb/util/opid.h"
+#include "yb/util/size_class_pool.h"
 #include "yb/util/trace.h"
 
 namespace yb {
@@ -108,7 +109,8 @@ class Preparer;
 // This class is thread safe.
 class OperationDriver : public RefCountedThreadSafe<OperationDriver>,
                         public consensus::ConsensusRoundCallback,
-                        public MPSCQueueEntry<OperationDriver> {
+                        public MPSCQueueEntry<OperationDriver>,
+                        public SizeClassPooled {
 
  public:
   // Construct OperationDriver. OperationDriver does not take ownership
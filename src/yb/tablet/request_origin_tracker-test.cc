@@ -0,0 +1,85 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+
+#include <gtest/gtest.h>
+
+#include "yb/tablet/request_origin_tracker.h"
+
+#include "yb/util/flags.h"
+#include "yb/util/test_macros.h"
+
+DECLARE_uint32(tablet_request_origin_sampling_interval);
+DECLARE_uint32(tablet_request_origin_min_samples);
+DECLARE_double(tablet_request_origin_min_fraction);
+DECLARE_uint32(tablet_request_origin_stable_windows);
+
+namespace yb::tablet {
+
+namespace {
+
+void AddRequests(RequestOriginTracker* tracker, const std::string& host, int num_requests) {
+  for (int i = 0; i != num_requests; ++i) {
+    if (tracker->RecordRequest()) {
+      tracker->AddOrigin(host);
+    }
+  }
+}
+
+} // namespace
+
+TEST(RequestOriginTrackerTest, DominantOrigin) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_tablet_request_origin_sampling_interval) = 2;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_tablet_request_origin_min_samples) = 50;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_tablet_request_origin_min_fraction) = 0.7;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_tablet_request_origin_stable_windows) = 2;
+
+  RequestOriginTracker tracker;
+
+  // Not enough samples.
+  AddRequests(&tracker, "host1", 50);
+  ASSERT_EQ(tracker.TakeDominantOrigin(), "");
+
+  // The origin should be dominant during several windows in a row.
+  AddRequests(&tracker, "host1", 160);
+  AddRequests(&tracker, "host2", 40);
+  ASSERT_EQ(tracker.TakeDominantOrigin(), "");
+  AddRequests(&tracker, "host1", 160);
+  AddRequests(&tracker, "host2", 40);
+  ASSERT_EQ(tracker.TakeDominantOrigin(), "host1");
+
+  // No host sends most of the requests.
+  AddRequests(&tracker, "host1", 100);
+  AddRequests(&tracker, "host2", 100);
+  ASSERT_EQ(tracker.TakeDominantOrigin(), "");
+
+  // A window with another dominant origin starts counting from scratch.
+  AddRequests(&tracker, "host2", 200);
+  ASSERT_EQ(tracker.TakeDominantOrigin(), "");
+  AddRequests(&tracker, "host2", 200);
+  ASSERT_EQ(tracker.TakeDominantOrigin(), "host2");
+
+  // Idle tablet has no dominant origin.
+  ASSERT_EQ(tracker.TakeDominantOrigin(), "");
+}
+
+TEST(RequestOriginTrackerTest, Disabled) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_tablet_request_origin_sampling_interval) = 0;
+  RequestOriginTracker tracker;
+  for (int i = 0; i != 100; ++i) {
+    ASSERT_FALSE(tracker.RecordRequest());
+  }
+  ASSERT_EQ(tracker.TakeDominantOrigin(), "");
+}
+
+} // namespace yb::tablet
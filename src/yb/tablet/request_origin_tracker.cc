@@ -0,0 +1,87 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+
+#include "yb/tablet/request_origin_tracker.h"
+
+#include "yb/util/flags.h"
+
+DEFINE_RUNTIME_uint32(tablet_request_origin_sampling_interval, 0,
+    "Origin hosts of one of this number of requests to a tablet leader are sampled, and the "
+    "leader is moved to a replica in another region when most requests come from the host of "
+    "that replica. 0 disables tracking of request origins.");
+TAG_FLAG(tablet_request_origin_sampling_interval, advanced);
+
+DEFINE_RUNTIME_uint32(tablet_request_origin_min_samples, 100,
+    "Min number of requests sampled during a window to detect the dominant origin of requests to "
+    "a tablet leader.");
+TAG_FLAG(tablet_request_origin_min_samples, advanced);
+
+DEFINE_RUNTIME_double(tablet_request_origin_min_fraction, 0.7,
+    "Min fraction of sampled requests that should come from the same host during a window for "
+    "this host to be the dominant origin of requests to a tablet leader.");
+TAG_FLAG(tablet_request_origin_min_fraction, advanced);
+
+DEFINE_RUNTIME_uint32(tablet_request_origin_stable_windows, 3,
+    "Number of consecutive windows that the same host should be the dominant origin of requests "
+    "to a tablet leader before the leader is moved.");
+TAG_FLAG(tablet_request_origin_stable_windows, advanced);
+
+namespace yb::tablet {
+
+bool RequestOriginTracker::RecordRequest() {
+  auto interval = FLAGS_tablet_request_origin_sampling_interval;
+  if (interval == 0) {
+    return false;
+  }
+  return num_requests_.fetch_add(1, std::memory_order_relaxed) % interval == 0;
+}
+
+void RequestOriginTracker::AddOrigin(const std::string& host) {
+  std::lock_guard lock(mutex_);
+  ++num_samples_by_origin_[host];
+}
+
+std::string RequestOriginTracker::TakeDominantOrigin() {
+  std::lock_guard lock(mutex_);
+  uint64_t total_samples = 0;
+  const std::string* top_origin = nullptr;
+  uint64_t top_samples = 0;
+  for (const auto& [origin, num_samples] : num_samples_by_origin_) {
+    total_samples += num_samples;
+    if (num_samples > top_samples) {
+      top_origin = &origin;
+      top_samples = num_samples;
+    }
+  }
+
+  if (!top_origin || total_samples < FLAGS_tablet_request_origin_min_samples ||
+      top_samples < FLAGS_tablet_request_origin_min_fraction * total_samples) {
+    last_origin_.clear();
+    num_windows_with_last_origin_ = 0;
+  } else if (*top_origin == last_origin_) {
+    ++num_windows_with_last_origin_;
+  } else {
+    last_origin_ = *top_origin;
+    num_windows_with_last_origin_ = 1;
+  }
+  num_samples_by_origin_.clear();
+
+  if (last_origin_.empty() ||
+      num_windows_with_last_origin_ < FLAGS_tablet_request_origin_stable_windows) {
+    return std::string();
+  }
+  return last_origin_;
+}
+
+} // namespace yb::tablet
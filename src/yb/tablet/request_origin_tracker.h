@@ -0,0 +1,54 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "yb/gutil/thread_annotations.h"
+
+namespace yb::tablet {
+
+// Tracks the hosts that requests to the tablet leader come from, so the leader could be moved
+// closer to the clients of the tablet.
+//
+// Each call to TakeDominantOrigin completes a window of sampled requests. An origin is dominant
+// when it sent most of the sampled requests during several consecutive windows, so the leader is
+// not moved back and forth by short bursts of requests from different hosts.
+class RequestOriginTracker {
+ public:
+  // Registers a request to the tablet. Returns true when the origin of this request should be
+  // passed to AddOrigin, i.e. for one of tablet_request_origin_sampling_interval requests.
+  bool RecordRequest();
+
+  void AddOrigin(const std::string& host);
+
+  // Completes the current window. Returns the dominant origin host, or an empty string if there
+  // is no such host.
+  std::string TakeDominantOrigin();
+
+ private:
+  std::atomic<uint64_t> num_requests_{0};
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, uint64_t> num_samples_by_origin_ GUARDED_BY(mutex_);
+  // Origin that sent most of the samples in the last completed windows.
+  std::string last_origin_ GUARDED_BY(mutex_);
+  uint32_t num_windows_with_last_origin_ GUARDED_BY(mutex_) = 0;
+};
+
+} // namespace yb::tablet
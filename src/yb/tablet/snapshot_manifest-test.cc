@@ -0,0 +1,117 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "yb/tablet/snapshot_manifest.h"
+
+#include "yb/util/env.h"
+#include "yb/util/faststring.h"
+#include "yb/util/path_util.h"
+#include "yb/util/test_macros.h"
+#include "yb/util/test_util.h"
+
+namespace yb::tablet {
+
+class SnapshotManifestTest : public YBTest {
+ protected:
+  void SetUp() override {
+    YBTest::SetUp();
+    top_snapshots_dir_ = GetTestPath("snapshots");
+    ASSERT_OK(env_->CreateDirs(top_snapshots_dir_));
+  }
+
+  std::string SnapshotDir(const std::string& name) {
+    return JoinPathSegments(top_snapshots_dir_, name);
+  }
+
+  void WriteFile(const std::string& dir, const std::string& name, const std::string& content) {
+    ASSERT_OK(env_->CreateDirs(DirName(JoinPathSegments(dir, name))));
+    ASSERT_OK(WriteStringToFile(env_.get(), content, JoinPathSegments(dir, name)));
+  }
+
+  void LinkFile(const std::string& src_dir, const std::string& dest_dir, const std::string& name) {
+    ASSERT_OK(env_->LinkFile(JoinPathSegments(src_dir, name), JoinPathSegments(dest_dir, name)));
+  }
+
+  Result<SnapshotManifestPB> CreateManifest(const std::string& dir) {
+    auto manifest = VERIFY_RESULT(CreateSnapshotManifest(env_.get(), dir, top_snapshots_dir_));
+    RETURN_NOT_OK(WriteSnapshotManifest(env_.get(), dir, manifest));
+    return manifest;
+  }
+
+  std::string ReadFile(const std::string& path) {
+    faststring result;
+    CHECK_OK(ReadFileToString(env_.get(), path, &result));
+    return result.ToString();
+  }
+
+  std::string top_snapshots_dir_;
+};
+
+TEST_F(SnapshotManifestTest, IncrementalChain) {
+  auto first = SnapshotDir("first");
+  ASSERT_NO_FATALS(WriteFile(first, "000010.sst", "first sst"));
+  ASSERT_NO_FATALS(WriteFile(first, "000011.sst", "compacted away"));
+  ASSERT_NO_FATALS(WriteFile(first, "MANIFEST-000001", "first manifest"));
+  auto first_manifest = ASSERT_RESULT(CreateManifest(first));
+  ASSERT_EQ(first_manifest.files().size(), 3);
+
+  auto second = SnapshotDir("second");
+  ASSERT_OK(env_->CreateDirs(second));
+  ASSERT_NO_FATALS(LinkFile(first, second, "000010.sst"));
+  ASSERT_NO_FATALS(WriteFile(second, "000012.sst", "second sst"));
+  ASSERT_NO_FATALS(WriteFile(second, "intents/000001.sst", "intents sst"));
+  ASSERT_NO_FATALS(WriteFile(second, "MANIFEST-000001", "second manifest"));
+  auto second_manifest = ASSERT_RESULT(CreateManifest(second));
+
+  auto diff = DiffSnapshotManifests(first_manifest, second_manifest);
+  ASSERT_EQ(diff.unchanged, std::vector<std::string>{"000010.sst"}) << diff.ToString();
+  std::sort(diff.added.begin(), diff.added.end());
+  ASSERT_EQ(diff.added,
+            (std::vector<std::string>{"000012.sst", "MANIFEST-000001", "intents/000001.sst"}));
+
+  // Export the first snapshot fully and the second one incrementally.
+  auto full_export = GetTestPath("full_export");
+  ASSERT_OK(env_->CreateDirs(full_export));
+  for (const auto& file : first_manifest.files()) {
+    ASSERT_NO_FATALS(LinkFile(first, full_export, file.name()));
+  }
+  ASSERT_OK(WriteSnapshotManifest(env_.get(), full_export, first_manifest));
+
+  auto incremental_export = GetTestPath("incremental_export");
+  for (const auto& name : diff.added) {
+    ASSERT_NO_FATALS(WriteFile(incremental_export, name, ReadFile(JoinPathSegments(second, name))));
+  }
+  ASSERT_OK(WriteSnapshotManifest(env_.get(), incremental_export, second_manifest));
+
+  auto restored = GetTestPath("restored");
+  ASSERT_OK(AssembleSnapshotFromChain(env_.get(), {full_export, incremental_export}, restored));
+  for (const auto& file : second_manifest.files()) {
+    ASSERT_EQ(ReadFile(JoinPathSegments(restored, file.name())),
+              ReadFile(JoinPathSegments(second, file.name())));
+  }
+  ASSERT_FALSE(env_->FileExists(JoinPathSegments(restored, "000011.sst")));
+  auto restored_manifest = ASSERT_RESULT(ReadSnapshotManifest(env_.get(), restored));
+  ASSERT_TRUE(DiffSnapshotManifests(second_manifest, restored_manifest).added.empty());
+
+  // Chain without the full export misses unchanged files.
+  ASSERT_NOK(AssembleSnapshotFromChain(
+      env_.get(), {incremental_export}, GetTestPath("incomplete")));
+}
+
+} // namespace yb::tablet
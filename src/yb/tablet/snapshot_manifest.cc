@@ -0,0 +1,209 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/tablet/snapshot_manifest.h"
+
+#include <unordered_map>
+
+#include "yb/tablet/tablet_snapshots.h"
+
+#include "yb/util/crc.h"
+#include "yb/util/env.h"
+#include "yb/util/env_util.h"
+#include "yb/util/format.h"
+#include "yb/util/logging.h"
+#include "yb/util/path_util.h"
+#include "yb/util/pb_util.h"
+#include "yb/util/result.h"
+#include "yb/util/size_literals.h"
+#include "yb/util/status_format.h"
+#include "yb/util/tostring.h"
+
+using namespace yb::size_literals;
+
+namespace yb::tablet {
+
+const std::string kSnapshotManifestFile = "snapshot.manifest";
+
+namespace {
+
+constexpr size_t kChecksumReadBufferSize = 1_MB;
+
+using KnownFiles = std::unordered_map<std::string, FilePB>;
+
+Result<uint32_t> ComputeFileChecksum(Env* env, const std::string& path) {
+  std::unique_ptr<SequentialFile> file;
+  RETURN_NOT_OK(env->NewSequentialFile(path, &file));
+  std::unique_ptr<uint8_t[]> buffer(new uint8_t[kChecksumReadBufferSize]);
+  auto* crc32c = crc::GetCrc32cInstance();
+  uint64_t checksum = 0;
+  for (;;) {
+    Slice slice;
+    RETURN_NOT_OK(file->Read(kChecksumReadBufferSize, &slice, buffer.get()));
+    if (slice.empty()) {
+      break;
+    }
+    crc32c->Compute(slice.data(), slice.size(), &checksum);
+  }
+  return static_cast<uint32_t>(checksum);
+}
+
+// Collects files with checksums from manifests of other snapshots in top_snapshots_dir.
+KnownFiles CollectKnownFiles(
+    Env* env, const std::string& snapshot_dir, const std::string& top_snapshots_dir) {
+  KnownFiles result;
+  auto children = env->GetChildren(top_snapshots_dir, ExcludeDots::kTrue);
+  if (!children.ok()) {
+    return result;
+  }
+  for (const auto& child : *children) {
+    auto dir = JoinPathSegments(top_snapshots_dir, child);
+    if (dir == snapshot_dir || TabletSnapshots::IsTempSnapshotDir(dir)) {
+      continue;
+    }
+    auto manifest = ReadSnapshotManifest(env, dir);
+    if (!manifest.ok()) {
+      continue;
+    }
+    for (auto& file : *manifest->mutable_files()) {
+      auto name = file.name();
+      result.emplace(std::move(name), std::move(file));
+    }
+  }
+  return result;
+}
+
+Status AddDirToManifest(
+    Env* env, const std::string& dir, const std::string& prefix, const KnownFiles& known_files,
+    SnapshotManifestPB* manifest) {
+  auto files = VERIFY_RESULT_PREPEND(
+      env->GetChildren(dir, ExcludeDots::kTrue), Format("Unable to list directory $0", dir));
+  for (const auto& file : files) {
+    const auto path = JoinPathSegments(dir, file);
+    const auto name = prefix.empty() ? file : JoinPathSegments(prefix, file);
+    if (VERIFY_RESULT(env->IsDirectory(path))) {
+      RETURN_NOT_OK(AddDirToManifest(env, path, name, known_files, manifest));
+      continue;
+    }
+    if (prefix.empty() && file == kSnapshotManifestFile) {
+      continue;
+    }
+
+    auto& file_pb = *manifest->add_files();
+    file_pb.set_name(name);
+    file_pb.set_size_bytes(VERIFY_RESULT(env->GetFileSize(path)));
+    file_pb.set_inode(VERIFY_RESULT(env->GetFileINode(path)));
+
+    // Hard linked file has the same inode, so its checksum is reused.
+    auto it = known_files.find(name);
+    if (it != known_files.end() && it->second.inode() == file_pb.inode() &&
+        it->second.size_bytes() == file_pb.size_bytes() && it->second.has_crc32c()) {
+      file_pb.set_crc32c(it->second.crc32c());
+    } else {
+      file_pb.set_crc32c(VERIFY_RESULT_PREPEND(
+          ComputeFileChecksum(env, path), Format("Unable to compute checksum of $0", path)));
+    }
+  }
+  return Status::OK();
+}
+
+bool SameContent(const FilePB& lhs, const FilePB& rhs) {
+  return lhs.size_bytes() == rhs.size_bytes() && lhs.crc32c() == rhs.crc32c();
+}
+
+} // namespace
+
+Result<SnapshotManifestPB> CreateSnapshotManifest(
+    Env* env, const std::string& snapshot_dir, const std::string& top_snapshots_dir) {
+  SnapshotManifestPB result;
+  RETURN_NOT_OK(AddDirToManifest(
+      env, snapshot_dir, /* prefix= */ std::string(),
+      CollectKnownFiles(env, snapshot_dir, top_snapshots_dir), &result));
+  return result;
+}
+
+Status WriteSnapshotManifest(
+    Env* env, const std::string& snapshot_dir, const SnapshotManifestPB& manifest) {
+  return pb_util::WritePBContainerToPath(
+      env, JoinPathSegments(snapshot_dir, kSnapshotManifestFile), manifest, pb_util::OVERWRITE,
+      pb_util::SYNC);
+}
+
+Result<SnapshotManifestPB> ReadSnapshotManifest(Env* env, const std::string& snapshot_dir) {
+  SnapshotManifestPB result;
+  RETURN_NOT_OK(pb_util::ReadPBContainerFromPath(
+      env, JoinPathSegments(snapshot_dir, kSnapshotManifestFile), &result));
+  return result;
+}
+
+std::string SnapshotFilesDiff::ToString() const {
+  return YB_STRUCT_TO_STRING(unchanged, added);
+}
+
+SnapshotFilesDiff DiffSnapshotManifests(
+    const SnapshotManifestPB& base, const SnapshotManifestPB& snapshot) {
+  std::unordered_map<std::string_view, const FilePB*> base_files;
+  for (const auto& file : base.files()) {
+    base_files.emplace(file.name(), &file);
+  }
+  SnapshotFilesDiff result;
+  for (const auto& file : snapshot.files()) {
+    auto it = base_files.find(file.name());
+    if (it != base_files.end() && SameContent(*it->second, file)) {
+      result.unchanged.push_back(file.name());
+    } else {
+      result.added.push_back(file.name());
+    }
+  }
+  return result;
+}
+
+Status AssembleSnapshotFromChain(
+    Env* env, const std::vector<std::string>& chain, const std::string& dest_dir) {
+  SCHECK(!chain.empty(), InvalidArgument, "Empty chain of snapshot exports");
+  auto manifest = VERIFY_RESULT_PREPEND(
+      ReadSnapshotManifest(env, chain.back()),
+      Format("Unable to read manifest of $0", chain.back()));
+
+  RETURN_NOT_OK(env->CreateDirs(dest_dir));
+  for (const auto& file : manifest.files()) {
+    // The latest export that contains the file has its actual version, since a file with the same
+    // name but different contents is exported again.
+    std::string source;
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+      auto path = JoinPathSegments(*it, file.name());
+      if (env->FileExists(path)) {
+        source = std::move(path);
+        break;
+      }
+    }
+    if (source.empty()) {
+      return STATUS_FORMAT(NotFound, "File $0 is missing in chain $1", file.name(), chain);
+    }
+    auto size = VERIFY_RESULT(env->GetFileSize(source));
+    SCHECK_EQ(size, file.size_bytes(), Corruption, Format("Wrong size of $0", source));
+
+    auto dest = JoinPathSegments(dest_dir, file.name());
+    RETURN_NOT_OK(env->CreateDirs(DirName(dest)));
+    auto status = env->LinkFile(source, dest);
+    if (!status.ok()) {
+      VLOG(1) << "Failed to link " << source << " to " << dest << ": " << status << ", copying";
+      RETURN_NOT_OK_PREPEND(
+          env_util::CopyFile(env, source, dest), Format("Unable to copy $0", source));
+    }
+  }
+  RETURN_NOT_OK(WriteSnapshotManifest(env, dest_dir, manifest));
+  return env->SyncDir(dest_dir);
+}
+
+} // namespace yb::tablet
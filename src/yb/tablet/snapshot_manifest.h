@@ -0,0 +1,69 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "yb/tablet/metadata.pb.h"
+
+#include "yb/util/status_fwd.h"
+
+namespace yb {
+
+class Env;
+
+namespace tablet {
+
+// Snapshot manifest lists files of a tablet snapshot with their sizes and checksums. SST files are
+// immutable and named by their file number, so a file with the same name, size and checksum as a
+// file of a previous snapshot does not have to be exported again.
+//
+// Incremental export of a snapshot contains its manifest and only files that are absent in the
+// previous export. The whole snapshot is assembled from the chain of such exports on restore.
+extern const std::string kSnapshotManifestFile;
+
+// Lists files of the snapshot in snapshot_dir. Checksums of files hard linked from other snapshots
+// in top_snapshots_dir are taken from their manifests, so only new files are read.
+Result<SnapshotManifestPB> CreateSnapshotManifest(
+    Env* env, const std::string& snapshot_dir, const std::string& top_snapshots_dir);
+
+Status WriteSnapshotManifest(
+    Env* env, const std::string& snapshot_dir, const SnapshotManifestPB& manifest);
+
+// Returns NotFound if the snapshot does not have a manifest.
+Result<SnapshotManifestPB> ReadSnapshotManifest(Env* env, const std::string& snapshot_dir);
+
+struct SnapshotFilesDiff {
+  // Files present in the base snapshot with the same size and checksum.
+  std::vector<std::string> unchanged;
+
+  // Files that should be exported.
+  std::vector<std::string> added;
+
+  std::string ToString() const;
+};
+
+SnapshotFilesDiff DiffSnapshotManifests(
+    const SnapshotManifestPB& base, const SnapshotManifestPB& snapshot);
+
+// Assembles snapshot in dest_dir from a chain of exports, ordered from the full export to the
+// latest incremental one. Each export should contain the manifest of its snapshot. Every file of
+// the latest snapshot is taken from the latest export that contains it, and is hard linked if
+// possible.
+Status AssembleSnapshotFromChain(
+    Env* env, const std::vector<std::string>& chain, const std::string& dest_dir);
+
+} // namespace tablet
+} // namespace yb
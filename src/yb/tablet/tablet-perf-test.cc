@@ -0,0 +1,208 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+// Benchmarks of DocDB read and write paths, that drive Tablet directly, without RPC layer.
+// Workload size is controlled by tablet_perf_* flags, packed rows by ycql_enable_packed_row.
+// For example:
+//   tablet-perf-test --tablet_perf_num_ops=1000000 --ycql_enable_packed_row=true
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "yb/common/ql_protocol_util.h"
+#include "yb/common/schema.h"
+
+#include "yb/docdb/read_operation_data.h"
+
+#include "yb/qlexpr/ql_rowblock.h"
+
+#include "yb/rocksdb/perf_context.h"
+
+#include "yb/tablet/local_tablet_writer.h"
+#include "yb/tablet/read_result.h"
+#include "yb/tablet/tablet-test-util.h"
+#include "yb/tablet/tablet.h"
+
+#include "yb/util/flags.h"
+#include "yb/util/hdr_histogram.h"
+#include "yb/util/random_util.h"
+#include "yb/util/stats/perf_level.h"
+#include "yb/util/test_macros.h"
+#include "yb/util/test_util.h"
+
+DEFINE_NON_RUNTIME_int32(tablet_perf_num_hash_keys, 1000, "Number of distinct hash keys.");
+DEFINE_NON_RUNTIME_int32(tablet_perf_rows_per_hash_key, 10,
+    "Number of rows with the same hash key, i.e. number of rows returned by a range scan.");
+DEFINE_NON_RUNTIME_int32(tablet_perf_num_value_columns, 8, "Number of value columns.");
+DEFINE_NON_RUNTIME_int32(tablet_perf_num_ops, 10000, "Number of measured operations.");
+DEFINE_NON_RUNTIME_int32(tablet_perf_write_batch_size, 10, "Number of rows per write.");
+DEFINE_NON_RUNTIME_bool(tablet_perf_flush_before_reads, true,
+    "Whether the tablet is flushed before reads, so they are served from SST files.");
+
+namespace yb::tablet {
+
+namespace {
+
+constexpr int kRangeColumnId = kFirstColumnId + 1;
+constexpr int kFirstValueColumnId = kFirstColumnId + 2;
+
+// Latencies are tracked in microseconds, up to one minute.
+constexpr uint64_t kMaxLatencyUs = 60 * 1000 * 1000;
+
+Schema CreatePerfSchema() {
+  std::vector<ColumnSchema> columns = {
+    ColumnSchema("h", DataType::INT32, ColumnKind::HASH),
+    ColumnSchema("r", DataType::INT32, ColumnKind::RANGE_ASC_NULL_FIRST),
+  };
+  for (int i = 0; i != FLAGS_tablet_perf_num_value_columns; ++i) {
+    columns.emplace_back(
+        Format("v$0", i), DataType::INT64, ColumnKind::VALUE, Nullable::kTrue);
+  }
+  return Schema(columns);
+}
+
+} // namespace
+
+class TabletPerfTest : public YBTabletTest {
+ public:
+  TabletPerfTest() : YBTabletTest(CreatePerfSchema()) {}
+
+  void SetUp() override {
+    YBTabletTest::SetUp();
+    writer_ = std::make_unique<LocalTabletWriter>(tablet());
+    SetPerfLevel(PerfLevel::kEnableCount);
+  }
+
+  void TearDown() override {
+    SetPerfLevel(PerfLevel::kDisable);
+    writer_.reset();
+    YBTabletTest::TearDown();
+  }
+
+ protected:
+  void AddUpsert(int32_t hash_key, int32_t range_key, LocalTabletWriter::Batch* batch) {
+    auto* req = batch->Add();
+    req->set_type(QLWriteRequestPB::QL_STMT_INSERT);
+    QLAddInt32HashValue(req, hash_key);
+    QLAddInt32RangeValue(req, range_key);
+    for (int i = 0; i != FLAGS_tablet_perf_num_value_columns; ++i) {
+      QLAddInt64ColumnValue(req, kFirstValueColumnId + i, RandomUniformInt<int64_t>());
+    }
+  }
+
+  void Load() {
+    LocalTabletWriter::Batch batch;
+    for (int32_t h = 0; h != FLAGS_tablet_perf_num_hash_keys; ++h) {
+      for (int32_t r = 0; r != FLAGS_tablet_perf_rows_per_hash_key; ++r) {
+        AddUpsert(h, r, &batch);
+        if (batch.size() >= FLAGS_tablet_perf_write_batch_size) {
+          ASSERT_OK(writer_->WriteBatch(&batch));
+        }
+      }
+    }
+    if (!batch.empty()) {
+      ASSERT_OK(writer_->WriteBatch(&batch));
+    }
+    if (FLAGS_tablet_perf_flush_before_reads) {
+      ASSERT_OK(tablet()->Flush(FlushMode::kSync));
+    }
+  }
+
+  // Reads rows with the specified hash key, and the specified range key if present.
+  // Returns the number of read rows.
+  Result<size_t> Read(int32_t hash_key, std::optional<int32_t> range_key) {
+    QLReadRequestPB req;
+    QLAddInt32HashValue(&req, hash_key);
+    QLSetHashCode(&req);
+    if (range_key) {
+      QLSetInt32Condition(
+          req.mutable_where_expr()->mutable_condition(), kRangeColumnId, QL_OP_EQUAL, *range_key);
+    }
+    QLAddColumns(schema_, {}, &req);
+    auto read_time = ReadHybridTime::SingleTime(VERIFY_RESULT(tablet()->SafeTime()));
+    QLReadRequestResult result;
+    TransactionMetadataPB transaction;
+    WriteBuffer rows_data(1024);
+    RETURN_NOT_OK(tablet()->HandleQLReadRequest(
+        docdb::ReadOperationData::FromReadTime(read_time), req, transaction, &result,
+        &rows_data));
+    SCHECK_EQ(result.response.status(), QLResponsePB::YQL_STATUS_OK, IllegalState,
+              result.response.error_message());
+    return qlexpr::CreateRowBlock(QLClient::YQL_CLIENT_CQL, schema_, rows_data.ToBuffer())
+        ->row_count();
+  }
+
+  // Runs op FLAGS_tablet_perf_num_ops times, and logs throughput, latency percentiles and
+  // RocksDB perf context counters of the run.
+  template <class Op>
+  void Measure(const std::string& name, const Op& op) {
+    HdrHistogram latencies(kMaxLatencyUs, 2);
+    rocksdb::perf_context.Reset();
+    auto start = MonoTime::Now();
+    for (int i = 0; i != FLAGS_tablet_perf_num_ops; ++i) {
+      auto op_start = MonoTime::Now();
+      ASSERT_NO_FATALS(op());
+      latencies.Increment((MonoTime::Now() - op_start).ToMicroseconds());
+    }
+    auto elapsed = MonoTime::Now() - start;
+    LOG(INFO) << name << ": " << FLAGS_tablet_perf_num_ops << " ops in " << elapsed << ", "
+              << FLAGS_tablet_perf_num_ops / elapsed.ToSeconds() << " ops/s, latency us: "
+              << "mean " << latencies.MeanValue()
+              << ", p50 " << latencies.ValueAtPercentile(50)
+              << ", p95 " << latencies.ValueAtPercentile(95)
+              << ", p99 " << latencies.ValueAtPercentile(99)
+              << ", max " << latencies.MaxValue();
+    LOG(INFO) << name << " perf context: "
+              << rocksdb::perf_context.ToString(/* exclude_zero_counters= */ true);
+  }
+
+  int32_t RandomHashKey() {
+    return RandomUniformInt<int32_t>(0, FLAGS_tablet_perf_num_hash_keys - 1);
+  }
+
+  int32_t RandomRangeKey() {
+    return RandomUniformInt<int32_t>(0, FLAGS_tablet_perf_rows_per_hash_key - 1);
+  }
+
+  std::unique_ptr<LocalTabletWriter> writer_;
+};
+
+TEST_F(TabletPerfTest, Upserts) {
+  Measure("Upserts", [this] {
+    LocalTabletWriter::Batch batch;
+    for (int i = 0; i != FLAGS_tablet_perf_write_batch_size; ++i) {
+      AddUpsert(RandomHashKey(), RandomRangeKey(), &batch);
+    }
+    ASSERT_OK(writer_->WriteBatch(&batch));
+  });
+}
+
+TEST_F(TabletPerfTest, PointReads) {
+  ASSERT_NO_FATALS(Load());
+  Measure("PointReads", [this] {
+    ASSERT_EQ(ASSERT_RESULT(Read(RandomHashKey(), RandomRangeKey())), 1U);
+  });
+}
+
+TEST_F(TabletPerfTest, RangeScans) {
+  ASSERT_NO_FATALS(Load());
+  Measure("RangeScans", [this] {
+    ASSERT_EQ(ASSERT_RESULT(Read(RandomHashKey(), std::nullopt)),
+              static_cast<size_t>(FLAGS_tablet_perf_rows_per_hash_key));
+  });
+}
+
+} // namespace yb::tablet
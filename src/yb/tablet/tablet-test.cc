@@ -45,16 +45,21 @@
 
 #include "yb/qlexpr/ql_expr.h"
 
+#include "yb/docdb/docdb_compaction_context.h"
 #include "yb/docdb/ql_rowwise_iterator_interface.h"
 
 #include "yb/gutil/stl_util.h"
 #include "yb/gutil/strings/join.h"
 
+#include "yb/server/logical_clock.h"
+
 #include "yb/tablet/local_tablet_writer.h"
 #include "yb/tablet/tablet-test-base.h"
 #include "yb/tablet/tablet.h"
 #include "yb/tablet/tablet_metrics.h"
 #include "yb/tablet/tablet_bootstrap_if.h"
+#include "yb/tablet/tablet_metadata.h"
+#include "yb/tablet/tablet_retention_policy.h"
 
 #include "yb/util/enums.h"
 #include "yb/util/slice.h"
@@ -65,6 +70,10 @@
 using std::string;
 using std::vector;
 
+DECLARE_bool(enable_history_cutoff_propagation);
+DECLARE_int32(history_cutoff_propagation_interval_ms);
+DECLARE_int32(timestamp_history_retention_interval_sec);
+
 namespace yb {
 namespace tablet {
 
@@ -253,5 +262,56 @@ TYPED_TEST(TestTablet, TestDocKeyMetrics) {
   ASSERT_EQ(metrics->Get(TabletCounters::kDocDBObsoleteKeysFound), 1);
 }
 
+// Test that the history_retention_interval_sec table property overrides
+// timestamp_history_retention_interval_sec, with and without history cutoff propagation.
+TYPED_TEST(TestTablet, TestTableHistoryRetentionInterval) {
+  constexpr int32_t kGlobalRetentionSec = 900;
+  constexpr int32_t kTableRetentionSec = 1;
+  const auto kStart = HybridTime::FromMicros(1000 * MonoTime::kMicrosecondsPerSecond);
+
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_timestamp_history_retention_interval_sec) =
+      kGlobalRetentionSec;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_enable_history_cutoff_propagation) = false;
+
+  auto* metadata = this->tablet()->metadata();
+  server::ClockPtr clock(server::LogicalClock::CreateStartingAt(kStart));
+  TabletRetentionPolicy policy(clock, AllowedHistoryCutoffProvider(), metadata);
+
+  auto cutoff = policy.GetRetentionDirective().history_cutoff.primary_cutoff_ht;
+  ASSERT_EQ(kStart.AddSeconds(-kGlobalRetentionSec).GetPhysicalValueMicros(),
+            cutoff.GetPhysicalValueMicros());
+
+  Schema schema = *metadata->schema();
+  schema.mutable_table_properties()->SetHistoryRetentionIntervalSec(kTableRetentionSec);
+  metadata->SetSchema(
+      schema, *metadata->index_map(), {}, metadata->schema_version() + 1, OpId());
+
+  cutoff = policy.GetRetentionDirective().history_cutoff.primary_cutoff_ht;
+  ASSERT_EQ(kStart.AddSeconds(-kTableRetentionSec).GetPhysicalValueMicros(),
+            cutoff.GetPhysicalValueMicros());
+
+  // With propagation the cutoff is only proposed every history_cutoff_propagation_interval_ms,
+  // unless the table retains less history than that.
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_enable_history_cutoff_propagation) = true;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_history_cutoff_propagation_interval_ms) = 180000;
+
+  auto proposed = policy.HistoryCutoffToPropagate(clock->Now());
+  ASSERT_TRUE(proposed.primary_cutoff_ht);
+  ASSERT_EQ(kStart.AddSeconds(-kTableRetentionSec).GetPhysicalValueMicros(),
+            proposed.primary_cutoff_ht.GetPhysicalValueMicros());
+  ASSERT_FALSE(policy.HistoryCutoffToPropagate(clock->Now()).primary_cutoff_ht);
+
+  SleepFor(MonoDelta::FromMilliseconds(kTableRetentionSec * 1000 + 100));
+  clock->Update(kStart.AddSeconds(kGlobalRetentionSec));
+  proposed = policy.HistoryCutoffToPropagate(clock->Now());
+  ASSERT_TRUE(proposed.primary_cutoff_ht);
+  ASSERT_EQ(kStart.AddSeconds(kGlobalRetentionSec - kTableRetentionSec).GetPhysicalValueMicros(),
+            proposed.primary_cutoff_ht.GetPhysicalValueMicros());
+
+  policy.UpdateCommittedHistoryCutoff(proposed);
+  cutoff = policy.GetRetentionDirective().history_cutoff.primary_cutoff_ht;
+  ASSERT_EQ(proposed.primary_cutoff_ht, cutoff);
+}
+
 } // namespace tablet
 } // namespace yb
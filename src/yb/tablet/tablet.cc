@@ -63,6 +63,7 @@
 #include "yb/docdb/conflict_resolution.h"
 #include "yb/docdb/consensus_frontier.h"
 #include "yb/docdb/cql_operation.h"
+#include "yb/docdb/doc_colocation_filter.h"
 #include "yb/docdb/doc_read_context.h"
 #include "yb/docdb/doc_rowwise_iterator.h"
 #include "yb/docdb/doc_write_batch.h"
@@ -74,18 +75,24 @@
 #include "yb/docdb/pgsql_operation.h"
 #include "yb/docdb/ql_rocksdb_storage.h"
 #include "yb/docdb/redis_operation.h"
+#include "yb/docdb/rocksdb_iterator_pool.h"
+#include "yb/docdb/row_cache.h"
 #include "yb/docdb/rocksdb_writer.h"
 #include "yb/dockv/value_type.h"
 
 #include "yb/gutil/casts.h"
 
 #include "yb/rocksdb/db/memtable.h"
+#include "yb/rocksdb/memtablerep.h"
+#include "yb/rocksdb/rate_limiter.h"
 #include "yb/rocksdb/utilities/checkpoint.h"
 
 #include "yb/rocksutil/yb_rocksdb.h"
 
 #include "yb/server/hybrid_clock.h"
 
+#include "yb/tablet/key_access_sampler.h"
+#include "yb/tablet/live_intents_filter.h"
 #include "yb/tablet/operations/change_metadata_operation.h"
 #include "yb/tablet/operations/operation.h"
 #include "yb/tablet/operations/snapshot_operation.h"
@@ -93,6 +100,7 @@
 #include "yb/tablet/operations/truncate_operation.h"
 #include "yb/tablet/operations/write_operation.h"
 #include "yb/tablet/read_result.h"
+#include "yb/tablet/request_origin_tracker.h"
 #include "yb/tablet/snapshot_coordinator.h"
 #include "yb/tablet/tablet_bootstrap_if.h"
 #include "yb/tablet/tablet_metadata.h"
@@ -114,6 +122,7 @@
 #include "yb/util/mem_tracker.h"
 #include "yb/util/metrics.h"
 #include "yb/util/net/net_util.h"
+#include "yb/util/path_util.h"
 #include "yb/util/pg_util.h"
 #include "yb/util/scope_exit.h"
 #include "yb/util/status_format.h"
@@ -139,6 +148,11 @@ DEPRECATE_FLAG(double, tablet_bloom_target_fp_rate, "06_2023");
 METRIC_DEFINE_entity(table);
 METRIC_DEFINE_entity(tablet);
 
+METRIC_DEFINE_gauge_uint32(tablet, full_compaction_progress_percent,
+    "Full Compaction Progress", yb::MetricUnit::kUnits,
+    "Percent of the input of the current incremental full compaction of the regular DB, that was "
+    "already compacted.");
+
 DEPRECATE_FLAG(int32, tablet_rocksdb_ops_quiet_down_timeout_ms, "04_2023");
 
 DEFINE_UNKNOWN_int32(intents_flush_max_delay_ms, 2000,
@@ -163,6 +177,13 @@ DEFINE_RUNTIME_int32(backfill_index_rate_rows_per_sec, 0,
     "multiple tablets could be processing more than this.");
 TAG_FLAG(backfill_index_rate_rows_per_sec, advanced);
 
+DEFINE_RUNTIME_int32(backfill_index_target_write_latency_ms, 0,
+    "Target latency of flushing a batch of index backfill writes. When a flush takes longer, "
+    "because the index tablets are busy serving the foreground workload, backfill of the tablet "
+    "pauses before the next batch, proportionally to the excess latency. 0 disables latency based "
+    "throttling of index backfill.");
+TAG_FLAG(backfill_index_target_write_latency_ms, advanced);
+
 DEFINE_RUNTIME_uint64(verify_index_read_batch_size, 128, "The batch size for reading the index.");
 TAG_FLAG(verify_index_read_batch_size, advanced);
 
@@ -238,6 +259,11 @@ DEFINE_test_flag(bool, docdb_log_write_batches, false,
 DEFINE_NON_RUNTIME_bool(export_intentdb_metrics, true,
                     "Dump intentsdb statistics to prometheus metrics");
 
+DEFINE_NON_RUNTIME_uint64(tablet_row_cache_size_bytes, 0,
+    "Size of the per tablet cache of the latest values of hot keys. Currently used by GETs of "
+    "Redis string values without TTL. 0 disables the cache.");
+TAG_FLAG(tablet_row_cache_size_bytes, advanced);
+
 DEFINE_test_flag(bool, pause_before_full_compaction, false,
                  "Pause before triggering full compaction.");
 
@@ -251,6 +277,11 @@ DEFINE_RUNTIME_uint64(post_split_compaction_input_size_threshold_bytes, 256_MB,
              "Max size of a files to be compacted within one iteration. "
              "Set to 0 to compact all files at once during post split compaction.");
 
+DEFINE_RUNTIME_bool(enable_post_split_compaction, true,
+    "Whether to rewrite data inherited from the parent tablet right after a tablet split. When "
+    "disabled, child tablets keep sharing SST files of the parent tablet, and keys outside of "
+    "the tablet key bounds are dropped by regular compactions.");
+
 DEFINE_test_flag(bool, pause_before_getting_safe_time, false,
                  "Pause before doing Tablet::DoGetSafeTime");
 
@@ -264,6 +295,12 @@ DEFINE_RUNTIME_bool(tablet_exclusive_full_compaction, false,
        "scheduled and unscheduled compactions are run before the full compaction and no other "
        "compactions will get scheduled during a full compaction.");
 
+DEFINE_RUNTIME_uint64(full_compaction_input_size_limit_per_job_bytes, 0,
+    "Max size of files compacted within one step of a full compaction of the regular DB. Output "
+    "of each step is committed, and the progress is stored in the tablet metadata, so a full "
+    "compaction interrupted by a restart continues from the last finished step. Steps other than "
+    "the first one could not drop delete markers. Set to 0 to compact all files at once.");
+
 // FLAGS_TEST_disable_getting_user_frontier_from_mem_table is used in conjunction with
 // FLAGS_TEST_disable_adding_user_frontier_to_sst.  Two flags are needed for the case in which
 // we're writing a mixture of SST files with and without UserFrontiers, to ensure that we're
@@ -276,6 +313,17 @@ DEFINE_test_flag(bool, disable_adding_last_compaction_to_tablet_metadata, false,
                  "Prevents adding the last full compaction time to tablet metadata upon "
                  "full compaction completion.");
 
+DEFINE_RUNTIME_uint64(apply_intents_sst_ingestion_min_records, 0,
+    "Min number of regular records in a chunk of applied transaction intents to write them to "
+    "the regular DB as an externally created SST file, instead of inserting them into the "
+    "memtable. Only chunks that do not overlap existing records are ingested, other records "
+    "are copied to a regular write batch. 0 disables SST ingestion.");
+
+DEFINE_NON_RUNTIME_int32(db_block_cache_tablet_quota_percentage, 0,
+    "Percentage of the block cache that blocks of a single tablet RocksDB could take. Data "
+    "blocks read while the tablet is over its quota are not added to the block cache, so "
+    "tablets with large scans could not evict hot blocks of other tablets. 0 means no quota.");
+
 DECLARE_int32(client_read_write_timeout_ms);
 DECLARE_bool(consistent_restore);
 DECLARE_int64(db_block_size_bytes);
@@ -414,6 +462,7 @@ class Tablet::RegularRocksDbListener : public rocksdb::EventListener {
 
   void OnCompactionCompleted(rocksdb::DB* db, const rocksdb::CompactionJobInfo& ci) override {
     auto& metadata = *CHECK_NOTNULL(tablet_.metadata());
+    tablet_.UpdateFullCompactionProgress(db);
     if (ci.is_full_compaction) {
       if (PREDICT_TRUE(!FLAGS_TEST_disable_adding_last_compaction_to_tablet_metadata)) {
         metadata.set_last_full_compaction_time(tablet_.clock()->Now().ToUint64());
@@ -428,6 +477,14 @@ class Tablet::RegularRocksDbListener : public rocksdb::EventListener {
       if (metadata.OnPostSplitCompactionDone()) {
         ERROR_NOT_OK(metadata.Flush(), log_prefix_);
       }
+    } else if (tablet_.StillHasOrphanedPostSplitDataAbortable() &&
+               !tablet_.HasFilesInheritedFromParent(db)) {
+      // Regular compactions also drop keys outside of the tablet key bounds, so parent data has
+      // been compacted once the last file inherited from the parent tablet is gone.
+      LOG(INFO) << log_prefix_ << "All files inherited from the parent tablet have been compacted";
+      if (metadata.OnPostSplitCompactionDone()) {
+        ERROR_NOT_OK(metadata.Flush(), log_prefix_);
+      }
     }
 
     if (FLAGS_enable_schema_packing_gc) {
@@ -524,6 +581,8 @@ Tablet::Tablet(const TabletInitData& data)
           Format("tablet-$0", tablet_id()), /* metric_name */ "PerTablet", data.parent_mem_tracker,
               AddToParent::kTrue, CreateMetrics::kFalse)),
       block_based_table_mem_tracker_(data.block_based_table_mem_tracker),
+      key_access_sampler_(std::make_unique<KeyAccessSampler>()),
+      request_origin_tracker_(std::make_unique<RequestOriginTracker>()),
       clock_(data.clock),
       mvcc_(
           MakeTabletLogPrefix(data.metadata->raft_group_id(), data.log_prefix_suffix), data.clock),
@@ -546,6 +605,7 @@ Tablet::Tablet(const TabletInitData& data)
           clock_, data.allowed_history_cutoff_provider, metadata_.get())),
       full_compaction_pool_(data.full_compaction_pool),
       admin_triggered_compaction_pool_(data.admin_triggered_compaction_pool),
+      parallel_scan_pool_(data.parallel_scan_pool),
       ts_post_split_compaction_added_(std::move(data.post_split_compaction_added)),
       get_min_xcluster_schema_version_(std::move(data.get_min_xcluster_schema_version)) {
   CHECK(schema()->has_column_ids());
@@ -574,6 +634,8 @@ Tablet::Tablet(const TabletInitData& data)
              : rocksdb::CreateDBStatistics(nullptr, nullptr, true));
 
     metrics_.reset(CreateTabletMetrics(table_metrics_entity_, tablet_metrics_entity_).release());
+    full_compaction_progress_ =
+        METRIC_full_compaction_progress_percent.Instantiate(tablet_metrics_entity_, 0);
 
     mem_tracker_->SetMetricEntity(tablet_metrics_entity_);
   }
@@ -789,6 +851,16 @@ std::string MakeTabletLogPrefix(
       tablet_id, Format("$0 [$1]", log_prefix_suffix, LogDbTypePrefix(db_type)));
 }
 
+// Limit of the tablet RocksDB block based table memory tracker, or -1 if there is no quota.
+int64_t BlockCacheTabletQuota(const MemTrackerPtr& block_based_table_mem_tracker) {
+  if (FLAGS_db_block_cache_tablet_quota_percentage <= 0 || !block_based_table_mem_tracker ||
+      !block_based_table_mem_tracker->has_limit()) {
+    return -1;
+  }
+  return block_based_table_mem_tracker->limit() *
+         std::min(FLAGS_db_block_cache_tablet_quota_percentage, 100) / 100;
+}
+
 } // namespace
 
 std::string Tablet::LogPrefix(docdb::StorageDbType db_type) const {
@@ -813,6 +885,7 @@ Status Tablet::OpenKeyValueTablet() {
       &rocksdb_options, LogPrefix(docdb::StorageDbType::kRegular), std::move(table_options));
   rocksdb_options.mem_tracker = MemTracker::FindOrCreateTracker(kRegularDB, mem_tracker_);
   regulardb_mem_tracker_ = MemTracker::FindOrCreateTracker(
+      BlockCacheTabletQuota(block_based_table_mem_tracker_),
       Format("$0-$1", kRegularDB, tablet_id()), /* metric_name */ kRegularDB,
           block_based_table_mem_tracker_, AddToParent::kTrue, CreateMetrics::kFalse);
   rocksdb_options.block_based_table_mem_tracker = regulardb_mem_tracker_;
@@ -830,6 +903,7 @@ Status Tablet::OpenKeyValueTablet() {
       retention_policy_, &key_bounds_,
       std::bind(&Tablet::DeleteMarkerRetentionTime, this, _1),
       metadata_.get());
+  rocksdb_options.subcompaction_boundary_extractor = docdb::CreateSubcompactionBoundaryExtractor();
 
   rocksdb_options.mem_table_flush_filter_factory = MakeMemTableFlushFilterFactory([this] {
     {
@@ -861,6 +935,10 @@ Status Tablet::OpenKeyValueTablet() {
   rocksdb::Options regular_rocksdb_options(rocksdb_options);
   regular_rocksdb_options.listeners.push_back(
       std::make_shared<RegularRocksDbListener>(this, regular_rocksdb_options.log_prefix));
+  if (metadata_->colocated()) {
+    regular_rocksdb_options.table_properties_collector_factories.push_back(
+        docdb::CreateColocationIdsCollectorFactory());
+  }
 
   const string db_dir = metadata()->rocksdb_dir();
   RETURN_NOT_OK(CreateTabletDirectories(db_dir, metadata()->fs_manager()));
@@ -877,12 +955,35 @@ Status Tablet::OpenKeyValueTablet() {
     return STATUS(IllegalState, rocksdb_open_status.ToString());
   }
   regular_db_.reset(db);
+  regular_iterator_pool_ = std::make_unique<docdb::RocksDBIteratorPool>(regular_db_.get());
+  if (table_type_ == TableType::REDIS_TABLE_TYPE && FLAGS_tablet_row_cache_size_bytes > 0) {
+    // Values written before the DB was opened could have hybrid time up to the max clock skew
+    // ahead of the local clock.
+    row_cache_ = std::make_unique<docdb::RowCache>(
+        FLAGS_tablet_row_cache_size_bytes, clock_->MaxGlobalNow());
+  }
   regular_db_->ListenFilesChanged(std::bind(&Tablet::RegularDbFilesChanged, this));
 
   if (transaction_participant_) {
     LOG_WITH_PREFIX(INFO) << "Opening intents DB at: " << db_dir + kIntentsDBSuffix;
     rocksdb::Options intents_rocksdb_options(rocksdb_options);
     intents_rocksdb_options.compaction_context_factory = {};
+    // Subcompaction boundaries are only adjusted for regular DB keys, so do not split intents DB
+    // compactions.
+    intents_rocksdb_options.subcompaction_boundary_extractor = {};
+    intents_rocksdb_options.max_subcompactions = 1;
+    // Intents DB relies on in memory erase of applied intents, that is not supported by memtables
+    // with concurrent writes.
+    intents_rocksdb_options.allow_concurrent_memtable_write = false;
+    intents_rocksdb_options.memtable_factory = std::make_shared<rocksdb::SkipListFactory>(
+        0 /* lookahead */, rocksdb::ConcurrentWrites::kFalse);
+    // Intents are short-lived, so intents DB always uses universal compactions of a single level.
+    if (intents_rocksdb_options.compaction_style ==
+            rocksdb::CompactionStyle::kCompactionStyleLevel) {
+      intents_rocksdb_options.compaction_style =
+          rocksdb::CompactionStyle::kCompactionStyleUniversal;
+      intents_rocksdb_options.num_levels = 1;
+    }
     docdb::SetLogPrefix(&intents_rocksdb_options, LogPrefix(docdb::StorageDbType::kIntents));
 
     intents_rocksdb_options.mem_table_flush_filter_factory = MakeMemTableFlushFilterFactory([this] {
@@ -895,6 +996,7 @@ Status Tablet::OpenKeyValueTablet() {
 
     intents_rocksdb_options.mem_tracker = MemTracker::FindOrCreateTracker(kIntentsDB, mem_tracker_);
     intentdb_mem_tracker_ = MemTracker::FindOrCreateTracker(
+        BlockCacheTabletQuota(block_based_table_mem_tracker_),
         Format("$0-$1", kIntentsDB, tablet_id()), /* metric_name */ kIntentsDB,
             block_based_table_mem_tracker_, AddToParent::kTrue, CreateMetrics::kFalse);
     intents_rocksdb_options.block_based_table_mem_tracker = intentdb_mem_tracker_;
@@ -912,7 +1014,7 @@ Status Tablet::OpenKeyValueTablet() {
     intents_db_->ListenFilesChanged(std::bind(&Tablet::CleanupIntentFiles, this));
   }
 
-  ql_storage_.reset(new docdb::QLRocksDBStorage(doc_db()));
+  ql_storage_.reset(new docdb::QLRocksDBStorage(doc_db(), parallel_scan_pool_));
   if (transaction_participant_) {
     // We need to set the "cdc_sdk_min_checkpoint_op_id" so that intents don't get
     // garbage collected after transactions are loaded.
@@ -938,6 +1040,10 @@ Status Tablet::OpenKeyValueTablet() {
 }
 
 void Tablet::RegularDbFilesChanged() {
+  if (regular_iterator_pool_) {
+    // Pooled iterators would keep replaced files and flushed memtables alive.
+    regular_iterator_pool_->Invalidate();
+  }
   std::lock_guard lock(num_sst_files_changed_listener_mutex_);
   if (num_sst_files_changed_listener_) {
     num_sst_files_changed_listener_();
@@ -1234,6 +1340,12 @@ std::vector<std::string> Tablet::CompleteShutdownRocksDBs(
 
   rocksdb::Options rocksdb_options;
 
+  if (regular_iterator_pool_) {
+    // Pending operations are paused, so all iterators are already returned to the pool.
+    // Pool itself is kept, since files changed listener could still be invoked during DB shutdown.
+    regular_iterator_pool_->Invalidate();
+  }
+
   std::vector<std::string> db_paths;
   for (auto* db_uniq_ptr : {&intents_db_, &regular_db_}) {
     if (*db_uniq_ptr) {
@@ -1378,6 +1490,40 @@ Status Tablet::ApplyOperation(
       already_applied_to_regular_db);
 }
 
+namespace {
+
+// Registers key range covering strong intents of the batch, weak intents are not used by reads.
+void RegisterIntentsRange(
+    const TransactionId& transaction_id, const docdb::LWKeyValueWriteBatchPB& put_batch,
+    TransactionParticipant* participant) {
+  Slice min_key;
+  Slice max_key;
+  auto update = [&min_key, &max_key](const auto& pairs) {
+    for (const auto& pair : pairs) {
+      auto key = pair.key();
+      if (min_key.empty() || key < min_key) {
+        min_key = key;
+      }
+      if (key > max_key) {
+        max_key = key;
+      }
+    }
+  };
+  update(put_batch.write_pairs());
+  update(put_batch.read_pairs());
+  if (max_key.empty()) {
+    return;
+  }
+  // Intent key is the key followed by intent type and hybrid time, that are less than kMaxByte.
+  std::string end;
+  end.reserve(max_key.size() + 1);
+  end.append(max_key.cdata(), max_key.size());
+  end.push_back(dockv::KeyEntryTypeAsChar::kMaxByte);
+  participant->RegisterIntentsRange(transaction_id, min_key, end);
+}
+
+} // namespace
+
 Status Tablet::WriteTransactionalBatch(
     int64_t batch_idx,
     const docdb::LWKeyValueWriteBatchPB& put_batch,
@@ -1423,7 +1569,16 @@ Status Tablet::WriteTransactionalBatch(
   write_batch.SetDirectWriter(&writer);
   RequestScope request_scope = VERIFY_RESULT(CreateRequestScope());
 
+  std::vector<uint64_t> intent_key_hashes;
+  writer.SetIntentKeyCallback([&intent_key_hashes](Slice doc_path, bool strong) {
+    intent_key_hashes.push_back(LiveIntentsFilter::KeyHash(doc_path, strong));
+  });
+
+  RegisterIntentsRange(transaction_id, put_batch, transaction_participant());
   WriteToRocksDB(frontiers, &write_batch, StorageDbType::kIntents);
+  // Operation still holds locks of its keys, so conflict resolution of other operations does not
+  // observe these intents yet.
+  transaction_participant()->RegisterIntentKeys(transaction_id, intent_key_hashes);
 
   last_batch_data.hybrid_time = hybrid_time;
   last_batch_data.next_write_id = writer.intra_txn_write_id();
@@ -1464,6 +1619,19 @@ Status Tablet::ApplyKeyValueRowOperations(
     regular_write_batch.SetDirectWriter(&batcher);
     WriteToRocksDB(frontiers, &regular_write_batch, StorageDbType::kRegular);
 
+    if (row_cache_) {
+      // Apply is done before the write becomes safe for reads, so cached values of written keys
+      // are not visible to reads that should see the write.
+      for (const auto& pair : put_batch.write_pairs()) {
+        auto doc_key_size = dockv::DocKey::EncodedSize(pair.key(), dockv::DocKeyPart::kWholeDocKey);
+        if (doc_key_size.ok()) {
+          row_cache_->Invalidate(pair.key().Prefix(*doc_key_size), write_hybrid_time);
+        } else {
+          row_cache_->Clear(write_hybrid_time);
+        }
+      }
+    }
+
     if (intents_write_batch.Count() != 0) {
       if (!metadata_->IsUnderXClusterReplication()) {
         RETURN_NOT_OK(metadata_->SetIsUnderXClusterReplicationAndFlush(true));
@@ -1537,7 +1705,8 @@ Status Tablet::HandleRedisReadRequest(const docdb::ReadOperationData& read_opera
   ScopedTabletMetricsLatencyTracker metrics_tracker(
       metrics_.get(), TabletEventStats::kQlReadLatency);
 
-  docdb::RedisReadOperation doc_op(redis_read_request, doc_db(), read_operation_data);
+  docdb::RedisReadOperation doc_op(
+      redis_read_request, doc_db(), read_operation_data, row_cache_.get());
   RETURN_NOT_OK(doc_op.Execute());
   *response = std::move(doc_op.response());
   return Status::OK();
@@ -1572,6 +1741,7 @@ Status Tablet::HandleQLReadRequest(
   RETURN_NOT_OK(scoped_read_operation);
   ScopedTabletMetricsLatencyTracker metrics_tracker(
       metrics_.get(), TabletEventStats::kQlReadLatency);
+  SampleReadKey(ql_read_request);
 
   bool schema_version_compatible = IsSchemaVersionCompatible(
       metadata()->schema_version(), ql_read_request.schema_version(),
@@ -1607,6 +1777,16 @@ Status Tablet::HandleQLReadRequest(
   return status;
 }
 
+void Tablet::SampleReadKey(const QLReadRequestPB& ql_read_request) {
+  // Only reads of particular hash keys are sampled, scans do not hit a single key range.
+  if (!key_access_sampler_->RecordAccess() || ql_read_request.hashed_column_values().empty()) {
+    return;
+  }
+  dockv::KeyBytes key;
+  dockv::AppendHash(ql_read_request.hash_code(), &key);
+  key_access_sampler_->AddSample(key.AsSlice());
+}
+
 Status Tablet::CreatePagingStateForRead(const QLReadRequestPB& ql_read_request,
                                         const size_t row_count,
                                         QLResponsePB* response) const {
@@ -1666,6 +1846,7 @@ Status Tablet::HandlePgsqlReadRequest(
   auto scoped_read_operation = CreateScopedRWOperationNotBlockingRocksDbShutdownStart(
       read_operation_data.deadline);
   RETURN_NOT_OK(scoped_read_operation);
+  SampleReadKey(pgsql_read_request);
 
   docdb::DocDBStatistics* statistics = nullptr;
   TabletMetrics* metrics = metrics_.get();
@@ -1697,6 +1878,20 @@ Status Tablet::HandlePgsqlReadRequest(
   return status;
 }
 
+void Tablet::SampleReadKey(const PgsqlReadRequestPB& pgsql_read_request) {
+  if (!key_access_sampler_->RecordAccess()) {
+    return;
+  }
+  if (pgsql_read_request.has_ybctid_column_value()) {
+    key_access_sampler_->AddSample(pgsql_read_request.ybctid_column_value().value().binary_value());
+  } else if (!pgsql_read_request.partition_column_values().empty() &&
+             pgsql_read_request.has_hash_code()) {
+    dockv::KeyBytes key;
+    dockv::AppendHash(pgsql_read_request.hash_code(), &key);
+    key_access_sampler_->AddSample(key.AsSlice());
+  }
+}
+
 Status Tablet::DoHandlePgsqlReadRequest(
     ScopedRWOperation* scoped_read_operation,
     docdb::DocDBStatistics* statistics,
@@ -1967,6 +2162,20 @@ Status Tablet::Flush(FlushMode mode, FlushFlags flags, int64_t ignore_if_flushed
   return Status::OK();
 }
 
+Status Tablet::FlushAndCheckNoUnflushedData() {
+  RETURN_NOT_OK(Flush(FlushMode::kSync));
+
+  auto scoped_read_operation = CreateScopedRWOperationBlockingRocksDbShutdownStart();
+  RETURN_NOT_OK(scoped_read_operation);
+
+  for (auto* db : {regular_db_.get(), intents_db_.get()}) {
+    if (db && db->GetFlushAbility() != rocksdb::FlushAbility::kNoNewData) {
+      return STATUS_FORMAT(IllegalState, "$0 has unflushed data after flush", db->GetName());
+    }
+  }
+  return Status::OK();
+}
+
 Status Tablet::WaitForFlush() {
   TRACE_EVENT0("tablet", "Tablet::WaitForFlush");
 
@@ -1986,7 +2195,12 @@ Status Tablet::FlushSuperblock(OnlyIfDirty only_if_dirty) {
 
 Status Tablet::ImportData(const std::string& source_dir) {
   // We import only regular records, so don't have to deal with intents here.
-  return regular_db_->Import(source_dir);
+  RETURN_NOT_OK(regular_db_->Import(source_dir));
+  if (row_cache_) {
+    // Imported values could have any hybrid time, so nothing is cached until the DB is reopened.
+    row_cache_->Clear(HybridTime::kMax);
+  }
+  return Status::OK();
 }
 
 // We apply intents by iterating over whole transaction reverse index.
@@ -2013,6 +2227,22 @@ Result<docdb::ApplyTransactionState> Tablet::ApplyIntents(const TransactionApply
   docdb::ConsensusFrontiers frontiers;
   auto frontiers_ptr = data.op_id.empty() ? nullptr : InitFrontiers(data, &frontiers);
   context.SetFrontiers(frontiers_ptr);
+  auto min_ingest_records = FLAGS_apply_intents_sst_ingestion_min_records;
+  if (min_ingest_records) {
+    // Records are collected before writing, because the file could not be added to the DB while
+    // the write batch is being applied.
+    docdb::BufferedWriteHandler handler;
+    RETURN_NOT_OK(intents_writer.Apply(&handler));
+    auto file_path = JoinPathSegments(
+        metadata()->rocksdb_dir(), Format("apply-$0.sst.tmp", data.transaction_id));
+    rocksdb::WriteBatch write_batch;
+    auto num_ingested = handler.Flush(
+        regular_db_.get(), file_path, min_ingest_records, &write_batch);
+    VLOG_WITH_PREFIX(2) << "Ingested " << num_ingested << " of " << handler.num_records()
+                        << " records of " << data.transaction_id;
+    WriteToRocksDB(frontiers_ptr, &write_batch, StorageDbType::kRegular);
+    return context.apply_state();
+  }
   WriteToRocksDB(frontiers_ptr, &regular_write_batch, StorageDbType::kRegular);
   return context.apply_state();
 }
@@ -2023,25 +2253,24 @@ Status Tablet::RemoveIntentsImpl(
   auto scoped_read_operation = CreateScopedRWOperationNotBlockingRocksDbShutdownStart();
   RETURN_NOT_OK(scoped_read_operation);
 
+  docdb::RemoveIntentsBatchWriter writer(
+      std::vector<TransactionId>(ids.begin(), ids.end()), static_cast<uint8_t>(reason),
+      intents_db_.get());
+  // Intents of applied transactions are removed as part of the apply, only the cleanup of
+  // intents of aborted and otherwise finished transactions is throttled.
+  const bool throttle = reason != RemoveReason::kApplied && reason != RemoveReason::kLargeApplied;
   rocksdb::WriteBatch intents_write_batch;
-  for (const auto& id : ids) {
-    boost::optional<docdb::ApplyTransactionState> apply_state;
-    for (;;) {
-      docdb::RemoveIntentsContext context(id, static_cast<uint8_t>(reason));
-      docdb::IntentsWriter writer(
-          apply_state ? apply_state->key : Slice(), intents_db_.get(), &context);
-      intents_write_batch.SetDirectWriter(&writer);
-      docdb::ConsensusFrontiers frontiers;
-      auto frontiers_ptr = InitFrontiers(data, &frontiers);
-      WriteToRocksDB(frontiers_ptr, &intents_write_batch, StorageDbType::kIntents);
-
-      if (!context.apply_state().active()) {
-        break;
-      }
-
-      apply_state = std::move(context.apply_state());
-      intents_write_batch.Clear();
-
+  while (!writer.Done()) {
+    intents_write_batch.SetDirectWriter(&writer);
+    docdb::ConsensusFrontiers frontiers;
+    auto frontiers_ptr = InitFrontiers(data, &frontiers);
+    WriteToRocksDB(frontiers_ptr, &intents_write_batch, StorageDbType::kIntents);
+    intents_write_batch.Clear();
+
+    if (throttle) {
+      ThrottleIntentsCleanup(writer.last_batch_bytes());
+    }
+    if (!writer.Done()) {
       AtomicFlagSleepMs(&FLAGS_apply_intents_task_injected_delay_ms);
     }
   }
@@ -2049,6 +2278,19 @@ Status Tablet::RemoveIntentsImpl(
   return Status::OK();
 }
 
+void Tablet::ThrottleIntentsCleanup(size_t bytes) {
+  auto* rate_limiter = tablet_options_.intents_cleanup_rate_limiter.get();
+  if (!rate_limiter) {
+    return;
+  }
+  const auto burst = std::max<size_t>(rate_limiter->GetSingleBurstBytes(), 1);
+  while (bytes > 0) {
+    auto request = std::min(bytes, burst);
+    rate_limiter->Request(request, IOPriority::kLow);
+    bytes -= request;
+  }
+}
+
 
 Status Tablet::RemoveIntents(
     const RemoveIntentsData& data, RemoveReason reason, const TransactionId& id) {
@@ -2091,7 +2333,10 @@ Result<std::unique_ptr<docdb::YQLRowwiseIteratorIf>> Tablet::CreateCDCSnapshotIt
   if (!next_key.empty()) {
     dockv::SubDocKey start_sub_doc_key;
     dockv::KeyBytes start_key_bytes(next_key);
-    RETURN_NOT_OK(start_sub_doc_key.FullyDecodeFrom(start_key_bytes.AsSlice()));
+    // The key is either the encoded SubDocKey of a snapshot checkpoint, or the encoded DocKey
+    // starting a snapshot range.
+    RETURN_NOT_OK(start_sub_doc_key.FullyDecodeFromKeyWithOptionalHybridTime(
+        start_key_bytes.AsSlice()));
     encoded_next_key = start_sub_doc_key.doc_key().Encode();
     VLOG_WITH_PREFIX(2) << "The nextKey doc is " << encoded_next_key;
   }
@@ -2396,6 +2641,28 @@ void MaybeSleepToThrottleBackfill(
   }
 }
 
+// Slow down before the next batch when writing the previous batch to the index took longer than
+// backfill_index_target_write_latency_ms. Pausing for the time the flush was late, scaled by how
+// late it was, backs off quickly while the foreground workload suffers and keeps backfill at full
+// speed otherwise.
+void MaybeSleepToThrottleBackfillOnLatency(MonoDelta flush_latency) {
+  auto target_ms = GetAtomicFlag(&FLAGS_backfill_index_target_write_latency_ms);
+  if (target_ms <= 0) {
+    return;
+  }
+  auto target = MonoDelta::FromMilliseconds(target_ms);
+  if (flush_latency <= target) {
+    return;
+  }
+  auto delay = MonoDelta::FromSeconds(
+      (flush_latency - target).ToSeconds() *
+      std::min(flush_latency.ToSeconds() / target.ToSeconds(), 10.0));
+  YB_LOG_EVERY_N_SECS(INFO, 10)
+      << "Index backfill write latency " << flush_latency << " exceeds target " << target
+      << ", pausing for " << delay;
+  SleepFor(delay);
+}
+
 bool CanProceedToBackfillMoreRows(
     const BackfillParams& backfill_params,
     size_t number_of_rows_processed) {
@@ -2755,8 +3022,10 @@ Status Tablet::FlushWriteIndexBatch(
   VLOG(1) << Format("Flushing $0 ops to the index",
                     (!ops_by_primary_key.empty() ? ops_by_primary_key.size()
                                                  : write_ops.size()));
+  auto flush_start = MonoTime::Now();
   RETURN_NOT_OK(FlushWithRetries(session, write_ops, kMaxNumRetries, failed_indexes));
   index_requests->clear();
+  MaybeSleepToThrottleBackfillOnLatency(MonoTime::Now() - flush_start);
 
   return Status::OK();
 }
@@ -3349,6 +3618,20 @@ Result<HybridTime> Tablet::OldestMutableMemtableWriteHybridTime() const {
   return result;
 }
 
+Result<uint64_t> Tablet::MutableMemtablesSize() const {
+  auto scoped_read_operation = CreateScopedRWOperationBlockingRocksDbShutdownStart();
+  RETURN_NOT_OK(scoped_read_operation);
+
+  uint64_t result = 0;
+  for (auto* db : { regular_db_.get(), intents_db_.get() }) {
+    uint64_t size = 0;
+    if (db && db->GetIntProperty(rocksdb::DB::Properties::kCurSizeActiveMemTable, &size)) {
+      result += size;
+    }
+  }
+  return result;
+}
+
 const yb::SchemaPtr Tablet::schema() const {
   return metadata_->schema();
 }
@@ -3534,7 +3817,13 @@ Status Tablet::ForceRocksDBCompact(
   auto scoped_operation = CreateScopedRWOperationNotBlockingRocksDbShutdownStart();
   RETURN_NOT_OK(scoped_operation);
   if (regular_db_) {
-    RETURN_NOT_OK(docdb::ForceRocksDBCompact(regular_db_.get(), regular_options));
+    if (regular_options.compaction_reason != rocksdb::CompactionReason::kPostSplitCompaction &&
+        (FLAGS_full_compaction_input_size_limit_per_job_bytes > 0 ||
+         metadata_->full_compaction_file_number_upper_bound() != 0)) {
+      RETURN_NOT_OK(IncrementalFullCompactRegularDb(regular_options, /* resume_only= */ false));
+    } else {
+      RETURN_NOT_OK(docdb::ForceRocksDBCompact(regular_db_.get(), regular_options));
+    }
   }
   if (intents_db_) {
     if (!intents_options.skip_flush) {
@@ -3635,6 +3924,19 @@ uint64_t Tablet::GetCurrentVersionNumSSTFiles() const {
   }, 0);
 }
 
+double Tablet::GetWriteStallPressure() const {
+  auto scoped_operation = CreateScopedRWOperationBlockingRocksDbShutdownStart();
+  if (!scoped_operation.ok()) {
+    return 0.0;
+  }
+  std::lock_guard lock(component_lock_);
+  double result = regular_db_ ? regular_db_->GetWriteStallPressure() : 0.0;
+  if (intents_db_) {
+    result = std::max(result, intents_db_->GetWriteStallPressure());
+  }
+  return result;
+}
+
 std::pair<int, int> Tablet::GetNumMemtables() const {
   int intents_num_memtables = 0;
   int regular_num_memtables = 0;
@@ -3903,8 +4205,17 @@ Result<std::string> Tablet::GetEncodedMiddleSplitKey(std::string *partition_spli
         Slice(key_bounds_.upper).ToDebugHexString());
   };
 
-  // TODO(tsplit): should take key_bounds_ into account.
-  auto middle_key = VERIFY_RESULT(regular_db_->GetMiddleKey());
+  // Hot tablet is split at the median of accessed keys, so the load is shared by the children.
+  std::string middle_key;
+  if (key_access_sampler_->IsHot()) {
+    middle_key = key_access_sampler_->MedianKey();
+    LOG_IF_WITH_PREFIX(INFO, !middle_key.empty())
+        << "Using median of accessed keys as split key: " << Slice(middle_key).ToDebugHexString();
+  }
+  if (middle_key.empty()) {
+    // TODO(tsplit): should take key_bounds_ into account.
+    middle_key = VERIFY_RESULT(regular_db_->GetMiddleKey());
+  }
 
   // In some rare cases middle key can point to a special internal record which is not visible
   // for a user, but tablet splitting routines expect the specific structure for partition keys
@@ -3989,6 +4300,11 @@ void Tablet::TriggerPostSplitCompactionIfNeeded() {
   if (!StillHasOrphanedPostSplitDataAbortable()) {
     return;
   }
+  if (!FLAGS_enable_post_split_compaction) {
+    VLOG_WITH_PREFIX(1) << "Post split compaction disabled, parent data will be dropped by regular "
+                        << "compactions";
+    return;
+  }
   auto status = TriggerManualCompactionIfNeeded(rocksdb::CompactionReason::kPostSplitCompaction);
   if (status.ok()) {
     ts_post_split_compaction_added_->Increment();
@@ -4003,6 +4319,11 @@ Status Tablet::TriggerManualCompactionIfNeeded(rocksdb::CompactionReason compact
     return STATUS(ServiceUnavailable, "Full compaction thread pool unavailable.");
   }
 
+  return SubmitFullCompactionTask(
+      std::bind(&Tablet::TriggerManualCompactionSync, this, compaction_reason));
+}
+
+Status Tablet::SubmitFullCompactionTask(std::function<void()> task) {
   std::lock_guard lock(full_compaction_token_mutex_);
   if (HasActiveFullCompactionUnlocked()) {
     return STATUS(
@@ -4014,8 +4335,116 @@ Status Tablet::TriggerManualCompactionIfNeeded(rocksdb::CompactionReason compact
         full_compaction_pool_->NewToken(ThreadPool::ExecutionMode::SERIAL);
   }
 
-  return full_compaction_task_pool_token_->SubmitFunc(
-      std::bind(&Tablet::TriggerManualCompactionSync, this, compaction_reason));
+  return full_compaction_task_pool_token_->SubmitFunc(std::move(task));
+}
+
+void Tablet::TriggerInterruptedFullCompactionIfNeeded() {
+  if (!regular_db_ || metadata_->full_compaction_file_number_upper_bound() == 0) {
+    return;
+  }
+  if (!full_compaction_pool_ || state_ != State::kOpen) {
+    return;
+  }
+  auto status = SubmitFullCompactionTask([this] {
+    rocksdb::CompactRangeOptions options;
+    options.skip_flush = docdb::SkipFlush::kTrue;
+    options.compaction_reason = rocksdb::CompactionReason::kScheduledFullCompaction;
+    options.exclusive_manual_compaction = FLAGS_tablet_exclusive_full_compaction;
+    auto scoped_operation = CreateScopedRWOperationNotBlockingRocksDbShutdownStart();
+    auto status = scoped_operation.ok()
+        ? IncrementalFullCompactRegularDb(options, /* resume_only= */ true)
+        : MoveStatus(scoped_operation);
+    WARN_WITH_PREFIX_NOT_OK(status, "Failed to resume interrupted full compaction");
+  });
+  if (!status.ok() && !status.IsServiceUnavailable()) {
+    LOG_WITH_PREFIX(WARNING) << "Failed to submit interrupted full compaction: " << status;
+  }
+}
+
+Status Tablet::IncrementalFullCompactRegularDb(
+    const rocksdb::CompactRangeOptions& options, bool resume_only) {
+  auto file_number_upper_bound = metadata_->full_compaction_file_number_upper_bound();
+  if (file_number_upper_bound != 0) {
+    LOG_WITH_PREFIX(INFO) << "Resuming interrupted full compaction of files before "
+                          << file_number_upper_bound;
+    RETURN_NOT_OK(CompactRegularDbFilesBefore(options, file_number_upper_bound));
+  }
+  if (resume_only) {
+    return Status::OK();
+  }
+  if (FLAGS_full_compaction_input_size_limit_per_job_bytes == 0) {
+    return docdb::ForceRocksDBCompact(regular_db_.get(), options);
+  }
+
+  // Files produced by the flush should be included into the compaction, so flush before picking
+  // the file number upper bound.
+  if (!options.skip_flush) {
+    RETURN_NOT_OK_PREPEND(
+        regular_db_->Flush(rocksdb::FlushOptions()), "Pre-compaction flush of regular db failed");
+  }
+  file_number_upper_bound = regular_db_->GetNextFileNumber();
+  uint64_t input_size = 0;
+  for (const auto& file : regular_db_->GetLiveFilesMetaData()) {
+    if (file.name_id < file_number_upper_bound) {
+      input_size += file.total_size;
+    }
+  }
+  metadata_->set_full_compaction_progress(file_number_upper_bound, input_size);
+  RETURN_NOT_OK(metadata_->Flush());
+  return CompactRegularDbFilesBefore(options, file_number_upper_bound);
+}
+
+Status Tablet::CompactRegularDbFilesBefore(
+    rocksdb::CompactRangeOptions options, uint64_t file_number_upper_bound) {
+  const auto input_size_limit = FLAGS_full_compaction_input_size_limit_per_job_bytes;
+  options.skip_flush = docdb::SkipFlush::kTrue;
+  options.file_number_upper_bound = file_number_upper_bound;
+  options.input_size_limit_per_job =
+      input_size_limit > 0 ? input_size_limit : std::numeric_limits<uint64_t>::max();
+  UpdateFullCompactionProgress(regular_db_.get());
+  RETURN_NOT_OK(docdb::ForceRocksDBCompact(regular_db_.get(), options));
+
+  // Steps of incremental compaction are not full compactions on their own.
+  if (PREDICT_TRUE(!FLAGS_TEST_disable_adding_last_compaction_to_tablet_metadata)) {
+    metadata_->set_last_full_compaction_time(clock()->Now().ToUint64());
+  }
+  metadata_->set_full_compaction_progress(0, 0);
+  RETURN_NOT_OK(metadata_->Flush());
+  if (full_compaction_progress_) {
+    full_compaction_progress_->set_value(100);
+  }
+  return Status::OK();
+}
+
+void Tablet::UpdateFullCompactionProgress(rocksdb::DB* db) {
+  const auto file_number_upper_bound = metadata_->full_compaction_file_number_upper_bound();
+  if (!full_compaction_progress_ || file_number_upper_bound == 0) {
+    return;
+  }
+  const auto input_size = metadata_->full_compaction_input_size();
+  uint64_t remaining_size = 0;
+  for (const auto& file : db->GetLiveFilesMetaData()) {
+    if (file.name_id < file_number_upper_bound) {
+      remaining_size += file.total_size;
+    }
+  }
+  const auto compacted_size = input_size - std::min(remaining_size, input_size);
+  full_compaction_progress_->set_value(
+      input_size ? narrow_cast<uint32_t>(compacted_size * 100 / input_size) : 100);
+}
+
+bool Tablet::HasFilesInheritedFromParent(rocksdb::DB* db) {
+  const auto file_number_upper_bound = metadata_->post_split_compaction_file_number_upper_bound();
+  if (!file_number_upper_bound || *file_number_upper_bound == 0) {
+    // Inherited files are unknown, so assume they are still there.
+    return true;
+  }
+  for (const auto& file : db->GetLiveFilesMetaData()) {
+    if (file.name_id < *file_number_upper_bound) {
+      return true;
+    }
+  }
+  return false;
 }
 
 Status Tablet::TriggerAdminFullCompactionIfNeededHelper(
@@ -4058,6 +4487,18 @@ bool Tablet::HasActiveTTLFileExpiration() {
             dockv::ValueControlFields::kMaxTtl;
 }
 
+Result<size_t> Tablet::ScheduleExpiredFilesDeletion() {
+  if (!FLAGS_tablet_enable_ttl_file_filter || state_ != State::kOpen) {
+    return 0;
+  }
+  auto scoped_operation = CreateScopedRWOperationBlockingRocksDbShutdownStart();
+  RETURN_NOT_OK(scoped_operation);
+  if (!regular_db_) {
+    return 0;
+  }
+  return regular_db_->ScheduleFilteredFilesDeletion();
+}
+
 bool Tablet::IsEligibleForFullCompaction() {
   return !HasActiveFullCompaction()
       && !HasActiveTTLFileExpiration()
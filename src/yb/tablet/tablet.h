@@ -446,6 +446,9 @@ class Tablet : public AbstractTablet,
 
   Status WaitForFlush();
 
+  // Synchronously flushes all RocksDBs and checks that they don't have unflushed data left.
+  Status FlushAndCheckNoUnflushedData();
+
   Status FlushSuperblock(OnlyIfDirty only_if_dirty);
 
   // Prepares the transaction context for the alter schema operation.
@@ -514,6 +517,12 @@ class Tablet : public AbstractTablet,
   // May be nullptr in unit tests, etc.
   TabletMetrics* metrics() { return metrics_.get(); }
 
+  // Tracks reads and writes of the tablet to detect hot key ranges.
+  KeyAccessSampler& key_access_sampler() { return *key_access_sampler_; }
+
+  // Tracks origins of requests to the tablet leader, to move the leader closer to its clients.
+  RequestOriginTracker& request_origin_tracker() { return *request_origin_tracker_; }
+
   // Return handle to the metric entity of this tablet/table.
   const scoped_refptr<MetricEntity>& GetTableMetricsEntity() const {
     return table_metrics_entity_;
@@ -543,6 +552,9 @@ class Tablet : public AbstractTablet,
   // is empty.
   Result<HybridTime> OldestMutableMemtableWriteHybridTime() const;
 
+  // Returns the total size of mutable memtables of regular and intents RocksDB.
+  Result<uint64_t> MutableMemtablesSize() const;
+
   // For non-kudu table type fills key-value batch in transaction state request and updates
   // request in state. Due to acquiring locks it can block the thread.
   void AcquireLocksAndPerformDocOperations(std::unique_ptr<WriteQuery> query);
@@ -626,7 +638,8 @@ class Tablet : public AbstractTablet,
         intents_db_.get(),
         &key_bounds_,
         retention_policy_.get(),
-        metrics ? metrics : metrics_.get() };
+        metrics ? metrics : metrics_.get(),
+        regular_iterator_pool_.get() };
   }
 
   // Returns approximate middle key for tablet split:
@@ -660,6 +673,10 @@ class Tablet : public AbstractTablet,
   std::pair<uint64_t, uint64_t> GetCurrentVersionSstFilesAllSizes() const;
   uint64_t GetCurrentVersionNumSSTFiles() const;
 
+  // Returns the max write stall pressure of regular and intents DBs, see
+  // rocksdb::DB::GetWriteStallPressure.
+  double GetWriteStallPressure() const;
+
   void ListenNumSSTFilesChanged(std::function<void()> listener);
 
   // Returns the number of memtables in intents and regular db-s.
@@ -769,6 +786,10 @@ class Tablet : public AbstractTablet,
   // previously by this tablet.
   void TriggerPostSplitCompactionIfNeeded();
 
+  // Resumes an incremental full compaction of the regular DB that was interrupted by tablet
+  // shutdown, see FLAGS_full_compaction_input_size_limit_per_job_bytes.
+  void TriggerInterruptedFullCompactionIfNeeded();
+
   // Triggers a manual compaction on this tablet (e.g. post tablet split, scheduled).
   // It is an error to call this function if it was called previously
   // and that compaction has not yet finished.
@@ -795,6 +816,10 @@ class Tablet : public AbstractTablet,
 
   bool HasActiveTTLFileExpiration();
 
+  // Schedules a background compaction of the regular DB that removes SST files which are fully
+  // expired according to the TTL file filter. Returns the number of such files.
+  Result<size_t> ScheduleExpiredFilesDeletion();
+
   // Indicates whether this tablet can currently be compacted by any (non-admin) triggered
   // full compaction.
   bool IsEligibleForFullCompaction();
@@ -994,6 +1019,29 @@ class Tablet : public AbstractTablet,
       const rocksdb::CompactRangeOptions& regular_options,
       const rocksdb::CompactRangeOptions& intents_options);
 
+  Status SubmitFullCompactionTask(std::function<void()> task);
+
+  // Full compaction of the regular DB, that is done in steps limited by
+  // FLAGS_full_compaction_input_size_limit_per_job_bytes. Progress is stored in the tablet metadata,
+  // so compaction interrupted by shutdown continues from the last finished step.
+  // Only finishes interrupted compaction when resume_only is true.
+  Status IncrementalFullCompactRegularDb(
+      const rocksdb::CompactRangeOptions& options, bool resume_only);
+
+  // Compacts files of the regular DB with number less than file_number_upper_bound.
+  Status CompactRegularDbFilesBefore(
+      rocksdb::CompactRangeOptions options, uint64_t file_number_upper_bound);
+
+  void UpdateFullCompactionProgress(rocksdb::DB* db);
+
+  // Returns true if db still contains files inherited from the parent tablet, i.e. files with
+  // numbers below post_split_compaction_file_number_upper_bound.
+  bool HasFilesInheritedFromParent(rocksdb::DB* db);
+
+  // Passes the key of a sampled read to key_access_sampler_.
+  void SampleReadKey(const QLReadRequestPB& ql_read_request);
+  void SampleReadKey(const PgsqlReadRequestPB& pgsql_read_request);
+
   // Opens read-only rocksdb at the specified directory and checks for any file corruption.
   Status OpenDbAndCheckIntegrity(const std::string& db_dir);
 
@@ -1068,6 +1116,8 @@ class Tablet : public AbstractTablet,
   MemTrackerPtr metric_mem_tracker_;
   std::unique_ptr<TabletMetrics> metrics_;
   std::shared_ptr<void> metric_detacher_;
+  std::unique_ptr<KeyAccessSampler> key_access_sampler_;
+  std::unique_ptr<RequestOriginTracker> request_origin_tracker_;
 
   // A pointer to the server's clock.
   scoped_refptr<server::Clock> clock_;
@@ -1094,6 +1144,10 @@ class Tablet : public AbstractTablet,
   // RocksDB database instances for key-value tables.
   std::unique_ptr<rocksdb::DB> regular_db_;
   std::unique_ptr<rocksdb::DB> intents_db_;
+  // Declared after regular_db_, so pooled iterators are destroyed before the DB.
+  std::unique_ptr<docdb::RocksDBIteratorPool> regular_iterator_pool_;
+  // Latest values of hot keys, see tablet_row_cache_size_bytes.
+  std::unique_ptr<docdb::RowCache> row_cache_;
   std::atomic<bool> rocksdb_shutdown_requested_{false};
 
   // Optional key bounds (see docdb::KeyBounds) served by this tablet.
@@ -1166,6 +1220,9 @@ class Tablet : public AbstractTablet,
   template <class Ids>
   Status RemoveIntentsImpl(const RemoveIntentsData& data, RemoveReason reason, const Ids& ids);
 
+  // Waits for tokens of the intents cleanup rate limiter for specified number of removed bytes.
+  void ThrottleIntentsCleanup(size_t bytes);
+
   // Tries to find intent .SST files that could be deleted and remove them.
   void CleanupIntentFiles();
   void DoCleanupIntentFiles();
@@ -1232,9 +1289,15 @@ class Tablet : public AbstractTablet,
   // Pointer to shared admin triggered thread pool in TsTabletManager.
   ThreadPool* admin_triggered_compaction_pool_ = nullptr;
 
+  // Pointer to shared thread pool in TsTabletManager, used to scan key ranges in parallel.
+  ThreadPool* parallel_scan_pool_ = nullptr;
+
   // Gauge to monitor post-split compactions that have been started.
   scoped_refptr<yb::AtomicGauge<uint64_t>> ts_post_split_compaction_added_;
 
+  // Percent of the incremental full compaction input that was already compacted.
+  scoped_refptr<yb::AtomicGauge<uint32_t>> full_compaction_progress_;
+
   // Function to get min schema version for a table needed for xCluster.
   std::function<uint32_t(const TableId&, const ColocationId&)>
       get_min_xcluster_schema_version_ = nullptr;
@@ -346,6 +346,32 @@ TEST_F(BootstrapTest, TestOrphanedReplicate) {
   EXPECT_EQ("term: 1 index: 1", boot_info.last_id.ShortDebugString());
 }
 
+// Bootstrap of a cleanly shut down tablet should not replay the log.
+TEST_F(BootstrapTest, TestSkipReplayAfterCleanShutdown) {
+  BuildLog();
+  const auto current_op_id = MakeOpId(1, current_index_);
+  AppendReplicateBatch(current_op_id, current_op_id);
+
+  {
+    RaftGroupMetadataPtr meta = ASSERT_RESULT(LoadOrCreateTestRaftGroupMetadata());
+    meta->set_clean_shutdown_op_id(OpId::FromPB(current_op_id));
+    ASSERT_OK(meta->Flush());
+  }
+
+  ConsensusBootstrapInfo boot_info;
+  TabletPtr tablet;
+  ASSERT_OK(BootstrapTestTablet(&tablet, &boot_info));
+
+  ASSERT_TRUE(test_hooks_->actual_report.replayed.empty())
+      << ToString(test_hooks_->actual_report.replayed);
+  ASSERT_TRUE(boot_info.orphaned_replicates.empty());
+  ASSERT_EQ("term: 1 index: 1", boot_info.last_id.ShortDebugString());
+  ASSERT_EQ("term: 1 index: 1", boot_info.last_committed_id.ShortDebugString());
+
+  // The marker is cleared, so the next bootstrap replays the log.
+  ASSERT_FALSE(tablet->metadata()->clean_shutdown_op_id().valid());
+}
+
 // Bootstrap should fail if no ConsensusMetadata file exists.
 TEST_F(BootstrapTest, TestMissingConsensusMetadata) {
   BuildLog();
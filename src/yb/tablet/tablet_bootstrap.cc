@@ -32,6 +32,7 @@
 
 #include "yb/tablet/tablet_bootstrap.h"
 
+#include <future>
 #include <map>
 #include <set>
 
@@ -125,6 +126,10 @@ DEFINE_UNKNOWN_bool(force_recover_flushed_frontier, false,
 TAG_FLAG(force_recover_flushed_frontier, hidden);
 TAG_FLAG(force_recover_flushed_frontier, advanced);
 
+DEFINE_RUNTIME_bool(tablet_bootstrap_read_ahead_segments, true,
+    "Read and decode the next log segment in a separate thread while entries of the current "
+    "segment are replayed during tablet bootstrap.");
+
 DEFINE_UNKNOWN_bool(skip_flushed_entries, true,
             "Only replay WAL entries that are not flushed to RocksDB or within the retryable "
             "request timeout.");
@@ -1230,6 +1235,24 @@ class TabletBootstrap {
   //
   // This functionality was originally introduced in
   // https://github.com/yugabyte/yugabyte-db/commit/41ef3f75e3c68686595c7613f53b649823b84fed
+  // Returns true if all operations up to the last one in the log were applied and flushed before
+  // the tablet was shut down, so there is nothing to replay.
+  bool CanSkipReplayAfterCleanShutdown(const OpId& clean_shutdown_op_id) {
+    if (!clean_shutdown_op_id.valid() || !GetAtomicFlag(&FLAGS_skip_wal_rewrite)) {
+      return false;
+    }
+    // Retryable requests are bootstrapped from the WAL, unless they were flushed at shutdown.
+    if (data_.bootstrap_retryable_requests && data_.retryable_requests_manager &&
+        data_.retryable_requests_manager->retryable_requests().GetMaxReplicatedOpId() <
+            clean_shutdown_op_id) {
+      LOG_WITH_PREFIX(INFO)
+          << "Retryable requests are not flushed up to clean shutdown op id "
+          << clean_shutdown_op_id << ", replaying log";
+      return false;
+    }
+    return true;
+  }
+
   SegmentSequence::const_iterator SkipFlushedEntries(SegmentSequence* segments_ptr) {
     static const char* kBootstrapOptimizerLogPrefix =
         "Bootstrap optimizer (skip_flushed_entries): ";
@@ -1413,6 +1436,14 @@ class TabletBootstrap {
       RETURN_NOT_OK(tablet_->snapshot_coordinator()->Load(tablet_.get()));
     }
 
+    // The clean shutdown op id is only valid until the WAL is appended again, so it is cleared
+    // before the log is opened.
+    const auto clean_shutdown_op_id = meta_->clean_shutdown_op_id();
+    if (clean_shutdown_op_id.valid()) {
+      meta_->set_clean_shutdown_op_id(OpId::Invalid());
+      RETURN_NOT_OK(meta_->Flush());
+    }
+
     replay_state_ = std::make_unique<ReplayState>(flushed_op_ids, LogPrefix());
     replay_state_->max_committed_hybrid_time = VERIFY_RESULT(tablet_->MaxPersistentHybridTime());
 
@@ -1456,7 +1487,16 @@ class TabletBootstrap {
       }
     }
     // Find the earliest log segment we need to read, so the rest can be ignored.
-    auto iter = should_skip_flushed_entries ? SkipFlushedEntries(&segments) : segments.begin();
+    SegmentSequence::const_iterator iter;
+    if (should_skip_flushed_entries && CanSkipReplayAfterCleanShutdown(clean_shutdown_op_id)) {
+      LOG_WITH_PREFIX(INFO) << "Tablet was cleanly shut down at " << clean_shutdown_op_id
+                            << ", skipping log replay";
+      iter = segments.end();
+      replay_state_->prev_op_id = clean_shutdown_op_id;
+      replay_state_->UpdateCommittedOpId(clean_shutdown_op_id);
+    } else {
+      iter = should_skip_flushed_entries ? SkipFlushedEntries(&segments) : segments.begin();
+    }
 
     OpId last_committed_op_id;
     OpId last_read_entry_op_id;
@@ -1466,10 +1506,20 @@ class TabletBootstrap {
             ? data_.retryable_requests_manager->retryable_requests().GetMaxReplicatedOpId()
             : OpId::Min();
     RestartSafeCoarseTimePoint last_entry_time;
+    // Entries of the segment following the one being replayed, read in background.
+    std::future<log::ReadEntriesResult> next_read_result;
     for (; iter != segments.end(); ++iter) {
       const scoped_refptr<ReadableLogSegment>& segment = *iter;
 
-      auto read_result = segment->ReadEntries();
+      auto read_result = next_read_result.valid() ? next_read_result.get()
+                                                  : segment->ReadEntries();
+      auto next_iter = std::next(iter);
+      if (next_iter != segments.end() &&
+          GetAtomicFlag(&FLAGS_tablet_bootstrap_read_ahead_segments)) {
+        next_read_result = std::async(std::launch::async, [next_segment = *next_iter] {
+          return next_segment->ReadEntries();
+        });
+      }
       last_committed_op_id = std::max(
           std::max(last_committed_op_id, read_result.committed_op_id),
           last_op_id_in_retryable_requests);
@@ -45,8 +45,10 @@ typedef std::shared_ptr<TabletPeer> TabletPeerPtr;
 typedef std::weak_ptr<TabletPeer> TabletPeerWeakPtr;
 
 class ChangeMetadataOperation;
+class KeyAccessSampler;
 class Operation;
 class OperationFilter;
+class RequestOriginTracker;
 class SnapshotCoordinator;
 class SnapshotOperation;
 class SplitOperation;
@@ -82,6 +84,7 @@ YB_STRONGLY_TYPED_BOOL(AbortOps);
 YB_STRONGLY_TYPED_BOOL(Destroy);
 YB_STRONGLY_TYPED_BOOL(DisableFlushOnShutdown);
 YB_STRONGLY_TYPED_BOOL(IsSysCatalogTablet);
+YB_STRONGLY_TYPED_BOOL(PersistCleanShutdown);
 YB_STRONGLY_TYPED_BOOL(ShouldAbortActiveTransactions);
 YB_STRONGLY_TYPED_BOOL(TransactionsEnabled);
 
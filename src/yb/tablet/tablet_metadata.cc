@@ -424,6 +424,8 @@ Status KvStoreInfo::LoadFromPB(const std::string& tablet_log_prefix,
   } else {
     post_split_compaction_file_number_upper_bound.reset();
   }
+  full_compaction_file_number_upper_bound = pb.full_compaction_file_number_upper_bound();
+  full_compaction_input_size = pb.full_compaction_input_size();
 
   for (const auto& schedule_id : pb.snapshot_schedules()) {
     snapshot_schedules.insert(VERIFY_RESULT(FullyDecodeSnapshotScheduleId(schedule_id)));
@@ -445,6 +447,9 @@ Status KvStoreInfo::MergeWithRestored(
   } else {
     post_split_compaction_file_number_upper_bound.reset();
   }
+  // Files of an interrupted full compaction are replaced by the restored ones.
+  full_compaction_file_number_upper_bound = 0;
+  full_compaction_input_size = 0;
 
   return RestoreMissingValuesAndMergeTableSchemaPackings(
       snapshot_kvstoreinfo, primary_table_id, colocated, overwrite);
@@ -552,6 +557,13 @@ void KvStoreInfo::ToPB(const TableId& primary_table_id, KvStoreInfoPB* pb) const
   } else {
     pb->clear_post_split_compaction_file_number_upper_bound();
   }
+  if (full_compaction_file_number_upper_bound != 0) {
+    pb->set_full_compaction_file_number_upper_bound(full_compaction_file_number_upper_bound);
+    pb->set_full_compaction_input_size(full_compaction_input_size);
+  } else {
+    pb->clear_full_compaction_file_number_upper_bound();
+    pb->clear_full_compaction_input_size();
+  }
 
   // Putting primary table first, then all other tables.
   pb->mutable_tables()->Reserve(narrow_cast<int>(tables.size() + 1));
@@ -991,6 +1003,9 @@ Status RaftGroupMetadata::LoadFromSuperBlock(const RaftGroupReplicaSuperBlockPB&
     }
 
     last_applied_change_metadata_op_id_ = last_flushed_change_metadata_op_id_;
+
+    clean_shutdown_op_id_ = superblock.has_clean_shutdown_op_id()
+        ? OpId::FromPB(superblock.clean_shutdown_op_id()) : OpId::Invalid();
   }
 
   return Status::OK();
@@ -1165,6 +1180,10 @@ void RaftGroupMetadata::ToSuperBlockUnlocked(RaftGroupReplicaSuperBlockPB* super
     last_applied_change_metadata_op_id_.ToPB(pb.mutable_last_flushed_change_metadata_op_id());
   }
 
+  if (clean_shutdown_op_id_.valid()) {
+    clean_shutdown_op_id_.ToPB(pb.mutable_clean_shutdown_op_id());
+  }
+
   superblock->Swap(&pb);
 }
 
@@ -1719,6 +1738,8 @@ Result<RaftGroupMetadataPtr> RaftGroupMetadata::CreateSubtabletMetadata(
   metadata->kv_store_.parent_data_compacted = false;
   metadata->kv_store_.last_full_compaction_time = kNoLastFullCompactionTime;
   metadata->kv_store_.post_split_compaction_file_number_upper_bound.reset();
+  metadata->kv_store_.full_compaction_file_number_upper_bound = 0;
+  metadata->kv_store_.full_compaction_input_size = 0;
   *metadata->partition_ = partition;
   metadata->state_ = kInitialized;
   metadata->tablet_data_state_ = TABLET_DATA_INIT_STARTED;
@@ -1948,6 +1969,16 @@ OpId RaftGroupMetadata::LastFlushedChangeMetadataOperationOpId() const {
   return last_flushed_change_metadata_op_id_;
 }
 
+OpId RaftGroupMetadata::clean_shutdown_op_id() const {
+  std::lock_guard lock(data_mutex_);
+  return clean_shutdown_op_id_;
+}
+
+void RaftGroupMetadata::set_clean_shutdown_op_id(const OpId& op_id) {
+  std::lock_guard lock(data_mutex_);
+  clean_shutdown_op_id_ = op_id;
+}
+
 OpId RaftGroupMetadata::TEST_LastAppliedChangeMetadataOperationOpId() const {
   std::lock_guard lock(data_mutex_);
   return last_applied_change_metadata_op_id_;
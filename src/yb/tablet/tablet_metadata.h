@@ -236,6 +236,10 @@ struct KvStoreInfo {
   // See KvStoreInfoPB field with the same name.
   std::optional<uint64_t> post_split_compaction_file_number_upper_bound = 0;
 
+  // See KvStoreInfoPB fields with the same name.
+  uint64_t full_compaction_file_number_upper_bound = 0;
+  uint64_t full_compaction_input_size = 0;
+
   // Map of tables sharing this KV-store indexed by the table id.
   // If pieces of the same table live in the same Raft group they should be located in different
   // KV-stores.
@@ -411,6 +415,24 @@ class RaftGroupMetadata : public RefCountedThreadSafe<RaftGroupMetadata>,
     kv_store_.post_split_compaction_file_number_upper_bound = value;
   }
 
+  uint64_t full_compaction_file_number_upper_bound() const {
+    std::lock_guard lock(data_mutex_);
+    return kv_store_.full_compaction_file_number_upper_bound;
+  }
+
+  uint64_t full_compaction_input_size() const {
+    std::lock_guard lock(data_mutex_);
+    return kv_store_.full_compaction_input_size;
+  }
+
+  // Stores state of the incremental full compaction, see KvStoreInfoPB. Zero upper bound means
+  // that there is no such compaction in progress.
+  void set_full_compaction_progress(uint64_t file_number_upper_bound, uint64_t input_size) {
+    std::lock_guard lock(data_mutex_);
+    kv_store_.full_compaction_file_number_upper_bound = file_number_upper_bound;
+    kv_store_.full_compaction_input_size = input_size;
+  }
+
   uint64_t last_full_compaction_time() {
     std::lock_guard lock(data_mutex_);
     return kv_store_.last_full_compaction_time;
@@ -643,6 +665,12 @@ class RaftGroupMetadata : public RefCountedThreadSafe<RaftGroupMetadata>,
 
   OpId TEST_LastAppliedChangeMetadataOperationOpId() const;
 
+  // OpId of the last operation of the tablet if it was cleanly shut down, see
+  // RaftGroupReplicaSuperBlockPB::clean_shutdown_op_id.
+  OpId clean_shutdown_op_id() const;
+
+  void set_clean_shutdown_op_id(const OpId& op_id);
+
   void SetLastAppliedChangeMetadataOperationOpId(const OpId& op_id);
 
   // Takes OpId of the change metadata operation applied as argument.
@@ -789,6 +817,9 @@ class RaftGroupMetadata : public RefCountedThreadSafe<RaftGroupMetadata>,
   // to prevent WAL GC of such operations.
   OpId min_unflushed_change_metadata_op_id_ GUARDED_BY(data_mutex_) = OpId::Max();
 
+  // OpId of the last operation applied and flushed before a clean shutdown of the tablet.
+  OpId clean_shutdown_op_id_ GUARDED_BY(data_mutex_) = OpId::Invalid();
+
   int disable_schema_gc_counter_ GUARDED_BY(data_mutex_) = 0;
 
   DISALLOW_COPY_AND_ASSIGN(RaftGroupMetadata);
@@ -55,11 +55,15 @@ struct TabletFullCompactionListener;
 // Common for all tablets within TabletManager.
 struct TabletOptions {
   std::shared_ptr<rocksdb::Cache> block_cache;
+  // Secondary cache of compressed data blocks, consulted on block_cache miss.
+  std::shared_ptr<rocksdb::Cache> compressed_block_cache;
   std::shared_ptr<rocksdb::MemoryMonitor> memory_monitor;
   std::vector<std::shared_ptr<rocksdb::EventListener>> listeners;
   yb::Env* env = Env::Default();
   rocksdb::Env* rocksdb_env = rocksdb::Env::Default();
   std::shared_ptr<rocksdb::RateLimiter> rate_limiter;
+  // Limits the rate of intents removal by all tablets, null if unlimited.
+  std::shared_ptr<rocksdb::RateLimiter> intents_cleanup_rate_limiter;
   std::shared_ptr<rocksdb::RocksDBPriorityThreadPoolMetrics> priority_thread_pool_metrics;
 };
 
@@ -89,6 +93,7 @@ struct TabletInitData {
   AutoFlagsManager* auto_flags_manager = nullptr;
   ThreadPool* full_compaction_pool;
   ThreadPool* admin_triggered_compaction_pool;
+  ThreadPool* parallel_scan_pool = nullptr;
   scoped_refptr<yb::AtomicGauge<uint64_t>> post_split_compaction_added;
   client::YBMetaDataCache* metadata_cache;
   std::function<SchemaVersion(const TableId&, const ColocationId&)>
@@ -517,6 +517,24 @@ TEST_F(TabletPeerTest, TestAddTableUpdatesLastChangeMetadataOpId) {
   ASSERT_EQ(tablet->metadata()->TEST_LastAppliedChangeMetadataOperationOpId(), op_id);
 }
 
+TEST_F(TabletPeerTest, Hibernation) {
+  ConsensusBootstrapInfo info;
+  ASSERT_OK(StartPeer(info));
+  ASSERT_OK(ExecuteInsertsAndRollLogs(1));
+
+  // The first call observes the new operations in the log, and treats them as activity.
+  ASSERT_FALSE(tablet_peer_->TryHibernate(CoarseMonoClock::now()));
+  ASSERT_FALSE(tablet_peer_->hibernated());
+  ASSERT_TRUE(tablet_peer_->TryHibernate(CoarseMonoClock::now()));
+  ASSERT_TRUE(tablet_peer_->hibernated());
+  // Already hibernated.
+  ASSERT_FALSE(tablet_peer_->TryHibernate(CoarseMonoClock::now()));
+
+  tablet_peer_->RecordAccess();
+  ASSERT_FALSE(tablet_peer_->hibernated());
+  ASSERT_FALSE(tablet_peer_->TryHibernate(CoarseMonoClock::now() - 1h));
+}
+
 class TabletPeerProtofBufSizeLimitTest : public TabletPeerTest {
  public:
   TabletPeerProtofBufSizeLimitTest() : TabletPeerTest(GetSimpleTestSchema()) {
@@ -114,6 +114,13 @@ DEFINE_UNKNOWN_int32(cdc_min_replicated_index_considered_stale_secs, 900,
 DEFINE_UNKNOWN_bool(propagate_safe_time, true,
     "Propagate safe time to read from leader to followers");
 
+DEFINE_RUNTIME_uint32(propagated_safe_time_lead_ms, 0,
+    "When positive, the leader propagates to followers a safe time this far ahead of its current "
+    "hybrid time, and assigns hybrid times after it to new operations. Followers then could serve "
+    "reads at fresher read times until the next heartbeat. Limited by the hybrid time leader "
+    "lease and by half of max_clock_skew_usec.");
+TAG_FLAG(propagated_safe_time_lead_ms, advanced);
+
 DEFINE_RUNTIME_bool(abort_active_txns_during_xrepl_bootstrap, true,
     "Abort active transactions during xcluster and cdc bootstrapping. Inconsistent replicated data "
     "may be produced if this is disabled.");
@@ -130,6 +137,8 @@ DECLARE_int64(cdc_intent_retention_ms);
 
 DECLARE_bool(enable_flush_retryable_requests);
 
+DECLARE_uint64(max_clock_skew_usec);
+
 namespace yb {
 namespace tablet {
 
@@ -396,6 +405,13 @@ Result<HybridTime> TabletPeer::PreparePeerRequest() {
   // Get the current majority-replicated HT leader lease without any waiting.
   auto ht_lease = VERIFY_RESULT(HybridTimeLease(
       /* min_allowed= */ HybridTime::kMin, /* deadline */ CoarseTimePoint::max()));
+  auto lead_us = std::min<uint64_t>(
+      GetAtomicFlag(&FLAGS_propagated_safe_time_lead_ms) * 1000,
+      GetAtomicFlag(&FLAGS_max_clock_skew_usec) / 2);
+  if (lead_us > 0 && !ht_lease.empty()) {
+    return tablet_->mvcc_manager()->PromiseSafeTime(
+        ht_lease.time.AddMicroseconds(lead_us), ht_lease);
+  }
   return tablet_->mvcc_manager()->SafeTime(ht_lease);
 }
 
@@ -504,7 +520,8 @@ bool TabletPeer::StartShutdown() {
 }
 
 void TabletPeer::CompleteShutdown(
-    const DisableFlushOnShutdown disable_flush_on_shutdown, const AbortOps abort_ops) {
+    const DisableFlushOnShutdown disable_flush_on_shutdown, const AbortOps abort_ops,
+    const PersistCleanShutdown persist_clean_shutdown) {
   auto* strand = strand_.get();
   if (strand) {
     strand->Shutdown();
@@ -528,6 +545,10 @@ void TabletPeer::CompleteShutdown(
 
   VLOG_WITH_PREFIX(1) << "Shut down!";
 
+  if (tablet_ && persist_clean_shutdown && !disable_flush_on_shutdown) {
+    WARN_NOT_OK(PersistCleanShutdownOpId(), LogPrefix() + "Clean shutdown op id not persisted");
+  }
+
   if (tablet_) {
     tablet_->CompleteShutdown(disable_flush_on_shutdown, abort_ops);
   }
@@ -1614,6 +1635,26 @@ bool TabletPeer::CanBeDeleted() {
   return true;
 }
 
+void TabletPeer::RecordAccess() {
+  last_access_time_.store(CoarseMonoClock::now(), std::memory_order_release);
+  if (hibernated_.load(std::memory_order_acquire) && hibernated_.exchange(false)) {
+    VLOG_WITH_PREFIX(1) << "Woke up from hibernation";
+  }
+}
+
+bool TabletPeer::TryHibernate(CoarseTimePoint idle_since) {
+  // Replicated writes do not go through RecordAccess on followers, so count them as activity here.
+  const auto op_index = GetLatestLogEntryOpId().index;
+  if (last_seen_op_index_.exchange(op_index) != op_index) {
+    RecordAccess();
+    return false;
+  }
+  if (last_access_time_.load(std::memory_order_acquire) > idle_since) {
+    return false;
+  }
+  return !hibernated_.exchange(true);
+}
+
 rpc::Scheduler& TabletPeer::scheduler() const {
   return messenger_->scheduler();
 }
@@ -1698,6 +1739,29 @@ Status TabletPeer::FlushRetryableRequests() {
   return retryable_requests_flusher->FlushRetryableRequests();
 }
 
+Status TabletPeer::PersistCleanShutdownOpId() {
+  auto consensus = GetRaftConsensusUnsafe();
+  SCHECK(consensus, IllegalState, "Consensus is not available");
+
+  // All operations are finished at this point, so the last received operation should also be the
+  // last applied one. Otherwise the WAL has uncommitted or not applied entries and should be
+  // replayed.
+  const auto last_received_op_id = consensus->GetLastReceivedOpId();
+  const auto last_applied_op_id = consensus->GetLastAppliedOpId();
+  SCHECK_EQ(last_received_op_id, last_applied_op_id, IllegalState,
+            "Not all received operations are applied");
+
+  if (FlushRetryableRequestsEnabled()) {
+    RETURN_NOT_OK_PREPEND(FlushRetryableRequests(), "Failed to flush retryable requests");
+  }
+  RETURN_NOT_OK(tablet_->FlushAndCheckNoUnflushedData());
+
+  meta_->set_clean_shutdown_op_id(last_applied_op_id);
+  RETURN_NOT_OK(meta_->Flush());
+  LOG_WITH_PREFIX(INFO) << "Persisted clean shutdown op id: " << last_applied_op_id;
+  return Status::OK();
+}
+
 Result<OpId> TabletPeer::CopyRetryableRequestsTo(const std::string& dest_path) {
   if (!FlushRetryableRequestsEnabled()) {
     return STATUS(NotSupported, "flush_retryable_requests is not supported");
@@ -181,7 +181,11 @@ class TabletPeer : public std::enable_shared_from_this<TabletPeer>,
   // Returns true if shutdown was just initiated, false if shutdown was already running.
   MUST_USE_RESULT bool StartShutdown();
   // Completes shutdown process and waits for it's completeness.
-  void CompleteShutdown(DisableFlushOnShutdown disable_flush_on_shutdown, AbortOps abort_ops);
+  // When persist_clean_shutdown is true and all operations were applied, flushes the tablet and
+  // records the last operation in the superblock, so the next bootstrap does not replay the WAL.
+  void CompleteShutdown(
+      DisableFlushOnShutdown disable_flush_on_shutdown, AbortOps abort_ops,
+      PersistCleanShutdown persist_clean_shutdown = PersistCleanShutdown::kFalse);
 
   // Abort active transactions on the tablet after shutdown is initiated.
   Status AbortSQLTransactions() const;
@@ -442,6 +446,17 @@ class TabletPeer : public std::enable_shared_from_this<TabletPeer>,
   // Might update the can_be_deleted_.
   bool CanBeDeleted();
 
+  // Records that the tablet was used to serve a request. Wakes up the tablet if it was hibernated.
+  void RecordAccess();
+
+  // Marks the tablet as hibernated if it was not accessed since idle_since and no new operations
+  // were written to its log since the previous call. Returns true if the tablet was just marked.
+  bool TryHibernate(CoarseTimePoint idle_since);
+
+  bool hibernated() const {
+    return hibernated_.load(std::memory_order_acquire);
+  }
+
   std::string LogPrefix() const;
 
   // Called from RemoteBootstrapSession and RemoteBootstrapAnchorSession to change role of the
@@ -567,6 +582,8 @@ class TabletPeer : public std::enable_shared_from_this<TabletPeer>,
 
   bool FlushRetryableRequestsEnabled() const;
 
+  Status PersistCleanShutdownOpId();
+
   MetricRegistry* metric_registry_;
 
   bool IsLeader() override {
@@ -586,6 +603,11 @@ class TabletPeer : public std::enable_shared_from_this<TabletPeer>,
   std::atomic<bool> flush_retryable_requests_enabled_{false};
   std::shared_ptr<RetryableRequestsFlusher> retryable_requests_flusher_;
 
+  // Used to detect idle tablets, see TryHibernate.
+  std::atomic<CoarseTimePoint> last_access_time_{CoarseMonoClock::now()};
+  std::atomic<int64_t> last_seen_op_index_{0};
+  std::atomic<bool> hibernated_{false};
+
   DISALLOW_COPY_AND_ASSIGN(TabletPeer);
 };
 
@@ -48,7 +48,8 @@ DEFINE_UNKNOWN_int32(timestamp_history_retention_interval_sec, 900,
              "The time interval in seconds to retain DocDB history for. Point-in-time reads at a "
              "hybrid time further than this in the past might not be allowed after a compaction. "
              "Set this to be higher than the expected maximum duration of any single transaction "
-             "in your application.");
+             "in your application. Could be overridden by the history_retention_interval_sec "
+             "table property.");
 
 DEFINE_UNKNOWN_int32(timestamp_syscatalog_history_retention_interval_sec, 4 * 3600,
     "The time interval in seconds to retain syscatalog history for CDC to read specific schema "
@@ -73,9 +74,28 @@ using docdb::HistoryRetentionDirective;
 
 namespace {
 
-HybridTime ClockBasedHistoryCutoff(server::Clock* clock) {
-  return clock->Now().AddSeconds(
-      -ANNOTATE_UNPROTECTED_READ(FLAGS_timestamp_history_retention_interval_sec));
+int32_t HistoryRetentionIntervalSec(const Schema& schema) {
+  const auto& table_properties = schema.table_properties();
+  return table_properties.HasHistoryRetentionInterval()
+      ? table_properties.history_retention_interval_sec()
+      : ANNOTATE_UNPROTECTED_READ(FLAGS_timestamp_history_retention_interval_sec);
+}
+
+HybridTime ClockBasedHistoryCutoff(server::Clock* clock, const Schema& schema) {
+  return clock->Now().AddSeconds(-HistoryRetentionIntervalSec(schema));
+}
+
+// The table could retain less history than the propagation interval, so propagate at least
+// as often as its retention interval.
+MonoDelta HistoryCutoffPropagationInterval(const Schema& schema) {
+  auto result = MonoDelta::FromMilliseconds(
+      ANNOTATE_UNPROTECTED_READ(FLAGS_history_cutoff_propagation_interval_ms));
+  if (schema.table_properties().HasHistoryRetentionInterval()) {
+    result = std::min(
+        result,
+        MonoDelta::FromSeconds(schema.table_properties().history_retention_interval_sec()));
+  }
+  return result;
 }
 
 }
@@ -145,7 +165,7 @@ HybridTime TabletRetentionPolicy::ProposedHistoryCutoff() {
   // there will be some imprecision which should be followed up in a diff.
   return FLAGS_enable_history_cutoff_propagation
       ? committed_history_cutoff_information_.primary_cutoff_ht :
-        ClockBasedHistoryCutoff(clock_.get());
+        ClockBasedHistoryCutoff(clock_.get(), *metadata_.schema());
 }
 
 Status TabletRetentionPolicy::RegisterReaderTimestamp(HybridTime timestamp) {
@@ -200,13 +220,13 @@ HistoryCutoff TabletRetentionPolicy::HistoryCutoffToPropagate(
   }
 
   next_history_cutoff_propagation_ =
-      now + ANNOTATE_UNPROTECTED_READ(FLAGS_history_cutoff_propagation_interval_ms) * 1ms;
+      now + HistoryCutoffPropagationInterval(*metadata_.schema());
 
   return EffectiveHistoryCutoff();
 }
 
 docdb::HistoryCutoff TabletRetentionPolicy::EffectiveHistoryCutoff() {
-  auto clock_based_cutoff = ClockBasedHistoryCutoff(clock_.get());
+  auto clock_based_cutoff = ClockBasedHistoryCutoff(clock_.get(), *metadata_.schema());
   return SanitizeHistoryCutoff({ clock_based_cutoff, clock_based_cutoff });
 }
 
@@ -30,6 +30,7 @@
 
 #include "yb/tablet/operations/snapshot_operation.h"
 #include "yb/tablet/restore_util.h"
+#include "yb/tablet/snapshot_manifest.h"
 #include "yb/tablet/tablet.h"
 #include "yb/tablet/tablet_metadata.h"
 
@@ -55,12 +56,18 @@ DEFINE_test_flag(int32, delay_tablet_export_metadata_ms, 0,
                  "How much time in milliseconds to delay before exporting tablet metadata during "
                  "snapshot creation.");
 
+DEFINE_RUNTIME_bool(tablet_snapshot_create_manifest, true,
+    "Whether snapshot manifest with checksums of snapshot files is created for tablet snapshots, "
+    "so they could be exported incrementally. Only files that are not hard linked from other "
+    "snapshots of the tablet are read to compute checksums.");
+
 namespace yb {
 namespace tablet {
 
 namespace {
 
 const std::string kTempSnapshotDirSuffix = ".tmp";
+const std::string kRestoredCheckpointDir = "restored_checkpoint" + kTempSnapshotDirSuffix;
 const std::string kTabletMetadataFile = "tablet.metadata";
 
 std::string TabletMetadataFile(const std::string& dir) {
@@ -196,6 +203,13 @@ Status TabletSnapshots::Create(const CreateSnapshotData& data) {
 
   RETURN_NOT_OK(tablet().metadata()->SaveTo(TabletMetadataFile(tmp_snapshot_dir)));
 
+  if (FLAGS_tablet_snapshot_create_manifest) {
+    auto manifest = VERIFY_RESULT_PREPEND(
+        CreateSnapshotManifest(env, tmp_snapshot_dir, top_snapshots_dir),
+        "Cannot create snapshot manifest");
+    RETURN_NOT_OK(WriteSnapshotManifest(env, tmp_snapshot_dir, manifest));
+  }
+
   RETURN_NOT_OK_PREPEND(
       env->RenameFile(tmp_snapshot_dir, snapshot_dir),
       Format("Cannot rename temp snapshot dir $0 to $1", tmp_snapshot_dir, snapshot_dir));
@@ -353,6 +367,18 @@ Status TabletSnapshots::RestoreCheckpoint(
     const docdb::ConsensusFrontier& frontier, bool is_pitr_restore, const OpId& op_id) {
   LongOperationTracker long_operation_tracker("Restore checkpoint", 5s);
 
+  // Files of the checkpoint are linked and patched before the RocksDBs are shut down, so the
+  // tablet is unavailable only while the prepared directory is swapped with the current one.
+  std::string restored_dir;
+  if (!dir.empty()) {
+    restored_dir = VERIFY_RESULT(PrepareRestoredCheckpoint(dir, restore_at, frontier));
+  }
+  auto se = ScopeExit([this, &restored_dir] {
+    if (!restored_dir.empty()) {
+      WARN_NOT_OK(CleanupSnapshotDir(restored_dir), "Cleanup restored checkpoint failed");
+    }
+  });
+
   // The following two lines can't just be changed to RETURN_NOT_OK(PauseReadWriteOperations()):
   // op_pause has to stay in scope until the end of the function.
   auto op_pauses = StartShutdownRocksDBs(DisableFlushOnShutdown(!dir.empty()), AbortOps::kTrue);
@@ -370,29 +396,22 @@ Status TabletSnapshots::RestoreCheckpoint(
     // Destroy DB object.
     // TODO: snapshot current DB and try to restore it in case of failure.
     RETURN_NOT_OK(DeleteRocksDBs(CompleteShutdownRocksDBs(op_pauses)));
-
-    auto s = CopyDirectory(
-        &rocksdb_env(), dir, db_dir, UseHardLinks::kTrue, CreateIfMissing::kTrue);
-    if (PREDICT_FALSE(!s.ok())) {
-      LOG_WITH_PREFIX(WARNING) << "Copy checkpoint files status: " << s;
-      return STATUS(IllegalState, "Unable to copy checkpoint files", s.ToString());
+    // DestroyDB keeps the directory if it contains unknown files.
+    if (env().FileExists(db_dir)) {
+      RETURN_NOT_OK_PREPEND(
+          env().DeleteRecursively(db_dir), Format("Cannot delete regular DB dir $0", db_dir));
     }
-    auto tablet_metadata_file = TabletMetadataFile(db_dir);
-    if (env().FileExists(tablet_metadata_file)) {
-      RETURN_NOT_OK(env().DeleteFile(tablet_metadata_file));
-    }
-  }
 
-  {
-    rocksdb::Options rocksdb_options;
-    tablet().InitRocksDBOptions(&rocksdb_options, LogPrefix());
-    docdb::RocksDBPatcher patcher(db_dir, rocksdb_options);
+    RETURN_NOT_OK_PREPEND(
+        env().RenameFile(restored_dir, db_dir),
+        Format("Cannot rename restored checkpoint $0 to $1", restored_dir, db_dir));
+    restored_dir.clear();
+    RETURN_NOT_OK_PREPEND(
+        env().SyncDir(DirName(db_dir)), Format("Cannot sync parent dir of $0", db_dir));
+  }
 
-    RETURN_NOT_OK(patcher.Load());
-    RETURN_NOT_OK(patcher.ModifyFlushedFrontier(frontier));
-    if (restore_at) {
-      RETURN_NOT_OK(patcher.SetHybridTimeFilter(std::nullopt, restore_at));
-    }
+  if (dir.empty()) {
+    RETURN_NOT_OK(PatchRestoredDb(db_dir, restore_at, frontier));
   }
 
   bool need_flush = false;
@@ -467,6 +486,51 @@ Status TabletSnapshots::RestoreCheckpoint(
   return Status::OK();
 }
 
+Result<std::string> TabletSnapshots::PrepareRestoredCheckpoint(
+    const std::string& dir, HybridTime restore_at, const docdb::ConsensusFrontier& frontier) {
+  auto result = JoinPathSegments(
+      VERIFY_RESULT(metadata().TopSnapshotsDir()), kRestoredCheckpointDir);
+  RETURN_NOT_OK(CleanupSnapshotDir(result));
+
+  bool prepared = false;
+  auto se = ScopeExit([this, &prepared, &result] {
+    if (!prepared) {
+      WARN_NOT_OK(CleanupSnapshotDir(result), "Cleanup restored checkpoint failed");
+    }
+  });
+
+  auto s = CopyDirectory(
+      &rocksdb_env(), dir, result, UseHardLinks::kTrue, CreateIfMissing::kTrue);
+  if (PREDICT_FALSE(!s.ok())) {
+    LOG_WITH_PREFIX(WARNING) << "Copy checkpoint files status: " << s;
+    return STATUS(IllegalState, "Unable to copy checkpoint files", s.ToString());
+  }
+  for (const auto& file : {TabletMetadataFile(result),
+                           JoinPathSegments(result, kSnapshotManifestFile)}) {
+    if (env().FileExists(file)) {
+      RETURN_NOT_OK(env().DeleteFile(file));
+    }
+  }
+  RETURN_NOT_OK(PatchRestoredDb(result, restore_at, frontier));
+
+  prepared = true;
+  return result;
+}
+
+Status TabletSnapshots::PatchRestoredDb(
+    const std::string& db_dir, HybridTime restore_at, const docdb::ConsensusFrontier& frontier) {
+  rocksdb::Options rocksdb_options;
+  tablet().InitRocksDBOptions(&rocksdb_options, LogPrefix());
+  docdb::RocksDBPatcher patcher(db_dir, rocksdb_options);
+
+  RETURN_NOT_OK(patcher.Load());
+  RETURN_NOT_OK(patcher.ModifyFlushedFrontier(frontier));
+  if (restore_at) {
+    RETURN_NOT_OK(patcher.SetHybridTimeFilter(std::nullopt, restore_at));
+  }
+  return Status::OK();
+}
+
 Result<std::string> TabletSnapshots::RestoreToTemporary(
     const TxnSnapshotId& snapshot_id, HybridTime restore_at) {
   auto source_dir = JoinPathSegments(
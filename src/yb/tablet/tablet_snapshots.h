@@ -104,6 +104,15 @@ class TabletSnapshots : public TabletComponent {
       const std::string& dir, HybridTime restore_at, const RestoreMetadata& metadata,
       const docdb::ConsensusFrontier& frontier, bool is_pitr_restore, const OpId& op_id);
 
+  // Prepares RocksDB directory restored from the checkpoint in dir, while the tablet is still
+  // running. Returns the prepared directory, that replaces the regular DB by rename.
+  Result<std::string> PrepareRestoredCheckpoint(
+      const std::string& dir, HybridTime restore_at, const docdb::ConsensusFrontier& frontier);
+
+  // Sets flushed frontier and restore hybrid time filter of the closed RocksDB in db_dir.
+  Status PatchRestoredDb(
+      const std::string& db_dir, HybridTime restore_at, const docdb::ConsensusFrontier& frontier);
+
   // Applies specified snapshot operation.
   Status Apply(SnapshotOperation* operation);
 
@@ -25,6 +25,7 @@
 #include <boost/multi_index_container.hpp>
 
 #include "yb/client/client.h"
+#include "yb/client/meta_cache.h"
 #include "yb/client/transaction_rpc.h"
 
 #include "yb/common/common.pb.h"
@@ -46,6 +47,7 @@
 #include "yb/rpc/messenger.h"
 #include "yb/rpc/poller.h"
 #include "yb/rpc/rpc.h"
+#include "yb/rpc/scheduler.h"
 
 #include "yb/server/clock.h"
 
@@ -113,6 +115,20 @@ DEFINE_test_flag(bool, fail_abort_request_with_try_again, false,
                  "When enabled, the txn coordinator responds to all abort transaction requests "
                  "with TryAgain error status, for the set of transactions it hosts.");
 
+DEFINE_RUNTIME_uint64(transaction_status_group_commit_window_usec, 0,
+    "Time window during which transaction status updates are accumulated by the transaction "
+    "coordinator, so updates of multiple transactions are submitted for replication together "
+    "and share a Raft round. 0 submits every update immediately.");
+
+DEFINE_RUNTIME_uint64(transaction_status_group_commit_max_size, 64,
+    "Max number of transaction status updates accumulated by the transaction coordinator. "
+    "Group is submitted for replication as soon as it reaches this size. "
+    "Should not exceed max_group_replicate_batch_size to keep group in one Raft round.");
+
+DEFINE_RUNTIME_AUTO_bool(batch_apply_transaction_requests, kExternal, false, true,
+    "Combine apply requests for participant tablets led by the same tablet server into a single "
+    "ApplyTransactions RPC.");
+
 DECLARE_bool(enable_wait_queues);
 DECLARE_bool(disable_deadlock_detection);
 DECLARE_int32(rpc_workers_limit);
@@ -1087,6 +1103,12 @@ class TransactionCoordinator::Impl : public TransactionStateContext,
     deadlock_detection_poller_.Shutdown();
     deadlock_detector_.Shutdown();
     poller_.Shutdown();
+    {
+      std::lock_guard lock(group_commit_mutex_);
+      group_commit_shutdown_ = true;
+    }
+    group_commit_task_.Shutdown();
+    SubmitGroupCommit();
     rpcs_.Shutdown();
   }
 
@@ -1449,6 +1471,7 @@ class TransactionCoordinator::Impl : public TransactionStateContext,
   }
 
   void Start() {
+    group_commit_task_.Bind(&context_.client_future().get()->messenger()->scheduler());
     deadlock_detection_poller_.Start(
         &context_.client_future().get()->messenger()->scheduler(),
         1us * FLAGS_transaction_deadlock_detection_interval_usec * kTimeMultiplier);
@@ -1458,46 +1481,70 @@ class TransactionCoordinator::Impl : public TransactionStateContext,
   }
 
   void Handle(std::unique_ptr<tablet::UpdateTxnOperation> request, int64_t term) {
-    auto& state = *request->request();
-    auto id = FullyDecodeTransactionId(state.transaction_id());
-    if (!id.ok()) {
-      LOG(WARNING) << "Failed to decode id from " << state.ShortDebugString() << ": " << id;
-      request->CompleteWithStatus(id.status());
-      return;
-    }
+    std::vector<std::unique_ptr<tablet::UpdateTxnOperation>> requests;
+    requests.push_back(std::move(request));
+    Handle(std::move(requests), term);
+  }
+
+  void Handle(std::vector<std::unique_ptr<tablet::UpdateTxnOperation>> requests, int64_t term) {
+    struct FailedRequest {
+      std::unique_ptr<tablet::UpdateTxnOperation> request;
+      TransactionId id;
+      Status status;
+    };
+    std::vector<FailedRequest> failed_requests;
 
     PostponedLeaderActions actions;
     {
       std::unique_lock<std::mutex> lock(managed_mutex_);
       postponed_leader_actions_.leader_term = term;
-      auto it = managed_transactions_.find(*id);
-      if (it == managed_transactions_.end()) {
-        auto status = HandleTransactionNotFound(*id, state);
-        if (status.ok()) {
+      for (auto& request : requests) {
+        auto& state = *request->request();
+        auto id = FullyDecodeTransactionId(state.transaction_id());
+        if (!id.ok()) {
+          LOG(WARNING) << "Failed to decode id from " << state.ShortDebugString() << ": " << id;
+          failed_requests.push_back(FailedRequest {
+            .request = std::move(request),
+            .id = TransactionId::Nil(),
+            .status = id.status(),
+          });
+          continue;
+        }
+        auto it = managed_transactions_.find(*id);
+        if (it == managed_transactions_.end()) {
+          auto status = HandleTransactionNotFound(*id, state);
+          if (!status.ok()) {
+            failed_requests.push_back(FailedRequest {
+              .request = std::move(request),
+              .id = *id,
+              .status = status.CloneAndAddErrorCode(
+                  TransactionError(TransactionErrorCode::kAborted)),
+            });
+            continue;
+          }
           it = managed_transactions_.emplace(
               this, *id, state.start_time(), context_.clock().Now(), log_prefix_).first;
-        } else {
-          lock.unlock();
-          status = status.CloneAndAddErrorCode(TransactionError(TransactionErrorCode::kAborted));
-          // If the transaction was involved in a deadlock, the deadlock error takes precedence
-          // over a generic status of type Expired.
-          if (status.IsExpired()) {
-            auto s = deadlock_detector_.GetTransactionDeadlockStatus(*id);
-            if (!s.ok()) {
-              status = std::move(s);
-            }
-          }
-          request->CompleteWithStatus(status);
-          return;
         }
-      }
 
-      managed_transactions_.modify(it, [&request](TransactionState& state) {
-        state.Handle(std::move(request));
-      });
+        managed_transactions_.modify(it, [&request](TransactionState& state) {
+          state.Handle(std::move(request));
+        });
+      }
       postponed_leader_actions_.Swap(&actions);
     }
 
+    for (auto& failed : failed_requests) {
+      // If the transaction was involved in a deadlock, the deadlock error takes precedence
+      // over a generic status of type Expired.
+      if (failed.status.IsExpired()) {
+        auto s = deadlock_detector_.GetTransactionDeadlockStatus(failed.id);
+        if (!s.ok()) {
+          failed.status = std::move(s);
+        }
+      }
+      failed.request->CompleteWithStatus(failed.status);
+    }
+
     ExecutePostponedLeaderActions(&actions);
   }
 
@@ -1591,6 +1638,98 @@ class TransactionCoordinator::Impl : public TransactionStateContext,
       >
   > ManagedTransactions;
 
+  void FillApplyingRequest(
+      const NotifyApplyingData& action, HybridTime now, tserver::UpdateTransactionRequestPB* req) {
+    req->set_tablet_id(action.tablet);
+    req->set_propagated_hybrid_time(now.ToUint64());
+    auto& state = *req->mutable_state();
+    state.set_transaction_id(action.transaction.data(), action.transaction.size());
+    state.set_status(TransactionStatus::APPLYING);
+    state.add_tablets(context_.tablet_id());
+    state.set_commit_hybrid_time(action.commit_time.ToUint64());
+    state.set_sealed(action.sealed);
+    *state.mutable_aborted() = action.aborted;
+  }
+
+  // Sends apply requests to participants. Requests for tablets whose leaders are known from the
+  // meta cache are combined into a single ApplyTransactions RPC per tablet server, other requests
+  // are sent to their tablets one by one.
+  void SendApplyingRequests(const std::vector<NotifyApplyingData>& actions, HybridTime now) {
+    const auto deadline = TransactionRpcDeadline();
+    if (actions.size() == 1 || !FLAGS_batch_apply_transaction_requests) {
+      for (const auto& action : actions) {
+        SendUpdateTransactionRequest(action, now, deadline);
+      }
+      return;
+    }
+    if (PREDICT_FALSE(FLAGS_TEST_disable_apply_committed_transactions)) {
+      return;
+    }
+
+    auto* yb_client = context_.client_future().get();
+    std::unordered_map<client::internal::RemoteTabletServer*, std::vector<NotifyApplyingData>>
+        actions_by_tserver;
+    for (const auto& action : actions) {
+      auto tablet = yb_client->LookupCachedTabletById(action.tablet);
+      auto* leader = tablet ? tablet->LeaderTServer() : nullptr;
+      if (leader) {
+        actions_by_tserver[leader].push_back(action);
+      } else {
+        SendUpdateTransactionRequest(action, now, deadline);
+      }
+    }
+    for (auto& [tserver, tserver_actions] : actions_by_tserver) {
+      if (tserver_actions.size() == 1) {
+        SendUpdateTransactionRequest(tserver_actions.front(), now, deadline);
+      } else {
+        SendApplyTransactionsRequest(tserver, std::move(tserver_actions), now, deadline);
+      }
+    }
+  }
+
+  void SendApplyTransactionsRequest(
+      client::internal::RemoteTabletServer* tserver, std::vector<NotifyApplyingData> actions,
+      HybridTime now, CoarseTimePoint deadline) {
+    VLOG_WITH_PREFIX(3) << "Notify applying " << actions.size() << " tablets at "
+                        << tserver->permanent_uuid();
+
+    tserver::ApplyTransactionsRequestPB req;
+    req.set_propagated_hybrid_time(now.ToUint64());
+    for (const auto& action : actions) {
+      FillApplyingRequest(action, now, req.add_requests());
+    }
+
+    auto handle = rpcs_.Prepare();
+    if (handle == rpcs_.InvalidHandle()) {
+      return;
+    }
+    *handle = client::ApplyTransactions(
+        deadline, tserver, context_.client_future().get(), &req,
+        [this, handle, actions = std::move(actions)](
+            const Status& status, const tserver::ApplyTransactionsResponsePB& resp) {
+          client::UpdateClock(resp, &context_);
+          rpcs_.Unregister(handle);
+          // Requests that were not applied are resent to their tablets one by one, so leader
+          // changes, splits and deleted tablets are handled by the regular per tablet logic.
+          for (size_t i = 0; i != actions.size(); ++i) {
+            auto request_status = status;
+            if (request_status.ok()) {
+              request_status = narrow_cast<int>(i) < resp.statuses_size()
+                  ? StatusFromPB(resp.statuses(narrow_cast<int>(i)))
+                  : STATUS(IllegalState, "Missing apply status");
+            }
+            if (request_status.ok()) {
+              continue;
+            }
+            VLOG_WITH_PREFIX(2) << "Batched apply failed for " << actions[i].ToString() << ": "
+                                << request_status;
+            SendUpdateTransactionRequest(
+                actions[i], context_.clock().Now(), TransactionRpcDeadline());
+          }
+        });
+    (**handle).SendRpc();
+  }
+
   void SendUpdateTransactionRequest(
       const NotifyApplyingData& action, HybridTime now,
       const CoarseTimePoint& deadline) {
@@ -1600,15 +1739,7 @@ class TransactionCoordinator::Impl : public TransactionStateContext,
     VLOG_WITH_PREFIX(3) << "Notify applying: " << action.ToString();
 
     tserver::UpdateTransactionRequestPB req;
-    req.set_tablet_id(action.tablet);
-    req.set_propagated_hybrid_time(now.ToUint64());
-    auto& state = *req.mutable_state();
-    state.set_transaction_id(action.transaction.data(), action.transaction.size());
-    state.set_status(TransactionStatus::APPLYING);
-    state.add_tablets(context_.tablet_id());
-    state.set_commit_hybrid_time(action.commit_time.ToUint64());
-    state.set_sealed(action.sealed);
-    *state.mutable_aborted() = action.aborted;
+    FillApplyingRequest(action, now, &req);
 
     auto handle = rpcs_.Prepare();
     if (handle != rpcs_.InvalidHandle()) {
@@ -1678,22 +1809,84 @@ class TransactionCoordinator::Impl : public TransactionStateContext,
     }
 
     if (!actions->notify_applying.empty()) {
-      auto now = context_.clock().Now();
-      for (const auto& action : actions->notify_applying) {
-        auto deadline = TransactionRpcDeadline();
-        SendUpdateTransactionRequest(action, now, deadline);
+      SendApplyingRequests(actions->notify_applying, context_.clock().Now());
+    }
+
+    SubmitUpdates(actions->leader_term, &actions->updates);
+  }
+
+  void SubmitUpdates(
+      int64_t term, std::vector<std::unique_ptr<UpdateTxnOperation>>* updates) {
+    if (updates->empty()) {
+      return;
+    }
+    if (FLAGS_transaction_status_group_commit_window_usec == 0) {
+      SubmitUpdatesNow(term, updates);
+      return;
+    }
+
+    // Group of the previous term is submitted before updates of the new term, its operations
+    // will be aborted by consensus.
+    std::vector<std::unique_ptr<UpdateTxnOperation>> previous_term_updates;
+    int64_t previous_term = OpId::kUnknownTerm;
+    std::vector<std::unique_ptr<UpdateTxnOperation>> full_group;
+    bool schedule = false;
+    {
+      std::lock_guard lock(group_commit_mutex_);
+      if (group_commit_shutdown_) {
+        full_group.swap(*updates);
+      } else {
+        if (group_commit_term_ != term) {
+          previous_term_updates.swap(group_commit_updates_);
+          previous_term = group_commit_term_;
+          group_commit_term_ = term;
+        }
+        schedule = group_commit_updates_.empty();
+        group_commit_updates_.insert(
+            group_commit_updates_.end(), std::make_move_iterator(updates->begin()),
+            std::make_move_iterator(updates->end()));
+        if (group_commit_updates_.size() >= FLAGS_transaction_status_group_commit_max_size) {
+          full_group.swap(group_commit_updates_);
+          schedule = false;
+        }
       }
     }
+    updates->clear();
+
+    SubmitUpdatesNow(previous_term, &previous_term_updates);
+    SubmitUpdatesNow(term, &full_group);
+    if (schedule) {
+      // Scheduled outside of the lock, since scheduling aborts the previously scheduled task.
+      // Aborted task submits the current group earlier, that is harmless.
+      group_commit_task_.Schedule(
+          [this](const Status&) { SubmitGroupCommit(); },
+          FLAGS_transaction_status_group_commit_window_usec * 1us);
+    }
+  }
+
+  // Submits updates accumulated for group commit.
+  void SubmitGroupCommit() {
+    std::vector<std::unique_ptr<UpdateTxnOperation>> updates;
+    int64_t term;
+    {
+      std::lock_guard lock(group_commit_mutex_);
+      updates.swap(group_commit_updates_);
+      term = group_commit_term_;
+    }
+    SubmitUpdatesNow(term, &updates);
+  }
 
-    for (auto& update : actions->updates) {
-      auto submit_status =
-          context_.SubmitUpdateTransaction(std::move(update), actions->leader_term);
+  void SubmitUpdatesNow(
+      int64_t term, std::vector<std::unique_ptr<UpdateTxnOperation>>* updates) {
+    for (auto& update : *updates) {
+      auto submit_status = context_.SubmitUpdateTransaction(std::move(update), term);
       if (!submit_status.ok()) {
         LOG_WITH_PREFIX(DFATAL)
             << "Could not submit transaction status update operation: "
             << update->ToString() << ", status: " << submit_status;
       }
     }
+    updates->clear();
   }
 
   ManagedTransactions::iterator GetTransaction(const TransactionId& id,
@@ -1887,6 +2080,14 @@ class TransactionCoordinator::Impl : public TransactionStateContext,
 
   rpc::Poller poller_;
   rpc::Rpcs rpcs_;
+
+  // Status updates accumulated to be submitted for replication together.
+  std::mutex group_commit_mutex_;
+  int64_t group_commit_term_ GUARDED_BY(group_commit_mutex_) = OpId::kUnknownTerm;
+  std::vector<std::unique_ptr<UpdateTxnOperation>> group_commit_updates_
+      GUARDED_BY(group_commit_mutex_);
+  bool group_commit_shutdown_ GUARDED_BY(group_commit_mutex_) = false;
+  rpc::ScheduledTaskTracker group_commit_task_;
 };
 
 TransactionCoordinator::TransactionCoordinator(const std::string& permanent_uuid,
@@ -1920,6 +2121,11 @@ void TransactionCoordinator::Handle(
   impl_->Handle(std::move(request), term);
 }
 
+void TransactionCoordinator::Handle(
+    std::vector<std::unique_ptr<tablet::UpdateTxnOperation>> requests, int64_t term) {
+  impl_->Handle(std::move(requests), term);
+}
+
 void TransactionCoordinator::Start() {
   impl_->Start();
 }
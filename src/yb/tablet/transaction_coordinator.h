@@ -17,6 +17,7 @@
 
 #include <future>
 #include <memory>
+#include <vector>
 
 #include "yb/client/client_fwd.h"
 
@@ -118,6 +119,9 @@ class TransactionCoordinator {
   // Handles new request for transaction update.
   void Handle(std::unique_ptr<tablet::UpdateTxnOperation> request, int64_t term);
 
+  // Handles batch of transaction update requests, taking the transactions lock once.
+  void Handle(std::vector<std::unique_ptr<tablet::UpdateTxnOperation>> requests, int64_t term);
+
   // Prepares log garbage collection. Return min index that should be preserved.
   int64_t PrepareGC(std::string* details = nullptr);
 
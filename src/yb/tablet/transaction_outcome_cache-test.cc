@@ -0,0 +1,66 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <gtest/gtest.h>
+
+#include "yb/tablet/transaction_outcome_cache.h"
+
+#include "yb/util/test_macros.h"
+
+namespace yb::tablet {
+
+TEST(TransactionOutcomeCacheTest, Outcomes) {
+  TransactionOutcomeCache cache(1024);
+  auto committed_id = TransactionId::GenerateRandom();
+  auto aborted_id = TransactionId::GenerateRandom();
+  ASSERT_FALSE(cache.Get(committed_id));
+
+  SubtxnSet aborted_subtxns;
+  ASSERT_OK(aborted_subtxns.SetRange(2, 3));
+  cache.AddCommitted(committed_id, HybridTime(1000), aborted_subtxns);
+  cache.AddAborted(aborted_id);
+
+  auto committed = cache.Get(committed_id);
+  ASSERT_TRUE(committed);
+  ASSERT_EQ(committed->commit_ht, HybridTime(1000));
+  ASSERT_EQ(committed->aborted_subtxn_set, aborted_subtxns);
+
+  auto aborted = cache.Get(aborted_id);
+  ASSERT_TRUE(aborted);
+  ASSERT_EQ(aborted->commit_ht, HybridTime::kMin);
+  ASSERT_EQ(cache.TEST_size(), 2U);
+
+  cache.Clear();
+  ASSERT_FALSE(cache.Get(committed_id));
+  ASSERT_EQ(cache.TEST_size(), 0U);
+}
+
+TEST(TransactionOutcomeCacheTest, Eviction) {
+  constexpr size_t kCapacity = 64;
+  TransactionOutcomeCache cache(kCapacity);
+  std::vector<TransactionId> ids;
+  for (size_t i = 0; i != kCapacity * 8; ++i) {
+    ids.push_back(TransactionId::GenerateRandom());
+    cache.AddAborted(ids.back());
+    // Keep the first transaction recently used, so it is never evicted.
+    ASSERT_TRUE(cache.Get(ids.front()));
+  }
+  ASSERT_LE(cache.TEST_size(), kCapacity);
+  ASSERT_TRUE(cache.Get(ids.back()));
+
+  TransactionOutcomeCache disabled_cache(0);
+  disabled_cache.AddAborted(ids.front());
+  ASSERT_FALSE(disabled_cache.Get(ids.front()));
+}
+
+}  // namespace yb::tablet
@@ -0,0 +1,94 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/tablet/transaction_outcome_cache.h"
+
+namespace yb::tablet {
+
+TransactionOutcomeCache::TransactionOutcomeCache(size_t capacity)
+    : stripe_capacity_((capacity + kNumStripes - 1) / kNumStripes) {
+}
+
+std::optional<TransactionLocalState> TransactionOutcomeCache::Get(const TransactionId& id) {
+  if (stripe_capacity_ == 0) {
+    return std::nullopt;
+  }
+  auto& stripe = GetStripe(id);
+  std::lock_guard lock(stripe.mutex);
+  auto& index = stripe.entries.get<IdTag>();
+  auto it = index.find(id);
+  if (it == index.end()) {
+    return std::nullopt;
+  }
+  // Move the entry to the front, as the most recently used one.
+  stripe.entries.relocate(stripe.entries.begin(), stripe.entries.project<0>(it));
+  return it->state;
+}
+
+void TransactionOutcomeCache::AddCommitted(
+    const TransactionId& id, HybridTime commit_ht, const SubtxnSet& aborted_subtxn_set) {
+  DCHECK(commit_ht.is_valid() && commit_ht != HybridTime::kMin) << commit_ht;
+  Add(id, TransactionLocalState {
+    .commit_ht = commit_ht,
+    .aborted_subtxn_set = aborted_subtxn_set,
+  });
+}
+
+void TransactionOutcomeCache::AddAborted(const TransactionId& id) {
+  Add(id, TransactionLocalState {
+    .commit_ht = HybridTime::kMin,
+    .aborted_subtxn_set = {},
+  });
+}
+
+void TransactionOutcomeCache::Add(const TransactionId& id, TransactionLocalState&& state) {
+  if (stripe_capacity_ == 0) {
+    return;
+  }
+  auto& stripe = GetStripe(id);
+  std::lock_guard lock(stripe.mutex);
+  auto [it, inserted] = stripe.entries.push_front(Entry {
+    .id = id,
+    .state = std::move(state),
+  });
+  if (!inserted) {
+    // Outcome of the transaction is final, so the existing entry is just marked as recently used.
+    stripe.entries.relocate(stripe.entries.begin(), it);
+    return;
+  }
+  while (stripe.entries.size() > stripe_capacity_) {
+    stripe.entries.pop_back();
+  }
+}
+
+void TransactionOutcomeCache::Clear() {
+  for (auto& stripe : stripes_) {
+    std::lock_guard lock(stripe.mutex);
+    stripe.entries.clear();
+  }
+}
+
+size_t TransactionOutcomeCache::TEST_size() const {
+  size_t result = 0;
+  for (const auto& stripe : stripes_) {
+    std::lock_guard lock(stripe.mutex);
+    result += stripe.entries.size();
+  }
+  return result;
+}
+
+TransactionOutcomeCache::Stripe& TransactionOutcomeCache::GetStripe(const TransactionId& id) {
+  return stripes_[TransactionIdHash()(id) % kNumStripes];
+}
+
+}  // namespace yb::tablet
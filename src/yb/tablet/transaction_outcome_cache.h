@@ -0,0 +1,89 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <optional>
+
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include "yb/common/transaction.h"
+
+#include "yb/gutil/thread_annotations.h"
+
+namespace yb::tablet {
+
+// Bounded cache of final outcomes of transactions, i.e. commit hybrid time and aborted
+// subtransactions of committed transactions, or abort of aborted transactions, shared by all reads
+// of the tablet. Final outcome does not depend on read time, so the reader should only check that
+// the commit time is not after its read time, the same way as with local commit data.
+//
+// Entries are distributed over independently locked stripes by transaction id, and each stripe
+// evicts its least recently used entries.
+class TransactionOutcomeCache {
+ public:
+  // capacity is the max number of cached transactions, zero disables the cache.
+  explicit TransactionOutcomeCache(size_t capacity);
+
+  // Returns the outcome of the specified transaction if it is known. The commit_ht of an aborted
+  // transaction is HybridTime::kMin.
+  std::optional<TransactionLocalState> Get(const TransactionId& id);
+
+  void AddCommitted(
+      const TransactionId& id, HybridTime commit_ht, const SubtxnSet& aborted_subtxn_set);
+
+  void AddAborted(const TransactionId& id);
+
+  void Clear();
+
+  size_t TEST_size() const;
+
+ private:
+  struct Entry {
+    TransactionId id;
+    TransactionLocalState state;
+  };
+
+  struct IdTag;
+
+  using Entries = boost::multi_index_container<
+      Entry,
+      boost::multi_index::indexed_by<
+          boost::multi_index::sequenced<>,
+          boost::multi_index::hashed_unique<
+              boost::multi_index::tag<IdTag>,
+              boost::multi_index::member<Entry, TransactionId, &Entry::id>,
+              TransactionIdHash>
+      >
+  >;
+
+  struct Stripe {
+    mutable std::mutex mutex;
+    Entries entries GUARDED_BY(mutex);
+  };
+
+  static constexpr size_t kNumStripes = 16;
+
+  Stripe& GetStripe(const TransactionId& id);
+  void Add(const TransactionId& id, TransactionLocalState&& state);
+
+  const size_t stripe_capacity_;
+  std::array<Stripe, kNumStripes> stripes_;
+};
+
+}  // namespace yb::tablet
@@ -38,11 +38,14 @@
 
 #include "yb/tablet/cleanup_aborts_task.h"
 #include "yb/tablet/cleanup_intents_task.h"
+#include "yb/tablet/live_intent_ranges.h"
+#include "yb/tablet/live_intents_filter.h"
 #include "yb/tablet/operations/update_txn_operation.h"
 #include "yb/tablet/remove_intents_task.h"
 #include "yb/tablet/running_transaction.h"
 #include "yb/tablet/running_transaction_context.h"
 #include "yb/tablet/transaction_loader.h"
+#include "yb/tablet/transaction_outcome_cache.h"
 #include "yb/tablet/transaction_participant_context.h"
 #include "yb/tablet/transaction_status_resolver.h"
 
@@ -100,6 +103,16 @@ DEFINE_NON_RUNTIME_int32(wait_queue_poll_interval_ms, 100,
     "The interval duration between wait queue polls to fetch transaction statuses of "
     "active blockers.");
 
+DEFINE_NON_RUNTIME_uint64(live_intents_filter_num_counters, 32768,
+                          "Number of counters in the per tablet filter of doc paths that have "
+                          "intents of live transactions, used to skip conflict resolution lookups "
+                          "in intents DB.");
+
+DEFINE_NON_RUNTIME_uint64(transaction_outcome_cache_capacity, 16384,
+                          "Max number of transactions whose final status, received from the "
+                          "transaction coordinator by reads of the tablet, is cached and shared by "
+                          "subsequent reads. Zero disables the cache.");
+
 DECLARE_int64(transaction_abort_check_timeout_ms);
 
 DECLARE_int64(cdc_intent_retention_ms);
@@ -244,6 +257,9 @@ class TransactionParticipant::Impl
       MinRunningNotifier min_running_notifier(nullptr /* applier */);
       DumpClear(RemoveReason::kShutdown);
       transactions_.clear();
+      live_intent_ranges_.Clear();
+      live_intents_filter_.Clear();
+      outcome_cache_.Clear();
       TransactionsModifiedUnlocked(&min_running_notifier);
 
       mem_tracker_->UnregisterFromParent();
@@ -305,6 +321,8 @@ class TransactionParticipant::Impl
       if (pending_apply) {
         txn->SetLocalCommitData(pending_apply->commit_ht, pending_apply->state.aborted);
         txn->SetApplyData(pending_apply->state);
+        live_intent_ranges_.SetUnbounded(metadata.transaction_id);
+        live_intents_filter_.SetUnbounded(metadata.transaction_id);
       }
     }
 
@@ -962,6 +980,9 @@ class TransactionParticipant::Impl
     std::lock_guard lock(mutex_);
     DumpClear(RemoveReason::kSetDB);
     transactions_.clear();
+    live_intent_ranges_.Clear();
+    live_intents_filter_.Clear();
+    outcome_cache_.Clear();
     mem_tracker_->Release(mem_tracker_->consumption());
     TransactionsModifiedUnlocked(&min_running_notifier);
     return Status::OK();
@@ -992,6 +1013,49 @@ class TransactionParticipant::Impl
     return &participant_context_;
   }
 
+  void RegisterIntentsRange(const TransactionId& id, Slice start, Slice end) {
+    std::lock_guard lock(mutex_);
+    // Intents of removed transaction are applied or cleaned, so no need to track them.
+    if (transactions_.find(id) != transactions_.end()) {
+      live_intent_ranges_.Extend(id, start, end);
+    }
+  }
+
+  bool MayHaveIntentsInRange(Slice lower, Slice upper) const {
+    // Transactions are not fully known until load is completed.
+    return !loader_.complete() || live_intent_ranges_.MayOverlap(lower, upper);
+  }
+
+  void RegisterIntentKeys(const TransactionId& id, const std::vector<uint64_t>& key_hashes) {
+    std::lock_guard lock(mutex_);
+    if (transactions_.find(id) != transactions_.end()) {
+      live_intents_filter_.Add(id, key_hashes);
+    }
+  }
+
+  bool MayHaveConflictingIntents(Slice doc_path, bool strong) const {
+    return !loader_.complete() || live_intents_filter_.MayConflict(doc_path, strong);
+  }
+
+  boost::optional<TransactionLocalState> CachedTxnOutcome(const TransactionId& id) {
+    auto result = outcome_cache_.Get(id);
+    if (!result) {
+      return boost::none;
+    }
+    return std::move(*result);
+  }
+
+  void CacheTxnOutcome(const TransactionId& id, const TransactionLocalState& outcome) {
+    if (!outcome.commit_ht.is_valid()) {
+      return;
+    }
+    if (outcome.commit_ht == HybridTime::kMin) {
+      outcome_cache_.AddAborted(id);
+    } else {
+      outcome_cache_.AddCommitted(id, outcome.commit_ht, outcome.aborted_subtxn_set);
+    }
+  }
+
   HybridTime MinRunningHybridTime() {
     auto result = min_running_ht_.load(std::memory_order_acquire);
     if (result == HybridTime::kMax || result == HybridTime::kInvalid) {
@@ -1628,6 +1692,9 @@ class TransactionParticipant::Impl
       txn->SetLocalCommitData(pending_apply->commit_ht, pending_apply->state.aborted);
       txn->SetApplyData(pending_apply->state);
     }
+    // Keys of loaded transaction intents are unknown, so it could have intents anywhere.
+    live_intent_ranges_.SetUnbounded(txn->id());
+    live_intents_filter_.SetUnbounded(txn->id());
     transactions_.insert(txn);
     mem_tracker_->Consume(kRunningTransactionSize);
     TransactionsModifiedUnlocked(&min_running_notifier);
@@ -1662,6 +1729,8 @@ class TransactionParticipant::Impl
     recently_removed_transactions_cleanup_queue_.push_back({transaction.id(), now + 15s});
     LOG_IF_WITH_PREFIX(DFATAL, !recently_removed_transactions_.insert(transaction.id()).second)
         << "Transaction removed twice: " << transaction.id();
+    live_intent_ranges_.Remove(transaction.id());
+    live_intents_filter_.Remove(transaction.id());
     transactions_.erase(it);
     mem_tracker_->Release(kRunningTransactionSize);
     TransactionsModifiedUnlocked(min_running_notifier);
@@ -2008,6 +2077,9 @@ class TransactionParticipant::Impl
   CountDownLatch shutdown_latch_{1};
 
   std::atomic<HybridTime> min_running_ht_{HybridTime::kInvalid};
+  LiveIntentRanges live_intent_ranges_;
+  LiveIntentsFilter live_intents_filter_{FLAGS_live_intents_filter_num_counters};
+  TransactionOutcomeCache outcome_cache_{FLAGS_transaction_outcome_cache_capacity};
   std::atomic<CoarseTimePoint> next_check_min_running_{CoarseTimePoint()};
   HybridTime waiting_for_min_running_ht_ = HybridTime::kMax;
   std::atomic<bool> shutdown_done_{false};
@@ -2153,6 +2225,34 @@ HybridTime TransactionParticipant::MinRunningHybridTime() const {
   return impl_->MinRunningHybridTime();
 }
 
+void TransactionParticipant::RegisterIntentsRange(
+    const TransactionId& id, Slice start, Slice end) {
+  impl_->RegisterIntentsRange(id, start, end);
+}
+
+bool TransactionParticipant::MayHaveIntentsInRange(Slice lower, Slice upper) const {
+  return impl_->MayHaveIntentsInRange(lower, upper);
+}
+
+void TransactionParticipant::RegisterIntentKeys(
+    const TransactionId& id, const std::vector<uint64_t>& key_hashes) {
+  impl_->RegisterIntentKeys(id, key_hashes);
+}
+
+bool TransactionParticipant::MayHaveConflictingIntents(Slice doc_path, bool strong) const {
+  return impl_->MayHaveConflictingIntents(doc_path, strong);
+}
+
+boost::optional<TransactionLocalState> TransactionParticipant::CachedTxnOutcome(
+    const TransactionId& id) {
+  return impl_->CachedTxnOutcome(id);
+}
+
+void TransactionParticipant::CacheTxnOutcome(
+    const TransactionId& id, const TransactionLocalState& outcome) {
+  impl_->CacheTxnOutcome(id, outcome);
+}
+
 void TransactionParticipant::WaitMinRunningHybridTime(HybridTime ht) {
   impl_->WaitMinRunningHybridTime(ht);
 }
@@ -187,6 +187,21 @@ class TransactionParticipant : public TransactionStatusManager {
 
   HybridTime MinRunningHybridTime() const override;
 
+  // Should be invoked before writing intents of the transaction with keys in [start, end) range.
+  void RegisterIntentsRange(const TransactionId& id, Slice start, Slice end);
+
+  bool MayHaveIntentsInRange(Slice lower, Slice upper) const override;
+
+  // Should be invoked after writing intents of the transaction, before conflict resolution of
+  // other operations could observe them. Hashes are calculated with LiveIntentsFilter::KeyHash.
+  void RegisterIntentKeys(const TransactionId& id, const std::vector<uint64_t>& key_hashes);
+
+  bool MayHaveConflictingIntents(Slice doc_path, bool strong) const override;
+
+  boost::optional<TransactionLocalState> CachedTxnOutcome(const TransactionId& id) override;
+
+  void CacheTxnOutcome(const TransactionId& id, const TransactionLocalState& outcome) override;
+
   Result<HybridTime> WaitForSafeTime(HybridTime safe_time, CoarseTimePoint deadline) override;
 
   // When minimal start hybrid time of running transaction will be at least `ht` applier
@@ -29,9 +29,11 @@
 #include "yb/docdb/consensus_frontier.h"
 #include "yb/docdb/cql_operation.h"
 #include "yb/docdb/doc_write_batch.h"
+#include "yb/docdb/docdb_statistics.h"
 #include "yb/docdb/pgsql_operation.h"
 #include "yb/docdb/redis_operation.h"
 
+#include "yb/tablet/key_access_sampler.h"
 #include "yb/tablet/tablet_metadata.h"
 #include "yb/tablet/operations/write_operation.h"
 #include "yb/tablet/tablet.h"
@@ -43,6 +45,7 @@
 
 #include "yb/util/logging.h"
 #include "yb/util/metrics.h"
+#include "yb/util/scope_exit.h"
 #include "yb/util/sync_point.h"
 #include "yb/util/trace.h"
 #include "yb/util/flags.h"
@@ -53,6 +56,8 @@ using namespace std::literals;
 DEFINE_test_flag(bool, writequery_stuck_from_callback_leak, false,
     "Simulate WriteQuery stuck because of the update index flushed rpc call back leak");
 
+DECLARE_bool(ysql_analyze_dump_metrics);
+
 namespace yb {
 namespace tablet {
 
@@ -382,6 +387,7 @@ Result<bool> WriteQuery::CqlPrepareExecute() {
     RETURN_NOT_OK(write_op->Init(resp));
     doc_ops_.emplace_back(std::move(write_op));
   }
+  SampleAccessedKeys(tablet.get());
 
   return true;
 }
@@ -430,10 +436,28 @@ Result<bool> WriteQuery::PgsqlPrepareExecute() {
     RETURN_NOT_OK(write_op->Init(resp));
     doc_ops_.emplace_back(std::move(write_op));
   }
+  SampleAccessedKeys(tablet.get());
 
   return true;
 }
 
+void WriteQuery::SampleAccessedKeys(Tablet* tablet) {
+  auto& sampler = tablet->key_access_sampler();
+  boost::container::small_vector<RefCntPrefix, 4> paths;
+  for (const auto& doc_op : doc_ops_) {
+    if (!sampler.RecordAccess()) {
+      continue;
+    }
+    paths.clear();
+    IsolationLevel ignored_isolation_level;
+    auto status = doc_op->GetDocPaths(
+        docdb::GetDocPathsMode::kLock, &paths, &ignored_isolation_level);
+    if (status.ok() && !paths.empty()) {
+      sampler.AddSample(paths.front().as_slice());
+    }
+  }
+}
+
 void WriteQuery::Execute(std::unique_ptr<WriteQuery> query) {
   auto* query_ptr = query.get();
   query_ptr->self_ = std::move(query);
@@ -594,7 +618,8 @@ Status WriteQuery::DoExecute() {
         pair.dup_key(key);
         // Empty values are disallowed by docdb.
         // https://github.com/YugaByte/yugabyte-db/issues/736
-        pair.dup_value(std::string(1, dockv::KeyEntryTypeAsChar::kNullLow));
+        static const char kNullLowValue = dockv::KeyEntryTypeAsChar::kNullLow;
+        pair.ref_value(Slice(&kNullLowValue, 1));
       }
     }
   }
@@ -694,11 +719,35 @@ Status WriteQuery::DoCompleteExecute(HybridTime safe_time) {
   auto init_marker_behavior = tablet->table_type() == TableType::REDIS_TABLE_TYPE
       ? docdb::InitMarkerBehavior::kRequired
       : docdb::InitMarkerBehavior::kOptional;
+
+  // Reads done while assembling the write batch are reported to the YSQL client in the same way
+  // as reads of read requests, so EXPLAIN ANALYZE of a DML statement shows them.
+  PgsqlResponsePB* metrics_response = nullptr;
+  if (GetAtomicFlag(&FLAGS_ysql_analyze_dump_metrics)) {
+    for (const auto& op : pgsql_write_ops_) {
+      if (op->request().metrics_capture() == PgsqlMetricsCaptureType::PGSQL_METRICS_CAPTURE_ALL) {
+        metrics_response = op->response();
+        break;
+      }
+    }
+  }
+  std::optional<docdb::DocDBStatistics> statistics;
+  if (metrics_response) {
+    statistics.emplace();
+  }
+  auto merge_statistics = ScopeExit([&statistics, &tablet] {
+    if (statistics) {
+      statistics->MergeAndClear(
+          tablet->regulardb_statistics().get(), tablet->intentsdb_statistics().get());
+    }
+  });
+
   for (;;) {
     RETURN_NOT_OK(docdb::AssembleDocWriteBatch(
         doc_ops_, read_operation_data, tablet->doc_db(), &tablet->GetSchemaPackingProvider(),
         scoped_read_operation_, request().mutable_write_batch(), init_marker_behavior,
-        tablet->monotonic_counter(), &restart_read_ht_, tablet->metadata()->table_name()));
+        tablet->monotonic_counter(), &restart_read_ht_, tablet->metadata()->table_name(),
+        statistics ? &*statistics : nullptr));
 
     // For serializable isolation we don't fix read time, so could do read restart locally,
     // instead of failing whole transaction.
@@ -730,6 +779,10 @@ Status WriteQuery::DoCompleteExecute(HybridTime safe_time) {
     read_operation_data.read_time.ToPB(response_->mutable_used_read_time());
   }
 
+  if (statistics) {
+    statistics->CopyToPgsqlResponse(metrics_response);
+  }
+
   if (restart_read_ht_.is_valid()) {
     return Status::OK();
   }
@@ -27,13 +27,14 @@
 #include "yb/tserver/tserver.fwd.h"
 
 #include "yb/util/operation_counter.h"
+#include "yb/util/size_class_pool.h"
 
 namespace yb {
 namespace tablet {
 
 struct UpdateQLIndexesTask;
 
-class WriteQuery {
+class WriteQuery : public SizeClassPooled {
  public:
   WriteQuery(int64_t term,
              CoarseTimePoint deadline,
@@ -130,6 +131,9 @@ class WriteQuery {
 
   Status InitExecute(ExecuteMode mode);
 
+  // Passes sampled keys of doc_ops_ to the key access sampler of the tablet.
+  void SampleAccessedKeys(Tablet* tablet);
+
   void ExecuteDone(const Status& status);
 
   Result<bool> PrepareExecute();
@@ -79,6 +79,11 @@ DEFINE_RUNTIME_uint32(auto_compact_min_wait_between_seconds, 0,
               "Minimum wait time between automatic full compactions. Also applies to "
               "scheduled full compactions.");
 
+DEFINE_RUNTIME_bool(auto_compact_expired_files, true,
+              "Whether the full compaction task should check SST files of tablets with TTL file "
+              "expiration enabled, and schedule compactions removing fully expired files, "
+              "without waiting for size based compactions to pick them.");
+
 DEFINE_RUNTIME_int32(auto_compact_memory_cleanup_interval_sec, 3600,
               "The frequency with which we should check whether cleanup is needed in the "
               "full compaction manager. -1 indicates we should disable clean up.");
@@ -106,10 +111,37 @@ void FullCompactionManager::ScheduleFullCompactions() {
   const auto peers = ts_tablet_manager_->GetTabletPeers();
   SetFrequencyAndJitterFromFlags();
   CollectDocDBStats(peers);
+  ScheduleExpiredFilesDeletion(peers);
   DoScheduleFullCompactions(peers);
   CleanupIfNecessary(peers);
 }
 
+void FullCompactionManager::ScheduleExpiredFilesDeletion(
+    const std::vector<tablet::TabletPeerPtr>& peers) {
+  if (!ANNOTATE_UNPROTECTED_READ(FLAGS_auto_compact_expired_files)) {
+    return;
+  }
+  size_t num_expired_files = 0;
+  for (const auto& peer : peers) {
+    const auto tablet = peer->shared_tablet();
+    if (!tablet) {
+      continue;
+    }
+    auto result = tablet->ScheduleExpiredFilesDeletion();
+    if (!result.ok()) {
+      LOG(WARNING) << "Unable to schedule expired files deletion on tablet " << peer->tablet_id()
+          << ": " << result.status();
+      continue;
+    }
+    if (*result) {
+      VLOG(1) << "Scheduled deletion of " << *result << " expired files on tablet "
+              << peer->tablet_id();
+      num_expired_files += *result;
+    }
+  }
+  num_expired_files_last_execution_.store(num_expired_files);
+}
+
 Status FullCompactionManager::Init() {
   if (check_interval_sec_ > 0) {
     bg_task_.reset(
@@ -123,6 +123,12 @@ class FullCompactionManager {
   // DoScheduleFullCompactions().
   int num_scheduled_last_execution() const { return num_scheduled_last_execution_.load(); }
 
+  // Indicates the number of expired files which deletion was scheduled during the last execution
+  // of ScheduleExpiredFilesDeletion().
+  size_t num_expired_files_last_execution() const {
+    return num_expired_files_last_execution_.load();
+  }
+
   // Provides public access to DetermineNextCompactTime() for tests.
   // Clears all precomputed next compaction times.
   HybridTime TEST_DetermineNextCompactTime(tablet::TabletPeerPtr peer, HybridTime now) {
@@ -166,6 +172,10 @@ class FullCompactionManager {
   // (next_compact_time_per_tablet_).
   void DoScheduleFullCompactions(const std::vector<tablet::TabletPeerPtr>& peers);
 
+  // Iterates through all tablet peers, scheduling background compactions that remove SST files
+  // already expired according to TTL metadata stored in their frontiers.
+  void ScheduleExpiredFilesDeletion(const std::vector<tablet::TabletPeerPtr>& peers);
+
   // Collects docdb key access statistics from all tablet peers, creating and storing a
   // sliding window of stats.
   void CollectDocDBStats(const std::vector<tablet::TabletPeerPtr>& peers);
@@ -241,6 +251,9 @@ class FullCompactionManager {
   // -1 indicates that there is no information about the previous execution.
   std::atomic<int> num_scheduled_last_execution_ = -1;
 
+  // Number of expired files which deletion was scheduled during the previous execution.
+  std::atomic<size_t> num_expired_files_last_execution_ = 0;
+
   // Background task for scheduling major compactions, called every check_interval_sec_.
   std::unique_ptr<BackgroundTask> bg_task_;
 
@@ -80,6 +80,12 @@ DEFINE_RUNTIME_string(ysql_sequence_cache_method, "connection",
     "Where sequence values are cached for both existing and new sequences. Valid values are "
     "\"connection\" and \"server\"");
 
+DEFINE_RUNTIME_uint32(ysql_sequence_server_cache_min_fetch_count, 0,
+    "Minimal number of values fetched from the sequences table when the server sequence cache is "
+    "refilled, if the sequence cache size is smaller. Larger ranges let all backends of the "
+    "tserver share a sequence with fewer writes to the sequences table.");
+TAG_FLAG(ysql_sequence_server_cache_min_fetch_count, advanced);
+
 DECLARE_bool(ysql_serializable_isolation_for_ddl_txn);
 DECLARE_bool(ysql_ddl_rollback_enabled);
 
@@ -1500,11 +1506,19 @@ Status PgClientSession::FetchSequenceTuple(
     }
   });
   if (use_sequence_cache) {
+    // Fast path: take a value from the cached range without waiting for the entry.
+    std::optional<int64_t> sequence_value = sequence_cache_.GetValueIfCached(sequence_id, inc_by);
+    if (sequence_value.has_value()) {
+      resp->set_first_value(*sequence_value);
+      resp->set_last_value(*sequence_value);
+      return Status::OK();
+    }
+
     entry = VERIFY_RESULT(
         sequence_cache_.GetWhenAvailable(sequence_id, ToSteady(context->GetClientDeadline())));
 
-    // If the cache has a value, return immediately.
-    std::optional<int64_t> sequence_value = entry->GetValueIfCached(inc_by);
+    // The range could have been refilled while waiting for the entry.
+    sequence_value = entry->GetValueIfCached(inc_by);
     if (sequence_value.has_value()) {
       // Since the tserver cache is enabled, the connection cache size is implicitly 1 so the first
       // and last value are the same.
@@ -1526,7 +1540,10 @@ Status PgClientSession::FetchSequenceTuple(
   write_request->add_partition_column_values()->mutable_value()->set_int64_value(sequence_id);
 
   auto* fetch_sequence_params = write_request->mutable_fetch_sequence_params();
-  fetch_sequence_params->set_fetch_count(req.fetch_count());
+  fetch_sequence_params->set_fetch_count(
+      use_sequence_cache
+          ? std::max(req.fetch_count(), FLAGS_ysql_sequence_server_cache_min_fetch_count)
+          : req.fetch_count());
   fetch_sequence_params->set_inc_by(inc_by);
   fetch_sequence_params->set_min_value(req.min_value());
   fetch_sequence_params->set_max_value(req.max_value());
@@ -31,7 +31,11 @@ PgSequenceCache::Entry::Entry() : cv_(&mutex_), available_(true), has_values_(fa
 
 std::optional<int64_t> PgSequenceCache::Entry::GetValueIfCached(int64_t inc_by) {
   CheckNotAvailable();
+  return TakeValue(inc_by);
+}
 
+std::optional<int64_t> PgSequenceCache::Entry::TakeValue(int64_t inc_by) {
+  std::lock_guard range_lock_guard(range_lock_);
   if (!has_values_) {
     return std::nullopt;
   }
@@ -54,6 +58,7 @@ std::optional<int64_t> PgSequenceCache::Entry::GetValueIfCached(int64_t inc_by)
 
 void PgSequenceCache::Entry::SetRange(int64_t first_value, int64_t last_value) {
   CheckNotAvailable();
+  std::lock_guard range_lock_guard(range_lock_);
   curr_value_ = first_value;
   last_value_ = last_value;
   has_values_ = true;
@@ -98,5 +103,18 @@ Result<std::shared_ptr<PgSequenceCache::Entry>> PgSequenceCache::GetWhenAvailabl
   return entry;
 }
 
+std::optional<int64_t> PgSequenceCache::GetValueIfCached(int64_t sequence_id, int64_t inc_by) {
+  std::shared_ptr<Entry> entry;
+  {
+    std::lock_guard cache_lock_guard(lock_);
+    auto it = cache_.find(sequence_id);
+    if (it == cache_.end()) {
+      return std::nullopt;
+    }
+    entry = it->second;
+  }
+  return entry->TakeValue(inc_by);
+}
+
 }  // namespace tserver
 }  // namespace yb
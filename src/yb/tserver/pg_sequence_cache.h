@@ -34,12 +34,16 @@ class PgSequenceCache {
     ConditionVariable cv_;
     // Whether no thread is currently working on this resource.
     bool available_ GUARDED_BY(mutex_);
+    // Protects the cached range, so values could be taken from it without waiting for the entry
+    // to be available.
+    simple_spinlock range_lock_;
     // Whether this entry's range has values remaining.
-    bool has_values_;
-    int64_t curr_value_;
-    int64_t last_value_;
+    bool has_values_ GUARDED_BY(range_lock_);
+    int64_t curr_value_ GUARDED_BY(range_lock_);
+    int64_t last_value_ GUARDED_BY(range_lock_);
 
     void CheckNotAvailable();
+    std::optional<int64_t> TakeValue(int64_t inc_by) EXCLUDES(range_lock_);
 
    public:
     Entry();
@@ -63,6 +67,12 @@ class PgSequenceCache {
   Result<std::shared_ptr<Entry>> GetWhenAvailable(int64_t sequence_id, const MonoTime& deadline)
       EXCLUDES(lock_);
 
+  // Get a single value of the sequence if its range is cached. Does not wait for the entry to be
+  // available, so concurrent nextval calls are not serialized while the range has values. Returns
+  // nullopt when the range should be refilled, which is done by the owner of the entry returned by
+  // GetWhenAvailable.
+  std::optional<int64_t> GetValueIfCached(int64_t sequence_id, int64_t inc_by) EXCLUDES(lock_);
+
  private:
   simple_spinlock lock_;
   std::unordered_map<int64_t, std::shared_ptr<Entry>> cache_ GUARDED_BY(lock_);
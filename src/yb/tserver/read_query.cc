@@ -22,6 +22,7 @@
 
 #include "yb/tablet/operations/write_operation.h"
 #include "yb/tablet/read_result.h"
+#include "yb/tablet/request_origin_tracker.h"
 #include "yb/tablet/tablet.h"
 #include "yb/tablet/tablet_metadata.h"
 #include "yb/tablet/tablet_metrics.h"
@@ -37,6 +38,8 @@
 #include "yb/util/debug/trace_event.h"
 #include "yb/util/flags.h"
 #include "yb/util/scope_exit.h"
+#include "yb/util/size_class_pool.h"
+#include "yb/util/status_format.h"
 #include "yb/util/trace.h"
 
 using namespace std::literals;
@@ -65,6 +68,12 @@ DEFINE_RUNTIME_bool(ysql_follower_reads_avoid_waiting_for_safe_time, true,
     "faster than waiting for safe time to catch up.");
 TAG_FLAG(ysql_follower_reads_avoid_waiting_for_safe_time, advanced);
 
+DEFINE_RUNTIME_bool(clamp_read_local_limit_to_safe_time, true,
+    "Limit the uncertainty window of a read with a specified read time by the safe time of the "
+    "tablet at the moment the read arrived, like for the following reads of the same tablet. "
+    "Reduces read restarts caused by clock skew.");
+TAG_FLAG(clamp_read_local_limit_to_safe_time, advanced);
+
 namespace yb {
 namespace tserver {
 
@@ -321,6 +330,14 @@ Status ReadQuery::DoPerform() {
         TabletServerError(TabletServerErrorPB::TABLET_NOT_FOUND));
   }
 
+  // Only reads served by the leader matter for leader placement.
+  if (!abstract_tablet_->system() && !reading_from_non_leader_) {
+    auto& request_origin_tracker = tablet()->request_origin_tracker();
+    if (request_origin_tracker.RecordRequest()) {
+      request_origin_tracker.AddOrigin(context_.remote_address().address().to_string());
+    }
+  }
+
   if (FLAGS_TEST_simulate_time_out_failures_msecs > 0 && RandomUniformInt(0, 10) < 2) {
     LOG(INFO) << "Marking request as timed out for test: " << req_->ShortDebugString();
     SleepFor(MonoDelta::FromMilliseconds(FLAGS_TEST_simulate_time_out_failures_msecs));
@@ -457,6 +474,14 @@ Status ReadQuery::DoPickReadTime(server::Clock* clock) {
              ? current_safe_time
              : VERIFY_RESULT(abstract_tablet_->SafeTime(
                    require_lease_, read_time_.read, context_.GetClientDeadline())));
+    // Records written after the safe time were not yet visible when the read arrived, so they
+    // were written concurrently with the read and do not require a read restart. The caller
+    // applies the same limit to the following reads of this tablet, see local_limit_ht.
+    if (transactional() && !IsPgsqlFollowerReadAtAFollower() &&
+        GetAtomicFlag(&FLAGS_clamp_read_local_limit_to_safe_time)) {
+      read_time_.local_limit = std::min(
+          read_time_.local_limit, std::max(safe_ht_to_read_, read_time_.read));
+    }
   }
   if (metrics) {
     auto safe_time_wait = MonoTime::Now() - start_time;
@@ -710,13 +735,44 @@ Result<ReadHybridTime> ReadQuery::DoReadImpl() {
   return ReadHybridTime();
 }
 
+// Returns true if the read could touch a large number of rows, i.e. it computes an aggregate,
+// samples the table or has no key restriction.
+bool IsScan(const ReadRequestPB& req) {
+  for (const auto& pgsql_req : req.pgsql_batch()) {
+    if (pgsql_req.is_aggregate() || pgsql_req.has_sampling_state() ||
+        (!pgsql_req.has_ybctid_column_value() && pgsql_req.batch_arguments().empty() &&
+         pgsql_req.partition_column_values().empty())) {
+      return true;
+    }
+  }
+  for (const auto& ql_req : req.ql_batch()) {
+    if (ql_req.is_aggregate() || ql_req.hashed_column_values().empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 } // namespace
 
 void PerformRead(
     TabletServerIf* server, ReadTabletProvider* read_tablet_provider,
     const ReadRequestPB* req, ReadResponsePB* resp, rpc::RpcContext context) {
-  auto read_query = std::make_shared<ReadQuery>(
-      server, read_tablet_provider, req, resp, std::move(context));
+  auto read_query = std::allocate_shared<ReadQuery>(
+      SizeClassAllocator<ReadQuery>(), server, read_tablet_provider, req, resp,
+      std::move(context));
+  auto* tablet_manager = server->tablet_manager();
+  auto* scan_read_pool = tablet_manager ? tablet_manager->scan_read_pool() : nullptr;
+  if (scan_read_pool && IsScan(*req)) {
+    // Execute scans in a separate pool, so they don't occupy the service threads used by
+    // point reads.
+    auto status = scan_read_pool->SubmitFunc([read_query] { read_query->Perform(); });
+    if (!status.ok()) {
+      read_query->RespondFailure(STATUS_FORMAT(
+          ServiceUnavailable, "Scan read pool is overloaded: $0", status));
+    }
+    return;
+  }
   read_query->Perform();
 }
 
@@ -598,16 +598,8 @@ Status RemoteBootstrapClient::DownloadRocksDBFiles() {
 
   RETURN_NOT_OK(CreateTabletDirectories(rocksdb_dir, meta_->fs_manager()));
 
-  DataIdPB data_id;
-  data_id.set_type(DataIdPB::ROCKSDB_FILE);
-  for (auto const& file_pb : new_superblock_.kv_store().rocksdb_files()) {
-    auto start = MonoTime::Now();
-    RETURN_NOT_OK(downloader_.DownloadFile(file_pb, rocksdb_dir, &data_id));
-    auto elapsed = MonoTime::Now().GetDeltaSince(start);
-    LOG_WITH_PREFIX(INFO)
-        << "Downloaded file " << file_pb.name() << " of size " << file_pb.size_bytes()
-        << " in " << elapsed.ToSeconds() << " seconds";
-  }
+  RETURN_NOT_OK(downloader_.DownloadFiles(
+      new_superblock_.kv_store().rocksdb_files(), rocksdb_dir, DataIdPB::ROCKSDB_FILE));
 
   // To avoid adding new file type to remote bootstrap we move intents as subdir of regular DB.
   auto intents_tmp_dir = JoinPathSegments(rocksdb_dir, tablet::kIntentsSubdir);
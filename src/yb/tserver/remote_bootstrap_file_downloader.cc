@@ -14,6 +14,7 @@
 #include "yb/tserver/remote_bootstrap_file_downloader.h"
 #include "yb/tserver/remote_client_base.h"
 
+#include <atomic>
 #include <iomanip>
 
 #include "yb/common/wire_protocol.h"
@@ -33,6 +34,7 @@
 #include "yb/util/size_literals.h"
 #include "yb/util/status_format.h"
 #include "yb/util/stopwatch.h"
+#include "yb/util/thread.h"
 
 using namespace yb::size_literals;
 
@@ -48,6 +50,16 @@ DEFINE_UNKNOWN_int64(remote_bootstrap_rate_limit_bytes_per_sec, 256_MB,
              "the total limit will be 2 * remote_bootstrap_rate_limit_bytes_per_sec because a "
              "tserver or master can act both as a sender and receiver at the same time.");
 
+DEFINE_RUNTIME_int32(remote_bootstrap_max_parallel_file_downloads, 1,
+    "Maximum number of RocksDB files downloaded concurrently by a single remote bootstrap "
+    "session. The rate limit is shared by all downloads of the session.");
+TAG_FLAG(remote_bootstrap_max_parallel_file_downloads, advanced);
+
+DEFINE_RUNTIME_int32(remote_bootstrap_fetch_data_max_retries, 3,
+    "Number of times a remote bootstrap data chunk fetch that failed with a timeout or a network "
+    "error is retried from the same offset, before failing the whole session.");
+TAG_FLAG(remote_bootstrap_fetch_data_max_retries, advanced);
+
 DEFINE_UNKNOWN_int32(bytes_remote_bootstrap_durable_write_mb, 1024,
              "Explicitly call fsync after downloading the specified amount of data in MB "
              "during a remote bootstrap session. If 0 fsync() is not called.");
@@ -102,16 +114,23 @@ Status RemoteBootstrapFileDownloader::DownloadFile(
   RETURN_NOT_OK(env().CreateDirs(DirName(file_path)));
 
   if (file_pb.inode() != 0) {
-    auto it = inode2file_.find(file_pb.inode());
-    if (it != inode2file_.end()) {
+    std::string linked_file;
+    {
+      std::lock_guard lock(inode2file_mutex_);
+      auto it = inode2file_.find(file_pb.inode());
+      if (it != inode2file_.end()) {
+        linked_file = it->second;
+      }
+    }
+    if (!linked_file.empty()) {
       VLOG_WITH_PREFIX(2) << "File with the same inode already found: " << file_path
-                          << " => " << it->second;
-      auto link_status = env().LinkFile(it->second, file_path);
+                          << " => " << linked_file;
+      auto link_status = env().LinkFile(linked_file, file_path);
       if (link_status.ok()) {
         return Status::OK();
       }
       // TODO fallback to copy.
-      LOG_WITH_PREFIX(ERROR) << "Failed to link file: " << file_path << " => " << it->second
+      LOG_WITH_PREFIX(ERROR) << "Failed to link file: " << file_path << " => " << linked_file
                              << ": " << link_status;
     }
   }
@@ -130,12 +149,65 @@ Status RemoteBootstrapFileDownloader::DownloadFile(
   VLOG_WITH_PREFIX(2) << "Downloaded file " << file_path;
 
   if (file_pb.inode() != 0) {
+    std::lock_guard lock(inode2file_mutex_);
     inode2file_.emplace(file_pb.inode(), file_path);
   }
 
   return Status::OK();
 }
 
+Status RemoteBootstrapFileDownloader::DownloadFiles(
+    const google::protobuf::RepeatedPtrField<tablet::FilePB>& files, const std::string& dir,
+    DataIdPB::IdType type) {
+  std::atomic<int> next_file{0};
+  std::mutex status_mutex;
+  Status status;
+
+  auto download = [&]() {
+    DataIdPB data_id;
+    data_id.set_type(type);
+    for (;;) {
+      auto idx = next_file.fetch_add(1);
+      if (idx >= files.size()) {
+        return;
+      }
+      const auto& file_pb = files.Get(idx);
+      auto start = MonoTime::Now();
+      auto s = DownloadFile(file_pb, dir, &data_id);
+      if (!s.ok()) {
+        std::lock_guard lock(status_mutex);
+        if (status.ok()) {
+          status = s;
+        }
+        // Stop other downloads, the session has failed anyway.
+        next_file = files.size();
+        return;
+      }
+      LOG_WITH_PREFIX(INFO)
+          << "Downloaded file " << file_pb.name() << " of size " << file_pb.size_bytes()
+          << " in " << MonoTime::Now().GetDeltaSince(start).ToSeconds() << " seconds";
+    }
+  };
+
+  const auto num_threads = std::min(
+      std::max(FLAGS_remote_bootstrap_max_parallel_file_downloads, 1), files.size());
+  std::vector<ThreadPtr> threads;
+  for (int i = 1; i < num_threads; ++i) {
+    auto thread = Thread::Make("remote_bootstrap", "rb-download", download);
+    if (!thread.ok()) {
+      LOG_WITH_PREFIX(WARNING) << "Failed to start download thread: " << thread.status();
+      break;
+    }
+    threads.push_back(std::move(*thread));
+  }
+  download();
+  for (const auto& thread : threads) {
+    thread->Join();
+  }
+
+  return status;
+}
+
 template<class Appendable>
 Status RemoteBootstrapFileDownloader::DownloadFile(
     const DataIdPB& data_id, Appendable* appendable) {
@@ -193,9 +265,23 @@ Status RemoteBootstrapFileDownloader::DownloadFile(
     req.set_max_length(max_length);
 
     FetchDataResponsePB resp;
-    auto status = rate_limiter->SendOrReceiveData([this, &req, &resp, &controller]() {
-      return proxy_->FetchData(req, &resp, &controller);
-    }, [&resp]() { return resp.ByteSize(); });
+    Status status;
+    for (int attempt = 0;; ++attempt) {
+      status = rate_limiter->SendOrReceiveData([this, &req, &resp, &controller]() {
+        return proxy_->FetchData(req, &resp, &controller);
+      }, [&resp]() { return resp.ByteSize(); });
+      // Data is appended only after a successful fetch, so a failed chunk could be fetched again
+      // from the same offset without restarting the session.
+      if (status.ok() || !(status.IsTimedOut() || status.IsNetworkError()) ||
+          attempt >= FLAGS_remote_bootstrap_fetch_data_max_retries) {
+        break;
+      }
+      LOG_WITH_PREFIX(WARNING) << "Failed to fetch " << data_id.file_name() << " at offset "
+                               << offset << ", retrying: " << status;
+      controller.Reset();
+      resp.Clear();
+      SleepFor(MonoDelta::FromMilliseconds(100 * (attempt + 1)));
+    }
     RETURN_NOT_OK_UNWIND_PREPEND(status, controller, "Unable to fetch data from remote");
     DCHECK_LE(resp.chunk().data().size(), max_length);
     iterations++;
@@ -14,9 +14,12 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
+#include "yb/gutil/thread_annotations.h"
+
 #include "yb/rpc/rpc_fwd.h"
 
 #include "yb/tablet/metadata.pb.h"
@@ -47,6 +50,12 @@ class RemoteBootstrapFileDownloader {
   Status DownloadFile(
       const tablet::FilePB& file_pb, const std::string& dir, DataIdPB* data_id);
 
+  // Download files of the specified type into dir, running up to
+  // remote_bootstrap_max_parallel_file_downloads downloads concurrently.
+  Status DownloadFiles(
+      const google::protobuf::RepeatedPtrField<tablet::FilePB>& files, const std::string& dir,
+      DataIdPB::IdType type);
+
   // Download a single remote file. The block and WAL implementations delegate
   // to this method when downloading files.
   //
@@ -80,7 +89,8 @@ class RemoteBootstrapFileDownloader {
   std::shared_ptr<RemoteBootstrapServiceProxy> proxy_;
   std::string session_id_;
   MonoDelta session_idle_timeout_ = MonoDelta::kZero;
-  std::unordered_map<uint64_t, std::string> inode2file_;
+  std::mutex inode2file_mutex_;
+  std::unordered_map<uint64_t, std::string> inode2file_ GUARDED_BY(inode2file_mutex_);
 };
 
 Status UnwindRemoteError(const Status& status, const rpc::RpcController& controller);
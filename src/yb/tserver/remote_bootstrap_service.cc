@@ -253,11 +253,15 @@ void RemoteBootstrapServiceImpl::FetchData(const FetchDataRequestPB* req,
     session = it->second.session;
   }
 
-  session->EnsureRateLimiterIsInitialized();
+  int64_t rate_limit;
+  {
+    std::lock_guard lock(session->fetch_data_mutex());
+    session->EnsureRateLimiterIsInitialized();
+    rate_limit = session->rate_limiter().GetMaxSizeForNextTransmission();
+  }
 
   MAYBE_FAULT(FLAGS_TEST_fault_crash_on_handle_rb_fetch_data);
 
-  int64_t rate_limit = session->rate_limiter().GetMaxSizeForNextTransmission();
   VLOG(3) << " rate limiter max len: " << rate_limit;
   GetDataPieceInfo info = {
     .offset = req->offset(),
@@ -270,15 +274,21 @@ void RemoteBootstrapServiceImpl::FetchData(const FetchDataRequestPB* req,
   RPC_RETURN_NOT_OK(ValidateFetchRequestDataId(data_id, &info.error_code, session),
                     info.error_code, "Invalid DataId");
 
-  session->data_read_timer().resume();
+  auto start = MonoTime::Now();
   RPC_RETURN_NOT_OK(session->GetDataPiece(data_id, &info),
                     info.error_code, "Unable to get piece of data file");
-  session->data_read_timer().stop();
+  auto data_read_time = MonoTime::Now() - start;
 
-  session->rate_limiter().UpdateDataSizeAndMaybeSleep(info.data.size());
-  session->crc_compute_timer().resume();
+  start = MonoTime::Now();
   uint32_t crc32 = Crc32c(info.data.data(), info.data.length());
-  session->crc_compute_timer().stop();
+  auto crc_compute_time = MonoTime::Now() - start;
+
+  {
+    std::lock_guard lock(session->fetch_data_mutex());
+    session->data_read_time() += data_read_time;
+    session->crc_compute_time() += crc_compute_time;
+    session->rate_limiter().UpdateDataSizeAndMaybeSleep(info.data.size());
+  }
 
   DataChunkPB* data_chunk = resp->mutable_chunk();
   *data_chunk->mutable_data() = std::move(info.data);
@@ -478,17 +488,20 @@ Status RemoteBootstrapServiceImpl::DoEndRemoteBootstrapSession(
     if(!session->Succeeded()) {
       session->SetSuccess();
 
+      std::lock_guard lock(session->fetch_data_mutex());
       const auto total_bytes = session->rate_limiter().total_bytes();
+      const auto data_read_ms = session->data_read_time().ToSeconds() * 1000;
+      const auto crc_compute_ms = session->crc_compute_time().ToSeconds() * 1000;
       LOG(INFO) << std::fixed << std::setprecision(3) << "Remote bootstrap session with id "
         << session_id << " completed. Stats: Transmission rate: "
         << session->rate_limiter().GetRate() << ", RateLimiter total time slept: "
         << session->rate_limiter().total_time_slept() << ", Total bytes: "
         << total_bytes << ", Read rate "
-        << (total_bytes / session->data_read_timer().elapsed().wall_millis())
-        << " bytes/msec (Total ms: " << session->data_read_timer().elapsed().wall_millis()
+        << (total_bytes / data_read_ms)
+        << " bytes/msec (Total ms: " << data_read_ms
         << "), CRC computation rate: "
-        << (total_bytes / session->crc_compute_timer().elapsed().wall_millis()) << " bytes/msec"
-        << "(Total ms: " << session->crc_compute_timer().elapsed().wall_millis() << ")";
+        << (total_bytes / crc_compute_ms) << " bytes/msec"
+        << "(Total ms: " << crc_compute_ms << ")";
     }
 
     if (PREDICT_FALSE(FLAGS_TEST_inject_latency_before_change_role_secs)) {
@@ -413,6 +413,24 @@ Status ReadFileChunkToBuf(RandomAccessFile* file, const string& data_name, GetDa
   return Status::OK();
 }
 
+// Copy a chunk of a memory mapped log segment into the response buffer, without reading it
+// through an intermediate file read.
+Status ReadMappingChunkToBuf(
+    const log::LogSegmentMapping& mapping, const string& data_name, GetDataPieceInfo* info) {
+  auto response_data_size = VERIFY_RESULT_PREPEND(
+      GetResponseDataSize(info), Format("Error reading $0", data_name));
+  auto data = mapping.data();
+  if (info->offset + response_data_size > data.size()) {
+    info->error_code = RemoteBootstrapErrorPB::IO_ERROR;
+    return STATUS_FORMAT(
+        IOError, "Chunk $0+$1 of $2 is beyond mapped size $3", info->offset, response_data_size,
+        data_name, data.size());
+  }
+  info->data.assign(data.cdata() + info->offset, response_data_size);
+  TRACE("Remote bootstrap: $0: $1 total bytes copied from mapping", data_name, response_data_size);
+  return Status::OK();
+}
+
 } // namespace
 
 Env* RemoteBootstrapSession::env() const {
@@ -500,6 +518,7 @@ Status RemoteBootstrapSession::GetDataPiece(const DataIdPB& data_id, GetDataPiec
 
 Status RemoteBootstrapSession::GetLogSegmentPiece(uint64_t segment_seqno, GetDataPieceInfo* info) {
   std::shared_ptr<RandomAccessFile> file;
+  std::shared_ptr<log::LogSegmentMapping> mapping;
   {
     std::lock_guard lock(mutex_);
     if (opened_log_segment_seqno_ != segment_seqno) {
@@ -507,8 +526,14 @@ Status RemoteBootstrapSession::GetLogSegmentPiece(uint64_t segment_seqno, GetDat
     }
     info->data_size = opened_log_segment_file_size_;
     file = opened_log_segment_file_;
+    mapping = opened_log_segment_mapping_;
+  }
+  auto data_name = Substitute("log segment $0", segment_seqno);
+  if (mapping) {
+    RETURN_NOT_OK(ReadMappingChunkToBuf(*mapping, data_name, info));
+  } else {
+    RETURN_NOT_OK(ReadFileChunkToBuf(file.get(), data_name, info));
   }
-  RETURN_NOT_OK(ReadFileChunkToBuf(file.get(), Substitute("log segment $0", segment_seqno), info));
 
   // Note: We do not eagerly close log segment files, since we share ownership
   // of the LogSegment objects with the Log itself.
@@ -622,6 +647,8 @@ Status RemoteBootstrapSession::OpenLogSegment(
       log_segment->get_encryption_header_size() + log_segment->readable_to_offset();
   opened_log_segment_seqno_ = segment_seqno;
   opened_log_segment_file_ = log_segment->readable_file_checkpoint();
+  // Only closed segments are mapped, so the mapping covers the whole segment file.
+  opened_log_segment_mapping_ = log_segment->GetMapping();
   opened_log_segment_active_ = active_seqno == segment_seqno;
 
   if (log_segment->HasFooter() &&
@@ -151,10 +151,14 @@ class RemoteBootstrapSession : public RefCountedThreadSafe<RemoteBootstrapSessio
 
   void EnsureRateLimiterIsInitialized();
 
+  // FetchData could be called concurrently for different files of the same session. The rate
+  // limiter and the fetch stats should be accessed only while holding this mutex.
+  std::mutex& fetch_data_mutex() { return fetch_data_mutex_; }
+
   RateLimiter& rate_limiter() { return rate_limiter_; }
 
-  Stopwatch& crc_compute_timer() { return crc_compute_timer_; }
-  Stopwatch& data_read_timer() { return data_read_timer_; }
+  MonoDelta& crc_compute_time() { return crc_compute_time_; }
+  MonoDelta& data_read_time() { return data_read_time_; }
 
   static const std::string kCheckpointsDir;
 
@@ -240,6 +244,7 @@ class RemoteBootstrapSession : public RefCountedThreadSafe<RemoteBootstrapSessio
   mutable std::mutex mutex_;
 
   std::shared_ptr<RandomAccessFile> opened_log_segment_file_ GUARDED_BY(mutex_);
+  std::shared_ptr<log::LogSegmentMapping> opened_log_segment_mapping_ GUARDED_BY(mutex_);
   int64_t opened_log_segment_file_size_ GUARDED_BY(mutex_) = -1;
   uint64_t opened_log_segment_seqno_ GUARDED_BY(mutex_) = 0;
   bool opened_log_segment_active_ GUARDED_BY(mutex_) = false;
@@ -274,9 +279,11 @@ class RemoteBootstrapSession : public RefCountedThreadSafe<RemoteBootstrapSessio
   // Time when this session was initialized.
   MonoTime start_time_;
 
-  // Stopwatch to capture the latency of different operations
-  Stopwatch crc_compute_timer_;
-  Stopwatch data_read_timer_;
+  std::mutex fetch_data_mutex_;
+
+  // Total latency of different operations, summed over all FetchData calls.
+  MonoDelta crc_compute_time_ = MonoDelta::kZero;
+  MonoDelta data_read_time_ = MonoDelta::kZero;
 
   // Used to limit the transmission rate.
   RateLimiter rate_limiter_;
@@ -53,6 +53,11 @@ DEFINE_RUNTIME_uint64(sst_files_hard_limit, 48,
     "When majority SST files number is greater that this limit, we will reject all write "
     "requests.");
 
+DEFINE_RUNTIME_bool(reject_writes_on_rocksdb_write_stall_pressure, true,
+    "When RocksDB of a tablet delays writes because of pending flushes and compactions, reject "
+    "part of write requests to this tablet. The higher the write stall pressure, the higher "
+    "probability of rejection.");
+
 DEFINE_test_flag(int32, write_rejection_percentage, 0,
                  "Reject specified percentage of writes.");
 
@@ -62,6 +67,10 @@ DEFINE_RUNTIME_uint64(min_rejection_delay_ms, 100,
 DEFINE_RUNTIME_uint64(max_rejection_delay_ms, 5000,
     "Maximal delay for rejected write to be retried in milliseconds.");
 
+DEFINE_RUNTIME_AUTO_bool(send_leader_hint_on_not_the_leader, kExternal, false, true,
+    "When true, NOT_THE_LEADER errors carry the uuid of the peer that the replica believes to be "
+    "the leader, so clients could retry on it without a master lookup.");
+
 DECLARE_int32(memory_limit_warn_threshold_percentage);
 
 namespace yb {
@@ -165,7 +174,21 @@ Result<int64_t> LeaderTerm(const tablet::TabletPeer& tablet_peer) {
     typedef consensus::LeaderStatus LeaderStatus;
     auto status = leader_state.CreateStatus();
     switch (leader_state.status) {
-      case LeaderStatus::NOT_LEADER: FALLTHROUGH_INTENDED;
+      case LeaderStatus::NOT_LEADER: {
+        status = status.CloneAndAddErrorCode(
+            TabletServerError(TabletServerErrorPB::NOT_THE_LEADER));
+        if (!FLAGS_send_leader_hint_on_not_the_leader) {
+          return status;
+        }
+        // Let the client retry on the known leader instead of trying replicas one by one or
+        // looking up the leader on the master.
+        auto leader_uuid =
+            consensus->ConsensusState(consensus::CONSENSUS_CONFIG_COMMITTED).leader_uuid();
+        if (!leader_uuid.empty() && leader_uuid != tablet_peer.permanent_uuid()) {
+          status = status.CloneAndAddErrorCode(TabletServerLeaderHint(leader_uuid));
+        }
+        return status;
+      }
       case LeaderStatus::LEADER_BUT_NO_MAJORITY_REPLICATED_LEASE:
         // We are returning a NotTheLeader as opposed to LeaderNotReady, because there is a chance
         // that we're a partitioned-away leader, and the client needs to do another leader lookup.
@@ -292,6 +315,7 @@ Result<TabletPeerTablet> DoLookupTabletPeer(
         TabletServerErrorPB::TABLET_NOT_RUNNING));
   }
   result.tablet = *tablet_result;
+  result.tablet_peer->RecordAccess();
   return result;
 }
 
@@ -440,6 +464,15 @@ Status CheckWriteThrottling(double score, tablet::TabletPeer* tablet_peer) {
     }
   }
 
+  if (FLAGS_reject_writes_on_rocksdb_write_stall_pressure) {
+    const auto write_stall_pressure = tablet->GetWriteStallPressure();
+    if (write_stall_pressure > 0 && write_stall_pressure >= 1 - score) {
+      auto message = Format("RocksDB write stall pressure $0, score: $1",
+                            write_stall_pressure, score);
+      return RejectWrite(tablet_peer, message, score + write_stall_pressure);
+    }
+  }
+
   if (FLAGS_TEST_write_rejection_percentage != 0 &&
       score >= 1.0 - FLAGS_TEST_write_rejection_percentage * 0.01) {
     auto status = Format("TEST: Write request rejected, desired percentage: $0, score: $1",
@@ -13,9 +13,13 @@
 
 #include "yb/tserver/tablet_memory_manager.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "yb/consensus/log_cache.h"
 #include "yb/consensus/raft_consensus.h"
 
+#include "yb/gutil/bind.h"
 #include "yb/gutil/bits.h"
 #include "yb/gutil/casts.h"
 #include "yb/gutil/strings/human_readable.h"
@@ -23,6 +27,7 @@
 
 #include "yb/rocksdb/cache.h"
 #include "yb/rocksdb/memory_monitor.h"
+#include "yb/rocksdb/util/arena.h"
 
 #include "yb/tablet/tablet.h"
 #include "yb/tablet/tablet_options.h"
@@ -32,6 +37,7 @@
 #include "yb/util/flags.h"
 #include "yb/util/logging.h"
 #include "yb/util/mem_tracker.h"
+#include "yb/util/metrics.h"
 #include "yb/util/status_log.h"
 
 using namespace std::literals;
@@ -52,6 +58,14 @@ DEFINE_UNKNOWN_int64(global_memstore_size_mb_max, 2048,
              "Global memstore size is determined as a percentage of the available "
              "memory. However, this flag limits it in absolute size. Value of 0 "
              "means no limit on the value obtained by the percentage. Default is 2048.");
+DEFINE_RUNTIME_uint64(memstore_flush_min_tablet_bytes, 0,
+    "When the global memstore limit is reached, prefer flushing the tablet with the oldest "
+    "memstore write among tablets holding at least this many bytes in their memstores. Tablets "
+    "with smaller memstores are flushed only if no tablet reaches this size. Avoids a stream of "
+    "tiny flushes on servers with many small tablets. 0 means always flush the tablet with the "
+    "oldest memstore write.");
+TAG_FLAG(memstore_flush_min_tablet_bytes, advanced);
+
 DEFINE_NON_RUNTIME_int32(
     tablet_overhead_size_percentage, 0,
     "Percentage of total available memory to use for tablet-related overheads. Default is 0, "
@@ -85,6 +99,51 @@ DEFINE_RUNTIME_int32(db_block_cache_num_shard_bits, -1,
              "The maximum permissible value is 19.");
 TAG_FLAG(db_block_cache_num_shard_bits, advanced);
 
+DEFINE_NON_RUNTIME_bool(db_block_cache_use_clock, false,
+             "Use CLOCK eviction policy for RocksDB block cache instead of LRU. Cache hits of "
+             "CLOCK cache do not take exclusive lock on the cache shard.");
+TAG_FLAG(db_block_cache_use_clock, advanced);
+
+DEFINE_NON_RUNTIME_int64(db_compressed_block_cache_size_bytes, 0,
+             "Size of RocksDB secondary cache of compressed data blocks (in bytes). Blocks read "
+             "from SST files are also stored there in compressed form, so a block evicted from "
+             "the block cache could be restored without reading the file. 0 disables the cache.");
+TAG_FLAG(db_compressed_block_cache_size_bytes, advanced);
+
+DEFINE_NON_RUNTIME_int32(memory_arbiter_interval_ms, 0,
+    "Interval of the task that shifts memory between the block cache and the global memstore, "
+    "comparing bytes read because of block cache misses with bytes flushed because of the global "
+    "memstore limit. 0 disables the task, so both sizes stay as configured.");
+TAG_FLAG(memory_arbiter_interval_ms, advanced);
+
+DEFINE_NON_RUNTIME_int32(memory_arbiter_max_shift_percentage, 50,
+    "Maximum percentage of the configured block cache or global memstore size that the memory "
+    "arbiter could give away to the other one.");
+TAG_FLAG(memory_arbiter_max_shift_percentage, advanced);
+
+DEFINE_RUNTIME_int32(memory_arbiter_step_percentage, 5,
+    "Percentage of the configured block cache and global memstore size combined, that the memory "
+    "arbiter moves from one to another in a single step.");
+TAG_FLAG(memory_arbiter_step_percentage, advanced);
+
+DECLARE_int64(db_block_size_bytes);
+
+METRIC_DECLARE_counter(block_cache_misses);
+
+METRIC_DEFINE_gauge_uint64(server, arena_explicit_huge_page_blocks,
+    "Arena Explicit Huge Page Blocks", yb::MetricUnit::kUnits,
+    "Number of arena blocks, e.g. memtable blocks, allocated from explicitly reserved huge pages.");
+
+METRIC_DEFINE_gauge_uint64(server, arena_transparent_huge_page_blocks,
+    "Arena Transparent Huge Page Blocks", yb::MetricUnit::kUnits,
+    "Number of arena blocks, e.g. memtable blocks, backed by transparent huge pages because "
+    "explicitly reserved huge pages were not available.");
+
+METRIC_DEFINE_gauge_uint64(server, arena_huge_page_fallback_blocks,
+    "Arena Huge Page Fallback Blocks", yb::MetricUnit::kUnits,
+    "Number of arena blocks configured to use huge pages, that were allocated from regular "
+    "pages because huge pages were not available.");
+
 DEFINE_test_flag(bool, pretend_memory_exceeded_enforce_flush, false,
                   "Always pretend memory has been exceeded to enforce background flush.");
 
@@ -94,6 +153,30 @@ using strings::Substitute;
 
 namespace {
 
+uint64_t GetArenaExplicitHugePageBlocks() {
+  return rocksdb::GetArenaHugePageStats().explicit_blocks;
+}
+
+uint64_t GetArenaTransparentHugePageBlocks() {
+  return rocksdb::GetArenaHugePageStats().transparent_blocks;
+}
+
+uint64_t GetArenaHugePageFallbackBlocks() {
+  return rocksdb::GetArenaHugePageStats().fallback_blocks;
+}
+
+void RegisterArenaHugePageMetrics(const scoped_refptr<MetricEntity>& metrics) {
+  if (!metrics) {
+    return;
+  }
+  metrics->NeverRetire(METRIC_arena_explicit_huge_page_blocks.InstantiateFunctionGauge(
+      metrics, Bind(GetArenaExplicitHugePageBlocks)));
+  metrics->NeverRetire(METRIC_arena_transparent_huge_page_blocks.InstantiateFunctionGauge(
+      metrics, Bind(GetArenaTransparentHugePageBlocks)));
+  metrics->NeverRetire(METRIC_arena_huge_page_fallback_blocks.InstantiateFunctionGauge(
+      metrics, Bind(GetArenaHugePageFallbackBlocks)));
+}
+
 class FunctorGC : public GarbageCollector {
  public:
   explicit FunctorGC(std::function<void(size_t)> impl) : impl_(std::move(impl)) {}
@@ -108,7 +191,8 @@ class FunctorGC : public GarbageCollector {
 
 class LRUCacheGC : public GarbageCollector {
  public:
-  explicit LRUCacheGC(std::shared_ptr<rocksdb::Cache> cache) : cache_(std::move(cache)) {}
+  explicit LRUCacheGC(std::shared_ptr<rocksdb::Cache> cache, const char* name = "table cache")
+      : cache_(std::move(cache)), name_(name) {}
 
   void CollectGarbage(size_t required) override {
     if (!FLAGS_enable_block_based_table_cache_gc) {
@@ -116,13 +200,14 @@ class LRUCacheGC : public GarbageCollector {
     }
 
     auto evicted = cache_->Evict(required);
-    LOG(INFO) << "Evicted from table cache: " << HumanReadableNumBytes::ToString(evicted)
+    LOG(INFO) << "Evicted from " << name_ << ": " << HumanReadableNumBytes::ToString(evicted)
               << ", new usage: " << HumanReadableNumBytes::ToString(cache_->GetUsage())
               << ", required: " << HumanReadableNumBytes::ToString(required);
   }
 
  private:
   std::shared_ptr<rocksdb::Cache> cache_;
+  const char* name_;
 };
 
 // Evaluates the target block cache size based on the db_block_cache_size_percentage and
@@ -158,6 +243,28 @@ size_t GetLogCacheSize(tablet::TabletPeer* peer) {
   return consensus_result.get()->LogCacheSize();
 }
 
+size_t GetGlobalMemstoreSizeBytes() {
+  // Calculate memstore_size_bytes based on total RAM available and global percentage.
+  CHECK(FLAGS_global_memstore_size_percentage > 0 && FLAGS_global_memstore_size_percentage <= 100)
+    << Substitute(
+        "Flag tablet_block_cache_size_percentage must be between 0 and 100. Current value: "
+        "$0",
+        FLAGS_global_memstore_size_percentage);
+  int64_t total_ram_avail = MemTracker::GetRootTracker()->limit();
+  size_t memstore_size_bytes = total_ram_avail * FLAGS_global_memstore_size_percentage / 100;
+
+  if (FLAGS_global_memstore_size_mb_max != 0) {
+    memstore_size_bytes = std::min(memstore_size_bytes,
+                                   static_cast<size_t>(FLAGS_global_memstore_size_mb_max << 20));
+  }
+  return memstore_size_bytes;
+}
+
+// Returns the minimal size the memory arbiter could shrink a pool of the specified size to.
+size_t MinArbitratedSize(size_t size) {
+  return size - size * std::clamp(FLAGS_memory_arbiter_max_shift_percentage, 0, 100) / 100;
+}
+
 int64 ComputeTabletOverheadLimit() {
   CHECK(0 <= FLAGS_tablet_overhead_size_percentage && FLAGS_tablet_overhead_size_percentage <= 100)
       << Format(
@@ -185,16 +292,24 @@ TabletMemoryManager::TabletMemoryManager(
   InitLogCacheGC();
   // Assign background_task_ if necessary.
   ConfigureBackgroundTask(options);
+  ConfigureMemoryArbiter(metrics, options);
+  RegisterArenaHugePageMetrics(metrics);
 }
 
 Status TabletMemoryManager::Init() {
   if (background_task_) {
     RETURN_NOT_OK(background_task_->Init());
   }
+  if (arbiter_task_) {
+    RETURN_NOT_OK(arbiter_task_->Init());
+  }
   return Status::OK();
 }
 
 void TabletMemoryManager::Shutdown() {
+  if (arbiter_task_) {
+    arbiter_task_->Shutdown();
+  }
   if (background_task_) {
     background_task_->Shutdown();
   }
@@ -220,18 +335,41 @@ void TabletMemoryManager::InitBlockCache(
     const int32_t default_block_cache_size_percentage,
     tablet::TabletOptions* options) {
   int64_t block_cache_size_bytes = GetTargetBlockCacheSize(default_block_cache_size_percentage);
+  int64_t block_cache_mem_limit = block_cache_size_bytes;
+  const bool use_compressed_block_cache =
+      block_cache_size_bytes != kDbCacheSizeCacheDisabled &&
+      FLAGS_db_compressed_block_cache_size_bytes > 0;
+  if (use_compressed_block_cache) {
+    // Blocks of both caches are tracked by the block based table trackers of the tablets.
+    block_cache_mem_limit += FLAGS_db_compressed_block_cache_size_bytes;
+  }
+  if (FLAGS_memory_arbiter_interval_ms > 0 && block_cache_size_bytes > 0) {
+    // Memory arbiter could grow the block cache using memory taken from the global memstore.
+    const auto memstore_size_bytes = GetGlobalMemstoreSizeBytes();
+    block_cache_mem_limit += memstore_size_bytes - MinArbitratedSize(memstore_size_bytes);
+  }
 
   block_based_table_mem_tracker_ = MemTracker::FindOrCreateTracker(
-      block_cache_size_bytes,
+      block_cache_mem_limit,
       "BlockBasedTable",
       server_mem_tracker_);
 
   if (block_cache_size_bytes != kDbCacheSizeCacheDisabled) {
-    options->block_cache = rocksdb::NewLRUCache(block_cache_size_bytes,
-                                                GetDbBlockCacheNumShardBits());
+    options->block_cache = FLAGS_db_block_cache_use_clock
+        ? rocksdb::NewClockCache(block_cache_size_bytes, GetDbBlockCacheNumShardBits())
+        : rocksdb::NewLRUCache(block_cache_size_bytes, GetDbBlockCacheNumShardBits());
     options->block_cache->SetMetrics(metrics);
     block_based_table_gc_ = std::make_shared<LRUCacheGC>(options->block_cache);
     block_based_table_mem_tracker_->AddGarbageCollector(block_based_table_gc_);
+    if (use_compressed_block_cache) {
+      options->compressed_block_cache = rocksdb::NewLRUCache(
+          FLAGS_db_compressed_block_cache_size_bytes, GetDbBlockCacheNumShardBits());
+      // Collectors are invoked in order, so compressed blocks are evicted only when evicting
+      // uncompressed ones did not free enough memory.
+      compressed_block_cache_gc_ = std::make_shared<LRUCacheGC>(
+          options->compressed_block_cache, "compressed block cache");
+      block_based_table_mem_tracker_->AddGarbageCollector(compressed_block_cache_gc_);
+    }
   }
 }
 
@@ -243,19 +381,7 @@ void TabletMemoryManager::InitLogCacheGC() {
 }
 
 void TabletMemoryManager::ConfigureBackgroundTask(tablet::TabletOptions* options) {
-  // Calculate memstore_size_bytes based on total RAM available and global percentage.
-  CHECK(FLAGS_global_memstore_size_percentage > 0 && FLAGS_global_memstore_size_percentage <= 100)
-    << Substitute(
-        "Flag tablet_block_cache_size_percentage must be between 0 and 100. Current value: "
-        "$0",
-        FLAGS_global_memstore_size_percentage);
-  int64_t total_ram_avail = MemTracker::GetRootTracker()->limit();
-  size_t memstore_size_bytes = total_ram_avail * FLAGS_global_memstore_size_percentage / 100;
-
-  if (FLAGS_global_memstore_size_mb_max != 0) {
-    memstore_size_bytes = std::min(memstore_size_bytes,
-                                   static_cast<size_t>(FLAGS_global_memstore_size_mb_max << 20));
-  }
+  size_t memstore_size_bytes = GetGlobalMemstoreSizeBytes();
 
   // Add memory monitor and background thread for flushing.
   // TODO(zhaoalex): replace task with Poller
@@ -272,6 +398,64 @@ void TabletMemoryManager::ConfigureBackgroundTask(tablet::TabletOptions* options
   memory_monitor_ = options->memory_monitor;
 }
 
+void TabletMemoryManager::ConfigureMemoryArbiter(
+    const scoped_refptr<MetricEntity>& metrics, tablet::TabletOptions* options) {
+  if (FLAGS_memory_arbiter_interval_ms <= 0 || !options->block_cache || !metrics ||
+      memory_monitor_->limit() == 0) {
+    return;
+  }
+  block_cache_ = options->block_cache;
+  block_cache_misses_ = METRIC_block_cache_misses.Instantiate(metrics);
+  last_block_cache_misses_ = block_cache_misses_->value();
+  block_cache_min_size_ = MinArbitratedSize(block_cache_->GetCapacity());
+  memstore_min_size_ = MinArbitratedSize(memory_monitor_->limit());
+  arbiter_step_base_ = block_cache_->GetCapacity() + memory_monitor_->limit();
+
+  arbiter_task_ = std::make_unique<BackgroundTask>(
+      std::function<void()>([this]() { ArbitrateMemory(); }),
+      "tablet manager",
+      "memory arbiter bgtask",
+      std::chrono::milliseconds(FLAGS_memory_arbiter_interval_ms));
+}
+
+void TabletMemoryManager::ArbitrateMemory() {
+  const auto misses = block_cache_misses_->value();
+  const uint64_t read_bytes =
+      (misses - std::exchange(last_block_cache_misses_, misses)) * FLAGS_db_block_size_bytes;
+  const uint64_t flushed_bytes = limit_flushed_bytes_.exchange(0);
+  const size_t step = arbiter_step_base_ * FLAGS_memory_arbiter_step_percentage / 100;
+  const size_t block_cache_size = block_cache_->GetCapacity();
+  const size_t memstore_size = memory_monitor_->limit();
+
+  // Move memory only when one pool is clearly under more pressure than the other, so the split
+  // does not oscillate under a balanced workload. The shrinking pool is resized first.
+  if (read_bytes > 2 * flushed_bytes) {
+    const auto delta = std::min(step, memstore_size - std::min(memstore_size, memstore_min_size_));
+    if (delta == 0) {
+      return;
+    }
+    memory_monitor_->SetLimit(memstore_size - delta);
+    block_cache_->SetCapacity(block_cache_size + delta);
+  } else if (flushed_bytes > 2 * read_bytes) {
+    const auto delta = std::min(
+        step, block_cache_size - std::min(block_cache_size, block_cache_min_size_));
+    if (delta == 0) {
+      return;
+    }
+    block_cache_->SetCapacity(block_cache_size - delta);
+    memory_monitor_->SetLimit(memstore_size + delta);
+  } else {
+    return;
+  }
+
+  LOG(INFO) << "Memory arbiter, read on cache miss: " << HumanReadableNumBytes::ToString(read_bytes)
+            << ", flushed on memstore limit: " << HumanReadableNumBytes::ToString(flushed_bytes)
+            << ", block cache size: "
+            << HumanReadableNumBytes::ToString(block_cache_->GetCapacity())
+            << ", global memstore size: "
+            << HumanReadableNumBytes::ToString(memory_monitor_->limit());
+}
+
 void TabletMemoryManager::LogCacheGC(MemTracker* log_cache_mem_tracker, size_t bytes_to_evict) {
   if (!FLAGS_enable_log_cache_gc) {
     return;
@@ -331,10 +515,15 @@ void TabletMemoryManager::FlushTabletIfLimitExceeded() {
       // we will schedule a second flush, which will unnecessarily stall writes for a short time.
       // This will not happen often, but should be fixed.
       if (tablet_to_flush) {
+        const auto memstore_size = tablet_to_flush->MutableMemtablesSize();
         LOG(INFO)
             << LogPrefix(peer_to_flush)
             << "Flushing tablet with oldest memstore write at "
-            << tablet_to_flush->OldestMutableMemtableWriteHybridTime();
+            << tablet_to_flush->OldestMutableMemtableWriteHybridTime()
+            << ", memstore size: " << memstore_size;
+        if (memstore_size.ok()) {
+          limit_flushed_bytes_.fetch_add(*memstore_size, std::memory_order_relaxed);
+        }
         WARN_NOT_OK(
             tablet_to_flush->Flush(
                 tablet::FlushMode::kAsync, tablet::FlushFlags::kAllDbs, flush_tick),
@@ -348,19 +537,34 @@ void TabletMemoryManager::FlushTabletIfLimitExceeded() {
 }
 
 // Return the tablet with the oldest write in memstore, or nullptr if all tablet memstores are
-// empty or about to flush.
+// empty or about to flush. Tablets with memstores smaller than memstore_flush_min_tablet_bytes
+// are only considered when no other tablet has data in memstore.
 tablet::TabletPeerPtr TabletMemoryManager::TabletToFlush() {
+  const auto min_tablet_bytes = FLAGS_memstore_flush_min_tablet_bytes;
   HybridTime oldest_write_in_memstores = HybridTime::kMax;
   tablet::TabletPeerPtr tablet_to_flush;
+  HybridTime oldest_write_in_small_memstores = HybridTime::kMax;
+  tablet::TabletPeerPtr small_tablet_to_flush;
   for (const tablet::TabletPeerPtr& peer : peers_fn_()) {
     const auto tablet = peer->shared_tablet();
     if (tablet) {
       const auto ht = tablet->OldestMutableMemtableWriteHybridTime();
       if (ht.ok()) {
-        if (*ht < oldest_write_in_memstores) {
-          oldest_write_in_memstores = *ht;
-          tablet_to_flush = peer;
+        if (*ht >= oldest_write_in_memstores) {
+          continue;
+        }
+        if (min_tablet_bytes) {
+          const auto size = tablet->MutableMemtablesSize();
+          if (size.ok() && *size < min_tablet_bytes) {
+            if (*ht < oldest_write_in_small_memstores) {
+              oldest_write_in_small_memstores = *ht;
+              small_tablet_to_flush = peer;
+            }
+            continue;
+          }
         }
+        oldest_write_in_memstores = *ht;
+        tablet_to_flush = peer;
       } else {
         YB_LOG_EVERY_N_SECS(WARNING, 5) << Format(
             "Failed to get oldest mutable memtable write ht for tablet $0: $1",
@@ -368,7 +572,7 @@ tablet::TabletPeerPtr TabletMemoryManager::TabletToFlush() {
       }
     }
   }
-  return tablet_to_flush;
+  return tablet_to_flush ? tablet_to_flush : small_tablet_to_flush;
 }
 
 std::string TabletMemoryManager::LogPrefix(const tablet::TabletPeerPtr& peer) const {
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include <boost/optional.hpp>
@@ -21,6 +22,7 @@
 
 #include "yb/util/background_task.h"
 #include "yb/util/mem_tracker.h"
+#include "yb/util/metrics_fwd.h"
 
 namespace yb {
 namespace tserver {
@@ -83,11 +85,21 @@ class TabletMemoryManager {
   // shared memstore limit.
   void ConfigureBackgroundTask(tablet::TabletOptions* options);
 
+  // Initializes the background thread that periodically moves memory between the block cache and
+  // the global memstore, if enabled by memory_arbiter_interval_ms.
+  void ConfigureMemoryArbiter(
+      const scoped_refptr<MetricEntity>& metrics, tablet::TabletOptions* options);
+
+  // Grows the block cache or the global memstore at the expense of the other one, depending on
+  // which of them caused more IO since the previous run.
+  void ArbitrateMemory();
+
   // Log cache garbage collection function bound to the memory tracker.
   void LogCacheGC(MemTracker* log_cache_mem_tracker, size_t bytes_to_evict);
 
-  // Determines which tablet has the oldest mutable memtable write time.  May return a null ptr
-  // if no tablet meets the criteria.  Uses peers_fn_ to determine the full list of peers to check.
+  // Determines which tablet has the oldest mutable memtable write time, preferring tablets with at
+  // least memstore_flush_min_tablet_bytes in memtables.  May return a null ptr if no tablet meets
+  // the criteria.  Uses peers_fn_ to determine the full list of peers to check.
   tablet::TabletPeerPtr TabletToFlush();
 
   // Function to return a log prefix with the tablet's tablet_id and permanent_uuid.
@@ -101,11 +113,23 @@ class TabletMemoryManager {
   std::shared_ptr<MemTracker> tablets_overhead_mem_tracker_;
 
   std::shared_ptr<GarbageCollector> block_based_table_gc_;
+  std::shared_ptr<GarbageCollector> compressed_block_cache_gc_;
   std::shared_ptr<GarbageCollector> log_cache_gc_;
 
   std::unique_ptr<BackgroundTask> background_task_;
 
   std::shared_ptr<rocksdb::MemoryMonitor> memory_monitor_;
+
+  // Memory arbiter state, used only when arbiter_task_ is set.
+  std::unique_ptr<BackgroundTask> arbiter_task_;
+  std::shared_ptr<rocksdb::Cache> block_cache_;
+  scoped_refptr<Counter> block_cache_misses_;
+  int64_t last_block_cache_misses_ = 0;
+  size_t block_cache_min_size_ = 0;
+  size_t memstore_min_size_ = 0;
+  size_t arbiter_step_base_ = 0;
+  // Bytes in memtables flushed because of the global memstore limit, since the last arbiter run.
+  std::atomic<uint64_t> limit_flushed_bytes_{0};
 };
 
 // Evaluates the number of bits used to shard the block cache depending on the number of cores.
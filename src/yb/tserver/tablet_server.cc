@@ -36,6 +36,7 @@
 #include <limits>
 #include <list>
 #include <thread>
+#include <unordered_map>
 
 #include "yb/client/auto_flags_manager.h"
 #include "yb/client/client.h"
@@ -602,7 +603,8 @@ Status TabletServer::RegisterServices() {
   RETURN_NOT_OK(RegisterService(FLAGS_ts_admin_svc_queue_length, std::move(admin_service)));
 
   auto consensus_service = std::make_shared<ConsensusServiceImpl>(
-      metric_entity(), tablet_manager_.get());
+      metric_entity(), tablet_manager_.get(),
+      &messenger()->ThreadPool(rpc::ServicePriority::kHigh));
   LOG(INFO) << "yb::tserver::ConsensusServiceImpl created at " << consensus_service.get();
   RETURN_NOT_OK(RegisterService(FLAGS_ts_consensus_svc_queue_length,
                                 std::move(consensus_service),
@@ -704,13 +706,37 @@ void TabletServer::Shutdown() {
 }
 
 Status TabletServer::PopulateLiveTServers(const master::TSHeartbeatResponsePB& heartbeat_resp) {
-  std::lock_guard l(lock_);
-  // We reset the list each time, since we want to keep the tservers that are live from the
-  // master's perspective.
-  // TODO: In the future, we should enhance the logic here to keep track information retrieved
-  // from the master and compare it with information stored here. Based on this information, we
-  // can only send diff updates CQL clients about whether a node came up or went down.
-  live_tservers_.assign(heartbeat_resp.tservers().begin(), heartbeat_resp.tservers().end());
+  std::vector<std::string> restarted_tservers;
+  auto now = MonoTime::Now();
+  {
+    std::lock_guard l(lock_);
+    // Tablet server that registered with the new instance seqno was restarted, so its old process
+    // is definitely gone, and replicas led by it don't have to wait for missed heartbeats.
+    std::unordered_map<std::string, int64_t> old_instance_seqnos;
+    for (const auto& ts : live_tservers_) {
+      old_instance_seqnos.emplace(
+          ts.tserver_instance().permanent_uuid(), ts.tserver_instance().instance_seqno());
+    }
+    for (const auto& ts : heartbeat_resp.tservers()) {
+      const auto& instance = ts.tserver_instance();
+      auto it = old_instance_seqnos.find(instance.permanent_uuid());
+      if (it != old_instance_seqnos.end() && it->second < instance.instance_seqno()) {
+        restarted_tservers.push_back(instance.permanent_uuid());
+      }
+    }
+
+    // We reset the list each time, since we want to keep the tservers that are live from the
+    // master's perspective.
+    // TODO: In the future, we should enhance the logic here to keep track information retrieved
+    // from the master and compare it with information stored here. Based on this information, we
+    // can only send diff updates CQL clients about whether a node came up or went down.
+    live_tservers_.assign(heartbeat_resp.tservers().begin(), heartbeat_resp.tservers().end());
+  }
+  for (const auto& ts_uuid : restarted_tservers) {
+    if (ts_uuid != permanent_uuid()) {
+      tablet_manager_->HandleTServerCrash(ts_uuid, now);
+    }
+  }
   return Status::OK();
 }
 
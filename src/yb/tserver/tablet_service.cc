@@ -45,6 +45,7 @@
 #include "yb/common/schema_pbutil.h"
 #include "yb/common/row_mark.h"
 #include "yb/common/schema.h"
+#include "yb/common/wire_protocol.h"
 #include "yb/consensus/leader_lease.h"
 #include "yb/consensus/consensus.pb.h"
 #include "yb/consensus/consensus_util.h"
@@ -77,10 +78,12 @@
 #include "yb/tablet/operations/update_txn_operation.h"
 #include "yb/tablet/operations/write_operation.h"
 #include "yb/tablet/read_result.h"
+#include "yb/tablet/request_origin_tracker.h"
 #include "yb/tablet/tablet.h"
 #include "yb/tablet/tablet_bootstrap_if.h"
 #include "yb/tablet/tablet_metadata.h"
 #include "yb/tablet/tablet_metrics.h"
+#include "yb/tablet/transaction_coordinator.h"
 #include "yb/tablet/transaction_participant.h"
 #include "yb/tablet/write_query.h"
 
@@ -221,6 +224,12 @@ DEFINE_test_flag(bool, txn_status_moved_rpc_force_fail, false,
 DEFINE_test_flag(int32, txn_status_moved_rpc_handle_delay_ms, 0,
                  "Inject delay to slowdown handling of updates in transaction status location.");
 
+DEFINE_test_flag(int32, update_transactions_delay_ms, 0,
+                 "Inject delay to slowdown handling of batched transaction heartbeats.");
+
+DEFINE_test_flag(bool, fail_first_apply_transactions_request, false,
+                 "Fail the first request of each ApplyTransactions batch.");
+
 METRIC_DEFINE_gauge_uint64(server, ts_split_op_added, "Split OPs Added to Leader",
                            yb::MetricUnit::kOperations,
                            "Number of split operations added to the leader's Raft log.");
@@ -1123,6 +1132,141 @@ void TabletServiceImpl::UpdateTransaction(const UpdateTransactionRequestPB* req,
   }
 }
 
+void TabletServiceImpl::UpdateTransactions(const UpdateTransactionsRequestPB* req,
+                                           UpdateTransactionsResponsePB* resp,
+                                           rpc::RpcContext context) {
+  TRACE("UpdateTransactions");
+
+  VLOG(2) << "UpdateTransactions: " << req->tablet_id() << ", " << req->states_size()
+          << " states, context: " << context.ToString();
+  UpdateClock(*req, server_->Clock());
+
+  if (PREDICT_FALSE(FLAGS_TEST_update_transactions_delay_ms > 0)) {
+    std::this_thread::sleep_for(FLAGS_TEST_update_transactions_delay_ms * 1ms);
+  }
+
+  auto tablet = LookupLeaderTabletOrRespond(
+      server_->tablet_peer_lookup(), req->tablet_id(), resp, &context);
+  if (!tablet) {
+    return;
+  }
+
+  auto* coordinator = tablet.tablet->transaction_coordinator();
+  if (!coordinator) {
+    SetupErrorAndRespond(
+        resp->mutable_error(),
+        STATUS(InvalidArgument, "Does not have transaction coordinator to process heartbeats"),
+        &context);
+    return;
+  }
+  for (const auto& state : req->states()) {
+    if (state.status() != TransactionStatus::PENDING) {
+      SetupErrorAndRespond(
+          resp->mutable_error(),
+          STATUS_FORMAT(InvalidArgument, "Unexpected status in batch: $0",
+                        TransactionStatus_Name(state.status())),
+          &context);
+      return;
+    }
+  }
+
+  if (req->states().empty()) {
+    resp->set_propagated_hybrid_time(server_->Clock()->Now().ToUint64());
+    context.RespondSuccess();
+    return;
+  }
+
+  // Statuses are preallocated, so each operation fills its own entry, and the last completed
+  // operation sends the response.
+  for (int i = 0; i != req->states_size(); ++i) {
+    resp->add_statuses();
+  }
+  auto context_ptr = std::make_shared<rpc::RpcContext>(std::move(context));
+  auto num_pending = std::make_shared<std::atomic<int>>(req->states_size());
+  std::vector<std::unique_ptr<tablet::UpdateTxnOperation>> operations;
+  operations.reserve(req->states_size());
+  for (int i = 0; i != req->states_size(); ++i) {
+    auto operation = std::make_unique<tablet::UpdateTxnOperation>(tablet.tablet);
+    operation->AllocateRequest()->CopyFrom(req->states(i));
+    operation->set_completion_callback(
+        [resp, i, num_pending, context_ptr, clock = server_->Clock()](const Status& status) {
+      StatusToPB(status, resp->mutable_statuses(i));
+      if (num_pending->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        resp->set_propagated_hybrid_time(clock->Now().ToUint64());
+        context_ptr->RespondSuccess();
+      }
+    });
+    operations.push_back(std::move(operation));
+  }
+  coordinator->Handle(std::move(operations), tablet.leader_term);
+}
+
+void TabletServiceImpl::ApplyTransactions(const ApplyTransactionsRequestPB* req,
+                                          ApplyTransactionsResponsePB* resp,
+                                          rpc::RpcContext context) {
+  TRACE("ApplyTransactions");
+
+  VLOG(2) << "ApplyTransactions: " << req->requests_size() << " requests, context: "
+          << context.ToString();
+  UpdateClock(*req, server_->Clock());
+
+  for (const auto& request : req->requests()) {
+    if (request.state().status() != TransactionStatus::APPLYING) {
+      SetupErrorAndRespond(
+          resp->mutable_error(),
+          STATUS_FORMAT(InvalidArgument, "Unexpected status in batch: $0",
+                        TransactionStatus_Name(request.state().status())),
+          &context);
+      return;
+    }
+  }
+
+  if (req->requests().empty()) {
+    resp->set_propagated_hybrid_time(server_->Clock()->Now().ToUint64());
+    context.RespondSuccess();
+    return;
+  }
+
+  // Statuses are preallocated, so each request fills its own entry, and the last completed
+  // request sends the response.
+  for (int i = 0; i != req->requests_size(); ++i) {
+    resp->add_statuses();
+  }
+  auto context_ptr = std::make_shared<rpc::RpcContext>(std::move(context));
+  auto num_pending = std::make_shared<std::atomic<int>>(req->requests_size());
+  auto complete = [resp, num_pending, context_ptr, clock = server_->Clock()](
+      int idx, const Status& status) {
+    StatusToPB(status, resp->mutable_statuses(idx));
+    if (num_pending->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      resp->set_propagated_hybrid_time(clock->Now().ToUint64());
+      context_ptr->RespondSuccess();
+    }
+  };
+  for (int i = 0; i != req->requests_size(); ++i) {
+    if (PREDICT_FALSE(FLAGS_TEST_fail_first_apply_transactions_request) && i == 0) {
+      complete(i, STATUS(IllegalState, "Injected failure of apply request"));
+      continue;
+    }
+    const auto& request = req->requests(i);
+    auto tablet = LookupLeaderTablet(server_->tablet_peer_lookup(), request.tablet_id());
+    if (!tablet.ok()) {
+      complete(i, tablet.status());
+      continue;
+    }
+    auto* participant = tablet->tablet->transaction_participant();
+    if (!participant) {
+      complete(i, STATUS(InvalidArgument, "Does not have transaction participant to apply"));
+      continue;
+    }
+    auto operation = std::make_unique<tablet::UpdateTxnOperation>(tablet->tablet);
+    operation->AllocateRequest()->CopyFrom(request.state());
+    operation->set_completion_callback([complete, i](const Status& status) {
+      complete(i, status);
+    });
+    participant->Handle(std::move(operation), tablet->leader_term);
+  }
+}
+
 template <class Req, class Resp, class Action>
 void TabletServiceImpl::PerformAtLeader(
     const Req& req, Resp* resp, rpc::RpcContext* context, const Action& action) {
@@ -1981,6 +2125,11 @@ Status TabletServiceImpl::PerformWrite(
         TabletServerError(TabletServerErrorPB::TABLET_NOT_FOUND));
   }
 
+  auto& request_origin_tracker = tablet.tablet->request_origin_tracker();
+  if (request_origin_tracker.RecordRequest()) {
+    request_origin_tracker.AddOrigin(context->remote_address().address().to_string());
+  }
+
 #if defined(DUMP_WRITE)
   if (req->has_write_batch() && req->write_batch().has_transaction()) {
     VLOG(1) << "Write with transaction: " << req->write_batch().transaction().ShortDebugString();
@@ -2109,9 +2258,11 @@ void TabletServiceImpl::Read(const ReadRequestPB* req,
 }
 
 ConsensusServiceImpl::ConsensusServiceImpl(const scoped_refptr<MetricEntity>& metric_entity,
-                                           TabletPeerLookupIf* tablet_manager)
+                                           TabletPeerLookupIf* tablet_manager,
+                                           rpc::ThreadPool* update_thread_pool)
     : ConsensusServiceIf(metric_entity),
-      tablet_manager_(tablet_manager) {
+      tablet_manager_(tablet_manager),
+      update_thread_pool_(update_thread_pool) {
 }
 
 ConsensusServiceImpl::~ConsensusServiceImpl() {
@@ -2127,61 +2278,113 @@ void ConsensusServiceImpl::CompleteUpdateConsensusResponse(
   resp->set_propagated_hybrid_time(tablet_peer->clock().Now().ToUint64());
 }
 
+namespace {
+
+// Appends ops sent in RPC sidecars to ops of the request.
+Status AddOpsFromSidecars(const rpc::RpcContext& context, consensus::LWConsensusRequestPB* req) {
+  for (uint32_t i = 0; i != req->num_sidecar_ops(); ++i) {
+    auto sidecar = VERIFY_RESULT(context.ExtractSidecar(req->ops_sidecars_start() + i));
+    auto* op = req->arena().NewObject<consensus::LWReplicateMsg>(&req->arena());
+    RETURN_NOT_OK(op->ParseFromSlice(sidecar.AsSlice()));
+    req->mutable_ops()->push_back_ref(op);
+  }
+  return Status::OK();
+}
+
+} // namespace
+
 void ConsensusServiceImpl::MultiRaftUpdateConsensus(
-      const consensus::MultiRaftConsensusRequestPB *req,
-      consensus::MultiRaftConsensusResponsePB *resp,
+      const consensus::LWMultiRaftConsensusRequestPB* req,
+      consensus::LWMultiRaftConsensusResponsePB* resp,
       rpc::RpcContext context) {
-    DVLOG(3) << "Received Batch Consensus Update RPC: " << req->ShortDebugString();
-    // Effectively performs ConsensusServiceImpl::UpdateConsensus for
-    // each ConsensusRequestPB in the batch but does not fail the entire
-    // batch if a single request fails.
-    for (int i = 0; i < req->consensus_request_size(); i++) {
-      // Unfortunately, we have to use const_cast here,
-      // because the protobuf-generated interface only gives us a const request
-      // but we need to be able to move messages out of the request for efficiency.
-      auto consensus_req = const_cast<ConsensusRequestPB*>(&req->consensus_request(i));
-      auto consensus_resp = resp->add_consensus_response();;
-
-      auto uuid_match_res = CheckUuidMatch(tablet_manager_, "UpdateConsensus", consensus_req,
-                                           context.requestor_string());
-      if (!uuid_match_res.ok()) {
-        SetupError(consensus_resp->mutable_error(), uuid_match_res.status());
-        continue;
-      }
+  DVLOG(3) << "Received Batch Consensus Update RPC: " << req->ShortDebugString();
+  // Effectively performs ConsensusServiceImpl::UpdateConsensus for
+  // each ConsensusRequestPB in the batch but does not fail the entire
+  // batch if a single request fails.
+  // Unfortunately, we have to use const_cast here, because the generated interface only gives
+  // us a const request, but we need to be able to move messages out of the request for
+  // efficiency.
+  auto* mutable_req = const_cast<consensus::LWMultiRaftConsensusRequestPB*>(req);
+  std::vector<std::pair<consensus::LWConsensusRequestPB*, consensus::LWConsensusResponsePB*>>
+      updates;
+  updates.reserve(mutable_req->consensus_request().size());
+  for (auto& consensus_req : *mutable_req->mutable_consensus_request()) {
+    updates.emplace_back(&consensus_req, resp->add_consensus_response());
+  }
 
-      auto peer_tablet_res = LookupTabletPeer(tablet_manager_, consensus_req->tablet_id());
-      if (!peer_tablet_res.ok()) {
-        SetupError(consensus_resp->mutable_error(), peer_tablet_res.status());
-        continue;
-      }
-      auto tablet_peer = peer_tablet_res.get().tablet_peer;
+  if (!update_thread_pool_ || updates.size() <= 1) {
+    for (const auto& [consensus_req, consensus_resp] : updates) {
+      UpdateConsensusInBatch(context, consensus_req, consensus_resp);
+    }
+    context.RespondSuccess();
+    return;
+  }
 
-      // Submit the update directly to the TabletPeer's Consensus instance.
-      auto consensus_res = GetConsensus(tablet_peer);
-      if (!consensus_res.ok()) {
-        SetupError(consensus_resp->mutable_error(), consensus_res.status());
-        continue;
-      }
-      auto consensus = *consensus_res;
-
-      // TODO(lw_uc) effective update for multiraft.
-      auto temp_resp = rpc::MakeSharedMessage<consensus::LWConsensusResponsePB>();
-      Status s = consensus->Update(
-         rpc::CopySharedMessage(*consensus_req),
-         temp_resp.get(), context.GetClientDeadline());
-      if (PREDICT_FALSE(!s.ok())) {
-        // Clear the response first, since a partially-filled response could
-        // result in confusing a caller, or in having missing required fields
-        // in embedded optional messages.
-        consensus_resp->Clear();
-        SetupError(consensus_resp->mutable_error(), s);
-        continue;
-      }
+  // Update of a tablet with ops waits until they are appended to its log. Updates of different
+  // tablets are processed concurrently, like separate RPCs would be, so the latency of a tablet
+  // does not include log waits of other tablets of the batch.
+  struct BatchState {
+    BatchState(rpc::RpcContext context_, size_t num_updates)
+        : context(std::move(context_)), remaining(num_updates) {}
 
-      CompleteUpdateConsensusResponse(tablet_peer, temp_resp.get());
-      temp_resp->ToGoogleProtobuf(consensus_resp);
+    rpc::RpcContext context;
+    std::atomic<size_t> remaining;
+  };
+  auto state = std::make_shared<BatchState>(std::move(context), updates.size());
+  auto process = [this, state](
+      consensus::LWConsensusRequestPB* consensus_req,
+      consensus::LWConsensusResponsePB* consensus_resp) {
+    UpdateConsensusInBatch(state->context, consensus_req, consensus_resp);
+    if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      state->context.RespondSuccess();
     }
-    context.RespondSuccess();
+  };
+  for (size_t i = 1; i != updates.size(); ++i) {
+    update_thread_pool_->EnqueueFunctor(
+        [process, update = updates[i]] { process(update.first, update.second); });
+  }
+  process(updates[0].first, updates[0].second);
+}
+
+void ConsensusServiceImpl::UpdateConsensusInBatch(
+    const rpc::RpcContext& context, consensus::LWConsensusRequestPB* consensus_req,
+    consensus::LWConsensusResponsePB* consensus_resp) {
+  auto uuid_match_res = CheckUuidMatch(tablet_manager_, "UpdateConsensus", consensus_req,
+                                       context.requestor_string());
+  if (!uuid_match_res.ok()) {
+    SetupError(consensus_resp->mutable_error(), uuid_match_res.status());
+    return;
+  }
+
+  auto peer_tablet_res = LookupTabletPeer(tablet_manager_, consensus_req->tablet_id());
+  if (!peer_tablet_res.ok()) {
+    SetupError(consensus_resp->mutable_error(), peer_tablet_res.status());
+    return;
+  }
+  auto tablet_peer = peer_tablet_res.get().tablet_peer;
+
+  // Submit the update directly to the TabletPeer's Consensus instance.
+  auto consensus_res = GetConsensus(tablet_peer);
+  if (!consensus_res.ok()) {
+    SetupError(consensus_resp->mutable_error(), consensus_res.status());
+    return;
+  }
+  auto consensus = *consensus_res;
+
+  // The request is shared with the RPC call params, so ops are not copied.
+  Status s = consensus->Update(
+      rpc::SharedField(context.shared_params(), consensus_req),
+      consensus_resp, context.GetClientDeadline());
+  if (PREDICT_FALSE(!s.ok())) {
+    // Clear the response first, since a partially-filled response could
+    // result in confusing a caller, or in having missing required fields
+    // in embedded optional messages.
+    consensus_resp->Clear();
+    SetupError(consensus_resp->mutable_error(), s);
+    return;
+  }
+
+  CompleteUpdateConsensusResponse(tablet_peer, consensus_resp);
 }
 
 void ConsensusServiceImpl::UpdateConsensus(const consensus::LWConsensusRequestPB* req,
@@ -2202,9 +2405,13 @@ void ConsensusServiceImpl::UpdateConsensus(const consensus::LWConsensusRequestPB
   // Unfortunately, we have to use const_cast here, because the protobuf-generated interface only
   // gives us a const request, but we need to be able to move messages out of the request for
   // efficiency.
-  Status s = consensus->Update(
-      rpc::SharedField(context.shared_params(), const_cast<consensus::LWConsensusRequestPB*>(req)),
-      resp, context.GetClientDeadline());
+  auto* mutable_req = const_cast<consensus::LWConsensusRequestPB*>(req);
+  Status s = AddOpsFromSidecars(context, mutable_req);
+  if (s.ok()) {
+    s = consensus->Update(
+        rpc::SharedField(context.shared_params(), mutable_req), resp,
+        context.GetClientDeadline());
+  }
   if (PREDICT_FALSE(!s.ok())) {
     // Clear the response first, since a partially-filled response could
     // result in confusing a caller, or in having missing required fields
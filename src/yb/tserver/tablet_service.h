@@ -133,6 +133,14 @@ class TabletServiceImpl : public TabletServerServiceIf, public ReadTabletProvide
                         AbortTransactionResponsePB* resp,
                         rpc::RpcContext context) override;
 
+  void UpdateTransactions(const UpdateTransactionsRequestPB* req,
+                          UpdateTransactionsResponsePB* resp,
+                          rpc::RpcContext context) override;
+
+  void ApplyTransactions(const ApplyTransactionsRequestPB* req,
+                         ApplyTransactionsResponsePB* resp,
+                         rpc::RpcContext context) override;
+
   void UpdateTransactionStatusLocation(const UpdateTransactionStatusLocationRequestPB* req,
                                        UpdateTransactionStatusLocationResponsePB* resp,
                                        rpc::RpcContext context) override;
@@ -327,8 +335,11 @@ class TabletServiceAdminImpl : public TabletServerAdminServiceIf {
 
 class ConsensusServiceImpl : public consensus::ConsensusServiceIf {
  public:
+  // When update_thread_pool is specified, updates of different tablets received in a single
+  // multi-Raft batch are processed concurrently on it.
   ConsensusServiceImpl(const scoped_refptr<MetricEntity>& metric_entity,
-                       TabletPeerLookupIf* tablet_manager_);
+                       TabletPeerLookupIf* tablet_manager_,
+                       rpc::ThreadPool* update_thread_pool = nullptr);
 
   virtual ~ConsensusServiceImpl();
 
@@ -336,8 +347,8 @@ class ConsensusServiceImpl : public consensus::ConsensusServiceIf {
                        consensus::LWConsensusResponsePB *resp,
                        rpc::RpcContext context) override;
 
-  void MultiRaftUpdateConsensus(const consensus::MultiRaftConsensusRequestPB *req,
-                                consensus::MultiRaftConsensusResponsePB *resp,
+  void MultiRaftUpdateConsensus(const consensus::LWMultiRaftConsensusRequestPB* req,
+                                consensus::LWMultiRaftConsensusResponsePB* resp,
                                 rpc::RpcContext context) override;
 
   void RequestConsensusVote(const consensus::VoteRequestPB* req,
@@ -383,7 +394,14 @@ class ConsensusServiceImpl : public consensus::ConsensusServiceIf {
  private:
   void CompleteUpdateConsensusResponse(std::shared_ptr<tablet::TabletPeer> tablet_peer,
                                        consensus::LWConsensusResponsePB* resp);
+
+  // Processes a single update of a multi-Raft batch, errors are reported in consensus_resp.
+  void UpdateConsensusInBatch(
+      const rpc::RpcContext& context, consensus::LWConsensusRequestPB* consensus_req,
+      consensus::LWConsensusResponsePB* consensus_resp);
+
   TabletPeerLookupIf* tablet_manager_;
+  rpc::ThreadPool* const update_thread_pool_;
 };
 
 }  // namespace tserver
@@ -34,6 +34,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -51,6 +52,7 @@
 #include "yb/common/wire_protocol.h"
 
 #include "yb/consensus/consensus.h"
+#include "yb/consensus/consensus.pb.h"
 #include "yb/consensus/multi_raft_batcher.h"
 #include "yb/consensus/consensus_meta.h"
 #include "yb/consensus/log.h"
@@ -75,6 +77,7 @@
 #include "yb/master/master_heartbeat.pb.h"
 #include "yb/master/sys_catalog.h"
 
+#include "yb/rocksdb/rate_limiter.h"
 #include "yb/rocksdb/util/task_metrics.h"
 
 #include "yb/rpc/messenger.h"
@@ -82,6 +85,7 @@
 
 #include "yb/tablet/metadata.pb.h"
 #include "yb/tablet/operations/split_operation.h"
+#include "yb/tablet/request_origin_tracker.h"
 #include "yb/tablet/tablet.h"
 #include "yb/tablet/tablet.pb.h"
 #include "yb/tablet/tablet_bootstrap_if.h"
@@ -127,6 +131,12 @@ DEFINE_NON_RUNTIME_int32(num_tablets_to_open_simultaneously, 0,
              "may make sense to manually tune this.");
 TAG_FLAG(num_tablets_to_open_simultaneously, advanced);
 
+DEFINE_NON_RUNTIME_int32(num_tablets_to_open_simultaneously_per_data_dir, 8,
+             "Number of threads per data directory available to open tablets during startup, "
+             "used when num_tablets_to_open_simultaneously is 0. The total number of bootstrap "
+             "threads is also limited by the number of CPUs.");
+TAG_FLAG(num_tablets_to_open_simultaneously_per_data_dir, advanced);
+
 DEFINE_NON_RUNTIME_int32(num_open_tablets_metadata_simultaneously, 0,
              "Number of threads available to open tablets' metadata during startup. If this "
              "is set to 0 (the default), then the number of open metadata threads will "
@@ -218,6 +228,19 @@ DEFINE_UNKNOWN_int32(cleanup_metrics_interval_sec, 60,
              "The tick interval time for the metrics cleanup background task. "
              "If set to 0, it disables the background task.");
 
+DEFINE_NON_RUNTIME_int32(tablet_hibernation_idle_sec, 0,
+    "Tablets that were not accessed and did not replicate any operations for this number of "
+    "seconds are hibernated: their memtables are flushed and their log cache is released. "
+    "A hibernated tablet wakes up on the first request. 0 disables hibernation.");
+TAG_FLAG(tablet_hibernation_idle_sec, advanced);
+
+DEFINE_NON_RUNTIME_int32(tablet_request_origin_window_sec, 60,
+    "Duration of the window used to detect the dominant origin of requests to tablet leaders. "
+    "See tablet_request_origin_sampling_interval.");
+TAG_FLAG(tablet_request_origin_window_sec, advanced);
+
+DECLARE_uint32(tablet_request_origin_sampling_interval);
+
 DEFINE_UNKNOWN_int32(send_wait_for_report_interval_ms, 60000,
              "The tick interval time to trigger updating all transaction coordinators with wait-for"
              " relationships.");
@@ -250,6 +273,19 @@ DEFINE_NON_RUNTIME_int32(full_compaction_pool_max_queue_size, 500,
              "on a scheduled basis or after they have been split and still contain irrelevant data "
              "from the tablet they were sourced from.");
 
+DEFINE_NON_RUNTIME_int32(parallel_scan_pool_max_threads, -1,
+             "The maximum number of threads allowed for parallel_scan_pool_. This pool is used "
+             "to scan key ranges of a single tablet in parallel. -1 means the number of CPUs.");
+
+DEFINE_NON_RUNTIME_int32(scan_read_pool_max_threads, 0,
+             "The maximum number of threads allowed for scan_read_pool_. When positive, reads "
+             "classified as scans (aggregates, sampling and reads without key restriction) are "
+             "executed in this pool instead of RPC service threads, so long scans do not delay "
+             "point reads. 0 disables the pool.");
+DEFINE_NON_RUNTIME_int32(scan_read_pool_max_queue_size, 128,
+             "The maximum number of scans that can wait in the queue of scan_read_pool_. Scans "
+             "over this limit are rejected as ServiceUnavailable and retried by the client.");
+
 DEFINE_NON_RUNTIME_int32(scheduled_full_compaction_check_interval_min, 15,
              "DEPRECATED. Use auto_compact_check_interval_sec.");
 
@@ -259,6 +295,11 @@ DEFINE_test_flag(int32, sleep_after_tombstoning_tablet_secs, 0,
 DEFINE_UNKNOWN_bool(enable_restart_transaction_status_tablets_first, true,
             "Set to true to prioritize bootstrapping transaction status tablets first.");
 
+DEFINE_NON_RUNTIME_bool(enable_restart_former_leader_tablets_first, true,
+    "Set to true to bootstrap tablets, that were probably leaders before restart, before other "
+    "user tablets. A tablet is considered a former leader if this server voted for itself in the "
+    "last term known to it.");
+
 DEFINE_RUNTIME_int32(bg_superblock_flush_interval_secs, 60,
     "The interval at which tablet superblocks are flushed to disk (if dirty) by a background "
     "thread. Applicable only when lazily_flush_superblock is enabled. 0 indicates that the "
@@ -274,6 +315,17 @@ DEFINE_UNKNOWN_int32(flush_retryable_requests_pool_max_threads, -1,
 DEFINE_test_flag(bool, disable_flush_on_shutdown, false,
                  "Whether to disable flushing memtable on shutdown.");
 
+DEFINE_RUNTIME_bool(persist_clean_shutdown_op_id, false,
+    "On tablet server shutdown, flush tablets that have applied all their operations and record "
+    "the last operation in the tablet superblock. Bootstrap of such tablets does not replay the "
+    "WAL.");
+
+DEFINE_NON_RUNTIME_int64(intents_cleanup_rate_limit_bytes_per_sec, 0,
+                         "Limits the rate of intents removal of aborted and cleaned up "
+                         "transactions by all tablets of the tablet server, in bytes of removed "
+                         "keys per second. Removal of intents of applied transactions is not "
+                         "limited. 0 means unlimited.");
+
 DECLARE_bool(enable_wait_queues);
 DECLARE_bool(disable_deadlock_detection);
 DECLARE_bool(lazily_flush_superblock);
@@ -347,6 +399,12 @@ THREAD_POOL_METRICS_DEFINE(server, admin_triggered_compaction_pool,
 THREAD_POOL_METRICS_DEFINE(server, full_compaction_pool,
     "Thread pool for tserver-triggered full compaction jobs.");
 
+THREAD_POOL_METRICS_DEFINE(server, parallel_scan_pool,
+    "Thread pool for scanning key ranges of a single tablet in parallel.");
+
+THREAD_POOL_METRICS_DEFINE(server, scan_read_pool,
+    "Thread pool for reads classified as scans.");
+
 THREAD_POOL_METRICS_DEFINE(
     server, waiting_txn_pool,
     "Thread pool for wait queue to resume waiting transactions and also for forwarding wait-for "
@@ -399,6 +457,16 @@ std::string SnapshotIdToString(const std::string& snapshot_id) {
   return uuid.IsNil() ? snapshot_id : uuid.ToString();
 }
 
+// Leader role is not persisted, so a tablet is considered a former leader when this server voted
+// for itself in the last term known to it.
+bool WasLeaderBeforeRestart(FsManager* fs_manager, const TabletId& tablet_id) {
+  std::unique_ptr<consensus::ConsensusMetadata> cmeta;
+  if (!consensus::ConsensusMetadata::Load(fs_manager, tablet_id, fs_manager->uuid(), &cmeta).ok()) {
+    return false;
+  }
+  return cmeta->has_voted_for() && cmeta->voted_for() == fs_manager->uuid();
+}
+
 } // namespace
 
 void TSTabletManager::VerifyTabletData() {
@@ -430,6 +498,118 @@ void TSTabletManager::CleanupOldMetrics() {
   metric_registry_->RetireOldMetrics();
 }
 
+void TSTabletManager::HibernateIdleTablets() {
+  const auto idle_since = CoarseMonoClock::now() - FLAGS_tablet_hibernation_idle_sec * 1s;
+  size_t num_hibernated = 0;
+  for (const auto& peer : GetTabletPeers()) {
+    if (peer->state() != RUNNING || !peer->TryHibernate(idle_since)) {
+      continue;
+    }
+    ++num_hibernated;
+    auto tablet = peer->shared_tablet_safe();
+    if (tablet.ok() && *tablet) {
+      auto oldest_write = (*tablet)->OldestMutableMemtableWriteHybridTime();
+      if (oldest_write.ok() && *oldest_write != HybridTime::kMax) {
+        WARN_NOT_OK((*tablet)->Flush(tablet::FlushMode::kAsync),
+                    Format("Failed to flush hibernated tablet $0", peer->tablet_id()));
+      }
+    }
+    auto consensus = peer->GetRaftConsensus();
+    if (consensus.ok()) {
+      (*consensus)->EvictLogCache(std::numeric_limits<size_t>::max());
+    }
+  }
+  if (num_hibernated) {
+    LOG_WITH_PREFIX(INFO) << "Hibernated " << num_hibernated << " idle tablets";
+  }
+}
+
+void TSTabletManager::HandleTServerCrash(const std::string& ts_uuid, MonoTime restart_seen_at) {
+  LOG_WITH_PREFIX(INFO) << "Tablet server " << ts_uuid << " was restarted";
+  for (const auto& peer : GetTabletPeers()) {
+    auto consensus = peer->GetRaftConsensus();
+    if (consensus.ok()) {
+      (*consensus)->HandlePeerCrash(ts_uuid, restart_seen_at);
+    }
+  }
+}
+
+namespace {
+
+// Returns true if the host is one of the addresses of the peer.
+bool PeerHasHost(const consensus::RaftPeerPB& peer, const std::string& host) {
+  for (const auto* addrs : {&peer.last_known_private_addr(), &peer.last_known_broadcast_addr()}) {
+    for (const auto& addr : *addrs) {
+      if (addr.host() == host) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+bool SameRegion(const CloudInfoPB& lhs, const CloudInfoPB& rhs) {
+  return lhs.placement_cloud() == rhs.placement_cloud() &&
+         lhs.placement_region() == rhs.placement_region();
+}
+
+} // namespace
+
+void TSTabletManager::MoveLeadersToRequestOrigins() {
+  if (FLAGS_tablet_request_origin_sampling_interval == 0) {
+    return;
+  }
+  for (const auto& peer : GetTabletPeers()) {
+    if (peer->state() != RUNNING) {
+      continue;
+    }
+    auto tablet = peer->shared_tablet();
+    if (!tablet) {
+      continue;
+    }
+    auto origin = tablet->request_origin_tracker().TakeDominantOrigin();
+    if (origin.empty()) {
+      continue;
+    }
+    auto consensus = peer->GetRaftConsensus();
+    if (!consensus.ok() ||
+        (*consensus)->GetLeaderStatus() != consensus::LeaderStatus::LEADER_AND_READY) {
+      continue;
+    }
+
+    // Move the leader only to a voter in another region, that runs on the host which sent most of
+    // the requests.
+    auto config = (*consensus)->CommittedConfig();
+    const consensus::RaftPeerPB* local_peer = nullptr;
+    const consensus::RaftPeerPB* origin_peer = nullptr;
+    for (const auto& config_peer : config.peers()) {
+      if (config_peer.permanent_uuid() == peer->permanent_uuid()) {
+        local_peer = &config_peer;
+      } else if (config_peer.member_type() == consensus::PeerMemberType::VOTER &&
+                 PeerHasHost(config_peer, origin)) {
+        origin_peer = &config_peer;
+      }
+    }
+    if (!local_peer || !origin_peer ||
+        SameRegion(local_peer->cloud_info(), origin_peer->cloud_info())) {
+      continue;
+    }
+
+    LOG_WITH_PREFIX(INFO)
+        << "Moving leader of " << peer->tablet_id() << " to " << origin_peer->permanent_uuid()
+        << ", most requests come from " << origin;
+    consensus::LeaderStepDownRequestPB req;
+    req.set_tablet_id(peer->tablet_id());
+    req.set_new_leader_uuid(origin_peer->permanent_uuid());
+    consensus::LeaderStepDownResponsePB resp;
+    auto status = (*consensus)->StepDown(&req, &resp);
+    if (status.ok() && resp.has_error()) {
+      status = StatusFromPB(resp.error().status());
+    }
+    WARN_NOT_OK(status, Format("Failed to move leader of $0", peer->tablet_id()));
+  }
+}
+
 void TSTabletManager::PollWaitingTxnRegistry() {
   DCHECK_NOTNULL(waiting_txn_registry_)->SendWaitForGraph();
 }
@@ -510,6 +690,20 @@ TSTabletManager::TSTabletManager(FsManager* fs_manager,
               .set_metrics(THREAD_POOL_METRICS_INSTANCE(
                   server_->metric_entity(), full_compaction_pool))
               .Build(&full_compaction_pool_));
+  CHECK_OK(ThreadPoolBuilder("parallel-scan")
+              .set_max_threads(FLAGS_parallel_scan_pool_max_threads < 0
+                                   ? base::NumCPUs() : FLAGS_parallel_scan_pool_max_threads)
+              .set_metrics(THREAD_POOL_METRICS_INSTANCE(
+                  server_->metric_entity(), parallel_scan_pool))
+              .Build(&parallel_scan_pool_));
+  if (FLAGS_scan_read_pool_max_threads > 0) {
+    CHECK_OK(ThreadPoolBuilder("scan-read")
+                .set_max_threads(FLAGS_scan_read_pool_max_threads)
+                .set_max_queue_size(FLAGS_scan_read_pool_max_queue_size)
+                .set_metrics(THREAD_POOL_METRICS_INSTANCE(
+                    server_->metric_entity(), scan_read_pool))
+                .Build(&scan_read_pool_));
+  }
   CHECK_OK(ThreadPoolBuilder("wait-queue")
               .set_min_threads(1)
               .unlimited_threads()
@@ -550,6 +744,10 @@ Status TSTabletManager::Init() {
   if (docdb::GetRocksDBRateLimiterSharingMode() == docdb::RateLimiterSharingMode::TSERVER) {
     tablet_options_.rate_limiter = docdb::CreateRocksDBRateLimiter();
   }
+  if (FLAGS_intents_cleanup_rate_limit_bytes_per_sec > 0) {
+    tablet_options_.intents_cleanup_rate_limiter.reset(
+        rocksdb::NewGenericRateLimiter(FLAGS_intents_cleanup_rate_limit_bytes_per_sec));
+  }
 
   // Start the threadpool we'll use to open tablets.
   // This has to be done in Init() instead of the constructor, since the
@@ -561,7 +759,9 @@ Status TSTabletManager::Init() {
       max_bootstrap_threads = 2;
     } else {
       max_bootstrap_threads = min(
-          num_cpus - 1, narrow_cast<int>(fs_manager_->GetDataRootDirs().size()) * 8);
+          num_cpus - 1,
+          narrow_cast<int>(fs_manager_->GetDataRootDirs().size()) *
+              std::max(FLAGS_num_tablets_to_open_simultaneously_per_data_dir, 1));
     }
     LOG_WITH_PREFIX(INFO) <<  "max_bootstrap_threads=" << max_bootstrap_threads;
   }
@@ -596,6 +796,9 @@ Status TSTabletManager::Init() {
     std::mutex ready_metas_mutex;
     std::mutex non_ready_metas_mutex;
     std::deque<RaftGroupMetadataPtr> ready_metas GUARDED_BY(ready_metas_mutex);
+    // Number of transaction status tablets at the front of ready_metas.
+    size_t num_transaction_status_metas GUARDED_BY(ready_metas_mutex) = 0;
+    std::vector<RaftGroupMetadataPtr> former_leader_metas GUARDED_BY(ready_metas_mutex);
     std::vector<RaftGroupMetadataPtr> non_ready_metas GUARDED_BY(non_ready_metas_mutex);
   };
 
@@ -627,6 +830,13 @@ Status TSTabletManager::Init() {
         // Prioritize bootstrapping transaction status tablets first.
         std::lock_guard lock(metas.ready_metas_mutex);
         metas.ready_metas.push_front(meta);
+        ++metas.num_transaction_status_metas;
+      } else if (FLAGS_enable_restart_former_leader_tablets_first &&
+                 WasLeaderBeforeRestart(fs_manager_, tablet_id)) {
+        // Leaders could not be elected before their former leader is bootstrapped or the leader
+        // lease expires, so bootstrapping them first makes the tablets available sooner.
+        std::lock_guard lock(metas.ready_metas_mutex);
+        metas.former_leader_metas.push_back(meta);
       } else {
         std::lock_guard lock(metas.ready_metas_mutex);
         metas.ready_metas.push_back(meta);
@@ -646,6 +856,13 @@ Status TSTabletManager::Init() {
   // Now submit the "Open" task for each.
   {
     std::lock_guard lock(metas.ready_metas_mutex);
+    if (!metas.former_leader_metas.empty()) {
+      LOG(INFO) << "Bootstrapping " << metas.former_leader_metas.size()
+                << " former leader tablets first";
+      metas.ready_metas.insert(
+          metas.ready_metas.begin() + metas.num_transaction_status_metas,
+          metas.former_leader_metas.begin(), metas.former_leader_metas.end());
+    }
     for (const RaftGroupMetadataPtr& meta : metas.ready_metas) {
       RegisterDataAndWalDir(
           fs_manager_, meta->table_id(), meta->raft_group_id(), meta->data_root_dir(),
@@ -704,6 +921,12 @@ Status TSTabletManager::Init() {
   waiting_txn_registry_poller_ = std::make_unique<rpc::Poller>(
       LogPrefix(), std::bind(&TSTabletManager::PollWaitingTxnRegistry, this));
 
+  hibernation_poller_ = std::make_unique<rpc::Poller>(
+      LogPrefix(), std::bind(&TSTabletManager::HibernateIdleTablets, this));
+
+  leader_placement_poller_ = std::make_unique<rpc::Poller>(
+      LogPrefix(), std::bind(&TSTabletManager::MoveLeadersToRequestOrigins, this));
+
   return Status::OK();
 }
 
@@ -775,6 +998,19 @@ Status TSTabletManager::Start() {
         << "Old metrics cleanup is disabled by cleanup_metrics_interval_sec flag set to 0";
   }
 
+  if (FLAGS_tablet_hibernation_idle_sec > 0) {
+    // Poll several times per idle period, so tablets are hibernated soon after becoming idle.
+    hibernation_poller_->Start(
+        &server_->messenger()->scheduler(),
+        std::max(FLAGS_tablet_hibernation_idle_sec / 4, 1) * 1s);
+    LOG(INFO) << "Idle tablets hibernation task started...";
+  }
+
+  if (FLAGS_tablet_request_origin_window_sec > 0) {
+    leader_placement_poller_->Start(
+        &server_->messenger()->scheduler(), FLAGS_tablet_request_origin_window_sec * 1s);
+  }
+
   if (waiting_txn_registry_) {
     waiting_txn_registry_poller_->Start(
         &server_->messenger()->scheduler(), FLAGS_send_wait_for_report_interval_ms * 1ms);
@@ -1728,6 +1964,7 @@ void TSTabletManager::OpenTablet(const RaftGroupMetadataPtr& meta,
         .wait_queue_pool = waiting_txn_pool_.get(),
         .full_compaction_pool = full_compaction_pool(),
         .admin_triggered_compaction_pool = admin_triggered_compaction_pool(),
+        .parallel_scan_pool = parallel_scan_pool(),
         .post_split_compaction_added = ts_post_split_compaction_added_,
         .metadata_cache = metadata_cache,
         .get_min_xcluster_schema_version =
@@ -1808,6 +2045,7 @@ void TSTabletManager::OpenTablet(const RaftGroupMetadataPtr& meta,
   }
 
   tablet->TriggerPostSplitCompactionIfNeeded();
+  tablet->TriggerInterruptedFullCompactionIfNeeded();
 
   if (tablet->ShouldDisableLbMove()) {
     std::lock_guard lock(mutex_);
@@ -1882,6 +2120,10 @@ void TSTabletManager::StartShutdown() {
 
   waiting_txn_registry_poller_->Shutdown();
 
+  hibernation_poller_->Shutdown();
+
+  leader_placement_poller_->Shutdown();
+
   mem_manager_->Shutdown();
 
   full_compaction_manager_->Shutdown();
@@ -1914,7 +2156,8 @@ void TSTabletManager::CompleteShutdown() {
   for (const TabletPeerPtr& peer : shutting_down_peers_) {
     peer->CompleteShutdown(
         tablet::DisableFlushOnShutdown(FLAGS_TEST_disable_flush_on_shutdown),
-        tablet::AbortOps::kFalse);
+        tablet::AbortOps::kFalse,
+        tablet::PersistCleanShutdown(GetAtomicFlag(&FLAGS_persist_clean_shutdown_op_id)));
   }
 
   // Shut down the apply pool.
@@ -1947,6 +2190,12 @@ void TSTabletManager::CompleteShutdown() {
   if (waiting_txn_pool_) {
     waiting_txn_pool_->Shutdown();
   }
+  if (parallel_scan_pool_) {
+    parallel_scan_pool_->Shutdown();
+  }
+  if (scan_read_pool_) {
+    scan_read_pool_->Shutdown();
+  }
 
   {
     std::lock_guard l(mutex_);
@@ -175,6 +175,8 @@ class TSTabletManager : public tserver::TabletPeerLookupIf, public tablet::Table
     return admin_triggered_compaction_pool_.get();
   }
   ThreadPool* waiting_txn_pool() const { return waiting_txn_pool_.get(); }
+  ThreadPool* parallel_scan_pool() const { return parallel_scan_pool_.get(); }
+  ThreadPool* scan_read_pool() const { return scan_read_pool_.get(); }
   ThreadPool* flush_retryable_requests_pool() const { return flush_retryable_requests_pool_.get(); }
 
   // Create a new tablet and register it with the tablet manager. The new tablet
@@ -295,6 +297,10 @@ class TSTabletManager : public tserver::TabletPeerLookupIf, public tablet::Table
   void GetTabletPeersUnlocked(TabletPeers* tablet_peers) const REQUIRES_SHARED(mutex_);
   void PreserveLocalLeadersOnly(std::vector<const TabletId*>* tablet_ids) const;
 
+  // Notifies tablet peers that the process of the tablet server ts_uuid was restarted, so the
+  // replicas led by it could start elections right away.
+  void HandleTServerCrash(const std::string& ts_uuid, MonoTime restart_seen_at);
+
   // Get TabletPeers for all status tablets hosted on this server.
   TabletPeers GetStatusTabletPeers();
 
@@ -370,6 +376,13 @@ class TSTabletManager : public tserver::TabletPeerLookupIf, public tablet::Table
   // Background task that Retires old metrics.
   void CleanupOldMetrics();
 
+  // Background task that flushes memtables and releases log cache of idle tablets.
+  void HibernateIdleTablets();
+
+  // Background task that moves tablet leaders to replicas in the region that most of the requests
+  // to the tablet come from.
+  void MoveLeadersToRequestOrigins();
+
   client::YBClient& client();
 
   const std::shared_future<client::YBClient*>& client_future();
@@ -693,6 +706,12 @@ class TSTabletManager : public tserver::TabletPeerLookupIf, public tablet::Table
 
   std::unique_ptr<ThreadPool> waiting_txn_pool_;
 
+  // Thread pool for scanning key ranges of a single tablet in parallel.
+  std::unique_ptr<ThreadPool> parallel_scan_pool_;
+
+  // Thread pool for reads classified as scans, nullptr if disabled by scan_read_pool_max_threads.
+  std::unique_ptr<ThreadPool> scan_read_pool_;
+
   std::unique_ptr<rpc::Poller> tablets_cleaner_;
 
   // Used for verifying tablet data integrity.
@@ -705,6 +724,12 @@ class TSTabletManager : public tserver::TabletPeerLookupIf, public tablet::Table
 
   std::unique_ptr<rpc::Poller> waiting_txn_registry_poller_;
 
+  // Used for hibernating idle tablets.
+  std::unique_ptr<rpc::Poller> hibernation_poller_;
+
+  // Used for moving tablet leaders to the origins of requests.
+  std::unique_ptr<rpc::Poller> leader_placement_poller_;
+
   // For block cache and memory monitor shared across tablets
   tablet::TabletOptions tablet_options_;
 
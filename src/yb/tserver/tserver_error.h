@@ -65,5 +65,18 @@ struct TabletServerDelayTag : IntegralBackedErrorTag<MonoDeltaTraits> {
 
 typedef StatusErrorCodeImpl<TabletServerDelayTag> TabletServerDelay;
 
+// UUID of the peer that this peer believes to be the leader of the tablet. Attached to
+// NOT_THE_LEADER errors, so the client could retry on the leader without a master lookup.
+struct TabletServerLeaderHintTag : StringBackedErrorTag {
+  // This category id is part of the wire protocol and should not be changed once released.
+  static constexpr uint8_t kCategory = 24;
+
+  static std::string ToMessage(const Value& value) {
+    return Format("Leader hint: $0", value);
+  }
+};
+
+typedef StatusErrorCodeImpl<TabletServerLeaderHintTag> TabletServerLeaderHint;
+
 } // namespace tserver
 } // namespace yb
@@ -20,6 +20,7 @@
 
 #include "yb/master/master_heartbeat.pb.h"
 
+#include "yb/tablet/key_access_sampler.h"
 #include "yb/tablet/tablet.h"
 #include "yb/tablet/tablet_metadata.h"
 #include "yb/tablet/tablet_peer.h"
@@ -93,6 +94,9 @@ void TServerMetricsHeartbeatDataProvider::DoAddData(
           storage_metadata->set_uncompressed_sst_file_size(sizes.second);
           storage_metadata->set_may_have_orphaned_post_split_data(
                 tablet->MayHaveOrphanedPostSplitData());
+          auto& key_access_sampler = tablet->key_access_sampler();
+          storage_metadata->set_key_accesses_per_sec(key_access_sampler.AccessesPerSecond());
+          storage_metadata->set_is_hot(key_access_sampler.IsHot());
           if (FLAGS_tserver_heartbeat_metrics_add_leader_info) {
             auto consensus_result = tablet_peer->GetRaftConsensus();
             if (consensus_result) {
@@ -13,6 +13,7 @@
 
 #include "yb/tserver/tserver_shared_mem.h"
 
+#include <algorithm>
 #include <atomic>
 #include <mutex>
 
@@ -25,8 +26,17 @@
 #include "yb/util/flags.h"
 #include "yb/util/path_util.h"
 #include "yb/util/result.h"
+#include "yb/util/size_literals.h"
 #include "yb/util/thread.h"
 
+using namespace yb::size_literals;
+
+DEFINE_NON_RUNTIME_uint64(pg_client_shared_memory_size, 1_MB,
+    "Size of the shared memory region used to exchange requests and responses between a YSQL "
+    "backend and the local tserver. Requests and responses that do not fit into this region are "
+    "transferred using RPC. Rounded up to the page size.");
+TAG_FLAG(pg_client_shared_memory_size, advanced);
+
 DEFINE_test_flag(bool, skip_remove_tserver_shared_memory_object, false,
                  "Skip remove tserver shared memory object in tests.");
 
@@ -150,6 +160,14 @@ class SharedExchangeHeader {
   std::byte data_[0];
 };
 
+size_t RegionSize() {
+  // Pages of the region are allocated on first access, so a large region costs nothing for
+  // sessions that exchange small messages only.
+  const size_t page_size = boost::interprocess::mapped_region::get_page_size();
+  const size_t size = std::max<size_t>(FLAGS_pg_client_shared_memory_size, page_size);
+  return (size + page_size - 1) / page_size * page_size;
+}
+
 std::string MakeSharedMemoryPrefix(const std::string& instance_id) {
   return Format("yb_pg_$0_", instance_id);
 }
@@ -169,7 +187,7 @@ class SharedExchange::Impl {
         shared_memory_object_(type, MakeSharedMemoryName(instance_id, session_id).c_str(),
                               boost::interprocess::read_write) {
     if (owner_) {
-      shared_memory_object_.truncate(boost::interprocess::mapped_region::get_page_size());
+      shared_memory_object_.truncate(RegionSize());
     }
     mapped_region_ = boost::interprocess::mapped_region(
         shared_memory_object_, boost::interprocess::read_write);
@@ -54,6 +54,10 @@ DECLARE_int32(cdc_write_rpc_timeout_ms);
 DEFINE_RUNTIME_bool(cdc_force_remote_tserver, false,
     "Avoid local tserver apply optimization for xCluster and force remote RPCs.");
 
+DEFINE_RUNTIME_uint32(xcluster_apply_max_parallel_writes, 16,
+    "Max number of write RPCs applying a single batch of replicated changes that are sent to "
+    "different consumer tablets in parallel.");
+
 DEFINE_RUNTIME_bool(xcluster_enable_packed_rows_support, true,
     "Enables rewriting of packed rows with xcluster consumer schema version");
 TAG_FLAG(xcluster_enable_packed_rows_support, advanced);
@@ -177,6 +181,7 @@ void XClusterOutputClient::ApplyChanges(std::shared_ptr<cdc::GetChangesResponseP
   {
     ACQUIRE_MUTEX_IF_ONLINE_ELSE_RETURN;
     DCHECK(consensus::OpIdEquals(op_id_, consensus::MinimumOpId()));
+    DCHECK_EQ(num_in_flight_writes_, 0);
     op_id_ = poller_resp->checkpoint().op_id();
     error_status_ = Status::OK();
     done_processing_ = false;
@@ -263,19 +268,39 @@ Status XClusterOutputClient::ProcessChangesStartingFromIndex(int start) {
 
 Status XClusterOutputClient::SendUserTableWrites() {
   // Send out the buffered writes.
-  std::unique_ptr<WriteRequestPB> write_request;
+  std::vector<std::unique_ptr<WriteRequestPB>> write_requests;
   {
     ACQUIRE_MUTEX_IF_ONLINE_ELSE_RETURN_STATUS;
-    write_request = write_strategy_->FetchNextRequest();
+    write_requests = FetchNextWriteRequests();
   }
-  if (!write_request) {
+  if (write_requests.empty()) {
     LOG(WARNING) << "Expected to find a write_request but were unable to";
     return STATUS(IllegalState, "Could not find a write request to send");
   }
-  SendNextCDCWriteToTablet(std::move(write_request));
+  for (auto& write_request : write_requests) {
+    SendNextCDCWriteToTablet(std::move(write_request));
+  }
   return Status::OK();
 }
 
+std::vector<std::unique_ptr<WriteRequestPB>> XClusterOutputClient::FetchNextWriteRequests() {
+  // Each write request targets a different consumer tablet, and all records of a row are in the
+  // same request, so the requests could be applied in parallel without reordering changes of a
+  // row.
+  std::vector<std::unique_ptr<WriteRequestPB>> result;
+  const auto max_parallel_writes =
+      std::max<size_t>(FLAGS_xcluster_apply_max_parallel_writes, 1);
+  while (num_in_flight_writes_ < max_parallel_writes) {
+    auto write_request = write_strategy_->FetchNextRequest();
+    if (!write_request) {
+      break;
+    }
+    result.push_back(std::move(write_request));
+    ++num_in_flight_writes_;
+  }
+  return result;
+}
+
 bool XClusterOutputClient::UseLocalTserver() {
   return use_local_tserver_ && !FLAGS_cdc_force_remote_tserver;
 }
@@ -465,7 +490,6 @@ void XClusterOutputClient::SendNextCDCWriteToTablet(std::unique_ptr<WriteRequest
       Format("Rate limiting write request for tablet $0", write_request->tablet_id())) {
     rate_limiter_->Request(write_request->ByteSizeLong(), IOPriority::kHigh);
   };
-  // TODO: This should be parallelized for better performance with M:N setups.
   auto deadline =
       CoarseMonoClock::Now() + MonoDelta::FromMilliseconds(FLAGS_cdc_write_rpc_timeout_ms);
 
@@ -613,26 +637,44 @@ void XClusterOutputClient::DoSchemaVersionCheckDone(
 
 void XClusterOutputClient::DoWriteCDCRecordDone(
     const Status& status, const WriteResponsePB& response) {
-  if (!status.ok()) {
-    HandleError(status);
-    return;
-  } else if (response.has_error()) {
-    HandleError(StatusFromPB(response.error().status()));
-    return;
-  }
-
   // See if we need to handle any more writes.
-  std::unique_ptr<WriteRequestPB> write_request;
+  std::vector<std::unique_ptr<WriteRequestPB>> write_requests;
+  bool writes_in_flight = false;
+  Status write_status;
   {
     ACQUIRE_MUTEX_IF_ONLINE_ELSE_RETURN;
-    if (FLAGS_TEST_running_test) {
+    --num_in_flight_writes_;
+    if (!status.ok()) {
+      write_status = status;
+    } else if (response.has_error()) {
+      write_status = StatusFromPB(response.error().status());
+    } else if (FLAGS_TEST_running_test) {
       xcluster_poller_->TEST_IncrementNumSuccessfulWriteRpcs();
     }
-    write_request = write_strategy_->FetchNextRequest();
+    // Stop sending writes after the first failure, and report it once all in flight writes are
+    // done.
+    if (!write_status.ok() && write_error_.ok()) {
+      write_error_ = write_status;
+    }
+    if (write_error_.ok()) {
+      write_requests = FetchNextWriteRequests();
+    }
+    writes_in_flight = num_in_flight_writes_ > 0;
+    if (!writes_in_flight) {
+      write_status = std::move(write_error_);
+      write_error_ = Status::OK();
+    }
   }
 
-  if (write_request) {
+  for (auto& write_request : write_requests) {
     SendNextCDCWriteToTablet(std::move(write_request));
+  }
+  if (writes_in_flight) {
+    return;
+  }
+
+  if (!write_status.ok()) {
+    HandleError(write_status);
   } else {
     // We may still have more records to process (in case of ddls/master requests).
     int next_record = 0;
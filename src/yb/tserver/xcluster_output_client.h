@@ -106,6 +106,9 @@ class XClusterOutputClient : public XClusterAsyncExecutor {
 
   Status SendUserTableWrites();
 
+  // Fetches write requests that could be sent without exceeding the limit of parallel writes.
+  std::vector<std::unique_ptr<WriteRequestPB>> FetchNextWriteRequests() REQUIRES(lock_);
+
   void SendNextCDCWriteToTablet(std::unique_ptr<WriteRequestPB> write_request);
   void UpdateSchemaVersionMapping(tserver::GetCompatibleSchemaVersionRequestPB* req);
 
@@ -162,6 +165,9 @@ class XClusterOutputClient : public XClusterAsyncExecutor {
   yb::MonoDelta timeout_ms_;
 
   std::unique_ptr<XClusterWriteInterface> write_strategy_ GUARDED_BY(lock_);
+  size_t num_in_flight_writes_ GUARDED_BY(lock_) = 0;
+  // First error of the in flight writes, reported once all of them are done.
+  Status write_error_ GUARDED_BY(lock_);
 
   rocksdb::RateLimiter* rate_limiter_;
 };
@@ -46,6 +46,11 @@ DEFINE_RUNTIME_uint32(async_replication_max_idle_wait, 3,
     "Maximum number of consecutive empty GetChanges until the poller "
     "backs off to the idle interval, rather than immediately retrying.");
 
+DEFINE_RUNTIME_uint32(xcluster_get_changes_wait_ms, 0,
+    "When positive, the producer holds GetChanges requests for up to this time until new changes "
+    "are available, instead of the poller repeatedly polling an idle tablet. 0 disables "
+    "waiting.");
+
 DEFINE_RUNTIME_uint32(replication_failure_delay_exponent, 16 /* ~ 2^16/1000 ~= 65 sec */,
     "Max number of failures (N) to use when calculating exponential backoff (2^N-1).");
 
@@ -327,6 +332,10 @@ void XClusterPoller::DoPoll() {
   req.set_stream_id(producer_tablet_info_.stream_id.ToString());
   req.set_tablet_id(producer_tablet_info_.tablet_id);
   req.set_serve_as_proxy(GetAtomicFlag(&FLAGS_cdc_consumer_use_proxy_forwarding));
+  const auto wait_for_changes_ms = GetAtomicFlag(&FLAGS_xcluster_get_changes_wait_ms);
+  if (wait_for_changes_ms > 0) {
+    req.set_wait_for_changes_ms(wait_for_changes_ms);
+  }
 
   cdc::CDCCheckpointPB checkpoint;
   *checkpoint.mutable_op_id() = op_id_;
@@ -468,7 +477,11 @@ void XClusterPoller::HandleApplyChangesResponse(XClusterOutputClientResponse& re
 
     op_id_ = response.last_applied_op_id;
 
-    idle_polls_ = (response.processed_record_count == 0) ? idle_polls_ + 1 : 0;
+    // The producer already waited for new changes, so an empty response does not need backoff.
+    idle_polls_ = (response.processed_record_count == 0 &&
+                   !response.get_changes_response->waited_for_changes())
+                      ? idle_polls_ + 1
+                      : 0;
 
     if (validated_schema_version_ < response.wait_for_version) {
       LOG(WARNING) << "Pausing Poller since producer schema version " << response.wait_for_version
@@ -52,6 +52,7 @@
 #include "yb/util/random.h"
 #include "yb/util/random_util.h"
 #include "yb/util/path_util.h"
+#include "yb/util/size_literals.h"
 #include "yb/util/status.h"
 #include "yb/util/stopwatch.h"
 #include "yb/util/test_macros.h"
@@ -60,6 +61,8 @@
 
 DECLARE_int32(o_direct_block_size_bytes);
 DECLARE_bool(TEST_simulate_fs_without_fallocate);
+DECLARE_bool(use_io_uring_for_multi_read);
+DECLARE_uint32(io_uring_queue_depth);
 
 #if !defined(__APPLE__)
 #include <linux/falloc.h>
@@ -623,6 +626,42 @@ TEST_F(TestEnv, TestOpenEmptyRandomAccessFile) {
   ASSERT_EQ(0, size);
 }
 
+TEST_F(TestEnv, TestMultiRead) {
+  constexpr size_t kFileSize = 64_KB;
+  constexpr size_t kReadLength = 3000;
+  Env* env = Env::Default();
+  string test_file = JoinPathSegments(GetTestDataDirectory(), "test_file");
+  ASSERT_NO_FATALS(WriteTestFile(env, test_file, kFileSize));
+  std::unique_ptr<RandomAccessFile> readable_file;
+  ASSERT_OK(env->NewRandomAccessFile(test_file, &readable_file));
+
+  // Small queue depth to check that big batches are submitted in several rounds.
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_io_uring_queue_depth) = 4;
+  for (auto use_io_uring : {false, true}) {
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_use_io_uring_for_multi_read) = use_io_uring;
+    std::vector<uint64_t> offsets = {
+        0, 10000, 5, 32_KB, 20000, 7777, 50000, 1, kFileSize - 100, kFileSize};
+    std::vector<std::unique_ptr<uint8_t[]>> buffers;
+    std::vector<ReadRequest> requests;
+    for (auto offset : offsets) {
+      buffers.emplace_back(new uint8_t[kReadLength]);
+      requests.push_back(ReadRequest {
+        .offset = offset,
+        .length = kReadLength,
+        .scratch = buffers.back().get(),
+        .result = Slice(),
+      });
+    }
+    ASSERT_OK(readable_file->MultiRead(requests.data(), requests.size()));
+    for (const auto& request : requests) {
+      ASSERT_EQ(request.result.data(), request.scratch);
+      ASSERT_EQ(request.result.size(),
+                std::min<size_t>(kReadLength, kFileSize - request.offset));
+      ASSERT_NO_FATALS(VerifyTestData(request.result, request.offset));
+    }
+  }
+}
+
 TEST_F(TestEnv, TestOverwrite) {
   string test_path = GetTestPath("test_env_wf");
 
@@ -114,6 +114,10 @@ Status ReadFileToString(Env* env, const std::string& fname, faststring* data) {
   return s;
 }
 
+Status Env::SyncFileSystem(const std::string& path) {
+  return STATUS(NotSupported, "File system sync is not supported", path);
+}
+
 Status Env::GetChildren(const std::string& dir, std::vector<std::string>* result) {
   return GetChildren(dir, ExcludeDots::kFalse, result);
 }
@@ -292,6 +296,10 @@ Status EnvWrapper::SyncDir(const std::string& d) {
   return target_->SyncDir(d);
 }
 
+Status EnvWrapper::SyncFileSystem(const std::string& path) {
+  return target_->SyncFileSystem(path);
+}
+
 Status EnvWrapper::DeleteDir(const std::string& d) {
   return target_->DeleteDir(d);
 }
@@ -292,6 +292,10 @@ class Env {
   // Synchronize the entry for a specific directory.
   virtual Status SyncDir(const std::string& dirname) = 0;
 
+  // Synchronize all data and metadata of the file system containing the specified path.
+  // Returns NotSupported if the platform does not allow it.
+  virtual Status SyncFileSystem(const std::string& path);
+
   // Recursively delete the specified directory.
   // This should operate safely, not following any symlinks, etc.
   virtual Status DeleteRecursively(const std::string &dirname) = 0;
@@ -708,6 +712,7 @@ class EnvWrapper : public Env {
   Status DeleteFile(const std::string& f) override;
   Status CreateDir(const std::string& d) override;
   Status SyncDir(const std::string& d) override;
+  Status SyncFileSystem(const std::string& path) override;
   Status DeleteDir(const std::string& d) override;
   Status DeleteRecursively(const std::string& d) override;
   Result<uint64_t> GetFileSize(const std::string& f) override;
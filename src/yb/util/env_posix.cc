@@ -1110,6 +1110,25 @@ class PosixEnv : public Env {
     return Status::OK();
   }
 
+  Status SyncFileSystem(const std::string& path) override {
+#if defined(__linux__)
+    TRACE_EVENT1("io", "SyncFileSystem", "path", path);
+    ThreadRestrictions::AssertIOAllowed();
+    if (FLAGS_never_fsync) return Status::OK();
+    int fd;
+    if ((fd = open(path.c_str(), O_RDONLY)) == -1) {
+      return STATUS_IO_ERROR(path, errno);
+    }
+    ScopedFdCloser fd_closer(fd);
+    if (syncfs(fd) != 0) {
+      return STATUS_IO_ERROR(path, errno);
+    }
+    return Status::OK();
+#else
+    return Env::SyncFileSystem(path);
+#endif
+  }
+
   Status DeleteRecursively(const std::string &name) override {
     return Walk(name, POST_ORDER, std::bind(&PosixEnv::DeleteRecursivelyCb, this, _1, _2, _3));
   }
@@ -38,6 +38,14 @@ struct FileSystemOptions {
   // If true, then use mmap to write data
   bool use_mmap_writes = true;
 
+  // If true, then open files for read with O_DIRECT. Reads are aligned internally, so callers
+  // could read arbitrary ranges.
+  bool use_direct_reads = false;
+
+  // If true, then open files for write with O_DIRECT. Writer should use UseOSBuffer() == false
+  // mode and write aligned data with PositionedAppend.
+  bool use_direct_writes = false;
+
   // If false, fallocate() calls are bypassed
   bool allow_fallocate = true;
 
@@ -118,6 +126,15 @@ class ReadValidator {
   virtual ~ReadValidator() = default;
 };
 
+// Single read of the RandomAccessFile::MultiRead batch.
+struct ReadRequest {
+  uint64_t offset;
+  size_t length;
+  uint8_t* scratch;
+  // Filled by MultiRead, points to scratch and is shorter than length only at end of file.
+  Slice result;
+};
+
 // A file abstraction for randomly reading the contents of a file.
 class RandomAccessFile : public FileWithUniqueId {
  public:
@@ -136,6 +153,13 @@ class RandomAccessFile : public FileWithUniqueId {
   virtual Status Read(uint64_t offset, size_t n, Slice* result,
                               uint8_t *scratch) const = 0;
 
+  // Reads a batch of file ranges, equivalent to calling Read for each request, but gives the
+  // implementation a chance to submit all reads at once.
+  // Returns first error, results of other requests are undefined in this case.
+  //
+  // Safe for concurrent use by multiple threads.
+  virtual Status MultiRead(ReadRequest* requests, size_t num_requests) const;
+
   // Similar to Read, but uses the given callback to validate the result.
   virtual Status ReadAndValidate(
       uint64_t offset, size_t n, Slice* result, char* scratch, const ReadValidator& validator);
@@ -180,6 +204,10 @@ class RandomAccessFile : public FileWithUniqueId {
 
   virtual void Hint(AccessPattern pattern) {}
 
+  // Asynchronously loads the specified range of the file into OS page cache, so subsequent reads
+  // of this range will not block on IO. Noop if not supported by the file.
+  virtual void Prefetch(uint64_t offset, size_t length) {}
+
   // Remove any kind of caching of data from the offset to offset+length
   // of this file. If the length is 0, then it refers to the end of file.
   // If the system is not caching the file contents, then this is a noop.
@@ -195,6 +223,7 @@ namespace rocksdb {
 using yb::FileWithUniqueId;
 using yb::Status;
 using yb::IOPriority;
+using yb::ReadRequest;
 
 // A file abstraction for sequential writing.  The implementation
 // must provide buffering since callers may append small fragments
@@ -367,6 +396,9 @@ class RandomAccessFileWrapper : public RandomAccessFile {
 
   Status Read(uint64_t offset, size_t n, Slice* result, uint8_t* scratch) const override;
 
+  // MultiRead is not forwarded, so wrappers that transform data in Read (e.g. encryption) keep
+  // working through the default implementation.
+
   Result<uint64_t> Size() const override;
 
   Result<uint64_t> INode() const override;
@@ -391,6 +423,10 @@ class RandomAccessFileWrapper : public RandomAccessFile {
 
   void Hint(AccessPattern pattern) override { return target_->Hint(pattern); }
 
+  void Prefetch(uint64_t offset, size_t length) override {
+    return target_->Prefetch(offset, length);
+  }
+
   Status InvalidateCache(size_t offset, size_t length) override;
 
  private:
@@ -19,18 +19,23 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <algorithm>
+
 #ifdef __linux__
 #include <linux/fs.h>
 #include <sys/statfs.h>
 #include <sys/syscall.h>
 #endif // __linux__
 
+#include "yb/util/alignment.h"
 #include "yb/util/coding.h"
 #include "yb/util/debug/trace_event.h"
 #include "yb/util/errno.h"
+#include "yb/util/io_uring.h"
 #include "yb/util/malloc.h"
 #include "yb/util/result.h"
 #include "yb/util/stats/iostats_context_imp.h"
+#include "yb/util/status_format.h"
 #include "yb/util/test_kill.h"
 #include "yb/util/thread_restrictions.h"
 
@@ -65,7 +70,19 @@ DEFINE_RUNTIME_uint64(rocksdb_check_sst_file_tail_for_zeros, 0,
     "if flag value is zero.");
 TAG_FLAG(rocksdb_check_sst_file_tail_for_zeros, advanced);
 
+DEFINE_RUNTIME_bool(use_io_uring_for_multi_read, false,
+    "Submit batched file reads (RandomAccessFile::MultiRead) with a single io_uring system call "
+    "instead of issuing pread for each of them. Falls back to pread when io_uring is not "
+    "supported by the kernel.");
+TAG_FLAG(use_io_uring_for_multi_read, advanced);
+
+DEFINE_NON_RUNTIME_uint32(io_uring_queue_depth, 64,
+    "Number of submission queue entries of io_uring instances, which are created per thread on "
+    "first batched read. Larger batches are submitted in several rounds.");
+TAG_FLAG(io_uring_queue_depth, advanced);
+
 DECLARE_bool(never_fsync);
+DECLARE_int32(o_direct_block_alignment_bytes);
 
 namespace {
 
@@ -169,7 +186,8 @@ Status PosixSequentialFile::InvalidateCache(size_t offset, size_t length) {
 
 PosixRandomAccessFile::PosixRandomAccessFile(const std::string& fname, int fd,
                                              const FileSystemOptions& options)
-    : filename_(fname), fd_(fd), use_os_buffer_(options.use_os_buffer) {
+    : filename_(fname), fd_(fd), use_os_buffer_(options.use_os_buffer),
+      direct_io_(options.use_direct_reads) {
   assert(!options.use_mmap_reads || sizeof(void*) < 8);
 }
 
@@ -178,6 +196,9 @@ PosixRandomAccessFile::~PosixRandomAccessFile() { close(fd_); }
 Status PosixRandomAccessFile::Read(uint64_t offset, size_t n, Slice* result,
                                    uint8_t* scratch) const {
   ThreadRestrictions::AssertIOAllowed();
+  if (direct_io_) {
+    return ReadDirect(offset, n, result, scratch);
+  }
   Status s;
   ssize_t r = -1;
   size_t left = n;
@@ -209,6 +230,79 @@ Status PosixRandomAccessFile::Read(uint64_t offset, size_t n, Slice* result,
   return s;
 }
 
+Status PosixRandomAccessFile::ReadDirect(
+    uint64_t offset, size_t n, Slice* result, uint8_t* scratch) const {
+  const size_t alignment = FLAGS_o_direct_block_alignment_bytes;
+  const uint64_t aligned_offset = offset - offset % alignment;
+  const size_t skip = offset - aligned_offset;
+  const size_t aligned_size = align_up(skip + n, alignment);
+  void* buffer = nullptr;
+  if (posix_memalign(&buffer, alignment, aligned_size) != 0) {
+    return STATUS_FORMAT(
+        IOError, "Failed to allocate $0 bytes to read $1", aligned_size, filename_);
+  }
+  std::unique_ptr<uint8_t, decltype(&free)> buffer_holder(static_cast<uint8_t*>(buffer), &free);
+
+  size_t done = 0;
+  while (done < aligned_size) {
+    auto r = pread(fd_, buffer_holder.get() + done, aligned_size - done,
+                   static_cast<off_t>(aligned_offset + done));
+    if (r < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      *result = Slice(scratch, static_cast<size_t>(0));
+      return STATUS_IO_ERROR(filename_, errno);
+    }
+    if (r == 0) {
+      break;
+    }
+    done += r;
+  }
+
+  const size_t size = done > skip ? std::min(n, done - skip) : 0;
+  memcpy(scratch, buffer_holder.get() + skip, size);
+  *result = Slice(scratch, size);
+  return Status::OK();
+}
+
+Status PosixRandomAccessFile::MultiRead(ReadRequest* requests, size_t num_requests) const {
+  // io_uring reads are not aligned, so could not be used with O_DIRECT.
+  if (num_requests > 1 && !direct_io_ && FLAGS_use_io_uring_for_multi_read) {
+    auto* ring = IoUring::ThreadLocal(FLAGS_io_uring_queue_depth);
+    if (ring) {
+      ThreadRestrictions::AssertIOAllowed();
+      auto status = ring->Read(fd_, requests, num_requests);
+      if (status.ok()) {
+        return CompleteShortReads(requests, num_requests);
+      }
+      // Results are undefined after failure, so all requests are read again with pread, that also
+      // reports the error with file name.
+      VLOG(1) << "Batched read of " << filename_ << " with io_uring failed: " << status;
+    }
+  }
+  return RandomAccessFile::MultiRead(requests, num_requests);
+}
+
+Status PosixRandomAccessFile::CompleteShortReads(
+    ReadRequest* requests, size_t num_requests) const {
+  for (auto* request = requests; request != requests + num_requests; ++request) {
+    const auto done = request->result.size();
+    // Empty result means end of file.
+    if (done == 0 || done == request->length) {
+      continue;
+    }
+    Slice tail;
+    RETURN_NOT_OK(Read(
+        request->offset + done, request->length - done, &tail, request->scratch + done));
+    request->result = Slice(request->scratch, done + tail.size());
+  }
+  if (!use_os_buffer_) {
+    Fadvise(fd_, 0, 0, POSIX_FADV_DONTNEED);
+  }
+  return Status::OK();
+}
+
 Result<uint64_t> PosixRandomAccessFile::Size() const {
   TRACE_EVENT1("io", __PRETTY_FUNCTION__, "path", filename_);
   ThreadRestrictions::AssertIOAllowed();
@@ -262,6 +356,13 @@ void PosixRandomAccessFile::Hint(AccessPattern pattern) {
   }
 }
 
+void PosixRandomAccessFile::Prefetch(uint64_t offset, size_t length) {
+  // Pages are dropped from OS cache after every read when OS buffer is not used.
+  if (use_os_buffer_) {
+    Fadvise(fd_, offset, length, POSIX_FADV_WILLNEED);
+  }
+}
+
 Status PosixRandomAccessFile::InvalidateCache(size_t offset, size_t length) {
 #ifndef __linux__
   return Status::OK();
@@ -281,7 +382,7 @@ namespace rocksdb {
 
 PosixWritableFile::PosixWritableFile(const std::string& fname, int fd,
                                      const FileSystemOptions& options)
-    : filename_(fname), fd_(fd), filesize_(0) {
+    : filename_(fname), fd_(fd), filesize_(0), direct_io_(options.use_direct_writes) {
 #ifdef ROCKSDB_FALLOCATE_PRESENT
   allow_fallocate_ = options.allow_fallocate;
   fallocate_with_keep_size_ = options.fallocate_with_keep_size;
@@ -296,6 +397,10 @@ PosixWritableFile::~PosixWritableFile() {
 }
 
 Status PosixWritableFile::Append(const Slice& data) {
+  if (direct_io_) {
+    // Writes are not aligned, that happens when file is used through a wrapper, e.g. encrypted one.
+    RETURN_NOT_OK(DisableDirectIO());
+  }
   const char* src = data.cdata();
   size_t left = data.size();
   while (left != 0) {
@@ -313,7 +418,50 @@ Status PosixWritableFile::Append(const Slice& data) {
   return Status::OK();
 }
 
+Status PosixWritableFile::PositionedAppend(const Slice& data, uint64_t offset) {
+  DCHECK(direct_io_);
+  const char* src = data.cdata();
+  size_t left = data.size();
+  while (left != 0) {
+    ssize_t done = pwrite(fd_, src, left, static_cast<off_t>(offset));
+    if (done < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return STATUS_IO_ERROR(filename_, errno);
+    }
+    left -= done;
+    src += done;
+    offset += done;
+  }
+  filesize_ = std::max(filesize_, offset);
+  return Status::OK();
+}
+
+size_t PosixWritableFile::GetRequiredBufferAlignment() const {
+  return FLAGS_o_direct_block_alignment_bytes;
+}
+
+Status PosixWritableFile::DisableDirectIO() {
+#ifdef O_DIRECT
+  auto flags = fcntl(fd_, F_GETFL);
+  if (flags == -1 || fcntl(fd_, F_SETFL, flags & ~O_DIRECT) == -1) {
+    return STATUS_IO_ERROR(filename_, errno);
+  }
+#endif
+  direct_io_ = false;
+  return Status::OK();
+}
+
 Status PosixWritableFile::Truncate(uint64_t size) {
+  if (!direct_io_) {
+    return Status::OK();
+  }
+  // Unbuffered writer pads the last block, so the tail should be cut.
+  if (ftruncate(fd_, size) != 0) {
+    return STATUS_IO_ERROR(filename_, errno);
+  }
+  filesize_ = size;
   return Status::OK();
 }
 
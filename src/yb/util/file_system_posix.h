@@ -49,6 +49,8 @@ class PosixRandomAccessFile : public RandomAccessFile {
   virtual Status Read(uint64_t offset, size_t n, Slice* result,
                       uint8_t* scratch) const override;
 
+  Status MultiRead(ReadRequest* requests, size_t num_requests) const override;
+
   Result<uint64_t> Size() const override;
 
   Result<uint64_t> INode() const override;
@@ -61,12 +63,20 @@ class PosixRandomAccessFile : public RandomAccessFile {
   virtual size_t GetUniqueId(char* id) const override;
 #endif
   virtual void Hint(AccessPattern pattern) override;
+  virtual void Prefetch(uint64_t offset, size_t length) override;
   virtual Status InvalidateCache(size_t offset, size_t length) override;
 
  private:
+  Status CompleteShortReads(ReadRequest* requests, size_t num_requests) const;
+
+  // Reads aligned range covering the requested one into temporary buffer, as required by O_DIRECT.
+  Status ReadDirect(uint64_t offset, size_t n, Slice* result, uint8_t* scratch) const;
+
   std::string filename_;
   int fd_;
   bool use_os_buffer_;
+  // File is opened with O_DIRECT.
+  bool direct_io_;
 };
 
 } // namespace yb
@@ -82,6 +92,8 @@ class PosixWritableFile : public WritableFile {
   const std::string filename_;
   int fd_;
   uint64_t filesize_;
+  // File is opened with O_DIRECT, so could be written only with aligned PositionedAppend.
+  bool direct_io_;
 #ifdef ROCKSDB_FALLOCATE_PRESENT
   bool allow_fallocate_;
   bool fallocate_with_keep_size_;
@@ -97,6 +109,9 @@ class PosixWritableFile : public WritableFile {
   Status Truncate(uint64_t size) override;
   Status Close() override;
   Status Append(const Slice& data) override;
+  Status PositionedAppend(const Slice& data, uint64_t offset) override;
+  bool UseOSBuffer() const override { return !direct_io_; }
+  size_t GetRequiredBufferAlignment() const override;
   Status Flush() override;
   Status Sync() override;
   Status Fsync() override;
@@ -109,6 +124,9 @@ class PosixWritableFile : public WritableFile {
   size_t GetUniqueId(char* id) const override;
 #endif
   const std::string& filename() const override { return filename_; }
+
+ private:
+  Status DisableDirectIO();
 };
 
 } // namespace rocksdb
@@ -0,0 +1,231 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/util/io_uring.h"
+
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define YB_HAVE_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
+#include <algorithm>
+
+#include "yb/util/errno.h"
+#include "yb/util/file_system.h"
+#include "yb/util/logging.h"
+#include "yb/util/result.h"
+
+namespace yb {
+
+#ifdef YB_HAVE_IO_URING
+
+namespace {
+
+Result<void*> MmapRing(int ring_fd, size_t size, off_t offset) {
+  auto* result = mmap(
+      nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+  if (result == MAP_FAILED) {
+    return STATUS_FROM_ERRNO("mmap io_uring", errno);
+  }
+  return result;
+}
+
+template <class T>
+T* RingField(void* ring, uint32_t offset) {
+  return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+
+} // namespace
+
+IoUring::~IoUring() {
+  if (sqes_) {
+    munmap(sqes_, sqes_size_);
+  }
+  if (cq_ring_ && cq_ring_ != sq_ring_) {
+    munmap(cq_ring_, cq_ring_size_);
+  }
+  if (sq_ring_) {
+    munmap(sq_ring_, sq_ring_size_);
+  }
+  if (ring_fd_ >= 0) {
+    close(ring_fd_);
+  }
+}
+
+Status IoUring::Init(uint32_t queue_depth) {
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  ring_fd_ = static_cast<int>(syscall(__NR_io_uring_setup, queue_depth, &params));
+  if (ring_fd_ < 0) {
+    return STATUS_FROM_ERRNO("io_uring_setup", errno);
+  }
+  sq_entries_ = params.sq_entries;
+
+  sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  bool single_mmap = false;
+#ifdef IORING_FEAT_SINGLE_MMAP
+  single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+#endif
+  if (single_mmap) {
+    sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+  }
+  sq_ring_ = VERIFY_RESULT(MmapRing(ring_fd_, sq_ring_size_, IORING_OFF_SQ_RING));
+  if (single_mmap) {
+    cq_ring_ = sq_ring_;
+  } else {
+    cq_ring_ = VERIFY_RESULT(MmapRing(ring_fd_, cq_ring_size_, IORING_OFF_CQ_RING));
+  }
+  sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+  sqes_ = VERIFY_RESULT(MmapRing(ring_fd_, sqes_size_, IORING_OFF_SQES));
+
+  sq_tail_ = RingField<uint32_t>(sq_ring_, params.sq_off.tail);
+  sq_mask_ = RingField<uint32_t>(sq_ring_, params.sq_off.ring_mask);
+  sq_array_ = RingField<uint32_t>(sq_ring_, params.sq_off.array);
+  cq_head_ = RingField<uint32_t>(cq_ring_, params.cq_off.head);
+  cq_tail_ = RingField<uint32_t>(cq_ring_, params.cq_off.tail);
+  cq_mask_ = RingField<uint32_t>(cq_ring_, params.cq_off.ring_mask);
+  cqes_ = RingField<io_uring_cqe>(cq_ring_, params.cq_off.cqes);
+
+  iovecs_.resize(sq_entries_);
+  return Status::OK();
+}
+
+size_t IoUring::ReapCompletions(ReadRequest* requests, Status* status) {
+  const auto* cqes = static_cast<const io_uring_cqe*>(cqes_);
+  auto head = *cq_head_;
+  const auto tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+  size_t result = 0;
+  for (; head != tail; ++head, ++result) {
+    const auto& cqe = cqes[head & *cq_mask_];
+    auto& request = requests[cqe.user_data];
+    if (cqe.res < 0) {
+      if (status->ok()) {
+        *status = STATUS_FROM_ERRNO("io_uring read", -cqe.res);
+      }
+      continue;
+    }
+    request.result = Slice(request.scratch, static_cast<size_t>(cqe.res));
+  }
+  __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+  return result;
+}
+
+Status IoUring::Read(int fd, ReadRequest* requests, size_t num_requests) {
+  auto* sqes = static_cast<io_uring_sqe*>(sqes_);
+  Status status;
+  for (size_t batch_start = 0; batch_start < num_requests; batch_start += sq_entries_) {
+    auto* batch = requests + batch_start;
+    auto batch_size = std::min<size_t>(num_requests - batch_start, sq_entries_);
+
+    // Only this thread produces submissions, and all of them were consumed by the kernel during
+    // the previous batch, so the whole submission queue is available.
+    const auto first_tail = *sq_tail_;
+    auto tail = first_tail;
+    for (size_t i = 0; i != batch_size; ++i) {
+      auto& iov = iovecs_[i];
+      iov.iov_base = batch[i].scratch;
+      iov.iov_len = batch[i].length;
+      const auto index = tail & *sq_mask_;
+      auto& sqe = sqes[index];
+      memset(&sqe, 0, sizeof(sqe));
+      sqe.opcode = IORING_OP_READV;
+      sqe.fd = fd;
+      sqe.addr = reinterpret_cast<uint64_t>(&iov);
+      sqe.len = 1;
+      sqe.off = batch[i].offset;
+      sqe.user_data = i;
+      sq_array_[index] = index;
+      ++tail;
+    }
+    __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+
+    size_t submitted = 0;
+    size_t completed = 0;
+    for (;;) {
+      completed += ReapCompletions(batch, &status);
+      if (completed == batch_size) {
+        break;
+      }
+      auto rv = syscall(
+          __NR_io_uring_enter, ring_fd_, batch_size - submitted, 1, IORING_ENTER_GETEVENTS,
+          nullptr, 0);
+      if (rv >= 0) {
+        submitted += rv;
+        continue;
+      }
+      const auto error = errno;
+      if (error == EINTR || error == EAGAIN || error == EBUSY) {
+        continue;
+      }
+      // Buffers of submitted reads belong to the caller, so we still have to wait for them.
+      LOG_IF(FATAL, submitted == batch_size)
+          << "Failed to wait for io_uring completions: " << ErrnoToString(error);
+      if (status.ok()) {
+        status = STATUS_FROM_ERRNO("io_uring_enter", error);
+      }
+      // Drop reads that were not consumed by the kernel.
+      batch_size = submitted;
+      __atomic_store_n(sq_tail_, first_tail + static_cast<uint32_t>(submitted), __ATOMIC_RELEASE);
+    }
+    RETURN_NOT_OK(status);
+  }
+  return Status::OK();
+}
+
+#else
+
+IoUring::~IoUring() = default;
+
+Status IoUring::Init(uint32_t queue_depth) {
+  return STATUS(NotSupported, "io_uring is not supported on this platform");
+}
+
+size_t IoUring::ReapCompletions(ReadRequest* requests, Status* status) {
+  return 0;
+}
+
+Status IoUring::Read(int fd, ReadRequest* requests, size_t num_requests) {
+  return STATUS(NotSupported, "io_uring is not supported on this platform");
+}
+
+#endif // YB_HAVE_IO_URING
+
+Result<std::unique_ptr<IoUring>> IoUring::Create(uint32_t queue_depth) {
+  std::unique_ptr<IoUring> result(new IoUring());
+  RETURN_NOT_OK(result->Init(queue_depth));
+  return result;
+}
+
+IoUring* IoUring::ThreadLocal(uint32_t queue_depth) {
+  static thread_local std::unique_ptr<IoUring> ring;
+  static thread_local bool create_failed = false;
+  if (ring || create_failed) {
+    return ring.get();
+  }
+  auto result = Create(queue_depth);
+  if (!result.ok()) {
+    YB_LOG_EVERY_N_SECS(WARNING, 60) << "Failed to create io_uring: " << result.status();
+    create_failed = true;
+    return nullptr;
+  }
+  ring = std::move(*result);
+  return ring.get();
+}
+
+} // namespace yb
@@ -0,0 +1,78 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <sys/uio.h>
+
+#include <memory>
+#include <vector>
+
+#include "yb/util/status_fwd.h"
+
+namespace yb {
+
+struct ReadRequest;
+
+// Minimal io_uring based reader implemented on top of raw system calls, so it does not depend on
+// liburing. The whole batch of reads is submitted with a single system call and completions are
+// reaped directly from the completion ring shared with the kernel.
+//
+// Not thread safe, each thread should use its own instance, see IoUring::ThreadLocal.
+class IoUring {
+ public:
+  ~IoUring();
+
+  static Result<std::unique_ptr<IoUring>> Create(uint32_t queue_depth);
+
+  // Returns io_uring instance of the current thread, creating it on the first call.
+  // Returns nullptr if io_uring could not be created, it is not retried for this thread then.
+  static IoUring* ThreadLocal(uint32_t queue_depth);
+
+  // Reads requests from the file and waits for all of them to complete. Sets request->result to
+  // the data that was read, which could be shorter than requested, so the caller is responsible
+  // for completing short reads.
+  // On failure results of all requests are undefined.
+  Status Read(int fd, ReadRequest* requests, size_t num_requests);
+
+ private:
+  IoUring() = default;
+
+  Status Init(uint32_t queue_depth);
+
+  // Processes available completions and returns their number.
+  size_t ReapCompletions(ReadRequest* requests, Status* status);
+
+  int ring_fd_ = -1;
+  uint32_t sq_entries_ = 0;
+
+  void* sq_ring_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  void* cq_ring_ = nullptr;
+  size_t cq_ring_size_ = 0;
+  void* sqes_ = nullptr;
+  size_t sqes_size_ = 0;
+
+  uint32_t* sq_tail_ = nullptr;
+  const uint32_t* sq_mask_ = nullptr;
+  uint32_t* sq_array_ = nullptr;
+  uint32_t* cq_head_ = nullptr;
+  const uint32_t* cq_tail_ = nullptr;
+  const uint32_t* cq_mask_ = nullptr;
+  const void* cqes_ = nullptr;
+
+  std::vector<iovec> iovecs_;
+};
+
+} // namespace yb
@@ -158,6 +158,19 @@ TEST_F(MetricsTest, SimpleAtomicGaugeTest) {
   ASSERT_EQ(5, mem_usage->value());
 }
 
+METRIC_DEFINE_gauge_int64(test_entity, test_striped_gauge, "Test Striped Gauge",
+                          MetricUnit::kRequests, "Test Striped Gauge");
+
+TEST_F(MetricsTest, SimpleStripedGaugeTest) {
+  auto gauge = METRIC_test_striped_gauge.InstantiateStriped(entity_);
+  ASSERT_EQ(0, gauge->value());
+  gauge->IncrementBy(7);
+  gauge->Decrement();
+  ASSERT_EQ(6, gauge->value());
+  DecrementGauge(gauge);
+  ASSERT_EQ(5, gauge->value());
+}
+
 METRIC_DEFINE_gauge_int64(test_entity, test_func_gauge, "Test Gauge", MetricUnit::kBytes,
                           "Test Gauge 2");
 
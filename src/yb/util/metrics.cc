@@ -198,20 +198,16 @@ bool MetricRegistry::TabletHasBeenShutdown(const scoped_refptr<MetricEntity> ent
 Status MetricRegistry::WriteAsJson(JsonWriter* writer,
                                    const MetricEntityOptions& entity_options,
                                    const MetricJsonOptions& opts) const {
-  EntityMap entities;
-  {
-    std::lock_guard l(lock_);
-    entities = entities_;
-  }
+  auto entities = EntitiesSnapshot();
 
   writer->StartArray();
-  for (const EntityMap::value_type& e : entities) {
-    if (TabletHasBeenShutdown(e.second)) {
+  for (const auto& entity : entities) {
+    if (TabletHasBeenShutdown(entity)) {
       continue;
     }
 
-    WARN_NOT_OK(e.second->WriteAsJson(writer, entity_options, opts),
-                Substitute("Failed to write entity $0 as JSON", e.second->id()));
+    WARN_NOT_OK(entity->WriteAsJson(writer, entity_options, opts),
+                Substitute("Failed to write entity $0 as JSON", entity->id()));
   }
   writer->EndArray();
 
@@ -228,19 +224,15 @@ Status MetricRegistry::WriteAsJson(JsonWriter* writer,
 Status MetricRegistry::WriteForPrometheus(PrometheusWriter* writer,
                                           const MetricEntityOptions& entity_options,
                                           const MetricPrometheusOptions& opts) const {
-  EntityMap entities;
-  {
-    std::lock_guard l(lock_);
-    entities = entities_;
-  }
+  auto entities = EntitiesSnapshot();
 
-  for (const EntityMap::value_type& e : entities) {
-    if (TabletHasBeenShutdown(e.second)) {
+  for (const auto& entity : entities) {
+    if (TabletHasBeenShutdown(entity)) {
       continue;
     }
 
-    WARN_NOT_OK(e.second->WriteForPrometheus(writer, entity_options, opts),
-                Substitute("Failed to write entity $0 as Prometheus", e.second->id()));
+    WARN_NOT_OK(entity->WriteForPrometheus(writer, entity_options, opts),
+                Substitute("Failed to write entity $0 as Prometheus", entity->id()));
   }
   RETURN_NOT_OK(writer->FlushAggregatedValues(opts.max_tables_metrics_breakdowns,
                 entity_options.priority_regex));
@@ -255,40 +247,59 @@ Status MetricRegistry::WriteForPrometheus(PrometheusWriter* writer,
   return Status::OK();
 }
 
-void MetricRegistry::get_all_prototypes(std::set<std::string>& prototypes) const {
-  EntityMap entities;
-  {
-    std::lock_guard l(lock_);
-    entities = entities_;
+std::vector<scoped_refptr<MetricEntity>> MetricRegistry::EntitiesSnapshot() const {
+  std::vector<scoped_refptr<MetricEntity>> result;
+  std::lock_guard l(lock_);
+  result.reserve(entities_.size());
+  for (const auto& [_, entity] : entities_) {
+    result.push_back(entity);
   }
-  for (const EntityMap::value_type& e : entities) {
-    prototypes.insert(e.second->prototype().name());
+  return result;
+}
+
+void MetricRegistry::get_all_prototypes(std::set<std::string>& prototypes) const {
+  for (const auto& entity : EntitiesSnapshot()) {
+    prototypes.insert(entity->prototype().name());
   }
 }
 
 void MetricRegistry::RetireOldMetrics() {
-  std::lock_guard l(lock_);
-  for (auto it = entities_.begin(); it != entities_.end();) {
-    it->second->RetireOldMetrics();
-
-    if (it->second->num_metrics() == 0 && it->second->HasOneRef()) {
-      // No metrics and no external references to this entity, so we can retire it.
-      // Unlike retiring the metrics themselves, we don't wait for any timeout
-      // to retire them -- we assume that that timed retention has been satisfied
-      // by holding onto the metrics inside the entity.
-
-      // For a tablet that has been shutdown, metrics are being deleted. So do not track
-      // the tablet anymore.
-      if (strcmp(it->second->prototype_->name(), "tablet") == 0) {
-        DVLOG(3) << "T " << it->first << ": "
-          << "Remove from set of tablets that have been shutdown so as to be freed";
-        tablets_shutdown_erase(it->first);
+  // Metrics are retired without holding lock_, so entity registration is not blocked while all
+  // entities are scanned. Only the entities that could be retired are rechecked under lock_.
+  std::vector<std::string> candidate_ids;
+  {
+    auto entities = EntitiesSnapshot();
+    for (const auto& entity : entities) {
+      entity->RetireOldMetrics();
+      if (entity->num_metrics() == 0) {
+        candidate_ids.push_back(entity->id());
       }
+    }
+  }
+  if (candidate_ids.empty()) {
+    return;
+  }
 
-      entities_.erase(it++);
-    } else {
-      ++it;
+  std::lock_guard l(lock_);
+  for (const auto& id : candidate_ids) {
+    auto it = entities_.find(id);
+    if (it == entities_.end() || it->second->num_metrics() != 0 || !it->second->HasOneRef()) {
+      continue;
     }
+    // No metrics and no external references to this entity, so we can retire it.
+    // Unlike retiring the metrics themselves, we don't wait for any timeout
+    // to retire them -- we assume that that timed retention has been satisfied
+    // by holding onto the metrics inside the entity.
+
+    // For a tablet that has been shutdown, metrics are being deleted. So do not track
+    // the tablet anymore.
+    if (strcmp(it->second->prototype_->name(), "tablet") == 0) {
+      DVLOG(3) << "T " << it->first << ": "
+        << "Remove from set of tablets that have been shutdown so as to be freed";
+      tablets_shutdown_erase(it->first);
+    }
+
+    entities_.erase(it);
   }
 }
 
@@ -411,6 +422,38 @@ Status StringGauge::WriteForPrometheus(
   return Status::OK();
 }
 
+//
+// StripedGauge
+//
+
+StripedGauge::StripedGauge(const GaugePrototype<int64_t>* proto) : Gauge(proto) {
+}
+
+StripedGauge::StripedGauge(std::unique_ptr<GaugePrototype<int64_t>> proto)
+    : Gauge(std::move(proto)) {
+}
+
+int64_t StripedGauge::value() const {
+  return value_.Value();
+}
+
+void StripedGauge::WriteValue(JsonWriter* writer) const {
+  writer->Value(value());
+}
+
+Status StripedGauge::WriteForPrometheus(
+    PrometheusWriter* writer, const MetricEntity::AttributeMap& attr,
+    const MetricPrometheusOptions& opts) const {
+  if (prototype_->level() < opts.level) {
+    return Status::OK();
+  }
+
+  return writer->WriteSingleEntry(attr, prototype_->name(), value(),
+                                  prototype()->aggregation_function(),
+                                  MetricType::PrometheusType(prototype_->type()),
+                                  prototype_->description());
+}
+
 //
 // Counter
 //
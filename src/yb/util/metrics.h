@@ -554,6 +554,11 @@ class MetricRegistry {
 
  private:
   typedef std::unordered_map<std::string, scoped_refptr<MetricEntity> > EntityMap;
+
+  // Returns the registered entities. lock_ is only held while references are copied, so
+  // serializing metrics does not block entity registration.
+  std::vector<scoped_refptr<MetricEntity>> EntitiesSnapshot() const;
+
   EntityMap entities_;
 
   mutable std::shared_timed_mutex tablets_shutdown_lock_;
@@ -664,6 +669,12 @@ class GaugePrototype : public MetricPrototype {
     return entity->FindOrCreateMetric<AtomicGauge<T>>(this, initial_value);
   }
 
+  // Instantiate a gauge that is only incremented and decremented, optimized for concurrent
+  // updates. See StripedGauge.
+  scoped_refptr<StripedGauge> InstantiateStriped(const scoped_refptr<MetricEntity>& entity) const {
+    return entity->FindOrCreateMetric<StripedGauge>(this);
+  }
+
   // Instantiate a gauge that is backed by the given callback.
   scoped_refptr<FunctionGauge<T> > InstantiateFunctionGauge(
       const scoped_refptr<MetricEntity>& entity,
@@ -788,6 +799,53 @@ void DecrementGauge(const scoped_refptr<AtomicGauge<T>>& gauge) {
   }
 }
 
+// A gauge that is only incremented and decremented, optimized for high-volume concurrent updates
+// from many threads. Updates go to a striped counter (see LongAdder), so they do not contend on a
+// single cache line, while reading the value has to sum all stripes. So it should be used for
+// gauges that are updated on hot paths and only read when metrics are collected.
+class StripedGauge : public Gauge {
+ public:
+  explicit StripedGauge(const GaugePrototype<int64_t>* proto);
+  explicit StripedGauge(std::unique_ptr<GaugePrototype<int64_t>> proto);
+
+  int64_t value() const;
+  void Increment() {
+    value_.Increment();
+  }
+  void IncrementBy(int64_t amount) {
+    value_.IncrementBy(amount);
+  }
+  void Decrement() {
+    value_.Decrement();
+  }
+  void DecrementBy(int64_t amount) {
+    value_.IncrementBy(-amount);
+  }
+
+  Status WriteForPrometheus(
+      PrometheusWriter* writer, const MetricEntity::AttributeMap& attr,
+      const MetricPrometheusOptions& opts) const override;
+
+ protected:
+  void WriteValue(JsonWriter* writer) const override;
+
+ private:
+  LongAdder value_;
+  DISALLOW_COPY_AND_ASSIGN(StripedGauge);
+};
+
+inline void IncrementGauge(const scoped_refptr<StripedGauge>& gauge) {
+  if (gauge) {
+    gauge->Increment();
+  }
+}
+
+inline void DecrementGauge(const scoped_refptr<StripedGauge>& gauge) {
+  if (gauge) {
+    gauge->Decrement();
+  }
+}
+
 // A Gauge that calls back to a function to get its value.
 //
 // This metric type should be used in cases where it is difficult to keep a running
@@ -38,6 +38,7 @@ class MillisLagPrototype;
 class NMSWriter;
 class PrometheusWriter;
 class StatsOnlyHistogram;
+class StripedGauge;
 
 struct MetricJsonOptions;
 struct MetricPrometheusOptions;
@@ -0,0 +1,40 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <gtest/gtest.h>
+
+#include "yb/util/numa_util.h"
+#include "yb/util/test_macros.h"
+#include "yb/util/test_util.h"
+
+namespace yb {
+
+class NumaUtilTest : public YBTest {
+};
+
+TEST_F(NumaUtilTest, ParseCpuList) {
+  ASSERT_EQ(ASSERT_RESULT(ParseCpuList("")), std::vector<int>());
+  ASSERT_EQ(ASSERT_RESULT(ParseCpuList("0\n")), std::vector<int>({0}));
+  ASSERT_EQ(ASSERT_RESULT(ParseCpuList("0-3,8-9")), std::vector<int>({0, 1, 2, 3, 8, 9}));
+  ASSERT_EQ(ASSERT_RESULT(ParseCpuList("2,5-6\n")), std::vector<int>({2, 5, 6}));
+  ASSERT_NOK(ParseCpuList("3-1"));
+  ASSERT_NOK(ParseCpuList("a-b"));
+}
+
+TEST_F(NumaUtilTest, PinCurrentThread) {
+  const auto& nodes = NumaNodeCpus();
+  LOG(INFO) << "NUMA nodes: " << nodes.size();
+  ASSERT_OK(PinCurrentThreadToNumaNode(nodes.size() + 1));
+}
+
+} // namespace yb
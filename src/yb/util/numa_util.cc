@@ -0,0 +1,117 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/util/numa_util.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <cctype>
+#include <fstream>
+#include <string>
+
+#include "yb/util/errno.h"
+#include "yb/util/format.h"
+#include "yb/util/logging.h"
+#include "yb/util/status_format.h"
+#include "yb/util/stol_utils.h"
+
+namespace yb {
+
+namespace {
+
+const std::string kNodesDir = "/sys/devices/system/node/";
+
+Result<std::vector<int>> ReadCpuList(const std::string& path) {
+  std::ifstream input(path);
+  std::string line;
+  if (!std::getline(input, line)) {
+    return STATUS_FORMAT(NotFound, "Unable to read $0", path);
+  }
+  return ParseCpuList(line);
+}
+
+std::vector<std::vector<int>> ReadNumaNodeCpus() {
+  std::vector<std::vector<int>> result;
+  auto nodes = ReadCpuList(kNodesDir + "online");
+  if (!nodes.ok()) {
+    VLOG(1) << "NUMA topology is not available: " << nodes.status();
+    return result;
+  }
+  for (auto node : *nodes) {
+    auto cpus = ReadCpuList(Format("$0node$1/cpulist", kNodesDir, node));
+    if (!cpus.ok()) {
+      LOG(WARNING) << "Failed to read CPUs of NUMA node " << node << ": " << cpus.status();
+      return {};
+    }
+    // Memory only nodes do not have CPUs.
+    if (!cpus->empty()) {
+      result.push_back(std::move(*cpus));
+    }
+  }
+  return result;
+}
+
+} // namespace
+
+Result<std::vector<int>> ParseCpuList(std::string_view cpu_list) {
+  std::vector<int> result;
+  while (!cpu_list.empty()) {
+    auto comma = cpu_list.find(',');
+    auto range = cpu_list.substr(0, comma);
+    cpu_list = comma == std::string_view::npos ? std::string_view() : cpu_list.substr(comma + 1);
+    while (!range.empty() && isspace(range.back())) {
+      range.remove_suffix(1);
+    }
+    if (range.empty()) {
+      continue;
+    }
+    auto dash = range.find('-');
+    auto first = VERIFY_RESULT(CheckedStoi(range.substr(0, dash)));
+    auto last = dash == std::string_view::npos
+        ? first : VERIFY_RESULT(CheckedStoi(range.substr(dash + 1)));
+    SCHECK_LE(first, last, InvalidArgument, "Bad CPU range");
+    for (auto cpu = first; cpu <= last; ++cpu) {
+      result.push_back(cpu);
+    }
+  }
+  return result;
+}
+
+const std::vector<std::vector<int>>& NumaNodeCpus() {
+  static const std::vector<std::vector<int>> result = ReadNumaNodeCpus();
+  return result;
+}
+
+Status PinCurrentThreadToNumaNode(size_t index) {
+#if defined(__linux__)
+  const auto& nodes = NumaNodeCpus();
+  if (nodes.size() < 2) {
+    return Status::OK();
+  }
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (auto cpu : nodes[index % nodes.size()]) {
+    CPU_SET(cpu, &cpu_set);
+  }
+  auto rc = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+  if (rc != 0) {
+    return STATUS_FORMAT(
+        RuntimeError, "Failed to pin thread to NUMA node $0: $1", index % nodes.size(),
+        ErrnoToString(rc));
+  }
+#endif
+  return Status::OK();
+}
+
+} // namespace yb
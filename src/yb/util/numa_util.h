@@ -0,0 +1,33 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "yb/util/result.h"
+
+namespace yb {
+
+// Parses list of CPUs in the format used by sysfs, e.g. "0-3,8-11".
+Result<std::vector<int>> ParseCpuList(std::string_view cpu_list);
+
+// Returns CPUs of each NUMA node of this machine. Empty when NUMA topology is not available.
+const std::vector<std::vector<int>>& NumaNodeCpus();
+
+// Pins the current thread to CPUs of NUMA node with number index % number of NUMA nodes.
+// Does nothing on machines with a single NUMA node.
+Status PinCurrentThreadToNumaNode(size_t index);
+
+} // namespace yb
@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 
+#include "yb/util/backoff_waiter.h"
 #include "yb/util/metrics.h"
 #include "yb/util/priority_thread_pool.h"
 #include "yb/util/random_util.h"
@@ -25,6 +26,8 @@
 
 using namespace std::literals;
 
+DECLARE_uint64(priority_thread_pool_io_bytes_per_priority_step);
+
 namespace yb {
 
 // In our jenkins environment test macs switch threads rare, so have to use higher step time.
@@ -608,4 +611,63 @@ TEST(PriorityThreadPoolTest, FailureToCreateThread) {
   ASSERT_EQ(running, std::vector<int>({8, 9, 10}));
 }
 
+// Task that reports I/O on every step.
+class IOTask : public Task {
+ public:
+  IOTask(int index, Share* share, size_t io_bytes_per_step)
+      : Task(index, share, kNoDrive), index_(index), share_(share),
+        io_bytes_per_step_(io_bytes_per_step) {
+  }
+
+  void Run(const Status& status, PriorityThreadPoolSuspender* suspender) override {
+    if (!status.ok()) {
+      return;
+    }
+    while (share_->Step(index_)) {
+      suspender->RecordIO(io_bytes_per_step_);
+      suspender->PauseIfNecessary();
+      std::this_thread::sleep_for(kStepTime);
+    }
+  }
+
+ private:
+  const int index_;
+  Share* const share_;
+  const size_t io_bytes_per_step_;
+};
+
+// Verify that task that performs a lot of I/O is preempted in favor of the queued task, and is
+// resumed after it.
+TEST(PriorityThreadPoolTest, IOPriorityPenalty) {
+  constexpr size_t kIOBytesPerStep = 10;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_priority_thread_pool_io_bytes_per_priority_step) =
+      kIOBytesPerStep * 4;
+
+  PriorityThreadPool thread_pool(1 /* max_running_tasks */);
+  Share share;
+  std::vector<int> running;
+
+  auto se = ScopeExit([&share, &thread_pool] {
+    thread_pool.StartShutdown();
+    share.StopAll();
+    thread_pool.CompleteShutdown();
+  });
+
+  auto io_task = std::make_unique<IOTask>(2, &share, kIOBytesPerStep);
+  ASSERT_OK(thread_pool.Submit(3 /* priority */, &io_task));
+  SubmitTask(1, &share, &thread_pool);
+
+  // Task 2 starts with higher priority, but loses it while performing I/O.
+  share.FillRunningTaskPriorities(&running);
+  ASSERT_EQ(running, std::vector<int>({2}));
+  ASSERT_OK(WaitFor([&share, &running] {
+    share.FillRunningTaskPriorities(&running);
+    return running == std::vector<int>({1});
+  }, kWaitTime * 20, "Wait task with I/O to be paused"));
+
+  share.Stop(1);
+  share.FillRunningTaskPriorities(&running);
+  ASSERT_EQ(running, std::vector<int>({2}));
+}
+
 } // namespace yb
@@ -13,6 +13,7 @@
 
 #include "yb/util/priority_thread_pool.h"
 
+#include <limits>
 #include <unordered_map>
 #include <mutex>
 
@@ -28,10 +29,18 @@
 #include "yb/util/locks.h"
 #include "yb/util/random_util.h"
 #include "yb/util/scope_exit.h"
+#include "yb/util/size_literals.h"
 #include "yb/util/unique_lock.h"
 #include "yb/util/compare_util.h"
 
 using namespace std::placeholders;
+using namespace yb::size_literals;
+
+DEFINE_RUNTIME_uint64(priority_thread_pool_io_bytes_per_priority_step, 1_GB,
+    "Priority of a running task is decreased by one for every specified number of bytes of I/O "
+    "performed by it, so long running tasks, for instance compactions of large tablets, could be "
+    "preempted in favor of tasks of other tablets. Priority is not decreased below zero. "
+    "0 disables this behavior.");
 
 namespace yb {
 
@@ -120,8 +129,24 @@ class PriorityThreadPoolInternalTask {
 
   // Changes to priority does not require immediate effect, so
   // relaxed could be used.
+  // Returns the task priority lowered by the penalty for I/O performed by the task.
   int task_priority() const {
-    return task_priority_.load(std::memory_order_relaxed);
+    auto result = task_priority_.load(std::memory_order_relaxed);
+    // Explicitly prioritized tasks are not penalized.
+    if (result <= 0 || result >= kHighPriority) {
+      return result;
+    }
+    return std::max(result - io_priority_penalty_.load(std::memory_order_relaxed), 0);
+  }
+
+  int io_priority_penalty() const {
+    return io_priority_penalty_.load(std::memory_order_relaxed);
+  }
+
+  // Returns the total number of bytes of I/O performed by the task, including the specified
+  // bytes.
+  uint64_t AddIOBytes(size_t bytes) const {
+    return io_bytes_.fetch_add(bytes, std::memory_order_acq_rel) + bytes;
   }
 
   int group_no_priority() const {
@@ -153,6 +178,10 @@ class PriorityThreadPoolInternalTask {
     task_priority_.store(value, std::memory_order_relaxed);
   }
 
+  void SetIOPriorityPenalty(int value) {
+    io_priority_penalty_.store(value, std::memory_order_relaxed);
+  }
+
   // Returns true if the group no priority was succesfully set.
   // Returns false otherwise.
   bool SetGroupNoPriority(int value) {
@@ -174,16 +203,17 @@ class PriorityThreadPoolInternalTask {
   }
 
   PriorityThreadPoolPriorities GetPriorities() const {
-    return PriorityThreadPoolPriorities{task_priority_.load(), group_no_priority()};
+    return PriorityThreadPoolPriorities{task_priority(), group_no_priority()};
   }
 
   // Reading the value of worker_ requires thread_pool_mutex_. But since this is only used for
   // logging and we are just printing the pointer value we do not need to lock.
   std::string ToString() const {
     return Format(
-        "{ task: $0 worker: $1 state: $2 task_priority: $3 group_no_priority: $4 serial_no: $5 }",
+        "{ task: $0 worker: $1 state: $2 task_priority: $3 group_no_priority: $4 serial_no: $5 "
+            "io_bytes: $6 }",
         TaskToString(), get_worker_relaxed(), state(), task_priority(), group_no_priority(),
-        serial_no_);
+        serial_no_, io_bytes_.load(std::memory_order_relaxed));
   }
 
  private:
@@ -198,6 +228,9 @@ class PriorityThreadPoolInternalTask {
     return task_to_string_;
   }
   std::atomic<int> task_priority_;
+  // Priority decrease caused by I/O performed by the task, modified only under thread pool mutex.
+  std::atomic<int> io_priority_penalty_{0};
+  mutable std::atomic<uint64_t> io_bytes_{0};
   int group_no_priority_ GUARDED_BY(group_no_priority_mutex_);
   bool group_no_priority_frozen_ GUARDED_BY(group_no_priority_mutex_) = false;
   mutable std::mutex group_no_priority_mutex_;
@@ -222,6 +255,7 @@ class PriorityThreadPoolInternalTask {
 class PriorityThreadPoolWorkerContext {
  public:
   virtual void PauseIfNecessary(PriorityThreadPoolWorker* worker) = 0;
+  virtual void RecordIO(PriorityThreadPoolWorker* worker, size_t bytes) = 0;
   virtual bool WorkerFinished(PriorityThreadPoolWorker* worker) = 0;
   virtual void TaskAborted(const PriorityThreadPoolInternalTask* task) = 0;
   virtual ~PriorityThreadPoolWorkerContext() {}
@@ -314,6 +348,10 @@ class PriorityThreadPoolWorker : public PriorityThreadPoolSuspender {
     context_->PauseIfNecessary(this);
   }
 
+  void RecordIO(size_t bytes) override {
+    context_->RecordIO(this, bytes);
+  }
+
   void Resumed() {
     cond_.notify_one();
   }
@@ -681,6 +719,32 @@ class PriorityThreadPool::Impl : public PriorityThreadPoolWorkerContext {
     }
   }
 
+  void RecordIO(PriorityThreadPoolWorker* worker, size_t bytes) override {
+    const auto bytes_per_step = FLAGS_priority_thread_pool_io_bytes_per_priority_step;
+    if (bytes_per_step == 0 || bytes == 0) {
+      return;
+    }
+    const auto* task = worker->task();
+    const auto total_bytes = task->AddIOBytes(bytes);
+    // Fast path, the task did not cross a step boundary.
+    if ((total_bytes - bytes) / bytes_per_step == total_bytes / bytes_per_step) {
+      return;
+    }
+
+    std::lock_guard lock(mutex_);
+    const auto penalty = static_cast<int>(std::min<uint64_t>(
+        total_bytes / bytes_per_step, std::numeric_limits<int>::max()));
+    if (penalty <= task->io_priority_penalty()) {
+      return;
+    }
+    tasks_.modify(tasks_.iterator_to(*task), [penalty](PriorityThreadPoolInternalTask& task) {
+      task.SetIOPriorityPenalty(penalty);
+    });
+    UpdateMaxPriorityToDefer();
+
+    VLOG(4) << "Lowered priority of task after I/O: " << task->ToString();
+  }
+
   bool ChangeTaskPriority(size_t serial_no, int priority) {
     std::lock_guard lock(mutex_);
     auto& index = tasks_.get<SerialNoTag>();
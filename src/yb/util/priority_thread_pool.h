@@ -40,6 +40,11 @@ struct PriorityThreadPoolPriorities {
 class PriorityThreadPoolSuspender {
  public:
   virtual void PauseIfNecessary() = 0;
+
+  // Notifies the pool that the running task performed I/O of the specified number of bytes.
+  // Used to lower priority of long running tasks, so they could be preempted in favor of others.
+  virtual void RecordIO(size_t bytes) {}
+
   virtual ~PriorityThreadPoolSuspender() {}
 };
 
@@ -0,0 +1,107 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <memory>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "yb/util/size_class_pool.h"
+#include "yb/util/test_util.h"
+
+namespace yb {
+
+namespace {
+
+class PooledBase : public SizeClassPooled {
+ public:
+  virtual ~PooledBase() = default;
+
+ private:
+  char data_[100];
+};
+
+class PooledDerived : public PooledBase {
+ private:
+  char more_data_[200];
+};
+
+} // namespace
+
+class SizeClassPoolTest : public YBTest {
+};
+
+TEST_F(SizeClassPoolTest, ReuseWithinSizeClass) {
+  auto* block = SizeClassPool::Allocate(1500);
+  SizeClassPool::Free(block, 1500);
+  // 1500 and 1480 belong to the same size class, so the cached block is reused.
+  auto* reused = SizeClassPool::Allocate(1480);
+  ASSERT_EQ(block, reused);
+  SizeClassPool::Free(reused, 1480);
+
+  auto* large = SizeClassPool::Allocate(SizeClassPool::kMaxPooledSize + 1);
+  SizeClassPool::Free(large, SizeClassPool::kMaxPooledSize + 1);
+}
+
+TEST_F(SizeClassPoolTest, DeleteViaBase) {
+  PooledBase* object = new PooledDerived;
+  void* block = object;
+  delete object;
+  // Derived object size should be passed to operator delete, so the block is cached in the size
+  // class of PooledDerived.
+  std::unique_ptr<PooledBase> reused(new PooledDerived);
+  ASSERT_EQ(block, static_cast<void*>(reused.get()));
+}
+
+TEST_F(SizeClassPoolTest, AllocateShared) {
+  struct Object {
+    char data[700];
+  };
+  auto object = std::allocate_shared<Object>(SizeClassAllocator<Object>());
+  void* block = object.get();
+  object.reset();
+  auto reused = std::allocate_shared<Object>(SizeClassAllocator<Object>());
+  ASSERT_EQ(block, static_cast<void*>(reused.get()));
+}
+
+// Blocks freed by another thread are transferred to the allocating thread via the central lists.
+TEST_F(SizeClassPoolTest, CrossThread) {
+  constexpr size_t kSize = 1000;
+  constexpr size_t kNumBlocks = 200;
+
+  std::vector<void*> blocks;
+  for (size_t i = 0; i != kNumBlocks; ++i) {
+    blocks.push_back(SizeClassPool::Allocate(kSize));
+  }
+  std::unordered_set<void*> freed(blocks.begin(), blocks.end());
+
+  std::thread([&blocks] {
+    for (auto* block : blocks) {
+      SizeClassPool::Free(block, kSize);
+    }
+  }).join();
+
+  blocks.clear();
+  for (size_t i = 0; i != kNumBlocks; ++i) {
+    auto* block = SizeClassPool::Allocate(kSize);
+    ASSERT_TRUE(freed.count(block)) << "Block was not reused: " << i;
+    blocks.push_back(block);
+  }
+  for (auto* block : blocks) {
+    SizeClassPool::Free(block, kSize);
+  }
+}
+
+} // namespace yb
@@ -0,0 +1,314 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/util/size_class_pool.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "yb/gutil/thread_annotations.h"
+
+#include "yb/util/flags.h"
+#include "yb/util/locks.h"
+#include "yb/util/mem_tracker.h"
+#include "yb/util/size_literals.h"
+
+using namespace yb::size_literals;
+
+DEFINE_RUNTIME_bool(size_class_pool_enabled, true,
+    "Whether hot objects like RPC calls and tablet queries are allocated from the size class "
+    "pool. When disabled, they are allocated from the heap directly.");
+
+DEFINE_RUNTIME_uint64(size_class_pool_max_central_cache_bytes, 64_MB,
+    "Max number of bytes cached in the central lists of the size class pool. Blocks that do not "
+    "fit are returned to the heap.");
+
+namespace yb {
+
+namespace {
+
+// Max number of bytes of a single size class cached by a thread.
+constexpr size_t kMaxThreadCacheBytesPerClass = 64_KB;
+
+// Thread statistics are published when the number of unpublished allocations or cached bytes
+// reaches these values.
+constexpr uint64_t kPublishAllocations = 1024;
+constexpr int64_t kPublishBytes = 256_KB;
+
+size_t SizeClass(size_t size) {
+  return size ? (size - 1) / SizeClassPool::kGranularity : 0;
+}
+
+size_t BlockSize(size_t size_class) {
+  return (size_class + 1) * SizeClassPool::kGranularity;
+}
+
+size_t MaxThreadCacheBlocks(size_t size_class) {
+  return std::max<size_t>(kMaxThreadCacheBytesPerClass / BlockSize(size_class), 2);
+}
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+class FreeList {
+ public:
+  FreeList() = default;
+
+  FreeList(FreeList&& rhs) : head_(rhs.head_), size_(rhs.size_) {
+    rhs.head_ = nullptr;
+    rhs.size_ = 0;
+  }
+
+  FreeList& operator=(FreeList&& rhs) {
+    std::swap(head_, rhs.head_);
+    std::swap(size_, rhs.size_);
+    return *this;
+  }
+
+  bool empty() const {
+    return head_ == nullptr;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  void Push(void* block) {
+    auto* free_block = static_cast<FreeBlock*>(block);
+    free_block->next = head_;
+    head_ = free_block;
+    ++size_;
+  }
+
+  void* Pop() {
+    auto* result = head_;
+    head_ = result->next;
+    --size_;
+    return result;
+  }
+
+  // Moves first n blocks to the returned list.
+  FreeList Split(size_t n) {
+    FreeList result;
+    if (n == 0) {
+      return result;
+    }
+    auto* last = head_;
+    for (size_t i = 1; i != n; ++i) {
+      last = last->next;
+    }
+    result.head_ = head_;
+    result.size_ = n;
+    head_ = last->next;
+    size_ -= n;
+    last->next = nullptr;
+    return result;
+  }
+
+  void FreeAll() {
+    while (!empty()) {
+      ::operator delete(Pop());
+    }
+  }
+
+ private:
+  FreeBlock* head_ = nullptr;
+  size_t size_ = 0;
+};
+
+class CentralCache {
+ public:
+  CentralCache()
+      : mem_tracker_(MemTracker::FindOrCreateTracker(
+            "Size Class Pool", MemTracker::GetRootTracker())) {
+  }
+
+  // Returns false when there are no cached blocks of the specified size class.
+  bool TakeBatch(size_t size_class, FreeList* out) {
+    auto& list = lists_[size_class];
+    {
+      std::lock_guard lock(list.lock);
+      if (list.batches.empty()) {
+        return false;
+      }
+      *out = std::move(list.batches.back());
+      list.batches.pop_back();
+    }
+    auto bytes = out->size() * BlockSize(size_class);
+    cached_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+    mem_tracker_->Release(bytes);
+    return true;
+  }
+
+  void PutBatch(size_t size_class, FreeList batch) {
+    auto bytes = batch.size() * BlockSize(size_class);
+    auto cached_bytes = cached_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    if (cached_bytes + bytes > FLAGS_size_class_pool_max_central_cache_bytes) {
+      cached_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+      batch.FreeAll();
+      return;
+    }
+    mem_tracker_->Consume(bytes);
+    auto& list = lists_[size_class];
+    std::lock_guard lock(list.lock);
+    list.batches.push_back(std::move(batch));
+  }
+
+  // Publishes statistics of a thread cache, cached_bytes_delta is the change of the number of
+  // bytes cached by this thread since the previous call.
+  void Publish(uint64_t hits, uint64_t misses, int64_t cached_bytes_delta) {
+    hits_.fetch_add(hits, std::memory_order_relaxed);
+    misses_.fetch_add(misses, std::memory_order_relaxed);
+    if (cached_bytes_delta > 0) {
+      mem_tracker_->Consume(cached_bytes_delta);
+    } else if (cached_bytes_delta < 0) {
+      mem_tracker_->Release(-cached_bytes_delta);
+    }
+  }
+
+  SizeClassPool::Stats GetStats() const {
+    return SizeClassPool::Stats {
+      .hits = hits_.load(std::memory_order_relaxed),
+      .misses = misses_.load(std::memory_order_relaxed),
+      .central_cached_bytes = cached_bytes_.load(std::memory_order_relaxed),
+    };
+  }
+
+ private:
+  struct SizeClassList {
+    simple_spinlock lock;
+    std::vector<FreeList> batches GUARDED_BY(lock);
+  };
+
+  const MemTrackerPtr mem_tracker_;
+  std::array<SizeClassList, SizeClassPool::kNumSizeClasses> lists_;
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+  std::atomic<uint64_t> cached_bytes_{0};
+};
+
+// Leaked, so blocks could be freed by threads that exit after static destructors.
+CentralCache& Central() {
+  static auto* central = new CentralCache();
+  return *central;
+}
+
+thread_local bool thread_cache_destroyed = false;
+
+class ThreadCache {
+ public:
+  ~ThreadCache() {
+    for (size_t size_class = 0; size_class != lists_.size(); ++size_class) {
+      auto& list = lists_[size_class];
+      if (!list.empty()) {
+        cached_bytes_delta_ -= list.size() * BlockSize(size_class);
+        Central().PutBatch(size_class, std::move(list));
+      }
+    }
+    Publish();
+    thread_cache_destroyed = true;
+  }
+
+  void* Allocate(size_t size_class) {
+    auto& list = lists_[size_class];
+    if (list.empty()) {
+      if (!Central().TakeBatch(size_class, &list)) {
+        ++misses_;
+        MaybePublish();
+        return ::operator new(BlockSize(size_class));
+      }
+      cached_bytes_delta_ += list.size() * BlockSize(size_class);
+    }
+    ++hits_;
+    cached_bytes_delta_ -= BlockSize(size_class);
+    MaybePublish();
+    return list.Pop();
+  }
+
+  void Free(void* block, size_t size_class) {
+    auto& list = lists_[size_class];
+    list.Push(block);
+    cached_bytes_delta_ += BlockSize(size_class);
+    if (list.size() > MaxThreadCacheBlocks(size_class)) {
+      auto batch = list.Split(list.size() / 2);
+      cached_bytes_delta_ -= batch.size() * BlockSize(size_class);
+      Central().PutBatch(size_class, std::move(batch));
+    }
+    MaybePublish();
+  }
+
+ private:
+  void MaybePublish() {
+    if (hits_ + misses_ >= kPublishAllocations || cached_bytes_delta_ >= kPublishBytes ||
+        cached_bytes_delta_ <= -kPublishBytes) {
+      Publish();
+    }
+  }
+
+  void Publish() {
+    Central().Publish(hits_, misses_, cached_bytes_delta_);
+    hits_ = 0;
+    misses_ = 0;
+    cached_bytes_delta_ = 0;
+  }
+
+  std::array<FreeList, SizeClassPool::kNumSizeClasses> lists_;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+  int64_t cached_bytes_delta_ = 0;
+};
+
+// Returns nullptr when the pool should not be used by the current thread.
+ThreadCache* GetThreadCache() {
+  if (!FLAGS_size_class_pool_enabled || thread_cache_destroyed) {
+    return nullptr;
+  }
+  static thread_local ThreadCache cache;
+  return &cache;
+}
+
+} // namespace
+
+void* SizeClassPool::Allocate(size_t size) {
+  if (size > kMaxPooledSize) {
+    return ::operator new(size);
+  }
+  auto size_class = SizeClass(size);
+  auto* cache = GetThreadCache();
+  if (!cache) {
+    // Blocks of the whole size class are allocated, since they could be cached after free.
+    return ::operator new(BlockSize(size_class));
+  }
+  return cache->Allocate(size_class);
+}
+
+void SizeClassPool::Free(void* block, size_t size) {
+  if (!block) {
+    return;
+  }
+  auto* cache = size <= kMaxPooledSize ? GetThreadCache() : nullptr;
+  if (!cache) {
+    ::operator delete(block);
+    return;
+  }
+  cache->Free(block, SizeClass(size));
+}
+
+SizeClassPool::Stats SizeClassPool::GetStats() {
+  return Central().GetStats();
+}
+
+} // namespace yb
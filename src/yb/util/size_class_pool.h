@@ -0,0 +1,102 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace yb {
+
+// Pool of memory blocks for objects that are allocated and freed at a high rate, like RPC calls
+// and tablet queries.
+//
+// Block sizes are rounded up to a multiple of kGranularity, and each size class has its own free
+// lists. Freed blocks are cached by the freeing thread and reused by subsequent allocations of
+// the same size class on this thread. When a thread cache grows too large, half of its blocks are
+// moved to a central list in a single batch, from where they are taken in batches by threads whose
+// caches are empty. So blocks allocated by one thread and freed by another, which is typical for
+// RPC calls, are transferred between threads without per block synchronization.
+//
+// Bytes cached by the pool are accounted in the "Size Class Pool" MemTracker.
+class SizeClassPool {
+ public:
+  static constexpr size_t kGranularity = 64;
+  static constexpr size_t kMaxPooledSize = 4096;
+  static constexpr size_t kNumSizeClasses = kMaxPooledSize / kGranularity;
+
+  struct Stats {
+    // Number of allocations served from the pool.
+    uint64_t hits;
+    // Number of allocations that required a new block.
+    uint64_t misses;
+    // Bytes cached in the central lists.
+    uint64_t central_cached_bytes;
+  };
+
+  // Blocks larger than kMaxPooledSize are allocated from the heap directly.
+  static void* Allocate(size_t size);
+
+  // size should be the same as passed to Allocate.
+  static void Free(void* block, size_t size);
+
+  // Statistics are updated by threads in batches, so they may lag behind.
+  static Stats GetStats();
+};
+
+// Base class for objects that should be allocated from SizeClassPool when created with new.
+// Objects deleted via pointer to base class should have virtual destructor, so the size of the
+// actual object is passed to operator delete.
+class SizeClassPooled {
+ public:
+  static void* operator new(size_t size) {
+    return SizeClassPool::Allocate(size);
+  }
+
+  static void operator delete(void* block, size_t size) {
+    SizeClassPool::Free(block, size);
+  }
+
+  // Blocks are not aligned above the default new alignment.
+  static void* operator new(size_t size, std::align_val_t alignment) = delete;
+};
+
+// Allocator for allocate_shared, so the object and control block are allocated from
+// SizeClassPool.
+template <class T>
+class SizeClassAllocator {
+ public:
+  using value_type = T;
+
+  SizeClassAllocator() = default;
+
+  template <class U>
+  SizeClassAllocator(const SizeClassAllocator<U>&) {} // NOLINT
+
+  T* allocate(size_t n) {
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    return static_cast<T*>(SizeClassPool::Allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T* p, size_t n) {
+    SizeClassPool::Free(p, n * sizeof(T));
+  }
+
+  template <class U>
+  bool operator==(const SizeClassAllocator<U>&) const {
+    return true;
+  }
+};
+
+} // namespace yb
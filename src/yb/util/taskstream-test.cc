@@ -44,8 +44,8 @@
 
 #include "yb/gutil/atomicops.h"
 
-#include "yb/util/blocking_queue.h"
 #include "yb/util/countdown_latch.h"
+#include "yb/util/lockfree.h"
 #include "yb/util/scope_exit.h"
 #include "yb/util/status.h"
 #include "yb/util/taskstream.h"
@@ -81,11 +81,17 @@ class TestTaskStream : public ::testing::Test {
   const MonoDelta kTaskstreamQueueMaxWait = MonoDelta::FromMilliseconds(1000);
 };
 
-static void SimpleTaskStreamMethod(int* value, std::atomic<int32_t>* counter) {
-  if (value == nullptr) {
+struct TestItem : public MPSCQueueEntry<TestItem> {
+  int value;
+
+  explicit TestItem(int value_) : value(value_) {}
+};
+
+static void SimpleTaskStreamMethod(TestItem* item, std::atomic<int32_t>* counter) {
+  if (item == nullptr) {
     return;
   }
-  int n = *value;
+  int n = item->value;
   while (n--) {
     (*counter)++;
   }
@@ -97,12 +103,12 @@ TEST_F(TestTaskStream, TestSimpleTaskStream) {
   ASSERT_OK(BuildMinMaxTestPool(1, 1, &thread_pool));
 
   std::atomic<int32_t> counter(0);
-  std::function<void (int*)> f1 = std::bind(&SimpleTaskStreamMethod, _1, &counter);
+  std::function<void (TestItem*)> f1 = std::bind(&SimpleTaskStreamMethod, _1, &counter);
 
-  TaskStream<int> taskStream(f1, thread_pool.get(), kTaskstreamQueueMaxSize,
+  TaskStream<TestItem> taskStream(f1, thread_pool.get(), kTaskstreamQueueMaxSize,
                              kTaskstreamQueueMaxWait);
   ASSERT_OK(taskStream.Start());
-  int a[4] = {10, 9, 8, 7};
+  TestItem a[4] = {TestItem(10), TestItem(9), TestItem(8), TestItem(7)};
   for (int i = 0; i < 4; i++) {
     ASSERT_OK(taskStream.Submit(&a[i]));
   }
@@ -119,20 +125,20 @@ TEST_F(TestTaskStream, TestTwoTaskStreams) {
 
   std::atomic<int32_t> counter0(0);
   std::atomic<int32_t> counter1(0);
-  std::function<void (int*)> f0 = std::bind(&SimpleTaskStreamMethod, _1, &counter0);
-  std::function<void (int*)> f1 = std::bind(&SimpleTaskStreamMethod, _1, &counter1);
+  std::function<void (TestItem*)> f0 = std::bind(&SimpleTaskStreamMethod, _1, &counter0);
+  std::function<void (TestItem*)> f1 = std::bind(&SimpleTaskStreamMethod, _1, &counter1);
 
-  TaskStream<int> taskStream0(f0, thread_pool.get(), kTaskstreamQueueMaxSize,
+  TaskStream<TestItem> taskStream0(f0, thread_pool.get(), kTaskstreamQueueMaxSize,
                               kTaskstreamQueueMaxWait);
-  TaskStream<int> taskStream1(f1, thread_pool.get(), kTaskstreamQueueMaxSize,
+  TaskStream<TestItem> taskStream1(f1, thread_pool.get(), kTaskstreamQueueMaxSize,
                               kTaskstreamQueueMaxWait);
   ASSERT_OK(taskStream0.Start());
   ASSERT_OK(taskStream1.Start());
-  int a[4] = {10, 9, 8, 7};
+  TestItem a[4] = {TestItem(10), TestItem(9), TestItem(8), TestItem(7)};
   for (int i = 0; i < 4; i++) {
     ASSERT_OK(taskStream0.Submit(&a[i]));
   }
-  int b[5] = {1, 2, 3, 4, 5};
+  TestItem b[5] = {TestItem(1), TestItem(2), TestItem(3), TestItem(4), TestItem(5)};
   for (int i = 0; i < 5; i++) {
     ASSERT_OK(taskStream1.Submit(&b[i]));
   }
@@ -143,4 +149,42 @@ TEST_F(TestTaskStream, TestTwoTaskStreams) {
   taskStream1.Stop();
   thread_pool->Shutdown();
 }
+
+// Several producers submit to the stream with small queue, so they have to wait for the consumer.
+TEST_F(TestTaskStream, TestConcurrentProducers) {
+  using namespace std::placeholders;
+  constexpr int kNumProducers = 8;
+  constexpr int kItemsPerProducer = 10000;
+  constexpr int32_t kQueueMaxSize = 16;
+
+  std::unique_ptr<ThreadPool> thread_pool;
+  ASSERT_OK(BuildMinMaxTestPool(1, 1, &thread_pool));
+
+  std::atomic<int32_t> counter(0);
+  std::function<void (TestItem*)> f = std::bind(&SimpleTaskStreamMethod, _1, &counter);
+
+  TaskStream<TestItem> taskStream(f, thread_pool.get(), kQueueMaxSize, kTaskstreamQueueMaxWait);
+  ASSERT_OK(taskStream.Start());
+  std::vector<std::vector<TestItem>> items(kNumProducers);
+  std::vector<std::thread> producers;
+  std::atomic<int> failures(0);
+  for (auto& producer_items : items) {
+    producer_items.assign(kItemsPerProducer, TestItem(1));
+    producers.emplace_back([&taskStream, &producer_items, &failures] {
+      for (auto& item : producer_items) {
+        if (!taskStream.Submit(&item).ok()) {
+          ++failures;
+        }
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  thread_pool->Wait();
+  ASSERT_EQ(0, failures.load());
+  ASSERT_EQ(kNumProducers * kItemsPerProducer, counter.load(std::memory_order_acquire));
+  taskStream.Stop();
+  thread_pool->Shutdown();
+}
 } // namespace yb
@@ -19,10 +19,12 @@
 #include <memory>
 #include <vector>
 
+#include "yb/gutil/atomicops.h"
+
 #include "yb/util/flags.h"
 
 #include "yb/util/status_fwd.h"
-#include "yb/util/blocking_queue.h"
+#include "yb/util/lockfree.h"
 #include "yb/util/status_format.h"
 #include "yb/util/thread.h"
 #include "yb/util/threadpool.h"
@@ -48,6 +50,10 @@ template <typename T>
 // When the queue is empty, it calls the user-provided function with no parameter,
 // to indicate it needs to process the end of the group of tasks processed.
 // This feature is used for the preparer and appender functionality.
+//
+// Tasks are linked into a lock-free multi producer single consumer queue, so T should be linkable
+// by SetNext/GetNext, e.g. derived from MPSCQueueEntry<T>. Submitters only take a lock when the
+// queue is full, or to wake up the consumer that is parked waiting for tasks.
 class TaskStream {
  public:
   explicit TaskStream(std::function<void(T*)> process_item,
@@ -72,12 +78,15 @@ class TaskStream {
   }
 
   std::string ToString() const {
-    return YB_CLASS_TO_STRING(queue, run_state, stopped, stop_requested);
+    return YB_CLASS_TO_STRING(queue_size, run_state, stopped, stop_requested);
   }
 
  private:
   using RunState = TaskStreamRunState;
 
+  // Number of times the consumer polls the empty queue before parking.
+  static constexpr int kSpinIterations = 1000;
+
   void ChangeRunState(RunState expected_old_state, RunState new_state) {
     auto old_state = run_state_.exchange(new_state, std::memory_order_acq_rel);
     LOG_IF(DFATAL, old_state != expected_old_state)
@@ -85,6 +94,19 @@ class TaskStream {
         << expected_old_state << " was expected";
   }
 
+  // Reserves place for a new item in the queue, waiting while the queue is full.
+  // Returns false if the queue was shut down.
+  bool ReserveQueueSpace();
+
+  // Pops all available items to group, spinning and then parking until deadline while the queue is
+  // empty.
+  void DrainQueue(std::vector<T*>* group, MonoTime deadline);
+
+  // Wakes up the threads parked in ReserveQueueSpace or DrainQueue, if any.
+  void NotifyWaiters(const std::atomic<size_t>& num_waiters, std::condition_variable* cond);
+
+  void ShutdownQueue();
+
   // We set this to true to tell the Run function to return. No new tasks will be accepted, but
   // existing tasks will still be processed.
   std::atomic<bool> stop_requested_{false};
@@ -95,7 +117,21 @@ class TaskStream {
   std::atomic<bool> stopped_{false};
 
   // The objects in the queue are owned by the queue and ownership gets tranferred to ProcessItem.
-  BlockingQueue<T*> queue_;
+  // Only Run pops from the queue, and it is executed by a single thread at a time.
+  MPSCQueue<T> queue_;
+
+  // Number of submitted items that are not popped yet. It is incremented before the item is
+  // pushed, so it could be temporarily greater than the actual queue length.
+  std::atomic<size_t> queue_size_{0};
+  const size_t queue_max_size_;
+  std::atomic<bool> queue_shutdown_{false};
+
+  // Used to park submitters waiting for space in the queue, and the consumer waiting for items.
+  std::mutex queue_mutex_;
+  std::condition_variable queue_not_full_;
+  std::condition_variable queue_not_empty_;
+  std::atomic<size_t> num_waiting_submitters_{0};
+  std::atomic<size_t> num_waiting_consumers_{0};
 
   // This mutex/condition combination is used in Stop() in case multiple threads are calling that
   // function concurrently. One of them will ask the taskstream thread to stop and wait for it, and
@@ -119,7 +155,7 @@ TaskStream<T>::TaskStream(std::function<void(T*)> process_item,
                           ThreadPool* thread_pool,
                           int32_t queue_max_size,
                           const MonoDelta& queue_max_wait)
-    : queue_(queue_max_size),
+    : queue_max_size_(queue_max_size),
       // run_state_ is responsible for serial execution, so we use concurrent here to avoid
       // unnecessary checks in thread pool.
       taskstream_pool_token_(thread_pool->NewToken(ThreadPool::ExecutionMode::CONCURRENT)),
@@ -144,7 +180,7 @@ void TaskStream<T>::Stop() {
   auto scope_exit = ScopeExit([] {
     VLOG(1) << "The TaskStream has stopped";
   });
-  queue_.Shutdown();
+  ShutdownQueue();
   if (stopped_.load(std::memory_order_acquire)) {
     return;
   }
@@ -152,32 +188,112 @@ void TaskStream<T>::Stop() {
   {
     std::unique_lock<std::mutex> stop_lock(stop_mtx_);
     stop_cond_.wait(stop_lock, [this] {
-      return (run_state_.load(std::memory_order_acquire) == RunState::kIdle && queue_.empty());
+      return (run_state_.load(std::memory_order_acquire) == RunState::kIdle &&
+              queue_size_.load(std::memory_order_acquire) == 0);
     });
   }
   stopped_.store(true, std::memory_order_release);
 }
 
+template <typename T>
+void TaskStream<T>::ShutdownQueue() {
+  std::lock_guard lock(queue_mutex_);
+  queue_shutdown_.store(true, std::memory_order_release);
+  queue_not_full_.notify_all();
+  queue_not_empty_.notify_all();
+}
+
+template <typename T>
+void TaskStream<T>::NotifyWaiters(
+    const std::atomic<size_t>& num_waiters, std::condition_variable* cond) {
+  // Waiters register themselves before checking the queue size, so either the waiter sees the
+  // updated queue size, or we see the waiter.
+  if (num_waiters.load(std::memory_order_seq_cst) == 0) {
+    return;
+  }
+  std::lock_guard lock(queue_mutex_);
+  cond->notify_all();
+}
+
+template <typename T>
+bool TaskStream<T>::ReserveQueueSpace() {
+  auto size = queue_size_.load(std::memory_order_acquire);
+  for (;;) {
+    if (queue_shutdown_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    if (size < queue_max_size_) {
+      if (queue_size_.compare_exchange_weak(size, size + 1, std::memory_order_seq_cst)) {
+        return true;
+      }
+      continue;
+    }
+    std::unique_lock lock(queue_mutex_);
+    num_waiting_submitters_.fetch_add(1, std::memory_order_seq_cst);
+    queue_not_full_.wait(lock, [this] {
+      return queue_shutdown_.load(std::memory_order_acquire) ||
+             queue_size_.load(std::memory_order_seq_cst) < queue_max_size_;
+    });
+    num_waiting_submitters_.fetch_sub(1, std::memory_order_relaxed);
+    size = queue_size_.load(std::memory_order_acquire);
+  }
+}
+
 template <typename T>
 Status TaskStream<T>::Submit(T *task) {
   if (stop_requested_.load(std::memory_order_acquire)) {
     return STATUS(IllegalState, "Tablet is shutting down");
   }
-  if (!queue_.BlockingPut(task)) {
+  if (!ReserveQueueSpace()) {
     return STATUS_FORMAT(ServiceUnavailable,
                          "TaskStream queue is full (max capacity $0)",
-                         queue_.max_size());
+                         queue_max_size_);
   }
+  queue_.Push(task);
+  NotifyWaiters(num_waiting_consumers_, &queue_not_empty_);
 
   RunState expected = RunState::kIdle;
   if (!run_state_.compare_exchange_strong(
-          expected, RunState::kSubmit, std::memory_order_acq_rel)) {
+          expected, RunState::kSubmit, std::memory_order_seq_cst)) {
     // run_state_ was not idle, so we are not creating a task to process operations.
     return Status::OK();
   }
   return taskstream_pool_token_->SubmitFunc(std::bind(&TaskStream::Run, this));
 }
 
+template <typename T>
+void TaskStream<T>::DrainQueue(std::vector<T*>* group, MonoTime deadline) {
+  for (int spin = 0;; ++spin) {
+    while (auto* item = queue_.Pop()) {
+      group->push_back(item);
+    }
+    if (!group->empty()) {
+      queue_size_.fetch_sub(group->size(), std::memory_order_seq_cst);
+      NotifyWaiters(num_waiting_submitters_, &queue_not_full_);
+      return;
+    }
+    if (queue_size_.load(std::memory_order_acquire) != 0) {
+      // Item is being pushed.
+      base::subtle::PauseCPU();
+      continue;
+    }
+    if (spin < kSpinIterations) {
+      base::subtle::PauseCPU();
+      continue;
+    }
+    std::unique_lock lock(queue_mutex_);
+    num_waiting_consumers_.fetch_add(1, std::memory_order_seq_cst);
+    bool ready = queue_not_empty_.wait_until(lock, deadline.ToSteadyTimePoint(), [this] {
+      return queue_shutdown_.load(std::memory_order_acquire) ||
+             queue_size_.load(std::memory_order_seq_cst) != 0;
+    });
+    num_waiting_consumers_.fetch_sub(1, std::memory_order_relaxed);
+    if (!ready || queue_size_.load(std::memory_order_acquire) == 0) {
+      return;
+    }
+  }
+}
+
 template <typename T>
 Status TaskStream<T>::TEST_SubmitFunc(const std::function<void()>& func) {
   return taskstream_pool_token_->SubmitFunc(func);
@@ -188,10 +304,10 @@ void TaskStream<T>::Run() {
   VLOG(1) << "Starting taskstream task:" << this;
   ChangeRunState(RunState::kSubmit, RunState::kDrain);
   run_tid_ = Thread::CurrentThreadIdForStack();
+  std::vector<T *> group;
   for (;;) {
     MonoTime wait_timeout_deadline = MonoTime::Now() + queue_max_wait_;
-    std::vector<T *> group;
-    queue_.BlockingDrainTo(&group, wait_timeout_deadline);
+    DrainQueue(&group, wait_timeout_deadline);
     if (!group.empty()) {
       ChangeRunState(RunState::kDrain, RunState::kProcess);
       for (T* item : group) {
@@ -207,7 +323,10 @@ void TaskStream<T>::Run() {
     // Not processing and queue empty, return from task.
     std::unique_lock<std::mutex> stop_lock(stop_mtx_);
     ChangeRunState(RunState::kFinish, RunState::kIdle);
-    if (!queue_.empty()) {
+    // Pairs with the run state check in Submit, so either Submit sees the idle state, or we see
+    // the submitted item.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (queue_size_.load(std::memory_order_seq_cst) != 0) {
       // Got more operations, try stay in the loop.
       RunState expected = RunState::kIdle;
       if (run_state_.compare_exchange_strong(
@@ -0,0 +1,125 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "yb/util/random_util.h"
+#include "yb/util/test_util.h"
+#include "yb/util/timing_wheel.h"
+
+using namespace std::literals;
+
+namespace yb {
+
+using Clock = std::chrono::steady_clock;
+using TestTimingWheel = TimingWheel<int, int, Clock>;
+
+class TimingWheelTest : public YBTest {
+ protected:
+  std::vector<int> Advance(Clock::duration delta) {
+    now_ += delta;
+    std::vector<int> result;
+    wheel_.Advance(now_, [this, &result](int key, int value) {
+      EXPECT_EQ(key, value);
+      result.push_back(key);
+    });
+    return result;
+  }
+
+  const Clock::time_point start_ = Clock::now();
+  Clock::time_point now_ = start_;
+  TestTimingWheel wheel_{1ms, start_};
+};
+
+TEST_F(TimingWheelTest, Simple) {
+  wheel_.Schedule(1, 1, now_ + 5ms);
+  wheel_.Schedule(2, 2, now_ + 300ms);
+  wheel_.Schedule(3, 3, now_ + 1h);
+  ASSERT_EQ(wheel_.size(), 3);
+  ASSERT_EQ(wheel_.NextExpirationTime(), now_ + 5ms);
+
+  ASSERT_EQ(Advance(4ms), std::vector<int>());
+  ASSERT_EQ(Advance(1ms), std::vector<int>{1});
+  ASSERT_EQ(Advance(294ms), std::vector<int>());
+  ASSERT_EQ(Advance(1ms), std::vector<int>{2});
+
+  // Rescheduled entry expires only at the new time.
+  wheel_.Schedule(3, 3, now_ + 10ms);
+  ASSERT_EQ(Advance(10ms), std::vector<int>{3});
+  ASSERT_EQ(Advance(2h), std::vector<int>());
+  ASSERT_TRUE(wheel_.empty());
+  ASSERT_EQ(wheel_.NextExpirationTime(), Clock::time_point::max());
+}
+
+TEST_F(TimingWheelTest, Erase) {
+  wheel_.Schedule(1, 1, now_ + 1s);
+  wheel_.Schedule(2, 2, now_ + 1s);
+  ASSERT_EQ(wheel_.Erase(1).value_or(0), 1);
+  ASSERT_FALSE(wheel_.Erase(1).has_value());
+  ASSERT_EQ(Advance(1s), std::vector<int>{2});
+}
+
+TEST_F(TimingWheelTest, RescheduleFromCallback) {
+  wheel_.Schedule(1, 1, now_ + 10ms);
+  int num_calls = 0;
+  for (int i = 0; i != 5; ++i) {
+    now_ += 10ms;
+    wheel_.Advance(now_, [this, &num_calls](int key, int value) {
+      ++num_calls;
+      wheel_.Schedule(key, value, now_ + 10ms);
+    });
+  }
+  ASSERT_EQ(num_calls, 5);
+  ASSERT_EQ(wheel_.size(), 1);
+}
+
+// Compares expiration of random entries with the ordered map of deadlines.
+TEST_F(TimingWheelTest, Random) {
+  constexpr int kNumKeys = 1000;
+  constexpr int kNumSteps = 10000;
+
+  std::map<int, Clock::time_point> deadlines;
+  for (int step = 0; step != kNumSteps; ++step) {
+    auto key = RandomUniformInt(0, kNumKeys - 1);
+    if (RandomUniformInt(0, 9) == 0) {
+      ASSERT_EQ(wheel_.Erase(key).has_value(), deadlines.erase(key) != 0);
+    } else {
+      // Mix of short and long delays, so entries are placed at all levels.
+      auto delay = RandomUniformInt(0, 3) == 0
+          ? RandomUniformInt<int64_t>(1, 100000000) * 1ms
+          : RandomUniformInt<int64_t>(1, 1000) * 1ms;
+      wheel_.Schedule(key, key, now_ + delay);
+      deadlines[key] = now_ + delay;
+    }
+
+    auto expired = Advance(RandomUniformInt<int64_t>(0, 1000) * 1ms);
+    std::sort(expired.begin(), expired.end());
+    std::vector<int> expected;
+    for (auto it = deadlines.begin(); it != deadlines.end();) {
+      if (it->second <= now_) {
+        expected.push_back(it->first);
+        it = deadlines.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    ASSERT_EQ(expired, expected) << "Step: " << step;
+    ASSERT_EQ(wheel_.size(), deadlines.size());
+  }
+}
+
+} // namespace yb
@@ -0,0 +1,268 @@
+// Copyright (c) YugabyteDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "yb/util/logging.h"
+
+namespace yb {
+
+// Hierarchical timing wheel, that tracks deadlines of a large number of entries identified by key.
+//
+// Time is divided into ticks. Level 0 has a slot for each of the next kSlotsPerLevel ticks, and
+// slots of every next level are kSlotsPerLevel times wider. An entry is placed into the lowest level
+// whose slot covers its deadline, and is moved to a lower level when the wheel reaches its slot.
+// So scheduling and erasing an entry takes O(1), and an entry is moved at most kNumLevels times.
+//
+// Entry expires at the first tick that is not earlier than its deadline, i.e. up to one tick late.
+//
+// Erased and rescheduled entries are removed from slots lazily, when their slot is reached.
+//
+// Not thread safe.
+template <class Key, class Value, class Clock>
+class TimingWheel {
+ public:
+  using TimePoint = typename Clock::time_point;
+  using Duration = typename Clock::duration;
+
+  static constexpr size_t kBitsPerLevel = 8;
+  static constexpr size_t kSlotsPerLevel = 1ULL << kBitsPerLevel;
+  static constexpr size_t kNumLevels = 4;
+  // Deadlines further than this number of ticks from now are postponed until it is closer.
+  static constexpr uint64_t kMaxTicks = (1ULL << (kBitsPerLevel * kNumLevels)) - 1;
+
+  TimingWheel(Duration tick, TimePoint start) : tick_(tick), start_(start) {
+    CHECK_GT(tick.count(), 0);
+  }
+
+  // Schedules entry to expire at the specified time. Replaces the entry with the same key.
+  void Schedule(const Key& key, Value value, TimePoint time) {
+    auto tick = std::max(CeilTick(time), current_tick_ + 1);
+    auto [it, inserted] = entries_.try_emplace(key, std::move(value), tick);
+    if (!inserted) {
+      it->second = Entry(std::move(value), tick);
+    }
+    Place(key, tick);
+  }
+
+  // Removes the entry with the specified key, returning its value if it was present.
+  std::optional<Value> Erase(const Key& key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return std::nullopt;
+    }
+    std::optional<Value> result(std::move(it->second.value));
+    entries_.erase(it);
+    return result;
+  }
+
+  // Calls f(key, value) for each entry that expired by now, in order of expiration ticks. Entry is
+  // removed before the call, so f could schedule it again.
+  template <class F>
+  void Advance(TimePoint now, const F& f) {
+    const auto target_tick = FloorTick(now);
+    while (current_tick_ < target_tick) {
+      if (entries_.empty()) {
+        ClearSlots();
+        current_tick_ = target_tick;
+        break;
+      }
+      // Skip ticks that do not have entries at lower levels.
+      auto skip_bits = EmptyLowerLevels() * kBitsPerLevel;
+      if (skip_bits) {
+        auto boundary = ((current_tick_ >> skip_bits) + 1) << skip_bits;
+        current_tick_ = std::min(boundary, target_tick + 1) - 1;
+        if (current_tick_ == target_tick) {
+          break;
+        }
+      }
+      ++current_tick_;
+      Cascade();
+      ExpireSlot(f);
+    }
+  }
+
+  // Returns the time when the wheel could have expired entries, i.e. the next tick with a non empty
+  // slot at level 0, or the next tick when entries are moved from higher levels.
+  // Returns TimePoint::max() if the wheel is empty.
+  TimePoint NextExpirationTime() const {
+    if (entries_.empty()) {
+      return TimePoint::max();
+    }
+    auto skip_bits = EmptyLowerLevels() * kBitsPerLevel;
+    if (skip_bits) {
+      return TickToTime(((current_tick_ >> skip_bits) + 1) << skip_bits);
+    }
+    const auto& slots = levels_[0].slots;
+    auto tick = current_tick_ + 1;
+    while (slots[tick & kSlotMask].empty() && (tick & kSlotMask) != 0) {
+      ++tick;
+    }
+    return TickToTime(tick);
+  }
+
+  template <class F>
+  void ForEach(const F& f) const {
+    for (const auto& [key, entry] : entries_) {
+      f(key, entry.value);
+    }
+  }
+
+  void Clear() {
+    entries_.clear();
+    ClearSlots();
+  }
+
+  size_t size() const {
+    return entries_.size();
+  }
+
+  bool empty() const {
+    return entries_.empty();
+  }
+
+ private:
+  static constexpr uint64_t kSlotMask = kSlotsPerLevel - 1;
+
+  struct Entry {
+    Value value;
+    uint64_t tick;
+
+    Entry(Value value_, uint64_t tick_) : value(std::move(value_)), tick(tick_) {}
+  };
+
+  // Slot entry is stale if the entry with its key was erased or scheduled to another tick.
+  struct SlotEntry {
+    Key key;
+    uint64_t tick;
+  };
+
+  using Slot = std::vector<SlotEntry>;
+
+  struct Level {
+    std::array<Slot, kSlotsPerLevel> slots;
+    // Number of slot entries at this level, including stale ones.
+    size_t size = 0;
+  };
+
+  uint64_t FloorTick(TimePoint time) const {
+    return time <= start_ ? 0 : static_cast<uint64_t>((time - start_) / tick_);
+  }
+
+  uint64_t CeilTick(TimePoint time) const {
+    if (time <= start_) {
+      return 0;
+    }
+    auto diff = time - start_;
+    return static_cast<uint64_t>(diff / tick_) + (diff % tick_ != Duration::zero());
+  }
+
+  TimePoint TickToTime(uint64_t tick) const {
+    return start_ + tick_ * static_cast<int64_t>(tick);
+  }
+
+  // Returns the number of lowest levels that are empty, except the top one.
+  size_t EmptyLowerLevels() const {
+    size_t result = 0;
+    while (result + 1 < kNumLevels && levels_[result].size == 0) {
+      ++result;
+    }
+    return result;
+  }
+
+  void Place(const Key& key, uint64_t tick) {
+    auto position = std::min(tick, current_tick_ + kMaxTicks);
+    size_t level = 0;
+    while (level + 1 < kNumLevels &&
+           (position >> (kBitsPerLevel * (level + 1))) !=
+               (current_tick_ >> (kBitsPerLevel * (level + 1)))) {
+      ++level;
+    }
+    auto& slot = levels_[level].slots[(position >> (kBitsPerLevel * level)) & kSlotMask];
+    slot.push_back(SlotEntry { .key = key, .tick = tick });
+    ++levels_[level].size;
+  }
+
+  bool IsStale(const SlotEntry& slot_entry) const {
+    auto it = entries_.find(slot_entry.key);
+    return it == entries_.end() || it->second.tick != slot_entry.tick;
+  }
+
+  // Moves entries from higher level slots that are reached at current_tick_ to lower levels.
+  void Cascade() {
+    for (auto level = kNumLevels; --level > 0;) {
+      auto shift = kBitsPerLevel * level;
+      if (current_tick_ & ((1ULL << shift) - 1)) {
+        continue;
+      }
+      Slot slot;
+      slot.swap(levels_[level].slots[(current_tick_ >> shift) & kSlotMask]);
+      levels_[level].size -= slot.size();
+      for (const auto& slot_entry : slot) {
+        if (!IsStale(slot_entry)) {
+          Place(slot_entry.key, slot_entry.tick);
+        }
+      }
+    }
+  }
+
+  template <class F>
+  void ExpireSlot(const F& f) {
+    auto& level = levels_[0];
+    if (level.slots[current_tick_ & kSlotMask].empty()) {
+      return;
+    }
+    Slot slot;
+    slot.swap(level.slots[current_tick_ & kSlotMask]);
+    level.size -= slot.size();
+    for (const auto& slot_entry : slot) {
+      auto it = entries_.find(slot_entry.key);
+      if (it == entries_.end() || it->second.tick != slot_entry.tick) {
+        continue;
+      }
+      auto value = std::move(it->second.value);
+      entries_.erase(it);
+      f(slot_entry.key, std::move(value));
+    }
+  }
+
+  void ClearSlots() {
+    for (auto& level : levels_) {
+      if (level.size == 0) {
+        continue;
+      }
+      for (auto& slot : level.slots) {
+        slot.clear();
+      }
+      level.size = 0;
+    }
+  }
+
+  const Duration tick_;
+  const TimePoint start_;
+  // All entries with ticks up to and including current_tick_ have expired.
+  uint64_t current_tick_ = 0;
+  std::unordered_map<Key, Entry> entries_;
+  std::array<Level, kNumLevels> levels_;
+};
+
+} // namespace yb
@@ -1049,6 +1049,9 @@ unique_ptr<CQLResponse> CQLProcessor::ProcessResult(const ExecutedResult::Shared
     }
     case ExecutedResult::Type::SCHEMA_CHANGE: {
       const auto& schema_change_result = static_cast<const SchemaChangeResult&>(*result);
+      if (service_impl_->system_cache() != nullptr) {
+        service_impl_->system_cache()->Invalidate();
+      }
       return make_unique<SchemaChangeResultResponse>(*request_, schema_change_result);
     }
 
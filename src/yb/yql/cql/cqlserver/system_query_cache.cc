@@ -20,6 +20,8 @@
 #include "yb/yql/cql/cqlserver/system_query_cache.h"
 
 #include <algorithm>
+#include <cctype>
+#include <cstring>
 #include <condition_variable>
 #include <mutex>
 #include <unordered_map>
@@ -72,6 +74,42 @@ static bool parse_tables(
   return true;
 }
 
+// Returns the query in the form used as the cache key: letters outside of quotes are lower-cased,
+// whitespace is collapsed and removed around punctuation, and the trailing semicolon is dropped.
+// So variants of the same query sent by different drivers share the cached result.
+static std::string normalize_query(const std::string& query) {
+  std::string result;
+  result.reserve(query.size());
+  char quote = 0;
+  bool pending_space = false;
+  for (char ch : query) {
+    if (quote) {
+      result.push_back(ch);
+      if (ch == quote) {
+        quote = 0;
+      }
+      continue;
+    }
+    if (isspace(static_cast<unsigned char>(ch))) {
+      pending_space = !result.empty();
+      continue;
+    }
+    const bool is_punct = ch == '=' || ch == ',' || ch == '(' || ch == ')' || ch == ';';
+    if (pending_space && !is_punct && !strchr("=,(", result.back())) {
+      result.push_back(' ');
+    }
+    pending_space = false;
+    if (ch == '\'' || ch == '"') {
+      quote = ch;
+    }
+    result.push_back(static_cast<char>(tolower(static_cast<unsigned char>(ch))));
+  }
+  while (!result.empty() && result.back() == ';') {
+    result.pop_back();
+  }
+  return result;
+}
+
 static bool validate_tables(const char* flagname, const std::string& value) {
   std::vector<QualifiedTable> tables;
 
@@ -100,9 +138,8 @@ namespace cqlserver {
 using ql::RowsResult;
 using ql::ExecutedResult;
 
-// TODO: Possibly do a case-insensitive string comparison.  This may be easier
-// said than done, since capitalization does matter for comparisons in WHERE
-// clauses, etc.
+// Queries are looked up in normalized form, see normalize_query, so capitalization and spacing of
+// the queries sent by clients do not matter except inside of quotes.
 const char* SYSTEM_QUERIES[] = {
   "SELECT * FROM system.peers",
   "SELECT peer, rpc_address, schema_version FROM system.peers",
@@ -115,9 +152,6 @@ const char* SYSTEM_QUERIES[] = {
 
   "SELECT * FROM system.local WHERE key='local'",
   "SELECT schema_version FROM system.local WHERE key='local'",
-  // The client evidently doesn't always have consistent formatting.
-  "select * from system.local where key = 'local'",
-  "select schema_version from system.local where key='local'",
   "SELECT * FROM system_schema.keyspaces",
   "SELECT * FROM system_schema.tables",
   "SELECT * FROM system_schema.views",
@@ -193,9 +227,10 @@ boost::optional<RowsResult::SharedPtr> SystemQueryCache::Lookup(const std::strin
       GetStaleness() > MonoDelta::FromMilliseconds(FLAGS_cql_system_query_cache_stale_msecs)) {
     return boost::none;
   }
+  const auto key = normalize_query(query);
   const std::lock_guard l(cache_mutex_);
 
-  const auto it = cache_->find(query);
+  const auto it = cache_->find(key);
   if (it == cache_->end()) {
     return boost::none;
   } else {
@@ -208,7 +243,7 @@ MonoDelta SystemQueryCache::GetStaleness() {
   return MonoTime::Now() - last_updated_;
 }
 
-void SystemQueryCache::RefreshCache() {
+void SystemQueryCache::RefreshCache(bool reschedule) {
   VLOG(1) << "Refreshing system query cache";
   auto new_cache = std::make_unique<std::unordered_map<std::string, RowsResult::SharedPtr>>();
   for (auto query : queries_) {
@@ -220,7 +255,7 @@ void SystemQueryCache::RefreshCache() {
       auto rows_result = std::dynamic_pointer_cast<RowsResult>(result);
       if (FLAGS_cql_system_query_cache_empty_responses ||
           rows_result->GetRowBlock()->row_count() > 0) {
-        (*new_cache)[query] = rows_result;
+        (*new_cache)[normalize_query(query)] = rows_result;
       } else {
         LOG(INFO) << "Skipping empty result for statement: " << query;
       }
@@ -228,7 +263,9 @@ void SystemQueryCache::RefreshCache() {
       LOG(WARNING) << "Could not execute statement: " << query << "; status: " << status.ToString();
       // We don't want to update the cache with no data; instead we'll let the
       // stale cache persist.
-      ScheduleRefreshCache(false /* now */);
+      if (reschedule) {
+        ScheduleRefreshCache(false /* now */);
+      }
       return;
     }
   }
@@ -239,7 +276,17 @@ void SystemQueryCache::RefreshCache() {
     last_updated_ = MonoTime::Now();
   }
 
-  ScheduleRefreshCache(false /* now */);
+  if (reschedule) {
+    ScheduleRefreshCache(false /* now */);
+  }
+}
+
+void SystemQueryCache::Invalidate() {
+  {
+    const std::lock_guard l(cache_mutex_);
+    cache_->clear();
+  }
+  ScheduleRefreshCache(true /* now */);
 }
 
 void SystemQueryCache::ScheduleRefreshCache(bool now) {
@@ -247,12 +294,13 @@ void SystemQueryCache::ScheduleRefreshCache(bool now) {
   DCHECK(scheduler_);
   VLOG(1) << "Scheduling cache refresh";
 
-  scheduler_->Schedule([this](const Status &s) {
+  // Immediate refreshes are one-off, the periodic refresh keeps rescheduling itself.
+  scheduler_->Schedule([this, now](const Status &s) {
       if (!s.ok()) {
         LOG(INFO) << "System cache updater scheduler was shutdown: " << s.ToString();
         return;
       }
-      this->RefreshCache();
+      this->RefreshCache(!now /* reschedule */);
       }, std::chrono::milliseconds(now ? 0 : FLAGS_cql_update_system_query_cache_msecs));
 }
 
@@ -55,9 +55,13 @@ class SystemQueryCache {
 
     MonoDelta GetStaleness();
 
+    // Drops cached results and refreshes them right away. Called after a schema change, so the
+    // results of metadata queries do not lag behind DDLs executed by this server.
+    void Invalidate();
+
  private:
     void InitializeQueries();
-    void RefreshCache();
+    void RefreshCache(bool reschedule);
     void ScheduleRefreshCache(bool now);
     void ExecuteSync(const std::string& stmt, Status* status,
         ExecutedResult::SharedPtr* result_ptr);
@@ -948,36 +948,16 @@ Status Executor::ExecPTNode(const PTSelectStmt *tnode, TnodeContext* tnode_conte
 
   req->set_is_forward_scan(tnode->is_forward_scan());
 
-  // Specify selected list by adding the expressions to selected_exprs in read request.
-  QLRSRowDescPB *rsrow_desc_pb = req->mutable_rsrow_desc();
-  for (const auto& expr : tnode->selected_exprs()) {
-    if (expr->opcode() == TreeNodeOpcode::kPTAllColumns) {
-      const Status s = PTExprToPB(static_cast<const PTAllColumns*>(expr.get()), req);
-      if (PREDICT_FALSE(!s.ok())) {
-        return exec_context_->Error(expr, s, ErrorCode::INVALID_ARGUMENTS);
-      }
-    } else {
-      const Status s = PTExprToPB(expr, req->add_selected_exprs());
-      if (PREDICT_FALSE(!s.ok())) {
-        return exec_context_->Error(expr, s, ErrorCode::INVALID_ARGUMENTS);
-      }
-
-      // Add the expression metadata (rsrow descriptor).
-      QLRSColDescPB *rscol_desc_pb = rsrow_desc_pb->add_rscol_descs();
-      rscol_desc_pb->set_name(expr->QLName());
-      expr->rscol_type_PB(rscol_desc_pb->mutable_ql_type());
-    }
-  }
-
-  // Setup the column values that need to be read.
-  Status s = ColumnRefsToPB(tnode, req->mutable_column_refs());
-  if (PREDICT_FALSE(!s.ok())) {
-    return exec_context_->Error(tnode, s, ErrorCode::INVALID_ARGUMENTS);
+  auto projection_template = tnode->projection_template();
+  if (projection_template) {
+    req->MergeFrom(*projection_template);
+  } else {
+    RETURN_NOT_OK(SelectedExprsToPB(tnode, req));
   }
 
   // Set the IF clause.
   if (tnode->if_clause() != nullptr) {
-    s = PTExprToPB(tnode->if_clause(), select_op->mutable_request()->mutable_if_expr());
+    auto s = PTExprToPB(tnode->if_clause(), select_op->mutable_request()->mutable_if_expr());
     if (PREDICT_FALSE(!s.ok())) {
       return exec_context_->Error(tnode->if_clause(), s, ErrorCode::INVALID_ARGUMENTS);
     }
@@ -1094,6 +1074,49 @@ Status Executor::ExecPTNode(const PTSelectStmt *tnode, TnodeContext* tnode_conte
   return Status::OK();
 }
 
+Status Executor::SelectedExprsToPB(const PTSelectStmt* tnode, QLReadRequestPB* req) {
+  // Only column references are converted to the same request fields on every execution, other
+  // expressions could contain bind variables.
+  bool only_column_refs = true;
+
+  // Specify selected list by adding the expressions to selected_exprs in read request.
+  QLRSRowDescPB *rsrow_desc_pb = req->mutable_rsrow_desc();
+  for (const auto& expr : tnode->selected_exprs()) {
+    if (expr->opcode() == TreeNodeOpcode::kPTAllColumns) {
+      const Status s = PTExprToPB(static_cast<const PTAllColumns*>(expr.get()), req);
+      if (PREDICT_FALSE(!s.ok())) {
+        return exec_context_->Error(expr, s, ErrorCode::INVALID_ARGUMENTS);
+      }
+    } else {
+      only_column_refs = only_column_refs && expr->opcode() == TreeNodeOpcode::kPTRef;
+      const Status s = PTExprToPB(expr, req->add_selected_exprs());
+      if (PREDICT_FALSE(!s.ok())) {
+        return exec_context_->Error(expr, s, ErrorCode::INVALID_ARGUMENTS);
+      }
+
+      // Add the expression metadata (rsrow descriptor).
+      QLRSColDescPB *rscol_desc_pb = rsrow_desc_pb->add_rscol_descs();
+      rscol_desc_pb->set_name(expr->QLName());
+      expr->rscol_type_PB(rscol_desc_pb->mutable_ql_type());
+    }
+  }
+
+  // Setup the column values that need to be read.
+  Status s = ColumnRefsToPB(tnode, req->mutable_column_refs());
+  if (PREDICT_FALSE(!s.ok())) {
+    return exec_context_->Error(tnode, s, ErrorCode::INVALID_ARGUMENTS);
+  }
+
+  if (only_column_refs && tnode->ShouldBuildProjectionTemplate()) {
+    auto projection_template = std::make_shared<QLReadRequestPB>();
+    *projection_template->mutable_selected_exprs() = req->selected_exprs();
+    *projection_template->mutable_rsrow_desc() = req->rsrow_desc();
+    *projection_template->mutable_column_refs() = req->column_refs();
+    tnode->set_projection_template(std::move(projection_template));
+  }
+  return Status::OK();
+}
+
 Result<QueryPagingState*> Executor::LoadPagingStateFromUser(const PTSelectStmt* tnode,
                                                             TnodeContext* tnode_context) {
   QueryPagingState *query_state = tnode_context->query_state();
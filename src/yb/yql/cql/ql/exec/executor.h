@@ -241,6 +241,9 @@ class Executor : public qlexpr::QLExprExecutor {
   // Append rows result.
   Status AppendRowsResult(RowsResult::SharedPtr&& rows_result);
 
+  // Set selected expressions, result set descriptor and referenced columns of the read request.
+  Status SelectedExprsToPB(const PTSelectStmt* tnode, QLReadRequestPB* req);
+
   // Read paging state from user's StatementParams.
   Result<QueryPagingState*> LoadPagingStateFromUser(const PTSelectStmt* tnode,
                                                     TnodeContext* tnode_context);
@@ -434,6 +434,16 @@ PTSelectStmt::PTSelectStmt(MemoryContext *memctx,
 PTSelectStmt::~PTSelectStmt() {
 }
 
+std::shared_ptr<const QLReadRequestPB> PTSelectStmt::projection_template() const {
+  std::lock_guard lock(projection_template_mutex_);
+  return projection_template_;
+}
+
+void PTSelectStmt::set_projection_template(std::shared_ptr<const QLReadRequestPB> value) const {
+  std::lock_guard lock(projection_template_mutex_);
+  projection_template_ = std::move(value);
+}
+
 Status PTSelectStmt::LookupIndex(SemContext *sem_context) {
   VLOG(3) << "Loading table descriptor for index " << index_id_;
   table_ = sem_context->GetTableDesc(index_id_);
@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 #include "yb/yql/cql/ql/ptree/list_node.h"
 #include "yb/yql/cql/ql/ptree/tree_node.h"
 #include "yb/yql/cql/ql/ptree/pt_name.h"
@@ -25,6 +29,9 @@
 #include "yb/qlexpr/qlexpr_fwd.h"
 
 namespace yb {
+
+class QLReadRequestPB;
+
 namespace ql {
 
 //--------------------------------------------------------------------------------------------------
@@ -446,6 +453,18 @@ class PTSelectStmt : public PTDmlStmt {
     return false;
   }
 
+  // Selected expressions, result set descriptor and referenced columns of the read request. They
+  // don't depend on bind values, so they are built on the first execution of the statement and
+  // copied to the requests of its later executions.
+  std::shared_ptr<const QLReadRequestPB> projection_template() const;
+  void set_projection_template(std::shared_ptr<const QLReadRequestPB> value) const;
+
+  // Returns true when the statement was executed before, so the template is worth building.
+  // Statements executed once, e.g. unprepared queries, don't build it.
+  bool ShouldBuildProjectionTemplate() const {
+    return executed_without_projection_template_.exchange(true, std::memory_order_acq_rel);
+  }
+
  private:
   // Analyze the components of a SELECT.
   Status LookupIndex(SemContext *sem_context);
@@ -516,6 +535,11 @@ class PTSelectStmt : public PTDmlStmt {
   // Flag for a top level SELECT.
   // Although CQL does not have nested SELECT, YugaByte treats INDEX query as a nested DML.
   bool is_top_level_ = true;
+
+  // The tree of a prepared statement is shared by concurrent executions.
+  mutable std::mutex projection_template_mutex_;
+  mutable std::shared_ptr<const QLReadRequestPB> projection_template_;
+  mutable std::atomic<bool> executed_without_projection_template_{false};
 };
 
 }  // namespace ql
@@ -73,7 +73,8 @@ const std::map<std::string, PTTableProperty::KVProperty> PTTableProperty::kPrope
     {"read_repair_chance", KVProperty::kReadRepairChance},
     {"speculative_retry", KVProperty::kSpeculativeRetry},
     {"transactions", KVProperty::kTransactions},
-    {"tablets", KVProperty::kNumTablets}
+    {"tablets", KVProperty::kNumTablets},
+    {"history_retention_interval_sec", KVProperty::kHistoryRetentionIntervalSec}
 };
 
 PTTableProperty::PTTableProperty(MemoryContext *memctx,
@@ -182,7 +183,8 @@ Status PTTableProperty::Analyze(SemContext *sem_context) {
       }
       break;
     case KVProperty::kGcGraceSeconds: FALLTHROUGH_INTENDED;
-    case KVProperty::kMemtableFlushPeriodInMs:
+    case KVProperty::kMemtableFlushPeriodInMs: FALLTHROUGH_INTENDED;
+    case KVProperty::kHistoryRetentionIntervalSec:
       RETURN_SEM_CONTEXT_ERROR_NOT_OK(GetIntValueFromExpr(rhs_, table_property_name, &int_val));
       if (int_val < 0) {
         return sem_context->Error(this,
@@ -384,7 +386,7 @@ Status PTTableProperty::SetTableProperty(yb::TableProperties *table_property) co
     case KVProperty::kTransactions:
       LOG(ERROR) << "Not primitive table property " << table_property_name;
       break;
-    case KVProperty::kNumTablets:
+    case KVProperty::kNumTablets: {
       int64_t val;
       auto status = GetIntValueFromExpr(rhs_, table_property_name, &val);
       if (!status.ok()) {
@@ -392,6 +394,17 @@ Status PTTableProperty::SetTableProperty(yb::TableProperties *table_property) co
       }
       table_property->SetNumTablets(trim_cast<int32_t>(val));
       break;
+    }
+    case KVProperty::kHistoryRetentionIntervalSec: {
+      // Zero resets the table to timestamp_history_retention_interval_sec.
+      int64_t val;
+      auto status = GetIntValueFromExpr(rhs_, table_property_name, &val);
+      if (!status.ok()) {
+        return status.CloneAndAppend("Invalid value for history_retention_interval_sec");
+      }
+      table_property->SetHistoryRetentionIntervalSec(trim_cast<int32_t>(val));
+      break;
+    }
   }
   return Status::OK();
 }
@@ -48,7 +48,8 @@ class PTTableProperty : public PTProperty {
     kReadRepairChance,
     kSpeculativeRetry,
     kTransactions,
-    kNumTablets
+    kNumTablets,
+    kHistoryRetentionIntervalSec
   };
 
   //------------------------------------------------------------------------------------------------
@@ -265,6 +265,37 @@ TEST_F(TestQLCreateTable, TestQLCreateTableWithTTL) {
   EXPECT_EQ(1000, properties_pb.default_time_to_live());
 }
 
+TEST_F(TestQLCreateTable, TestQLCreateTableWithHistoryRetentionInterval) {
+  // Init the simulated cluster.
+  ASSERT_NO_FATALS(CreateSimulatedCluster());
+
+  // Get an available processor.
+  TestQLProcessor *processor = GetQLProcessor();
+
+  EXEC_INVALID_STMT("CREATE TABLE invalid_retention (c1 int PRIMARY KEY) WITH "
+                        "history_retention_interval_sec = -1;");
+  EXEC_VALID_STMT("CREATE TABLE table_with_retention (c1 int, c2 int, PRIMARY KEY(c1)) WITH "
+                      "history_retention_interval_sec = 60;");
+
+  auto *catalog_manager = &cluster_->mini_master()->catalog_manager();
+  master::GetTableSchemaRequestPB request_pb;
+  master::GetTableSchemaResponsePB response_pb;
+  request_pb.mutable_table()->mutable_namespace_()->set_name(kDefaultKeyspaceName);
+  request_pb.mutable_table()->set_table_name("table_with_retention");
+
+  CHECK_OK(catalog_manager->GetTableSchema(&request_pb, &response_pb));
+  EXPECT_EQ(60, response_pb.schema().table_properties().history_retention_interval_sec());
+
+  EXEC_VALID_STMT("ALTER TABLE table_with_retention WITH history_retention_interval_sec = 5;");
+  CHECK_OK(catalog_manager->GetTableSchema(&request_pb, &response_pb));
+  EXPECT_EQ(5, response_pb.schema().table_properties().history_retention_interval_sec());
+
+  // Zero restores timestamp_history_retention_interval_sec for the table.
+  EXEC_VALID_STMT("ALTER TABLE table_with_retention WITH history_retention_interval_sec = 0;");
+  CHECK_OK(catalog_manager->GetTableSchema(&request_pb, &response_pb));
+  EXPECT_EQ(0, response_pb.schema().table_properties().history_retention_interval_sec());
+}
+
 TEST_F(TestQLCreateTable, TestQLCreateTableWithClusteringOrderBy) {
   // Init the simulated cluster.
   ASSERT_NO_FATALS(CreateSimulatedCluster());
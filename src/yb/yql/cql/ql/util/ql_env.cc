@@ -44,6 +44,9 @@ DEFINE_UNKNOWN_bool(ycql_use_local_transaction_tables, false,
             "Whether or not to use local transaction tables when possible for YCQL transactions.");
 DEFINE_RUNTIME_bool(ycql_allow_local_calls_in_curr_thread, true,
                     "Whether or not to allow local calls on the RPC thread.");
+DEFINE_RUNTIME_bool(ycql_coalesce_session_flushes, false,
+                    "Whether non-transactional writes flushed concurrently by different YCQL "
+                    "sessions could be combined into shared tablet RPCs.");
 
 namespace yb {
 namespace ql {
@@ -118,6 +121,9 @@ Result<YBTransactionPtr> QLEnv::NewTransaction(const YBTransactionPtr& transacti
 YBSessionPtr QLEnv::NewSession(CoarseTimePoint deadline) {
   auto session = std::make_shared<YBSession>(client_, deadline, clock_);
   session->set_allow_local_calls_in_curr_thread(FLAGS_ycql_allow_local_calls_in_curr_thread);
+  if (FLAGS_ycql_coalesce_session_flushes) {
+    session->SetFlushCoalescer(client_->flush_coalescer());
+  }
   return session;
 }
 
@@ -367,7 +367,8 @@ Status PgDml::Fetch(int32_t natts,
 
   // Keep reading until we either reach the end or get some rows.
   *has_data = true;
-  PgTuple pg_tuple(values, isnulls, syscols);
+  PgTuple pg_tuple(
+      values, isnulls, syscols, borrow_fetched_values_ && FLAGS_ysql_borrow_fetched_values);
   while (!VERIFY_RESULT(GetNextRow(&pg_tuple))) {
     if (!VERIFY_RESULT(FetchDataFromServer())) {
       // Stop processing as server returns no more rows.
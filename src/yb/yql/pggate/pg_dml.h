@@ -78,6 +78,12 @@ class PgDml : public PgStatement {
                PgSysColumns *syscols,
                bool *has_data);
 
+  // Let fetched TEXT and BYTEA values point into the response buffer instead of copying them.
+  // Such values are valid only until the next Fetch call.
+  void SetBorrowFetchedValues(bool borrow_fetched_values) {
+    borrow_fetched_values_ = borrow_fetched_values;
+  }
+
   // Returns TRUE if docdb replies with more data.
   Result<bool> FetchDataFromServer();
 
@@ -245,6 +251,7 @@ class PgDml : public PgStatement {
   // Data members for navigating the output / result-set from either seleted or returned targets.
   std::list<PgDocResult> rowsets_;
   int64_t current_row_order_ = 0;
+  bool borrow_fetched_values_ = false;
 
   // Yugabyte has a few IN/OUT parameters of statement execution, "pg_exec_params_" is used to sent
   // OUT value back to postgres.
@@ -152,6 +152,7 @@ void PgDmlWrite::AllocWriteRequest() {
   write_req_->dup_table_id(table_id_.GetYbTableId());
   write_req_->set_schema_version(target_->schema_version());
   write_req_->set_stmt_id(reinterpret_cast<uint64_t>(write_req_.get()));
+  write_req_->set_metrics_capture(pg_session_->metrics().metrics_capture());
 
   doc_op_ = std::make_shared<PgDocWriteOp>(pg_session_, &target_, std::move(write_op));
 }
@@ -58,7 +58,7 @@ class PgDocReadOpCached : private PgDocReadOpCachedHelper, public PgDocOp {
     data.swap(data_);
     if (data) {
       for (const auto& d : *data) {
-        result.emplace_back(d);
+        result.emplace_back(d).MarkDataShared();
       }
     }
     return result;
@@ -165,6 +165,11 @@ int64_t PgDocResult::NextRowOrder() {
 
 Status PgDocResult::WritePgTuple(const std::vector<PgFetchedTarget*>& targets, PgTuple *pg_tuple,
                                  int64_t *row_order) {
+  if (data_shared_ && pg_tuple->borrow_values()) {
+    auto tuple = pg_tuple->WithoutBorrowedValues();
+    return WritePgTuple(targets, &tuple, row_order);
+  }
+
   for (auto* target : targets) {
     if (PgDocData::ReadHeaderIsNull(&row_iterator_)) {
       target->SetNull(pg_tuple);
@@ -279,7 +284,9 @@ Result<std::list<PgDocResult>> PgDocOp::GetResult() {
 
   if (!end_of_data_) {
     // Send request now in case prefetching was suppressed.
-    if (suppress_next_result_prefetching_ && !response_.Valid()) {
+    if ((suppress_next_result_prefetching_ || next_result_prefetching_deferred_) &&
+        !response_.Valid()) {
+      next_result_prefetching_deferred_ = false;
       RETURN_NOT_OK(SendRequest());
     }
 
@@ -303,13 +310,36 @@ Result<std::list<PgDocResult>> PgDocOp::GetResult() {
     DCHECK(!result.empty() || end_of_data_);
     // Prefetch next portion of data if needed.
     if (!(end_of_data_ || suppress_next_result_prefetching_)) {
-      RETURN_NOT_OK(SendRequest());
+      if (PrefetchFitsMemoryBudget(result)) {
+        RETURN_NOT_OK(SendRequest());
+      } else {
+        next_result_prefetching_deferred_ = true;
+      }
     }
   }
 
   return result;
 }
 
+bool PgDocOp::PrefetchFitsMemoryBudget(const std::list<PgDocResult>& result) {
+  const auto budget = FLAGS_ysql_prefetch_memory_budget_bytes;
+  if (budget == 0) {
+    return true;
+  }
+  size_t result_size = 0;
+  for (const auto& batch : result) {
+    result_size += batch.data_size();
+  }
+  // The prefetched result is expected to be of the same size as the current one, and both of them
+  // are kept in memory while postgres processes the current one.
+  if (2 * result_size <= budget) {
+    return true;
+  }
+  VLOG(1) << "Result of " << result_size << " bytes exceeds half of the prefetch memory budget "
+          << budget << ", next result is not prefetched";
+  return false;
+}
+
 Result<int32_t> PgDocOp::GetRowsAffectedCount() const {
   RETURN_NOT_OK(exec_status_);
   DCHECK(end_of_data_);
@@ -1236,7 +1266,10 @@ Status PgDocReadOp::CompleteProcessResponse() {
 
     if (res.has_sampling_state()) {
       VLOG(1) << "Received sampling state: " << res.sampling_state().ShortDebugString();
-      sample_rows_ = res.sampling_state().samplerows();
+      const auto& res_sampling_state = res.sampling_state();
+      sample_rows_ = res_sampling_state.has_estimated_total_rows()
+          ? res_sampling_state.estimated_total_rows()
+          : res_sampling_state.samplerows();
 
       // Copy sampling state from the response to propagate in later requests for continuing further
       // sampling.
@@ -79,10 +79,23 @@ class PgDocResult {
     return row_count_;
   }
 
+  // Size of the data selected from DocDB.
+  size_t data_size() const {
+    return data_.second.size();
+  }
+
+  // Data is shared with other results, so values should not be borrowed from it.
+  void MarkDataShared() {
+    data_shared_ = true;
+  }
+
  private:
   // Data selected from DocDB.
   rpc::SidecarHolder data_;
 
+  // Borrowing values overwrites their size prefixes in "data_", see PgTuple::borrow_values.
+  bool data_shared_ = false;
+
   // Iterator on "data_" from row to row.
   Slice row_iterator_;
 
@@ -338,6 +351,10 @@ class PgDocOp : public std::enable_shared_from_this<PgDocOp> {
   // Next request will be sent in case upper level will ask for additional data.
   bool suppress_next_result_prefetching_ = false;
 
+  // Prefetching of the next result was skipped because the last result exceeded the prefetch
+  // memory budget. Next request will be sent in case upper level will ask for additional data.
+  bool next_result_prefetching_deferred_ = false;
+
   // Populated protobuf request.
   std::vector<PgsqlOpPtr> pgsql_ops_;
 
@@ -413,6 +430,10 @@ class PgDocOp : public std::enable_shared_from_this<PgDocOp> {
 
   void RecordRequestMetrics();
 
+  // Returns true if prefetching the result following the specified one keeps both of them within
+  // ysql_prefetch_memory_budget_bytes.
+  static bool PrefetchFitsMemoryBudget(const std::list<PgDocResult>& result);
+
   Result<std::list<PgDocResult>> ProcessResponse(const Result<PgDocResponse::Data>& data);
 
   Result<std::list<PgDocResult>> ProcessResponseImpl(const Result<PgDocResponse::Data>& data);
@@ -21,6 +21,7 @@
 #include "yb/client/schema.h"
 
 #include "yb/common/pg_system_attr.h"
+#include "yb/common/pg_types.h"
 #include "yb/common/ql_type.h"
 
 #include "yb/util/decimal.h"
@@ -48,6 +49,27 @@ namespace {
 constexpr uint8_t kDeterministicCollation = 0x01;
 constexpr uint8_t kCollationMarker = 0x80;
 
+bool IsPgType(const YBCPgTypeEntity* type_entity, PgOid type_oid) {
+  return static_cast<PgOid>(type_entity->type_oid) == type_oid;
+}
+
+// Size of the header of a postgres varlena with 4 byte header, see VARHDRSZ in postgres.h.
+constexpr size_t kVarlenaHeaderSize = 4;
+
+// Makes postgres varlena from size bytes at data without copying them, by overwriting the preceding
+// bytes of the value size prefix with the varlena header. Returns 0 when it is not possible.
+uint64_t BorrowVarlena(const uint8_t* data, int64_t size) {
+  auto* header = const_cast<uint8_t*>(data) - kVarlenaHeaderSize;
+  if (size > kYBCMaxPostgresTextSizeBytes ||
+      reinterpret_cast<uintptr_t>(header) % alignof(uint32_t) != 0) {
+    return 0;
+  }
+  // See SET_VARSIZE_4B in postgres.h.
+  static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "Only little endian is supported");
+  *reinterpret_cast<uint32_t*>(header) = static_cast<uint32_t>((size + kVarlenaHeaderSize) << 2);
+  return reinterpret_cast<uint64_t>(header);
+}
+
 Slice MakeCollationEncodedString(
   ThreadSafeArena* arena, const char* value, int64_t bytes, uint8_t collation_flags,
   const char* sortkey) {
@@ -428,10 +450,13 @@ class PgTextColumnRef : public Base {
     DCHECK(*text.cend() == '\0' && (text.empty() || !text.ends_with('\0')))
         << "Data received from DocDB does not have expected format";
 
+    uint64_t datum = 0;
     if (kCollate) {
       text = DecodeCollationEncodedString(text);
+    } else if (tuple->borrow_values() && IsPgType(Base::type_entity_, kPgTextOid)) {
+      datum = BorrowVarlena(text.data(), text.size());
     }
-    Base::DoSetDatum(tuple, Base::YbToDatum(text.cdata(), text.size()));
+    Base::DoSetDatum(tuple, datum ? datum : Base::YbToDatum(text.cdata(), text.size()));
     data->remove_prefix(data_size);
   }
 };
@@ -444,7 +469,11 @@ class PgBinaryColumnRef : public Base {
 
   void SetValue(Slice* data, PgTuple* tuple) override {
     auto data_size = PgDocData::ReadNumber<int64_t>(data);
-    Base::DoSetDatum(tuple, Base::YbToDatum(data->data(), data_size));
+    uint64_t datum = 0;
+    if (tuple->borrow_values() && IsPgType(Base::type_entity_, kPgByteArrayOid)) {
+      datum = BorrowVarlena(data->data(), data_size);
+    }
+    Base::DoSetDatum(tuple, datum ? datum : Base::YbToDatum(data->data(), data_size));
     data->remove_prefix(data_size);
   }
 };
@@ -13,6 +13,8 @@
 
 #include "yb/yql/pggate/pg_operation_buffer.h"
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <ostream>
 #include <unordered_set>
@@ -145,6 +147,8 @@ using RowKeys = std::unordered_set<RowIdentifier, boost::hash<RowIdentifier>>;
 struct InFlightOperation {
   RowKeys keys;
   PerformFuture future;
+  // Operations whose responses carry storage metrics, kept only when metrics are captured.
+  PgsqlOps ops_with_metrics;
 
   explicit InFlightOperation(PerformFuture future_)
       : future(std::move(future_)) {}
@@ -166,6 +170,33 @@ void EnsureCapacity(InFlightOps* in_flight_ops, BufferingSettings buffering_sett
   }
 }
 
+// All the buffered operations are for different rows, so the order in which they are sent does
+// not matter. Sending them ordered by table and key, i.e. in the order DocDB stores the rows, lets
+// the tablets of bulk loads, like COPY FROM with non-transactional writes, insert long runs of
+// ordered keys into their memtables.
+void SortByRowId(BufferableOperations* ops, const std::vector<RowIdentifier>& row_ids) {
+  DCHECK_EQ(ops->size(), row_ids.size());
+  std::vector<size_t> order(row_ids.size());
+  std::iota(order.begin(), order.end(), 0);
+  auto less = [&row_ids](size_t lhs, size_t rhs) {
+    const auto& lhs_id = row_ids[lhs];
+    const auto& rhs_id = row_ids[rhs];
+    return lhs_id.table_id() == rhs_id.table_id()
+        ? lhs_id.ybctid().compare(rhs_id.ybctid()) < 0
+        : lhs_id.table_id() < rhs_id.table_id();
+  };
+  if (std::is_sorted(order.begin(), order.end(), less)) {
+    return;
+  }
+  std::sort(order.begin(), order.end(), less);
+  BufferableOperations sorted;
+  sorted.Reserve(order.size());
+  for (auto idx : order) {
+    sorted.Add(std::move(ops->operations[idx]), ops->relations[idx]);
+  }
+  ops->Swap(&sorted);
+}
+
 } // namespace
 
 void BufferableOperations::Add(PgsqlOpPtr op, const PgObjectId& relation) {
@@ -226,6 +257,7 @@ class PgOperationBuffer::Impl {
   void Clear() {
     VLOG_IF(1, !keys_.empty()) << "Dropping " << keys_.size() << " pending operations";
     ops_.Clear();
+    ops_row_ids_.clear();
     txn_ops_.Clear();
     keys_.clear();
     // Clearing of in_flight_ops_ might get blocked on future::get()
@@ -255,25 +287,22 @@ class PgOperationBuffer::Impl {
     // If multiple operations are performed in context of single RPC second operation will not
     // see the results of first operation on DocDB side.
     // Multiple operations on same row must be performed in context of different RPC.
-    // Flush is required in this case.
+    // So current buffer is sent in this case. There is no need to wait for its completion here,
+    // conflicts with in-flight operations are resolved when the buffer with the new operation is
+    // sent (see WaitForConflictingInFlightOps).
     RowIdentifier row_id(table.id(), table.schema(), op->write_request());
     if (PREDICT_FALSE(!keys_.insert(row_id).second)) {
-      RETURN_NOT_OK(Flush());
+      RETURN_NOT_OK(SendBuffer());
       keys_.insert(row_id);
-    } else {
-      // Prevent conflicts on in-flight operations which use current row_id.
-      for (auto i = in_flight_ops_.begin(); i != in_flight_ops_.end(); ++i) {
-        if (i->keys.find(row_id) != i->keys.end()) {
-          RETURN_NOT_OK(EnsureCompleted(i - in_flight_ops_.begin() + 1));
-          break;
-        }
-      }
     }
     auto& target = (transactional ? txn_ops_ : ops_);
     if (target.empty()) {
       target.Reserve(buffering_settings_.max_batch_size);
     }
     target.Add(std::move(op), table.id());
+    if (!transactional) {
+      ops_row_ids_.push_back(std::move(row_id));
+    }
     return keys_.size() >= buffering_settings_.max_batch_size
       ? SendBuffer()
       : Status::OK();
@@ -321,6 +350,12 @@ class PgOperationBuffer::Impl {
       auto result = VERIFY_RESULT(metrics_.CallWithDuration(
           [&future = in_flight_ops_.front().future] { return future.Get(); }, &duration));
       metrics_.FlushRequest(duration);
+      for (const auto& op : in_flight_ops_.front().ops_with_metrics) {
+        const auto* response = op->response();
+        if (response && response->has_metrics()) {
+          metrics_.RecordRequestMetrics(response->metrics());
+        }
+      }
       in_flight_ops_.pop_front();
     }
     return Status::OK();
@@ -346,7 +381,10 @@ class PgOperationBuffer::Impl {
     ops_.Swap(&ops);
     txn_ops_.Swap(&txn_ops);
     keys_.swap(keys);
+    SortByRowId(&ops, ops_row_ids_);
+    ops_row_ids_.clear();
 
+    RETURN_NOT_OK(WaitForConflictingInFlightOps(keys));
     const auto ops_count = keys.size();
     bool ops_sent = VERIFY_RESULT(SendOperations(
       interceptor, std::move(txn_ops), true /* transactional */, ops_count));
@@ -359,6 +397,24 @@ class PgOperationBuffer::Impl {
     return Status::OK();
   }
 
+  // Operations on same row must be applied in order they were added. So before sending the batch
+  // wait for completion of the last in-flight operation (and all the operations before it) which
+  // uses any of the batch keys. In-flight operations on other rows are not waited for, so the
+  // executor keeps producing rows while they are applied.
+  Status WaitForConflictingInFlightOps(const RowKeys& keys) {
+    for (auto i = in_flight_ops_.size(); i > 0; --i) {
+      const auto& in_flight_keys = in_flight_ops_[i - 1].keys;
+      const auto& smaller = keys.size() < in_flight_keys.size() ? keys : in_flight_keys;
+      const auto& larger = &smaller == &keys ? in_flight_keys : keys;
+      for (const auto& key : smaller) {
+        if (larger.find(key) != larger.end()) {
+          return EnsureCompleted(i);
+        }
+      }
+    }
+    return Status::OK();
+  }
+
   Result<bool> SendOperations(const SendInterceptor* interceptor,
                               BufferableOperations ops,
                               bool transactional,
@@ -377,8 +433,13 @@ class PgOperationBuffer::Impl {
         space_required -= in_flight_ops_.front().keys.size();
         RETURN_NOT_OK(EnsureCompleted(1));
       }
+      PgsqlOps ops_with_metrics;
+      if (metrics_.metrics_capture() != PgsqlMetricsCaptureType::PGSQL_METRICS_CAPTURE_NONE) {
+        ops_with_metrics = ops.operations;
+      }
       in_flight_ops_.push_back(
         InFlightOperation(VERIFY_RESULT(flusher_(std::move(ops), transactional))));
+      in_flight_ops_.back().ops_with_metrics = std::move(ops_with_metrics);
       return true;
     }
     return false;
@@ -404,6 +465,8 @@ class PgOperationBuffer::Impl {
   const Flusher flusher_;
   const BufferingSettings& buffering_settings_;
   BufferableOperations ops_;
+  // Row ids of ops_, in the same order.
+  std::vector<RowIdentifier> ops_row_ids_;
   BufferableOperations txn_ops_;
   RowKeys keys_;
   InFlightOps in_flight_ops_;
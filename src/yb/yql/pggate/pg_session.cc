@@ -681,7 +681,8 @@ Result<PerformFuture> PgSession::Perform(BufferableOperations&& ops, PerformOpti
       RETURN_NOT_OK(UpdateReadTime(&options, ops_read_time));
     }
   }
-  bool global_transaction = yb_force_global_transaction;
+  bool global_transaction =
+      yb_force_global_transaction || pg_txn_manager_->IsGlobalTransactionExpected();
   for (auto i = ops.operations.begin(); !global_transaction && i != ops.operations.end(); ++i) {
     global_transaction = !(*i)->is_region_local();
   }
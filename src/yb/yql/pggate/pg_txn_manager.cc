@@ -254,6 +254,11 @@ Status PgTxnManager::SetDeferrable(bool deferrable) {
   return Status::OK();
 }
 
+Status PgTxnManager::ExpectGlobalTransaction() {
+  global_transaction_expected_ = true;
+  return Status::OK();
+}
+
 uint64_t PgTxnManager::NewPriority(TxnPriorityRequirement txn_priority_requirement) {
   if (txn_priority_requirement == kHighestPriority) {
     return txn_priority_highpri_upper_bound;
@@ -413,6 +418,7 @@ void PgTxnManager::ResetTxnAndSession() {
   enable_tracing_ = false;
   read_time_for_follower_reads_ = HybridTime();
   read_time_manipulation_ = tserver::ReadTimeManipulation::NONE;
+  global_transaction_expected_ = false;
 }
 
 Status PgTxnManager::EnterSeparateDdlTxnMode() {
@@ -69,6 +69,9 @@ class PgTxnManager : public RefCountedThreadSafe<PgTxnManager> {
   Status SetEnableTracing(bool tracing);
   Status EnableFollowerReads(bool enable_follower_reads, int32_t staleness);
   Status SetDeferrable(bool deferrable);
+  // Marks that the current transaction accesses tables outside of the local region, so it should
+  // be started as global instead of being promoted later.
+  Status ExpectGlobalTransaction();
   Status EnterSeparateDdlTxnMode();
   Status ExitSeparateDdlTxnMode(Commit commit);
   void SetDdlHasSyscatalogChanges();
@@ -77,6 +80,7 @@ class PgTxnManager : public RefCountedThreadSafe<PgTxnManager> {
   IsolationLevel GetIsolationLevel() const { return isolation_level_; }
   bool IsDdlMode() const { return ddl_mode_.has_value(); }
   bool ShouldEnableTracing() const { return enable_tracing_; }
+  bool IsGlobalTransactionExpected() const { return global_transaction_expected_; }
 
   void SetupPerformOptions(
       tserver::PgPerformOptionsPB* options, EnsureReadTimeIsSet ensure_read_time);
@@ -123,6 +127,7 @@ class PgTxnManager : public RefCountedThreadSafe<PgTxnManager> {
   uint64_t follower_read_staleness_ms_ = 0;
   HybridTime read_time_for_follower_reads_;
   bool deferrable_ = false;
+  bool global_transaction_expected_ = false;
 
   std::optional<DdlMode> ddl_mode_;
 
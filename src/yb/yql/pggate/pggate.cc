@@ -409,7 +409,7 @@ void PgApiImpl::TupleIdBuilder::Prepare() {
   doc_key_.Clear();
 }
 
-Result<dockv::KeyBytes> PgApiImpl::TupleIdBuilder::Build(
+Result<Slice> PgApiImpl::TupleIdBuilder::Build(
     PgSession* session, const YBCPgYBTupleIdDescriptor& descr) {
   Prepare();
   auto target_desc = VERIFY_RESULT(session->LoadTable(
@@ -482,7 +482,9 @@ Result<dockv::KeyBytes> PgApiImpl::TupleIdBuilder::Build(
     doc_key_.set_hash(VERIFY_RESULT(
         target_desc->partition_schema().PgsqlHashColumnCompoundValue(hashed_values)));
   }
-  return doc_key_.Encode();
+  tuple_id_.Clear();
+  doc_key_.AppendTo(&tuple_id_);
+  return tuple_id_.AsSlice();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1372,7 +1374,7 @@ Status PgApiImpl::DmlFetch(PgStatement *handle, int32_t natts, uint64_t *values,
   return down_cast<PgDml*>(handle)->Fetch(natts, values, isnulls, syscols, has_data);
 }
 
-Result<dockv::KeyBytes> PgApiImpl::BuildTupleId(const YBCPgYBTupleIdDescriptor& descr) {
+Result<Slice> PgApiImpl::BuildTupleId(const YBCPgYBTupleIdDescriptor& descr) {
     return tuple_id_builder_.Build(pg_session_.get(), descr);
 }
 
@@ -1625,6 +1627,15 @@ Status PgApiImpl::SetForwardScan(PgStatement *handle, bool is_forward_scan) {
   return Status::OK();
 }
 
+Status PgApiImpl::SetBorrowFetchedValues(PgStatement *handle, bool borrow_fetched_values) {
+  if (!PgStatement::IsValidStmt(handle, StmtOp::STMT_SELECT)) {
+    // Invalid handle.
+    return STATUS(InvalidArgument, "Invalid statement handle");
+  }
+  down_cast<PgDml*>(handle)->SetBorrowFetchedValues(borrow_fetched_values);
+  return Status::OK();
+}
+
 Status PgApiImpl::SetDistinctPrefixLength(PgStatement *handle, int distinct_prefix_length) {
   if (!PgStatement::IsValidStmt(handle, StmtOp::STMT_SELECT)) {
     // Invalid handle.
@@ -1956,6 +1967,10 @@ Status PgApiImpl::SetTransactionDeferrable(bool deferrable) {
   return pg_txn_manager_->SetDeferrable(deferrable);
 }
 
+Status PgApiImpl::ExpectGlobalTransaction() {
+  return pg_txn_manager_->ExpectGlobalTransaction();
+}
+
 Status PgApiImpl::EnterSeparateDdlTxnMode() {
   // Flush all buffered operations as ddl txn use its own transaction session.
   RETURN_NOT_OK(pg_session_->FlushBufferedOperations());
@@ -1987,6 +2002,9 @@ Status PgApiImpl::SetActiveSubTransaction(SubTransactionId id) {
 }
 
 Status PgApiImpl::RollbackToSubTransaction(SubTransactionId id) {
+  // Referenced rows written by the rolled back subtransactions are gone and the locks taken by
+  // their FK checks are released, so the cached references can't be trusted anymore.
+  pg_session_->InvalidateForeignKeyReferenceCache();
   pg_session_->DropBufferedOperations();
   return pg_session_->RollbackToSubTransaction(id);
 }
@@ -486,7 +486,8 @@ class PgApiImpl {
   Status DmlAddYBTupleIdColumn(PgStatement *handle, int attr_num, uint64_t datum,
                                bool is_null, const YBCPgTypeEntity *type_entity);
 
-  Result<dockv::KeyBytes> BuildTupleId(const YBCPgYBTupleIdDescriptor& descr);
+  // Returned tuple id is valid until the next call.
+  Result<Slice> BuildTupleId(const YBCPgYBTupleIdDescriptor& descr);
 
   // DB Operations: SET, WHERE, ORDER_BY, GROUP_BY, etc.
   // + The following operations are run by DocDB.
@@ -562,6 +563,8 @@ class PgApiImpl {
 
   Status SetForwardScan(PgStatement *handle, bool is_forward_scan);
 
+  Status SetBorrowFetchedValues(PgStatement *handle, bool borrow_fetched_values);
+
   Status SetDistinctPrefixLength(PgStatement *handle, int distinct_prefix_length);
 
   Status ExecSelect(PgStatement *handle, const PgExecParameters *exec_params);
@@ -613,6 +616,7 @@ class PgApiImpl {
   Status SetTransactionIsolationLevel(int isolation);
   Status SetTransactionReadOnly(bool read_only);
   Status SetTransactionDeferrable(bool deferrable);
+  Status ExpectGlobalTransaction();
   Status SetEnableTracing(bool tracing);
   Status EnableFollowerReads(bool enable_follower_reads, int32_t staleness_ms);
   Status EnterSeparateDdlTxnMode();
@@ -732,13 +736,15 @@ class PgApiImpl {
 
   class TupleIdBuilder {
    public:
-    Result<dockv::KeyBytes> Build(PgSession* session, const YBCPgYBTupleIdDescriptor& descr);
+    Result<Slice> Build(PgSession* session, const YBCPgYBTupleIdDescriptor& descr);
 
    private:
     void Prepare();
 
     ThreadSafeArena arena_;
     dockv::DocKey doc_key_;
+    // Encoded tuple id, buffer is reused across keys.
+    dockv::KeyBytes tuple_id_;
     size_t counter_ = 0;
   };
 
@@ -16,8 +16,11 @@
 // (linked into postgres).
 
 #include "yb/util/flags.h"
+#include "yb/util/size_literals.h"
 #include "yb/yql/pggate/pggate_flags.h"
 
+using namespace yb::size_literals;
+
 DEFINE_UNKNOWN_int32(pgsql_rpc_keepalive_time_ms, 0,
              "If an RPC connection from a client is idle for this amount of time, the server "
              "will disconnect the client. Setting flag to 0 disables this clean up.");
@@ -46,6 +49,15 @@ DEPRECATE_FLAG(uint64, ysql_prefetch_limit, "04_2023");
 
 DEPRECATE_FLAG(double, ysql_backward_prefetch_scale_factor, "11_2022");
 
+DEFINE_RUNTIME_uint64(ysql_prefetch_memory_budget_bytes, 64_MB,
+    "Max memory of the fetched page and the page prefetched while postgres processes it. When a "
+    "fetched page is larger than half of this budget, the next page is not prefetched and is "
+    "requested when postgres needs more rows. 0 means unlimited.");
+
+DEFINE_NON_RUNTIME_bool(ysql_borrow_fetched_values, true,
+    "Whether scans could form tuples from TEXT and BYTEA values located in the response buffer, "
+    "instead of copying each value first.");
+
 DEFINE_UNKNOWN_uint64(ysql_session_max_batch_size, 3072,
               "Use session variable ysql_session_max_batch_size instead. "
               "Maximum batch size for buffered writes between PostgreSQL server and YugaByte DocDB "
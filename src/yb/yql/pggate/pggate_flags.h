@@ -23,6 +23,8 @@ DECLARE_int32(pggate_tserver_shm_fd);
 DECLARE_int32(ysql_request_limit);
 DECLARE_uint64(ysql_prefetch_limit);
 DECLARE_double(ysql_backward_prefetch_scale_factor);
+DECLARE_uint64(ysql_prefetch_memory_budget_bytes);
+DECLARE_bool(ysql_borrow_fetched_values);
 DECLARE_uint64(ysql_session_max_batch_size);
 DECLARE_bool(ysql_non_txn_copy);
 DECLARE_int32(ysql_max_read_restart_attempts);
@@ -21,8 +21,8 @@
 namespace yb {
 namespace pggate {
 
-PgTuple::PgTuple(uint64_t *datums, bool *isnulls, PgSysColumns *syscols)
-    : datums_(datums), isnulls_(isnulls), syscols_(syscols) {
+PgTuple::PgTuple(uint64_t *datums, bool *isnulls, PgSysColumns *syscols, bool borrow_values)
+    : datums_(datums), isnulls_(isnulls), syscols_(syscols), borrow_values_(borrow_values) {
 }
 
 void PgTuple::WriteNull(int index) {
@@ -25,10 +25,11 @@ namespace pggate {
 // most datatype except numeric. A simpler optimization would be allocate one buffer for each
 // tuple and write the value there.
 //
-// Currently we allocate one individual buffer per column and write result there.
+// Currently we allocate one individual buffer per column and write result there. The exception
+// is tuples that borrow values: TEXT and BYTEA values of such tuples point into the DocDB buffer.
 class PgTuple {
  public:
-  PgTuple(uint64_t *datums, bool *isnulls, PgSysColumns *syscols);
+  PgTuple(uint64_t *datums, bool *isnulls, PgSysColumns *syscols, bool borrow_values = false);
 
   // Write null value.
   void WriteNull(int index);
@@ -41,10 +42,21 @@ class PgTuple {
     return syscols_;
   }
 
+  // Whether variable length values could point into the buffer they were fetched from instead of
+  // being copied. Such values are valid only until the next row is fetched.
+  bool borrow_values() const {
+    return borrow_values_;
+  }
+
+  PgTuple WithoutBorrowedValues() const {
+    return PgTuple(datums_, isnulls_, syscols_);
+  }
+
  private:
   uint64_t *datums_;
   bool *isnulls_;
   PgSysColumns *syscols_;
+  bool borrow_values_;
 };
 
 }  // namespace pggate
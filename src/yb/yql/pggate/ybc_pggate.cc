@@ -174,7 +174,7 @@ YBCStatus ExtractValueFromResult(Result<T> result, T* value) {
 template<class Processor>
 Status ProcessYbctidImpl(const YBCPgYBTupleIdDescriptor& source, const Processor& processor) {
   auto ybctid = VERIFY_RESULT(pgapi->BuildTupleId(source));
-  return processor(source.table_oid, ybctid.AsSlice());
+  return processor(source.table_oid, ybctid);
 }
 
 template<class Processor>
@@ -1181,6 +1181,10 @@ YBCStatus YBCPgSetForwardScan(YBCPgStatement handle, bool is_forward_scan) {
   return ToYBCStatus(pgapi->SetForwardScan(handle, is_forward_scan));
 }
 
+YBCStatus YBCPgSetBorrowFetchedValues(YBCPgStatement handle, bool borrow_fetched_values) {
+  return ToYBCStatus(pgapi->SetBorrowFetchedValues(handle, borrow_fetched_values));
+}
+
 YBCStatus YBCPgSetDistinctPrefixLength(YBCPgStatement handle, int distinct_prefix_length) {
   return ToYBCStatus(pgapi->SetDistinctPrefixLength(handle, distinct_prefix_length));
 }
@@ -1408,6 +1412,10 @@ YBCStatus YBCPgSetTransactionDeferrable(bool deferrable) {
   return ToYBCStatus(pgapi->SetTransactionDeferrable(deferrable));
 }
 
+YBCStatus YBCPgExpectGlobalTransaction() {
+  return ToYBCStatus(pgapi->ExpectGlobalTransaction());
+}
+
 YBCStatus YBCPgEnterSeparateDdlTxnMode() {
   return ToYBCStatus(pgapi->EnterSeparateDdlTxnMode());
 }
@@ -540,6 +540,11 @@ YBCStatus YBCPgNewSelect(YBCPgOid database_oid,
 // Set forward/backward scan direction.
 YBCStatus YBCPgSetForwardScan(YBCPgStatement handle, bool is_forward_scan);
 
+// Let YBCPgDmlFetch return TEXT and BYTEA values that point into the response buffer instead of
+// copies. Such values are valid only until the next YBCPgDmlFetch call on the statement, so this is
+// only allowed when the caller copies fetched values before that, e.g. by forming a tuple.
+YBCStatus YBCPgSetBorrowFetchedValues(YBCPgStatement handle, bool borrow_fetched_values);
+
 // Set prefix length for distinct index scans.
 YBCStatus YBCPgSetDistinctPrefixLength(YBCPgStatement handle, int distinct_prefix_length);
 
@@ -570,6 +575,7 @@ YBCStatus YBCPgAbortTransaction();
 YBCStatus YBCPgSetTransactionIsolationLevel(int isolation);
 YBCStatus YBCPgSetTransactionReadOnly(bool read_only);
 YBCStatus YBCPgSetTransactionDeferrable(bool deferrable);
+YBCStatus YBCPgExpectGlobalTransaction();
 YBCStatus YBCPgSetEnableTracing(bool tracing);
 YBCStatus YBCPgEnableFollowerReads(bool enable_follower_reads, int32_t staleness_ms);
 YBCStatus YBCPgEnterSeparateDdlTxnMode();
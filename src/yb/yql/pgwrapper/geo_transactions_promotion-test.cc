@@ -10,10 +10,16 @@
 // or implied.  See the License for the specific language governing permissions and limitations
 // under the License.
 
+#include "yb/client/transaction.h"
 #include "yb/client/transaction_manager.h"
+#include "yb/client/transaction_pool.h"
+#include "yb/client/yb_table_name.h"
 
 #include "yb/master/catalog_manager.h"
 
+#include "yb/tserver/mini_tablet_server.h"
+#include "yb/tserver/tablet_server.h"
+
 #include "yb/util/async_util.h"
 #include "yb/util/backoff_waiter.h"
 #include "yb/util/countdown_latch.h"
@@ -44,6 +50,8 @@ DECLARE_uint64(force_single_shard_waiter_retry_ms);
 DECLARE_uint64(refresh_waiter_timeout_ms);
 DECLARE_uint64(transaction_heartbeat_usec);
 
+METRIC_DECLARE_counter(transaction_promotions);
+
 namespace yb {
 
 namespace client {
@@ -455,6 +463,65 @@ TEST_F(GeoTransactionsPromotionTest, YB_DISABLE_TEST_IN_TSAN(TestSimple)) {
                        TestTransactionSuccess::kTrue);
 }
 
+// A statement that accesses a table in a remote tablespace should start the transaction as global,
+// even when its first flushed operation is local.
+TEST_F(GeoTransactionsPromotionTest,
+       YB_DISABLE_TEST_IN_TSAN(TestStatementWithRemoteTableStartsGlobal)) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_force_global_transactions) = false;
+  auto promotions = [this] {
+    int64_t result = 0;
+    for (size_t i = 0; i != cluster_->num_tablet_servers(); ++i) {
+      result += METRIC_transaction_promotions.Instantiate(
+          cluster_->mini_tablet_server(i)->server()->metric_entity())->value();
+    }
+    return result;
+  };
+  std::vector<TabletId> global_status_tablets;
+  ASSERT_OK(client_->GetTablets(
+      YBTableName(YQL_DATABASE_CQL, master::kSystemNamespaceName, kGlobalTransactionsTableName),
+      1000 /* max_tablets */, &global_status_tablets, nullptr /* ranges */));
+  auto check_last_transaction_global = [this, &global_status_tablets] {
+    auto metadata = transaction_pool_->TEST_GetLastTransaction()->GetMetadata(
+        TransactionRpcDeadline()).get();
+    ASSERT_OK(metadata);
+    ASSERT_TRUE(std::find(global_status_tablets.begin(), global_status_tablets.end(),
+                          metadata->status_tablet) != global_status_tablets.end());
+  };
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute("SET force_global_transaction = false"));
+  // Flush every write separately, so the local write reaches the tablet first.
+  ASSERT_OK(conn.Execute("SET ysql_session_max_batch_size = 1"));
+
+  // Local and remote tables accessed by separate statements promote the transaction.
+  auto initial_promotions = promotions();
+  ASSERT_OK(conn.StartTransaction(IsolationLevel::SERIALIZABLE_ISOLATION));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO $0$1_1(value) VALUES (1)", kTablePrefix, kLocalRegion));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO $0$1_1(value) VALUES (1)", kTablePrefix, kOtherRegion));
+  ASSERT_OK(conn.CommitTransaction());
+  ASSERT_EQ(promotions(), initial_promotions + 1);
+
+  // A single statement that accesses both starts a global transaction right away.
+  initial_promotions = promotions();
+  ASSERT_OK(conn.StartTransaction(IsolationLevel::SERIALIZABLE_ISOLATION));
+  ASSERT_OK(conn.ExecuteFormat(
+      "WITH local_rows AS (INSERT INTO $0$1_1(value) VALUES (2) RETURNING value) "
+      "INSERT INTO $0$2_1(value) SELECT value FROM local_rows",
+      kTablePrefix, kLocalRegion, kOtherRegion));
+  ASSERT_NO_FATALS(check_last_transaction_global());
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO $0$1_1(value) VALUES (3)", kTablePrefix, kLocalRegion));
+  ASSERT_OK(conn.CommitTransaction());
+  ASSERT_EQ(promotions(), initial_promotions);
+
+  ASSERT_EQ(2, ASSERT_RESULT(conn.FetchRow<PGUint64>(Format(
+      "SELECT COUNT(*) FROM $0$1_1", kTablePrefix, kOtherRegion))));
+  ASSERT_EQ(3, ASSERT_RESULT(conn.FetchRow<PGUint64>(Format(
+      "SELECT COUNT(*) FROM $0$1_1", kTablePrefix, kLocalRegion))));
+}
+
 TEST_F(GeoTransactionsPromotionTest, YB_DISABLE_TEST_IN_TSAN(TestRPCDelayed)) {
   // Commit will timeout due to it taking too long to send the transaction status moved RPCs.
   ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_txn_status_moved_rpc_send_delay_ms) = static_cast<uint32_t>(
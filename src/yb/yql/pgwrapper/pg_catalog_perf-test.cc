@@ -296,10 +296,10 @@ class PgCatalogWithStaleResponseCacheTest : public PgCatalogWithUnlimitedCachePe
   }
 };
 
-constexpr uint64_t kFirstConnectionRPCCountDefault = 5;
-constexpr uint64_t kFirstConnectionRPCCountWithAdditionalTables = 6;
+// The response cache is keyed by the catalog version from the tserver shared memory, so enabling
+// the cache doesn't add RPCs to a master.
+constexpr uint64_t kFirstConnectionRPCCount = 5;
 constexpr uint64_t kSubsequentConnectionRPCCount = 2;
-static_assert(kFirstConnectionRPCCountDefault <= kFirstConnectionRPCCountWithAdditionalTables);
 
 } // namespace
 
@@ -310,7 +310,7 @@ static_assert(kFirstConnectionRPCCountDefault <= kFirstConnectionRPCCountWithAdd
 //       Number of RPCs in all the tests are not the constants and they can be changed in future.
 TEST_F(PgCatalogPerfTest, StartupRPCCount) {
   const auto first_connect_rpc_count = ASSERT_RESULT(RPCCountOnStartUp());
-  ASSERT_EQ(first_connect_rpc_count, kFirstConnectionRPCCountDefault);
+  ASSERT_EQ(first_connect_rpc_count, kFirstConnectionRPCCount);
   const auto subsequent_connect_rpc_count = ASSERT_RESULT(RPCCountOnStartUp());
   ASSERT_EQ(subsequent_connect_rpc_count, kSubsequentConnectionRPCCount);
 }
@@ -536,21 +536,21 @@ TEST_F_EX(PgCatalogPerfTest,
           PgPreloadAdditionalCatListTest) {
   // No failures even there are invalid PG catalog on the flag list.
   const auto rpc_count = ASSERT_RESULT(RPCCountOnStartUp());
-  ASSERT_EQ(rpc_count, kFirstConnectionRPCCountWithAdditionalTables);
+  ASSERT_EQ(rpc_count, kFirstConnectionRPCCount);
 }
 
 TEST_F_EX(PgCatalogPerfTest,
           RPCCountOnStartupAdditionalCatTablesPreload,
           PgPreloadAdditionalCatTablesTest) {
   const auto rpc_count = ASSERT_RESULT(RPCCountOnStartUp());
-  ASSERT_EQ(rpc_count, kFirstConnectionRPCCountWithAdditionalTables);
+  ASSERT_EQ(rpc_count, kFirstConnectionRPCCount);
 }
 
 TEST_F_EX(PgCatalogPerfTest,
           RPCCountOnStartupAdditionalCatBothPreload,
           PgPreloadAdditionalCatBothTest) {
   const auto rpc_count = ASSERT_RESULT(RPCCountOnStartUp());
-  ASSERT_EQ(rpc_count, kFirstConnectionRPCCountWithAdditionalTables);
+  ASSERT_EQ(rpc_count, kFirstConnectionRPCCount);
 }
 
 // Test checks that response cache is DB specific.
@@ -564,7 +564,7 @@ TEST_F_EX(PgCatalogPerfTest,
 TEST_F_EX(PgCatalogPerfTest, ResponseCacheIsDBSpecific, PgCatalogWithUnlimitedCachePerfTest) {
   constexpr auto* kDBName = "db1";
   auto rpc_count_checker = [this](const std::string& db_name = {}) -> Status {
-    for (auto expected_rpc_count : {kFirstConnectionRPCCountWithAdditionalTables,
+    for (auto expected_rpc_count : {kFirstConnectionRPCCount,
                                     kSubsequentConnectionRPCCount}) {
       const auto rpc_count = VERIFY_RESULT(RPCCountOnStartUp(db_name));
       SCHECK_EQ(rpc_count, expected_rpc_count, IllegalState, "Unexpected rpc count");
@@ -581,7 +581,7 @@ TEST_F_EX(PgCatalogPerfTest,
           RPCCountOnStartupPredictableMemoryUsage,
           PgPredictableMemoryUsageTest) {
   const auto first_connect_rpc_count = ASSERT_RESULT(RPCCountOnStartUp());
-  ASSERT_EQ(first_connect_rpc_count, kFirstConnectionRPCCountWithAdditionalTables);
+  ASSERT_EQ(first_connect_rpc_count, kFirstConnectionRPCCount);
   const auto subsequent_connect_rpc_count = ASSERT_RESULT(RPCCountOnStartUp());
   ASSERT_EQ(subsequent_connect_rpc_count, kSubsequentConnectionRPCCount);
 }
@@ -490,6 +490,32 @@ TEST_F(PgFKeyTest, YB_DISABLE_TEST_IN_TSAN(UpdateBatching)) {
   ASSERT_EQ(rpc_count.perform, rpc_count.read + rpc_count.write - 1);
 }
 
+// Test checks that references cached by the transaction are dropped on rollback to savepoint.
+TEST_F(PgFKeyTest, RollbackToSavepointInvalidatesFKCache) {
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(CreateTables(&conn));
+  ASSERT_OK(AddFKConstraint(&conn));
+  ASSERT_OK(InsertItems(&conn, kPKTable, 1, 10));
+  ASSERT_OK(conn.StartTransaction(IsolationLevel::SNAPSHOT_ISOLATION));
+  ASSERT_OK(InsertItems(&conn, kFKTable, 1, 5));
+  ASSERT_OK(conn.Execute("SAVEPOINT s"));
+  // Row written by the transaction is added to the FK cache.
+  ASSERT_OK(InsertItems(&conn, kPKTable, 11, 11));
+  ASSERT_OK(conn.Execute("ROLLBACK TO SAVEPOINT s"));
+  ASSERT_NOK(conn.ExecuteFormat("INSERT INTO $0 VALUES (11, 11)", kFKTable));
+  ASSERT_OK(conn.RollbackTransaction());
+
+  ASSERT_OK(conn.StartTransaction(IsolationLevel::SNAPSHOT_ISOLATION));
+  ASSERT_OK(conn.Execute("SAVEPOINT s"));
+  ASSERT_OK(InsertItems(&conn, kFKTable, 1, 5));
+  ASSERT_OK(conn.Execute("ROLLBACK TO SAVEPOINT s"));
+  // References to existing rows are checked again and pass.
+  ASSERT_OK(InsertItems(&conn, kFKTable, 1, 10));
+  ASSERT_OK(conn.CommitTransaction());
+  ASSERT_EQ(ASSERT_RESULT(conn.FetchRow<PGUint64>(
+      Format("SELECT COUNT(*) FROM $0", kFKTable))), 10);
+}
+
 // Test checks rows written by buffered write operations are read successfully while
 // performing FK constraint check.
 TEST_F_EX(PgFKeyTest, BufferedWriteOfReferencedRows, PgFKeyTestNoFKCache) {
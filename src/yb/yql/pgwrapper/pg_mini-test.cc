@@ -78,6 +78,7 @@ DECLARE_bool(enable_wait_queues);
 DECLARE_double(TEST_respond_write_failed_probability);
 DECLARE_double(TEST_transaction_ignore_applying_probability);
 
+DECLARE_int32(TEST_parallel_scan_stop_range);
 DECLARE_int32(TEST_txn_participant_inject_latency_on_apply_update_txn_ms);
 DECLARE_int32(heartbeat_interval_ms);
 DECLARE_int32(history_cutoff_propagation_interval_ms);
@@ -100,7 +101,10 @@ DECLARE_int64(tablet_split_high_phase_size_threshold_bytes);
 DECLARE_int64(tablet_split_low_phase_shard_count_per_node);
 DECLARE_int64(tablet_split_low_phase_size_threshold_bytes);
 
+DECLARE_uint32(ysql_aggregate_batch_size);
+DECLARE_uint32(ysql_parallel_scan_max_ranges);
 DECLARE_uint64(max_clock_skew_usec);
+DECLARE_uint64(ysql_parallel_scan_min_range_size_bytes);
 
 DECLARE_string(time_source);
 
@@ -603,6 +607,160 @@ TEST_F_EX(PgMiniTest, YB_DISABLE_TEST_IN_SANITIZERS(ReadRestartSnapshot),
   TestReadRestart(false /* deferrable */);
 }
 
+namespace {
+
+constexpr int kParallelScanRanges = 4;
+
+void EnableParallelScan() {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_ysql_parallel_scan_max_ranges) = kParallelScanRanges;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_ysql_parallel_scan_min_range_size_bytes) = 1;
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_ysql_aggregate_batch_size) = 16;
+  // Every flush adds a file, whose boundaries are used as split points.
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_rocksdb_disable_compactions) = true;
+}
+
+// Inserts rows with keys [0, num_rows) into the table, flushing them to num_files files.
+void FillParallelScanTable(
+    MiniCluster* cluster, PGConn* conn, const std::string& table, int num_rows, int num_files) {
+  for (int i = 0; i != num_files; ++i) {
+    ASSERT_OK(conn->ExecuteFormat(
+        "INSERT INTO $0 SELECT i, i % 1000 - 500 FROM generate_series($1, $2) AS i",
+        table, num_rows * i / num_files, num_rows * (i + 1) / num_files - 1));
+    ASSERT_OK(cluster->FlushTablets());
+  }
+}
+
+} // namespace
+
+class PgParallelScanTest : public PgMiniTestSingleNode {
+ protected:
+  void SetUp() override {
+    EnableParallelScan();
+    PgMiniTestSingleNode::SetUp();
+  }
+
+  // Returns value of the first EXPLAIN (ANALYZE, DIST, DEBUG) line with the specified label,
+  // or 0 when there is no such line.
+  Result<double> GetExplainValue(PGConn* conn, const std::string& query, const std::string& label) {
+    auto lines = VERIFY_RESULT(conn->FetchRows<std::string>(
+        "EXPLAIN (ANALYZE, DIST, DEBUG) " + query));
+    const auto prefix = label + ": ";
+    for (const auto& line : lines) {
+      auto pos = line.find(prefix);
+      if (pos != std::string::npos) {
+        return std::stod(line.substr(pos + prefix.size()));
+      }
+    }
+    return 0;
+  }
+
+  // Checks that aggregates evaluated by parallel scan match the sequential scan, also when the
+  // scan of some range is stopped and continued by the next page.
+  void TestAggregates(const std::string& create_table_stmt) {
+    constexpr int kNumRows = 10000;
+    constexpr int kNumFiles = 8;
+    const std::string kQuery = "SELECT COUNT(*), SUM(v), MIN(v), MAX(v) FROM t";
+    using Aggregates = std::tuple<int64_t, int64_t, int32_t, int32_t>;
+
+    auto conn = ASSERT_RESULT(Connect());
+    ASSERT_OK(conn.Execute(create_table_stmt));
+    ASSERT_NO_FATALS(FillParallelScanTable(cluster_.get(), &conn, "t", kNumRows, kNumFiles));
+
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_ysql_parallel_scan_max_ranges) = 0;
+    Aggregates expected = ASSERT_RESULT((conn.FetchRow<int64_t, int64_t, int32_t, int32_t>(
+        kQuery)));
+    ASSERT_EQ(std::get<0>(expected), kNumRows);
+    auto sequential_requests = ASSERT_RESULT(
+        GetExplainValue(&conn, kQuery, "Storage Table Read Requests"));
+    auto sequential_nexts = ASSERT_RESULT(
+        GetExplainValue(&conn, kQuery, "Metric rocksdb_number_db_next"));
+
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_ysql_parallel_scan_max_ranges) = kParallelScanRanges;
+    Aggregates actual = ASSERT_RESULT((conn.FetchRow<int64_t, int64_t, int32_t, int32_t>(
+        kQuery)));
+    ASSERT_EQ(expected, actual);
+    ASSERT_EQ(sequential_requests, ASSERT_RESULT(
+        GetExplainValue(&conn, kQuery, "Storage Table Read Requests")));
+    // Statistics of all ranges are reported, not only of the first one.
+    auto parallel_nexts = ASSERT_RESULT(
+        GetExplainValue(&conn, kQuery, "Metric rocksdb_number_db_next"));
+    ASSERT_GE(parallel_nexts * 4, sequential_nexts * 3);
+
+    // Stopping any range returns the aggregates merged up to it, the rest is read by next pages.
+    for (int stop_range = 0; stop_range != kParallelScanRanges; ++stop_range) {
+      ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_parallel_scan_stop_range) = stop_range;
+      actual = ASSERT_RESULT((conn.FetchRow<int64_t, int64_t, int32_t, int32_t>(kQuery)));
+      ASSERT_EQ(expected, actual) << "Stop range: " << stop_range;
+      ASSERT_GT(ASSERT_RESULT(GetExplainValue(&conn, kQuery, "Storage Table Read Requests")),
+                sequential_requests) << "Stop range: " << stop_range;
+    }
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_parallel_scan_stop_range) = -1;
+
+    // Filtered aggregates use the sequential scan.
+    auto filtered_count = ASSERT_RESULT(conn.FetchRow<int64_t>(
+        "SELECT COUNT(*) FROM t WHERE v > 0"));
+    ASSERT_EQ(filtered_count, kNumRows / 1000 * 499);
+  }
+};
+
+TEST_F(PgParallelScanTest, HashTableAggregates) {
+  TestAggregates("CREATE TABLE t (k INT, v INT, PRIMARY KEY (k HASH)) SPLIT INTO 1 TABLETS");
+}
+
+TEST_F(PgParallelScanTest, RangeTableAggregates) {
+  TestAggregates("CREATE TABLE t (k INT, v INT, PRIMARY KEY (k ASC))");
+}
+
+class PgParallelScanClockSkewTest : public PgMiniLargeClockSkewTest {
+ protected:
+  void SetUp() override {
+    EnableParallelScan();
+    PgMiniLargeClockSkewTest::SetUp();
+  }
+};
+
+// Rows written by the concurrent transaction in any range, after the read time but within the clock
+// skew, should restart the read. Otherwise the aggregate could miss an already committed value.
+TEST_F_EX(PgMiniTest, YB_DISABLE_TEST_IN_SANITIZERS(ParallelScanReadRestart),
+          PgParallelScanClockSkewTest) {
+  constexpr int kNumRows = 4000;
+  constexpr int kNumFiles = 8;
+  constexpr int kNumReadThreads = 4;
+  constexpr std::chrono::milliseconds kClockSkew = -100ms;
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute("CREATE TABLE t (k INT, v INT, PRIMARY KEY (k ASC))"));
+  ASSERT_NO_FATALS(FillParallelScanTable(cluster_.get(), &conn, "t", kNumRows, kNumFiles));
+
+  auto delta_changers = SkewClocks(cluster_.get(), kClockSkew);
+
+  TestThreadHolder thread_holder;
+  std::atomic<int> committed_value{0};
+  // The row of the last range is updated, so its value has to be merged from a range that is
+  // scanned in parallel.
+  const auto last_key = AsString(kNumRows - 1);
+  thread_holder.AddThreadFunctor(
+      [this, &committed_value, &stop = thread_holder.stop_flag(), last_key] {
+    auto write_conn = ASSERT_RESULT(Connect());
+    for (int value = 1000; !stop.load(std::memory_order_acquire); ++value) {
+      ASSERT_OK(write_conn.ExecuteFormat("UPDATE t SET v = $0 WHERE k = $1", value, last_key));
+      committed_value.store(value, std::memory_order_release);
+    }
+  });
+  for (int i = 0; i != kNumReadThreads; ++i) {
+    thread_holder.AddThreadFunctor([this, &committed_value, &stop = thread_holder.stop_flag()] {
+      auto read_conn = ASSERT_RESULT(Connect());
+      while (!stop.load(std::memory_order_acquire)) {
+        auto min_value = committed_value.load(std::memory_order_acquire);
+        auto value = ASSERT_RESULT(read_conn.FetchRow<int32_t>("SELECT MAX(v) FROM t"));
+        ASSERT_GE(value, min_value);
+      }
+    });
+  }
+  thread_holder.WaitAndStop(15s);
+  ASSERT_GT(committed_value.load(), 1000);
+}
+
 TEST_F_EX(PgMiniTest, SerializableReadOnly, PgMiniTestFailOnConflict) {
   PGConn read_conn = ASSERT_RESULT(Connect());
   PGConn setup_conn = ASSERT_RESULT(Connect());
@@ -203,6 +203,30 @@ TEST_F(PgOpBufferingTest, ConflictingOps) {
     ASSERT_EQ(write_rpc_count, 2);
 }
 
+// The test checks that operations on same row which are sent in different batches are applied in
+// order they were added, while batches are sent without waiting for completion of previous ones.
+TEST_F(PgOpBufferingTest, ConflictingOpsInFlight) {
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(CreateTable(&conn));
+  ASSERT_OK(SetMaxBatchSize(&conn, 2));
+  ASSERT_OK(conn.ExecuteFormat(
+      "DO $$$$" \
+      "BEGIN" \
+      "  INSERT INTO $0 VALUES(1, 1);" \
+      "  INSERT INTO $0 VALUES(2, 1);" \
+      "  UPDATE $0 SET v = 2 WHERE k = 1;" \
+      "  INSERT INTO $0 VALUES(3, 1);" \
+      "  UPDATE $0 SET v = 3 WHERE k = 1;" \
+      "  DELETE FROM $0 WHERE k = 2;" \
+      "  INSERT INTO $0 VALUES(2, 4);" \
+      "END$$$$;",
+      kTable));
+  const auto rows = ASSERT_RESULT((conn.FetchRows<int32_t, int32_t>(
+      Format("SELECT k, v FROM $0 ORDER BY k", kTable))));
+  const decltype(rows) expected = {{1, 3}, {2, 4}, {3, 1}};
+  ASSERT_EQ(rows, expected);
+}
+
 // The test checks that the 'duplicate key value violates unique constraint' error is correctly
 // handled for buffered operations. In the test row with existing ybctid is used (conflict by PK).
 TEST_F(PgOpBufferingTest, PKConstraintConflict) {
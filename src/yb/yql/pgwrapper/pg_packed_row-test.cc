@@ -550,6 +550,45 @@ TEST_P(PgPackedRowTest, PackDuringCompaction) {
   ASSERT_EQ(rows, expected_rows);
 }
 
+// Reads rows that interleave more schema versions than the reader keeps cached packings for, so
+// cached packings are evicted and looked up again while scanning.
+TEST_P(PgPackedRowTest, InterleavedSchemaVersions) {
+  constexpr int kVersions = 6;
+  constexpr int kRowsPerVersion = 5;
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute("CREATE TABLE t (key INT, PRIMARY KEY (key ASC))"));
+
+  std::string columns;
+  std::string sum;
+  for (int version = 0; version != kVersions; ++version) {
+    if (version) {
+      ASSERT_OK(conn.ExecuteFormat("ALTER TABLE t ADD COLUMN v$0 INT", version));
+      columns += Format(", v$0", version);
+      sum += Format(" + COALESCE(v$0, 0)", version);
+    }
+    // Keys of consecutive rows have consecutive schema versions.
+    for (int i = 0; i != kRowsPerVersion; ++i) {
+      auto key = i * kVersions + version;
+      std::string values = AsString(key);
+      for (int column = 0; column != version; ++column) {
+        values += Format(", $0", key);
+      }
+      ASSERT_OK(conn.ExecuteFormat("INSERT INTO t (key$0) VALUES ($1)", columns, values));
+    }
+  }
+
+  // Each row has a value equal to its key in the columns that existed when it was inserted.
+  std::vector<std::tuple<int32_t, int32_t, int32_t>> expected_rows;
+  for (int key = 0; key != kVersions * kRowsPerVersion; ++key) {
+    auto version = key % kVersions;
+    expected_rows.emplace_back(key, version, key * version);
+  }
+  auto rows = ASSERT_RESULT((conn.FetchRows<int32_t, int32_t, int32_t>(Format(
+      "SELECT key, num_nonnulls($0), 0$1 FROM t ORDER BY key", columns.substr(2), sum))));
+  ASSERT_EQ(rows, expected_rows);
+}
+
 // Check that we correctly interpret packed row size limit.
 TEST_P(PgPackedRowTest, BigValue) {
   constexpr size_t kValueLimit = 512;
@@ -61,6 +61,9 @@ DECLARE_int32(send_wait_for_report_interval_ms);
 DECLARE_uint64(TEST_inject_process_update_resp_delay_ms);
 DECLARE_uint64(TEST_delay_rpc_status_req_callback_ms);
 DECLARE_int32(TEST_txn_participant_inject_delay_on_start_shutdown_ms);
+DECLARE_bool(TEST_skip_deadlock_probes_on_wait_for_update);
+DECLARE_int32(deadlock_probe_full_scan_period);
+DECLARE_bool(wait_queue_defer_conflicting_resumed_waiters);
 
 using namespace std::literals;
 
@@ -495,6 +498,44 @@ TEST_F(PgWaitQueuesTest, YB_DISABLE_TEST_IN_TSAN(MultipleWaitersUnblock)) {
   thread_holder.WaitAndStop(10s * kTimeMultiplier);
 }
 
+// Waiters resumed together by the commit of their common blocker lock the same key, so all but the
+// first one are deferred by the resumed waiter runner. They should still be resumed and complete.
+TEST_F(PgWaitQueuesTest, YB_DISABLE_TEST_IN_TSAN(DeferredConflictingWaitersResume)) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_wait_queue_defer_conflicting_resumed_waiters) = true;
+  constexpr size_t kClients = 10;
+  auto setup_conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(setup_conn.Execute("CREATE TABLE foo (k INT PRIMARY KEY, v INT)"));
+  ASSERT_OK(setup_conn.Execute("INSERT INTO foo VALUES (0, 0)"));
+
+  ASSERT_OK(setup_conn.StartTransaction(IsolationLevel::SNAPSHOT_ISOLATION));
+  ASSERT_OK(setup_conn.Fetch("SELECT * FROM foo WHERE k=0 FOR UPDATE"));
+
+  TestThreadHolder thread_holder;
+  CountDownLatch started(kClients);
+  CountDownLatch done(kClients);
+  for (size_t i = 0; i != kClients; ++i) {
+    thread_holder.AddThreadFunctor([this, i, &started, &done] {
+      auto conn = ASSERT_RESULT(Connect());
+      ASSERT_OK(conn.StartTransaction(IsolationLevel::SNAPSHOT_ISOLATION));
+      started.CountDown();
+      ASSERT_OK(conn.Fetch("SELECT * FROM foo WHERE k=0 FOR UPDATE"));
+      LOG(INFO) << "Locked key " << i;
+      std::this_thread::sleep_for(10ms);
+      ASSERT_OK(conn.CommitTransaction());
+      done.CountDown();
+    });
+  }
+
+  ASSERT_TRUE(started.WaitFor(5s * kTimeMultiplier));
+  // Let all clients enter the wait queue before releasing the lock.
+  std::this_thread::sleep_for(1s * kTimeMultiplier);
+  ASSERT_EQ(done.count(), kClients);
+  ASSERT_OK(setup_conn.CommitTransaction());
+
+  ASSERT_TRUE(done.WaitFor(15s * kTimeMultiplier));
+  thread_holder.WaitAndStop(5s * kTimeMultiplier);
+}
+
 TEST_F(PgWaitQueuesTest, YB_DISABLE_TEST_IN_TSAN(LongWaitBeforeDeadlock)) {
   auto setup_conn = ASSERT_RESULT(Connect());
   constexpr int kClients = 2;
@@ -1074,6 +1115,39 @@ TEST_F(PgWaitQueuesTest, YB_DISABLE_TEST_IN_TSAN(ParallelUpdatesDetectDeadlock))
 }
 
 
+class PgWaitQueuesPartialProbeScanTest : public PgWaitQueuesTest {
+ protected:
+  void SetUp() override {
+    // Deadlocks are only detected by periodic probe rounds, none of which is a full scan.
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_TEST_skip_deadlock_probes_on_wait_for_update) = true;
+    ANNOTATE_UNPROTECTED_WRITE(FLAGS_deadlock_probe_full_scan_period) =
+        std::numeric_limits<int32_t>::max();
+    PgWaitQueuesTest::SetUp();
+  }
+};
+
+// Tests that a deadlock formed by new wait-for dependencies is detected by a round that only probes
+// changed waiters.
+TEST_F(PgWaitQueuesPartialProbeScanTest, YB_DISABLE_TEST_IN_TSAN(DetectDeadlock)) {
+  auto setup_conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(setup_conn.Execute("CREATE TABLE foo (k INT PRIMARY KEY, v INT)"));
+  ASSERT_OK(setup_conn.Execute("INSERT INTO foo VALUES (1, 1), (2, 2)"));
+
+  auto conn1 = ASSERT_RESULT(Connect());
+  auto conn2 = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn1.StartTransaction(IsolationLevel::SNAPSHOT_ISOLATION));
+  ASSERT_OK(conn2.StartTransaction(IsolationLevel::SNAPSHOT_ISOLATION));
+  ASSERT_OK(conn1.Fetch("SELECT * FROM foo WHERE k=1 FOR UPDATE"));
+  ASSERT_OK(conn2.Fetch("SELECT * FROM foo WHERE k=2 FOR UPDATE"));
+
+  auto deadline = GetDeadlockDetectedDeadline();
+  auto status_future =
+      ASSERT_RESULT(ExpectBlockedAsync(&conn1, "SELECT * FROM foo WHERE k=2 FOR UPDATE"));
+  auto status = conn2.Execute("SELECT * FROM foo WHERE k=1 FOR UPDATE");
+  ASSERT_FALSE(status.ok() && status_future.get().ok());
+  ASSERT_LE(CoarseMonoClock::Now(), deadline);
+}
+
 TEST_F(PgWaitQueuesTest, YB_DISABLE_TEST_IN_TSAN(MultiTabletFairness)) {
   constexpr int kNumUpdateConns = 20;
   constexpr int kNumKeys = 40;
@@ -613,7 +613,7 @@ class TabletOperations {
     if (!data.block) {
       ArenaAllocator<Block> alloc(arena);
       data.block = std::allocate_shared<Block>(
-          alloc, context, alloc, metrics_internal[static_cast<size_t>(OperationType::kRead)]);
+          alloc, context, alloc, metrics_internal[static_cast<size_t>(type)]);
       if (last_conflict_type_ == OperationType::kLocal) {
         last_local_block_->SetNext(data.block);
         last_conflict_type_ = type;